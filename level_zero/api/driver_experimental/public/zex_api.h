@@ -15,7 +15,10 @@
 #include <level_zero/ze_api.h>
 
 // driver experimental API headers
+#include "zex_cmdlist.h"
+#include "zex_device.h"
 #include "zex_driver.h"
+#include "zex_event.h"
 #include "zex_memory.h"
 #include "zex_module.h"
 
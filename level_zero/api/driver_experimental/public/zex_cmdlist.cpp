@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/api/driver_experimental/public/zex_api.h"
+#include "level_zero/core/source/cmdlist/cmdlist.h"
+
+namespace L0 {
+
+ze_result_t ZE_APICALL
+zexCommandListUpdateKernelLaunch(
+    ze_command_list_handle_t hCommandList,
+    uint32_t launchIndex,
+    ze_kernel_handle_t hKernel,
+    const ze_group_count_t *pLaunchFuncArgs) {
+    return L0::CommandList::fromHandle(hCommandList)->updateKernelLaunch(launchIndex, hKernel, pLaunchFuncArgs);
+}
+
+ze_result_t ZE_APICALL
+zexCommandListAppendLaunchMultipleKernels(
+    ze_command_list_handle_t hCommandList,
+    uint32_t numKernels,
+    const ze_kernel_handle_t *phKernels,
+    const ze_group_count_t *pLaunchFuncArgs,
+    ze_event_handle_t hSignalEvent,
+    uint32_t numWaitEvents,
+    ze_event_handle_t *phWaitEvents) {
+    return L0::CommandList::fromHandle(hCommandList)->appendLaunchMultipleKernels(numKernels, phKernels, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents);
+}
+
+ze_result_t ZE_APICALL
+zexCommandListBeginGraphCapture(
+    ze_command_list_handle_t hCommandList) {
+    return L0::CommandList::fromHandle(hCommandList)->beginGraphCapture();
+}
+
+ze_result_t ZE_APICALL
+zexCommandListEndGraphCapture(
+    ze_command_list_handle_t hCommandList,
+    ze_command_list_handle_t *phGraph) {
+    return L0::CommandList::fromHandle(hCommandList)->endGraphCapture(phGraph);
+}
+
+ze_result_t ZE_APICALL
+zexCommandListAppendGraph(
+    ze_command_list_handle_t hCommandList,
+    ze_command_list_handle_t hGraph) {
+    return L0::CommandList::fromHandle(hCommandList)->appendGraph(hGraph);
+}
+
+ze_result_t ZE_APICALL
+zexCommandListAppendConditionalLaunchKernel(
+    ze_command_list_handle_t hCommandList,
+    ze_kernel_handle_t hKernel,
+    const ze_group_count_t *pLaunchFuncArgs,
+    const uint32_t *pCondition,
+    ze_event_handle_t hSignalEvent,
+    uint32_t numWaitEvents,
+    ze_event_handle_t *phWaitEvents) {
+    return L0::CommandList::fromHandle(hCommandList)->appendConditionalLaunchKernel(hKernel, pLaunchFuncArgs, pCondition, hSignalEvent, numWaitEvents, phWaitEvents);
+}
+
+} // namespace L0
+
+extern "C" {
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListUpdateKernelLaunch(
+    ze_command_list_handle_t hCommandList,
+    uint32_t launchIndex,
+    ze_kernel_handle_t hKernel,
+    const ze_group_count_t *pLaunchFuncArgs) {
+    return L0::zexCommandListUpdateKernelLaunch(hCommandList, launchIndex, hKernel, pLaunchFuncArgs);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListAppendLaunchMultipleKernels(
+    ze_command_list_handle_t hCommandList,
+    uint32_t numKernels,
+    const ze_kernel_handle_t *phKernels,
+    const ze_group_count_t *pLaunchFuncArgs,
+    ze_event_handle_t hSignalEvent,
+    uint32_t numWaitEvents,
+    ze_event_handle_t *phWaitEvents) {
+    return L0::zexCommandListAppendLaunchMultipleKernels(hCommandList, numKernels, phKernels, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListBeginGraphCapture(
+    ze_command_list_handle_t hCommandList) {
+    return L0::zexCommandListBeginGraphCapture(hCommandList);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListEndGraphCapture(
+    ze_command_list_handle_t hCommandList,
+    ze_command_list_handle_t *phGraph) {
+    return L0::zexCommandListEndGraphCapture(hCommandList, phGraph);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListAppendGraph(
+    ze_command_list_handle_t hCommandList,
+    ze_command_list_handle_t hGraph) {
+    return L0::zexCommandListAppendGraph(hCommandList, hGraph);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListAppendConditionalLaunchKernel(
+    ze_command_list_handle_t hCommandList,
+    ze_kernel_handle_t hKernel,
+    const ze_group_count_t *pLaunchFuncArgs,
+    const uint32_t *pCondition,
+    ze_event_handle_t hSignalEvent,
+    uint32_t numWaitEvents,
+    ze_event_handle_t *phWaitEvents) {
+    return L0::zexCommandListAppendConditionalLaunchKernel(hCommandList, hKernel, pLaunchFuncArgs, pCondition, hSignalEvent, numWaitEvents, phWaitEvents);
+}
+}
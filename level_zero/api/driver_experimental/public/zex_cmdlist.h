@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef _ZEX_CMDLIST_H
+#define _ZEX_CMDLIST_H
+#if defined(__cplusplus)
+#pragma once
+#endif
+
+#include "level_zero/api/driver_experimental/public/zex_api.h"
+
+namespace L0 {
+
+ze_result_t ZE_APICALL
+zexCommandListUpdateKernelLaunch(
+    ze_command_list_handle_t hCommandList,  ///< [in] handle of the regular command list
+    uint32_t launchIndex,                   ///< [in] index of the kernel launch, in order of appending to the command list
+    ze_kernel_handle_t hKernel,             ///< [in] handle of the kernel used by the launch, with updated arguments
+    const ze_group_count_t *pLaunchFuncArgs ///< [in] new thread group launch arguments
+);
+
+ze_result_t ZE_APICALL
+zexCommandListAppendLaunchMultipleKernels(
+    ze_command_list_handle_t hCommandList,   ///< [in] handle of the command list
+    uint32_t numKernels,                     ///< [in] number of kernels to launch
+    const ze_kernel_handle_t *phKernels,     ///< [in][range(0, numKernels)] handles of the kernels
+    const ze_group_count_t *pLaunchFuncArgs, ///< [in][range(0, numKernels)] thread group launch arguments of each kernel
+    ze_event_handle_t hSignalEvent,          ///< [in][optional] handle of the event to signal on completion of all kernels
+    uint32_t numWaitEvents,                  ///< [in][optional] number of events to wait on before launching
+    ze_event_handle_t *phWaitEvents          ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait on before launching
+);
+
+ze_result_t ZE_APICALL
+zexCommandListBeginGraphCapture(
+    ze_command_list_handle_t hCommandList ///< [in] handle of the immediate command list
+);
+
+ze_result_t ZE_APICALL
+zexCommandListEndGraphCapture(
+    ze_command_list_handle_t hCommandList, ///< [in] handle of the immediate command list
+    ze_command_list_handle_t *phGraph      ///< [out] closed regular command list with appends made since begin of capture
+);
+
+ze_result_t ZE_APICALL
+zexCommandListAppendGraph(
+    ze_command_list_handle_t hCommandList, ///< [in] handle of the immediate command list
+    ze_command_list_handle_t hGraph        ///< [in] handle of the captured graph to submit
+);
+
+ze_result_t ZE_APICALL
+zexCommandListAppendConditionalLaunchKernel(
+    ze_command_list_handle_t hCommandList,   ///< [in] handle of the command list
+    ze_kernel_handle_t hKernel,              ///< [in] handle of the kernel
+    const ze_group_count_t *pLaunchFuncArgs, ///< [in] thread group launch arguments
+    const uint32_t *pCondition,              ///< [in] USM value read by the GPU when the launch executes, kernel is skipped when it is 0
+    ze_event_handle_t hSignalEvent,          ///< [in][optional] handle of the event to signal on completion
+    uint32_t numWaitEvents,                  ///< [in][optional] number of events to wait on before launching
+    ze_event_handle_t *phWaitEvents          ///< [in][optional][range(0, numWaitEvents)] handle of the events to wait on before launching
+);
+
+} // namespace L0
+
+#endif // _ZEX_CMDLIST_H
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/device/device.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
+
+#include "level_zero/api/driver_experimental/public/zex_api.h"
+#include "level_zero/core/source/device/device.h"
+
+namespace L0 {
+
+ze_result_t ZE_APICALL
+zexDeviceRecoverFromGpuHang(
+    ze_device_handle_t hDevice,
+    uint32_t *pRecoveredEnginesCount) {
+    if (hDevice == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+
+    auto neoDevice = Device::fromHandle(hDevice)->getNEODevice();
+    auto rootDeviceIndex = neoDevice->getRootDeviceIndex();
+    uint32_t recoveredEnginesCount = 0u;
+    ze_result_t ret = ZE_RESULT_SUCCESS;
+
+    for (auto &engine : neoDevice->getMemoryManager()->getRegisteredEngines()) {
+        auto csr = engine.commandStreamReceiver;
+        if (csr->getRootDeviceIndex() != rootDeviceIndex || !engine.osContext->isInitialized() || !csr->isGpuHangDetected()) {
+            continue;
+        }
+        if (csr->recoverFromGpuHang()) {
+            recoveredEnginesCount++;
+        } else {
+            ret = ZE_RESULT_ERROR_DEVICE_LOST;
+        }
+    }
+
+    if (pRecoveredEnginesCount) {
+        *pRecoveredEnginesCount = recoveredEnginesCount;
+    }
+    return ret;
+}
+
+} // namespace L0
+
+extern "C" {
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexDeviceRecoverFromGpuHang(
+    ze_device_handle_t hDevice,
+    uint32_t *pRecoveredEnginesCount) {
+    return L0::zexDeviceRecoverFromGpuHang(hDevice, pRecoveredEnginesCount);
+}
+}
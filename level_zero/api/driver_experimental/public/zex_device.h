@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef _ZEX_DEVICE_H
+#define _ZEX_DEVICE_H
+#if defined(__cplusplus)
+#pragma once
+#endif
+
+#include "level_zero/api/driver_experimental/public/zex_api.h"
+
+namespace L0 {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Recovers engines of a device from GPU hang without reinitializing the driver
+///
+/// @details
+///     - Hardware contexts and direct submission rings of every hung engine of
+///       the device are recreated.
+///     - Work submitted to hung engines before recovery is treated as completed;
+///       its results are undefined and events signaled by it must be reset.
+///     - Modules, memory allocations, command lists and queues stay valid.
+///     - The application must not submit work to the device while this
+///       function is executing.
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `nullptr == hDevice`
+///     - ::ZE_RESULT_ERROR_DEVICE_LOST
+///         + at least one of the engines could not be recovered
+ze_result_t ZE_APICALL
+zexDeviceRecoverFromGpuHang(
+    ze_device_handle_t hDevice,      ///< [in] handle of the device
+    uint32_t *pRecoveredEnginesCount ///< [out][optional] number of engines recovered from GPU hang
+);
+
+} // namespace L0
+
+#endif // _ZEX_DEVICE_H
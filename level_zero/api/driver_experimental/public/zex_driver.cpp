@@ -5,10 +5,14 @@
  *
  */
 
+#include "shared/source/utilities/performance_hints_log.h"
+
 #include "level_zero/api/driver_experimental/public/zex_api.h"
 #include "level_zero/core/source/driver/driver.h"
 #include "level_zero/core/source/driver/driver_handle.h"
 
+#include <algorithm>
+
 namespace L0 {
 
 ze_result_t ZE_APICALL
@@ -34,6 +38,35 @@ zexDriverGetHostPointerBaseAddress(
     return L0::DriverHandle::fromHandle(hDriver)->getHostPointerBaseAddress(ptr, baseAddress);
 }
 
+ze_result_t ZE_APICALL
+zexDriverGetPerformanceHints(
+    ze_driver_handle_t hDriver,
+    uint32_t *pCount,
+    zex_performance_hint_t *pHints) {
+    if (pCount == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    std::vector<NEO::PerformanceHintRecord> records;
+    if (auto performanceHintsLog = NEO::PerformanceHintsLog::get()) {
+        records = performanceHintsLog->getRecords();
+    }
+
+    if (*pCount == 0 || pHints == nullptr) {
+        *pCount = static_cast<uint32_t>(records.size());
+        return ZE_RESULT_SUCCESS;
+    }
+
+    *pCount = std::min(*pCount, static_cast<uint32_t>(records.size()));
+    for (uint32_t i = 0; i < *pCount; i++) {
+        pHints[i].hintId = static_cast<uint32_t>(records[i].hintId);
+        pHints[i].callSite = records[i].callSite;
+        std::copy(records[i].params.begin(), records[i].params.end(), pHints[i].params);
+        pHints[i].occurrences = records[i].occurrences;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 } // namespace L0
 
 extern "C" {
@@ -60,4 +93,12 @@ zexDriverGetHostPointerBaseAddress(
     void **baseAddress) {
     return L0::zexDriverGetHostPointerBaseAddress(hDriver, ptr, baseAddress);
 }
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexDriverGetPerformanceHints(
+    ze_driver_handle_t hDriver,
+    uint32_t *pCount,
+    zex_performance_hint_t *pHints) {
+    return L0::zexDriverGetPerformanceHints(hDriver, pCount, pHints);
+}
 }
\ No newline at end of file
@@ -13,6 +13,15 @@
 
 #include "level_zero/api/driver_experimental/public/zex_api.h"
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Structured performance hint reported by the driver
+typedef struct _zex_performance_hint_t {
+    uint32_t hintId;      ///< [out] identifier of the hint
+    const char *callSite; ///< [out] driver call site which reported the hint
+    uint64_t params[4];   ///< [out] hint specific parameters
+    uint64_t occurrences; ///< [out] number of times the hint was hit at its call site
+} zex_performance_hint_t;
+
 namespace L0 {
 
 ze_result_t ZE_APICALL
@@ -35,6 +44,26 @@ zexDriverGetHostPointerBaseAddress(
     void **baseAddress          ///< [out] if not null, returns address of the base pointer of the imported pointer
 );
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Retrieves performance hints collected by the driver
+///
+/// @details
+///     - Hints are collected only when enabled with PerformanceHintsRecordsPerCallSite
+///       debug setting, otherwise no hints are returned.
+///     - Only first hints reported by each call site are returned, occurrences hold
+///       the number of all times the hint was hit at that call site.
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `nullptr == pCount`
+ze_result_t ZE_APICALL
+zexDriverGetPerformanceHints(
+    ze_driver_handle_t hDriver,    ///< [in] handle of the driver
+    uint32_t *pCount,              ///< [in,out] number of hints, if zero it is set to the number of available hints
+    zex_performance_hint_t *pHints ///< [in,out][optional][range(0, *pCount)] array receiving the hints
+);
+
 } // namespace L0
 
 #endif // _ZEX_DRIVER_H
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device/device.h"
+
+#include "level_zero/api/driver_experimental/public/zex_api.h"
+#include "level_zero/core/source/device/device.h"
+#include "level_zero/core/source/event/event.h"
+
+namespace L0 {
+
+ze_result_t ZE_APICALL
+zexEventQueryKernelTimestamps(
+    ze_device_handle_t hDevice,
+    uint32_t numEvents,
+    ze_event_handle_t *phEvents,
+    zex_kernel_timestamps_t *pTimestamps) {
+    if (phEvents == nullptr || pTimestamps == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    auto globalStart = pTimestamps->globalStart;
+    auto globalEnd = pTimestamps->globalEnd;
+    auto contextStart = pTimestamps->contextStart;
+    auto contextEnd = pTimestamps->contextEnd;
+
+    ze_result_t ret = ZE_RESULT_SUCCESS;
+    for (uint32_t i = 0; i < numEvents; i++) {
+        ze_kernel_timestamp_result_t timestamp = {};
+        auto eventResult = Event::fromHandle(phEvents[i])->queryKernelTimestamp(&timestamp);
+        if (eventResult != ZE_RESULT_SUCCESS) {
+            timestamp = {};
+            ret = eventResult;
+        }
+        globalStart[i] = timestamp.global.kernelStart;
+        globalEnd[i] = timestamp.global.kernelEnd;
+        contextStart[i] = timestamp.context.kernelStart;
+        contextEnd[i] = timestamp.context.kernelEnd;
+        if (pTimestamps->pResults) {
+            pTimestamps->pResults[i] = eventResult;
+        }
+    }
+
+    if (hDevice) {
+        const double resolution = Device::fromHandle(hDevice)->getNEODevice()->getDeviceInfo().profilingTimerResolution;
+        for (uint32_t i = 0; i < numEvents; i++) {
+            globalStart[i] = static_cast<uint64_t>(globalStart[i] * resolution);
+            globalEnd[i] = static_cast<uint64_t>(globalEnd[i] * resolution);
+            contextStart[i] = static_cast<uint64_t>(contextStart[i] * resolution);
+            contextEnd[i] = static_cast<uint64_t>(contextEnd[i] * resolution);
+        }
+    }
+
+    return ret;
+}
+
+ze_result_t ZE_APICALL
+zexCounterBasedEventCreate(
+    ze_device_handle_t hDevice,
+    ze_event_handle_t *phEvent) {
+    if (hDevice == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    if (phEvent == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    *phEvent = CounterBasedEvent::create(Device::fromHandle(hDevice))->toHandle();
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ZE_APICALL
+zexEventPoolHostReset(
+    ze_event_pool_handle_t hEventPool) {
+    if (hEventPool == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    return EventPool::fromHandle(hEventPool)->hostResetEvents();
+}
+
+ze_result_t ZE_APICALL
+zexEventPoolHostSignal(
+    ze_event_pool_handle_t hEventPool) {
+    if (hEventPool == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    return EventPool::fromHandle(hEventPool)->hostSignalEvents();
+}
+
+} // namespace L0
+
+extern "C" {
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventQueryKernelTimestamps(
+    ze_device_handle_t hDevice,
+    uint32_t numEvents,
+    ze_event_handle_t *phEvents,
+    zex_kernel_timestamps_t *pTimestamps) {
+    return L0::zexEventQueryKernelTimestamps(hDevice, numEvents, phEvents, pTimestamps);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCounterBasedEventCreate(
+    ze_device_handle_t hDevice,
+    ze_event_handle_t *phEvent) {
+    return L0::zexCounterBasedEventCreate(hDevice, phEvent);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventPoolHostReset(
+    ze_event_pool_handle_t hEventPool) {
+    return L0::zexEventPoolHostReset(hEventPool);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventPoolHostSignal(
+    ze_event_pool_handle_t hEventPool) {
+    return L0::zexEventPoolHostSignal(hEventPool);
+}
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#ifndef _ZEX_EVENT_H
+#define _ZEX_EVENT_H
+#if defined(__cplusplus)
+#pragma once
+#endif
+
+#include "level_zero/api/driver_experimental/public/zex_api.h"
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Kernel timestamps of multiple events, stored as structure of arrays
+typedef struct _zex_kernel_timestamps_t {
+    uint64_t *globalStart;  ///< [out][range(0, numEvents)] global start timestamps
+    uint64_t *globalEnd;    ///< [out][range(0, numEvents)] global end timestamps
+    uint64_t *contextStart; ///< [out][range(0, numEvents)] context start timestamps
+    uint64_t *contextEnd;   ///< [out][range(0, numEvents)] context end timestamps
+    ze_result_t *pResults;  ///< [out][optional][range(0, numEvents)] per event query result
+} zex_kernel_timestamps_t;
+
+namespace L0 {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Queries kernel timestamps of multiple events in a single call
+///
+/// @details
+///     - Equivalent to calling ::zeEventQueryKernelTimestamp for each event, with
+///       results written to the arrays of `pTimestamps` at the event's position.
+///     - Timestamps of events that are not yet signaled are set to zero.
+///     - When `hDevice` is given, timestamps are converted from ticks to nanoseconds
+///       using the timer resolution of that device.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_NOT_READY
+///         + at least one of the events is not signaled
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `nullptr == phEvents`
+///         + `nullptr == pTimestamps`
+ze_result_t ZE_APICALL
+zexEventQueryKernelTimestamps(
+    ze_device_handle_t hDevice,          ///< [in][optional] device used for conversion to nanoseconds
+    uint32_t numEvents,                  ///< [in] number of events in phEvents
+    ze_event_handle_t *phEvents,         ///< [in][range(0, numEvents)] handles of the events to query
+    zex_kernel_timestamps_t *pTimestamps ///< [in,out] arrays receiving the timestamps
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Creates an event that is not backed by event pool memory
+///
+/// @details
+///     - The event completes when the command stream receiver it was last
+///       signaled on reaches the task count of that submission; signaling does
+///       not write event memory and the event does not need to be reset.
+///     - The event may be used as signal event only on immediate command lists,
+///       and as wait event on any command list.
+///     - An event that has not been signaled yet is considered complete.
+///     - The event is destroyed with ::zeEventDestroy.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `nullptr == hDevice`
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `nullptr == phEvent`
+ze_result_t ZE_APICALL
+zexCounterBasedEventCreate(
+    ze_device_handle_t hDevice, ///< [in] handle of the device
+    ze_event_handle_t *phEvent  ///< [out] pointer to handle of event object created
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Resets all events of an event pool from the host in a single operation
+///
+/// @details
+///     - Equivalent to calling ::zeEventHostReset on every event created from
+///       the pool; the pool memory is written once with non-temporal stores.
+///     - The application must not call this function while any event of the
+///       pool is in use by a device.
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `nullptr == hEventPool`
+ze_result_t ZE_APICALL
+zexEventPoolHostReset(
+    ze_event_pool_handle_t hEventPool ///< [in] handle of the event pool
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Signals all events of an event pool from the host in a single operation
+///
+/// @details
+///     - Equivalent to calling ::zeEventHostSignal on every event created from
+///       the pool; the pool memory is written once with non-temporal stores.
+///
+/// @returns
+///     - ::ZE_RESULT_SUCCESS
+///     - ::ZE_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `nullptr == hEventPool`
+ze_result_t ZE_APICALL
+zexEventPoolHostSignal(
+    ze_event_pool_handle_t hEventPool ///< [in] handle of the event pool
+);
+
+} // namespace L0
+
+#endif // _ZEX_EVENT_H
@@ -18,6 +18,21 @@ zexKernelGetBaseAddress(
     return L0::Kernel::fromHandle(hKernel)->getBaseAddress(baseAddress);
 }
 
+ze_result_t ZE_APICALL
+zexKernelClone(
+    ze_kernel_handle_t hKernel,
+    ze_kernel_handle_t *phKernel) {
+    if (nullptr == hKernel || nullptr == phKernel) {
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    Kernel *kernel = nullptr;
+    auto result = L0::Kernel::fromHandle(hKernel)->clone(&kernel);
+    if (result == ZE_RESULT_SUCCESS) {
+        *phKernel = kernel->toHandle();
+    }
+    return result;
+}
+
 } // namespace L0
 
 extern "C" {
@@ -28,4 +43,11 @@ zexKernelGetBaseAddress(
     uint64_t *baseAddress) {
     return L0::zexKernelGetBaseAddress(hKernel, baseAddress);
 }
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexKernelClone(
+    ze_kernel_handle_t hKernel,
+    ze_kernel_handle_t *phKernel) {
+    return L0::zexKernelClone(hKernel, phKernel);
+}
 }
@@ -18,6 +18,11 @@ zexKernelGetBaseAddress(
     ze_kernel_handle_t hKernel,
     uint64_t *baseAddress);
 
+ze_result_t ZE_APICALL
+zexKernelClone(
+    ze_kernel_handle_t hKernel,
+    ze_kernel_handle_t *phKernel);
+
 }
 
 #endif // _ZEX_MODULE_H
@@ -35,6 +35,8 @@ enum class Builtin : uint32_t {
     FillBufferSSHOffsetStateless,
     FillBufferMiddle,
     FillBufferMiddleStateless,
+    FillBufferMiddleVec,
+    FillBufferMiddleVecStateless,
     FillBufferRightLeftover,
     FillBufferRightLeftoverStateless,
     QueryKernelTimestamps,
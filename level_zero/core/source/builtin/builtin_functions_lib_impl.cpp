@@ -103,6 +103,14 @@ void BuiltinFunctionsLibImpl::initBuiltinKernel(Builtin func) {
         builtinName = "FillBufferMiddle";
         builtin = NEO::EBuiltInOps::FillBufferStateless;
         break;
+    case Builtin::FillBufferMiddleVec:
+        builtinName = "FillBufferMiddleVec";
+        builtin = NEO::EBuiltInOps::FillBuffer;
+        break;
+    case Builtin::FillBufferMiddleVecStateless:
+        builtinName = "FillBufferMiddleVec";
+        builtin = NEO::EBuiltInOps::FillBufferStateless;
+        break;
     case Builtin::FillBufferRightLeftover:
         builtinName = "FillBufferRightLeftover";
         builtin = NEO::EBuiltInOps::FillBuffer;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021 Intel Corporation
+ * Copyright (C) 2021-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,22 +7,105 @@
 
 #include "level_zero/core/source/cache/linux/cache_reservation_impl.h"
 
+#include "shared/source/device/device.h"
+#include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/os_interface/linux/cache_info.h"
+#include "shared/source/os_interface/linux/drm_allocation.h"
+#include "shared/source/os_interface/linux/drm_neo.h"
+#include "shared/source/os_interface/os_interface.h"
+
+#include "level_zero/core/source/device/device.h"
+#include "level_zero/core/source/driver/driver_handle.h"
+
 namespace L0 {
 
 std::unique_ptr<CacheReservation> CacheReservation::create(Device &device) {
     return std::make_unique<CacheReservationImpl>(device);
 }
 
+CacheReservationImpl::~CacheReservationImpl() {
+    auto drm = getDrm();
+    if (drm != nullptr && drm->getCacheInfo() != nullptr) {
+        freeL3CacheRegion(*drm);
+    }
+}
+
+NEO::Drm *CacheReservationImpl::getDrm() {
+    auto &osInterface = device.getNEODevice()->getRootDeviceEnvironment().osInterface;
+    if (!osInterface || !osInterface->getDriverModel()) {
+        return nullptr;
+    }
+    return osInterface->getDriverModel()->as<NEO::Drm>();
+}
+
+void CacheReservationImpl::freeL3CacheRegion(NEO::Drm &drm) {
+    if (reservedL3CacheRegion != NEO::CacheRegion::None) {
+        drm.getCacheInfo()->freeCacheRegion(reservedL3CacheRegion);
+    }
+    reservedL3CacheRegion = NEO::CacheRegion::None;
+    reservedL3CacheSize = 0;
+}
+
 bool CacheReservationImpl::reserveCache(size_t cacheLevel, size_t cacheReservationSize) {
-    return false;
+    auto drm = getDrm();
+    if (cacheLevel != 3 || drm == nullptr || drm->getCacheInfo() == nullptr) {
+        return false;
+    }
+
+    auto cacheInfo = drm->getCacheInfo();
+    if (cacheReservationSize > cacheInfo->getMaxReservationCacheSize()) {
+        return false;
+    }
+
+    // a new reservation replaces the previous one, zero size only releases it
+    freeL3CacheRegion(*drm);
+    if (cacheReservationSize == 0) {
+        return true;
+    }
+
+    auto cacheRegion = cacheInfo->reserveCacheRegion(cacheReservationSize);
+    if (cacheRegion == NEO::CacheRegion::None) {
+        return false;
+    }
+    reservedL3CacheRegion = cacheRegion;
+    reservedL3CacheSize = cacheReservationSize;
+    return true;
 }
 
 bool CacheReservationImpl::setCacheAdvice(void *ptr, size_t regionSize, ze_cache_ext_region_t cacheRegion) {
-    return false;
+    auto drm = getDrm();
+    if (drm == nullptr || drm->getCacheInfo() == nullptr) {
+        return false;
+    }
+
+    auto cacheRegionIndex = NEO::CacheRegion::Default;
+    auto cacheRegionSize = regionSize;
+    if (cacheRegion == ze_cache_ext_region_t::ZE_CACHE_EXT_REGION_ZE_CACHE_RESERVE_REGION) {
+        if (reservedL3CacheRegion == NEO::CacheRegion::None) {
+            return false;
+        }
+        cacheRegionIndex = reservedL3CacheRegion;
+        cacheRegionSize = reservedL3CacheSize;
+    }
+
+    auto allocData = device.getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
+    if (allocData == nullptr) {
+        return false;
+    }
+    auto allocation = allocData->gpuAllocations.getGraphicsAllocation(device.getRootDeviceIndex());
+    if (allocation == nullptr) {
+        return false;
+    }
+    return static_cast<NEO::DrmAllocation *>(allocation)->setCacheAdvice(drm, cacheRegionSize, cacheRegionIndex);
 }
 
 size_t CacheReservationImpl::getMaxCacheReservationSize() {
-    return 0;
+    auto drm = getDrm();
+    if (drm == nullptr || drm->getCacheInfo() == nullptr) {
+        return 0;
+    }
+    return drm->getCacheInfo()->getMaxReservationCacheSize();
 }
 
 } // namespace L0
@@ -1,23 +1,37 @@
 /*
- * Copyright (C) 2021 Intel Corporation
+ * Copyright (C) 2021-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/helpers/common_types.h"
+
 #include "level_zero/core/source/cache/cache_reservation.h"
 
+namespace NEO {
+class Drm;
+} // namespace NEO
+
 namespace L0 {
 
 class CacheReservationImpl : public CacheReservation {
   public:
-    ~CacheReservationImpl() override = default;
-    CacheReservationImpl(Device &device){};
+    ~CacheReservationImpl() override;
+    CacheReservationImpl(Device &device) : device(device){};
 
     bool reserveCache(size_t cacheLevel, size_t cacheReservationSize) override;
     bool setCacheAdvice(void *ptr, size_t regionSize, ze_cache_ext_region_t cacheRegion) override;
     size_t getMaxCacheReservationSize() override;
+
+  protected:
+    NEO::Drm *getDrm();
+    void freeL3CacheRegion(NEO::Drm &drm);
+
+    Device &device;
+    NEO::CacheRegion reservedL3CacheRegion = NEO::CacheRegion::None;
+    size_t reservedL3CacheSize = 0;
 };
 
-} // namespace L0
\ No newline at end of file
+} // namespace L0
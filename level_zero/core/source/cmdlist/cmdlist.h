@@ -67,6 +67,14 @@ struct CommandList : _ze_command_list_handle_t {
         CommandType type = Invalid;
     };
     using CommandsToPatch = StackVec<CommandToPatch, 16>;
+    struct KernelLaunchToPatch {
+        Kernel *kernel = nullptr;
+        void *walker = nullptr;
+        void *indirectData = nullptr;
+        uint32_t crossThreadDataSize = 0u;
+        uint32_t groupSize[3] = {};
+    };
+    using KernelLaunchesToPatch = std::vector<KernelLaunchToPatch>;
     using CmdListReturnPoints = StackVec<CmdListReturnPoint, 32>;
 
     virtual ze_result_t close() = 0;
@@ -110,12 +118,16 @@ struct CommandList : _ze_command_list_handle_t {
                                                             const uint32_t *pNumLaunchArguments,
                                                             const ze_group_count_t *pLaunchArgumentsBuffer, ze_event_handle_t hEvent,
                                                             uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) = 0;
+    virtual ze_result_t appendLaunchMultipleKernels(uint32_t numKernels, const ze_kernel_handle_t *kernelHandles,
+                                                    const ze_group_count_t *pLaunchFuncArgs, ze_event_handle_t hEvent,
+                                                    uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) = 0;
     virtual ze_result_t appendMemAdvise(ze_device_handle_t hDevice, const void *ptr, size_t size,
                                         ze_memory_advice_t advice) = 0;
     virtual ze_result_t appendMemoryCopy(void *dstptr, const void *srcptr, size_t size,
                                          ze_event_handle_t hSignalEvent, uint32_t numWaitEvents,
                                          ze_event_handle_t *phWaitEvents) = 0;
     virtual ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstptr, NEO::GraphicsAllocation *srcptr, size_t size, bool flushHost) = 0;
+    virtual ze_result_t appendPageFaultCopyRange(NEO::GraphicsAllocation *dstptr, NEO::GraphicsAllocation *srcptr, size_t offset, size_t size, bool flushHost) = 0;
     virtual ze_result_t appendMemoryCopyRegion(void *dstPtr,
                                                const ze_copy_region_t *dstRegion,
                                                uint32_t dstPitch,
@@ -143,6 +155,14 @@ struct CommandList : _ze_command_list_handle_t {
 
     virtual ze_result_t reserveSpace(size_t size, void **ptr) = 0;
     virtual ze_result_t reset() = 0;
+    virtual ze_result_t updateKernelLaunch(uint32_t launchIndex, ze_kernel_handle_t hKernel,
+                                           const ze_group_count_t *threadGroupDimensions) = 0;
+    virtual ze_result_t beginGraphCapture() { return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE; }
+    virtual ze_result_t endGraphCapture(ze_command_list_handle_t *phGraph) { return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE; }
+    virtual ze_result_t appendGraph(ze_command_list_handle_t hGraph) { return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE; }
+    virtual ze_result_t appendConditionalLaunchKernel(ze_kernel_handle_t kernelHandle, const ze_group_count_t *threadGroupDimensions,
+                                                      const uint32_t *pCondition, ze_event_handle_t hEvent,
+                                                      uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) { return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE; }
 
     virtual ze_result_t appendMetricMemoryBarrier() = 0;
     virtual ze_result_t appendMetricStreamerMarker(zet_metric_streamer_handle_t hMetricStreamer,
@@ -265,6 +285,9 @@ struct CommandList : _ze_command_list_handle_t {
     const CommandsToPatch &getCommandsToPatch() {
         return commandsToPatch;
     }
+    const KernelLaunchesToPatch &getKernelLaunchesToPatch() const {
+        return kernelLaunchesToPatch;
+    }
 
     CmdListReturnPoints &getReturnPoints() {
         return returnPoints;
@@ -274,6 +297,10 @@ struct CommandList : _ze_command_list_handle_t {
         return static_cast<uint32_t>(returnPoints.size());
     }
 
+    std::vector<uint8_t> &getCachedBatchBufferStarts() {
+        return cachedBatchBufferStarts;
+    }
+
     void makeResidentAndMigrate(bool);
     void migrateSharedAllocations();
 
@@ -283,6 +310,7 @@ struct CommandList : _ze_command_list_handle_t {
 
     ze_context_handle_t hContext = nullptr;
     std::vector<Kernel *> printfKernelContainer;
+    std::vector<uint8_t> cachedBatchBufferStarts;
     CommandQueue *cmdQImmediate = nullptr;
     NEO::CommandStreamReceiver *csr = nullptr;
     Device *device = nullptr;
@@ -311,6 +339,7 @@ struct CommandList : _ze_command_list_handle_t {
     NEO::StreamProperties requiredStreamState{};
     NEO::StreamProperties finalStreamState{};
     CommandsToPatch commandsToPatch{};
+    KernelLaunchesToPatch kernelLaunchesToPatch;
     UnifiedMemoryControls unifiedMemoryControls;
 
     ze_command_list_flags_t flags = 0u;
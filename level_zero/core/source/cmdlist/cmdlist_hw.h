@@ -22,6 +22,7 @@
 namespace NEO {
 enum class ImageType;
 class LogicalStateHelper;
+struct EncodeDispatchKernelArgs;
 } // namespace NEO
 
 namespace L0 {
@@ -45,11 +46,14 @@ struct AlignedAllocationData {
 
 struct EventPool;
 struct Event;
+struct CounterBasedEvent;
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 struct CommandListCoreFamily : CommandListImp {
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
 
+    static constexpr size_t minimalSizeForBcsSplit = 4 * MemoryConstants::megaByte;
+
     using CommandListImp::CommandListImp;
     ze_result_t initialize(Device *device, NEO::EngineGroupType engineGroupType, ze_command_list_flags_t flags) override;
     void programL3(bool isSLMused);
@@ -102,6 +106,18 @@ struct CommandListCoreFamily : CommandListImp {
                                                     ze_event_handle_t hEvent,
                                                     uint32_t numWaitEvents,
                                                     ze_event_handle_t *phWaitEvents) override;
+    ze_result_t appendLaunchMultipleKernels(uint32_t numKernels,
+                                            const ze_kernel_handle_t *kernelHandles,
+                                            const ze_group_count_t *pLaunchFuncArgs,
+                                            ze_event_handle_t hEvent,
+                                            uint32_t numWaitEvents,
+                                            ze_event_handle_t *phWaitEvents) override;
+    ze_result_t appendConditionalLaunchKernel(ze_kernel_handle_t kernelHandle,
+                                              const ze_group_count_t *threadGroupDimensions,
+                                              const uint32_t *pCondition,
+                                              ze_event_handle_t hEvent,
+                                              uint32_t numWaitEvents,
+                                              ze_event_handle_t *phWaitEvents) override;
     ze_result_t appendMemAdvise(ze_device_handle_t hDevice,
                                 const void *ptr, size_t size,
                                 ze_memory_advice_t advice) override;
@@ -112,6 +128,11 @@ struct CommandListCoreFamily : CommandListImp {
                                     NEO::GraphicsAllocation *srcAllocation,
                                     size_t size,
                                     bool flushHost) override;
+    ze_result_t appendPageFaultCopyRange(NEO::GraphicsAllocation *dstAllocation,
+                                         NEO::GraphicsAllocation *srcAllocation,
+                                         size_t offset,
+                                         size_t size,
+                                         bool flushHost) override;
     ze_result_t appendMemoryCopyRegion(void *dstPtr,
                                        const ze_copy_region_t *dstRegion,
                                        uint32_t dstPitch,
@@ -162,6 +183,8 @@ struct CommandListCoreFamily : CommandListImp {
 
     ze_result_t reserveSpace(size_t size, void **ptr) override;
     ze_result_t reset() override;
+    ze_result_t updateKernelLaunch(uint32_t launchIndex, ze_kernel_handle_t hKernel,
+                                   const ze_group_count_t *threadGroupDimensions) override;
     ze_result_t executeCommandListImmediate(bool performMigration) override;
     ze_result_t executeCommandListImmediateImpl(bool performMigration, L0::CommandQueue *cmdQImmediate);
     size_t getReserveSshSize();
@@ -239,14 +262,20 @@ struct CommandListCoreFamily : CommandListImp {
                                           const void *pattern,
                                           Event *signalEvent,
                                           const CmdListKernelLaunchParams &launchParams);
+    bool isMemoryFillWithStoreDataImmAllowed(uint64_t dstGpuAddress, size_t size) const;
+    void appendMemoryFillWithStoreDataImm(uint64_t dstGpuAddress, const void *pattern, size_t patternSize, size_t size);
 
     ze_result_t prepareIndirectParams(const ze_group_count_t *threadGroupDimensions);
+    bool getUsmGpuAddressAndMakeResident(const void *ptr, uint64_t &gpuAddress);
     void updateStreamProperties(Kernel &kernel, bool isCooperative);
     void clearCommandsToPatch();
+    void reserveHeapsForKernels(uint32_t numKernels, const ze_kernel_handle_t *kernelHandles);
+    void storeKernelLaunchToPatch(Kernel *kernel, const NEO::EncodeDispatchKernelArgs &dispatchKernelArgs, const CmdListKernelLaunchParams &launchParams);
 
     size_t getTotalSizeForCopyRegion(const ze_copy_region_t *region, uint32_t pitch, uint32_t slicePitch);
     bool isAppendSplitNeeded(void *dstPtr, const void *srcPtr, size_t size);
     bool isAppendSplitNeeded(NEO::MemoryPool dstPool, NEO::MemoryPool srcPool, size_t size);
+    bool isPeerCopyOverDeviceLink(void *dstPtr, const void *srcPtr, size_t size);
 
     void applyMemoryRangesBarrier(uint32_t numRanges, const size_t *pRangeSizes,
                                   const void **pRanges);
@@ -256,6 +285,7 @@ struct CommandListCoreFamily : CommandListImp {
     void appendWriteKernelTimestamp(Event *event, bool beforeWalker, bool maskLsb, bool workloadPartition);
     void adjustWriteKernelTimestamp(uint64_t globalAddress, uint64_t contextAddress, bool maskLsb, uint32_t mask, bool workloadPartition);
     void appendEventForProfiling(Event *event, bool beforeWalker, bool workloadPartition);
+    void appendWaitOnCounterBasedEvent(CounterBasedEvent *event);
     void appendEventForProfilingCopyCommand(Event *event, bool beforeWalker);
     void appendSignalEventPostWalker(Event *event, bool workloadPartition);
     virtual void programStateBaseAddress(NEO::CommandContainer &container, bool genericMediaStateClearRequired);
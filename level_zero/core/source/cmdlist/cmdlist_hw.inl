@@ -25,6 +25,7 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/helpers/surface_format_info.h"
 #include "shared/source/indirect_heap/indirect_heap.h"
+#include "shared/source/kernel/implicit_args.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/memadvise_flags.h"
@@ -34,7 +35,9 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 #include "shared/source/program/sync_buffer_handler.h"
 #include "shared/source/program/sync_buffer_handler.inl"
+#include "shared/source/utilities/performance_hints_log.h"
 #include "shared/source/utilities/software_tags_manager.h"
+#include "shared/source/utilities/trace_points.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw.h"
 #include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
@@ -42,6 +45,7 @@
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/source/event/event.h"
+#include "level_zero/core/source/fabric/fabric.h"
 #include "level_zero/core/source/image/image.h"
 #include "level_zero/core/source/kernel/kernel.h"
 #include "level_zero/core/source/module/module.h"
@@ -98,6 +102,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
     containsAnyKernel = false;
     containsCooperativeKernelsFlag = false;
     clearCommandsToPatch();
+    kernelLaunchesToPatch.clear();
     commandListSLMEnabled = false;
 
     if (!isCopyOnly()) {
@@ -113,6 +118,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
     this->ownedPrivateAllocations.clear();
     cmdListCurrentStartOffset = 0;
     this->returnPoints.clear();
+    this->cachedBatchBufferStarts.clear();
     return ZE_RESULT_SUCCESS;
 }
 
@@ -200,6 +206,7 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::close() {
     commandContainer.removeDuplicatesFromResidencyContainer();
     NEO::EncodeBatchBufferStartOrEnd<GfxFamily>::programBatchBufferEnd(commandContainer);
+    this->cachedBatchBufferStarts.clear();
 
     return ZE_RESULT_SUCCESS;
 }
@@ -214,6 +221,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(ze_kernel_h
                                                                      uint32_t numWaitEvents,
                                                                      ze_event_handle_t *phWaitEvents,
                                                                      const CmdListKernelLaunchParams &launchParams) {
+    TRACE_POINT(AppendLaunchKernel, reinterpret_cast<uintptr_t>(kernelHandle), reinterpret_cast<uintptr_t>(this));
 
     NEO::Device *neoDevice = device->getNEODevice();
     uint32_t callId = 0;
@@ -236,9 +244,19 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(ze_kernel_h
         event = Event::fromHandle(hEvent);
     }
 
-    auto res = appendLaunchKernelWithParams(Kernel::fromHandle(kernelHandle), threadGroupDimensions,
+    auto kernel = Kernel::fromHandle(kernelHandle);
+    uint32_t metricSampleSlot = std::numeric_limits<uint32_t>::max();
+    if (NEO::DebugManager.flags.MetricKernelSamplingPeriod.get() > 0) {
+        device->getMetricDeviceContext().appendKernelSampleBegin(*this, kernel->getKernelDescriptor().kernelMetadata.kernelName, metricSampleSlot);
+    }
+
+    auto res = appendLaunchKernelWithParams(kernel, threadGroupDimensions,
                                             event, launchParams);
 
+    if (metricSampleSlot != std::numeric_limits<uint32_t>::max()) {
+        device->getMetricDeviceContext().appendKernelSampleEnd(*this, metricSampleSlot);
+    }
+
     if (NEO::DebugManager.flags.EnableSWTags.get()) {
         neoDevice->getRootDeviceEnvironment().tagsManager->insertTag<GfxFamily, NEO::SWTags::CallNameEndTag>(
             *commandContainer.getCommandStream(),
@@ -321,12 +339,13 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchMultipleKernelsInd
 
     appendEventForProfiling(event, true, false);
     const bool haveLaunchArguments = pLaunchArgumentsBuffer != nullptr;
-    auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(pNumLaunchArguments);
-    auto alloc = allocData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
-    commandContainer.addToResidencyContainer(alloc);
+    uint64_t numLaunchArgumentsGpuAddress = 0u;
+    if (!getUsmGpuAddressAndMakeResident(pNumLaunchArguments, numLaunchArgumentsGpuAddress)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
 
     for (uint32_t i = 0; i < numKernels; i++) {
-        NEO::EncodeMathMMIO<GfxFamily>::encodeGreaterThanPredicate(commandContainer, alloc->getGpuAddress(), i);
+        NEO::EncodeMathMMIO<GfxFamily>::encodeGreaterThanPredicate(commandContainer, numLaunchArgumentsGpuAddress, i);
 
         CmdListKernelLaunchParams launchParams = {};
         launchParams.isIndirect = true;
@@ -344,6 +363,108 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchMultipleKernelsInd
     return ret;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendConditionalLaunchKernel(ze_kernel_handle_t kernelHandle,
+                                                                                const ze_group_count_t *threadGroupDimensions,
+                                                                                const uint32_t *pCondition,
+                                                                                ze_event_handle_t hEvent,
+                                                                                uint32_t numWaitEvents,
+                                                                                ze_event_handle_t *phWaitEvents) {
+    uint64_t conditionGpuAddress = 0u;
+    if (threadGroupDimensions == nullptr || !getUsmGpuAddressAndMakeResident(pCondition, conditionGpuAddress)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents);
+    if (ret) {
+        return ret;
+    }
+
+    Event *event = nullptr;
+    if (hEvent) {
+        event = Event::fromHandle(hEvent);
+    }
+
+    appendEventForProfiling(event, true, false);
+
+    // condition is evaluated when the walker is parsed, so it may be written by previously appended kernels
+    NEO::EncodeMathMMIO<GfxFamily>::encodeGreaterThanPredicate(commandContainer, conditionGpuAddress, 0u);
+
+    CmdListKernelLaunchParams launchParams = {};
+    launchParams.isPredicate = true;
+    ret = appendLaunchKernelWithParams(Kernel::fromHandle(kernelHandle), threadGroupDimensions,
+                                       nullptr, launchParams);
+    appendSignalEventPostWalker(event, false);
+
+    return ret;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchMultipleKernels(uint32_t numKernels,
+                                                                              const ze_kernel_handle_t *kernelHandles,
+                                                                              const ze_group_count_t *pLaunchFuncArgs,
+                                                                              ze_event_handle_t hEvent,
+                                                                              uint32_t numWaitEvents,
+                                                                              ze_event_handle_t *phWaitEvents) {
+    if (numKernels > 0 && (kernelHandles == nullptr || pLaunchFuncArgs == nullptr)) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents);
+    if (ret) {
+        return ret;
+    }
+
+    Event *event = nullptr;
+    if (hEvent) {
+        event = Event::fromHandle(hEvent);
+    }
+
+    appendEventForProfiling(event, true, false);
+
+    // reserve heap space for the whole batch up front, so heaps are not switched between launches
+    // and state base address is reprogrammed at most once
+    reserveHeapsForKernels(numKernels, kernelHandles);
+
+    for (uint32_t i = 0; i < numKernels; i++) {
+        CmdListKernelLaunchParams launchParams = {};
+        ret = appendLaunchKernelWithParams(Kernel::fromHandle(kernelHandles[i]), &pLaunchFuncArgs[i], nullptr, launchParams);
+        if (ret) {
+            return ret;
+        }
+    }
+
+    appendSignalEventPostWalker(event, false);
+
+    return ret;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::reserveHeapsForKernels(uint32_t numKernels, const ze_kernel_handle_t *kernelHandles) {
+    using WALKER_TYPE = typename GfxFamily::WALKER_TYPE;
+    using BINDING_TABLE_STATE = typename GfxFamily::BINDING_TABLE_STATE;
+
+    size_t iohSize = 0u;
+    size_t sshSize = 0u;
+    for (uint32_t i = 0; i < numKernels; i++) {
+        auto kernel = Kernel::fromHandle(kernelHandles[i]);
+        iohSize += alignUp(kernel->getCrossThreadDataSize() + kernel->getPerThreadDataSizeForWholeThreadGroup() + sizeof(NEO::ImplicitArgs),
+                           WALKER_TYPE::INDIRECTDATASTARTADDRESS_ALIGN_SIZE);
+        sshSize += alignUp(kernel->getSurfaceStateHeapDataSize(), BINDING_TABLE_STATE::SURFACESTATEPOINTER_ALIGN_SIZE);
+    }
+
+    auto ioh = commandContainer.getIndirectHeap(NEO::HeapType::INDIRECT_OBJECT);
+    if (ioh && iohSize > 0u) {
+        commandContainer.getHeapWithRequiredSizeAndAlignment(NEO::HeapType::INDIRECT_OBJECT, std::min(iohSize, ioh->getMaxAvailableSpace()),
+                                                             WALKER_TYPE::INDIRECTDATASTARTADDRESS_ALIGN_SIZE);
+    }
+    auto ssh = commandContainer.getIndirectHeap(NEO::HeapType::SURFACE_STATE);
+    if (ssh && sshSize > 0u) {
+        commandContainer.getHeapWithRequiredSizeAndAlignment(NEO::HeapType::SURFACE_STATE, std::min(sshSize, ssh->getMaxAvailableSpace()),
+                                                             BINDING_TABLE_STATE::SURFACESTATEPOINTER_ALIGN_SIZE);
+    }
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendEventReset(ze_event_handle_t hEvent) {
     auto event = Event::fromHandle(hEvent);
@@ -1055,6 +1176,13 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::GraphicsAllocation *dstAllocation,
                                                                       NEO::GraphicsAllocation *srcAllocation,
                                                                       size_t size, bool flushHost) {
+    return appendPageFaultCopyRange(dstAllocation, srcAllocation, 0u, size, flushHost);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopyRange(NEO::GraphicsAllocation *dstAllocation,
+                                                                           NEO::GraphicsAllocation *srcAllocation,
+                                                                           size_t offset, size_t size, bool flushHost) {
 
     size_t middleElSize = sizeof(uint32_t) * 4;
     uintptr_t rightSize = size % middleElSize;
@@ -1064,8 +1192,8 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(NEO::Graph
         isStateless = true;
     }
 
-    uintptr_t dstAddress = static_cast<uintptr_t>(dstAllocation->getGpuAddress());
-    uintptr_t srcAddress = static_cast<uintptr_t>(srcAllocation->getGpuAddress());
+    uintptr_t dstAddress = static_cast<uintptr_t>(dstAllocation->getGpuAddress() + offset);
+    uintptr_t srcAddress = static_cast<uintptr_t>(srcAllocation->getGpuAddress() + offset);
     ze_result_t ret = ZE_RESULT_ERROR_UNKNOWN;
     if (isCopyOnly()) {
         return appendMemoryCopyBlit(dstAddress, dstAllocation, 0u,
@@ -1140,6 +1268,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopy(void *dstptr,
     uintptr_t middleSizeBytes = size - leftSize - rightSize;
 
     if (!isAligned<4>(reinterpret_cast<uintptr_t>(srcptr) + leftSize)) {
+        PERFORMANCE_HINT(NEO::PerformanceHintId::UnalignedCopy, reinterpret_cast<uintptr_t>(srcptr), reinterpret_cast<uintptr_t>(dstptr), size);
         leftSize += middleSizeBytes;
         middleSizeBytes = 0;
     }
@@ -1544,6 +1673,25 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryFill(void *ptr,
     }
 
     auto dstAllocation = this->getAlignedAllocation(this->device, ptr, size, false);
+    auto dstGpuAddress = static_cast<uint64_t>(dstAllocation.alignedAllocationPtr + dstAllocation.offset);
+    if (isMemoryFillWithStoreDataImmAllowed(dstGpuAddress, size)) {
+        bool workloadPartition = setupTimestampEventForMultiTile(signalEvent);
+        appendEventForProfiling(signalEvent, true, workloadPartition);
+        commandContainer.addToResidencyContainer(dstAllocation.alloc);
+        appendMemoryFillWithStoreDataImm(dstGpuAddress, pattern, patternSize, size);
+        appendSignalEventPostWalker(signalEvent, workloadPartition);
+        addFlushRequiredCommand(hostPointerNeedsFlush, signalEvent);
+
+        if (NEO::DebugManager.flags.EnableSWTags.get()) {
+            neoDevice->getRootDeviceEnvironment().tagsManager->insertTag<GfxFamily, NEO::SWTags::CallNameEndTag>(
+                *commandContainer.getCommandStream(),
+                *neoDevice,
+                "zeCommandListAppendMemoryFill",
+                callId);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
     if (size >= 4ull * MemoryConstants::gigaByte) {
         isStateless = true;
     }
@@ -1609,13 +1757,14 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryFill(void *ptr,
         }
     } else {
 
-        Kernel *builtinKernel = nullptr;
-        if (isStateless) {
-            builtinKernel = device->getBuiltinFunctionsLib()->getFunction(Builtin::FillBufferMiddleStateless);
-        } else {
-            builtinKernel = device->getBuiltinFunctionsLib()->getFunction(Builtin::FillBufferMiddle);
-        }
+        // pattern allocation is replicated to cache line size, vector stores need only aligned destination
         size_t middleElSize = sizeof(uint32_t);
+        Builtin middleBuiltin = isStateless ? Builtin::FillBufferMiddleStateless : Builtin::FillBufferMiddle;
+        if (isAligned<4 * sizeof(uint32_t)>(dstAllocation.alignedAllocationPtr + dstAllocation.offset)) {
+            middleElSize = 4 * sizeof(uint32_t);
+            middleBuiltin = isStateless ? Builtin::FillBufferMiddleVecStateless : Builtin::FillBufferMiddleVec;
+        }
+        Kernel *builtinKernel = device->getBuiltinFunctionsLib()->getFunction(middleBuiltin);
         size_t adjustedSize = size / middleElSize;
         uint32_t groupSizeX = static_cast<uint32_t>(adjustedSize);
         uint32_t groupSizeY = 1, groupSizeZ = 1;
@@ -1710,6 +1859,42 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryFill(void *ptr,
     return res;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamily<gfxCoreFamily>::isMemoryFillWithStoreDataImmAllowed(uint64_t dstGpuAddress, size_t size) const {
+    auto maxSize = NEO::DebugManager.flags.MemoryFillStoreDataImmMaxSize.get();
+    if (maxSize <= 0 || size > static_cast<size_t>(maxSize)) {
+        return false;
+    }
+    return size > 0 && isAligned<sizeof(uint32_t)>(size) && isAligned<sizeof(uint32_t)>(dstGpuAddress);
+}
+
+// fills of few bytes are written by command streamer, pattern is known at append time
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::appendMemoryFillWithStoreDataImm(uint64_t dstGpuAddress, const void *pattern, size_t patternSize, size_t size) {
+    auto patternBytes = reinterpret_cast<const uint8_t *>(pattern);
+    auto getDword = [&](size_t offset) {
+        uint32_t dword = 0;
+        auto dwordBytes = reinterpret_cast<uint8_t *>(&dword);
+        for (size_t i = 0; i < sizeof(uint32_t); i++) {
+            dwordBytes[i] = patternBytes[(offset + i) % patternSize];
+        }
+        return dword;
+    };
+
+    size_t offset = 0;
+    while (offset < size) {
+        auto gpuAddress = dstGpuAddress + offset;
+        bool storeQword = isAligned<sizeof(uint64_t)>(gpuAddress) && (size - offset) >= sizeof(uint64_t);
+        NEO::EncodeStoreMemory<GfxFamily>::programStoreDataImm(*commandContainer.getCommandStream(),
+                                                               gpuAddress,
+                                                               getDword(offset),
+                                                               storeQword ? getDword(offset + sizeof(uint32_t)) : 0u,
+                                                               storeQword,
+                                                               false);
+        offset += storeQword ? sizeof(uint64_t) : sizeof(uint32_t);
+    }
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendBlitFill(void *ptr,
                                                                  const void *pattern,
@@ -1719,42 +1904,66 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendBlitFill(void *ptr,
                                                                  uint32_t numWaitEvents,
                                                                  ze_event_handle_t *phWaitEvents) {
     auto neoDevice = device->getNEODevice();
-    if (NEO::HwHelper::get(device->getHwInfo().platform.eRenderCoreFamily).getMaxFillPaternSizeForCopyEngine() < patternSize) {
-        return ZE_RESULT_ERROR_INVALID_SIZE;
-    } else {
-        ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents);
-        if (ret) {
-            return ret;
+    ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents);
+    if (ret) {
+        return ret;
+    }
+
+    appendEventForProfiling(signalEvent, true, false);
+    NEO::GraphicsAllocation *gpuAllocation = device->getDriverHandle()->getDriverSystemMemoryAllocation(ptr,
+                                                                                                        size,
+                                                                                                        neoDevice->getRootDeviceIndex(),
+                                                                                                        nullptr);
+    DriverHandleImp *driverHandle = static_cast<DriverHandleImp *>(device->getDriverHandle());
+    auto allocData = driverHandle->getSvmAllocsManager()->getSVMAlloc(ptr);
+    if (driverHandle->isRemoteResourceNeeded(ptr, gpuAllocation, allocData, device)) {
+        if (allocData) {
+            uint64_t pbase = allocData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress();
+            gpuAllocation = driverHandle->getPeerAllocation(device, allocData, reinterpret_cast<void *>(pbase), nullptr);
+        }
+        if (gpuAllocation == nullptr) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
         }
+    }
 
-        appendEventForProfiling(signalEvent, true, false);
-        NEO::GraphicsAllocation *gpuAllocation = device->getDriverHandle()->getDriverSystemMemoryAllocation(ptr,
-                                                                                                            size,
-                                                                                                            neoDevice->getRootDeviceIndex(),
-                                                                                                            nullptr);
-        DriverHandleImp *driverHandle = static_cast<DriverHandleImp *>(device->getDriverHandle());
-        auto allocData = driverHandle->getSvmAllocsManager()->getSVMAlloc(ptr);
-        if (driverHandle->isRemoteResourceNeeded(ptr, gpuAllocation, allocData, device)) {
-            if (allocData) {
-                uint64_t pbase = allocData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress();
-                gpuAllocation = driverHandle->getPeerAllocation(device, allocData, reinterpret_cast<void *>(pbase), nullptr);
-            }
-            if (gpuAllocation == nullptr) {
-                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    uint64_t offset = reinterpret_cast<uint64_t>(static_cast<uint64_t *>(ptr)) - static_cast<uint64_t>(gpuAllocation->getGpuAddress());
+    auto &rootDeviceEnvironment = *neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()];
+
+    commandContainer.addToResidencyContainer(gpuAllocation);
+    if (NEO::HwHelper::get(device->getHwInfo().platform.eRenderCoreFamily).getMaxFillPaternSizeForCopyEngine() < patternSize) {
+        // pattern too large for color fill is replicated in staging allocation and copied
+        size_t patternAllocationSize = std::min(size, std::max(patternSize, (MemoryConstants::pageSize64k / patternSize) * patternSize));
+        auto patternGfxAlloc = device->obtainReusableAllocation(patternAllocationSize, NEO::AllocationType::FILL_PATTERN);
+        if (patternGfxAlloc == nullptr) {
+            patternGfxAlloc = device->getDriverHandle()->getMemoryManager()->allocateGraphicsMemoryWithProperties({neoDevice->getRootDeviceIndex(),
+                                                                                                                   patternAllocationSize,
+                                                                                                                   NEO::AllocationType::FILL_PATTERN,
+                                                                                                                   neoDevice->getDeviceBitfield()});
+            if (patternGfxAlloc == nullptr) {
+                return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
             }
         }
+        patternAllocations.push_back(patternGfxAlloc);
+        for (size_t patternOffset = 0; patternOffset < patternAllocationSize; patternOffset += patternSize) {
+            auto sizeToCopy = std::min(patternSize, patternAllocationSize - patternOffset);
+            memcpy_s(ptrOffset(patternGfxAlloc->getUnderlyingBuffer(), patternOffset), sizeToCopy, pattern, sizeToCopy);
+        }
 
-        uint64_t offset = reinterpret_cast<uint64_t>(static_cast<uint64_t *>(ptr)) - static_cast<uint64_t>(gpuAllocation->getGpuAddress());
-
-        commandContainer.addToResidencyContainer(gpuAllocation);
+        auto clearColorAllocation = neoDevice->getDefaultEngine().commandStreamReceiver->getClearColorAllocation();
+        commandContainer.addToResidencyContainer(patternGfxAlloc);
+        commandContainer.addToResidencyContainer(clearColorAllocation);
+        NEO::BlitCommandsHelper<GfxFamily>::dispatchBlitMemoryPatternFill(gpuAllocation, offset, patternGfxAlloc, patternAllocationSize,
+                                                                          *commandContainer.getCommandStream(), size,
+                                                                          clearColorAllocation, rootDeviceEnvironment);
+    } else {
         uint32_t patternToCommand[4] = {};
         memcpy_s(&patternToCommand, sizeof(patternToCommand), pattern, patternSize);
         NEO::BlitCommandsHelper<GfxFamily>::dispatchBlitMemoryColorFill(gpuAllocation, offset, patternToCommand, patternSize,
                                                                         *commandContainer.getCommandStream(),
                                                                         size,
-                                                                        *neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()]);
-        appendSignalEventPostWalker(signalEvent, false);
+                                                                        rootDeviceEnvironment);
     }
+    appendSignalEventPostWalker(signalEvent, false);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -2014,6 +2223,10 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(uint32_t nu
 
     for (uint32_t i = 0; i < numEvents; i++) {
         auto event = Event::fromHandle(phEvent[i]);
+        if (event->isCounterBased()) {
+            appendWaitOnCounterBasedEvent(static_cast<CounterBasedEvent *>(event));
+            continue;
+        }
         commandContainer.addToResidencyContainer(&event->getAllocation(this->device));
         gpuAddr = event->getGpuAddress(this->device);
         uint32_t packetsToWait = event->getPacketsInUse();
@@ -2042,6 +2255,32 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(uint32_t nu
     return ZE_RESULT_SUCCESS;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::appendWaitOnCounterBasedEvent(CounterBasedEvent *event) {
+    using COMPARE_OPERATION = typename GfxFamily::MI_SEMAPHORE_WAIT::COMPARE_OPERATION;
+
+    NEO::CommandStreamReceiver *completionCsr = nullptr;
+    uint32_t completionTaskCount = 0u;
+    if (!event->getCompletionState(completionCsr, completionTaskCount)) {
+        return;
+    }
+
+    if (completionCsr->peekLatestFlushedTaskCount() < completionTaskCount) {
+        completionCsr->flushTagUpdate();
+    }
+
+    auto tagAllocation = completionCsr->getTagAllocation();
+    commandContainer.addToResidencyContainer(tagAllocation);
+    uint64_t gpuAddr = tagAllocation->getGpuAddress();
+    for (uint32_t i = 0u; i < completionCsr->getActivePartitions(); i++) {
+        NEO::EncodeSempahore<GfxFamily>::addMiSemaphoreWaitCommand(*commandContainer.getCommandStream(),
+                                                                   gpuAddr,
+                                                                   completionTaskCount,
+                                                                   COMPARE_OPERATION::COMPARE_OPERATION_SAD_GREATER_THAN_OR_EQUAL_SDD);
+        gpuAddr += completionCsr->getPostSyncWriteOffset();
+    }
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::programSyncBuffer(Kernel &kernel, NEO::Device &device,
                                                                     const ze_group_count_t *threadGroupDimensions) {
@@ -2280,6 +2519,26 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::reserveSpace(size_t size, void
     return ZE_RESULT_SUCCESS;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamily<gfxCoreFamily>::getUsmGpuAddressAndMakeResident(const void *ptr, uint64_t &gpuAddress) {
+    auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
+    if (allocData == nullptr) {
+        return false;
+    }
+    auto alloc = allocData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+    commandContainer.addToResidencyContainer(alloc);
+
+    size_t offset = 0;
+    if (allocData->cpuAllocation != nullptr) {
+        commandContainer.addToResidencyContainer(allocData->cpuAllocation);
+        offset = ptrDiff(ptr, allocData->cpuAllocation->getUnderlyingBuffer());
+    } else {
+        offset = ptrDiff(ptr, alloc->getGpuAddress());
+    }
+    gpuAddress = ptrOffset(alloc->getGpuAddress(), offset);
+    return true;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::prepareIndirectParams(const ze_group_count_t *threadGroupDimensions) {
     auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(threadGroupDimensions);
@@ -2375,6 +2634,76 @@ void CommandListCoreFamily<gfxCoreFamily>::updateStreamProperties(Kernel &kernel
     }
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::storeKernelLaunchToPatch(Kernel *kernel, const NEO::EncodeDispatchKernelArgs &dispatchKernelArgs, const CmdListKernelLaunchParams &launchParams) {
+    if (cmdListType != CommandListType::TYPE_REGULAR || internalUsage || launchParams.isBuiltInKernel) {
+        return;
+    }
+
+    KernelLaunchToPatch kernelLaunch{};
+    kernelLaunch.kernel = kernel;
+
+    // only launches with a single walker and all arguments in cross thread data can be patched in place
+    const auto &kernelDescriptor = kernel->getKernelDescriptor();
+    bool patchable = !launchParams.isIndirect &&
+                     dispatchKernelArgs.partitionCount == 1 &&
+                     dispatchKernelArgs.outWalkerPtr != nullptr &&
+                     dispatchKernelArgs.outIndirectDataPtr != nullptr &&
+                     kernel->getImplicitArgs() == nullptr &&
+                     !kernel->usesSyncBuffer() &&
+                     kernelDescriptor.payloadMappings.bindingTable.numEntries == 0;
+    if (patchable) {
+        kernelLaunch.walker = dispatchKernelArgs.outWalkerPtr;
+        kernelLaunch.indirectData = dispatchKernelArgs.outIndirectDataPtr;
+        kernelLaunch.crossThreadDataSize = kernel->getCrossThreadDataSize();
+        auto groupSize = kernel->getGroupSize();
+        std::copy(groupSize, groupSize + 3, kernelLaunch.groupSize);
+    }
+    kernelLaunchesToPatch.push_back(kernelLaunch);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamily<gfxCoreFamily>::updateKernelLaunch(uint32_t launchIndex, ze_kernel_handle_t hKernel,
+                                                                     const ze_group_count_t *threadGroupDimensions) {
+    if (launchIndex >= kernelLaunchesToPatch.size() || threadGroupDimensions == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto &kernelLaunch = kernelLaunchesToPatch[launchIndex];
+    auto kernel = Kernel::fromHandle(hKernel);
+    if (kernel != kernelLaunch.kernel) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (kernelLaunch.walker == nullptr) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    auto groupSize = kernel->getGroupSize();
+    if (!std::equal(groupSize, groupSize + 3, kernelLaunch.groupSize) ||
+        kernel->getCrossThreadDataSize() != kernelLaunch.crossThreadDataSize) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    kernel->setGroupCount(threadGroupDimensions->groupCountX,
+                          threadGroupDimensions->groupCountY,
+                          threadGroupDimensions->groupCountZ);
+
+    const auto &kernelDescriptor = kernel->getKernelDescriptor();
+    NEO::EncodeDispatchKernel<GfxFamily>::patchCrossThreadData(kernelLaunch.walker, kernelLaunch.indirectData, kernelDescriptor,
+                                                               kernel->getCrossThreadData(), kernel->getCrossThreadDataSize());
+
+    const uint32_t threadGroupCount[3] = {threadGroupDimensions->groupCountX,
+                                          threadGroupDimensions->groupCountY,
+                                          threadGroupDimensions->groupCountZ};
+    NEO::EncodeDispatchKernel<GfxFamily>::patchThreadGroupCount(kernelLaunch.walker, threadGroupCount, device->getHwInfo(),
+                                                                kernelDescriptor.kernelAttributes.numGrfRequired);
+
+    for (auto resource : kernel->getResidencyContainer()) {
+        commandContainer.addToResidencyContainer(resource);
+    }
+    commandContainer.removeDuplicatesFromResidencyContainer();
+
+    return ZE_RESULT_SUCCESS;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandListCoreFamily<gfxCoreFamily>::clearCommandsToPatch() {
     using VFE_STATE_TYPE = typename GfxFamily::VFE_STATE_TYPE;
@@ -2416,19 +2745,53 @@ bool CommandListCoreFamily<gfxCoreFamily>::isAppendSplitNeeded(void *dstPtr, con
     auto dstMemoryPool = dstAllocationStruct.alloc->getMemoryPool();
     auto srcMemoryPool = srcAllocationStruct.alloc->getMemoryPool();
 
-    return this->isAppendSplitNeeded(dstMemoryPool, srcMemoryPool, size);
+    if (this->isAppendSplitNeeded(dstMemoryPool, srcMemoryPool, size)) {
+        return true;
+    }
+
+    // peer copies are striped across link copy engines as well, the transfer is bound by link bandwidth
+    return this->isBcsSplitNeeded &&
+           size >= minimalSizeForBcsSplit &&
+           !NEO::MemoryPoolHelper::isSystemMemoryPool(dstMemoryPool) &&
+           !NEO::MemoryPoolHelper::isSystemMemoryPool(srcMemoryPool) &&
+           this->isPeerCopyOverDeviceLink(dstPtr, srcPtr, size);
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 inline bool CommandListCoreFamily<gfxCoreFamily>::isAppendSplitNeeded(NEO::MemoryPool dstPool, NEO::MemoryPool srcPool, size_t size) {
-    constexpr size_t minimalSizeForBcsSplit = 4 * MemoryConstants::megaByte;
-
     return this->isBcsSplitNeeded &&
            size >= minimalSizeForBcsSplit &&
            ((!NEO::MemoryPoolHelper::isSystemMemoryPool(dstPool) && NEO::MemoryPoolHelper::isSystemMemoryPool(srcPool)) ||
             (!NEO::MemoryPoolHelper::isSystemMemoryPool(srcPool) && NEO::MemoryPoolHelper::isSystemMemoryPool(dstPool)));
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamily<gfxCoreFamily>::isPeerCopyOverDeviceLink(void *dstPtr, const void *srcPtr, size_t size) {
+    if (NEO::DebugManager.flags.SplitBcsForPeerCopies.get() == 0) {
+        return false;
+    }
+
+    auto deviceImp = static_cast<DeviceImp *>(this->device);
+    if (deviceImp->fabricVertex == nullptr) {
+        return false;
+    }
+
+    for (auto ptr : {dstPtr, const_cast<void *>(srcPtr)}) {
+        NEO::SvmAllocationData *allocData = nullptr;
+        if (!this->device->getDriverHandle()->findAllocationDataForRange(ptr, size, &allocData) ||
+            allocData->device == nullptr ||
+            allocData->memoryType != InternalMemoryType::DEVICE_UNIFIED_MEMORY) {
+            continue;
+        }
+        auto peerDevice = static_cast<DeviceImp *>(allocData->device->getSpecializedDevice<Device>());
+        if (peerDevice != nullptr && peerDevice->fabricVertex != nullptr &&
+            deviceImp->fabricVertex->isPeerLinkAvailable(*peerDevice->fabricVertex)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::setGlobalWorkSizeIndirect(NEO::CrossThreadDataOffset offsets[3], uint64_t crossThreadAddress, uint32_t lws[3]) {
     NEO::EncodeIndirectParams<GfxFamily>::setGlobalWorkSizeIndirect(commandContainer, offsets, crossThreadAddress, lws);
@@ -9,7 +9,10 @@
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw.h"
 
+#include <mutex>
+
 namespace NEO {
+class StagingBufferManager;
 struct SvmAllocationData;
 }
 
@@ -26,6 +29,8 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
 
     using BaseClass::BaseClass;
 
+    ~CommandListCoreFamilyImmediate() override;
+
     ze_result_t appendLaunchKernel(ze_kernel_handle_t kernelHandle,
                                    const ze_group_count_t *threadGroupDimensions,
                                    ze_event_handle_t hEvent, uint32_t numWaitEvents,
@@ -37,6 +42,18 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
                                            ze_event_handle_t hEvent, uint32_t numWaitEvents,
                                            ze_event_handle_t *phWaitEvents) override;
 
+    ze_result_t appendLaunchMultipleKernels(uint32_t numKernels,
+                                            const ze_kernel_handle_t *kernelHandles,
+                                            const ze_group_count_t *pLaunchFuncArgs,
+                                            ze_event_handle_t hEvent, uint32_t numWaitEvents,
+                                            ze_event_handle_t *phWaitEvents) override;
+
+    ze_result_t appendConditionalLaunchKernel(ze_kernel_handle_t kernelHandle,
+                                              const ze_group_count_t *threadGroupDimensions,
+                                              const uint32_t *pCondition,
+                                              ze_event_handle_t hEvent, uint32_t numWaitEvents,
+                                              ze_event_handle_t *phWaitEvents) override;
+
     ze_result_t appendBarrier(ze_event_handle_t hSignalEvent,
                               uint32_t numWaitEvents,
                               ze_event_handle_t *phWaitEvents) override;
@@ -70,9 +87,9 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
 
     ze_result_t appendEventReset(ze_event_handle_t hEvent) override;
 
-    ze_result_t appendPageFaultCopy(NEO::GraphicsAllocation *dstAllocation,
-                                    NEO::GraphicsAllocation *srcAllocation,
-                                    size_t size, bool flushHost) override;
+    ze_result_t appendPageFaultCopyRange(NEO::GraphicsAllocation *dstAllocation,
+                                         NEO::GraphicsAllocation *srcAllocation,
+                                         size_t offset, size_t size, bool flushHost) override;
 
     ze_result_t appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phEvent) override;
 
@@ -118,12 +135,22 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
                                           uint32_t numWaitEvents,
                                           ze_event_handle_t *phWaitEvents) override;
 
+    ze_result_t beginGraphCapture() override;
+    ze_result_t endGraphCapture(ze_command_list_handle_t *phGraph) override;
+    ze_result_t appendGraph(ze_command_list_handle_t hGraph) override;
+
     MOCKABLE_VIRTUAL ze_result_t executeCommandListImmediateWithFlushTask(bool performMigration);
 
+    // append, encode and flush of one call stay atomic when the list is shared between threads
+    using MutexType = std::recursive_mutex;
+    [[nodiscard]] std::unique_lock<MutexType> obtainAppendOwnership();
+
     void checkAvailableSpace();
     void updateDispatchFlagsWithRequiredStreamState(NEO::DispatchFlags &dispatchFlags);
 
     ze_result_t flushImmediate(ze_result_t inputRet, bool performMigration);
+    bool takeCounterBasedSignalEvent(ze_event_handle_t &hSignalEvent);
+    void signalCounterBasedEvent();
 
     void createLogicalStateHelper() override {}
     NEO::LogicalStateHelper *getLogicalStateHelper() const override;
@@ -131,10 +158,15 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     bool preferCopyThroughLockedPtr(NEO::SvmAllocationData *dstAlloc, bool dstFound, NEO::SvmAllocationData *srcAlloc, bool srcFound, size_t size);
     bool isAllocUSMDeviceMemory(NEO::SvmAllocationData *alloc, bool allocFound);
     ze_result_t performCpuMemcpy(void *dstptr, const void *srcptr, size_t size, bool isDstDeviceMemory, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
+    ze_result_t performStagingCopy(NEO::StagingBufferManager &stagingBufferManager, void *dstptr, const void *srcptr, size_t size);
     void *obtainLockedPtrFromDevice(void *ptr, size_t size);
+    void copyThroughLockedPtr(void *dstptr, const void *srcptr, size_t size, bool isDstDeviceMemory);
 
   protected:
     std::atomic<bool> barrierCalled{false};
+    MutexType appendMutex;
+    CommandList *graphCaptureTarget = nullptr; // regular command list recording appends between begin and end of graph capture
+    CounterBasedEvent *counterBasedSignalEvent = nullptr; // signaled with the task count of the next flush
 };
 
 template <PRODUCT_FAMILY gfxProductFamily>
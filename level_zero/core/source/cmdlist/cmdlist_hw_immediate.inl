@@ -13,10 +13,15 @@
 #include "shared/source/helpers/logical_state_helper.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/prefetch_manager.h"
+#include "shared/source/memory_manager/staging_buffer_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/utilities/cpuintrinsics.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
 #include "level_zero/core/source/device/bcs_split.h"
+#include "level_zero/core/source/driver/driver_handle_imp.h"
+
+#include <thread>
 
 namespace L0 {
 
@@ -25,6 +30,14 @@ NEO::LogicalStateHelper *CommandListCoreFamilyImmediate<gfxCoreFamily>::getLogic
     return this->csr->getLogicalStateHelper();
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+std::unique_lock<typename CommandListCoreFamilyImmediate<gfxCoreFamily>::MutexType> CommandListCoreFamilyImmediate<gfxCoreFamily>::obtainAppendOwnership() {
+    if (NEO::DebugManager.flags.EnableThreadSafeImmediateCommandList.get() == 1) {
+        return std::unique_lock<MutexType>(appendMutex);
+    }
+    return std::unique_lock<MutexType>();
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace() {
     if (this->commandContainer.getCommandStream()->getAvailableSpace() < maxImmediateCommandSize) {
@@ -175,6 +188,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
     ze_kernel_handle_t kernelHandle, const ze_group_count_t *threadGroupDimensions,
     ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents,
     const CmdListKernelLaunchParams &launchParams) {
+    auto appendLock = this->obtainAppendOwnership();
+    if (!this->takeCounterBasedSignalEvent(hSignalEvent)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendLaunchKernel(kernelHandle, threadGroupDimensions, hSignalEvent, numWaitEvents, phWaitEvents, launchParams);
+    }
 
     if (this->isFlushTaskSubmissionEnabled) {
         checkAvailableSpace();
@@ -190,6 +210,13 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelIndirect(
     ze_kernel_handle_t kernelHandle, const ze_group_count_t *pDispatchArgumentsBuffer,
     ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    auto appendLock = this->obtainAppendOwnership();
+    if (!this->takeCounterBasedSignalEvent(hSignalEvent)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendLaunchKernelIndirect(kernelHandle, pDispatchArgumentsBuffer, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
 
     if (this->isFlushTaskSubmissionEnabled) {
         checkAvailableSpace();
@@ -199,11 +226,82 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernelInd
     return flushImmediate(ret, true);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendConditionalLaunchKernel(
+    ze_kernel_handle_t kernelHandle, const ze_group_count_t *threadGroupDimensions, const uint32_t *pCondition,
+    ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    auto appendLock = this->obtainAppendOwnership();
+    if (!this->takeCounterBasedSignalEvent(hSignalEvent)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendConditionalLaunchKernel(kernelHandle, threadGroupDimensions, pCondition, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
+
+    if (this->isFlushTaskSubmissionEnabled) {
+        checkAvailableSpace();
+    }
+    auto ret = CommandListCoreFamily<gfxCoreFamily>::appendConditionalLaunchKernel(kernelHandle, threadGroupDimensions, pCondition,
+                                                                                   hSignalEvent, numWaitEvents, phWaitEvents);
+    return flushImmediate(ret, true);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchMultipleKernels(
+    uint32_t numKernels, const ze_kernel_handle_t *kernelHandles, const ze_group_count_t *pLaunchFuncArgs,
+    ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    auto appendLock = this->obtainAppendOwnership();
+    if (!this->takeCounterBasedSignalEvent(hSignalEvent)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendLaunchMultipleKernels(numKernels, kernelHandles, pLaunchFuncArgs, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
+
+    if (!this->isFlushTaskSubmissionEnabled) {
+        auto ret = CommandListCoreFamily<gfxCoreFamily>::appendLaunchMultipleKernels(numKernels, kernelHandles, pLaunchFuncArgs,
+                                                                                     hSignalEvent, numWaitEvents, phWaitEvents);
+        return flushImmediate(ret, true);
+    }
+
+    // flush task submission requires each submission to fit into a single command buffer
+    const auto maxKernelsPerFlush = std::max(static_cast<uint32_t>(this->commandContainer.getCommandStream()->getMaxAvailableSpace() / maxImmediateCommandSize), 1u);
+    ze_result_t ret = ZE_RESULT_SUCCESS;
+    uint32_t firstKernel = 0u;
+    do {
+        const auto numKernelsInFlush = std::min(numKernels - firstKernel, maxKernelsPerFlush);
+        const bool isFirstFlush = (firstKernel == 0u);
+        const bool isLastFlush = (firstKernel + numKernelsInFlush == numKernels);
+
+        if (this->commandContainer.getCommandStream()->getAvailableSpace() < std::max(numKernelsInFlush, 1u) * maxImmediateCommandSize) {
+            this->commandContainer.allocateNextCommandBuffer();
+            this->cmdListCurrentStartOffset = 0;
+        }
+
+        ret = CommandListCoreFamily<gfxCoreFamily>::appendLaunchMultipleKernels(numKernelsInFlush,
+                                                                                kernelHandles ? &kernelHandles[firstKernel] : nullptr,
+                                                                                pLaunchFuncArgs ? &pLaunchFuncArgs[firstKernel] : nullptr,
+                                                                                isLastFlush ? hSignalEvent : nullptr,
+                                                                                isFirstFlush ? numWaitEvents : 0u,
+                                                                                isFirstFlush ? phWaitEvents : nullptr);
+        ret = flushImmediate(ret, true);
+        firstKernel += numKernelsInFlush;
+    } while (ret == ZE_RESULT_SUCCESS && firstKernel < numKernels);
+    return ret;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendBarrier(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
+    auto appendLock = this->obtainAppendOwnership();
+    if (!this->takeCounterBasedSignalEvent(hSignalEvent)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendBarrier(hSignalEvent, numWaitEvents, phWaitEvents);
+    }
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
     if (this->isFlushTaskSubmissionEnabled) {
@@ -222,6 +320,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
+    auto appendLock = this->obtainAppendOwnership();
+    if (!this->takeCounterBasedSignalEvent(hSignalEvent)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMemoryCopy(dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
 
     if (this->isFlushTaskSubmissionEnabled) {
         checkAvailableSpace();
@@ -237,6 +342,11 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
         return performCpuMemcpy(dstptr, srcptr, size, dstAllocFound, hSignalEvent, numWaitEvents, phWaitEvents);
     }
 
+    auto stagingBufferManager = static_cast<DriverHandleImp *>(this->device->getDriverHandle())->stagingBufferManager.get();
+    if (!srcAllocFound && stagingBufferManager && stagingBufferManager->isValidForCopy(srcptr, size, hSignalEvent != nullptr || numWaitEvents > 0)) {
+        return performStagingCopy(*stagingBufferManager, dstptr, srcptr, size);
+    }
+
     if (this->isAppendSplitNeeded(dstptr, srcptr, size)) {
         ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, void *, const void *>(this, dstptr, srcptr, size, hSignalEvent, [&](void *dstptrParam, const void *srcptrParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
             return CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopy(dstptrParam, srcptrParam, sizeParam, hSignalEventParam, numWaitEvents, phWaitEvents);
@@ -248,6 +358,18 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(
     return flushImmediate(ret, true);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performStagingCopy(NEO::StagingBufferManager &stagingBufferManager, void *dstptr, const void *srcptr, size_t size) {
+    NEO::ChunkCopyFunction chunkCopy = [&](void *stagingBuffer, size_t chunkOffset, size_t chunkSize) -> int32_t {
+        if (this->isFlushTaskSubmissionEnabled) {
+            checkAvailableSpace();
+        }
+        auto ret = CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopy(ptrOffset(dstptr, chunkOffset), stagingBuffer, chunkSize, nullptr, 0, nullptr);
+        return flushImmediate(ret, true);
+    };
+    return static_cast<ze_result_t>(stagingBufferManager.performCopy(srcptr, size, chunkCopy, this->csr));
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopyRegion(
     void *dstPtr,
@@ -261,6 +383,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopyRegio
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
+    auto appendLock = this->obtainAppendOwnership();
+    if (!this->takeCounterBasedSignalEvent(hSignalEvent)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMemoryCopyRegion(dstPtr, dstRegion, dstPitch, dstSlicePitch, srcPtr, srcRegion, srcPitch, srcSlicePitch, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
 
     if (this->isFlushTaskSubmissionEnabled) {
         checkAvailableSpace();
@@ -268,7 +397,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopyRegio
 
     ze_result_t ret;
 
-    if (this->isAppendSplitNeeded(dstPtr, srcPtr, this->getTotalSizeForCopyRegion(dstRegion, dstPitch, dstSlicePitch))) {
+    if (!this->counterBasedSignalEvent && this->isAppendSplitNeeded(dstPtr, srcPtr, this->getTotalSizeForCopyRegion(dstRegion, dstPitch, dstSlicePitch))) {
         ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, uint32_t, uint32_t>(this, dstRegion->originX, srcRegion->originX, dstRegion->width, hSignalEvent, [&](uint32_t dstOriginXParam, uint32_t srcOriginXParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
             ze_copy_region_t dstRegionLocal = {};
             ze_copy_region_t srcRegionLocal = {};
@@ -296,6 +425,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryFill(void
                                                                             ze_event_handle_t hSignalEvent,
                                                                             uint32_t numWaitEvents,
                                                                             ze_event_handle_t *phWaitEvents) {
+    auto appendLock = this->obtainAppendOwnership();
+    if (!this->takeCounterBasedSignalEvent(hSignalEvent)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMemoryFill(ptr, pattern, patternSize, size, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
 
     if (this->isFlushTaskSubmissionEnabled) {
         checkAvailableSpace();
@@ -306,6 +442,14 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryFill(void
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalEvent(ze_event_handle_t hSignalEvent) {
+    auto appendLock = this->obtainAppendOwnership();
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendSignalEvent(hSignalEvent);
+    }
+    if (Event::fromHandle(hSignalEvent)->isCounterBased()) {
+        static_cast<CounterBasedEvent *>(Event::fromHandle(hSignalEvent))->assignTaskCount(this->csr, this->csr->peekTaskCount());
+        return ZE_RESULT_SUCCESS;
+    }
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
@@ -318,6 +462,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalEvent(ze_
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendEventReset(ze_event_handle_t hSignalEvent) {
+    auto appendLock = this->obtainAppendOwnership();
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendEventReset(hSignalEvent);
+    }
+    if (Event::fromHandle(hSignalEvent)->isCounterBased()) {
+        return ZE_RESULT_SUCCESS;
+    }
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
     ze_result_t ret = ZE_RESULT_SUCCESS;
 
@@ -329,9 +480,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendEventReset(ze_e
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
-ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(NEO::GraphicsAllocation *dstAllocation,
-                                                                               NEO::GraphicsAllocation *srcAllocation,
-                                                                               size_t size, bool flushHost) {
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopyRange(NEO::GraphicsAllocation *dstAllocation,
+                                                                                    NEO::GraphicsAllocation *srcAllocation,
+                                                                                    size_t offset, size_t size, bool flushHost) {
+    auto appendLock = this->obtainAppendOwnership();
 
     if (this->isFlushTaskSubmissionEnabled) {
         checkAvailableSpace();
@@ -340,8 +492,8 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(N
     ze_result_t ret;
 
     if (this->isAppendSplitNeeded(dstAllocation->getMemoryPool(), srcAllocation->getMemoryPool(), size)) {
-        uintptr_t dstAddress = static_cast<uintptr_t>(dstAllocation->getGpuAddress());
-        uintptr_t srcAddress = static_cast<uintptr_t>(srcAllocation->getGpuAddress());
+        uintptr_t dstAddress = static_cast<uintptr_t>(dstAllocation->getGpuAddress() + offset);
+        uintptr_t srcAddress = static_cast<uintptr_t>(srcAllocation->getGpuAddress() + offset);
         ret = static_cast<DeviceImp *>(this->device)->bcsSplit.appendSplitCall<gfxCoreFamily, uintptr_t, uintptr_t>(this, dstAddress, srcAddress, size, nullptr, [&](uintptr_t dstAddressParam, uintptr_t srcAddressParam, size_t sizeParam, ze_event_handle_t hSignalEventParam) {
             this->appendMemoryCopyBlit(dstAddressParam, dstAllocation, 0u,
                                        srcAddressParam, srcAllocation, 0u,
@@ -349,13 +501,17 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendPageFaultCopy(N
             return this->appendSignalEvent(hSignalEventParam);
         });
     } else {
-        ret = CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopy(dstAllocation, srcAllocation, size, flushHost);
+        ret = CommandListCoreFamily<gfxCoreFamily>::appendPageFaultCopyRange(dstAllocation, srcAllocation, offset, size, flushHost);
     }
     return flushImmediate(ret, false);
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phWaitEvents) {
+    auto appendLock = this->obtainAppendOwnership();
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendWaitOnEvents(numEvents, phWaitEvents);
+    }
     if (this->isFlushTaskSubmissionEnabled) {
         checkAvailableSpace();
     }
@@ -367,6 +523,13 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendWriteGlobalTimestamp(
     uint64_t *dstptr, ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    auto appendLock = this->obtainAppendOwnership();
+    if (!this->takeCounterBasedSignalEvent(hSignalEvent)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendWriteGlobalTimestamp(dstptr, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
 
     if (this->isFlushTaskSubmissionEnabled) {
         checkAvailableSpace();
@@ -379,6 +542,7 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopyFromContext(
     void *dstptr, ze_context_handle_t hContextSrc, const void *srcptr,
     size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    auto appendLock = this->obtainAppendOwnership();
 
     return CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryCopy(dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents);
 }
@@ -389,6 +553,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopy(
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
+    auto appendLock = this->obtainAppendOwnership();
 
     return CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyRegion(dst, src, nullptr, nullptr, hSignalEvent,
                                                                                 numWaitEvents, phWaitEvents);
@@ -402,6 +567,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyRegion
                                                                                  ze_event_handle_t hSignalEvent,
                                                                                  uint32_t numWaitEvents,
                                                                                  ze_event_handle_t *phWaitEvents) {
+    auto appendLock = this->obtainAppendOwnership();
+    if (!this->takeCounterBasedSignalEvent(hSignalEvent)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendImageCopyRegion(hDstImage, hSrcImage, pDstRegion, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
 
     if (this->isFlushTaskSubmissionEnabled) {
         checkAvailableSpace();
@@ -419,6 +591,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyFromMe
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
+    auto appendLock = this->obtainAppendOwnership();
+    if (!this->takeCounterBasedSignalEvent(hSignalEvent)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendImageCopyFromMemory(hDstImage, srcPtr, pDstRegion, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
 
     if (this->isFlushTaskSubmissionEnabled) {
         checkAvailableSpace();
@@ -436,6 +615,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyToMemo
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents) {
+    auto appendLock = this->obtainAppendOwnership();
+    if (!this->takeCounterBasedSignalEvent(hSignalEvent)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendImageCopyToMemory(dstPtr, hSrcImage, pSrcRegion, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
 
     if (this->isFlushTaskSubmissionEnabled) {
         checkAvailableSpace();
@@ -452,6 +638,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryRangesBar
                                                                                      ze_event_handle_t hSignalEvent,
                                                                                      uint32_t numWaitEvents,
                                                                                      ze_event_handle_t *phWaitEvents) {
+    auto appendLock = this->obtainAppendOwnership();
+    if (!this->takeCounterBasedSignalEvent(hSignalEvent)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (this->graphCaptureTarget) {
+        return this->graphCaptureTarget->appendMemoryRangesBarrier(numRanges, pRangeSizes, pRanges, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
     if (this->isFlushTaskSubmissionEnabled) {
         checkAvailableSpace();
     }
@@ -459,6 +652,62 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendMemoryRangesBar
     return flushImmediate(ret, true);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+CommandListCoreFamilyImmediate<gfxCoreFamily>::~CommandListCoreFamilyImmediate() {
+    if (this->graphCaptureTarget) {
+        this->graphCaptureTarget->destroy();
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::beginGraphCapture() {
+    if (this->graphCaptureTarget) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    ze_result_t returnValue = ZE_RESULT_SUCCESS;
+    this->graphCaptureTarget = CommandList::create(this->device->getHwInfo().platform.eProductFamily, this->device,
+                                                   this->engineGroupType, this->flags, returnValue);
+    return returnValue;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::endGraphCapture(ze_command_list_handle_t *phGraph) {
+    if (this->graphCaptureTarget == nullptr || phGraph == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto graph = this->graphCaptureTarget;
+    this->graphCaptureTarget = nullptr;
+
+    auto ret = graph->close();
+    if (ret != ZE_RESULT_SUCCESS) {
+        graph->destroy();
+        return ret;
+    }
+    *phGraph = graph->toHandle();
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendGraph(ze_command_list_handle_t hGraph) {
+    auto appendLock = this->obtainAppendOwnership();
+    if (this->graphCaptureTarget) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto graph = CommandList::fromHandle(hGraph);
+    if (graph == nullptr || graph->cmdListType != CommandList::CommandListType::TYPE_REGULAR ||
+        graph->isCopyOnly() != this->isCopyOnly()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto ret = this->cmdQImmediate->executeCommandLists(1, &hGraph, nullptr, true);
+    if (ret == ZE_RESULT_SUCCESS && this->isSyncModeQueue) {
+        ret = this->cmdQImmediate->synchronize(std::numeric_limits<uint64_t>::max());
+    }
+    return ret;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_result_t inputRet, bool performMigration) {
     if (inputRet == ZE_RESULT_SUCCESS) {
@@ -468,9 +717,34 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_res
             inputRet = executeCommandListImmediate(performMigration);
         }
     }
+    if (inputRet == ZE_RESULT_SUCCESS) {
+        signalCounterBasedEvent();
+    }
+    this->counterBasedSignalEvent = nullptr;
     return inputRet;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::takeCounterBasedSignalEvent(ze_event_handle_t &hSignalEvent) {
+    if (hSignalEvent == nullptr || !Event::fromHandle(hSignalEvent)->isCounterBased()) {
+        return true;
+    }
+    if (this->graphCaptureTarget) {
+        return false;
+    }
+    this->counterBasedSignalEvent = static_cast<CounterBasedEvent *>(Event::fromHandle(hSignalEvent));
+    hSignalEvent = nullptr;
+    return true;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::signalCounterBasedEvent() {
+    if (this->counterBasedSignalEvent) {
+        this->counterBasedSignalEvent->assignTaskCount(this->csr, this->csr->peekTaskCount());
+        this->counterBasedSignalEvent = nullptr;
+    }
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 bool CommandListCoreFamilyImmediate<gfxCoreFamily>::preferCopyThroughLockedPtr(NEO::SvmAllocationData *dstAlloc, bool dstFound, NEO::SvmAllocationData *srcAlloc, bool srcFound, size_t size) {
     size_t h2DThreshold = 2 * MemoryConstants::megaByte;
@@ -498,7 +772,9 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuMemcpy(void
 
     bool needsBarrier = (numWaitEvents > 0);
     if (needsBarrier) {
+        auto counterBasedEvent = std::exchange(this->counterBasedSignalEvent, nullptr);
         this->appendBarrier(nullptr, numWaitEvents, phWaitEvents);
+        this->counterBasedSignalEvent = counterBasedEvent;
     }
 
     if (this->barrierCalled) {
@@ -533,15 +809,54 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuMemcpy(void
         signalEvent->setGpuStartTimestamp();
     }
 
-    memcpy_s(cpuMemcpyDstPtr, size, cpuMemcpySrcPtr, size);
+    copyThroughLockedPtr(cpuMemcpyDstPtr, cpuMemcpySrcPtr, size, isDstDeviceMemory);
 
     if (signalEvent) {
         signalEvent->setGpuEndTimestamp();
         signalEvent->hostSignal();
     }
+    signalCounterBasedEvent();
     return ZE_RESULT_SUCCESS;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::copyThroughLockedPtr(void *dstptr, const void *srcptr, size_t size, bool isDstDeviceMemory) {
+    // locked device memory is write-combined, streaming stores avoid partial writes over BAR
+    bool useNonTemporalStores = isDstDeviceMemory && NEO::DebugManager.flags.ExperimentalCpuCopyNonTemporalStores.get() != 0;
+    auto copyFunction = [useNonTemporalStores](void *dst, const void *src, size_t partSize) {
+        if (useNonTemporalStores) {
+            NEO::CpuIntrinsics::nonTemporalCopy(dst, src, partSize);
+        } else {
+            memcpy_s(dst, partSize, src, partSize);
+        }
+    };
+
+    constexpr size_t minSizePerThread = 64 * MemoryConstants::kiloByte;
+    size_t threadsCount = 1u;
+    if (NEO::DebugManager.flags.ExperimentalCpuCopyThreads.get() > 1) {
+        threadsCount = std::min(static_cast<size_t>(NEO::DebugManager.flags.ExperimentalCpuCopyThreads.get()), std::max(size / minSizePerThread, size_t{1}));
+    }
+
+    if (threadsCount > 1) {
+        auto partSize = alignUp(size / threadsCount, MemoryConstants::cacheLineSize);
+        std::vector<std::thread> workers;
+        size_t offset = 0u;
+        for (size_t i = 0; i + 1 < threadsCount && offset + partSize < size; i++, offset += partSize) {
+            workers.emplace_back(copyFunction, ptrOffset(dstptr, offset), ptrOffset(srcptr, offset), partSize);
+        }
+        copyFunction(ptrOffset(dstptr, offset), ptrOffset(srcptr, offset), size - offset);
+        for (auto &worker : workers) {
+            worker.join();
+        }
+    } else {
+        copyFunction(dstptr, srcptr, size);
+    }
+
+    if (useNonTemporalStores) {
+        NEO::CpuIntrinsics::sfence();
+    }
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 void *CommandListCoreFamilyImmediate<gfxCoreFamily>::obtainLockedPtrFromDevice(void *ptr, size_t size) {
     NEO::SvmAllocationData *allocData = nullptr;
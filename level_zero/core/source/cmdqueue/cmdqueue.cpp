@@ -19,6 +19,7 @@
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
+#include "level_zero/core/source/fence/fence.h"
 #include "level_zero/core/source/hw_helpers/l0_hw_helper.h"
 #include "level_zero/core/source/kernel/kernel.h"
 
@@ -44,9 +45,41 @@ CommandQueueImp::CommandQueueImp(Device *device, NEO::CommandStreamReceiver *csr
         useKmdWaitFunction = !!(overrideUseKmdWaitFunction);
     }
 
+    submissionAggregationWindowUs = NEO::DebugManager.flags.CommandQueueSubmissionAggregationWindow.get();
+
+    if (NEO::DebugManager.flags.FencePoolSize.get() > 0) {
+        maxPooledFences = static_cast<size_t>(NEO::DebugManager.flags.FencePoolSize.get());
+    }
+
     frontEndStateTracking = L0HwHelper::enableFrontEndStateTracking();
     pipelineSelectStateTracking = L0HwHelper::enablePipelineSelectStateTracking();
     stateComputeModeTracking = L0HwHelper::enableStateComputeModeTracking();
+    stateBaseAddressTracking = L0HwHelper::enableStateBaseAddressTracking();
+}
+
+CommandQueueImp::~CommandQueueImp() {
+    for (auto fence : fencePool) {
+        delete fence;
+    }
+}
+
+Fence *CommandQueueImp::obtainFenceFromPool() {
+    std::lock_guard<std::mutex> lock(fencePoolMutex);
+    if (fencePool.empty()) {
+        return nullptr;
+    }
+    auto fence = fencePool.back();
+    fencePool.pop_back();
+    return fence;
+}
+
+bool CommandQueueImp::returnFenceToPool(Fence *fence) {
+    std::lock_guard<std::mutex> lock(fencePoolMutex);
+    if (fencePool.size() >= maxPooledFences) {
+        return false;
+    }
+    fencePool.push_back(fence);
+    return true;
 }
 
 ze_result_t CommandQueueImp::destroy() {
@@ -204,6 +237,12 @@ ze_command_queue_mode_t CommandQueueImp::getSynchronousMode() const {
     return desc.mode;
 }
 
+bool CommandQueueImp::isSubmissionAggregationEnabled() const {
+    return submissionAggregationWindowUs >= 0 &&
+           !internalUsage &&
+           getSynchronousMode() != ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS;
+}
+
 ze_result_t CommandQueueImp::CommandBufferManager::initialize(Device *device, size_t sizeRequested) {
     size_t alignedSize = alignUp<size_t>(sizeRequested, MemoryConstants::pageSize64k);
     NEO::AllocationProperties properties{device->getRootDeviceIndex(), true, alignedSize,
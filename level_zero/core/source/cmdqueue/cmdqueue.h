@@ -70,6 +70,7 @@ struct CommandQueue : _ze_command_queue_handle_t {
     bool frontEndStateTracking = false;
     bool pipelineSelectStateTracking = false;
     bool stateComputeModeTracking = false;
+    bool stateBaseAddressTracking = false;
 };
 
 using CommandQueueAllocatorFn = CommandQueue *(*)(Device *device, NEO::CommandStreamReceiver *csr,
@@ -99,6 +99,14 @@ struct CommandQueueHw : public CommandQueueImp {
         bool hasIndirectAccess{};
     };
 
+    ze_result_t executeCommandListsImpl(uint32_t numCommandLists,
+                                        ze_command_list_handle_t *phCommandLists,
+                                        ze_fence_handle_t hFence, bool performMigration);
+    ze_result_t executeCommandListsAggregated(uint32_t numCommandLists,
+                                              ze_command_list_handle_t *phCommandLists,
+                                              ze_fence_handle_t hFence, bool performMigration);
+    void submitAggregatedSubmissions(std::vector<AggregatedSubmission *> &submissions);
+    bool isSubmissionAggregatable(const AggregatedSubmission &submission, bool &containsCooperativeKernels);
     ze_result_t validateCommandListsParams(CommandListExecutionContext &ctx,
                                            ze_command_list_handle_t *phCommandLists,
                                            uint32_t numCommandLists);
@@ -136,6 +144,17 @@ struct CommandQueueHw : public CommandQueueImp {
     inline void programStateBaseAddressWithGsbaIfDirty(CommandListExecutionContext &ctx,
                                                        ze_command_list_handle_t hCommandList,
                                                        NEO::LinearStream &commandStream);
+    inline void setStateBaseAddressProperties(CommandListExecutionContext &ctx,
+                                              CommandList *commandList,
+                                              NEO::StreamProperties &streamProperties);
+    inline size_t estimateStateBaseAddressCmdSizeForMultipleCommandLists(CommandListExecutionContext &ctx,
+                                                                         CommandList *commandList,
+                                                                         NEO::StreamProperties &csrStateCopy,
+                                                                         bool &gsbaStateDirty);
+    inline void programOneCmdListStateBaseAddressIfDirty(CommandListExecutionContext &ctx,
+                                                         CommandList *commandList,
+                                                         NEO::LinearStream &commandStream,
+                                                         NEO::StreamProperties &csrState);
     inline void programCsrBaseAddressIfPreemptionModeInitial(bool isPreemptionModeInitial, NEO::LinearStream &commandStream);
     inline void programStateSip(bool isStateSipRequired, NEO::LinearStream &commandStream);
     inline void updateOneCmdListPreemptionModeAndCtxStatePreemption(CommandListExecutionContext &ctx,
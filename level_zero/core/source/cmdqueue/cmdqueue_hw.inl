@@ -20,12 +20,15 @@
 #include "shared/source/command_stream/wait_status.h"
 #include "shared/source/debugger/debugger_l0.h"
 #include "shared/source/device/device.h"
+#include "shared/source/helpers/api_specific_config.h"
+#include "shared/source/helpers/bindless_heaps_helper.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/logical_state_helper.h"
 #include "shared/source/helpers/pause_on_gpu_properties.h"
 #include "shared/source/helpers/pipe_control_args.h"
 #include "shared/source/helpers/preamble.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/prefetch_manager.h"
@@ -35,6 +38,7 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 #include "shared/source/unified_memory/unified_memory.h"
 #include "shared/source/utilities/software_tags_manager.h"
+#include "shared/source/utilities/trace_points.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist.h"
 #include "level_zero/core/source/cmdlist/cmdlist_hw.h"
@@ -45,6 +49,7 @@
 #include "level_zero/tools/source/metrics/metric.h"
 
 #include <algorithm>
+#include <chrono>
 #include <limits>
 #include <thread>
 
@@ -76,6 +81,129 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
     ze_command_list_handle_t *phCommandLists,
     ze_fence_handle_t hFence,
     bool performMigration) {
+    TRACE_POINT(ExecuteCommandLists, numCommandLists, this->csr->peekTaskCount());
+
+    if (this->isSubmissionAggregationEnabled()) {
+        return this->executeCommandListsAggregated(numCommandLists, phCommandLists, hFence, performMigration);
+    }
+    return this->executeCommandListsImpl(numCommandLists, phCommandLists, hFence, performMigration);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsAggregated(
+    uint32_t numCommandLists,
+    ze_command_list_handle_t *phCommandLists,
+    ze_fence_handle_t hFence,
+    bool performMigration) {
+
+    AggregatedSubmission submission{{phCommandLists, phCommandLists + numCommandLists}, hFence, performMigration};
+
+    std::unique_lock<std::mutex> lock(this->submissionAggregationMutex);
+    this->pendingSubmissions.push_back(&submission);
+
+    // one caller at a time submits everything queued so far, the remaining callers wait for their results
+    this->submissionAggregationCondition.wait(lock, [&] { return submission.completed || !this->submissionAggregationLeaderActive; });
+    if (submission.completed) {
+        return submission.result;
+    }
+    this->submissionAggregationLeaderActive = true;
+
+    if (this->submissionAggregationWindowUs > 0) {
+        lock.unlock();
+        std::this_thread::sleep_for(std::chrono::microseconds(this->submissionAggregationWindowUs));
+        lock.lock();
+    }
+
+    std::vector<AggregatedSubmission *> submissions;
+    submissions.swap(this->pendingSubmissions);
+    lock.unlock();
+
+    this->submitAggregatedSubmissions(submissions);
+
+    lock.lock();
+    for (auto pendingSubmission : submissions) {
+        pendingSubmission->completed = true;
+    }
+    this->submissionAggregationLeaderActive = false;
+    lock.unlock();
+    this->submissionAggregationCondition.notify_all();
+
+    return submission.result;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandQueueHw<gfxCoreFamily>::isSubmissionAggregatable(const AggregatedSubmission &submission, bool &containsCooperativeKernels) {
+    bool anyCooperative = false;
+    bool anyRegular = false;
+    for (auto hCommandList : submission.commandLists) {
+        auto commandList = CommandList::fromHandle(hCommandList);
+        if (this->peekIsCopyOnlyCommandQueue() != commandList->isCopyOnly() ||
+            this->activeSubDevices < commandList->partitionCount) {
+            return false;
+        }
+        if (commandList->containsCooperativeKernels()) {
+            anyCooperative = true;
+        } else {
+            anyRegular = true;
+        }
+    }
+    containsCooperativeKernels = anyCooperative;
+    return !(anyCooperative && anyRegular);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandQueueHw<gfxCoreFamily>::submitAggregatedSubmissions(std::vector<AggregatedSubmission *> &submissions) {
+    size_t groupStart = 0;
+    while (groupStart < submissions.size()) {
+        auto &first = *submissions[groupStart];
+        bool groupCooperative = false;
+        size_t groupEnd = groupStart + 1;
+
+        if (isSubmissionAggregatable(first, groupCooperative)) {
+            bool cooperative = false;
+            while (groupEnd < submissions.size() &&
+                   isSubmissionAggregatable(*submissions[groupEnd], cooperative) &&
+                   cooperative == groupCooperative) {
+                groupEnd++;
+            }
+        }
+
+        if (groupEnd - groupStart == 1) {
+            first.result = this->executeCommandListsImpl(static_cast<uint32_t>(first.commandLists.size()), first.commandLists.data(),
+                                                         first.hFence, first.performMigration);
+        } else {
+            std::vector<ze_command_list_handle_t> commandLists;
+            ze_fence_handle_t hFence = nullptr;
+            bool performMigration = false;
+            for (auto i = groupStart; i < groupEnd; i++) {
+                auto &submission = *submissions[i];
+                commandLists.insert(commandLists.end(), submission.commandLists.begin(), submission.commandLists.end());
+                performMigration |= submission.performMigration;
+                if (submission.hFence) {
+                    if (hFence) {
+                        this->aggregatedFences.push_back(submission.hFence);
+                    } else {
+                        hFence = submission.hFence;
+                    }
+                }
+            }
+
+            auto ret = this->executeCommandListsImpl(static_cast<uint32_t>(commandLists.size()), commandLists.data(), hFence, performMigration);
+            this->aggregatedFences.clear();
+            for (auto i = groupStart; i < groupEnd; i++) {
+                submissions[i]->result = ret;
+            }
+        }
+        groupStart = groupEnd;
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsImpl(
+    uint32_t numCommandLists,
+    ze_command_list_handle_t *phCommandLists,
+    ze_fence_handle_t hFence,
+    bool performMigration) {
 
     auto lockCSR = this->csr->obtainUniqueOwnership();
 
@@ -186,6 +314,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandListsRegular(
         this->programOneCmdListPipelineSelect(commandList, child, csrStateProperties, requiredStreamState, finalStreamState);
         this->programOneCmdListFrontEndIfDirty(ctx, child, csrStateProperties, requiredStreamState, finalStreamState);
         this->programRequiredStateComputeModeForCommandList(commandList, child, csrStateProperties, requiredStreamState, finalStreamState);
+        this->programOneCmdListStateBaseAddressIfDirty(ctx, commandList, child, csrStateProperties);
 
         this->patchCommands(*commandList, this->csr->getScratchSpaceController()->getScratchPatchAddress());
         this->programOneCmdListBatchBufferStart(commandList, child, ctx);
@@ -673,7 +802,14 @@ size_t CommandQueueHw<gfxCoreFamily>::estimateLinearStreamSizeComplementary(
         }
     }
 
-    if (ctx.gsbaStateDirty) {
+    if (this->stateBaseAddressTracking) {
+        auto streamPropertiesCopy = csr->getStreamProperties();
+        bool gsbaStateDirtyCopy = csr->getGSBAStateDirty();
+        for (uint32_t i = 0; i < numCommandLists; i++) {
+            auto cmdList = CommandList::fromHandle(phCommandLists[i]);
+            linearStreamSizeEstimate += estimateStateBaseAddressCmdSizeForMultipleCommandLists(ctx, cmdList, streamPropertiesCopy, gsbaStateDirtyCopy);
+        }
+    } else if (ctx.gsbaStateDirty) {
         linearStreamSizeEstimate += estimateStateBaseAddressCmdSize();
     }
 
@@ -752,6 +888,12 @@ void CommandQueueHw<gfxCoreFamily>::programStateBaseAddressWithGsbaIfDirty(
     ze_command_list_handle_t hCommandList,
     NEO::LinearStream &cmdStream) {
 
+    if (this->stateBaseAddressTracking) {
+        // 1st command list state is programmed here to preserve dispatch order of hw commands,
+        // main loop programs state base address again only for command lists requiring different state
+        this->programOneCmdListStateBaseAddressIfDirty(ctx, CommandList::fromHandle(hCommandList), cmdStream, csr->getStreamProperties());
+        return;
+    }
     if (!ctx.gsbaStateDirty) {
         return;
     }
@@ -763,6 +905,67 @@ void CommandQueueHw<gfxCoreFamily>::programStateBaseAddressWithGsbaIfDirty(
                             ctx.cachedMOCSAllowed);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandQueueHw<gfxCoreFamily>::setStateBaseAddressProperties(
+    CommandListExecutionContext &ctx,
+    CommandList *commandList,
+    NEO::StreamProperties &streamProperties) {
+
+    NEO::Device *neoDevice = this->device->getNEODevice();
+    int64_t indirectObjectBaseAddress = -1;
+    int64_t bindingTablePoolBaseAddress = -1;
+    int32_t statelessMocs = -1;
+
+    // without global heaps command lists program their own indirect object heap and stateless mocs,
+    // queue owns only general state there
+    if (NEO::ApiSpecificConfig::getBindlessConfiguration()) {
+        auto indirectHeap = commandList->commandContainer.getIndirectHeap(NEO::HeapType::INDIRECT_OBJECT);
+        bool useLocalMemoryForIndirectHeap = indirectHeap->getGraphicsAllocation()->isAllocatedInLocalMemoryPool();
+        indirectObjectBaseAddress = static_cast<int64_t>(neoDevice->getMemoryManager()->getInternalHeapBaseAddress(this->device->getRootDeviceIndex(), useLocalMemoryForIndirectHeap));
+        bindingTablePoolBaseAddress = static_cast<int64_t>(neoDevice->getBindlessHeapsHelper()->getHeap(NEO::BindlessHeapsHelper::GLOBAL_SSH)->getHeapGpuBase());
+        statelessMocs = static_cast<int32_t>(this->device->getMOCS(ctx.cachedMOCSAllowed, false) >> 1);
+    }
+    auto generalStateBaseAddress = static_cast<int64_t>(this->csr->getScratchSpaceController()->calculateNewGSH());
+
+    streamProperties.stateBaseAddress.setProperties(generalStateBaseAddress, indirectObjectBaseAddress, bindingTablePoolBaseAddress, statelessMocs);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+size_t CommandQueueHw<gfxCoreFamily>::estimateStateBaseAddressCmdSizeForMultipleCommandLists(
+    CommandListExecutionContext &ctx,
+    CommandList *commandList,
+    NEO::StreamProperties &csrStateCopy,
+    bool &gsbaStateDirty) {
+
+    this->setStateBaseAddressProperties(ctx, commandList, csrStateCopy);
+    if (!gsbaStateDirty && !csrStateCopy.stateBaseAddress.isDirty()) {
+        return 0;
+    }
+    gsbaStateDirty = false;
+    return estimateStateBaseAddressCmdSize();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandQueueHw<gfxCoreFamily>::programOneCmdListStateBaseAddressIfDirty(
+    CommandListExecutionContext &ctx,
+    CommandList *commandList,
+    NEO::LinearStream &cmdStream,
+    NEO::StreamProperties &csrState) {
+
+    if (!this->stateBaseAddressTracking) {
+        return;
+    }
+    this->setStateBaseAddressProperties(ctx, commandList, csrState);
+    if (!this->csr->getGSBAStateDirty() && !csrState.stateBaseAddress.isDirty()) {
+        return;
+    }
+    auto indirectHeap = commandList->commandContainer.getIndirectHeap(NEO::HeapType::INDIRECT_OBJECT);
+    programStateBaseAddress(static_cast<uint64_t>(csrState.stateBaseAddress.generalStateBaseAddress.value),
+                            indirectHeap->getGraphicsAllocation()->isAllocatedInLocalMemoryPool(),
+                            cmdStream,
+                            ctx.cachedMOCSAllowed);
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandQueueHw<gfxCoreFamily>::programCsrBaseAddressIfPreemptionModeInitial(bool isPreemptionModeInitial, NEO::LinearStream &cmdStream) {
     if (!isPreemptionModeInitial) {
@@ -889,6 +1092,17 @@ void CommandQueueHw<gfxCoreFamily>::programOneCmdListBatchBufferStart(CommandLis
     uint32_t returnPointsSize = commandList->getReturnPointsSize();
     uint32_t returnPointIdx = 0;
 
+    // chain of closed regular command list stays the same until the list is reset or closed again
+    bool cacheBatchBufferStarts = NEO::DebugManager.flags.CacheCommandListBatchBufferStarts.get() == 1 &&
+                                  !isCommandListImmediate && returnPointsSize == 0;
+    auto &cachedBatchBufferStarts = commandList->getCachedBatchBufferStarts();
+    if (cacheBatchBufferStarts && !cachedBatchBufferStarts.empty()) {
+        memcpy_s(cmdStream.getSpace(cachedBatchBufferStarts.size()), cachedBatchBufferStarts.size(),
+                 cachedBatchBufferStarts.data(), cachedBatchBufferStarts.size());
+        return;
+    }
+    auto chainStartOffset = cmdStream.getUsed();
+
     for (size_t iter = 0; iter < cmdBufferCount; iter++) {
         auto allocation = cmdBufferAllocations[iter];
         uint64_t startOffset = allocation->getGpuAddress();
@@ -919,6 +1133,11 @@ void CommandQueueHw<gfxCoreFamily>::programOneCmdListBatchBufferStart(CommandLis
             }
         }
     }
+
+    if (cacheBatchBufferStarts) {
+        auto chainStart = ptrOffset(reinterpret_cast<uint8_t *>(cmdStream.getCpuBase()), chainStartOffset);
+        cachedBatchBufferStarts.assign(chainStart, chainStart + (cmdStream.getUsed() - chainStartOffset));
+    }
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -969,6 +1188,9 @@ void CommandQueueHw<gfxCoreFamily>::assignCsrTaskCountToFenceIfAvailable(ze_fenc
     if (hFence) {
         Fence::fromHandle(hFence)->assignTaskCountFromCsr();
     }
+    for (auto hAggregatedFence : this->aggregatedFences) {
+        Fence::fromHandle(hAggregatedFence)->assignTaskCountFromCsr();
+    }
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
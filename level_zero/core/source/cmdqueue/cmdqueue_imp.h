@@ -15,6 +15,8 @@
 
 #include "level_zero/core/source/cmdqueue/cmdqueue.h"
 
+#include <condition_variable>
+#include <mutex>
 #include <vector>
 
 struct UnifiedMemoryControls;
@@ -28,6 +30,7 @@ class MemoryManager;
 
 namespace L0 {
 struct CommandList;
+struct Fence;
 struct Kernel;
 struct CommandQueueImp : public CommandQueue {
     class CommandBufferManager {
@@ -58,6 +61,14 @@ struct CommandQueueImp : public CommandQueue {
         std::pair<uint32_t, NEO::FlushStamp> flushId[BUFFER_ALLOCATION::COUNT];
         BUFFER_ALLOCATION bufferUse = BUFFER_ALLOCATION::FIRST;
     };
+    struct AggregatedSubmission {
+        std::vector<ze_command_list_handle_t> commandLists;
+        ze_fence_handle_t hFence = nullptr;
+        bool performMigration = false;
+        bool completed = false;
+        ze_result_t result = ZE_RESULT_SUCCESS;
+    };
+
     static constexpr size_t defaultQueueCmdBufferSize = 128 * MemoryConstants::kiloByte;
     static constexpr size_t minCmdBufferPtrAlign = 8;
     static constexpr size_t totalCmdBufferSize =
@@ -67,6 +78,7 @@ struct CommandQueueImp : public CommandQueue {
 
     CommandQueueImp() = delete;
     CommandQueueImp(Device *device, NEO::CommandStreamReceiver *csr, const ze_command_queue_desc_t *desc);
+    ~CommandQueueImp() override;
 
     ze_result_t destroy() override;
 
@@ -84,6 +96,10 @@ struct CommandQueueImp : public CommandQueue {
     ze_command_queue_mode_t getSynchronousMode() const;
     virtual bool getPreemptionCmdProgramming() = 0;
     void handleIndirectAllocationResidency(UnifiedMemoryControls unifiedMemoryControls, std::unique_lock<std::mutex> &lockForIndirect) override;
+    bool isSubmissionAggregationEnabled() const;
+
+    Fence *obtainFenceFromPool();
+    bool returnFenceToPool(Fence *fence);
 
   protected:
     MOCKABLE_VIRTUAL NEO::SubmissionStatus submitBatchBuffer(size_t offset, NEO::ResidencyContainer &residencyContainer, void *endingCmdPtr,
@@ -106,6 +122,17 @@ struct CommandQueueImp : public CommandQueue {
 
     std::atomic<uint32_t> taskCount{0};
 
+    std::mutex submissionAggregationMutex;
+    std::condition_variable submissionAggregationCondition;
+    std::vector<AggregatedSubmission *> pendingSubmissions;
+    std::vector<ze_fence_handle_t> aggregatedFences;
+    int32_t submissionAggregationWindowUs = -1;
+    bool submissionAggregationLeaderActive = false;
+
+    std::mutex fencePoolMutex;
+    std::vector<Fence *> fencePool;
+    size_t maxPooledFences = 0u;
+
     bool useKmdWaitFunction = false;
 };
 
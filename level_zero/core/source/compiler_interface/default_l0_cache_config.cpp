@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,14 @@ NEO::CompilerCacheConfig getDefaultL0CompilerCacheConfig() {
     std::unique_ptr<NEO::SettingsReader> settingsReader(NEO::SettingsReader::createOsReader(false, keyName));
     ret.cacheDir = settingsReader->getSetting(settingsReader->appSpecificLocation(keyName), static_cast<std::string>(L0_CACHE_LOCATION));
 
+    std::string sizeKeyName = registryPath;
+    sizeKeyName += "l0_c_cache_max_size";
+    ret.cacheSize = static_cast<size_t>(settingsReader->getSetting(settingsReader->appSpecificLocation(sizeKeyName), static_cast<int64_t>(0)));
+
+    std::string readOnlyDirKeyName = registryPath;
+    readOnlyDirKeyName += "l0_c_cache_readonly_dir";
+    ret.readOnlyCacheDir = settingsReader->getSetting(settingsReader->appSpecificLocation(readOnlyDirKeyName), std::string(""));
+
     ret.cacheFileExtension = ".l0_c_cache";
 
     return ret;
@@ -8,6 +8,8 @@
 #include "level_zero/core/source/context/context_imp.h"
 
 #include "shared/source/command_container/implicit_scaling.h"
+#include "shared/source/gmm_helper/gmm_helper.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 
@@ -314,8 +316,11 @@ ze_result_t ContextImp::freeMem(const void *ptr, bool blocking) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
+    this->eraseCachedIpcHandle(ptr);
+
     for (auto pairDevice : this->devices) {
         this->freePeerAllocations(ptr, blocking, Device::fromHandle(pairDevice.second));
+        static_cast<DeviceImp *>(Device::fromHandle(pairDevice.second))->memAdviseSharedAllocations.erase(allocation);
     }
 
     this->driverHandle->svmAllocsManager->freeSVMAlloc(const_cast<void *>(ptr), blocking);
@@ -424,9 +429,56 @@ ze_result_t ContextImp::getMemAddressRange(const void *ptr,
 }
 
 ze_result_t ContextImp::closeIpcMemHandle(const void *ptr) {
+    if (this->releaseCachedIpcHandle(ptr)) {
+        return ZE_RESULT_SUCCESS;
+    }
     return this->freeMem(ptr);
 }
 
+// Imported IPC handles are reference counted per context, opening the same handles again
+// returns the already imported allocation without prime import and GPU VA allocation.
+void *ContextImp::openCachedIpcHandle(const IpcHandleKey &key) {
+    std::lock_guard<std::mutex> lock(this->ipcHandlesMutex);
+    auto openedHandle = this->openedIpcHandles.find(key);
+    if (openedHandle == this->openedIpcHandles.end()) {
+        return nullptr;
+    }
+    openedHandle->second.refCount++;
+    return openedHandle->second.ptr;
+}
+
+void ContextImp::cacheOpenedIpcHandle(IpcHandleKey &&key, void *ptr) {
+    std::lock_guard<std::mutex> lock(this->ipcHandlesMutex);
+    auto openedHandle = this->openedIpcHandles.find(key);
+    if (openedHandle != this->openedIpcHandles.end()) {
+        openedHandle->second.refCount++;
+        return;
+    }
+    this->openedIpcHandleKeys[ptr] = key;
+    this->openedIpcHandles[std::move(key)] = {ptr, 1u};
+}
+
+// Returns true if the handle is still referenced and its allocation must be kept
+bool ContextImp::releaseCachedIpcHandle(const void *ptr) {
+    std::lock_guard<std::mutex> lock(this->ipcHandlesMutex);
+    auto openedHandleKey = this->openedIpcHandleKeys.find(ptr);
+    if (openedHandleKey == this->openedIpcHandleKeys.end()) {
+        return false;
+    }
+    auto &openedHandle = this->openedIpcHandles[openedHandleKey->second];
+    return --openedHandle.refCount > 0u;
+}
+
+void ContextImp::eraseCachedIpcHandle(const void *ptr) {
+    std::lock_guard<std::mutex> lock(this->ipcHandlesMutex);
+    auto openedHandleKey = this->openedIpcHandleKeys.find(ptr);
+    if (openedHandleKey == this->openedIpcHandleKeys.end()) {
+        return;
+    }
+    this->openedIpcHandles.erase(openedHandleKey->second);
+    this->openedIpcHandleKeys.erase(openedHandleKey);
+}
+
 ze_result_t ContextImp::getIpcMemHandle(const void *ptr,
                                         ze_ipc_mem_handle_t *pIpcHandle) {
     NEO::SvmAllocationData *allocData = this->driverHandle->svmAllocsManager->getSVMAlloc(ptr);
@@ -482,11 +534,18 @@ ze_result_t ContextImp::openIpcMemHandle(ze_device_handle_t hDevice,
              reinterpret_cast<void *>(pIpcHandle.data),
              sizeof(handle));
 
+    IpcHandleKey key{Device::fromHandle(hDevice)->getRootDeviceIndex(), flags, {handle}};
+    *ptr = this->openCachedIpcHandle(key);
+    if (*ptr != nullptr) {
+        return ZE_RESULT_SUCCESS;
+    }
+
     *ptr = getMemHandlePtr(hDevice, handle, flags);
     if (nullptr == *ptr) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
+    this->cacheOpenedIpcHandle(std::move(key), *ptr);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -495,7 +554,11 @@ ze_result_t ContextImp::openIpcMemHandles(ze_device_handle_t hDevice,
                                           ze_ipc_mem_handle_t *pIpcHandles,
                                           ze_ipc_memory_flags_t flags,
                                           void **pptr) {
+    auto neoDevice = Device::fromHandle(hDevice)->getNEODevice()->getRootDevice();
+    IpcHandleKey key{neoDevice->getRootDeviceIndex(), flags, {}};
+    key.handles.reserve(numIpcHandles);
     std::vector<NEO::osHandle> handles;
+    handles.reserve(numIpcHandles);
     for (uint32_t i = 0; i < numIpcHandles; i++) {
         uint64_t handle = 0;
         memcpy_s(&handle,
@@ -503,14 +566,20 @@ ze_result_t ContextImp::openIpcMemHandles(ze_device_handle_t hDevice,
                  reinterpret_cast<void *>(pIpcHandles[i].data),
                  sizeof(handle));
         handles.push_back(static_cast<NEO::osHandle>(handle));
+        key.handles.push_back(handle);
+    }
+
+    *pptr = this->openCachedIpcHandle(key);
+    if (*pptr != nullptr) {
+        return ZE_RESULT_SUCCESS;
     }
-    auto neoDevice = Device::fromHandle(hDevice)->getNEODevice()->getRootDevice();
 
     *pptr = this->driverHandle->importFdHandles(neoDevice, flags, handles, nullptr);
     if (nullptr == *pptr) {
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
+    this->cacheOpenedIpcHandle(std::move(key), *pptr);
     return ZE_RESULT_SUCCESS;
 }
 
@@ -707,15 +776,63 @@ ze_result_t ContextImp::activateMetricGroups(zet_device_handle_t hDevice,
     return L0::Device::fromHandle(hDevice)->activateMetricGroupsDeferred(count, phMetricGroups);
 }
 
+// Virtual memory is reserved once in GfxPartition, physical memory is bound to and unbound from
+// the reservation in place, so growing a buffer neither copies its contents nor reserves address space again.
 ze_result_t ContextImp::reserveVirtualMem(const void *pStart,
                                           size_t size,
                                           void **pptr) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    if (size == 0u || !isAligned<MemoryConstants::pageSize64k>(size)) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_SIZE;
+    }
+
+    auto neoDevice = this->driverHandle->devices[0]->getNEODevice();
+    auto rootDeviceIndex = neoDevice->getRootDeviceIndex();
+    auto memoryManager = this->driverHandle->getMemoryManager();
+    auto addressRange = memoryManager->reserveGpuAddress(size, rootDeviceIndex);
+    if (addressRange.address == 0u) {
+        return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+
+    auto gmmHelper = neoDevice->getGmmHelper();
+    auto ptr = static_cast<uintptr_t>(gmmHelper->decanonize(addressRange.address));
+    {
+        std::lock_guard<std::mutex> lock(this->virtualMemoryMutex);
+        this->virtualMemoryReservations[ptr] = {addressRange.address, addressRange.size, rootDeviceIndex};
+    }
+    *pptr = reinterpret_cast<void *>(ptr);
+    return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t ContextImp::freeVirtualMem(const void *ptr,
                                        size_t size) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    VirtualMemoryReservation reservation;
+    {
+        std::lock_guard<std::mutex> lock(this->virtualMemoryMutex);
+        auto it = this->virtualMemoryReservations.find(reinterpret_cast<uintptr_t>(ptr));
+        if (it == this->virtualMemoryReservations.end() || it->second.size != size) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        auto mapping = this->virtualMemoryMappings.lower_bound(it->first);
+        if (mapping != this->virtualMemoryMappings.end() && mapping->first < it->first + size) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        reservation = it->second;
+        this->virtualMemoryReservations.erase(it);
+    }
+    this->driverHandle->getMemoryManager()->freeGpuAddress({reservation.gpuAddress, reservation.size}, reservation.rootDeviceIndex);
+    return ZE_RESULT_SUCCESS;
+}
+
+ContextImp::VirtualMemoryReservation *ContextImp::findVirtualMemoryReservation(uintptr_t address, size_t size) {
+    auto it = this->virtualMemoryReservations.upper_bound(address);
+    if (it == this->virtualMemoryReservations.begin()) {
+        return nullptr;
+    }
+    --it;
+    if (address + size > it->first + it->second.size) {
+        return nullptr;
+    }
+    return &it->second;
 }
 
 ze_result_t ContextImp::queryVirtualMemPageSize(ze_device_handle_t hDevice,
@@ -728,11 +845,45 @@ ze_result_t ContextImp::queryVirtualMemPageSize(ze_device_handle_t hDevice,
 ze_result_t ContextImp::createPhysicalMem(ze_device_handle_t hDevice,
                                           ze_physical_mem_desc_t *desc,
                                           ze_physical_mem_handle_t *phPhysicalMemory) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    auto device = Device::fromHandle(hDevice);
+    if (isDeviceDefinedForThisContext(device) == false) {
+        return ZE_RESULT_ERROR_DEVICE_LOST;
+    }
+    if (desc->size == 0u || !isAligned<MemoryConstants::pageSize64k>(desc->size)) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_SIZE;
+    }
+
+    auto neoDevice = device->getNEODevice();
+    NEO::AllocationProperties properties{neoDevice->getRootDeviceIndex(), true, desc->size, NEO::AllocationType::BUFFER, false, false, neoDevice->getDeviceBitfield()};
+    properties.flags.isUSMDeviceAllocation = true;
+    auto allocation = this->driverHandle->getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+    if (allocation == nullptr) {
+        return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(this->virtualMemoryMutex);
+        this->physicalMemoryAllocations[allocation] = device;
+    }
+    *phPhysicalMemory = reinterpret_cast<ze_physical_mem_handle_t>(allocation);
+    return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t ContextImp::destroyPhysicalMem(ze_physical_mem_handle_t hPhysicalMemory) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    auto allocation = reinterpret_cast<NEO::GraphicsAllocation *>(hPhysicalMemory);
+    {
+        std::lock_guard<std::mutex> lock(this->virtualMemoryMutex);
+        for (auto &mapping : this->virtualMemoryMappings) {
+            if (mapping.second.physicalAllocation == allocation) {
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+        }
+        if (this->physicalMemoryAllocations.erase(allocation) == 0u) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+    this->driverHandle->getMemoryManager()->freeGraphicsMemory(allocation);
+    return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t ContextImp::mapVirtualMem(const void *ptr,
@@ -740,12 +891,71 @@ ze_result_t ContextImp::mapVirtualMem(const void *ptr,
                                       ze_physical_mem_handle_t hPhysicalMemory,
                                       size_t offset,
                                       ze_memory_access_attribute_t access) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    if (offset != 0u) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    auto address = reinterpret_cast<uintptr_t>(ptr);
+    auto allocation = reinterpret_cast<NEO::GraphicsAllocation *>(hPhysicalMemory);
+    std::lock_guard<std::mutex> lock(this->virtualMemoryMutex);
+    auto physicalMemory = this->physicalMemoryAllocations.find(allocation);
+    if (physicalMemory == this->physicalMemoryAllocations.end()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto reservation = findVirtualMemoryReservation(address, size);
+    if (reservation == nullptr || reservation->rootDeviceIndex != allocation->getRootDeviceIndex()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    auto nextMapping = this->virtualMemoryMappings.lower_bound(address);
+    if (nextMapping != this->virtualMemoryMappings.end() && nextMapping->first < address + size) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (nextMapping != this->virtualMemoryMappings.begin() && std::prev(nextMapping)->first + std::prev(nextMapping)->second.size > address) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    for (auto &mapping : this->virtualMemoryMappings) {
+        if (mapping.second.physicalAllocation == allocation) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    auto neoDevice = physicalMemory->second->getNEODevice();
+    auto memoryManager = this->driverHandle->getMemoryManager();
+    auto physicalGpuAddress = allocation->getGpuAddress();
+    auto gpuAddress = neoDevice->getGmmHelper()->canonize(address);
+    if (!memoryManager->mapPhysicalToVirtualMemory(allocation, gpuAddress, size)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    neoDevice->getRootDeviceEnvironment().memoryOperationsInterface->makeResident(neoDevice, ArrayRef<NEO::GraphicsAllocation *>(&allocation, 1));
+
+    NEO::SvmAllocationData allocData(neoDevice->getRootDeviceIndex());
+    allocData.gpuAllocations.addAllocation(allocation);
+    allocData.cpuAllocation = nullptr;
+    allocData.size = size;
+    allocData.memoryType = InternalMemoryType::DEVICE_UNIFIED_MEMORY;
+    allocData.device = neoDevice;
+    this->driverHandle->svmAllocsManager->insertSVMAlloc(allocData);
+
+    this->virtualMemoryMappings[address] = {allocation, physicalGpuAddress, size};
+    return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t ContextImp::unMapVirtualMem(const void *ptr,
                                         size_t size) {
-    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    std::lock_guard<std::mutex> lock(this->virtualMemoryMutex);
+    auto mapping = this->virtualMemoryMappings.find(reinterpret_cast<uintptr_t>(ptr));
+    if (mapping == this->virtualMemoryMappings.end() || mapping->second.size != size) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto svmData = this->driverHandle->svmAllocsManager->getSVMAlloc(ptr);
+    if (svmData != nullptr) {
+        this->driverHandle->svmAllocsManager->removeSVMAlloc(*svmData);
+    }
+    auto allocation = mapping->second.physicalAllocation;
+    this->driverHandle->getMemoryManager()->mapPhysicalToVirtualMemory(allocation, mapping->second.physicalGpuAddress, size);
+    this->virtualMemoryMappings.erase(mapping);
+    return ZE_RESULT_SUCCESS;
 }
 
 ze_result_t ContextImp::setVirtualMemAccessAttribute(const void *ptr,
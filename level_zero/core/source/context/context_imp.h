@@ -13,6 +13,13 @@
 #include "level_zero/core/source/context/context.h"
 
 #include <map>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+namespace NEO {
+class GraphicsAllocation;
+} // namespace NEO
 
 namespace L0 {
 struct StructuresLookupTable;
@@ -152,8 +159,50 @@ struct ContextImp : Context {
   protected:
     bool isAllocationSuitableForCompression(const StructuresLookupTable &structuresLookupTable, Device &device, size_t allocSize);
 
+    struct VirtualMemoryReservation {
+        uint64_t gpuAddress = 0u;
+        size_t size = 0u;
+        uint32_t rootDeviceIndex = 0u;
+    };
+
+    struct VirtualMemoryMapping {
+        NEO::GraphicsAllocation *physicalAllocation = nullptr;
+        uint64_t physicalGpuAddress = 0u;
+        size_t size = 0u;
+    };
+
+    struct IpcHandleKey {
+        uint32_t rootDeviceIndex = 0u;
+        ze_ipc_memory_flags_t flags = 0u;
+        std::vector<uint64_t> handles;
+
+        bool operator<(const IpcHandleKey &other) const {
+            return std::tie(rootDeviceIndex, flags, handles) < std::tie(other.rootDeviceIndex, other.flags, other.handles);
+        }
+    };
+
+    struct OpenedIpcHandle {
+        void *ptr = nullptr;
+        uint32_t refCount = 0u;
+    };
+
+    VirtualMemoryReservation *findVirtualMemoryReservation(uintptr_t address, size_t size);
+    void *openCachedIpcHandle(const IpcHandleKey &key);
+    void cacheOpenedIpcHandle(IpcHandleKey &&key, void *ptr);
+    bool releaseCachedIpcHandle(const void *ptr);
+    void eraseCachedIpcHandle(const void *ptr);
+
     std::map<uint32_t, ze_device_handle_t> devices;
     DriverHandleImp *driverHandle = nullptr;
+
+    std::map<uintptr_t, VirtualMemoryReservation> virtualMemoryReservations;
+    std::map<uintptr_t, VirtualMemoryMapping> virtualMemoryMappings;
+    std::map<NEO::GraphicsAllocation *, Device *> physicalMemoryAllocations;
+    std::mutex virtualMemoryMutex;
+
+    std::map<IpcHandleKey, OpenedIpcHandle> openedIpcHandles;
+    std::map<const void *, IpcHandleKey> openedIpcHandleKeys;
+    std::mutex ipcHandlesMutex;
 };
 
 } // namespace L0
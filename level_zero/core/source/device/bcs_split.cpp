@@ -8,7 +8,9 @@
 #include "level_zero/core/source/device/bcs_split.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/aligned_memory.h"
 
+#include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
 #include "level_zero/core/source/device/device_imp.h"
 
 namespace L0 {
@@ -54,6 +56,38 @@ bool BcsSplit::setupDevice(uint32_t productFamily, bool internalUsage, const ze_
     return true;
 }
 
+void BcsSplit::distributeSize(size_t size, StackVec<size_t, 4> &chunkSizes) {
+    const auto engineCount = this->cmdQs.size();
+    chunkSizes.resize(engineCount);
+
+    if (NEO::DebugManager.flags.SplitBcsLoadBalancing.get() != 1) {
+        auto remainingSize = size;
+        for (size_t i = 0; i < engineCount; i++) {
+            chunkSizes[i] = remainingSize / (engineCount - i);
+            remainingSize -= chunkSizes[i];
+        }
+        return;
+    }
+
+    // weight each engine by the inverse of the work still pending on it
+    StackVec<double, 4> weights;
+    double weightSum = 0.0;
+    for (auto cmdQ : this->cmdQs) {
+        auto csr = static_cast<CommandQueueImp *>(cmdQ)->getCsr();
+        auto pendingTaskCount = csr->peekTaskCount() - std::min(csr->peekTaskCount(), *csr->getTagAddress());
+        weights.push_back(1.0 / (1.0 + pendingTaskCount));
+        weightSum += weights.back();
+    }
+
+    auto remainingSize = size;
+    for (size_t i = 0; i + 1 < engineCount; i++) {
+        auto chunkSize = alignDown(static_cast<size_t>(size * weights[i] / weightSum), MemoryConstants::cacheLineSize);
+        chunkSizes[i] = std::min(chunkSize, remainingSize);
+        remainingSize -= chunkSizes[i];
+    }
+    chunkSizes[engineCount - 1] = remainingSize;
+}
+
 void BcsSplit::releaseResources() {
     std::lock_guard<std::mutex> lock(this->mtx);
     this->clientCount--;
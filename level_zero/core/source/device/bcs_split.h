@@ -70,23 +70,27 @@ struct BcsSplit {
         auto subcopyEventIndex = markerEventIndex * this->cmdQs.size();
         StackVec<ze_event_handle_t, 4> eventHandles;
 
-        auto totalSize = size;
-        auto engineCount = this->cmdQs.size();
+        StackVec<size_t, 4> chunkSizes;
+        this->distributeSize(size, chunkSizes);
+
+        size_t offset = 0u;
         for (size_t i = 0; i < this->cmdQs.size(); i++) {
-            auto localSize = totalSize / engineCount;
-            auto localDstPtr = ptrOffset(dstptr, size - totalSize);
-            auto localSrcPtr = ptrOffset(srcptr, size - totalSize);
+            auto localSize = chunkSizes[i];
+            if (localSize == 0u) {
+                continue;
+            }
+            auto localDstPtr = ptrOffset(dstptr, offset);
+            auto localSrcPtr = ptrOffset(srcptr, offset);
 
             auto eventHandle = this->events.subcopy[subcopyEventIndex + i]->toHandle();
             result = appendCall(localDstPtr, localSrcPtr, localSize, eventHandle);
             cmdList->executeCommandListImmediateImpl(true, this->cmdQs[i]);
             eventHandles.push_back(eventHandle);
 
-            totalSize -= localSize;
-            engineCount--;
+            offset += localSize;
         }
 
-        cmdList->addEventsToCmdList(static_cast<uint32_t>(this->cmdQs.size()), eventHandles.data());
+        cmdList->addEventsToCmdList(static_cast<uint32_t>(eventHandles.size()), eventHandles.data());
         cmdList->appendSignalEvent(this->events.marker[markerEventIndex]->toHandle());
 
         if (hSignalEvent) {
@@ -96,6 +100,7 @@ struct BcsSplit {
         return result;
     }
 
+    void distributeSize(size_t size, StackVec<size_t, 4> &chunkSizes);
     bool setupDevice(uint32_t productFamily, bool internalUsage, const ze_command_queue_desc_t *desc, NEO::CommandStreamReceiver *csr);
     void releaseResources();
 
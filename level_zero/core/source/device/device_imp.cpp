@@ -239,9 +239,14 @@ ze_result_t DeviceImp::createCommandQueue(const ze_command_queue_desc_t *desc,
     if (commandQueueDesc.priority == ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_LOW && !isCopyOnly) {
         getCsrForLowPriority(&csr);
     } else {
-        auto ret = getCsrForOrdinalAndIndex(&csr, commandQueueDesc.ordinal, commandQueueDesc.index);
-        if (ret != ZE_RESULT_SUCCESS) {
-            return ret;
+        if (commandQueueDesc.priority == ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_HIGH && !isCopyOnly) {
+            getCsrForHighPriority(&csr);
+        }
+        if (csr == nullptr) {
+            auto ret = getCsrForOrdinalAndIndex(&csr, commandQueueDesc.ordinal, commandQueueDesc.index);
+            if (ret != ZE_RESULT_SUCCESS) {
+                return ret;
+            }
         }
     }
 
@@ -1121,6 +1126,11 @@ void DeviceImp::releaseResources() {
         this->pageFaultCommandList = nullptr;
     }
 
+    // Root device samples reference sub-device queries, collect them first.
+    if (metricContext) {
+        metricContext->releaseKernelSampler();
+    }
+
     for (uint32_t i = 0; i < this->numSubDevices; i++) {
         delete this->subDevices[i];
     }
@@ -1316,6 +1326,19 @@ ze_result_t DeviceImp::getCsrForLowPriority(NEO::CommandStreamReceiver **csr) {
     return ZE_RESULT_ERROR_UNKNOWN;
 }
 
+bool DeviceImp::getCsrForHighPriority(NEO::CommandStreamReceiver **csr) {
+    if (this->implicitScalingCapable) {
+        return false;
+    }
+    for (auto &it : getActiveDevice()->getAllEngines()) {
+        if (it.osContext->isHighPriority()) {
+            *csr = it.commandStreamReceiver;
+            return true;
+        }
+    }
+    return false;
+}
+
 DebugSession *DeviceImp::getDebugSession(const zet_debug_config_t &config) {
     return debugSession.get();
 }
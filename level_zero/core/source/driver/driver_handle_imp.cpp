@@ -12,6 +12,7 @@
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/staging_buffer_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_library.h"
 
@@ -20,9 +21,11 @@
 #include "level_zero/core/source/driver/driver_imp.h"
 #include "level_zero/core/source/driver/host_pointer_manager.h"
 #include "level_zero/core/source/fabric/fabric.h"
+#include "level_zero/core/source/module/module_build_queue.h"
 
 #include "driver_version_l0.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
@@ -152,10 +155,12 @@ DriverHandleImp::~DriverHandleImp() {
     if (memoryManager != nullptr) {
         memoryManager->peekExecutionEnvironment().prepareForCleanup();
         if (this->svmAllocsManager) {
-            this->svmAllocsManager->trimUSMDeviceAllocCache();
+            this->svmAllocsManager->trimUSMAllocCaches();
         }
     }
 
+    this->stagingBufferManager.reset();
+    this->moduleBuildQueue.reset();
     for (auto &device : this->devices) {
         delete device;
     }
@@ -222,6 +227,10 @@ ze_result_t DriverHandleImp::initialize(std::vector<std::unique_ptr<NEO::Device>
         return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
     }
 
+    if (NEO::StagingBufferManager::isEnabled()) {
+        this->stagingBufferManager = std::make_unique<NEO::StagingBufferManager>(this->svmAllocsManager, this->rootDeviceIndices, this->deviceBitfields);
+    }
+
     this->numDevices = static_cast<uint32_t>(this->devices.size());
 
     extensionFunctionsLookupMap = getExtensionFunctionsLookupMap();
@@ -367,6 +376,15 @@ void DriverHandleImp::createHostPointerManager() {
     hostPointerManager = std::make_unique<HostPointerManager>(getMemoryManager());
 }
 
+ModuleBuildQueue *DriverHandleImp::getModuleBuildQueue() {
+    std::lock_guard<std::mutex> lock(moduleBuildQueueMutex);
+    if (!moduleBuildQueue) {
+        auto workersCount = std::max(NEO::DebugManager.flags.AsyncModuleBuildThreads.get(), 1);
+        moduleBuildQueue = std::make_unique<ModuleBuildQueue>(static_cast<uint32_t>(workersCount));
+    }
+    return moduleBuildQueue.get();
+}
+
 ze_result_t DriverHandleImp::importExternalPointer(void *ptr, size_t size) {
     if (hostPointerManager.get() != nullptr) {
         auto ret = hostPointerManager->createHostPointerMultiAllocation(this->devices,
@@ -380,7 +398,13 @@ ze_result_t DriverHandleImp::importExternalPointer(void *ptr, size_t size) {
 
 ze_result_t DriverHandleImp::releaseImportedPointer(void *ptr) {
     if (hostPointerManager.get() != nullptr) {
+        auto hostPointerData = hostPointerManager->getHostPointerAllocation(ptr);
+        auto size = hostPointerData ? hostPointerData->size : 0u;
         bool ret = hostPointerManager->freeHostPointerAllocation(ptr);
+        if (ret) {
+            // Application is done with this range, pinning kept for earlier transfers from it has to go as well
+            getMemoryManager()->releaseCachedHostPtrPinning(ptr, size);
+        }
         return ret ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
     return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
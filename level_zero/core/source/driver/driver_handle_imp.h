@@ -16,8 +16,13 @@
 #include <map>
 #include <mutex>
 
+namespace NEO {
+class StagingBufferManager;
+} // namespace NEO
+
 namespace L0 {
 class HostPointerManager;
+class ModuleBuildQueue;
 
 struct DriverHandleImp : public DriverHandle {
     ~DriverHandleImp() override;
@@ -71,6 +76,7 @@ struct DriverHandleImp : public DriverHandle {
                                                uintptr_t *peerGpuAddress);
     ze_result_t fabricVertexGetExp(uint32_t *pCount, ze_fabric_vertex_handle_t *phDevices) override;
     void createHostPointerManager();
+    ModuleBuildQueue *getModuleBuildQueue();
     void sortNeoDevices(std::vector<std::unique_ptr<NEO::Device>> &neoDevices);
 
     bool isRemoteResourceNeeded(void *ptr,
@@ -79,6 +85,9 @@ struct DriverHandleImp : public DriverHandle {
                                 Device *device);
 
     std::unique_ptr<HostPointerManager> hostPointerManager;
+    std::unique_ptr<NEO::StagingBufferManager> stagingBufferManager;
+    std::unique_ptr<ModuleBuildQueue> moduleBuildQueue;
+    std::mutex moduleBuildQueueMutex;
     // Experimental functions
     std::unordered_map<std::string, void *> extensionFunctionsLookupMap;
 
@@ -29,6 +29,7 @@
 #include "level_zero/core/source/hw_helpers/l0_hw_helper.h"
 #include "level_zero/tools/source/metrics/metric.h"
 
+#include <algorithm>
 #include <set>
 
 //
@@ -43,6 +44,7 @@ ze_result_t EventPoolImp::initialize(DriverHandle *driver, Context *context, uin
 
     RootDeviceIndicesContainer rootDeviceIndices;
     uint32_t maxRootDeviceIndex = 0u;
+    NEO::DeviceBitfield eventDevicesBitfield = 0;
 
     DriverHandleImp *driverHandleImp = static_cast<DriverHandleImp *>(driver);
     bool useDevicesFromApi = true;
@@ -67,6 +69,7 @@ ze_result_t EventPoolImp::initialize(DriverHandle *driver, Context *context, uin
         }
 
         devices.push_back(eventDevice);
+        eventDevicesBitfield |= eventDevice->getNEODevice()->getDeviceBitfield();
         rootDeviceIndices.push_back(eventDevice->getNEODevice()->getRootDeviceIndex());
         if (maxRootDeviceIndex < eventDevice->getNEODevice()->getRootDeviceIndex()) {
             maxRootDeviceIndex = eventDevice->getNEODevice()->getRootDeviceIndex();
@@ -84,7 +87,8 @@ ze_result_t EventPoolImp::initialize(DriverHandle *driver, Context *context, uin
     size_t alignedSize = alignUp<size_t>(numEvents * eventSize, MemoryConstants::pageSize64k);
     NEO::AllocationType allocationType = isEventPoolTimestampFlagSet() ? NEO::AllocationType::TIMESTAMP_PACKET_TAG_BUFFER
                                                                        : NEO::AllocationType::BUFFER_HOST_MEMORY;
-    if (this->devices.size() > 1) {
+    // sub-devices of one root device signal and wait on events in its local memory
+    if (rootDeviceIndices.size() > 1) {
         useDeviceAlloc = false;
     }
 
@@ -97,7 +101,7 @@ ze_result_t EventPoolImp::initialize(DriverHandle *driver, Context *context, uin
     bool allocatedMemory = false;
 
     if (useDeviceAlloc) {
-        NEO::AllocationProperties allocationProperties{*rootDeviceIndices.begin(), alignedSize, allocationType, devices[0]->getNEODevice()->getDeviceBitfield()};
+        NEO::AllocationProperties allocationProperties{*rootDeviceIndices.begin(), alignedSize, allocationType, eventDevicesBitfield};
         allocationProperties.alignment = eventAlignment;
         if (eventPoolFlags & ZE_EVENT_POOL_FLAG_IPC) {
             this->isShareableEventMemory = true;
@@ -158,11 +162,159 @@ ze_result_t EventPoolImp::createEvent(const ze_event_desc_t *desc, ze_event_hand
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t EventPoolImp::hostResetEvents() {
+    hostFillEvents(false);
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t EventPoolImp::hostSignalEvents() {
+    hostFillEvents(true);
+    return ZE_RESULT_SUCCESS;
+}
+
+void EventPoolImp::hostFillEvents(bool signal) {
+    std::lock_guard<std::mutex> lock(eventsMutex);
+    if (events.empty()) {
+        return;
+    }
+
+    uint64_t pattern = 0u;
+    if (!signal) {
+        pattern = (events[0]->getTimestampSizeInDw() == 1) ? std::numeric_limits<uint64_t>::max()
+                                                              : static_cast<uint64_t>(Event::STATE_INITIAL);
+    }
+
+    void *previousBuffer = nullptr;
+    for (auto allocation : eventPoolAllocations->getGraphicsAllocations()) {
+        if (allocation == nullptr || allocation->getUnderlyingBuffer() == previousBuffer) {
+            continue;
+        }
+        previousBuffer = allocation->getUnderlyingBuffer();
+        NEO::CpuIntrinsics::nonTemporalFill(previousBuffer, pattern, numEvents * eventSize);
+    }
+    NEO::CpuIntrinsics::sfence();
+
+    for (auto event : events) {
+        if (signal) {
+            event->setCompleted();
+        } else {
+            event->resetHostState();
+        }
+    }
+}
+
+void EventPool::registerEvent(Event *event) {
+    std::lock_guard<std::mutex> lock(eventsMutex);
+    events.push_back(event);
+}
+
+void EventPool::unregisterEvent(Event *event) {
+    std::lock_guard<std::mutex> lock(eventsMutex);
+    auto it = std::find(events.begin(), events.end(), event);
+    if (it != events.end()) {
+        *it = events.back();
+        events.pop_back();
+    }
+}
+
 ze_result_t Event::destroy() {
     delete this;
     return ZE_RESULT_SUCCESS;
 }
 
+void Event::resetHostState() {
+    kernelCount = EventPacketsCount::maxKernelSplit;
+    resetPackets();
+    resetCompletion();
+    l3FlushAppliedOnKernel.reset();
+}
+
+CounterBasedEvent *CounterBasedEvent::create(Device *device) {
+    return new CounterBasedEvent(device);
+}
+
+CounterBasedEvent::CounterBasedEvent(Device *device) : device(device) {
+    counterBased = true;
+}
+
+ze_result_t CounterBasedEvent::hostSignal() {
+    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ze_result_t CounterBasedEvent::hostSynchronize(uint64_t timeout) {
+    NEO::CommandStreamReceiver *completionCsr = nullptr;
+    uint32_t completionTaskCount = 0u;
+    if (!getCompletionState(completionCsr, completionTaskCount)) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    if (timeout == 0) {
+        return queryStatus();
+    }
+
+    if (timeout == std::numeric_limits<uint64_t>::max()) {
+        // after kmd notify delay, blocking waits sleep in KMD on user fence, or gem wait when user fences are not active
+        const auto waitStatus = completionCsr->waitForTaskCountWithKmdNotifyFallback(completionTaskCount, completionCsr->obtainCurrentFlushStamp(), false, NEO::QueueThrottle::MEDIUM);
+        return waitStatus == NEO::WaitStatus::GpuHang ? ZE_RESULT_ERROR_DEVICE_LOST : ZE_RESULT_SUCCESS;
+    }
+
+    NEO::WaitParams waitParams{false, true, static_cast<int64_t>(timeout / 1000u)};
+
+    const auto waitStatus = completionCsr->waitForCompletionWithTimeout(waitParams, completionTaskCount);
+    if (waitStatus == NEO::WaitStatus::GpuHang) {
+        return ZE_RESULT_ERROR_DEVICE_LOST;
+    }
+    return waitStatus == NEO::WaitStatus::Ready ? ZE_RESULT_SUCCESS : ZE_RESULT_NOT_READY;
+}
+
+ze_result_t CounterBasedEvent::queryStatus() {
+    NEO::CommandStreamReceiver *completionCsr = nullptr;
+    uint32_t completionTaskCount = 0u;
+    if (!getCompletionState(completionCsr, completionTaskCount)) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    if (completionCsr->peekLatestFlushedTaskCount() < completionTaskCount) {
+        completionCsr->flushTagUpdate();
+    }
+    return completionCsr->testTaskCountReady(completionCsr->getTagAddress(), completionTaskCount) ? ZE_RESULT_SUCCESS : ZE_RESULT_NOT_READY;
+}
+
+ze_result_t CounterBasedEvent::reset() {
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t CounterBasedEvent::queryKernelTimestamp(ze_kernel_timestamp_result_t *dstptr) {
+    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ze_result_t CounterBasedEvent::queryTimestampsExp(Device *device, uint32_t *pCount, ze_kernel_timestamp_result_t *pTimestamps) {
+    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+NEO::GraphicsAllocation &CounterBasedEvent::getAllocation(Device *device) {
+    std::lock_guard<std::mutex> lock(completionStateMutex);
+    UNRECOVERABLE_IF(csr == nullptr);
+    return *csr->getTagAllocation();
+}
+
+uint64_t CounterBasedEvent::getGpuAddress(Device *device) {
+    return getAllocation(device).getGpuAddress();
+}
+
+void CounterBasedEvent::assignTaskCount(NEO::CommandStreamReceiver *signalingCsr, uint32_t signalingTaskCount) {
+    std::lock_guard<std::mutex> lock(completionStateMutex);
+    this->csr = signalingCsr;
+    this->taskCount = signalingTaskCount;
+}
+
+bool CounterBasedEvent::getCompletionState(NEO::CommandStreamReceiver *&completionCsr, uint32_t &completionTaskCount) {
+    std::lock_guard<std::mutex> lock(completionStateMutex);
+    completionCsr = this->csr;
+    completionTaskCount = this->taskCount;
+    return completionCsr != nullptr;
+}
+
 EventPool *EventPool::create(DriverHandle *driver, Context *context, uint32_t numDevices, ze_device_handle_t *phDevices, const ze_event_pool_desc_t *desc, ze_result_t &result) {
     auto eventPool = std::make_unique<EventPoolImp>(desc);
     if (!eventPool) {
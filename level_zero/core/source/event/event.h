@@ -14,6 +14,8 @@
 #include <bitset>
 #include <chrono>
 #include <limits>
+#include <mutex>
+#include <vector>
 
 struct _ze_event_handle_t {};
 
@@ -98,6 +100,9 @@ struct Event : _ze_event_handle_t {
     bool isUsingContextEndOffset() const {
         return isTimestampEvent || usingContextEndOffset;
     }
+    bool isCounterBased() const {
+        return counterBased;
+    }
 
     void increaseKernelCount() {
         kernelCount++;
@@ -119,6 +124,10 @@ struct Event : _ze_event_handle_t {
     void resetCompletion() {
         this->isCompleted = false;
     }
+    void setCompleted() {
+        this->isCompleted = true;
+    }
+    void resetHostState();
 
     uint64_t globalStartTS;
     uint64_t globalEndTS;
@@ -153,6 +162,7 @@ struct Event : _ze_event_handle_t {
 
     bool isTimestampEvent = false;
     bool usingContextEndOffset = false;
+    bool counterBased = false;
     std::atomic<bool> isCompleted{false};
 };
 
@@ -181,6 +191,7 @@ struct EventImp : public Event {
 
     ~EventImp() override {}
 
+    ze_result_t destroy() override;
     ze_result_t hostSignal() override;
 
     ze_result_t hostSynchronize(uint64_t timeout) override;
@@ -218,6 +229,40 @@ struct EventImp : public Event {
     MOCKABLE_VIRTUAL void assignKernelEventCompletionData(void *address);
 };
 
+// Event without pool memory, completed when the tag of the csr it was last signaled on reaches the task count of that submission.
+// Signaling only records the {csr, taskCount} pair, so the event is never written by the GPU and does not need reset.
+// An event that has not been signaled yet is considered complete.
+struct CounterBasedEvent : public Event {
+    static CounterBasedEvent *create(Device *device);
+
+    CounterBasedEvent(Device *device);
+
+    ze_result_t hostSignal() override;
+    ze_result_t hostSynchronize(uint64_t timeout) override;
+    ze_result_t queryStatus() override;
+    ze_result_t reset() override;
+    ze_result_t queryKernelTimestamp(ze_kernel_timestamp_result_t *dstptr) override;
+    ze_result_t queryTimestampsExp(Device *device, uint32_t *pCount, ze_kernel_timestamp_result_t *pTimestamps) override;
+
+    NEO::GraphicsAllocation &getAllocation(Device *device) override;
+    uint64_t getGpuAddress(Device *device) override;
+    uint32_t getPacketsInUse() override { return 1u; }
+    uint32_t getPacketsUsedInLastKernel() override { return 1u; }
+    uint64_t getPacketAddress(Device *device) override { return getGpuAddress(device); }
+    void resetPackets() override {}
+    void setPacketsInUse(uint32_t value) override {}
+    void setGpuStartTimestamp() override {}
+    void setGpuEndTimestamp() override {}
+
+    void assignTaskCount(NEO::CommandStreamReceiver *signalingCsr, uint32_t signalingTaskCount);
+    bool getCompletionState(NEO::CommandStreamReceiver *&completionCsr, uint32_t &completionTaskCount);
+
+  protected:
+    Device *device = nullptr;
+    std::mutex completionStateMutex;
+    uint32_t taskCount = 0u;
+};
+
 struct EventPool : _ze_event_pool_handle_t {
     static EventPool *create(DriverHandle *driver, Context *context, uint32_t numDevices, ze_device_handle_t *phDevices, const ze_event_pool_desc_t *desc, ze_result_t &result);
     virtual ~EventPool() = default;
@@ -226,6 +271,8 @@ struct EventPool : _ze_event_pool_handle_t {
     virtual ze_result_t closeIpcHandle() = 0;
     virtual ze_result_t createEvent(const ze_event_desc_t *desc, ze_event_handle_t *phEvent) = 0;
     virtual Device *getDevice() = 0;
+    virtual ze_result_t hostResetEvents() = 0;
+    virtual ze_result_t hostSignalEvents() = 0;
 
     static EventPool *fromHandle(ze_event_pool_handle_t handle) {
         return static_cast<EventPool *>(handle);
@@ -257,8 +304,14 @@ struct EventPool : _ze_event_pool_handle_t {
         return false;
     }
 
+    void registerEvent(Event *event);
+    void unregisterEvent(Event *event);
+
     std::unique_ptr<NEO::MultiGraphicsAllocation> eventPoolAllocations;
     ze_event_pool_flags_t eventPoolFlags;
+
+    std::mutex eventsMutex;
+    std::vector<Event *> events; // events created from this pool, for operations on all of them
 };
 
 struct EventPoolImp : public EventPool {
@@ -285,6 +338,9 @@ struct EventPoolImp : public EventPool {
 
     Device *getDevice() override { return devices[0]; }
 
+    ze_result_t hostResetEvents() override;
+    ze_result_t hostSignalEvents() override;
+
     void *eventPoolPtr = nullptr;
     std::vector<Device *> devices;
     ContextImp *context = nullptr;
@@ -293,6 +349,8 @@ struct EventPoolImp : public EventPool {
     bool isShareableEventMemory = false;
 
   protected:
+    void hostFillEvents(bool signal);
+
     uint32_t eventAlignment = 0;
     uint32_t eventSize = 0;
 };
@@ -45,10 +45,17 @@ Event *Event::create(EventPool *eventPool, const ze_event_desc_t *desc, Device *
     if (eventPoolImp->isImportedIpcPool == false) {
         event->reset();
     }
+    eventPool->registerEvent(event);
 
     return event;
 }
 
+template <typename TagSizeT>
+ze_result_t EventImp<TagSizeT>::destroy() {
+    eventPool->unregisterEvent(this);
+    return Event::destroy();
+}
+
 template <typename TagSizeT>
 uint64_t EventImp<TagSizeT>::getGpuAddress(Device *device) {
     auto alloc = eventPool->getAllocation().getGraphicsAllocation(device->getNEODevice()->getRootDeviceIndex());
@@ -72,4 +72,16 @@ ze_result_t FabricVertex::getDevice(ze_device_handle_t *phDevice) {
     return ZE_RESULT_SUCCESS;
 }
 
+// Vertices of different P2P capable root devices are connected with a device link,
+// copy engines of either endpoint reach peer memory without going through system memory.
+bool FabricVertex::isPeerLinkAvailable(const FabricVertex &peerVertex) const {
+    auto neoDevice = device->getNEODevice();
+    auto peerNeoDevice = peerVertex.device->getNEODevice();
+    if (neoDevice->getRootDeviceIndex() == peerNeoDevice->getRootDeviceIndex()) {
+        return false;
+    }
+    return neoDevice->getHardwareInfo().capabilityTable.p2pAccessSupported &&
+           peerNeoDevice->getHardwareInfo().capabilityTable.p2pAccessSupported;
+}
+
 } // namespace L0
@@ -14,12 +14,23 @@
 namespace L0 {
 
 Fence *Fence::create(CommandQueueImp *cmdQueue, const ze_fence_desc_t *desc) {
-    auto fence = new Fence(cmdQueue);
+    auto fence = cmdQueue->obtainFenceFromPool();
+    if (fence == nullptr) {
+        fence = new Fence(cmdQueue);
+    }
     UNRECOVERABLE_IF(fence == nullptr);
     fence->reset(!!(desc->flags & ZE_FENCE_FLAG_SIGNALED));
     return fence;
 }
 
+// fences only track a task count of the queue's timeline, destroyed fences are pooled for reuse
+ze_result_t Fence::destroy() {
+    if (cmdQueue == nullptr || !cmdQueue->returnFenceToPool(this)) {
+        delete this;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
 ze_result_t Fence::queryStatus() {
     auto csr = cmdQueue->getCsr();
     csr->downloadAllocations();
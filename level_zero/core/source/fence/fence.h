@@ -21,10 +21,7 @@ struct CommandQueueImp;
 struct Fence : _ze_fence_handle_t {
     static Fence *create(CommandQueueImp *cmdQueue, const ze_fence_desc_t *desc);
     virtual ~Fence() = default;
-    MOCKABLE_VIRTUAL ze_result_t destroy() {
-        delete this;
-        return ZE_RESULT_SUCCESS;
-    }
+    MOCKABLE_VIRTUAL ze_result_t destroy();
     MOCKABLE_VIRTUAL ze_result_t hostSynchronize(uint64_t timeout);
     MOCKABLE_VIRTUAL ze_result_t queryStatus();
     MOCKABLE_VIRTUAL ze_result_t assignTaskCountFromCsr();
@@ -17,8 +17,24 @@ std::unordered_map<std::string, void *> getExtensionFunctionsLookupMap() {
     addToMap(lookupMap, zexDriverImportExternalPointer);
     addToMap(lookupMap, zexDriverReleaseImportedPointer);
     addToMap(lookupMap, zexDriverGetHostPointerBaseAddress);
+    addToMap(lookupMap, zexDriverGetPerformanceHints);
+
+    addToMap(lookupMap, zexDeviceRecoverFromGpuHang);
 
     addToMap(lookupMap, zexKernelGetBaseAddress);
+    addToMap(lookupMap, zexKernelClone);
+
+    addToMap(lookupMap, zexCommandListUpdateKernelLaunch);
+    addToMap(lookupMap, zexCommandListAppendLaunchMultipleKernels);
+    addToMap(lookupMap, zexCommandListBeginGraphCapture);
+    addToMap(lookupMap, zexCommandListEndGraphCapture);
+    addToMap(lookupMap, zexCommandListAppendGraph);
+    addToMap(lookupMap, zexCommandListAppendConditionalLaunchKernel);
+
+    addToMap(lookupMap, zexEventQueryKernelTimestamps);
+    addToMap(lookupMap, zexCounterBasedEventCreate);
+    addToMap(lookupMap, zexEventPoolHostReset);
+    addToMap(lookupMap, zexEventPoolHostSignal);
 
     addToMap(lookupMap, zexMemGetIpcHandles);
     addToMap(lookupMap, zexMemOpenIpcHandles);
@@ -39,4 +39,12 @@ bool L0HwHelper::enableStateComputeModeTracking() {
     return defaultValue;
 }
 
+bool L0HwHelper::enableStateBaseAddressTracking() {
+    constexpr bool defaultValue = false;
+    if (NEO::DebugManager.flags.EnableStateBaseAddressTracking.get() != -1) {
+        return !!NEO::DebugManager.flags.EnableStateBaseAddressTracking.get();
+    }
+    return defaultValue;
+}
+
 } // namespace L0
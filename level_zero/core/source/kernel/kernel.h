@@ -36,7 +36,15 @@ struct KernelImmutableData {
 
     void initialize(NEO::KernelInfo *kernelInfo, Device *device,
                     uint32_t computeUnitsUsedForSratch,
-                    NEO::GraphicsAllocation *globalConstBuffer, NEO::GraphicsAllocation *globalVarBuffer, bool internalKernel);
+                    NEO::GraphicsAllocation *globalConstBuffer, NEO::GraphicsAllocation *globalVarBuffer, bool internalKernel,
+                    NEO::GraphicsAllocation *isaParentAllocation = nullptr, size_t isaOffsetInParentAllocation = 0u);
+
+    // allocation part of initialize, kept apart from templates so that modules can batch allocations
+    void initializeIsaAllocation(NEO::KernelInfo *kernelInfo, Device *device, bool internalKernel,
+                                 NEO::GraphicsAllocation *isaParentAllocation, size_t isaOffsetInParentAllocation);
+    // host only part of initialize, safe to run concurrently for different kernels
+    void initializeTemplates(NEO::KernelInfo *kernelInfo, Device *device, uint32_t computeUnitsUsedForSratch,
+                             NEO::GraphicsAllocation *globalConstBuffer, NEO::GraphicsAllocation *globalVarBuffer);
 
     const std::vector<NEO::GraphicsAllocation *> &getResidencyContainer() const {
         return residencyContainer;
@@ -47,7 +55,9 @@ struct KernelImmutableData {
     }
 
     uint32_t getIsaSize() const;
-    NEO::GraphicsAllocation *getIsaGraphicsAllocation() const { return isaGraphicsAllocation.get(); }
+    NEO::GraphicsAllocation *getIsaGraphicsAllocation() const { return isaParentAllocation ? isaParentAllocation : isaGraphicsAllocation.get(); }
+    size_t getIsaOffsetInParentAllocation() const { return isaOffsetInParentAllocation; }
+    uint64_t getIsaGpuAddress() const { return getIsaGraphicsAllocation()->getGpuAddress() + isaOffsetInParentAllocation; }
 
     const uint8_t *getCrossThreadDataTemplate() const { return crossThreadDataTemplate.get(); }
 
@@ -71,6 +81,14 @@ struct KernelImmutableData {
         return isaCopiedToAllocation;
     }
 
+    void setIsaDeduplicated() {
+        isaDeduplicated = true;
+    }
+
+    bool isIsaDeduplicated() const {
+        return isaDeduplicated;
+    }
+
     MOCKABLE_VIRTUAL void createRelocatedDebugData(NEO::GraphicsAllocation *globalConstBuffer,
                                                    NEO::GraphicsAllocation *globalVarBuffer);
 
@@ -79,6 +97,8 @@ struct KernelImmutableData {
     NEO::KernelInfo *kernelInfo = nullptr;
     NEO::KernelDescriptor *kernelDescriptor = nullptr;
     std::unique_ptr<NEO::GraphicsAllocation> isaGraphicsAllocation = nullptr;
+    NEO::GraphicsAllocation *isaParentAllocation = nullptr;
+    size_t isaOffsetInParentAllocation = 0u;
 
     uint32_t crossThreadDataSize = 0;
     std::unique_ptr<uint8_t[]> crossThreadDataTemplate = nullptr;
@@ -92,6 +112,7 @@ struct KernelImmutableData {
     std::vector<NEO::GraphicsAllocation *> residencyContainer;
 
     bool isaCopiedToAllocation = false;
+    bool isaDeduplicated = false;
 };
 
 struct Kernel : _ze_kernel_handle_t, virtual NEO::DispatchKernelEncoderI {
@@ -152,6 +173,7 @@ struct Kernel : _ze_kernel_handle_t, virtual NEO::DispatchKernelEncoderI {
     virtual NEO::GraphicsAllocation *getPrivateMemoryGraphicsAllocation() = 0;
 
     virtual ze_result_t setSchedulingHintExp(ze_scheduling_hint_exp_desc_t *pHint) = 0;
+    virtual ze_result_t clone(Kernel **outKernel) = 0;
 
     Kernel() = default;
     Kernel(const Kernel &) = delete;
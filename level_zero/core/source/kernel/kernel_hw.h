@@ -51,7 +51,7 @@ struct KernelHw : public KernelImp {
         if (NEO::isValidOffset(argInfo.bindless)) {
             surfaceStateAddress = patchBindlessSurfaceState(alloc, argInfo.bindless);
         } else {
-            surfaceStateAddress = ptrOffset(surfaceStateHeapData.get(), argInfo.bindful);
+            surfaceStateAddress = ptrOffset(getMutableSurfaceStateHeapData(), argInfo.bindful);
             surfaceState = *reinterpret_cast<typename GfxFamily::RENDER_SURFACE_STATE *>(surfaceStateAddress);
         }
         uint64_t bufferAddressForSsh = baseAddress;
@@ -68,7 +68,7 @@ struct KernelHw : public KernelImp {
         NEO::Device *neoDevice = device->getNEODevice();
 
         auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(reinterpret_cast<void *>(alloc->getGpuAddress()));
-        if (allocData && allocData->allocationFlagsProperty.flags.locallyUncachedResource) {
+        if (allocData && isAllocationUncached(allocData)) {
             l3Enabled = false;
         }
 
@@ -41,6 +41,7 @@
 
 #include "encode_surface_state_args.h"
 
+#include <algorithm>
 #include <memory>
 
 namespace L0 {
@@ -61,26 +62,44 @@ KernelImmutableData::~KernelImmutableData() {
 void KernelImmutableData::initialize(NEO::KernelInfo *kernelInfo, Device *device,
                                      uint32_t computeUnitsUsedForSratch,
                                      NEO::GraphicsAllocation *globalConstBuffer,
-                                     NEO::GraphicsAllocation *globalVarBuffer, bool internalKernel) {
+                                     NEO::GraphicsAllocation *globalVarBuffer, bool internalKernel,
+                                     NEO::GraphicsAllocation *isaParentAllocation, size_t isaOffsetInParentAllocation) {
+    initializeIsaAllocation(kernelInfo, device, internalKernel, isaParentAllocation, isaOffsetInParentAllocation);
+    initializeTemplates(kernelInfo, device, computeUnitsUsedForSratch, globalConstBuffer, globalVarBuffer);
+}
 
+void KernelImmutableData::initializeIsaAllocation(NEO::KernelInfo *kernelInfo, Device *device, bool internalKernel,
+                                                  NEO::GraphicsAllocation *isaParentAllocation, size_t isaOffsetInParentAllocation) {
     UNRECOVERABLE_IF(kernelInfo == nullptr);
-    this->kernelInfo = kernelInfo;
-    this->kernelDescriptor = &kernelInfo->kernelDescriptor;
-
-    DeviceImp *deviceImp = static_cast<DeviceImp *>(device);
-    auto neoDevice = deviceImp->getActiveDevice();
-    auto memoryManager = neoDevice->getMemoryManager();
-
     auto kernelIsaSize = kernelInfo->heapInfo.KernelHeapSize;
     UNRECOVERABLE_IF(kernelIsaSize == 0);
     UNRECOVERABLE_IF(!kernelInfo->heapInfo.pKernelHeap);
-    const auto allocType = internalKernel ? NEO::AllocationType::KERNEL_ISA_INTERNAL : NEO::AllocationType::KERNEL_ISA;
 
-    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(
+    if (isaParentAllocation) {
+        this->isaParentAllocation = isaParentAllocation;
+        this->isaOffsetInParentAllocation = isaOffsetInParentAllocation;
+        return;
+    }
+
+    auto neoDevice = static_cast<DeviceImp *>(device)->getActiveDevice();
+    const auto allocType = internalKernel ? NEO::AllocationType::KERNEL_ISA_INTERNAL : NEO::AllocationType::KERNEL_ISA;
+    auto allocation = neoDevice->getMemoryManager()->allocateGraphicsMemoryWithProperties(
         {neoDevice->getRootDeviceIndex(), kernelIsaSize, allocType, neoDevice->getDeviceBitfield()});
     UNRECOVERABLE_IF(allocation == nullptr);
 
     isaGraphicsAllocation.reset(allocation);
+}
+
+void KernelImmutableData::initializeTemplates(NEO::KernelInfo *kernelInfo, Device *device,
+                                              uint32_t computeUnitsUsedForSratch,
+                                              NEO::GraphicsAllocation *globalConstBuffer,
+                                              NEO::GraphicsAllocation *globalVarBuffer) {
+    UNRECOVERABLE_IF(kernelInfo == nullptr);
+    this->kernelInfo = kernelInfo;
+    this->kernelDescriptor = &kernelInfo->kernelDescriptor;
+
+    DeviceImp *deviceImp = static_cast<DeviceImp *>(device);
+    auto neoDevice = deviceImp->getActiveDevice();
 
     if (neoDevice->getDebugger() && kernelInfo->kernelDescriptor.external.debugData.get()) {
         createRelocatedDebugData(globalConstBuffer, globalVarBuffer);
@@ -188,12 +207,15 @@ void KernelImmutableData::createRelocatedDebugData(NEO::GraphicsAllocation *glob
 ze_result_t KernelImp::getBaseAddress(uint64_t *baseAddress) {
     if (baseAddress) {
         auto gmmHelper = module->getDevice()->getNEODevice()->getGmmHelper();
-        *baseAddress = gmmHelper->decanonize(this->kernelImmData->getIsaGraphicsAllocation()->getGpuAddress());
+        *baseAddress = gmmHelper->decanonize(this->kernelImmData->getIsaGpuAddress());
     }
     return ZE_RESULT_SUCCESS;
 }
 
 uint32_t KernelImmutableData::getIsaSize() const {
+    if (isaParentAllocation) {
+        return static_cast<uint32_t>(kernelInfo->heapInfo.KernelHeapSize);
+    }
     return static_cast<uint32_t>(isaGraphicsAllocation->getUnderlyingBufferSize());
 }
 
@@ -212,6 +234,9 @@ KernelImp::~KernelImp() {
         PrintfHandler::printOutput(kernelImmData, this->printfBuffer, module->getDevice());
         module->getDevice()->getNEODevice()->getMemoryManager()->freeGraphicsMemory(printfBuffer);
     }
+    if (rayTracingInitialized) {
+        module->getDevice()->getNEODevice()->releaseRayTracing();
+    }
     slmArgSizes.clear();
     crossThreadData.reset();
     surfaceStateHeapData.reset();
@@ -227,6 +252,16 @@ ze_result_t KernelImp::setArgumentValue(uint32_t argIndex, size_t argSize,
 }
 
 void KernelImp::setGroupCount(uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
+    auto &cache = groupCountPatchCache;
+    if (cache.groupCount[0] == groupCountX && cache.groupCount[1] == groupCountY && cache.groupCount[2] == groupCountZ &&
+        cache.groupSize[0] == groupSize[0] && cache.groupSize[1] == groupSize[1] && cache.groupSize[2] == groupSize[2]) {
+        return;
+    }
+    cache.groupCount[0] = groupCountX;
+    cache.groupCount[1] = groupCountY;
+    cache.groupCount[2] = groupCountZ;
+    std::copy(std::begin(groupSize), std::end(groupSize), std::begin(cache.groupSize));
+
     const NEO::KernelDescriptor &desc = kernelImmData->getDescriptor();
     uint32_t globalWorkSize[3] = {groupCountX * groupSize[0], groupCountY * groupSize[1],
                                   groupCountZ * groupSize[2]};
@@ -276,16 +311,14 @@ ze_result_t KernelImp::setGroupSize(uint32_t groupSizeX, uint32_t groupSizeY,
         return ZE_RESULT_ERROR_INVALID_GROUP_SIZE_DIMENSION;
     }
 
-    this->groupSize[0] = groupSizeX;
-    this->groupSize[1] = groupSizeY;
-    this->groupSize[2] = groupSizeZ;
+    const uint32_t newGroupSize[3] = {groupSizeX, groupSizeY, groupSizeZ};
     const NEO::KernelDescriptor &kernelDescriptor = kernelImmData->getDescriptor();
     for (uint32_t i = 0u; i < 3u; i++) {
         if (kernelDescriptor.kernelAttributes.requiredWorkgroupSize[i] != 0 &&
-            kernelDescriptor.kernelAttributes.requiredWorkgroupSize[i] != this->groupSize[i]) {
+            kernelDescriptor.kernelAttributes.requiredWorkgroupSize[i] != newGroupSize[i]) {
             NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr,
                                   "Invalid group size {%d, %d, %d} specified, requiredWorkGroupSize = {%d, %d, %d}\n",
-                                  this->groupSize[0], this->groupSize[1], this->groupSize[2],
+                                  groupSizeX, groupSizeY, groupSizeZ,
                                   kernelDescriptor.kernelAttributes.requiredWorkgroupSize[0],
                                   kernelDescriptor.kernelAttributes.requiredWorkgroupSize[1],
                                   kernelDescriptor.kernelAttributes.requiredWorkgroupSize[2]);
@@ -293,6 +326,14 @@ ze_result_t KernelImp::setGroupSize(uint32_t groupSizeX, uint32_t groupSizeY,
         }
     }
 
+    // group size holds last successfully applied size, cross thread data and local ids are already up to date
+    if (this->groupSize[0] == groupSizeX && this->groupSize[1] == groupSizeY && this->groupSize[2] == groupSizeZ) {
+        return ZE_RESULT_SUCCESS;
+    }
+    this->groupSize[0] = groupSizeX;
+    this->groupSize[1] = groupSizeY;
+    this->groupSize[2] = groupSizeZ;
+
     auto simdSize = kernelDescriptor.kernelAttributes.simdSize;
     this->numThreadsPerThreadGroup = static_cast<uint32_t>((itemsInGroup + simdSize - 1u) / simdSize);
     patchWorkgroupSizeInCrossThreadData(groupSizeX, groupSizeY, groupSizeZ);
@@ -344,28 +385,50 @@ ze_result_t KernelImp::suggestGroupSize(uint32_t globalSizeX, uint32_t globalSiz
     uint32_t dim = (globalSizeY > 1U) ? 2 : 1U;
     dim = (globalSizeZ > 1U) ? 3 : dim;
 
-    if (NEO::DebugManager.flags.EnableComputeWorkSizeND.get()) {
-        auto usesImages = getImmutableData()->getDescriptor().kernelAttributes.flags.usesImages;
-        auto neoDevice = module->getDevice()->getNEODevice();
-        const auto hwInfo = &neoDevice->getHardwareInfo();
-        const auto &deviceInfo = neoDevice->getDeviceInfo();
-        uint32_t numThreadsPerSubSlice = (uint32_t)deviceInfo.maxNumEUsPerSubSlice * deviceInfo.numThreadsPerEU;
-        uint32_t localMemSize = (uint32_t)deviceInfo.localMemSize;
-
-        NEO::WorkSizeInfo wsInfo(maxWorkGroupSize, kernelImmData->getDescriptor().kernelAttributes.usesBarriers(), simd, this->getSlmTotalSize(),
-                                 hwInfo, numThreadsPerSubSlice, localMemSize,
-                                 usesImages, false, kernelImmData->getDescriptor().kernelAttributes.flags.requiresDisabledEUFusion);
-        NEO::computeWorkgroupSizeND(wsInfo, retGroupSize, workItems, dim);
-    } else {
-        if (1U == dim) {
-            NEO::computeWorkgroupSize1D(maxWorkGroupSize, retGroupSize, workItems, simd);
-        } else if (NEO::DebugManager.flags.EnableComputeWorkSizeSquared.get() && (2U == dim)) {
-            NEO::computeWorkgroupSizeSquared(maxWorkGroupSize, retGroupSize, workItems, simd, dim);
+    NEO::WorkGroupSizeCacheKey cacheKey;
+    cacheKey.globalSize[0] = workItems[0];
+    cacheKey.globalSize[1] = workItems[1];
+    cacheKey.globalSize[2] = workItems[2];
+    cacheKey.slmTotalSize = this->getSlmTotalSize();
+    cacheKey.maxWorkGroupSize = maxWorkGroupSize;
+    cacheKey.workDim = dim;
+
+    auto profile = NEO::WorkGroupSizeProfile::get();
+    bool groupSizeFound = profile && profile->find(kernelImmData->getDescriptor().kernelMetadata.kernelName, workItems, maxWorkGroupSize, retGroupSize);
+    bool useCache = !groupSizeFound && NEO::WorkGroupSizeCache::isEnabled();
+    if (useCache) {
+        groupSizeFound = groupSizeCache.find(cacheKey, retGroupSize);
+        useCache = !groupSizeFound;
+    }
+
+    if (!groupSizeFound) {
+        if (NEO::DebugManager.flags.EnableComputeWorkSizeND.get()) {
+            auto usesImages = getImmutableData()->getDescriptor().kernelAttributes.flags.usesImages;
+            auto neoDevice = module->getDevice()->getNEODevice();
+            const auto hwInfo = &neoDevice->getHardwareInfo();
+            const auto &deviceInfo = neoDevice->getDeviceInfo();
+            uint32_t numThreadsPerSubSlice = (uint32_t)deviceInfo.maxNumEUsPerSubSlice * deviceInfo.numThreadsPerEU;
+            uint32_t localMemSize = (uint32_t)deviceInfo.localMemSize;
+
+            NEO::WorkSizeInfo wsInfo(maxWorkGroupSize, kernelImmData->getDescriptor().kernelAttributes.usesBarriers(), simd, this->getSlmTotalSize(),
+                                     hwInfo, numThreadsPerSubSlice, localMemSize,
+                                     usesImages, false, kernelImmData->getDescriptor().kernelAttributes.flags.requiresDisabledEUFusion);
+            NEO::computeWorkgroupSizeND(wsInfo, retGroupSize, workItems, dim);
         } else {
-            NEO::computeWorkgroupSize2D(maxWorkGroupSize, retGroupSize, workItems, simd);
+            if (1U == dim) {
+                NEO::computeWorkgroupSize1D(maxWorkGroupSize, retGroupSize, workItems, simd);
+            } else if (NEO::DebugManager.flags.EnableComputeWorkSizeSquared.get() && (2U == dim)) {
+                NEO::computeWorkgroupSizeSquared(maxWorkGroupSize, retGroupSize, workItems, simd, dim);
+            } else {
+                NEO::computeWorkgroupSize2D(maxWorkGroupSize, retGroupSize, workItems, simd);
+            }
         }
     }
 
+    if (useCache) {
+        groupSizeCache.store(cacheKey, retGroupSize);
+    }
+
     *groupSizeX = static_cast<uint32_t>(retGroupSize[0]);
     *groupSizeY = static_cast<uint32_t>(retGroupSize[1]);
     *groupSizeZ = static_cast<uint32_t>(retGroupSize[2]);
@@ -379,6 +442,13 @@ ze_result_t KernelImp::suggestMaxCooperativeGroupCount(uint32_t *totalGroupCount
     UNRECOVERABLE_IF(0 == groupSize[1]);
     UNRECOVERABLE_IF(0 == groupSize[2]);
 
+    auto &cache = cooperativeGroupCountCache;
+    if (cache.engineGroupType == engineGroupType && cache.isEngineInstanced == isEngineInstanced &&
+        cache.slmArgsTotalSize == slmArgsTotalSize && std::equal(groupSize, groupSize + 3, cache.groupSize)) {
+        *totalGroupCount = cache.totalGroupCount;
+        return ZE_RESULT_SUCCESS;
+    }
+
     auto &hardwareInfo = module->getDevice()->getHwInfo();
 
     auto dssCount = hardwareInfo.gtSystemInfo.DualSubSliceCount;
@@ -402,6 +472,14 @@ ze_result_t KernelImp::suggestMaxCooperativeGroupCount(uint32_t *totalGroupCount
                                                                workDim,
                                                                localWorkSize);
     *totalGroupCount = hwHelper.adjustMaxWorkGroupCount(*totalGroupCount, engineGroupType, hardwareInfo, isEngineInstanced);
+
+    if (NEO::DebugManager.flags.OverrideMaxWorkGroupCount.get() == -1) {
+        std::copy(groupSize, groupSize + 3, cache.groupSize);
+        cache.slmArgsTotalSize = slmArgsTotalSize;
+        cache.engineGroupType = engineGroupType;
+        cache.isEngineInstanced = isEngineInstanced;
+        cache.totalGroupCount = *totalGroupCount;
+    }
     return ZE_RESULT_SUCCESS;
 }
 
@@ -486,7 +564,7 @@ ze_result_t KernelImp::setArgRedescribedImage(uint32_t argIndex, ze_image_handle
     }
 
     const auto image = Image::fromHandle(argVal);
-    image->copyRedescribedSurfaceStateToSSH(surfaceStateHeapData.get(), arg.bindful);
+    image->copyRedescribedSurfaceStateToSSH(getMutableSurfaceStateHeapData(), arg.bindful);
     residencyContainer[argIndex] = image->getAllocation();
 
     return ZE_RESULT_SUCCESS;
@@ -504,7 +582,7 @@ ze_result_t KernelImp::setArgBufferWithAlloc(uint32_t argIndex, uintptr_t argVal
     auto allocData = this->module->getDevice()->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(reinterpret_cast<void *>(allocation->getGpuAddress()));
     if (allocData) {
         bool argWasUncacheable = isArgUncached[argIndex];
-        bool argIsUncacheable = allocData->allocationFlagsProperty.flags.locallyUncachedResource;
+        bool argIsUncacheable = isAllocationUncached(allocData);
         if (argWasUncacheable == false && argIsUncacheable) {
             kernelRequiresUncachedMocsCount++;
         } else if (argWasUncacheable && argIsUncacheable == false) {
@@ -518,6 +596,17 @@ ze_result_t KernelImp::setArgBufferWithAlloc(uint32_t argIndex, uintptr_t argVal
     return ZE_RESULT_SUCCESS;
 }
 
+// Allocation is accessed uncached when it was allocated with uncached bias or, afterwards,
+// when zeCommandListAppendMemAdvise with ZE_MEMORY_ADVICE_BIAS_UNCACHED was issued for it on kernel's device
+bool KernelImp::isAllocationUncached(NEO::SvmAllocationData *allocData) {
+    if (allocData->allocationFlagsProperty.flags.locallyUncachedResource) {
+        return true;
+    }
+    auto deviceImp = static_cast<DeviceImp *>(this->module->getDevice());
+    auto memAdvise = deviceImp->memAdviseSharedAllocations.find(allocData);
+    return memAdvise != deviceImp->memAdviseSharedAllocations.end() && memAdvise->second.cached_memory == 0;
+}
+
 ze_result_t KernelImp::setArgUnknown(uint32_t argIndex, size_t argSize, const void *argVal) {
     return ZE_RESULT_SUCCESS;
 }
@@ -633,7 +722,7 @@ ze_result_t KernelImp::setArgImage(uint32_t argIndex, size_t argSize, const void
     if (kernelImmData->getDescriptor().kernelAttributes.imageAddressingMode == NEO::KernelDescriptor::Bindless) {
         image->copySurfaceStateToSSH(patchBindlessSurfaceState(image->getAllocation(), arg.bindless), 0u, isMediaBlockImage);
     } else {
-        image->copySurfaceStateToSSH(surfaceStateHeapData.get(), arg.bindful, isMediaBlockImage);
+        image->copySurfaceStateToSSH(getMutableSurfaceStateHeapData(), arg.bindful, isMediaBlockImage);
     }
 
     residencyContainer[argIndex] = image->getAllocation();
@@ -670,7 +759,7 @@ ze_result_t KernelImp::setArgImage(uint32_t argIndex, size_t argSize, const void
 ze_result_t KernelImp::setArgSampler(uint32_t argIndex, size_t argSize, const void *argVal) {
     const auto &arg = kernelImmData->getDescriptor().payloadMappings.explicitArgs[argIndex].as<NEO::ArgDescSampler>();
     const auto sampler = Sampler::fromHandle(*static_cast<const ze_sampler_handle_t *>(argVal));
-    sampler->copySamplerStateToDSH(dynamicStateHeapData.get(), dynamicStateHeapDataSize, arg.bindful);
+    sampler->copySamplerStateToDSH(getMutableDynamicStateHeapData(), dynamicStateHeapDataSize, arg.bindful);
 
     auto samplerDesc = sampler->getSamplerDesc();
 
@@ -754,7 +843,7 @@ void KernelImp::patchCrossthreadDataWithPrivateAllocation(NEO::GraphicsAllocatio
     auto device = module->getDevice();
 
     ArrayRef<uint8_t> crossThreadDataArrayRef = ArrayRef<uint8_t>(this->crossThreadData.get(), this->crossThreadDataSize);
-    ArrayRef<uint8_t> surfaceStateHeapArrayRef = ArrayRef<uint8_t>(this->surfaceStateHeapData.get(), this->surfaceStateHeapDataSize);
+    ArrayRef<uint8_t> surfaceStateHeapArrayRef = ArrayRef<uint8_t>(getMutableSurfaceStateHeapData(), this->surfaceStateHeapDataSize);
 
     patchWithImplicitSurface(crossThreadDataArrayRef, surfaceStateHeapArrayRef,
                              static_cast<uintptr_t>(privateAllocation->getGpuAddressToPatch()),
@@ -773,7 +862,6 @@ ze_result_t KernelImp::initialize(const ze_kernel_desc_t *desc) {
     auto neoDevice = module->getDevice()->getNEODevice();
     auto &hwInfo = neoDevice->getHardwareInfo();
     const auto &hwInfoConfig = *NEO::HwInfoConfig::get(hwInfo.platform.eProductFamily);
-    auto &kernelDescriptor = kernelImmData->getDescriptor();
 
     UNRECOVERABLE_IF(!this->kernelImmData->getKernelInfo()->heapInfo.pKernelHeap);
 
@@ -786,6 +874,30 @@ ze_result_t KernelImp::initialize(const ze_kernel_desc_t *desc) {
                                                               static_cast<size_t>(this->kernelImmData->getKernelInfo()->heapInfo.KernelHeapSize));
     }
 
+    return initializeState(false);
+}
+
+ze_result_t KernelImp::clone(Kernel **outKernel) {
+    auto productFamily = module->getDevice()->getHwInfo().platform.eProductFamily;
+    UNRECOVERABLE_IF(productFamily >= IGFX_MAX_PRODUCT);
+    KernelAllocatorFn allocator = kernelFactory[productFamily];
+    auto kernel = static_cast<KernelImp *>(allocator(module));
+
+    // isa was already transferred when this kernel was created, clone only needs its own state
+    kernel->kernelImmData = this->kernelImmData;
+    auto result = kernel->initializeState(true);
+    if (result != ZE_RESULT_SUCCESS) {
+        kernel->destroy();
+        return result;
+    }
+    *outKernel = kernel;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t KernelImp::initializeState(bool shareHeapTemplates) {
+    auto neoDevice = module->getDevice()->getNEODevice();
+    auto &kernelDescriptor = kernelImmData->getDescriptor();
+
     for (const auto &argT : kernelDescriptor.payloadMappings.explicitArgs) {
         switch (argT.type) {
         default:
@@ -811,12 +923,16 @@ ze_result_t KernelImp::initialize(const ze_kernel_desc_t *desc) {
     isArgUncached.resize(this->kernelArgHandlers.size(), 0);
 
     if (kernelImmData->getSurfaceStateHeapSize() > 0) {
-        this->surfaceStateHeapData.reset(new uint8_t[kernelImmData->getSurfaceStateHeapSize()]);
-        memcpy_s(this->surfaceStateHeapData.get(),
-                 kernelImmData->getSurfaceStateHeapSize(),
-                 kernelImmData->getSurfaceStateHeapTemplate(),
-                 kernelImmData->getSurfaceStateHeapSize());
         this->surfaceStateHeapDataSize = kernelImmData->getSurfaceStateHeapSize();
+        if (shareHeapTemplates) {
+            this->sharedSurfaceStateHeapData = kernelImmData->getSurfaceStateHeapTemplate();
+        } else {
+            this->surfaceStateHeapData.reset(new uint8_t[kernelImmData->getSurfaceStateHeapSize()]);
+            memcpy_s(this->surfaceStateHeapData.get(),
+                     kernelImmData->getSurfaceStateHeapSize(),
+                     kernelImmData->getSurfaceStateHeapTemplate(),
+                     kernelImmData->getSurfaceStateHeapSize());
+        }
     }
 
     if (kernelDescriptor.kernelAttributes.crossThreadDataSize != 0) {
@@ -829,12 +945,16 @@ ze_result_t KernelImp::initialize(const ze_kernel_desc_t *desc) {
     }
 
     if (kernelImmData->getDynamicStateHeapDataSize() != 0) {
-        this->dynamicStateHeapData.reset(new uint8_t[kernelImmData->getDynamicStateHeapDataSize()]);
-        memcpy_s(this->dynamicStateHeapData.get(),
-                 kernelImmData->getDynamicStateHeapDataSize(),
-                 kernelImmData->getDynamicStateHeapTemplate(),
-                 kernelImmData->getDynamicStateHeapDataSize());
         this->dynamicStateHeapDataSize = kernelImmData->getDynamicStateHeapDataSize();
+        if (shareHeapTemplates) {
+            this->sharedDynamicStateHeapData = kernelImmData->getDynamicStateHeapTemplate();
+        } else {
+            this->dynamicStateHeapData.reset(new uint8_t[kernelImmData->getDynamicStateHeapDataSize()]);
+            memcpy_s(this->dynamicStateHeapData.get(),
+                     kernelImmData->getDynamicStateHeapDataSize(),
+                     kernelImmData->getDynamicStateHeapTemplate(),
+                     kernelImmData->getDynamicStateHeapDataSize());
+        }
     }
 
     if (kernelDescriptor.kernelAttributes.requiredWorkgroupSize[0] > 0) {
@@ -885,8 +1005,10 @@ ze_result_t KernelImp::initialize(const ze_kernel_desc_t *desc) {
         if (arg.pointerSize == 0) {
             // kernel is allocating its own RTDispatchGlobals manually
             neoDevice->initializeRayTracing(0);
+            rayTracingInitialized = true;
         } else {
             neoDevice->initializeRayTracing(bvhLevels);
+            rayTracingInitialized = true;
             auto rtDispatchGlobalsInfo = neoDevice->getRTDispatchGlobals(bvhLevels);
             if (rtDispatchGlobalsInfo == nullptr) {
                 return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
@@ -908,6 +1030,24 @@ ze_result_t KernelImp::initialize(const ze_kernel_desc_t *desc) {
     return ZE_RESULT_SUCCESS;
 }
 
+uint8_t *KernelImp::getMutableSurfaceStateHeapData() {
+    if (sharedSurfaceStateHeapData != nullptr) {
+        surfaceStateHeapData.reset(new uint8_t[surfaceStateHeapDataSize]);
+        memcpy_s(surfaceStateHeapData.get(), surfaceStateHeapDataSize, sharedSurfaceStateHeapData, surfaceStateHeapDataSize);
+        sharedSurfaceStateHeapData = nullptr;
+    }
+    return surfaceStateHeapData.get();
+}
+
+uint8_t *KernelImp::getMutableDynamicStateHeapData() {
+    if (sharedDynamicStateHeapData != nullptr) {
+        dynamicStateHeapData.reset(new uint8_t[dynamicStateHeapDataSize]);
+        memcpy_s(dynamicStateHeapData.get(), dynamicStateHeapDataSize, sharedDynamicStateHeapData, dynamicStateHeapDataSize);
+        sharedDynamicStateHeapData = nullptr;
+    }
+    return dynamicStateHeapData.get();
+}
+
 void KernelImp::createPrintfBuffer() {
     if (this->kernelImmData->getDescriptor().kernelAttributes.flags.usesPrintf || pImplicitArgs) {
         this->printfBuffer = PrintfHandler::createPrintfBuffer(this->module->getDevice());
@@ -942,7 +1082,7 @@ void KernelImp::setDebugSurface() {
     auto device = module->getDevice();
     if (module->isDebugEnabled() && device->getNEODevice()->getDebugger()) {
 
-        auto surfaceStateHeapRef = ArrayRef<uint8_t>(surfaceStateHeapData.get(), surfaceStateHeapDataSize);
+        auto surfaceStateHeapRef = ArrayRef<uint8_t>(getMutableSurfaceStateHeapData(), surfaceStateHeapDataSize);
 
         patchWithImplicitSurface(ArrayRef<uint8_t>(), surfaceStateHeapRef,
                                  0,
@@ -1034,6 +1174,10 @@ NEO::GraphicsAllocation *KernelImp::getIsaAllocation() const {
     return getImmutableData()->getIsaGraphicsAllocation();
 }
 
+uint64_t KernelImp::getIsaOffsetInParentAllocation() const {
+    return static_cast<uint64_t>(getImmutableData()->getIsaOffsetInParentAllocation());
+}
+
 ze_result_t KernelImp::setSchedulingHintExp(ze_scheduling_hint_exp_desc_t *pHint) {
     auto &threadArbitrationPolicy = const_cast<NEO::ThreadArbitrationPolicy &>(getKernelDescriptor().kernelAttributes.threadArbitrationPolicy);
     if (pHint->flags == ZE_SCHEDULING_HINT_EXP_FLAG_OLDEST_FIRST) {
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "shared/source/command_stream/thread_arbitration_policy.h"
+#include "shared/source/helpers/work_group_size_cache.h"
 #include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
 #include "shared/source/unified_memory/unified_memory.h"
 
@@ -15,6 +16,10 @@
 
 #include <memory>
 
+namespace NEO {
+struct SvmAllocationData;
+}
+
 namespace L0 {
 
 struct KernelExt {
@@ -85,6 +90,7 @@ struct KernelImp : Kernel {
     virtual void setBufferSurfaceState(uint32_t argIndex, void *address, NEO::GraphicsAllocation *alloc) = 0;
 
     ze_result_t initialize(const ze_kernel_desc_t *desc);
+    ze_result_t clone(Kernel **outKernel) override;
 
     const uint8_t *getPerThreadData() const override { return perThreadDataForWholeThreadGroup; }
     uint32_t getPerThreadDataSizeForWholeThreadGroup() const override { return perThreadDataSizeForWholeThreadGroup; }
@@ -99,10 +105,10 @@ struct KernelImp : Kernel {
     bool usesSyncBuffer() override;
     void patchSyncBuffer(NEO::GraphicsAllocation *gfxAllocation, size_t bufferOffset) override;
 
-    const uint8_t *getSurfaceStateHeapData() const override { return surfaceStateHeapData.get(); }
+    const uint8_t *getSurfaceStateHeapData() const override { return sharedSurfaceStateHeapData ? sharedSurfaceStateHeapData : surfaceStateHeapData.get(); }
     uint32_t getSurfaceStateHeapDataSize() const override { return surfaceStateHeapDataSize; }
 
-    const uint8_t *getDynamicStateHeapData() const override { return dynamicStateHeapData.get(); }
+    const uint8_t *getDynamicStateHeapData() const override { return sharedDynamicStateHeapData ? sharedDynamicStateHeapData : dynamicStateHeapData.get(); }
 
     const KernelImmutableData *getImmutableData() const override { return kernelImmData; }
 
@@ -128,12 +134,14 @@ struct KernelImp : Kernel {
     }
 
     NEO::GraphicsAllocation *getIsaAllocation() const override;
+    uint64_t getIsaOffsetInParentAllocation() const override;
 
     uint32_t getRequiredWorkgroupOrder() const override { return requiredWorkgroupOrder; }
     bool requiresGenerationOfLocalIdsByRuntime() const override { return kernelRequiresGenerationOfLocalIdsByRuntime; }
     bool getKernelRequiresUncachedMocs() { return (kernelRequiresUncachedMocsCount > 0); }
     bool getKernelRequiresQueueUncachedMocs() { return (kernelRequiresQueueUncachedMocsCount > 0); }
     void setKernelArgUncached(uint32_t index, bool val) { isArgUncached[index] = val; }
+    bool isAllocationUncached(NEO::SvmAllocationData *allocData);
 
     uint32_t *getGlobalOffsets() override {
         return this->globalOffsets;
@@ -168,7 +176,10 @@ struct KernelImp : Kernel {
   protected:
     KernelImp() = default;
 
+    ze_result_t initializeState(bool shareHeapTemplates);
     void patchWorkgroupSizeInCrossThreadData(uint32_t x, uint32_t y, uint32_t z);
+    uint8_t *getMutableSurfaceStateHeapData();
+    uint8_t *getMutableDynamicStateHeapData();
 
     NEO::GraphicsAllocation *privateMemoryGraphicsAllocation = nullptr;
 
@@ -188,16 +199,20 @@ struct KernelImp : Kernel {
     NEO::GraphicsAllocation *printfBuffer = nullptr;
 
     uint32_t groupSize[3] = {0u, 0u, 0u};
+    NEO::WorkGroupSizeCache groupSizeCache;
     uint32_t numThreadsPerThreadGroup = 1u;
     uint32_t threadExecutionMask = 0u;
 
     std::unique_ptr<uint8_t[]> crossThreadData = nullptr;
     uint32_t crossThreadDataSize = 0;
 
+    // clones point to immutable heap templates until the first write
     std::unique_ptr<uint8_t[]> surfaceStateHeapData = nullptr;
+    const uint8_t *sharedSurfaceStateHeapData = nullptr;
     uint32_t surfaceStateHeapDataSize = 0;
 
     std::unique_ptr<uint8_t[]> dynamicStateHeapData = nullptr;
+    const uint8_t *sharedDynamicStateHeapData = nullptr;
     uint32_t dynamicStateHeapDataSize = 0;
 
     uint8_t *perThreadDataForWholeThreadGroup = nullptr;
@@ -210,6 +225,21 @@ struct KernelImp : Kernel {
     uint32_t slmArgsTotalSize = 0U;
     uint32_t requiredWorkgroupOrder = 0u;
 
+    // last result of suggestMaxCooperativeGroupCount, reused while group size and SLM usage are unchanged
+    struct CooperativeGroupCountCache {
+        uint32_t groupSize[3] = {0u, 0u, 0u};
+        uint32_t slmArgsTotalSize = 0u;
+        NEO::EngineGroupType engineGroupType = NEO::EngineGroupType::MaxEngineGroups;
+        bool isEngineInstanced = false;
+        uint32_t totalGroupCount = 0u;
+    } cooperativeGroupCountCache;
+
+    // dimensions last patched by setGroupCount, cross thread data and implicit args are patched again only when they change
+    struct GroupCountPatchCache {
+        uint32_t groupCount[3] = {0u, 0u, 0u};
+        uint32_t groupSize[3] = {0u, 0u, 0u};
+    } groupCountPatchCache;
+
     bool kernelRequiresGenerationOfLocalIdsByRuntime = true;
     uint32_t kernelRequiresUncachedMocsCount = false;
     uint32_t kernelRequiresQueueUncachedMocsCount = false;
@@ -220,6 +250,7 @@ struct KernelImp : Kernel {
     ze_cache_config_flags_t cacheConfigFlags = 0u;
 
     bool kernelHasIndirectAccess = true;
+    bool rayTracingInitialized = false;
 
     std::unique_ptr<NEO::ImplicitArgs> pImplicitArgs;
 
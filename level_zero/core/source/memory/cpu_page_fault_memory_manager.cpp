@@ -13,6 +13,8 @@
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 
+#include <algorithm>
+
 namespace NEO {
 void PageFaultManager::transferToCpu(void *ptr, size_t size, void *device) {
     L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>(device);
@@ -20,22 +22,24 @@ void PageFaultManager::transferToCpu(void *ptr, size_t size, void *device) {
     NEO::SvmAllocationData *allocData = deviceImp->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
     UNRECOVERABLE_IF(allocData == nullptr);
 
+    auto offset = ptrDiff(ptr, allocData->cpuAllocation->getUnderlyingBuffer());
     auto ret =
-        deviceImp->pageFaultCommandList->appendPageFaultCopy(allocData->cpuAllocation,
-                                                             allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()),
-                                                             allocData->size, true);
+        deviceImp->pageFaultCommandList->appendPageFaultCopyRange(allocData->cpuAllocation,
+                                                                  allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()),
+                                                                  offset, std::min(size, allocData->size - offset), true);
     UNRECOVERABLE_IF(ret);
 }
-void PageFaultManager::transferToGpu(void *ptr, void *device) {
+void PageFaultManager::transferToGpu(void *ptr, size_t size, void *device) {
     L0::DeviceImp *deviceImp = static_cast<L0::DeviceImp *>(device);
 
     NEO::SvmAllocationData *allocData = deviceImp->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
     UNRECOVERABLE_IF(allocData == nullptr);
 
+    auto offset = ptrDiff(ptr, allocData->cpuAllocation->getUnderlyingBuffer());
     auto ret =
-        deviceImp->pageFaultCommandList->appendPageFaultCopy(allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()),
-                                                             allocData->cpuAllocation,
-                                                             allocData->size, false);
+        deviceImp->pageFaultCommandList->appendPageFaultCopyRange(allocData->gpuAllocations.getGraphicsAllocation(deviceImp->getRootDeviceIndex()),
+                                                                  allocData->cpuAllocation,
+                                                                  offset, std::min(size, allocData->size - offset), false);
     UNRECOVERABLE_IF(ret);
 
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, deviceImp->getNEODevice());
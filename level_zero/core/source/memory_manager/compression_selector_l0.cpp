@@ -19,6 +19,8 @@ bool CompressionSelector::preferCompressedAllocation(const AllocationProperties
             (properties.flags.isUSMDeviceAllocation)) {
             preferredCompression = true;
         }
+    } else if (compressionEnabled == -1) {
+        preferredCompression = allowCompressionForDeviceOnlyAllocation(properties, hwInfo);
     }
     return preferredCompression;
 }
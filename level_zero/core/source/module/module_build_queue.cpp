@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/core/source/module/module_build_queue.h"
+
+namespace L0 {
+
+ModuleBuildQueue::ModuleBuildQueue(uint32_t workersCount) {
+    workers.reserve(workersCount);
+    for (uint32_t i = 0; i < workersCount; i++) {
+        workers.emplace_back([this]() { workerLoop(); });
+    }
+}
+
+ModuleBuildQueue::~ModuleBuildQueue() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    condition.notify_all();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+void ModuleBuildQueue::enqueue(std::function<void()> &&task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        tasks.push_back(std::move(task));
+    }
+    condition.notify_one();
+}
+
+void ModuleBuildQueue::workerLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [this]() { return stopping || !tasks.empty(); });
+            if (tasks.empty()) {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
+
+} // namespace L0
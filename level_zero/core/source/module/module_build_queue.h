@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace L0 {
+
+// Fixed pool of worker threads owned by the driver handle, used to build modules in background.
+// Pending builds are drained before the queue is destroyed.
+class ModuleBuildQueue : NEO::NonCopyableOrMovableClass {
+  public:
+    ModuleBuildQueue(uint32_t workersCount);
+    ~ModuleBuildQueue();
+
+    void enqueue(std::function<void()> &&task);
+
+  protected:
+    void workerLoop();
+
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> tasks;
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool stopping = false;
+};
+
+} // namespace L0
@@ -7,6 +7,7 @@
 
 #include "level_zero/core/source/module/module_imp.h"
 
+#include "shared/source/built_ins/built_ins.h"
 #include "shared/source/compiler_interface/compiler_options.h"
 #include "shared/source/compiler_interface/compiler_warnings/compiler_warnings.h"
 #include "shared/source/compiler_interface/intermediate_representations.h"
@@ -22,6 +23,7 @@
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/compiler_hw_info_config.h"
 #include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/kernel_helpers.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/memory_manager/memory_manager.h"
@@ -32,14 +34,20 @@
 #include "shared/source/source_level_debugger/source_level_debugger.h"
 
 #include "level_zero/core/source/device/device.h"
+#include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/driver/driver_handle.h"
+#include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/source/kernel/kernel.h"
 #include "level_zero/core/source/module/module_build_log.h"
+#include "level_zero/core/source/module/module_build_queue.h"
 
 #include "program_debug_data.h"
 
+#include <algorithm>
+#include <atomic>
 #include <list>
 #include <memory>
+#include <thread>
 #include <unordered_map>
 
 namespace L0 {
@@ -145,6 +153,11 @@ std::string ModuleTranslationUnit::generateCompilerOptions(const char *buildOpti
 }
 
 bool ModuleTranslationUnit::processSpecConstantInfo(NEO::CompilerInterface *compilerInterface, const ze_module_constants_t *pConstants, const char *input, uint32_t inputSize) {
+    return processSpecConstantInfo(compilerInterface, pConstants, input, inputSize, this->specConstantsValues);
+}
+
+bool ModuleTranslationUnit::processSpecConstantInfo(NEO::CompilerInterface *compilerInterface, const ze_module_constants_t *pConstants, const char *input, uint32_t inputSize,
+                                                    NEO::specConstValuesMap &outSpecConstantsValues) {
     if (pConstants) {
         NEO::SpecConstantInfo specConstInfo;
         auto retVal = compilerInterface->getSpecConstantsInfo(*device->getNEODevice(), ArrayRef<const char>(input, inputSize), specConstInfo);
@@ -167,7 +180,43 @@ bool ModuleTranslationUnit::processSpecConstantInfo(NEO::CompilerInterface *comp
             }
             memcpy_s(&specConstantValue, sizeof(uint64_t),
                      const_cast<void *>(pConstants->pConstantValues[i]), atributeSize);
-            specConstantsValues[specConstantId] = specConstantValue;
+            outSpecConstantsValues[specConstantId] = specConstantValue;
+        }
+    }
+    return true;
+}
+
+bool ModuleTranslationUnit::processSpecConstantsInfoInParallel(NEO::CompilerInterface *compilerInterface, const std::vector<const ze_module_constants_t *> &specConstants,
+                                                               const std::vector<const char *> &inputSpirVs, const std::vector<uint32_t> &inputModuleSizes) {
+    auto modulesCount = specConstants.size();
+    std::vector<NEO::specConstValuesMap> modulesSpecConstantsValues(modulesCount);
+    std::vector<uint8_t> modulesResults(modulesCount, 0u);
+    std::atomic<size_t> nextModule{0u};
+    auto processRemainingModules = [&]() {
+        for (auto moduleId = nextModule++; moduleId < modulesCount; moduleId = nextModule++) {
+            modulesResults[moduleId] = this->processSpecConstantInfo(compilerInterface, specConstants[moduleId], inputSpirVs[moduleId], inputModuleSizes[moduleId],
+                                                                     modulesSpecConstantsValues[moduleId]);
+        }
+    };
+
+    auto threadsCount = std::min(static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u)), modulesCount);
+    std::vector<std::thread> workers;
+    workers.reserve(threadsCount - 1);
+    for (size_t i = 1u; i < threadsCount; i++) {
+        workers.emplace_back(processRemainingModules);
+    }
+    processRemainingModules();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    // merged in modules order, values of later modules override earlier ones as in serial processing
+    for (size_t moduleId = 0; moduleId < modulesCount; moduleId++) {
+        if (!modulesResults[moduleId]) {
+            return false;
+        }
+        for (auto &specConstantValue : modulesSpecConstantsValues[moduleId]) {
+            specConstantsValues[specConstantValue.first] = specConstantValue.second;
         }
     }
     return true;
@@ -178,6 +227,7 @@ bool ModuleTranslationUnit::compileGenBinary(NEO::TranslationInput inputArgs, bo
     UNRECOVERABLE_IF(nullptr == compilerInterface);
 
     inputArgs.specializedValues = this->specConstantsValues;
+    inputArgs.allowCaching = this->allowCaching && !staticLink;
 
     NEO::TranslationOutput compilerOuput = {};
     NEO::TranslationOutput::ErrorCode compilerErr;
@@ -212,11 +262,17 @@ bool ModuleTranslationUnit::staticLinkSpirV(std::vector<const char *> inputSpirV
 
     std::string internalOptions = this->generateCompilerOptions(buildOptions, internalBuildOptions);
 
-    for (uint32_t i = 0; i < static_cast<uint32_t>(specConstants.size()); i++) {
-        auto specConstantResult = this->processSpecConstantInfo(compilerInterface, specConstants[i], inputSpirVs[i], inputModuleSizes[i]);
-        if (!specConstantResult) {
+    if (NEO::DebugManager.flags.ParallelProgramBuild.get() == 1 && specConstants.size() > 1) {
+        if (!this->processSpecConstantsInfoInParallel(compilerInterface, specConstants, inputSpirVs, inputModuleSizes)) {
             return false;
         }
+    } else {
+        for (uint32_t i = 0; i < static_cast<uint32_t>(specConstants.size()); i++) {
+            auto specConstantResult = this->processSpecConstantInfo(compilerInterface, specConstants[i], inputSpirVs[i], inputModuleSizes[i]);
+            if (!specConstantResult) {
+                return false;
+            }
+        }
     }
 
     NEO::TranslationInput linkInputArgs = {IGC::CodeType::elf, IGC::CodeType::oclGenBin};
@@ -438,7 +494,12 @@ ModuleImp::ModuleImp(Device *device, ModuleBuildLog *moduleBuildLog, ModuleType
 }
 
 ModuleImp::~ModuleImp() {
+    waitForBuild();
     kernelImmDatas.clear();
+    releaseDeduplicatedIsaAllocations();
+    if (kernelsIsaParentAllocation) {
+        device->getNEODevice()->getMemoryManager()->freeGraphicsMemory(kernelsIsaParentAllocation);
+    }
 }
 
 NEO::Debug::Segments ModuleImp::getZebinSegments() {
@@ -447,7 +508,190 @@ NEO::Debug::Segments ModuleImp::getZebinSegments() {
         kernels.push_back({kernelImmData->getDescriptor().kernelMetadata.kernelName, kernelImmData->getIsaGraphicsAllocation()});
     ArrayRef<const uint8_t> strings = {reinterpret_cast<const uint8_t *>(translationUnit->programInfo.globalStrings.initData),
                                        translationUnit->programInfo.globalStrings.size};
-    return NEO::Debug::Segments(translationUnit->globalVarBuffer, translationUnit->globalConstBuffer, strings, kernels);
+    NEO::Debug::Segments segments(translationUnit->globalVarBuffer, translationUnit->globalConstBuffer, strings, kernels);
+    if (kernelsIsaParentAllocation) {
+        for (const auto &kernelImmData : kernelImmDatas) {
+            segments.nameToSegMap[kernelImmData->getDescriptor().kernelMetadata.kernelName] = {static_cast<uintptr_t>(kernelImmData->getIsaGpuAddress()),
+                                                                                              kernelImmData->getIsaSize()};
+        }
+    }
+    return segments;
+}
+
+bool ModuleImp::isKernelsIsaSuballocationEnabled() const {
+    if (DebugManager.flags.EnableModuleIsaSuballocation.get() != 1) {
+        return false;
+    }
+    // debuggers track every kernel isa as a separate allocation
+    return this->type == ModuleType::User &&
+           nullptr == device->getNEODevice()->getDebugger() &&
+           false == this->translationUnit->programInfo.kernelInfos.empty();
+}
+
+std::vector<size_t> ModuleImp::allocateKernelsIsaParentAllocation() {
+    std::vector<size_t> isaOffsets;
+    if (!isKernelsIsaSuballocationEnabled()) {
+        return isaOffsets;
+    }
+
+    size_t totalIsaSize = 0u;
+    for (const auto &kernelInfo : this->translationUnit->programInfo.kernelInfos) {
+        isaOffsets.push_back(totalIsaSize);
+        totalIsaSize += alignUp(static_cast<size_t>(kernelInfo->heapInfo.KernelHeapSize), MemoryConstants::cacheLineSize);
+    }
+
+    auto neoDevice = static_cast<DeviceImp *>(device)->getActiveDevice();
+    kernelsIsaParentAllocation = neoDevice->getMemoryManager()->allocateGraphicsMemoryWithProperties(
+        {neoDevice->getRootDeviceIndex(), totalIsaSize, NEO::AllocationType::KERNEL_ISA, neoDevice->getDeviceBitfield()});
+    if (nullptr == kernelsIsaParentAllocation) {
+        // fall back to separate allocation per kernel
+        isaOffsets.clear();
+    }
+    return isaOffsets;
+}
+
+void ModuleImp::copyKernelsIsaToParentAllocation(const NEO::Linker::PatchableSegments *patchedSegments) {
+    std::vector<uint8_t> isaHostStorage(kernelsIsaParentAllocation->getUnderlyingBufferSize(), 0u);
+    for (size_t i = 0; i < kernelImmDatas.size(); i++) {
+        auto &kernelImmData = kernelImmDatas[i];
+        UNRECOVERABLE_IF(kernelImmData->isIsaCopiedToAllocation());
+        const void *isa = kernelImmData->getKernelInfo()->heapInfo.pKernelHeap;
+        size_t isaSize = kernelImmData->getKernelInfo()->heapInfo.KernelHeapSize;
+        if (patchedSegments) {
+            isa = (*patchedSegments)[i].hostPointer;
+            isaSize = (*patchedSegments)[i].segmentSize;
+        }
+        auto offset = kernelImmData->getIsaOffsetInParentAllocation();
+        memcpy_s(isaHostStorage.data() + offset, isaHostStorage.size() - offset, isa, isaSize);
+        kernelImmData->setIsaCopiedToAllocation();
+    }
+
+    auto neoDevice = device->getNEODevice();
+    const auto &hwInfo = neoDevice->getHardwareInfo();
+    const auto &hwInfoConfig = *NEO::HwInfoConfig::get(hwInfo.platform.eProductFamily);
+    kernelsIsaParentAllocation->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
+    kernelsIsaParentAllocation->setAubWritable(true, std::numeric_limits<uint32_t>::max());
+    NEO::MemoryTransferHelper::transferMemoryToAllocation(hwInfoConfig.isBlitCopyRequiredForLocalMemory(hwInfo, *kernelsIsaParentAllocation),
+                                                          *neoDevice, kernelsIsaParentAllocation, 0, isaHostStorage.data(), isaHostStorage.size());
+}
+
+uint32_t ModuleImp::getKernelsInitializationThreadsCount() const {
+    auto kernelsCount = kernelImmDatas.size();
+    if (DebugManager.flags.ModuleInitializationThreads.get() != -1) {
+        return static_cast<uint32_t>(std::max(size_t{1u}, std::min(static_cast<size_t>(DebugManager.flags.ModuleInitializationThreads.get()), kernelsCount)));
+    }
+    if (kernelsCount < minKernelsForParallelInitialization) {
+        return 1u;
+    }
+    size_t threadsCount = std::min({static_cast<size_t>(std::thread::hardware_concurrency()), kernelsCount, static_cast<size_t>(maxKernelsInitializationThreads)});
+    return static_cast<uint32_t>(std::max(size_t{1u}, threadsCount));
+}
+
+void ModuleImp::initializeKernelImmutableDatasTemplates() {
+    auto computeUnitsUsedForScratch = device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch;
+    auto kernelsCount = kernelImmDatas.size();
+    std::atomic<size_t> nextKernel{0u};
+    auto initializeRemainingKernels = [&]() {
+        for (auto kernelId = nextKernel++; kernelId < kernelsCount; kernelId = nextKernel++) {
+            kernelImmDatas[kernelId]->initializeTemplates(this->translationUnit->programInfo.kernelInfos[kernelId], device, computeUnitsUsedForScratch,
+                                                          this->translationUnit->globalConstBuffer, this->translationUnit->globalVarBuffer);
+        }
+    };
+
+    // host only work, graphics allocations are created afterwards in kernels order
+    auto threadsCount = getKernelsInitializationThreadsCount();
+    std::vector<std::thread> workers;
+    workers.reserve(threadsCount - 1);
+    for (uint32_t i = 1u; i < threadsCount; i++) {
+        workers.emplace_back(initializeRemainingKernels);
+    }
+    initializeRemainingKernels();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+bool ModuleImp::isIsaDeduplicationAllowed(size_t kernelId) const {
+    auto neoDevice = device->getNEODevice();
+    if (!neoDevice->getMemoryManager()->isIsaDeduplicationEnabled()) {
+        return false;
+    }
+    if (this->type != ModuleType::User || nullptr != kernelsIsaParentAllocation || nullptr != neoDevice->getDebugger()) {
+        return false;
+    }
+    // relocated isa depends on addresses of this module's allocations
+    auto linkerInput = this->translationUnit->programInfo.linkerInput.get();
+    if (linkerInput) {
+        const auto &relocations = linkerInput->getRelocationsInInstructionSegments();
+        if (kernelId < relocations.size() && false == relocations[kernelId].empty()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+NEO::GraphicsAllocation *ModuleImp::obtainDeduplicatedIsaAllocation(const NEO::KernelInfo &kernelInfo) {
+    auto neoDevice = static_cast<DeviceImp *>(device)->getActiveDevice();
+    auto rootDevice = neoDevice->getRootDevice();
+    auto memoryManager = neoDevice->getMemoryManager();
+    auto isa = reinterpret_cast<const uint8_t *>(kernelInfo.heapInfo.pKernelHeap);
+    size_t isaSize = kernelInfo.heapInfo.KernelHeapSize;
+    auto isaHash = NEO::Hash::hash(reinterpret_cast<const char *>(isa), isaSize);
+
+    auto lock = memoryManager->lockSharedIsaAllocationMap();
+    auto &sharedIsaAllocations = memoryManager->getSharedIsaAllocationMap();
+    auto sharedIsaRange = sharedIsaAllocations.equal_range(isaHash);
+    for (auto sharedIsaIt = sharedIsaRange.first; sharedIsaIt != sharedIsaRange.second; ++sharedIsaIt) {
+        auto &sharedIsa = sharedIsaIt->second;
+        if (sharedIsa.isaAllocation->getRootDeviceIndex() == rootDevice->getRootDeviceIndex() &&
+            sharedIsa.isa.size() == isaSize && 0 == memcmp(sharedIsa.isa.data(), isa, isaSize)) {
+            sharedIsa.reuseCounter++;
+            deduplicatedIsaAllocations.push_back({isaHash, sharedIsa.isaAllocation});
+            return sharedIsa.isaAllocation;
+        }
+    }
+
+    // allocated for root device, so that all of its sub-devices can share it
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(
+        {rootDevice->getRootDeviceIndex(), isaSize, NEO::AllocationType::KERNEL_ISA, rootDevice->getDeviceBitfield()});
+    if (nullptr == allocation) {
+        return nullptr;
+    }
+
+    const auto &hwInfo = rootDevice->getHardwareInfo();
+    const auto &hwInfoConfig = *NEO::HwInfoConfig::get(hwInfo.platform.eProductFamily);
+    allocation->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
+    allocation->setAubWritable(true, std::numeric_limits<uint32_t>::max());
+    NEO::MemoryTransferHelper::transferMemoryToAllocation(hwInfoConfig.isBlitCopyRequiredForLocalMemory(hwInfo, *allocation),
+                                                          *rootDevice, allocation, 0, isa, isaSize);
+
+    sharedIsaAllocations.emplace(isaHash, NEO::MemoryManager::SharedIsaAllocationInfo(allocation, isa, isaSize));
+    deduplicatedIsaAllocations.push_back({isaHash, allocation});
+    return allocation;
+}
+
+void ModuleImp::releaseDeduplicatedIsaAllocations() {
+    if (deduplicatedIsaAllocations.empty()) {
+        return;
+    }
+    auto memoryManager = device->getNEODevice()->getMemoryManager();
+    auto lock = memoryManager->lockSharedIsaAllocationMap();
+    auto &sharedIsaAllocations = memoryManager->getSharedIsaAllocationMap();
+    for (const auto &deduplicatedIsa : deduplicatedIsaAllocations) {
+        auto sharedIsaRange = sharedIsaAllocations.equal_range(deduplicatedIsa.isaHash);
+        for (auto sharedIsaIt = sharedIsaRange.first; sharedIsaIt != sharedIsaRange.second; ++sharedIsaIt) {
+            if (sharedIsaIt->second.isaAllocation != deduplicatedIsa.allocation) {
+                continue;
+            }
+            sharedIsaIt->second.reuseCounter--;
+            if (sharedIsaIt->second.reuseCounter == 0) {
+                memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(deduplicatedIsa.allocation);
+                sharedIsaAllocations.erase(sharedIsaIt);
+            }
+            break;
+        }
+    }
+    deduplicatedIsaAllocations.clear();
 }
 
 bool ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice) {
@@ -523,6 +767,11 @@ bool ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice)
             }
         }
 
+        if (type == ModuleType::Builtin) {
+            this->translationUnit->allowCaching = (NEO::DebugManager.flags.EnableBuiltinBinaryCache.get() == 1) &&
+                                                  neoDevice->getBuiltIns()->isCacheingEnabled();
+        }
+
         if (desc->format == ZE_MODULE_FORMAT_NATIVE) {
             success = this->translationUnit->createFromNativeBinary(
                 reinterpret_cast<const char *>(desc->pInputModule), desc->inputSize);
@@ -558,12 +807,23 @@ bool ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice)
     }
 
     kernelImmDatas.reserve(this->translationUnit->programInfo.kernelInfos.size());
-    for (auto &ki : this->translationUnit->programInfo.kernelInfos) {
-        std::unique_ptr<KernelImmutableData> kernelImmData{new KernelImmutableData(this->device)};
-        kernelImmData->initialize(ki, device, device->getNEODevice()->getDeviceInfo().computeUnitsUsedForScratch,
-                                  this->translationUnit->globalConstBuffer, this->translationUnit->globalVarBuffer,
-                                  this->type == ModuleType::Builtin);
-        kernelImmDatas.push_back(std::move(kernelImmData));
+    for (size_t i = 0; i < this->translationUnit->programInfo.kernelInfos.size(); i++) {
+        kernelImmDatas.push_back(std::unique_ptr<KernelImmutableData>{new KernelImmutableData(this->device)});
+    }
+    initializeKernelImmutableDatasTemplates();
+
+    auto isaOffsets = allocateKernelsIsaParentAllocation();
+    for (size_t i = 0; i < kernelImmDatas.size(); i++) {
+        auto ki = this->translationUnit->programInfo.kernelInfos[i];
+        auto &kernelImmData = kernelImmDatas[i];
+        auto deduplicatedIsaAllocation = isIsaDeduplicationAllowed(i) ? obtainDeduplicatedIsaAllocation(*ki) : nullptr;
+        auto isaParentAllocation = deduplicatedIsaAllocation ? deduplicatedIsaAllocation : kernelsIsaParentAllocation;
+        kernelImmData->initializeIsaAllocation(ki, device, this->type == ModuleType::Builtin,
+                                               isaParentAllocation, kernelsIsaParentAllocation ? isaOffsets[i] : 0u);
+        if (deduplicatedIsaAllocation) {
+            kernelImmData->setIsaDeduplicated();
+            kernelImmData->setIsaCopiedToAllocation();
+        }
     }
 
     auto refBin = ArrayRef<const uint8_t>::fromAny(translationUnit->unpackedDeviceBinary.get(), translationUnit->unpackedDeviceBinarySize);
@@ -594,6 +854,9 @@ bool ModuleImp::initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice)
     const auto &hwInfoConfig = *NEO::HwInfoConfig::get(hwInfo.platform.eProductFamily);
 
     if (this->isFullyLinked && this->type == ModuleType::User) {
+        if (kernelsIsaParentAllocation && !kernelImmDatas[0]->isIsaCopiedToAllocation()) {
+            copyKernelsIsaToParentAllocation(nullptr);
+        }
         for (auto &ki : kernelImmDatas) {
 
             if (!ki->isIsaCopiedToAllocation()) {
@@ -739,6 +1002,9 @@ void ModuleImp::updateBuildLog(NEO::Device *neoDevice) {
 
 ze_result_t ModuleImp::createKernel(const ze_kernel_desc_t *desc,
                                     ze_kernel_handle_t *kernelHandle) {
+    if (!waitForBuild()) {
+        return ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
+    }
     ze_result_t res;
     if (!isFullyLinked) {
         return ZE_RESULT_ERROR_INVALID_MODULE_UNLINKED;
@@ -753,6 +1019,9 @@ ze_result_t ModuleImp::createKernel(const ze_kernel_desc_t *desc,
 }
 
 ze_result_t ModuleImp::getNativeBinary(size_t *pSize, uint8_t *pModuleNativeBinary) {
+    if (!waitForBuild()) {
+        return ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
+    }
     auto genBinary = this->translationUnit->packedDeviceBinary.get();
 
     *pSize = this->translationUnit->packedDeviceBinarySize;
@@ -763,6 +1032,9 @@ ze_result_t ModuleImp::getNativeBinary(size_t *pSize, uint8_t *pModuleNativeBina
 }
 
 ze_result_t ModuleImp::getDebugInfo(size_t *pDebugDataSize, uint8_t *pDebugData) {
+    if (!waitForBuild()) {
+        return ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
+    }
     if (translationUnit == nullptr) {
         return ZE_RESULT_ERROR_UNINITIALIZED;
     }
@@ -785,8 +1057,13 @@ void ModuleImp::copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSeg
         const auto &hwInfo = device->getNEODevice()->getHardwareInfo();
         const auto &hwInfoConfig = *NEO::HwInfoConfig::get(hwInfo.platform.eProductFamily);
 
+        if (kernelsIsaParentAllocation) {
+            copyKernelsIsaToParentAllocation(&isaSegmentsForPatching);
+            return;
+        }
+
         for (auto &kernelImmData : this->kernelImmDatas) {
-            if (nullptr == kernelImmData->getIsaGraphicsAllocation()) {
+            if (nullptr == kernelImmData->getIsaGraphicsAllocation() || kernelImmData->isIsaDeduplicated()) {
                 continue;
             }
 
@@ -842,8 +1119,8 @@ bool ModuleImp::linkBinary() {
     if (linkerInput->getExportedFunctionsSegmentId() >= 0) {
         auto exportedFunctionHeapId = linkerInput->getExportedFunctionsSegmentId();
         this->exportedFunctionsSurface = this->kernelImmDatas[exportedFunctionHeapId]->getIsaGraphicsAllocation();
-        exportedFunctions.gpuAddress = static_cast<uintptr_t>(exportedFunctionsSurface->getGpuAddressToPatch());
-        exportedFunctions.segmentSize = exportedFunctionsSurface->getUnderlyingBufferSize();
+        exportedFunctions.gpuAddress = static_cast<uintptr_t>(exportedFunctionsSurface->getGpuAddressToPatch() + this->kernelImmDatas[exportedFunctionHeapId]->getIsaOffsetInParentAllocation());
+        exportedFunctions.segmentSize = this->kernelImmDatas[exportedFunctionHeapId]->getIsaSize();
     }
 
     Linker::KernelDescriptorsT kernelDescriptors;
@@ -855,7 +1132,7 @@ bool ModuleImp::linkBinary() {
             auto &kernHeapInfo = kernelInfo->heapInfo;
             const char *originalIsa = reinterpret_cast<const char *>(kernHeapInfo.pKernelHeap);
             patchedIsaTempStorage.push_back(std::vector<char>(originalIsa, originalIsa + kernHeapInfo.KernelHeapSize));
-            isaSegmentsForPatching.push_back(Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), static_cast<uintptr_t>(kernelImmDatas.at(i)->getIsaGraphicsAllocation()->getGpuAddressToPatch()), kernHeapInfo.KernelHeapSize, kernelInfo->kernelDescriptor.kernelMetadata.kernelName});
+            isaSegmentsForPatching.push_back(Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), static_cast<uintptr_t>(kernelImmDatas.at(i)->getIsaGraphicsAllocation()->getGpuAddressToPatch() + kernelImmDatas.at(i)->getIsaOffsetInParentAllocation()), kernHeapInfo.KernelHeapSize, kernelInfo->kernelDescriptor.kernelMetadata.kernelName});
             kernelDescriptors.push_back(&kernelInfo->kernelDescriptor);
         }
     }
@@ -904,6 +1181,9 @@ bool ModuleImp::linkBinary() {
 }
 
 ze_result_t ModuleImp::getFunctionPointer(const char *pFunctionName, void **pfnFunction) {
+    if (!waitForBuild()) {
+        return ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
+    }
     // Check if the function is in the exported symbol table
     auto symbolIt = symbols.find(pFunctionName);
     if ((symbolIt != symbols.end()) && (symbolIt->second.symbol.segment == NEO::SegmentType::Instructions)) {
@@ -915,7 +1195,7 @@ ze_result_t ModuleImp::getFunctionPointer(const char *pFunctionName, void **pfnF
         auto kernelImmData = this->getKernelImmutableData(pFunctionName);
         if (kernelImmData != nullptr) {
             auto isaAllocation = kernelImmData->getIsaGraphicsAllocation();
-            *pfnFunction = reinterpret_cast<void *>(isaAllocation->getGpuAddress());
+            *pfnFunction = reinterpret_cast<void *>(kernelImmData->getIsaGpuAddress());
             // Ensure that any kernel in this module which uses this kernel module function pointer has access to the memory.
             for (auto &data : this->getKernelImmutableDataVector()) {
                 if (data.get() != kernelImmData) {
@@ -932,6 +1212,9 @@ ze_result_t ModuleImp::getFunctionPointer(const char *pFunctionName, void **pfnF
 }
 
 ze_result_t ModuleImp::getGlobalPointer(const char *pGlobalName, size_t *pSize, void **pPtr) {
+    if (!waitForBuild()) {
+        return ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
+    }
     uint64_t address;
     size_t size;
     auto hostSymbolIt = hostGlobalSymbolsMap.find(pGlobalName);
@@ -959,10 +1242,59 @@ ze_result_t ModuleImp::getGlobalPointer(const char *pGlobalName, size_t *pSize,
     return ZE_RESULT_SUCCESS;
 }
 
+bool ModuleImp::isAsyncBuildAllowed(const ze_module_desc_t *desc) const {
+    if (NEO::DebugManager.flags.AsyncModuleBuildThreads.get() <= 0) {
+        return false;
+    }
+    // build log and spec constants are consumed during zeModuleCreate, debugger requires module create notification
+    return type == ModuleType::User &&
+           desc->format == ZE_MODULE_FORMAT_IL_SPIRV &&
+           desc->pNext == nullptr &&
+           (desc->pConstants == nullptr || desc->pConstants->numConstants == 0u) &&
+           moduleBuildLog == nullptr &&
+           device->getL0Debugger() == nullptr &&
+           device->getNEODevice()->getSourceLevelDebugger() == nullptr;
+}
+
+void ModuleImp::initializeAsync(const ze_module_desc_t *desc, NEO::Device *neoDevice) {
+    auto input = reinterpret_cast<const uint8_t *>(desc->pInputModule);
+    asyncBuildInput.assign(input, input + desc->inputSize);
+    asyncBuildFlags = desc->pBuildFlags != nullptr ? desc->pBuildFlags : "";
+
+    asyncBuildDesc = *desc;
+    asyncBuildDesc.pInputModule = asyncBuildInput.data();
+    asyncBuildDesc.pBuildFlags = asyncBuildFlags.c_str();
+    asyncBuildDesc.pConstants = nullptr;
+    asyncBuildPending = true;
+
+    auto driverHandle = static_cast<DriverHandleImp *>(device->getDriverHandle());
+    driverHandle->getModuleBuildQueue()->enqueue([this, neoDevice]() {
+        auto success = this->initialize(&this->asyncBuildDesc, neoDevice);
+        asyncBuildInput = {};
+        {
+            std::lock_guard<std::mutex> lock(asyncBuildMutex);
+            asyncBuildSucceeded = success;
+            asyncBuildPending = false;
+        }
+        asyncBuildCondition.notify_all();
+    });
+}
+
+bool ModuleImp::waitForBuild() {
+    std::unique_lock<std::mutex> lock(asyncBuildMutex);
+    asyncBuildCondition.wait(lock, [this]() { return !asyncBuildPending; });
+    return asyncBuildSucceeded;
+}
+
 Module *Module::create(Device *device, const ze_module_desc_t *desc,
                        ModuleBuildLog *moduleBuildLog, ModuleType type) {
     auto module = new ModuleImp(device, moduleBuildLog, type);
 
+    if (module->isAsyncBuildAllowed(desc)) {
+        module->initializeAsync(desc, device->getNEODevice());
+        return module;
+    }
+
     bool success = module->initialize(desc, device->getNEODevice());
     if (success == false) {
         module->destroy();
@@ -973,6 +1305,9 @@ Module *Module::create(Device *device, const ze_module_desc_t *desc,
 }
 
 ze_result_t ModuleImp::getKernelNames(uint32_t *pCount, const char **pNames) {
+    if (!waitForBuild()) {
+        return ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
+    }
     auto &kernelImmDatas = this->getKernelImmutableDataVector();
     if (*pCount == 0) {
         *pCount = static_cast<uint32_t>(kernelImmDatas.size());
@@ -1033,6 +1368,9 @@ void ModuleImp::checkIfPrivateMemoryPerDispatchIsNeeded() {
 }
 
 ze_result_t ModuleImp::getProperties(ze_module_properties_t *pModuleProperties) {
+    if (!waitForBuild()) {
+        return ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
+    }
 
     pModuleProperties->flags = 0;
 
@@ -1046,6 +1384,11 @@ ze_result_t ModuleImp::getProperties(ze_module_properties_t *pModuleProperties)
 ze_result_t ModuleImp::performDynamicLink(uint32_t numModules,
                                           ze_module_handle_t *phModules,
                                           ze_module_build_log_handle_t *phLinkLog) {
+    for (auto i = 0u; i < numModules; i++) {
+        if (!static_cast<ModuleImp *>(Module::fromHandle(phModules[i]))->waitForBuild()) {
+            return ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
+        }
+    }
     std::map<void *, std::map<void *, void *>> dependencies;
     ModuleBuildLog *moduleLinkLog = nullptr;
     if (phLinkLog) {
@@ -1086,7 +1429,7 @@ ze_result_t ModuleImp::performDynamicLink(uint32_t numModules,
                     auto &kernHeapInfo = kernelInfo->heapInfo;
                     const char *originalIsa = reinterpret_cast<const char *>(kernHeapInfo.pKernelHeap);
                     patchedIsaTempStorage.push_back(std::vector<char>(originalIsa, originalIsa + kernHeapInfo.KernelHeapSize));
-                    isaSegmentsForPatching.push_back(NEO::Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), static_cast<uintptr_t>(kernelImmDatas.at(i)->getIsaGraphicsAllocation()->getGpuAddressToPatch()), kernHeapInfo.KernelHeapSize, kernelInfo->kernelDescriptor.kernelMetadata.kernelName});
+                    isaSegmentsForPatching.push_back(NEO::Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), static_cast<uintptr_t>(kernelImmDatas.at(i)->getIsaGraphicsAllocation()->getGpuAddressToPatch() + kernelImmDatas.at(i)->getIsaOffsetInParentAllocation()), kernHeapInfo.KernelHeapSize, kernelInfo->kernelDescriptor.kernelMetadata.kernelName});
                 }
             }
             for (const auto &unresolvedExternal : moduleId->unresolvedExternalsInfo) {
@@ -1189,6 +1532,7 @@ bool ModuleImp::populateHostGlobalSymbolsMap(std::unordered_map<std::string, std
 }
 
 ze_result_t ModuleImp::destroy() {
+    waitForBuild();
     notifyModuleDestroy();
 
     auto tempHandle = debugModuleHandle;
@@ -1295,8 +1639,12 @@ void ModuleImp::notifyModuleDestroy() {
 
 StackVec<NEO::GraphicsAllocation *, 32> ModuleImp::getModuleAllocations() {
     StackVec<NEO::GraphicsAllocation *, 32> allocs;
-    for (auto &kernImmData : kernelImmDatas) {
-        allocs.push_back(kernImmData->getIsaGraphicsAllocation());
+    if (kernelsIsaParentAllocation) {
+        allocs.push_back(kernelsIsaParentAllocation);
+    } else {
+        for (auto &kernImmData : kernelImmDatas) {
+            allocs.push_back(kernImmData->getIsaGraphicsAllocation());
+        }
     }
 
     if (translationUnit) {
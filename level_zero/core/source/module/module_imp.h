@@ -15,8 +15,10 @@
 
 #include "igfxfmid.h"
 
+#include <condition_variable>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 
 namespace NEO {
@@ -48,6 +50,10 @@ struct ModuleTranslationUnit {
     MOCKABLE_VIRTUAL bool processUnpackedBinary();
     std::vector<uint8_t> generateElfFromSpirV(std::vector<const char *> inputSpirVs, std::vector<uint32_t> inputModuleSizes);
     bool processSpecConstantInfo(NEO::CompilerInterface *compilerInterface, const ze_module_constants_t *pConstants, const char *input, uint32_t inputSize);
+    bool processSpecConstantInfo(NEO::CompilerInterface *compilerInterface, const ze_module_constants_t *pConstants, const char *input, uint32_t inputSize,
+                                 NEO::specConstValuesMap &outSpecConstantsValues);
+    bool processSpecConstantsInfoInParallel(NEO::CompilerInterface *compilerInterface, const std::vector<const ze_module_constants_t *> &specConstants,
+                                            const std::vector<const char *> &inputSpirVs, const std::vector<uint32_t> &inputModuleSizes);
     std::string generateCompilerOptions(const char *buildOptions, const char *internalBuildOptions);
     MOCKABLE_VIRTUAL bool compileGenBinary(NEO::TranslationInput inputArgs, bool staticLink);
     void updateBuildLog(const std::string &newLogEntry);
@@ -60,6 +66,7 @@ struct ModuleTranslationUnit {
 
     std::string options;
     bool shouldSuppressRebuildWarning{false};
+    bool allowCaching{false};
 
     std::string buildLog;
 
@@ -123,6 +130,9 @@ struct ModuleImp : public Module {
     MOCKABLE_VIRTUAL bool linkBinary();
 
     bool initialize(const ze_module_desc_t *desc, NEO::Device *neoDevice);
+    bool isAsyncBuildAllowed(const ze_module_desc_t *desc) const;
+    void initializeAsync(const ze_module_desc_t *desc, NEO::Device *neoDevice);
+    bool waitForBuild();
 
     bool isDebugEnabled() const override;
 
@@ -150,12 +160,31 @@ struct ModuleImp : public Module {
     void notifyModuleDestroy();
     bool populateHostGlobalSymbolsMap(std::unordered_map<std::string, std::string> &devToHostNameMapping);
     StackVec<NEO::GraphicsAllocation *, 32> getModuleAllocations();
+    bool isKernelsIsaSuballocationEnabled() const;
+    std::vector<size_t> allocateKernelsIsaParentAllocation();
+    void copyKernelsIsaToParentAllocation(const NEO::Linker::PatchableSegments *patchedSegments);
+    uint32_t getKernelsInitializationThreadsCount() const;
+    void initializeKernelImmutableDatasTemplates();
+    bool isIsaDeduplicationAllowed(size_t kernelId) const;
+    NEO::GraphicsAllocation *obtainDeduplicatedIsaAllocation(const NEO::KernelInfo &kernelInfo);
+    void releaseDeduplicatedIsaAllocations();
+
+    static constexpr size_t minKernelsForParallelInitialization = 64u;
+    static constexpr uint32_t maxKernelsInitializationThreads = 16u;
 
     Device *device = nullptr;
     PRODUCT_FAMILY productFamily{};
     std::unique_ptr<ModuleTranslationUnit> translationUnit;
     ModuleBuildLog *moduleBuildLog = nullptr;
     NEO::GraphicsAllocation *exportedFunctionsSurface = nullptr;
+    NEO::GraphicsAllocation *kernelsIsaParentAllocation = nullptr;
+
+    struct DeduplicatedIsaAllocation {
+        uint64_t isaHash = 0u;
+        NEO::GraphicsAllocation *allocation = nullptr;
+    };
+    std::vector<DeduplicatedIsaAllocation> deduplicatedIsaAllocations;
+
     uint32_t maxGroupSize = 0U;
     std::vector<std::unique_ptr<KernelImmutableData>> kernelImmDatas;
     NEO::Linker::RelocatedSymbolsMap symbols;
@@ -179,6 +208,14 @@ struct ModuleImp : public Module {
     uint32_t profileFlags = 0;
     uint64_t moduleLoadAddress = std::numeric_limits<uint64_t>::max();
 
+    std::mutex asyncBuildMutex;
+    std::condition_variable asyncBuildCondition;
+    bool asyncBuildPending = false;
+    bool asyncBuildSucceeded = true;
+    ze_module_desc_t asyncBuildDesc{};
+    std::vector<uint8_t> asyncBuildInput;
+    std::string asyncBuildFlags;
+
     NEO::Linker::PatchableSegments isaSegmentsForPatching;
     std::vector<std::vector<char>> patchedIsaTempStorage;
 };
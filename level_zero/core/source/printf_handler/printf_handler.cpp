@@ -28,6 +28,11 @@ NEO::GraphicsAllocation *PrintfHandler::createPrintfBuffer(Device *device) {
 
 void PrintfHandler::printOutput(const KernelImmutableData *kernelData,
                                 NEO::GraphicsAllocation *printfBuffer, Device *device) {
+    auto printfBufferWrittenSize = *reinterpret_cast<uint32_t *>(printfBuffer->getUnderlyingBuffer());
+    if (printfBufferWrittenSize <= PrintfHandler::printfSurfaceInitialDataSize) {
+        return;
+    }
+
     bool using32BitGpuPointers = kernelData->getDescriptor().kernelAttributes.gpuPointerSize == 4u;
 
     auto usesStringMap = kernelData->getDescriptor().kernelAttributes.usesStringMap();
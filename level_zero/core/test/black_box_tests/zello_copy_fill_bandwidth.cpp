@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <level_zero/ze_api.h>
+
+#include "zello_common.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+// Measures latency and bandwidth of copies and fills submitted through synchronous immediate
+// command lists. Sweeps transfer sizes, USM and system memory types of the source and every
+// queue group with copy capability, then prints which queue group is the fastest for each size.
+// Immediate command lists use the same paths as applications do, including copies split between
+// copy engines and CPU copies through locked pointers for small host to device transfers.
+
+enum class MemoryType {
+    Host,
+    Device,
+    Shared,
+    System
+};
+
+const char *getMemoryTypeName(MemoryType memoryType) {
+    switch (memoryType) {
+    case MemoryType::Host:
+        return "host";
+    case MemoryType::Device:
+        return "device";
+    case MemoryType::Shared:
+        return "shared";
+    default:
+        return "system";
+    }
+}
+
+struct QueueGroup {
+    uint32_t ordinal;
+    std::string name;
+};
+
+struct Measurement {
+    double latencyUs;
+    double bandwidthGBs;
+};
+
+std::vector<QueueGroup> getCopyCapableQueueGroups(ze_device_handle_t device) {
+    uint32_t numQueueGroups = 0;
+    SUCCESS_OR_TERMINATE(zeDeviceGetCommandQueueGroupProperties(device, &numQueueGroups, nullptr));
+    std::vector<ze_command_queue_group_properties_t> queueProperties(numQueueGroups);
+    SUCCESS_OR_TERMINATE(zeDeviceGetCommandQueueGroupProperties(device, &numQueueGroups, queueProperties.data()));
+
+    std::vector<QueueGroup> queueGroups;
+    uint32_t copyOnlyGroupsCount = 0;
+    for (uint32_t i = 0; i < numQueueGroups; i++) {
+        if (!(queueProperties[i].flags & ZE_COMMAND_QUEUE_GROUP_PROPERTY_FLAG_COPY)) {
+            continue;
+        }
+        std::string name;
+        if (queueProperties[i].flags & ZE_COMMAND_QUEUE_GROUP_PROPERTY_FLAG_COMPUTE) {
+            name = "compute";
+        } else {
+            name = (copyOnlyGroupsCount++ == 0) ? "copy" : "link copy";
+        }
+        name += "(" + std::to_string(i) + ")";
+        queueGroups.push_back({i, name});
+    }
+    return queueGroups;
+}
+
+void *allocate(ze_context_handle_t context, ze_device_handle_t device, MemoryType memoryType, size_t size) {
+    void *ptr = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+    ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+    switch (memoryType) {
+    case MemoryType::Host:
+        SUCCESS_OR_TERMINATE(zeMemAllocHost(context, &hostDesc, size, 64, &ptr));
+        break;
+    case MemoryType::Device:
+        SUCCESS_OR_TERMINATE(zeMemAllocDevice(context, &deviceDesc, size, 64, device, &ptr));
+        break;
+    case MemoryType::Shared:
+        SUCCESS_OR_TERMINATE(zeMemAllocShared(context, &deviceDesc, &hostDesc, size, 64, device, &ptr));
+        break;
+    default:
+        ptr = malloc(size);
+        SUCCESS_OR_TERMINATE_BOOL(ptr != nullptr);
+        memset(ptr, 0, size);
+        break;
+    }
+    return ptr;
+}
+
+void release(ze_context_handle_t context, MemoryType memoryType, void *ptr) {
+    if (memoryType == MemoryType::System) {
+        free(ptr);
+        return;
+    }
+    SUCCESS_OR_TERMINATE(zeMemFree(context, ptr));
+}
+
+template <typename AppendT>
+Measurement measure(ze_command_list_handle_t cmdList, size_t size, uint32_t iterations, AppendT &&append) {
+    SUCCESS_OR_TERMINATE(append(cmdList));
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        SUCCESS_OR_TERMINATE(append(cmdList));
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    auto totalUs = std::chrono::duration<double, std::micro>(end - start).count();
+    Measurement measurement;
+    measurement.latencyUs = totalUs / iterations;
+    measurement.bandwidthGBs = (static_cast<double>(size) / 1e3) / measurement.latencyUs;
+    return measurement;
+}
+
+int main(int argc, char *argv[]) {
+    const std::string blackBoxName = "Zello Copy Fill Bandwidth";
+    verbose = isVerbose(argc, argv);
+    uint32_t iterations = static_cast<uint32_t>(getParamValue(argc, argv, "-i", "--iterations", 10));
+    size_t minSize = static_cast<size_t>(getParamValue(argc, argv, "-min", "--min-size", 256));
+    size_t maxSize = static_cast<size_t>(getParamValue(argc, argv, "-max", "--max-size", 256 * 1024 * 1024));
+
+    ze_context_handle_t context = nullptr;
+    auto devices = zelloInitContextAndGetDevices(context);
+    auto device = devices[0];
+
+    ze_device_properties_t deviceProperties = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    SUCCESS_OR_TERMINATE(zeDeviceGetProperties(device, &deviceProperties));
+    printDeviceProperties(deviceProperties);
+
+    auto queueGroups = getCopyCapableQueueGroups(device);
+    std::vector<ze_command_list_handle_t> cmdLists;
+    for (auto &queueGroup : queueGroups) {
+        ze_command_queue_desc_t cmdQueueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+        cmdQueueDesc.ordinal = queueGroup.ordinal;
+        cmdQueueDesc.index = 0;
+        cmdQueueDesc.mode = ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS;
+        ze_command_list_handle_t cmdList = nullptr;
+        SUCCESS_OR_TERMINATE(zeCommandListCreateImmediate(context, device, &cmdQueueDesc, &cmdList));
+        cmdLists.push_back(cmdList);
+    }
+
+    void *deviceBuffer = allocate(context, device, MemoryType::Device, maxSize);
+    const MemoryType memoryTypes[] = {MemoryType::Host, MemoryType::Device, MemoryType::Shared, MemoryType::System};
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "operation, source, queue group, size [B], latency [us], bandwidth [GB/s]\n";
+    for (auto memoryType : memoryTypes) {
+        void *srcBuffer = allocate(context, device, memoryType, maxSize);
+
+        for (auto operation : {"copy", "fill"}) {
+            bool isFill = (std::string(operation) == "fill");
+            if (isFill && memoryType != MemoryType::Host) {
+                continue;
+            }
+            // fill pattern is read from host memory, destination is the device buffer in both operations
+            std::string source = isFill ? "pattern" : getMemoryTypeName(memoryType);
+
+            std::string previousBest;
+            for (size_t size = minSize; size <= maxSize; size *= 4) {
+                std::string best;
+                double bestLatency = std::numeric_limits<double>::max();
+                for (size_t group = 0; group < queueGroups.size(); group++) {
+                    Measurement measurement;
+                    if (isFill) {
+                        uint32_t pattern = 0xdeadbeef;
+                        measurement = measure(cmdLists[group], size, iterations, [&](ze_command_list_handle_t cmdList) {
+                            return zeCommandListAppendMemoryFill(cmdList, deviceBuffer, &pattern, sizeof(pattern), size, nullptr, 0, nullptr);
+                        });
+                    } else {
+                        measurement = measure(cmdLists[group], size, iterations, [&](ze_command_list_handle_t cmdList) {
+                            return zeCommandListAppendMemoryCopy(cmdList, deviceBuffer, srcBuffer, size, nullptr, 0, nullptr);
+                        });
+                    }
+                    std::cout << operation << ", " << source << ", " << queueGroups[group].name << ", " << size << ", "
+                              << measurement.latencyUs << ", " << measurement.bandwidthGBs << "\n";
+                    if (measurement.latencyUs < bestLatency) {
+                        bestLatency = measurement.latencyUs;
+                        best = queueGroups[group].name;
+                    }
+                }
+                if (!previousBest.empty() && best != previousBest) {
+                    std::cout << "Crossover: " << operation << " from " << source << " is faster on " << best
+                              << " than on " << previousBest << " from " << size << " bytes\n";
+                }
+                previousBest = best;
+            }
+        }
+
+        release(context, memoryType, srcBuffer);
+    }
+
+    release(context, MemoryType::Device, deviceBuffer);
+    for (auto cmdList : cmdLists) {
+        SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+    }
+    SUCCESS_OR_TERMINATE(zeContextDestroy(context));
+
+    printResult(false, true, blackBoxName);
+    return 0;
+}
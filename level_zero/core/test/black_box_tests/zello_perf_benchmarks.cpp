@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include <level_zero/ze_api.h>
+
+#include "zello_common.h"
+#include "zello_compile.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+const char *emptyKernelSrc = R"===(
+__kernel void empty_kernel(){
+}
+)===";
+
+struct BenchmarkResult {
+    std::string name;
+    std::string unit;
+    uint32_t iterations = 0;
+    double min = 0.0;
+    double median = 0.0;
+    double mean = 0.0;
+    double max = 0.0;
+};
+
+using Clock = std::chrono::steady_clock;
+
+BenchmarkResult summarize(const std::string &name, const std::string &unit, std::vector<double> &samples) {
+    BenchmarkResult result;
+    result.name = name;
+    result.unit = unit;
+    result.iterations = static_cast<uint32_t>(samples.size());
+    if (samples.empty()) {
+        return result;
+    }
+    std::sort(samples.begin(), samples.end());
+    result.min = samples.front();
+    result.max = samples.back();
+    result.median = samples[samples.size() / 2];
+    double sum = 0.0;
+    for (auto sample : samples) {
+        sum += sample;
+    }
+    result.mean = sum / samples.size();
+    return result;
+}
+
+double elapsedUs(Clock::time_point start, Clock::time_point end) {
+    return std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+void createEmptyKernel(ze_context_handle_t &context, ze_device_handle_t &device, ze_module_handle_t &module, ze_kernel_handle_t &kernel) {
+    std::string buildLog;
+    auto spirV = compileToSpirV(emptyKernelSrc, "", buildLog);
+    if (buildLog.size() > 0) {
+        std::cout << "Build log " << buildLog;
+    }
+    SUCCESS_OR_TERMINATE((0 == spirV.size()));
+
+    ze_module_desc_t moduleDesc = {ZE_STRUCTURE_TYPE_MODULE_DESC};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pInputModule = spirV.data();
+    moduleDesc.inputSize = spirV.size();
+    moduleDesc.pBuildFlags = "";
+    SUCCESS_OR_TERMINATE(zeModuleCreate(context, device, &moduleDesc, &module, nullptr));
+
+    ze_kernel_desc_t kernelDesc = {ZE_STRUCTURE_TYPE_KERNEL_DESC};
+    kernelDesc.pKernelName = "empty_kernel";
+    SUCCESS_OR_TERMINATE(zeKernelCreate(module, &kernelDesc, &kernel));
+    SUCCESS_OR_TERMINATE(zeKernelSetGroupSize(kernel, 1u, 1u, 1u));
+}
+
+// Host time of a single empty kernel launch on a synchronous immediate command list
+BenchmarkResult benchmarkImmediateEmptyKernelLaunch(ze_context_handle_t &context, ze_device_handle_t &device, ze_kernel_handle_t kernel, uint32_t iterations) {
+    ze_command_queue_desc_t cmdQueueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+    cmdQueueDesc.ordinal = getCommandQueueOrdinal(device);
+    cmdQueueDesc.index = 0;
+    cmdQueueDesc.mode = ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS;
+    ze_command_list_handle_t cmdList;
+    SUCCESS_OR_TERMINATE(zeCommandListCreateImmediate(context, device, &cmdQueueDesc, &cmdList));
+
+    ze_group_count_t dispatchTraits{1u, 1u, 1u};
+    // warm up
+    SUCCESS_OR_TERMINATE(zeCommandListAppendLaunchKernel(cmdList, kernel, &dispatchTraits, nullptr, 0, nullptr));
+
+    std::vector<double> samples;
+    samples.reserve(iterations);
+    for (uint32_t i = 0; i < iterations; i++) {
+        auto start = Clock::now();
+        SUCCESS_OR_TERMINATE(zeCommandListAppendLaunchKernel(cmdList, kernel, &dispatchTraits, nullptr, 0, nullptr));
+        auto end = Clock::now();
+        samples.push_back(elapsedUs(start, end));
+    }
+
+    SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+    return summarize("immediate_empty_kernel_launch", "us", samples);
+}
+
+// Host time of submitting a closed command list with one empty kernel and waiting for its completion
+BenchmarkResult benchmarkExecuteCommandLists(ze_context_handle_t &context, ze_device_handle_t &device, ze_kernel_handle_t kernel, uint32_t iterations) {
+    ze_command_queue_desc_t cmdQueueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+    cmdQueueDesc.ordinal = getCommandQueueOrdinal(device);
+    cmdQueueDesc.index = 0;
+    cmdQueueDesc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+    ze_command_queue_handle_t cmdQueue;
+    SUCCESS_OR_TERMINATE(zeCommandQueueCreate(context, device, &cmdQueueDesc, &cmdQueue));
+    ze_command_list_handle_t cmdList;
+    SUCCESS_OR_TERMINATE(createCommandList(context, device, cmdList));
+
+    ze_group_count_t dispatchTraits{1u, 1u, 1u};
+    SUCCESS_OR_TERMINATE(zeCommandListAppendLaunchKernel(cmdList, kernel, &dispatchTraits, nullptr, 0, nullptr));
+    SUCCESS_OR_TERMINATE(zeCommandListClose(cmdList));
+
+    // warm up
+    SUCCESS_OR_TERMINATE(zeCommandQueueExecuteCommandLists(cmdQueue, 1, &cmdList, nullptr));
+    SUCCESS_OR_TERMINATE(zeCommandQueueSynchronize(cmdQueue, std::numeric_limits<uint64_t>::max()));
+
+    std::vector<double> samples;
+    samples.reserve(iterations);
+    for (uint32_t i = 0; i < iterations; i++) {
+        auto start = Clock::now();
+        SUCCESS_OR_TERMINATE(zeCommandQueueExecuteCommandLists(cmdQueue, 1, &cmdList, nullptr));
+        SUCCESS_OR_TERMINATE(zeCommandQueueSynchronize(cmdQueue, std::numeric_limits<uint64_t>::max()));
+        auto end = Clock::now();
+        samples.push_back(elapsedUs(start, end));
+    }
+
+    SUCCESS_OR_TERMINATE(zeCommandListDestroy(cmdList));
+    SUCCESS_OR_TERMINATE(zeCommandQueueDestroy(cmdQueue));
+    return summarize("execute_command_lists_and_synchronize", "us", samples);
+}
+
+// Host time between signaling an event from the host and observing it signaled
+BenchmarkResult benchmarkEventHostSignalToWait(ze_context_handle_t &context, ze_device_handle_t &device, uint32_t iterations) {
+    ze_event_pool_handle_t eventPool;
+    ze_event_handle_t event;
+    createEventPoolAndEvents(context, device, eventPool,
+                             (ze_event_pool_flag_t)(ZE_EVENT_POOL_FLAG_HOST_VISIBLE),
+                             1, &event,
+                             ZE_EVENT_SCOPE_FLAG_HOST,
+                             ZE_EVENT_SCOPE_FLAG_HOST);
+
+    std::vector<double> samples;
+    samples.reserve(iterations);
+    for (uint32_t i = 0; i < iterations; i++) {
+        auto start = Clock::now();
+        SUCCESS_OR_TERMINATE(zeEventHostSignal(event));
+        SUCCESS_OR_TERMINATE(zeEventHostSynchronize(event, std::numeric_limits<uint64_t>::max()));
+        auto end = Clock::now();
+        samples.push_back(elapsedUs(start, end));
+        SUCCESS_OR_TERMINATE(zeEventHostReset(event));
+    }
+
+    SUCCESS_OR_TERMINATE(zeEventDestroy(event));
+    SUCCESS_OR_TERMINATE(zeEventPoolDestroy(eventPool));
+    return summarize("event_host_signal_to_wait", "us", samples);
+}
+
+std::string toJson(const ze_device_properties_t &deviceProperties, const std::vector<BenchmarkResult> &results) {
+    std::ostringstream json;
+    json << "{\n";
+    json << "  \"device\": \"" << deviceProperties.name << "\",\n";
+    json << "  \"benchmarks\": [\n";
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto &result = results[i];
+        json << "    {\"name\": \"" << result.name << "\", \"unit\": \"" << result.unit << "\", \"iterations\": " << result.iterations
+             << ", \"min\": " << result.min << ", \"median\": " << result.median << ", \"mean\": " << result.mean << ", \"max\": " << result.max << "}"
+             << ((i + 1 < results.size()) ? "," : "") << "\n";
+    }
+    json << "  ]\n";
+    json << "}\n";
+    return json.str();
+}
+
+int main(int argc, char *argv[]) {
+    verbose = isVerbose(argc, argv);
+    uint32_t iterations = static_cast<uint32_t>(std::max(1, getParamValue(argc, argv, "-i", "--iterations", 1000)));
+
+    std::string outputFile;
+    for (int i = 1; i + 1 < argc; i++) {
+        if ((0 == strcmp(argv[i], "-o")) || (0 == strcmp(argv[i], "--output"))) {
+            outputFile = argv[i + 1];
+        }
+    }
+
+    ze_context_handle_t context = nullptr;
+    auto devices = zelloInitContextAndGetDevices(context);
+    auto device = devices[0];
+
+    ze_device_properties_t deviceProperties = {ZE_STRUCTURE_TYPE_DEVICE_PROPERTIES};
+    SUCCESS_OR_TERMINATE(zeDeviceGetProperties(device, &deviceProperties));
+    printDeviceProperties(deviceProperties);
+
+    ze_module_handle_t module = nullptr;
+    ze_kernel_handle_t kernel = nullptr;
+    createEmptyKernel(context, device, module, kernel);
+
+    std::vector<BenchmarkResult> results;
+    results.push_back(benchmarkImmediateEmptyKernelLaunch(context, device, kernel, iterations));
+    results.push_back(benchmarkExecuteCommandLists(context, device, kernel, iterations));
+    results.push_back(benchmarkEventHostSignalToWait(context, device, iterations));
+
+    SUCCESS_OR_TERMINATE(zeKernelDestroy(kernel));
+    SUCCESS_OR_TERMINATE(zeModuleDestroy(module));
+    SUCCESS_OR_TERMINATE(zeContextDestroy(context));
+
+    auto json = toJson(deviceProperties, results);
+    if (outputFile.empty()) {
+        std::cout << json;
+    } else {
+        std::ofstream out(outputFile);
+        out << json;
+    }
+    return 0;
+}
@@ -200,6 +200,14 @@ struct MockCommandList : public CommandList {
                       uint32_t numWaitEvents,
                       ze_event_handle_t *phWaitEvents));
 
+    ADDMETHOD_NOBASE(appendLaunchMultipleKernels, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint32_t numKernels,
+                      const ze_kernel_handle_t *kernelHandles,
+                      const ze_group_count_t *pLaunchFuncArgs,
+                      ze_event_handle_t hEvent,
+                      uint32_t numWaitEvents,
+                      ze_event_handle_t *phWaitEvents));
+
     ADDMETHOD_NOBASE(appendEventReset, ze_result_t, ZE_RESULT_SUCCESS,
                      (ze_event_handle_t hEvent));
 
@@ -268,6 +276,13 @@ struct MockCommandList : public CommandList {
                       size_t size,
                       bool flushHost));
 
+    ADDMETHOD_NOBASE(appendPageFaultCopyRange, ze_result_t, ZE_RESULT_SUCCESS,
+                     (NEO::GraphicsAllocation * dstptr,
+                      NEO::GraphicsAllocation *srcptr,
+                      size_t offset,
+                      size_t size,
+                      bool flushHost));
+
     ADDMETHOD_NOBASE(appendMemoryCopyRegion, ze_result_t, ZE_RESULT_SUCCESS,
                      (void *dstptr,
                       const ze_copy_region_t *dstRegion,
@@ -331,6 +346,11 @@ struct MockCommandList : public CommandList {
 
     ADDMETHOD_NOBASE(reset, ze_result_t, ZE_RESULT_SUCCESS, ());
 
+    ADDMETHOD_NOBASE(updateKernelLaunch, ze_result_t, ZE_RESULT_SUCCESS,
+                     (uint32_t launchIndex,
+                      ze_kernel_handle_t hKernel,
+                      const ze_group_count_t *threadGroupDimensions));
+
     ADDMETHOD_NOBASE(appendMetricMemoryBarrier, ze_result_t, ZE_RESULT_SUCCESS, ());
 
     ADDMETHOD_NOBASE(appendMetricStreamerMarker, ze_result_t, ZE_RESULT_SUCCESS,
@@ -477,6 +497,7 @@ class MockCommandListImmediateHw : public WhiteBox<::L0::CommandListCoreFamilyIm
   public:
     using BaseClass = WhiteBox<::L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>;
     MockCommandListImmediateHw() : BaseClass() {}
+    using BaseClass::appendMutex;
     using BaseClass::applyMemoryRangesBarrier;
     using BaseClass::barrierCalled;
     using BaseClass::isFlushTaskSubmissionEnabled;
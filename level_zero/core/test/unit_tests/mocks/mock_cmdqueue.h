@@ -27,6 +27,7 @@ struct WhiteBox<::L0::CommandQueue> : public ::L0::CommandQueueImp {
     using BaseClass::commandStream;
     using BaseClass::csr;
     using BaseClass::device;
+    using BaseClass::fencePool;
     using BaseClass::preemptionCmdSyncProgramming;
     using BaseClass::printfKernelContainer;
     using BaseClass::submitBatchBuffer;
@@ -65,6 +66,7 @@ struct MockCommandQueueHw : public L0::CommandQueueHw<gfxCoreFamily> {
     using BaseClass::commandStream;
     using BaseClass::prepareAndSubmitBatchBuffer;
     using BaseClass::printfKernelContainer;
+    using BaseClass::submitAggregatedSubmissions;
     using L0::CommandQueue::activeSubDevices;
     using L0::CommandQueue::frontEndStateTracking;
     using L0::CommandQueue::internalUsage;
@@ -92,10 +94,12 @@ struct MockCommandQueueHw : public L0::CommandQueueHw<gfxCoreFamily> {
 
     NEO::SubmissionStatus submitBatchBuffer(size_t offset, NEO::ResidencyContainer &residencyContainer, void *endingCmdPtr, bool isCooperative) override {
         residencyContainerSnapshot = residencyContainer;
+        submitBatchBufferCalled++;
         return BaseClass::submitBatchBuffer(offset, residencyContainer, endingCmdPtr, isCooperative);
     }
 
     uint32_t synchronizedCalled = 0;
+    uint32_t submitBatchBufferCalled = 0;
     NEO::ResidencyContainer residencyContainerSnapshot;
     ze_result_t synchronizeReturnValue{ZE_RESULT_SUCCESS};
     std::optional<NEO::WaitStatus> reserveLinearStreamSizeReturnValue{};
@@ -61,6 +61,8 @@ struct Mock<EventPool> : public EventPool {
     ADDMETHOD_NOBASE(createEvent, ze_result_t, ZE_RESULT_SUCCESS, (const ze_event_desc_t *desc, ze_event_handle_t *phEvent));
     ADDMETHOD_NOBASE(getDevice, Device *, nullptr, ());
     ADDMETHOD_NOBASE(getEventSize, uint32_t, 0u, ());
+    ADDMETHOD_NOBASE(hostResetEvents, ze_result_t, ZE_RESULT_SUCCESS, ());
+    ADDMETHOD_NOBASE(hostSignalEvents, ze_result_t, ZE_RESULT_SUCCESS, ());
 
     using EventPool::eventPoolAllocations;
 };
@@ -23,11 +23,14 @@ struct WhiteBox<::L0::Module> : public ::L0::ModuleImp {
     using BaseClass::BaseClass;
     using BaseClass::builtFromSPIRv;
     using BaseClass::copyPatchedSegments;
+    using BaseClass::deduplicatedIsaAllocations;
     using BaseClass::device;
     using BaseClass::exportedFunctionsSurface;
+    using BaseClass::getKernelsInitializationThreadsCount;
     using BaseClass::importedSymbolAllocations;
     using BaseClass::isFullyLinked;
     using BaseClass::kernelImmDatas;
+    using BaseClass::kernelsIsaParentAllocation;
     using BaseClass::maxGroupSize;
     using BaseClass::symbols;
     using BaseClass::translationUnit;
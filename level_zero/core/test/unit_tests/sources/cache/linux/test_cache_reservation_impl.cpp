@@ -5,6 +5,11 @@
  *
  */
 
+#include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/os_interface/os_interface.h"
+#include "shared/test/common/libult/linux/drm_query_mock.h"
+#include "shared/test/common/os_interface/linux/drm_mock_cache_info.h"
 #include "shared/test/common/test_macros/test.h"
 
 #include "level_zero/core/source/cache/linux/cache_reservation_impl.h"
@@ -52,5 +57,62 @@ TEST_F(CacheReservationTest, GivenCacheReservationCreatedWhenCallingSetCacheAdvi
 TEST_F(CacheReservationTest, GivenCacheReservationCreatedWhenCallingGetMaxCacheReservationSizeThenReturnZero) {
     EXPECT_EQ(0u, cache->getMaxCacheReservationSize());
 }
+
+class CacheReservationWithCacheInfoFixture : public DeviceFixture {
+  public:
+    void setUp() {
+        DeviceFixture::setUp();
+        auto &rootDeviceEnvironment = *neoDevice->executionEnvironment->rootDeviceEnvironments[0];
+        drm = new DrmQueryMock(rootDeviceEnvironment);
+        mockCacheInfo = new MockCacheInfo(*drm, 32 * MemoryConstants::kiloByte, 2, 32);
+        drm->cacheInfo.reset(mockCacheInfo);
+        rootDeviceEnvironment.osInterface.reset(new OSInterface());
+        rootDeviceEnvironment.osInterface->setDriverModel(std::unique_ptr<DriverModel>(drm));
+        cache = std::make_unique<CacheReservationImpl>(*device);
+    }
+    void tearDown() {
+        cache.reset();
+        DeviceFixture::tearDown();
+    }
+    DrmQueryMock *drm = nullptr;
+    MockCacheInfo *mockCacheInfo = nullptr;
+    std::unique_ptr<CacheReservationImpl> cache;
+};
+
+using CacheReservationWithCacheInfoTest = Test<CacheReservationWithCacheInfoFixture>;
+
+TEST_F(CacheReservationWithCacheInfoTest, GivenCacheInfoWhenCallingGetMaxCacheReservationSizeThenReturnMaxReservationCacheSize) {
+    EXPECT_EQ(mockCacheInfo->getMaxReservationCacheSize(), cache->getMaxCacheReservationSize());
+}
+
+TEST_F(CacheReservationWithCacheInfoTest, GivenCacheInfoWhenReservingL3CacheThenRegionIsReservedAndPreviousReservationIsReleased) {
+    EXPECT_FALSE(cache->reserveCache(2, MemoryConstants::kiloByte));
+    EXPECT_FALSE(cache->reserveCache(3, 2 * mockCacheInfo->getMaxReservationCacheSize()));
+    EXPECT_TRUE(mockCacheInfo->cacheRegionsReserved.empty());
+
+    EXPECT_TRUE(cache->reserveCache(3, MemoryConstants::kiloByte));
+    ASSERT_EQ(1u, mockCacheInfo->cacheRegionsReserved.size());
+    EXPECT_EQ(CacheRegion::Region1, mockCacheInfo->cacheRegionsReserved.begin()->first);
+
+    EXPECT_TRUE(cache->reserveCache(3, 2 * MemoryConstants::kiloByte));
+    ASSERT_EQ(1u, mockCacheInfo->cacheRegionsReserved.size());
+    EXPECT_EQ(2 * MemoryConstants::kiloByte, mockCacheInfo->cacheRegionsReserved.begin()->second);
+
+    EXPECT_TRUE(cache->reserveCache(3, 0));
+    EXPECT_TRUE(mockCacheInfo->cacheRegionsReserved.empty());
+}
+
+TEST_F(CacheReservationWithCacheInfoTest, GivenNoReservedRegionWhenSettingReservedRegionCacheAdviceThenReturnFalse) {
+    int data = 0;
+    EXPECT_FALSE(cache->setCacheAdvice(&data, sizeof(data), ze_cache_ext_region_t::ZE_CACHE_EXT_REGION_ZE_CACHE_RESERVE_REGION));
+}
+
+TEST_F(CacheReservationWithCacheInfoTest, GivenPointerNotFromUsmWhenSettingCacheAdviceThenReturnFalse) {
+    int data = 0;
+    EXPECT_TRUE(cache->reserveCache(3, MemoryConstants::kiloByte));
+    EXPECT_FALSE(cache->setCacheAdvice(&data, sizeof(data), ze_cache_ext_region_t::ZE_CACHE_EXT_REGION_ZE_CACHE_RESERVE_REGION));
+    EXPECT_FALSE(cache->setCacheAdvice(&data, sizeof(data), ze_cache_ext_region_t::ZE_CACHE_EXT_REGION_ZE_CACHE_NON_RESERVED_REGION));
+}
+
 } // namespace ult
 } // namespace L0
@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_command_stream_receiver.h"
 #include "shared/test/common/mocks/ult_device_factory.h"
 #include "shared/test/common/test_macros/hw_test.h"
@@ -15,6 +16,8 @@
 #include "level_zero/core/test/unit_tests/mocks/mock_image.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_kernel.h"
 
+#include <thread>
+
 namespace L0 {
 namespace ult {
 
@@ -295,6 +298,49 @@ HWTEST2_F(CommandListTest, givenImmediateCommandListWhenAppendMemoryRangesBarrie
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+struct AppendOwnershipCheckingCommandListImmediateHw : public MockCommandListImmediateHw<gfxCoreFamily> {
+    ze_result_t executeCommandListImmediateWithFlushTask(bool performMigration) override {
+        std::thread([this]() {
+            appendOwnershipHeldDuringFlush = !this->appendMutex.try_lock();
+            if (!appendOwnershipHeldDuringFlush) {
+                this->appendMutex.unlock();
+            }
+        }).join();
+        return MockCommandListImmediateHw<gfxCoreFamily>::executeCommandListImmediateWithFlushTask(performMigration);
+    }
+
+    bool appendOwnershipHeldDuringFlush = false;
+};
+
+HWTEST2_F(CommandListTest, givenThreadSafeImmediateCommandListWhenAppendingThenAppendOwnershipIsHeldUntilFlushIsDone, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.EnableThreadSafeImmediateCommandList.set(1);
+
+    AppendOwnershipCheckingCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdListType = CommandList::CommandListType::TYPE_IMMEDIATE;
+    cmdList.initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendBarrier(nullptr, 0, nullptr));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_TRUE(cmdList.appendOwnershipHeldDuringFlush);
+
+    EXPECT_TRUE(cmdList.appendMutex.try_lock());
+    cmdList.appendMutex.unlock();
+}
+
+HWTEST2_F(CommandListTest, givenThreadSafeImmediateCommandListDisabledWhenAppendingThenAppendOwnershipIsNotTaken, IsAtLeastSkl) {
+    AppendOwnershipCheckingCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.isFlushTaskSubmissionEnabled = true;
+    cmdList.cmdListType = CommandList::CommandListType::TYPE_IMMEDIATE;
+    cmdList.initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendBarrier(nullptr, 0, nullptr));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_FALSE(cmdList.appendOwnershipHeldDuringFlush);
+}
+
 HWTEST2_F(CommandListTest,
           givenComputeCommandListAnd2dRegionWhenMemoryCopyRegionInExternalHostAllocationCalledThenBuiltinFlagAndDestinationAllocSystemIsSet, IsAtLeastSkl) {
     auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
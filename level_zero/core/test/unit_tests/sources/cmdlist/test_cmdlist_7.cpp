@@ -5,8 +5,10 @@
  *
  */
 
+#include "shared/source/memory_manager/staging_buffer_manager.h"
 #include "shared/source/os_interface/hw_info_config.h"
 #include "shared/test/common/cmd_parse/hw_parse.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
 #include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/ult_device_factory.h"
@@ -195,6 +197,67 @@ TEST_F(CommandListCreate, givenRootDeviceAndImplicitScalingDisabledWhenCreatingC
     L0::CommandList::fromHandle(commandList)->destroy();
 }
 
+HWTEST2_F(CommandListCreate, givenImmediateCommandListUsesFlushTaskWhenAppendingWithCounterBasedSignalEventThenEventIsAssignedCsrTaskCount, IsAtLeastSkl) {
+    auto commandList = std::make_unique<WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>>();
+    ASSERT_NE(nullptr, commandList);
+    commandList->isFlushTaskSubmissionEnabled = true;
+    ze_result_t ret = commandList->initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, ret);
+    commandList->device = device;
+    commandList->cmdListType = CommandList::CommandListType::TYPE_IMMEDIATE;
+    commandList->csr = device->getNEODevice()->getDefaultEngine().commandStreamReceiver;
+
+    auto event = std::unique_ptr<CounterBasedEvent>(CounterBasedEvent::create(device));
+    NEO::CommandStreamReceiver *completionCsr = nullptr;
+    uint32_t completionTaskCount = 0u;
+    EXPECT_FALSE(event->getCompletionState(completionCsr, completionTaskCount));
+
+    auto taskCountBefore = commandList->csr->peekTaskCount();
+    ret = commandList->appendBarrier(event->toHandle(), 0, nullptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, ret);
+    EXPECT_LT(taskCountBefore, commandList->csr->peekTaskCount());
+
+    EXPECT_TRUE(event->getCompletionState(completionCsr, completionTaskCount));
+    EXPECT_EQ(commandList->csr, completionCsr);
+    EXPECT_EQ(commandList->csr->peekTaskCount(), completionTaskCount);
+
+    event->assignTaskCount(nullptr, 0u);
+    ret = commandList->appendSignalEvent(event->toHandle());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, ret);
+    EXPECT_TRUE(event->getCompletionState(completionCsr, completionTaskCount));
+    EXPECT_EQ(commandList->csr->peekTaskCount(), completionTaskCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendEventReset(event->toHandle()));
+}
+
+HWTEST2_F(CommandListCreate, givenStagingBufferManagerWhenImmediateCommandListCopiesFromPageableHostMemoryThenCopyIsSubmittedInStagingChunks, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.StagingBufferSize.set(4);
+    driverHandle->stagingBufferManager = std::make_unique<NEO::StagingBufferManager>(driverHandle->svmAllocsManager, driverHandle->rootDeviceIndices, driverHandle->deviceBitfields);
+    auto chunkSize = driverHandle->stagingBufferManager->getChunkSize();
+
+    auto commandList = std::make_unique<WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>>();
+    ASSERT_NE(nullptr, commandList);
+    commandList->isFlushTaskSubmissionEnabled = true;
+    ze_result_t ret = commandList->initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, ret);
+    commandList->device = device;
+    commandList->cmdListType = CommandList::CommandListType::TYPE_IMMEDIATE;
+    commandList->csr = device->getNEODevice()->getDefaultEngine().commandStreamReceiver;
+
+    std::vector<uint8_t> srcMemory(2 * chunkSize);
+    std::vector<uint8_t> dstMemory(2 * chunkSize);
+
+    auto taskCountBefore = commandList->csr->peekTaskCount();
+    ret = commandList->appendMemoryCopy(dstMemory.data(), srcMemory.data(), 2 * chunkSize, nullptr, 0, nullptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, ret);
+    EXPECT_EQ(taskCountBefore + 2, commandList->csr->peekTaskCount());
+
+    taskCountBefore = commandList->csr->peekTaskCount();
+    ret = commandList->appendMemoryCopy(dstMemory.data(), srcMemory.data(), chunkSize, nullptr, 0, nullptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, ret);
+    EXPECT_EQ(taskCountBefore + 1, commandList->csr->peekTaskCount());
+}
+
 using SingleTileOnlyPlatforms = IsWithinGfxCore<IGFX_GEN9_CORE, IGFX_GEN12LP_CORE>;
 HWTEST2_F(CommandListCreate, givenSingleTileOnlyPlatformsWhenProgrammingMultiTileBarrierThenNoProgrammingIsExpected, SingleTileOnlyPlatforms) {
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
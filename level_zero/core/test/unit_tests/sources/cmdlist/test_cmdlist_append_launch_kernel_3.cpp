@@ -15,6 +15,7 @@
 #include "shared/test/common/helpers/unit_test_helper.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include "level_zero/api/driver_experimental/public/zex_api.h"
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
 #include "level_zero/core/source/event/event.h"
 #include "level_zero/core/test/unit_tests/fixtures/module_fixture.h"
@@ -154,6 +155,89 @@ HWCMDTEST_F(IGFX_GEN8_CORE, CommandListAppendLaunchKernel, givenAppendLaunchMult
     context->freeMem(reinterpret_cast<void *>(numLaunchArgs));
 }
 
+HWTEST_F(CommandListAppendLaunchKernel, givenLaunchCountAtOffsetInAllocationWhenAppendLaunchMultipleKernelsIndirectThenCountIsLoadedFromItsAddress) {
+    createKernel();
+
+    using MI_LOAD_REGISTER_MEM = typename FamilyType::MI_LOAD_REGISTER_MEM;
+    ze_result_t returnValue;
+    auto commandList = std::unique_ptr<L0::CommandList>(L0::CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue));
+    const ze_kernel_handle_t launchKernels = kernel->toHandle();
+    uint32_t *launchCountsAllocation;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    auto result = context->allocDeviceMem(
+        device->toHandle(), &deviceDesc, 16384u, 4096u, reinterpret_cast<void **>(&launchCountsAllocation));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto numLaunchArgs = launchCountsAllocation + 4;
+
+    result = commandList->appendLaunchMultipleKernelsIndirect(1, &launchKernels, numLaunchArgs, nullptr, nullptr, 0, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(
+        cmdList, commandList->commandContainer.getCommandStream()->getCpuBase(), commandList->commandContainer.getCommandStream()->getUsed()));
+    auto itorLrm = find<MI_LOAD_REGISTER_MEM *>(cmdList.begin(), cmdList.end());
+    ASSERT_NE(cmdList.end(), itorLrm);
+
+    auto lrm = genCmdCast<MI_LOAD_REGISTER_MEM *>(*itorLrm);
+    EXPECT_EQ(CS_GPR_R0, lrm->getRegisterAddress());
+    EXPECT_EQ(reinterpret_cast<uint64_t>(numLaunchArgs), lrm->getMemoryAddress());
+    context->freeMem(reinterpret_cast<void *>(launchCountsAllocation));
+}
+
+HWTEST_F(CommandListAppendLaunchKernel, givenLaunchCountNotInUsmAllocationWhenAppendLaunchMultipleKernelsIndirectThenInvalidArgumentIsReturned) {
+    createKernel();
+
+    ze_result_t returnValue;
+    auto commandList = std::unique_ptr<L0::CommandList>(L0::CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue));
+    const ze_kernel_handle_t launchKernels = kernel->toHandle();
+    uint32_t numLaunchArgs = 1;
+
+    auto result = commandList->appendLaunchMultipleKernelsIndirect(1, &launchKernels, &numLaunchArgs, nullptr, nullptr, 0, nullptr);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, result);
+}
+
+HWCMDTEST_F(IGFX_GEN8_CORE, CommandListAppendLaunchKernel, givenConditionInUsmWhenAppendConditionalLaunchKernelThenConditionIsLoadedAndWalkerIsPredicated) {
+    createKernel();
+
+    using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
+    using MI_LOAD_REGISTER_MEM = typename FamilyType::MI_LOAD_REGISTER_MEM;
+    ze_result_t returnValue;
+    auto commandList = std::unique_ptr<L0::CommandList>(L0::CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue));
+    uint32_t *condition;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    auto result = context->allocDeviceMem(
+        device->toHandle(), &deviceDesc, 4096u, 4096u, reinterpret_cast<void **>(&condition));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    ze_group_count_t groupCount{1, 1, 1};
+
+    result = commandList->appendConditionalLaunchKernel(kernel->toHandle(), &groupCount, condition, nullptr, 0, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(
+        cmdList, commandList->commandContainer.getCommandStream()->getCpuBase(), commandList->commandContainer.getCommandStream()->getUsed()));
+    auto itorLrm = find<MI_LOAD_REGISTER_MEM *>(cmdList.begin(), cmdList.end());
+    ASSERT_NE(cmdList.end(), itorLrm);
+    EXPECT_EQ(reinterpret_cast<uint64_t>(condition), genCmdCast<MI_LOAD_REGISTER_MEM *>(*itorLrm)->getMemoryAddress());
+
+    auto itorWalker = find<GPGPU_WALKER *>(itorLrm, cmdList.end());
+    ASSERT_NE(cmdList.end(), itorWalker);
+    EXPECT_TRUE(genCmdCast<GPGPU_WALKER *>(*itorWalker)->getPredicateEnable());
+    context->freeMem(reinterpret_cast<void *>(condition));
+}
+
+HWTEST_F(CommandListAppendLaunchKernel, givenConditionNotInUsmWhenAppendConditionalLaunchKernelThenInvalidArgumentIsReturned) {
+    createKernel();
+
+    ze_result_t returnValue;
+    auto commandList = std::unique_ptr<L0::CommandList>(L0::CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue));
+    uint32_t condition = 1;
+    ze_group_count_t groupCount{1, 1, 1};
+
+    auto result = commandList->appendConditionalLaunchKernel(kernel->toHandle(), &groupCount, &condition, nullptr, 0, nullptr);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, result);
+}
+
 HWCMDTEST_F(IGFX_GEN8_CORE, CommandListAppendLaunchKernel, givenAppendLaunchMultipleKernelsThenUsesMathAndWalker) {
     createKernel();
 
@@ -218,6 +302,78 @@ HWTEST2_F(CommandListAppendLaunchKernel, givenImmediateCommandListWhenAppendingL
     ASSERT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+HWTEST2_F(CommandListAppendLaunchKernel, givenImmediateCommandListInGraphCaptureWhenAppendingLaunchKernelThenKernelIsRecordedIntoGraphAndSubmittedOnAppendGraph, IsAtLeastSkl) {
+    createKernel();
+
+    const ze_command_queue_desc_t desc = {};
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               device,
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::RenderCompute,
+                                                                               result));
+    ASSERT_NE(nullptr, commandList0);
+    auto csr = reinterpret_cast<CommandQueueImp *>(commandList0->cmdQImmediate)->getCsr();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListBeginGraphCapture(commandList0->toHandle()));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexCommandListBeginGraphCapture(commandList0->toHandle()));
+
+    auto taskCountBeforeCapture = csr->peekTaskCount();
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    result = commandList0->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, launchParams);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    result = commandList0->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, launchParams);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(taskCountBeforeCapture, csr->peekTaskCount());
+
+    ze_command_list_handle_t hGraph = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListEndGraphCapture(commandList0->toHandle(), &hGraph));
+    ASSERT_NE(nullptr, hGraph);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexCommandListEndGraphCapture(commandList0->toHandle(), &hGraph));
+
+    auto graph = CommandList::fromHandle(hGraph);
+    EXPECT_EQ(static_cast<uint32_t>(CommandList::CommandListType::TYPE_REGULAR), graph->cmdListType);
+    EXPECT_EQ(2u, graph->getKernelLaunchesToPatch().size());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListAppendGraph(commandList0->toHandle(), hGraph));
+    EXPECT_LT(taskCountBeforeCapture, csr->peekTaskCount());
+
+    graph->destroy();
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenRegularCommandListWhenGraphCaptureIsUsedThenUnsupportedFeatureIsReturned, IsAtLeastSkl) {
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(L0::CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, returnValue);
+
+    ze_command_list_handle_t hGraph = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, zexCommandListBeginGraphCapture(commandList->toHandle()));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, zexCommandListEndGraphCapture(commandList->toHandle(), &hGraph));
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, zexCommandListAppendGraph(commandList->toHandle(), hGraph));
+}
+
+HWTEST2_F(CommandListAppendLaunchKernel, givenImmediateCommandListInGraphCaptureWhenDestroyedOrAppendingGraphThenCaptureIsReleasedAndErrorIsReturned, IsAtLeastSkl) {
+    const ze_command_queue_desc_t desc = {};
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::CommandList> commandList0(CommandList::createImmediate(productFamily,
+                                                                               device,
+                                                                               &desc,
+                                                                               false,
+                                                                               NEO::EngineGroupType::RenderCompute,
+                                                                               result));
+    ASSERT_NE(nullptr, commandList0);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> regularCommandList(L0::CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue));
+    regularCommandList->close();
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexCommandListAppendGraph(commandList0->toHandle(), commandList0->toHandle()));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListBeginGraphCapture(commandList0->toHandle()));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexCommandListAppendGraph(commandList0->toHandle(), regularCommandList->toHandle()));
+}
+
 HWTEST2_F(CommandListAppendLaunchKernel, givenImmediateCommandListWhenAppendingLaunchKernelWithInvalidEventThenInvalidArgumentErrorIsReturned, IsAtLeastSkl) {
     createKernel();
 
@@ -525,6 +681,110 @@ HWTEST_F(CommandListAppendLaunchKernel, givenInvalidKernelWhenAppendingThenRetur
     EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, returnValue);
 }
 
+HWTEST_F(CommandListAppendLaunchKernel, givenRegularCommandListWhenKernelIsAppendedThenKernelLaunchCanBeUpdatedInPlace) {
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+
+    Mock<::L0::Kernel> kernel;
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(L0::CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, returnValue);
+
+    ze_group_count_t groupCount{8, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    returnValue = commandList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0U, nullptr, launchParams);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, returnValue);
+    commandList->close();
+
+    auto &kernelLaunches = commandList->getKernelLaunchesToPatch();
+    ASSERT_EQ(1u, kernelLaunches.size());
+    EXPECT_EQ(&kernel, kernelLaunches[0].kernel);
+    ASSERT_NE(nullptr, kernelLaunches[0].walker);
+
+    ze_group_count_t newGroupCount{4, 2, 3};
+    returnValue = zexCommandListUpdateKernelLaunch(commandList->toHandle(), 0u, kernel.toHandle(), &newGroupCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, returnValue);
+
+    auto walker = reinterpret_cast<WALKER_TYPE *>(kernelLaunches[0].walker);
+    EXPECT_EQ(4u, walker->getThreadGroupIdXDimension());
+    EXPECT_EQ(2u, walker->getThreadGroupIdYDimension());
+    EXPECT_EQ(3u, walker->getThreadGroupIdZDimension());
+
+    commandList->reset();
+    EXPECT_TRUE(commandList->getKernelLaunchesToPatch().empty());
+}
+
+HWTEST_F(CommandListAppendLaunchKernel, givenInvalidLaunchIndexOrDifferentKernelWhenUpdatingKernelLaunchThenErrorInvalidArgumentIsReturned) {
+    Mock<::L0::Kernel> kernel;
+    Mock<::L0::Kernel> otherKernel;
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(L0::CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, returnValue);
+
+    ze_group_count_t groupCount{8, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    returnValue = commandList->appendLaunchKernel(kernel.toHandle(), &groupCount, nullptr, 0U, nullptr, launchParams);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, returnValue);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateKernelLaunch(1u, kernel.toHandle(), &groupCount));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateKernelLaunch(0u, otherKernel.toHandle(), &groupCount));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateKernelLaunch(0u, kernel.toHandle(), nullptr));
+
+    kernel.groupSize[0] *= 2;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateKernelLaunch(0u, kernel.toHandle(), &groupCount));
+}
+
+HWTEST_F(CommandListAppendLaunchKernel, givenMultipleKernelsWhenAppendLaunchMultipleKernelsIsCalledThenWalkerIsProgrammedForEachKernel) {
+    using WALKER_TYPE = typename FamilyType::WALKER_TYPE;
+
+    Mock<::L0::Kernel> kernel;
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(L0::CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, returnValue);
+
+    auto commandStream = commandList->commandContainer.getCommandStream();
+    auto usedBefore = commandStream->getUsed();
+
+    ze_kernel_handle_t kernelHandles[3] = {kernel.toHandle(), kernel.toHandle(), kernel.toHandle()};
+    ze_group_count_t groupCounts[3] = {{1, 1, 1}, {2, 1, 1}, {3, 1, 1}};
+    returnValue = zexCommandListAppendLaunchMultipleKernels(commandList->toHandle(), 3u, kernelHandles, groupCounts, nullptr, 0u, nullptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, returnValue);
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(cmdList, ptrOffset(commandStream->getCpuBase(), usedBefore), commandStream->getUsed() - usedBefore));
+    auto walkers = findAll<WALKER_TYPE *>(cmdList.begin(), cmdList.end());
+    ASSERT_EQ(3u, walkers.size());
+    for (uint32_t i = 0; i < 3u; i++) {
+        auto walker = genCmdCast<WALKER_TYPE *>(*walkers[i]);
+        EXPECT_EQ(groupCounts[i].groupCountX, walker->getThreadGroupIdXDimension());
+    }
+    EXPECT_EQ(3u, commandList->getKernelLaunchesToPatch().size());
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, commandList->appendLaunchMultipleKernels(1u, nullptr, groupCounts, nullptr, 0u, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, commandList->appendLaunchMultipleKernels(1u, kernelHandles, nullptr, nullptr, 0u, nullptr));
+}
+
+HWTEST_F(CommandListAppendLaunchKernel, givenIndirectLaunchWhenUpdatingKernelLaunchThenErrorUnsupportedFeatureIsReturned) {
+    Mock<::L0::Kernel> kernel;
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(L0::CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, returnValue);
+
+    void *alloc = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    auto result = context->allocDeviceMem(device->toHandle(), &deviceDesc, 16384u, 4096u, &alloc);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    returnValue = commandList->appendLaunchKernelIndirect(kernel.toHandle(), static_cast<ze_group_count_t *>(alloc), nullptr, 0, nullptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, returnValue);
+
+    ASSERT_EQ(1u, commandList->getKernelLaunchesToPatch().size());
+    EXPECT_EQ(nullptr, commandList->getKernelLaunchesToPatch()[0].walker);
+
+    ze_group_count_t groupCount{8, 1, 1};
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->updateKernelLaunch(0u, kernel.toHandle(), &groupCount));
+    context->freeMem(alloc);
+}
+
 struct CommandListAppendLaunchKernelWithImplicitArgs : CommandListAppendLaunchKernel {
     template <typename FamilyType>
     uint64_t getIndirectHeapOffsetForImplicitArgsBuffer(const Mock<::L0::Kernel> &kernel) {
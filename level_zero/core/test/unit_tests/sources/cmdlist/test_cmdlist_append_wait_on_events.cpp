@@ -8,6 +8,7 @@
 #include "shared/source/command_container/command_encoder.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
+#include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
@@ -386,6 +387,42 @@ HWTEST_F(CommandListAppendWaitOnEvent, givenCommandBufferIsEmptyWhenAppendingWai
     EXPECT_EQ(1u, semaphoreWaitsFound);
 }
 
+HWTEST_F(CommandListAppendWaitOnEvent, givenCounterBasedEventWhenAppendingWaitOnEventThenSemaphoreWaitsForTaskCountOnCsrTag) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+
+    auto &csr = neoDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.latestFlushedTaskCount = 10u;
+
+    auto counterBasedEvent = std::unique_ptr<CounterBasedEvent>(CounterBasedEvent::create(device));
+    ze_event_handle_t hEventHandle = counterBasedEvent->toHandle();
+
+    auto usedSpaceBefore = commandList->commandContainer.getCommandStream()->getUsed();
+    auto result = commandList->appendWaitOnEvents(1, &hEventHandle);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(usedSpaceBefore, commandList->commandContainer.getCommandStream()->getUsed());
+
+    counterBasedEvent->assignTaskCount(&csr, 10u);
+    result = commandList->appendWaitOnEvents(1, &hEventHandle);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    auto usedSpaceAfter = commandList->commandContainer.getCommandStream()->getUsed();
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(cmdList,
+                                                      ptrOffset(commandList->commandContainer.getCommandStream()->getCpuBase(), usedSpaceBefore),
+                                                      usedSpaceAfter - usedSpaceBefore));
+
+    auto itorSW = findAll<MI_SEMAPHORE_WAIT *>(cmdList.begin(), cmdList.end());
+    ASSERT_EQ(csr.getActivePartitions(), itorSW.size());
+    auto cmd = genCmdCast<MI_SEMAPHORE_WAIT *>(*itorSW[0]);
+    auto addressSpace = device->getHwInfo().capabilityTable.gpuAddressSpace;
+    EXPECT_EQ(MI_SEMAPHORE_WAIT::COMPARE_OPERATION::COMPARE_OPERATION_SAD_GREATER_THAN_OR_EQUAL_SDD, cmd->getCompareOperation());
+    EXPECT_EQ(10u, cmd->getSemaphoreDataDword());
+    EXPECT_EQ(csr.getTagAllocation()->getGpuAddress() & addressSpace, cmd->getSemaphoreGraphicsAddress() & addressSpace);
+
+    auto &residencyContainer = commandList->commandContainer.getResidencyContainer();
+    EXPECT_NE(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), csr.getTagAllocation()));
+}
+
 using MultTileCommandListAppendWaitOnEvent = Test<MultiTileCommandListFixture<false, false, false>>;
 HWTEST2_F(MultTileCommandListAppendWaitOnEvent,
           GivenMultiTileCmdListWhenPartitionedEventUsedToWaitThenExpectProperGpuAddressAndSemaphoreCount, IsAtLeastXeHpCore) {
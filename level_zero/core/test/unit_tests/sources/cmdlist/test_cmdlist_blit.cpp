@@ -60,15 +60,6 @@ class MockDriverHandle : public L0::DriverHandleImp {
 
 using AppendMemoryCopy = Test<DeviceFixture>;
 
-HWTEST2_F(AppendMemoryCopy, givenCopyOnlyCommandListWhenAppenBlitFillCalledWithLargePatternSizeThenMemCopyWasCalled, IsAtLeastSkl) {
-    MockCommandListForMemFill<gfxCoreFamily> cmdList;
-    cmdList.initialize(device, NEO::EngineGroupType::Copy, 0u);
-    uint64_t pattern[4] = {1, 2, 3, 4};
-    void *ptr = reinterpret_cast<void *>(0x1234);
-    auto ret = cmdList.appendMemoryFill(ptr, reinterpret_cast<void *>(&pattern), sizeof(pattern), 0x1000, nullptr, 0, nullptr);
-    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, ret);
-}
-
 HWTEST2_F(AppendMemoryCopy, givenCopyOnlyCommandListWhenAppenBlitFillToNotDeviceMemThenInvalidArgumentReturned, IsAtLeastSkl) {
     MockCommandListForMemFill<gfxCoreFamily> cmdList;
     cmdList.initialize(device, NEO::EngineGroupType::Copy, 0u);
@@ -101,6 +92,40 @@ HWTEST2_F(AppendMemoryCopy, givenCopyOnlyCommandListWhenAppenBlitFillThenCopyBlt
     device->setDriverHandle(driverHandle.get());
 }
 
+HWTEST2_F(AppendMemoryCopy, givenCopyOnlyCommandListWhenAppenBlitFillCalledWithLargePatternSizeThenPatternIsStagedAndCopiedWithDoublingCopies, MemFillPlatforms) {
+    using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
+    using XY_COPY_BLT = typename GfxFamily::XY_COPY_BLT;
+    using XY_COLOR_BLT = typename GfxFamily::XY_COLOR_BLT;
+    using MI_FLUSH_DW = typename GfxFamily::MI_FLUSH_DW;
+    MockCommandListForMemFill<gfxCoreFamily> commandList;
+    MockDriverHandle driverHandleMock;
+    NEO::DeviceVector neoDevices;
+    neoDevices.push_back(std::unique_ptr<NEO::Device>(neoDevice));
+    driverHandleMock.initialize(std::move(neoDevices));
+    device->setDriverHandle(&driverHandleMock);
+    commandList.initialize(device, NEO::EngineGroupType::Copy, 0u);
+    uint64_t pattern[4] = {1, 2, 3, 4};
+    void *ptr = reinterpret_cast<void *>(0x1234);
+    auto ret = commandList.appendMemoryFill(ptr, reinterpret_cast<void *>(&pattern), sizeof(pattern), 4 * MemoryConstants::pageSize64k, nullptr, 0, nullptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, ret);
+
+    ASSERT_EQ(1u, commandList.patternAllocations.size());
+    auto patternAllocation = commandList.patternAllocations[0];
+    EXPECT_GE(patternAllocation->getUnderlyingBufferSize(), MemoryConstants::pageSize64k);
+    EXPECT_EQ(0, memcmp(ptrOffset(patternAllocation->getUnderlyingBuffer(), MemoryConstants::pageSize64k - sizeof(pattern)), pattern, sizeof(pattern)));
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(
+        cmdList, ptrOffset(commandList.commandContainer.getCommandStream()->getCpuBase(), 0), commandList.commandContainer.getCommandStream()->getUsed()));
+    EXPECT_EQ(cmdList.end(), find<XY_COLOR_BLT *>(cmdList.begin(), cmdList.end()));
+    auto copyBlts = findAll<XY_COPY_BLT *>(cmdList.begin(), cmdList.end());
+    ASSERT_EQ(3u, copyBlts.size());
+    EXPECT_EQ(patternAllocation->getGpuAddress(), genCmdCast<XY_COPY_BLT *>(*copyBlts[0])->getSourceBaseAddress());
+    EXPECT_NE(copyBlts[1], find<MI_FLUSH_DW *>(copyBlts[0], copyBlts[1]));
+    EXPECT_NE(copyBlts[2], find<MI_FLUSH_DW *>(copyBlts[1], copyBlts[2]));
+    device->setDriverHandle(driverHandle.get());
+}
+
 HWTEST2_F(AppendMemoryCopy, givenCopyOnlyCommandListAndHostPointersWhenMemoryCopyCalledThenPipeControlWithDcFlushAddedIsNotAddedAfterBlitCopy, IsAtLeastSkl) {
     using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
@@ -679,5 +679,54 @@ HWTEST2_F(MultiTileAppendFillTest,
     EXPECT_EQ(expectedDcFlush, dcFlushFound);
 }
 
+HWTEST2_F(AppendFillTest,
+          givenMemoryFillStoreDataImmMaxSizeSetWhenAppendingTinyAlignedFillThenStoreDataImmIsProgrammedInsteadOfKernel, IsAtLeastSkl) {
+    using MI_STORE_DATA_IMM = typename FamilyType::MI_STORE_DATA_IMM;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.MemoryFillStoreDataImmMaxSize.set(64);
+
+    auto commandList = std::make_unique<WhiteBox<MockCommandList<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+
+    alignas(8) uint8_t tinyDst[12] = {};
+    uint8_t tinyPattern[3] = {1, 2, 3};
+    auto result = commandList->appendMemoryFill(tinyDst, tinyPattern, sizeof(tinyPattern), sizeof(tinyDst), nullptr, 0, nullptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(0u, commandList->numberOfCallsToAppendLaunchKernelWithParams);
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(
+        cmdList, commandList->commandContainer.getCommandStream()->getCpuBase(),
+        commandList->commandContainer.getCommandStream()->getUsed()));
+
+    auto storeDataImms = findAll<MI_STORE_DATA_IMM *>(cmdList.begin(), cmdList.end());
+    ASSERT_EQ(2u, storeDataImms.size());
+
+    auto qwordStore = genCmdCast<MI_STORE_DATA_IMM *>(*storeDataImms[0]);
+    EXPECT_EQ(reinterpret_cast<uint64_t>(tinyDst), qwordStore->getAddress());
+    EXPECT_TRUE(qwordStore->getStoreQword());
+    EXPECT_EQ(0x01030201u, qwordStore->getDataDword0());
+    EXPECT_EQ(0x02010302u, qwordStore->getDataDword1());
+
+    auto dwordStore = genCmdCast<MI_STORE_DATA_IMM *>(*storeDataImms[1]);
+    EXPECT_EQ(reinterpret_cast<uint64_t>(tinyDst) + sizeof(uint64_t), dwordStore->getAddress());
+    EXPECT_FALSE(dwordStore->getStoreQword());
+    EXPECT_EQ(0x03020103u, dwordStore->getDataDword0());
+}
+
+HWTEST2_F(AppendFillTest,
+          givenMemoryFillStoreDataImmMaxSizeSetWhenAppendingFillWithUnalignedSizeThenFillKernelIsDispatched, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.MemoryFillStoreDataImmMaxSize.set(64);
+
+    auto commandList = std::make_unique<WhiteBox<MockCommandList<gfxCoreFamily>>>();
+    commandList->initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+
+    alignas(8) uint8_t tinyDst[6] = {};
+    auto result = commandList->appendMemoryFill(tinyDst, &immediatePattern, sizeof(immediatePattern), sizeof(tinyDst), nullptr, 0, nullptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_NE(0u, commandList->numberOfCallsToAppendLaunchKernelWithParams);
+}
+
 } // namespace ult
 } // namespace L0
@@ -739,6 +739,52 @@ TEST_F(DeviceCreateCommandQueueTest, givenLowPriorityDescWhenCreateCommandQueueI
     commandQueue->destroy();
 }
 
+struct DeviceCreateHighPriorityCommandQueueTest : public Test<DeviceFixture> {
+    void SetUp() override {
+        DebugManager.flags.CreateHighPriorityContext.set(1);
+        Test<DeviceFixture>::SetUp();
+    }
+    DebugManagerStateRestore restorer;
+};
+
+TEST_F(DeviceCreateHighPriorityCommandQueueTest, givenHighPriorityDescWhenCreateCommandQueueIsCalledThenHighPriorityCsrIsAssigned) {
+    ze_command_queue_desc_t desc{};
+    desc.ordinal = 0u;
+    desc.index = 0u;
+    desc.priority = ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_HIGH;
+
+    ze_command_queue_handle_t commandQueueHandle = {};
+
+    ze_result_t res = device->createCommandQueue(&desc, &commandQueueHandle);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    auto commandQueue = static_cast<CommandQueueImp *>(L0::CommandQueue::fromHandle(commandQueueHandle));
+    EXPECT_NE(commandQueue, nullptr);
+    EXPECT_TRUE(commandQueue->getCsr()->getOsContext().isHighPriority());
+    NEO::CommandStreamReceiver *csr = nullptr;
+    EXPECT_TRUE(static_cast<DeviceImp *>(device)->getCsrForHighPriority(&csr));
+    EXPECT_EQ(commandQueue->getCsr(), csr);
+    commandQueue->destroy();
+}
+
+TEST_F(DeviceCreateCommandQueueTest, givenHighPriorityDescAndNoHighPriorityContextWhenCreateCommandQueueIsCalledThenCsrForOrdinalIsAssigned) {
+    ze_command_queue_desc_t desc{};
+    desc.ordinal = 0u;
+    desc.index = 0u;
+    desc.priority = ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_HIGH;
+
+    ze_command_queue_handle_t commandQueueHandle = {};
+
+    ze_result_t res = device->createCommandQueue(&desc, &commandQueueHandle);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    auto commandQueue = static_cast<CommandQueueImp *>(L0::CommandQueue::fromHandle(commandQueueHandle));
+    EXPECT_NE(commandQueue, nullptr);
+    EXPECT_FALSE(commandQueue->getCsr()->getOsContext().isHighPriority());
+    NEO::CommandStreamReceiver *csr = nullptr;
+    device->getCsrForOrdinalAndIndex(&csr, 0u, 0u);
+    EXPECT_EQ(commandQueue->getCsr(), csr);
+    commandQueue->destroy();
+}
+
 TEST_F(DeviceCreateCommandQueueTest, givenCopyOrdinalWhenCreateCommandQueueWithLowPriorityDescIsCalledThenCopyCsrIsAssigned) {
     auto copyCsr = std::unique_ptr<NEO::CommandStreamReceiver>(neoDevice->createCommandStreamReceiver());
     EngineDescriptor copyEngineDescriptor({aub_stream::ENGINE_BCS, EngineUsage::Regular}, neoDevice->getDeviceBitfield(), neoDevice->getPreemptionMode(), false, false);
@@ -1367,6 +1413,60 @@ HWTEST2_F(ExecuteCommandListTests, givenTwoCommandQueuesHavingTwoB2BCommandLists
     commandQueue1->destroy();
 }
 
+HWTEST2_F(ExecuteCommandListTests, givenStateBaseAddressTrackingEnabledWhenCommandListsWithSameStateAreExecutedThenGSBAIsProgrammedOnlyAfterStateChange, CommandQueueExecuteSupport) {
+    using STATE_BASE_ADDRESS = typename FamilyType::STATE_BASE_ADDRESS;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableStateBaseAddressTracking.set(1);
+
+    ze_command_queue_desc_t desc = {};
+    NEO::CommandStreamReceiver *csr;
+    device->getCsrForOrdinalAndIndex(&csr, 0u, 0u);
+    ze_result_t returnValue;
+    auto commandQueue = whiteboxCast(CommandQueue::create(productFamily,
+                                                          device,
+                                                          csr,
+                                                          &desc,
+                                                          false,
+                                                          false,
+                                                          returnValue));
+    ASSERT_NE(nullptr, commandQueue);
+    auto commandList0 = std::unique_ptr<CommandList>(whiteboxCast(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue)));
+    commandList0->setCommandListPerThreadScratchSize(0u);
+    auto commandList1 = std::unique_ptr<CommandList>(whiteboxCast(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue)));
+    commandList1->setCommandListPerThreadScratchSize(0u);
+    ze_command_list_handle_t commandLists[] = {commandList0->toHandle(), commandList1->toHandle()};
+
+    commandQueue->executeCommandLists(2, commandLists, nullptr, false);
+    commandQueue->executeCommandLists(2, commandLists, nullptr, false);
+    EXPECT_FALSE(csr->getGSBAStateDirty());
+
+    auto usedSpaceAfter = commandQueue->commandStream.getUsed();
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(
+        cmdList, ptrOffset(commandQueue->commandStream.getCpuBase(), 0), usedSpaceAfter));
+    auto gsbaStates = findAll<STATE_BASE_ADDRESS *>(cmdList.begin(), cmdList.end());
+    EXPECT_EQ(1u, gsbaStates.size());
+
+    auto &sbaState = csr->getStreamProperties().stateBaseAddress;
+    EXPECT_EQ(static_cast<int64_t>(csr->getScratchSpaceController()->calculateNewGSH()), sbaState.generalStateBaseAddress.value);
+
+    auto expectedGsh = sbaState.generalStateBaseAddress.value;
+    sbaState.setProperties(expectedGsh + 0x1000, -1, -1, -1);
+
+    auto usedSpaceBefore = commandQueue->commandStream.getUsed();
+    commandQueue->executeCommandLists(2, commandLists, nullptr, false);
+    usedSpaceAfter = commandQueue->commandStream.getUsed();
+
+    GenCmdList cmdList1;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(
+        cmdList1, ptrOffset(commandQueue->commandStream.getCpuBase(), usedSpaceBefore), usedSpaceAfter - usedSpaceBefore));
+    gsbaStates = findAll<STATE_BASE_ADDRESS *>(cmdList1.begin(), cmdList1.end());
+    EXPECT_EQ(1u, gsbaStates.size());
+    EXPECT_EQ(expectedGsh, sbaState.generalStateBaseAddress.value);
+
+    commandQueue->destroy();
+}
+
 HWTEST2_F(ExecuteCommandListTests, givenTwoCommandQueuesHavingTwoB2BCommandListsAndWithPTSSsetForSecondCmdListThenMVSandGSBAAreProgrammedTwice, CommandQueueExecuteSupport) {
     using MEDIA_VFE_STATE = typename FamilyType::MEDIA_VFE_STATE;
     using STATE_BASE_ADDRESS = typename FamilyType::STATE_BASE_ADDRESS;
@@ -202,6 +202,66 @@ HWTEST_F(CommandQueueExecuteCommandLists, whenASecondLevelBatchBufferPerCommandL
     commandQueue->destroy();
 }
 
+HWTEST_F(CommandQueueExecuteCommandLists, givenCachedBatchBufferStartsWhenExecutingClosedCommandListsAgainThenSameBatchBufferStartsAreProgrammedUntilListIsReset) {
+    using MI_BATCH_BUFFER_START = typename FamilyType::MI_BATCH_BUFFER_START;
+    using PARSE = typename FamilyType::PARSE;
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.CacheCommandListBatchBufferStarts.set(1);
+
+    const ze_command_queue_desc_t desc{};
+    ze_result_t returnValue;
+    auto commandQueue = whiteboxCast(CommandQueue::create(productFamily,
+                                                          device,
+                                                          neoDevice->getDefaultEngine().commandStreamReceiver,
+                                                          &desc,
+                                                          false,
+                                                          false,
+                                                          returnValue));
+    ASSERT_NE(nullptr, commandQueue);
+
+    for (auto i = 0u; i < numCommandLists; i++) {
+        auto commandList = CommandList::fromHandle(commandLists[i]);
+        commandList->close();
+        EXPECT_TRUE(commandList->getCachedBatchBufferStarts().empty());
+    }
+
+    auto result = commandQueue->executeCommandLists(numCommandLists, commandLists, nullptr, true);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    for (auto i = 0u; i < numCommandLists; i++) {
+        auto commandList = CommandList::fromHandle(commandLists[i]);
+        EXPECT_EQ(commandList->commandContainer.getCmdBufferAllocations().size() * sizeof(MI_BATCH_BUFFER_START), commandList->getCachedBatchBufferStarts().size());
+    }
+
+    auto usedSpaceBefore = commandQueue->commandStream.getUsed();
+    result = commandQueue->executeCommandLists(numCommandLists, commandLists, nullptr, true);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto usedSpaceAfter = commandQueue->commandStream.getUsed();
+    ASSERT_GT(usedSpaceAfter, usedSpaceBefore);
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(PARSE::parseCommandBuffer(cmdList,
+                                          ptrOffset(commandQueue->commandStream.getCpuBase(), usedSpaceBefore),
+                                          usedSpaceAfter - usedSpaceBefore));
+
+    auto itorCurrent = cmdList.begin();
+    for (auto i = 0u; i < numCommandLists; i++) {
+        auto commandList = CommandList::fromHandle(commandLists[i]);
+        auto allocation = commandList->commandContainer.getCmdBufferAllocations()[0];
+
+        itorCurrent = find<MI_BATCH_BUFFER_START *>(itorCurrent, cmdList.end());
+        ASSERT_NE(cmdList.end(), itorCurrent);
+        auto bbs = genCmdCast<MI_BATCH_BUFFER_START *>(*itorCurrent++);
+        ASSERT_NE(nullptr, bbs);
+        EXPECT_EQ(allocation->getGpuAddress(), bbs->getBatchBufferStartAddress());
+    }
+
+    auto commandList = CommandList::fromHandle(commandLists[0]);
+    commandList->reset();
+    EXPECT_TRUE(commandList->getCachedBatchBufferStarts().empty());
+
+    commandQueue->destroy();
+}
+
 HWTEST_F(CommandQueueExecuteCommandLists, givenFenceWhenExecutingCmdListThenFenceStatusIsCorrect) {
     const ze_command_queue_desc_t desc{};
     ze_result_t returnValue;
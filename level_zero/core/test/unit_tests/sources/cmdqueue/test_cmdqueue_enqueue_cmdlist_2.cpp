@@ -7,6 +7,7 @@
 
 #include "shared/source/helpers/pause_on_gpu_properties.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
@@ -568,5 +569,88 @@ HWTEST2_F(CmdListLargeGrfTest,
     testBody<FamilyType>();
 }
 
+HWTEST2_F(CommandQueueExecuteCommandListsSimpleTest, givenSubmissionAggregationEnabledWhenSubmittingPendingSubmissionsThenSingleBatchBufferIsSubmittedAndAllFencesAreAssigned, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.CommandQueueSubmissionAggregationWindow.set(0);
+
+    ze_command_queue_desc_t desc = {};
+    desc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+    auto mockCmdQ = new MockCommandQueueHw<gfxCoreFamily>(device, neoDevice->getDefaultEngine().commandStreamReceiver, &desc);
+    mockCmdQ->initialize(false, false);
+    EXPECT_TRUE(mockCmdQ->isSubmissionAggregationEnabled());
+
+    ze_result_t returnValue;
+    auto commandList0 = CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue);
+    auto commandList1 = CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue);
+    commandList0->close();
+    commandList1->close();
+
+    ze_fence_desc_t fenceDesc = {};
+    auto fence0 = whiteboxCast(Fence::create(mockCmdQ, &fenceDesc));
+    auto fence1 = whiteboxCast(Fence::create(mockCmdQ, &fenceDesc));
+
+    using AggregatedSubmission = typename MockCommandQueueHw<gfxCoreFamily>::AggregatedSubmission;
+    AggregatedSubmission submission0{{commandList0->toHandle()}, fence0->toHandle(), true};
+    AggregatedSubmission submission1{{commandList1->toHandle()}, fence1->toHandle(), false};
+    submission0.result = ZE_RESULT_ERROR_UNKNOWN;
+    submission1.result = ZE_RESULT_ERROR_UNKNOWN;
+    std::vector<AggregatedSubmission *> submissions = {&submission0, &submission1};
+
+    mockCmdQ->submitAggregatedSubmissions(submissions);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, submission0.result);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, submission1.result);
+    EXPECT_EQ(1u, mockCmdQ->submitBatchBufferCalled);
+    EXPECT_NE(0u, fence0->taskCount);
+    EXPECT_EQ(fence0->taskCount, fence1->taskCount);
+
+    fence0->destroy();
+    fence1->destroy();
+    commandList0->destroy();
+    commandList1->destroy();
+    mockCmdQ->destroy();
+}
+
+HWTEST2_F(CommandQueueExecuteCommandListsSimpleTest, givenSubmissionAggregationEnabledWhenQueueIsSynchronousThenAggregationIsDisabled, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.CommandQueueSubmissionAggregationWindow.set(0);
+
+    ze_command_queue_desc_t desc = {};
+    desc.mode = ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS;
+    auto mockCmdQ = new MockCommandQueueHw<gfxCoreFamily>(device, neoDevice->getDefaultEngine().commandStreamReceiver, &desc);
+    mockCmdQ->initialize(false, false);
+    EXPECT_FALSE(mockCmdQ->isSubmissionAggregationEnabled());
+    mockCmdQ->destroy();
+}
+
+HWTEST2_F(CommandQueueExecuteCommandListsSimpleTest, givenSubmissionAggregationEnabledWhenExecutingCommandListsThenFenceIsAssignedAndQueueCanBeReused, IsAtLeastSkl) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.CommandQueueSubmissionAggregationWindow.set(1);
+
+    ze_command_queue_desc_t desc = {};
+    desc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+    auto mockCmdQ = new MockCommandQueueHw<gfxCoreFamily>(device, neoDevice->getDefaultEngine().commandStreamReceiver, &desc);
+    mockCmdQ->initialize(false, false);
+
+    ze_result_t returnValue;
+    auto commandList = CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue);
+    commandList->close();
+    auto hCommandList = commandList->toHandle();
+
+    ze_fence_desc_t fenceDesc = {};
+    auto fence = whiteboxCast(Fence::create(mockCmdQ, &fenceDesc));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, mockCmdQ->executeCommandLists(1, &hCommandList, fence->toHandle(), false));
+    auto firstTaskCount = fence->taskCount;
+    EXPECT_NE(0u, firstTaskCount);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, mockCmdQ->executeCommandLists(1, &hCommandList, fence->toHandle(), false));
+    EXPECT_GT(fence->taskCount, firstTaskCount);
+    EXPECT_EQ(2u, mockCmdQ->submitBatchBufferCalled);
+
+    fence->destroy();
+    commandList->destroy();
+    mockCmdQ->destroy();
+}
+
 } // namespace ult
 } // namespace L0
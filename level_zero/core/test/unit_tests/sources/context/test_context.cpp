@@ -5,6 +5,8 @@
  *
  */
 
+#include "shared/source/gmm_helper/gmm_helper.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/test/common/mocks/mock_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_compilers.h"
 #include "shared/test/common/mocks/mock_cpu_page_fault_manager.h"
@@ -788,7 +790,7 @@ TEST_F(ContextTest, whenGettingDriverThenDriverIsRetrievedSuccessfully) {
     EXPECT_EQ(ZE_RESULT_SUCCESS, res);
 }
 
-TEST_F(ContextTest, whenCallingVirtualMemInterfacesThenUnsupportedIsReturned) {
+TEST_F(ContextTest, whenReservingAndFreeingVirtualMemThenGpuAddressRangeIsReservedAndReleased) {
     ze_context_handle_t hContext;
     ze_context_desc_t desc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC, nullptr, 0};
 
@@ -801,10 +803,25 @@ TEST_F(ContextTest, whenCallingVirtualMemInterfacesThenUnsupportedIsReturned) {
     size_t size = 0u;
     void *ptr = nullptr;
     res = contextImp->reserveVirtualMem(pStart, size, &ptr);
-    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_SIZE, res);
+
+    size = MemoryConstants::pageSize64k + 1;
+    res = contextImp->reserveVirtualMem(pStart, size, &ptr);
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_SIZE, res);
+
+    size = 4 * MemoryConstants::pageSize64k;
+    res = contextImp->reserveVirtualMem(pStart, size, &ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_NE(nullptr, ptr);
+
+    res = contextImp->freeVirtualMem(ptr, MemoryConstants::pageSize64k);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, res);
 
     res = contextImp->freeVirtualMem(ptr, size);
-    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+
+    res = contextImp->freeVirtualMem(ptr, size);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, res);
 
     res = contextImp->destroy();
     EXPECT_EQ(ZE_RESULT_SUCCESS, res);
@@ -841,7 +858,7 @@ TEST_F(ContextTest, whenCallingQueryVirtualMemPageSizeCorrectAlignmentIsReturned
     EXPECT_EQ(ZE_RESULT_SUCCESS, res);
 }
 
-TEST_F(ContextTest, whenCallingPhysicalMemInterfacesThenUnsupportedIsReturned) {
+TEST_F(ContextTest, whenCreatingAndDestroyingPhysicalMemThenGraphicsAllocationIsCreatedAndFreed) {
     ze_context_handle_t hContext;
     ze_context_desc_t desc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC, nullptr, 0};
 
@@ -850,19 +867,29 @@ TEST_F(ContextTest, whenCallingPhysicalMemInterfacesThenUnsupportedIsReturned) {
 
     ContextImp *contextImp = static_cast<ContextImp *>(L0::Context::fromHandle(hContext));
 
-    ze_physical_mem_desc_t descMem = {};
+    ze_physical_mem_desc_t descMem = {ZE_STRUCTURE_TYPE_PHYSICAL_MEM_DESC, nullptr, 0, 100u};
     ze_physical_mem_handle_t mem = {};
     res = contextImp->createPhysicalMem(device, &descMem, &mem);
-    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_SIZE, res);
+
+    descMem.size = MemoryConstants::pageSize64k;
+    res = contextImp->createPhysicalMem(device, &descMem, &mem);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    auto allocation = reinterpret_cast<NEO::GraphicsAllocation *>(mem);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(MemoryConstants::pageSize64k, allocation->getUnderlyingBufferSize());
 
     res = contextImp->destroyPhysicalMem(mem);
-    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+
+    res = contextImp->destroyPhysicalMem(mem);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, res);
 
     res = contextImp->destroy();
     EXPECT_EQ(ZE_RESULT_SUCCESS, res);
 }
 
-TEST_F(ContextTest, whenCallingMappingVirtualInterfacesThenUnsupportedIsReturned) {
+TEST_F(ContextTest, givenReservedVirtualMemWhenMappingPhysicalMemChunksThenChunksAreBoundInPlaceAndUnboundOnUnmap) {
     ze_context_handle_t hContext;
     ze_context_desc_t desc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC, nullptr, 0};
 
@@ -871,18 +898,80 @@ TEST_F(ContextTest, whenCallingMappingVirtualInterfacesThenUnsupportedIsReturned
 
     ContextImp *contextImp = static_cast<ContextImp *>(L0::Context::fromHandle(hContext));
 
-    ze_physical_mem_desc_t descMem = {};
-    ze_physical_mem_handle_t mem = {};
-    res = contextImp->createPhysicalMem(device, &descMem, &mem);
+    const size_t chunkSize = MemoryConstants::pageSize64k;
+    void *ptr = nullptr;
+    res = contextImp->reserveVirtualMem(nullptr, 2 * chunkSize, &ptr);
+    ASSERT_EQ(ZE_RESULT_SUCCESS, res);
+
+    ze_physical_mem_desc_t descMem = {ZE_STRUCTURE_TYPE_PHYSICAL_MEM_DESC, nullptr, 0, chunkSize};
+    ze_physical_mem_handle_t chunks[2] = {};
+    for (auto &chunk : chunks) {
+        res = contextImp->createPhysicalMem(device, &descMem, &chunk);
+        ASSERT_EQ(ZE_RESULT_SUCCESS, res);
+    }
+    auto firstChunk = reinterpret_cast<NEO::GraphicsAllocation *>(chunks[0]);
+    auto secondChunk = reinterpret_cast<NEO::GraphicsAllocation *>(chunks[1]);
+    auto secondChunkGpuAddress = secondChunk->getGpuAddress();
+    auto secondPtr = ptrOffset(ptr, chunkSize);
+    auto gmmHelper = device->getNEODevice()->getGmmHelper();
+
+    ze_memory_access_attribute_t access = ZE_MEMORY_ACCESS_ATTRIBUTE_READWRITE;
+    res = contextImp->mapVirtualMem(ptr, chunkSize, chunks[0], chunkSize, access);
     EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
 
+    res = contextImp->mapVirtualMem(ptr, chunkSize, chunks[0], 0u, access);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(gmmHelper->canonize(castToUint64(ptr)), firstChunk->getGpuAddress());
+
+    res = contextImp->mapVirtualMem(ptr, chunkSize, chunks[1], 0u, access);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, res);
+    res = contextImp->mapVirtualMem(ptrOffset(ptr, 2 * chunkSize), chunkSize, chunks[1], 0u, access);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, res);
+
+    res = contextImp->mapVirtualMem(secondPtr, chunkSize, chunks[1], 0u, access);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(gmmHelper->canonize(castToUint64(secondPtr)), secondChunk->getGpuAddress());
+
+    auto svmData = driverHandle->svmAllocsManager->getSVMAlloc(secondPtr);
+    ASSERT_NE(nullptr, svmData);
+    EXPECT_EQ(secondChunk, svmData->gpuAllocations.getDefaultGraphicsAllocation());
+
+    res = contextImp->destroyPhysicalMem(chunks[1]);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, res);
+    res = contextImp->freeVirtualMem(ptr, 2 * chunkSize);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, res);
+
+    res = contextImp->unMapVirtualMem(secondPtr, chunkSize);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    EXPECT_EQ(secondChunkGpuAddress, secondChunk->getGpuAddress());
+    EXPECT_EQ(nullptr, driverHandle->svmAllocsManager->getSVMAlloc(secondPtr));
+
+    res = contextImp->unMapVirtualMem(ptr, chunkSize);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    res = contextImp->unMapVirtualMem(ptr, chunkSize);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, res);
+
+    for (auto &chunk : chunks) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->destroyPhysicalMem(chunk));
+    }
+    EXPECT_EQ(ZE_RESULT_SUCCESS, contextImp->freeVirtualMem(ptr, 2 * chunkSize));
+
+    res = contextImp->destroy();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+}
+
+TEST_F(ContextTest, whenCallingVirtualMemAccessAttributeInterfacesThenUnsupportedIsReturned) {
+    ze_context_handle_t hContext;
+    ze_context_desc_t desc = {ZE_STRUCTURE_TYPE_CONTEXT_DESC, nullptr, 0};
+
+    ze_result_t res = driverHandle->createContext(&desc, 0u, nullptr, &hContext);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+
+    ContextImp *contextImp = static_cast<ContextImp *>(L0::Context::fromHandle(hContext));
+
     ze_memory_access_attribute_t access = {};
-    size_t offset = 0;
     void *ptr = nullptr;
     size_t size = 0;
-    res = contextImp->mapVirtualMem(ptr, size, mem, offset, access);
-    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
-
     res = contextImp->setVirtualMemAccessAttribute(ptr, size, access);
     EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
 
@@ -891,12 +980,6 @@ TEST_F(ContextTest, whenCallingMappingVirtualInterfacesThenUnsupportedIsReturned
     res = contextImp->getVirtualMemAccessAttribute(ptr, size, &outAccess, &outSize);
     EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
 
-    res = contextImp->unMapVirtualMem(ptr, size);
-    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
-
-    res = contextImp->destroyPhysicalMem(mem);
-    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, res);
-
     res = contextImp->destroy();
     EXPECT_EQ(ZE_RESULT_SUCCESS, res);
 }
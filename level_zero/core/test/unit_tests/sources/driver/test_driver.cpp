@@ -9,10 +9,12 @@
 #include "shared/source/os_interface/device_factory.h"
 #include "shared/source/os_interface/hw_info_config.h"
 #include "shared/source/os_interface/os_inc_base.h"
+#include "shared/source/os_interface/os_interface.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/ult_hw_config.h"
 #include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/mocks/mock_compilers.h"
+#include "shared/test/common/mocks/mock_driver_model.h"
 #include "shared/test/common/mocks/mock_io_functions.h"
 #include "shared/test/common/mocks/ult_device_factory.h"
 #include "shared/test/common/test_macros/hw_test.h"
@@ -659,7 +661,20 @@ TEST_F(DriverExperimentalApiTest, whenRetrievingApiFunctionThenExpectProperPoint
     decltype(&zexDriverImportExternalPointer) expectedImport = L0::zexDriverImportExternalPointer;
     decltype(&zexDriverReleaseImportedPointer) expectedRelease = L0::zexDriverReleaseImportedPointer;
     decltype(&zexDriverGetHostPointerBaseAddress) expectedGet = L0::zexDriverGetHostPointerBaseAddress;
+    decltype(&zexDriverGetPerformanceHints) expectedGetPerformanceHints = L0::zexDriverGetPerformanceHints;
+    decltype(&zexDeviceRecoverFromGpuHang) expectedDeviceRecoverFromGpuHang = L0::zexDeviceRecoverFromGpuHang;
     decltype(&zexKernelGetBaseAddress) expectedKernelGetBaseAddress = L0::zexKernelGetBaseAddress;
+    decltype(&zexKernelClone) expectedKernelClone = L0::zexKernelClone;
+    decltype(&zexCommandListUpdateKernelLaunch) expectedCommandListUpdateKernelLaunch = L0::zexCommandListUpdateKernelLaunch;
+    decltype(&zexCommandListAppendLaunchMultipleKernels) expectedCommandListAppendLaunchMultipleKernels = L0::zexCommandListAppendLaunchMultipleKernels;
+    decltype(&zexCommandListBeginGraphCapture) expectedCommandListBeginGraphCapture = L0::zexCommandListBeginGraphCapture;
+    decltype(&zexCommandListEndGraphCapture) expectedCommandListEndGraphCapture = L0::zexCommandListEndGraphCapture;
+    decltype(&zexCommandListAppendGraph) expectedCommandListAppendGraph = L0::zexCommandListAppendGraph;
+    decltype(&zexCommandListAppendConditionalLaunchKernel) expectedCommandListAppendConditionalLaunchKernel = L0::zexCommandListAppendConditionalLaunchKernel;
+    decltype(&zexEventQueryKernelTimestamps) expectedEventQueryKernelTimestamps = L0::zexEventQueryKernelTimestamps;
+    decltype(&zexCounterBasedEventCreate) expectedCounterBasedEventCreate = L0::zexCounterBasedEventCreate;
+    decltype(&zexEventPoolHostReset) expectedEventPoolHostReset = L0::zexEventPoolHostReset;
+    decltype(&zexEventPoolHostSignal) expectedEventPoolHostSignal = L0::zexEventPoolHostSignal;
 
     void *funPtr = nullptr;
 
@@ -675,9 +690,61 @@ TEST_F(DriverExperimentalApiTest, whenRetrievingApiFunctionThenExpectProperPoint
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
     EXPECT_EQ(expectedGet, reinterpret_cast<decltype(&zexDriverGetHostPointerBaseAddress)>(funPtr));
 
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexDriverGetPerformanceHints", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedGetPerformanceHints, reinterpret_cast<decltype(&zexDriverGetPerformanceHints)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexDeviceRecoverFromGpuHang", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedDeviceRecoverFromGpuHang, reinterpret_cast<decltype(&zexDeviceRecoverFromGpuHang)>(funPtr));
+
     result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexKernelGetBaseAddress", &funPtr);
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
     EXPECT_EQ(expectedKernelGetBaseAddress, reinterpret_cast<decltype(&zexKernelGetBaseAddress)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexKernelClone", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedKernelClone, reinterpret_cast<decltype(&zexKernelClone)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListUpdateKernelLaunch", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedCommandListUpdateKernelLaunch, reinterpret_cast<decltype(&zexCommandListUpdateKernelLaunch)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListAppendLaunchMultipleKernels", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedCommandListAppendLaunchMultipleKernels, reinterpret_cast<decltype(&zexCommandListAppendLaunchMultipleKernels)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListBeginGraphCapture", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedCommandListBeginGraphCapture, reinterpret_cast<decltype(&zexCommandListBeginGraphCapture)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListEndGraphCapture", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedCommandListEndGraphCapture, reinterpret_cast<decltype(&zexCommandListEndGraphCapture)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListAppendGraph", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedCommandListAppendGraph, reinterpret_cast<decltype(&zexCommandListAppendGraph)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandListAppendConditionalLaunchKernel", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedCommandListAppendConditionalLaunchKernel, reinterpret_cast<decltype(&zexCommandListAppendConditionalLaunchKernel)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexEventQueryKernelTimestamps", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedEventQueryKernelTimestamps, reinterpret_cast<decltype(&zexEventQueryKernelTimestamps)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexCounterBasedEventCreate", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedCounterBasedEventCreate, reinterpret_cast<decltype(&zexCounterBasedEventCreate)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexEventPoolHostReset", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedEventPoolHostReset, reinterpret_cast<decltype(&zexEventPoolHostReset)>(funPtr));
+
+    result = zeDriverGetExtensionFunctionAddress(driverHandle, "zexEventPoolHostSignal", &funPtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(expectedEventPoolHostSignal, reinterpret_cast<decltype(&zexEventPoolHostSignal)>(funPtr));
 }
 
 TEST_F(DriverExperimentalApiTest, givenHostPointerApiExistWhenImportingPtrThenExpectProperBehavior) {
@@ -699,5 +766,44 @@ TEST_F(DriverExperimentalApiTest, givenHostPointerApiExistWhenImportingPtrThenEx
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+TEST_F(DriverExperimentalApiTest, givenPerformanceHintsDisabledWhenGettingPerformanceHintsThenNoHintsAreReturned) {
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zexDriverGetPerformanceHints(driverHandle, nullptr, nullptr));
+
+    uint32_t count = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexDriverGetPerformanceHints(driverHandle, &count, nullptr));
+    EXPECT_EQ(0u, count);
+
+    zex_performance_hint_t hint = {};
+    count = 1;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexDriverGetPerformanceHints(driverHandle, &count, &hint));
+    EXPECT_EQ(0u, count);
+}
+
+TEST_F(DriverExperimentalApiTest, givenNullDeviceHandleWhenRecoveringFromGpuHangThenErrorIsReturned) {
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, zexDeviceRecoverFromGpuHang(nullptr, nullptr));
+}
+
+TEST_F(DriverExperimentalApiTest, givenNoGpuHangWhenRecoveringFromGpuHangThenNoEngineIsRecovered) {
+    uint32_t recoveredEnginesCount = 1u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexDeviceRecoverFromGpuHang(device->toHandle(), &recoveredEnginesCount));
+    EXPECT_EQ(0u, recoveredEnginesCount);
+}
+
+TEST_F(DriverExperimentalApiTest, givenGpuHangWhenRecoveringFromGpuHangThenHungEnginesAreRecovered) {
+    auto driverModelMock = std::make_unique<NEO::MockDriverModel>();
+    driverModelMock->isGpuHangDetectedToReturn = true;
+    auto osInterface = std::make_unique<NEO::OSInterface>();
+    osInterface->setDriverModel(std::move(driverModelMock));
+    neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[0]->osInterface = std::move(osInterface);
+
+    auto &csr = neoDevice->getGpgpuCommandStreamReceiver();
+    *csr.getTagAddress() = csr.peekTaskCount() + 1;
+
+    uint32_t recoveredEnginesCount = 0u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexDeviceRecoverFromGpuHang(device->toHandle(), &recoveredEnginesCount));
+    EXPECT_NE(0u, recoveredEnginesCount);
+    EXPECT_EQ(csr.peekTaskCount(), *csr.getTagAddress());
+}
+
 } // namespace ult
 } // namespace L0
@@ -7,6 +7,7 @@
 
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_compilers.h"
 #include "shared/test/common/mocks/mock_csr.h"
 #include "shared/test/common/mocks/mock_memory_manager.h"
@@ -14,6 +15,7 @@
 #include "shared/test/common/mocks/mock_timestamp_packet.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include "level_zero/api/driver_experimental/public/zex_api.h"
 #include "level_zero/core/source/context/context_imp.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
 #include "level_zero/core/source/event/event.h"
@@ -37,6 +39,7 @@ extern volatile uint32_t *pauseAddress;
 extern uint32_t pauseValue;
 extern uint32_t pauseOffset;
 extern std::function<void()> setupPauseAddress;
+extern std::atomic<uint32_t> nonTemporalFillCounter;
 } // namespace CpuIntrinsicsTests
 
 namespace L0 {
@@ -362,6 +365,46 @@ TEST_F(EventPoolCreateMultiDevice, whenGettingIpcHandleForEventPoolWhenHostShare
     delete[] devices;
 }
 
+TEST_F(EventPoolCreateMultiDevice, givenSubDevicesOfOneRootDeviceWhenCreatingEventPoolWithoutHostVisibleFlagThenDeviceAllocationIsUsed) {
+    ze_event_pool_desc_t eventPoolDesc = {
+        ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
+        nullptr,
+        0u,
+        4};
+
+    uint32_t deviceCount = 1;
+    ze_device_handle_t rootDeviceHandle;
+    ze_result_t result = zeDeviceGet(driverHandle.get(), &deviceCount, &rootDeviceHandle);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    deviceCount = 0;
+    result = zeDeviceGetSubDevices(rootDeviceHandle, &deviceCount, nullptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(numSubDevices, deviceCount);
+    auto subDeviceHandles = std::make_unique<ze_device_handle_t[]>(deviceCount);
+    result = zeDeviceGetSubDevices(rootDeviceHandle, &deviceCount, subDeviceHandles.get());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context, deviceCount, subDeviceHandles.get(), &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, eventPool);
+    EXPECT_EQ(NEO::AllocationType::GPU_TIMESTAMP_DEVICE_BUFFER, eventPool->getAllocation().getAllocationType());
+}
+
+TEST_F(EventPoolCreateMultiDevice, givenMultipleRootDevicesWhenCreatingEventPoolWithoutHostVisibleFlagThenHostAllocationIsUsed) {
+    ze_event_pool_desc_t eventPoolDesc = {
+        ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
+        nullptr,
+        0u,
+        4};
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, eventPool);
+    EXPECT_EQ(NEO::AllocationType::BUFFER_HOST_MEMORY, eventPool->getAllocation().getAllocationType());
+}
+
 TEST_F(EventPoolIPCHandleTests, whenOpeningIpcHandleForEventPoolThenEventPoolIsCreatedAndEventSizesAreTheSame) {
     uint32_t numEvents = 4;
     ze_event_pool_desc_t eventPoolDesc = {
@@ -646,6 +689,100 @@ TEST_F(EventCreate, givenAnEventCreatedThenTheEventHasTheDeviceCommandStreamRece
     ASSERT_EQ(device->getNEODevice()->getDefaultEngine().commandStreamReceiver, event->csr);
 }
 
+HWTEST_F(EventCreate, givenCounterBasedEventWhenQueryingStatusThenCompletionFollowsCsrTagAgainstAssignedTaskCount) {
+    ze_event_handle_t hEvent = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, zexCounterBasedEventCreate(nullptr, &hEvent));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCounterBasedEventCreate(device->toHandle(), &hEvent));
+    auto event = static_cast<CounterBasedEvent *>(Event::fromHandle(hEvent));
+    EXPECT_TRUE(event->isCounterBased());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatus());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSynchronize(0u));
+
+    auto &csr = neoDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.latestFlushedTaskCount = 5u;
+    *csr.getTagAddress() = 4u;
+    event->assignTaskCount(&csr, 5u);
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->queryStatus());
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->hostSynchronize(0u));
+    EXPECT_EQ(csr.getTagAllocation(), &event->getAllocation(device));
+
+    *csr.getTagAddress() = 5u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryStatus());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSynchronize(std::numeric_limits<uint64_t>::max()));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->reset());
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, event->hostSignal());
+    ze_kernel_timestamp_result_t timestamp = {};
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, event->queryKernelTimestamp(&timestamp));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->destroy());
+}
+
+HWTEST_F(EventCreate, givenCounterBasedEventWhenSynchronizingWithoutTimeoutThenCsrWaitsWithKmdNotifyFallback) {
+    ze_event_handle_t hEvent = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCounterBasedEventCreate(device->toHandle(), &hEvent));
+    auto event = static_cast<CounterBasedEvent *>(Event::fromHandle(hEvent));
+
+    auto &csr = neoDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.latestFlushedTaskCount = 5u;
+    *csr.getTagAddress() = 4u;
+    event->assignTaskCount(&csr, 5u);
+
+    csr.waitForTaskCountWithKmdNotifyFallbackReturnValue = NEO::WaitStatus::GpuHang;
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, event->hostSynchronize(std::numeric_limits<uint64_t>::max()));
+
+    csr.waitForTaskCountWithKmdNotifyFallbackReturnValue = NEO::WaitStatus::Ready;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSynchronize(std::numeric_limits<uint64_t>::max()));
+
+    csr.waitForTaskCountWithKmdNotifyFallbackReturnValue = NEO::WaitStatus::GpuHang;
+    EXPECT_EQ(ZE_RESULT_NOT_READY, event->hostSynchronize(1u));
+
+    *csr.getTagAddress() = 5u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->destroy());
+}
+
+TEST_F(EventCreate, givenEventPoolWithEventsWhenSignalingAndResettingPoolFromHostThenAllEventsChangeState) {
+    ze_event_pool_desc_t eventPoolDesc = {
+        ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
+        nullptr,
+        ZE_EVENT_POOL_FLAG_HOST_VISIBLE,
+        2};
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> eventPool(EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, eventPool);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventPoolHostReset(eventPool->toHandle()));
+
+    ze_event_handle_t events[2] = {};
+    for (uint32_t i = 0; i < 2; i++) {
+        ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC, nullptr, i, 0, 0};
+        EXPECT_EQ(ZE_RESULT_SUCCESS, eventPool->createEvent(&eventDesc, &events[i]));
+    }
+    EXPECT_EQ(2u, eventPool->events.size());
+
+    auto cpuIntrinsicsFillCount = CpuIntrinsicsTests::nonTemporalFillCounter.load();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventPoolHostSignal(eventPool->toHandle()));
+    EXPECT_LT(cpuIntrinsicsFillCount, CpuIntrinsicsTests::nonTemporalFillCounter.load());
+    for (auto hEvent : events) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, Event::fromHandle(hEvent)->queryStatus());
+    }
+
+    Event::fromHandle(events[0])->increaseKernelCount();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventPoolHostReset(eventPool->toHandle()));
+    for (auto hEvent : events) {
+        EXPECT_EQ(ZE_RESULT_NOT_READY, Event::fromHandle(hEvent)->queryStatus());
+        EXPECT_EQ(1u, Event::fromHandle(hEvent)->getKernelCount());
+    }
+
+    for (auto hEvent : events) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, Event::fromHandle(hEvent)->destroy());
+    }
+    EXPECT_TRUE(eventPool->events.empty());
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, zexEventPoolHostSignal(nullptr));
+}
+
 TEST_F(EventCreate, givenEventWhenSignaledAndResetFromTheHostThenCorrectDataAndOffsetAreSet) {
     ze_event_pool_desc_t eventPoolDesc = {};
     eventPoolDesc.count = 1;
@@ -1445,6 +1582,48 @@ TEST_F(TimestampEventCreate, givenEventWhenQueryingTimestampExpThenCorrectDataSe
     }
 }
 
+TEST_F(TimestampEventCreate, givenSignaledAndNotSignaledEventsWhenQueryingKernelTimestampsInBatchThenArraysAreFilledPerEvent) {
+    typename MockTimestampPackets32::Packet packetData;
+    packetData.contextStart = 1u;
+    packetData.contextEnd = 2u;
+    packetData.globalStart = 3u;
+    packetData.globalEnd = 4u;
+    event->hostAddress = &packetData;
+
+    ze_event_desc_t eventDesc = {};
+    auto notSignaledEvent = std::unique_ptr<L0::Event>(L0::Event::create<uint32_t>(eventPool.get(), &eventDesc, device));
+    ASSERT_NE(nullptr, notSignaledEvent);
+
+    ze_event_handle_t events[] = {event->toHandle(), notSignaledEvent->toHandle()};
+    uint64_t globalStart[2] = {}, globalEnd[2] = {}, contextStart[2] = {}, contextEnd[2] = {};
+    ze_result_t results[2] = {};
+    zex_kernel_timestamps_t timestamps = {globalStart, globalEnd, contextStart, contextEnd, results};
+
+    auto result = zexEventQueryKernelTimestamps(nullptr, 2u, events, &timestamps);
+    EXPECT_EQ(ZE_RESULT_NOT_READY, result);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, results[0]);
+    EXPECT_EQ(ZE_RESULT_NOT_READY, results[1]);
+    EXPECT_EQ(3u, globalStart[0]);
+    EXPECT_EQ(4u, globalEnd[0]);
+    EXPECT_EQ(0u, globalStart[1]);
+    EXPECT_EQ(0u, globalEnd[1]);
+
+    ze_kernel_timestamp_result_t single = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryKernelTimestamp(&single));
+    EXPECT_EQ(single.context.kernelStart, contextStart[0]);
+    EXPECT_EQ(single.context.kernelEnd, contextEnd[0]);
+
+    const double resolution = device->getNEODevice()->getDeviceInfo().profilingTimerResolution;
+    result = zexEventQueryKernelTimestamps(device->toHandle(), 1u, events, &timestamps);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(static_cast<uint64_t>(3u * resolution), globalStart[0]);
+    EXPECT_EQ(static_cast<uint64_t>(4u * resolution), globalEnd[0]);
+    EXPECT_EQ(static_cast<uint64_t>(single.context.kernelStart * resolution), contextStart[0]);
+    EXPECT_EQ(static_cast<uint64_t>(single.context.kernelEnd * resolution), contextEnd[0]);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zexEventQueryKernelTimestamps(nullptr, 1u, nullptr, &timestamps));
+}
+
 TEST_F(TimestampEventCreate, givenTimeStampEventUsedOnTwoKernelsWhenL3FlushSetOnFirstKernelThenDoNotUseSecondPacketOfFirstKernel) {
     typename MockTimestampPackets32::Packet packetData[4];
     event->hostAddress = packetData;
@@ -129,5 +129,23 @@ TEST_F(FabricVertexFixture, givenFabricVerticesAreCreatedWhenzeFabricVertexGetPr
     }
 }
 
+TEST_F(FabricVertexFixture, givenFabricVerticesOfRootDevicesWhenCheckingPeerLinkThenLinkIsAvailableOnlyBetweenP2pCapableDifferentRootDevices) {
+    auto deviceImp0 = static_cast<L0::DeviceImp *>(driverHandle->devices[0]);
+    auto deviceImp1 = static_cast<L0::DeviceImp *>(driverHandle->devices[1]);
+    for (auto deviceImp : {deviceImp0, deviceImp1}) {
+        deviceImp->getNEODevice()->getRootDeviceEnvironment().getMutableHardwareInfo()->capabilityTable.p2pAccessSupported = true;
+    }
+
+    EXPECT_TRUE(deviceImp0->fabricVertex->isPeerLinkAvailable(*deviceImp1->fabricVertex));
+    EXPECT_TRUE(deviceImp1->fabricVertex->isPeerLinkAvailable(*deviceImp0->fabricVertex));
+    EXPECT_FALSE(deviceImp0->fabricVertex->isPeerLinkAvailable(*deviceImp0->fabricVertex));
+
+    auto subDeviceImp = static_cast<L0::DeviceImp *>(deviceImp0->subDevices[0]);
+    EXPECT_FALSE(deviceImp0->fabricVertex->isPeerLinkAvailable(*subDeviceImp->fabricVertex));
+
+    deviceImp1->getNEODevice()->getRootDeviceEnvironment().getMutableHardwareInfo()->capabilityTable.p2pAccessSupported = false;
+    EXPECT_FALSE(deviceImp0->fabricVertex->isPeerLinkAvailable(*deviceImp1->fabricVertex));
+}
+
 } // namespace ult
-} // namespace L0
\ No newline at end of file
+} // namespace L0
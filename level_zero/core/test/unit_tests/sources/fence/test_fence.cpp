@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_csr.h"
 #include "shared/test/common/test_macros/hw_test.h"
@@ -348,5 +349,44 @@ TEST_F(FenceTest, givenFenceWhenResettingThenTaskCountIsReset) {
     delete fence;
 }
 
+TEST_F(FenceTest, givenFencePoolEnabledWhenDestroyingAndCreatingFenceThenFenceObjectIsReusedAndReset) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.FencePoolSize.set(1);
+
+    auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    Mock<CommandQueue> cmdqueue(device, csr.get());
+    ze_fence_desc_t desc = {};
+
+    auto fence = whiteboxCast(Fence::create(&cmdqueue, &desc));
+    auto secondFence = Fence::create(&cmdqueue, &desc);
+    ASSERT_NE(fence, nullptr);
+    fence->taskCount = 1;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, fence->destroy());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, secondFence->destroy());
+    ASSERT_EQ(1u, cmdqueue.fencePool.size());
+    EXPECT_EQ(fence, cmdqueue.fencePool[0]);
+
+    desc.flags = ZE_FENCE_FLAG_SIGNALED;
+    auto reusedFence = whiteboxCast(Fence::create(&cmdqueue, &desc));
+    EXPECT_EQ(fence, reusedFence);
+    EXPECT_EQ(0u, reusedFence->taskCount);
+    EXPECT_TRUE(cmdqueue.fencePool.empty());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, reusedFence->destroy());
+    EXPECT_EQ(1u, cmdqueue.fencePool.size());
+}
+
+TEST_F(FenceTest, givenDefaultSettingsWhenDestroyingFenceThenFenceIsNotPooled) {
+    auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    Mock<CommandQueue> cmdqueue(device, csr.get());
+    ze_fence_desc_t desc = {};
+
+    auto fence = Fence::create(&cmdqueue, &desc);
+    ASSERT_NE(fence, nullptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, fence->destroy());
+    EXPECT_TRUE(cmdqueue.fencePool.empty());
+}
+
 } // namespace ult
 } // namespace L0
@@ -21,6 +21,7 @@
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include "level_zero/api/driver_experimental/public/zex_api.h"
 #include "level_zero/core/source/image/image_format_desc_helper.h"
 #include "level_zero/core/source/image/image_hw.h"
 #include "level_zero/core/source/kernel/kernel_hw.h"
@@ -233,6 +234,40 @@ TEST_F(KernelImpSetGroupSizeTest, givenIncorrectGroupSizeWhenSettingGroupSizeThe
     EXPECT_EQ(ZE_RESULT_ERROR_INVALID_GROUP_SIZE_DIMENSION, ret);
 }
 
+TEST_F(KernelImpSetGroupSizeTest, givenIncorrectGroupSizeWhenSettingGroupSizeThenPreviouslySetGroupSizeIsKept) {
+    Mock<Kernel> mockKernel;
+    Mock<Module> mockModule(this->device, nullptr);
+    mockKernel.descriptor.kernelAttributes.simdSize = 1;
+    mockKernel.descriptor.kernelAttributes.requiredWorkgroupSize[0] = 2;
+    mockKernel.module = &mockModule;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, mockKernel.setGroupSize(2, 3, 5));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_GROUP_SIZE_DIMENSION, mockKernel.setGroupSize(1, 3, 5));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_GROUP_SIZE_DIMENSION, mockKernel.setGroupSize(1, 3, 5));
+    EXPECT_EQ(2u, mockKernel.groupSize[0]);
+    EXPECT_EQ(3u, mockKernel.groupSize[1]);
+    EXPECT_EQ(5u, mockKernel.groupSize[2]);
+}
+
+TEST_F(KernelImpSetGroupSizeTest, givenUnchangedGroupSizeWhenSettingGroupSizeAgainThenLocalIdsAreNotGeneratedAgain) {
+    Mock<Kernel> mockKernel;
+    Mock<Module> mockModule(this->device, nullptr);
+    mockKernel.descriptor.kernelAttributes.simdSize = 1;
+    mockKernel.descriptor.kernelAttributes.numLocalIdChannels = 3;
+    mockKernel.module = &mockModule;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, mockKernel.setGroupSize(2, 3, 5));
+    auto perThreadData = mockKernel.perThreadDataForWholeThreadGroup;
+    ASSERT_NE(nullptr, perThreadData);
+    perThreadData[0] = 0xff;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, mockKernel.setGroupSize(2, 3, 5));
+    EXPECT_EQ(0xff, perThreadData[0]);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, mockKernel.setGroupSize(5, 3, 2));
+    EXPECT_EQ(0u, mockKernel.perThreadDataForWholeThreadGroup[0]);
+}
+
 TEST_F(KernelImpSetGroupSizeTest, givenZeroGroupSizeWhenSettingGroupSizeThenInvalidArgumentErrorIsReturned) {
     Mock<Kernel> mockKernel;
     Mock<Module> mockModule(this->device, nullptr);
@@ -1180,6 +1215,40 @@ class KernelPropertiesTests : public ModuleFixture, public ::testing::Test {
     MockKernel *kernel = nullptr;
 };
 
+TEST_F(KernelPropertiesTests, givenKernelWhenCloningThenCloneSharesImmutableDataAndHeapTemplates) {
+    ze_kernel_handle_t clonedKernelHandle = nullptr;
+    ze_result_t res = zexKernelClone(kernelHandle, &clonedKernelHandle);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+    ASSERT_NE(nullptr, clonedKernelHandle);
+    EXPECT_NE(kernelHandle, clonedKernelHandle);
+
+    auto clonedKernel = static_cast<KernelImp *>(L0::Kernel::fromHandle(clonedKernelHandle));
+    EXPECT_EQ(kernel->getImmutableData(), clonedKernel->getImmutableData());
+    EXPECT_EQ(kernel->getCrossThreadDataSize(), clonedKernel->getCrossThreadDataSize());
+    EXPECT_NE(kernel->getCrossThreadData(), clonedKernel->getCrossThreadData());
+    EXPECT_EQ(0, memcmp(kernel->getCrossThreadData(), clonedKernel->getCrossThreadData(), kernel->getCrossThreadDataSize()));
+
+    ASSERT_EQ(kernel->getSurfaceStateHeapDataSize(), clonedKernel->getSurfaceStateHeapDataSize());
+    if (kernel->getSurfaceStateHeapDataSize() > 0) {
+        if (!module->isDebugEnabled() && kernel->getKernelDescriptor().kernelAttributes.perHwThreadPrivateMemorySize == 0) {
+            EXPECT_EQ(kernel->getImmutableData()->getSurfaceStateHeapTemplate(), clonedKernel->getSurfaceStateHeapData());
+        }
+        EXPECT_EQ(0, memcmp(kernel->getSurfaceStateHeapData(), clonedKernel->getSurfaceStateHeapData(), kernel->getSurfaceStateHeapDataSize()));
+    }
+
+    uint32_t groupSize[3] = {};
+    res = clonedKernel->suggestGroupSize(64, 1, 1, &groupSize[0], &groupSize[1], &groupSize[2]);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+
+    clonedKernel->destroy();
+}
+
+TEST_F(KernelPropertiesTests, givenNullHandlesWhenCloningKernelThenErrorIsReturned) {
+    ze_kernel_handle_t clonedKernelHandle = nullptr;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, zexKernelClone(nullptr, &clonedKernelHandle));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, zexKernelClone(kernelHandle, nullptr));
+}
+
 TEST_F(KernelPropertiesTests, givenKernelThenCorrectNameIsRetrieved) {
     size_t kernelSize = 0;
     ze_result_t res = kernel->getKernelName(&kernelSize, nullptr);
@@ -2142,6 +2211,51 @@ TEST_F(KernelBindlessUncachedMemoryTests,
     }
 }
 
+TEST_F(KernelBindlessUncachedMemoryTests,
+       givenAllocationAdvisedAsUncachedSetAsArgumentWhenAdviceIsClearedAndArgumentIsSetAgainThenRequiresUncachedMocsIsCorrectlySet) {
+    ze_kernel_desc_t desc = {};
+    desc.pKernelName = kernelName.c_str();
+    MyMockKernel mockKernel;
+
+    mockKernel.module = module.get();
+    mockKernel.initialize(&desc);
+
+    auto &arg = const_cast<NEO::ArgDescPointer &>(mockKernel.kernelImmData->getDescriptor().payloadMappings.explicitArgs[0].as<NEO::ArgDescPointer>());
+    arg.bindless = undefined<CrossThreadDataOffset>;
+    arg.bindful = undefined<SurfaceStateHeapOffset>;
+
+    void *devicePtr = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ze_result_t res = context->allocDeviceMem(device->toHandle(),
+                                              &deviceDesc,
+                                              16384u,
+                                              0u,
+                                              &devicePtr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, res);
+
+    auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(devicePtr);
+    ASSERT_NE(nullptr, allocData);
+    auto alloc = allocData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+    EXPECT_NE(nullptr, alloc);
+
+    auto deviceImp = static_cast<DeviceImp *>(device);
+    NEO::MemAdviseFlags flags;
+    flags.cached_memory = 0;
+    deviceImp->memAdviseSharedAllocations[allocData] = flags;
+
+    mockKernel.setArgBufferWithAlloc(0, 0x1234, alloc);
+    EXPECT_TRUE(mockKernel.getKernelRequiresUncachedMocs());
+
+    flags.cached_memory = 1;
+    deviceImp->memAdviseSharedAllocations[allocData] = flags;
+
+    mockKernel.setArgBufferWithAlloc(0, 0x1234, alloc);
+    EXPECT_FALSE(mockKernel.getKernelRequiresUncachedMocs());
+
+    context->freeMem(devicePtr);
+    EXPECT_EQ(deviceImp->memAdviseSharedAllocations.end(), deviceImp->memAdviseSharedAllocations.find(allocData));
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 struct MyMockImage : public WhiteBox<::L0::ImageCoreFamily<gfxCoreFamily>> {
     void copySurfaceStateToSSH(void *surfaceStateHeap, const uint32_t surfaceStateOffset, bool isMediaBlockArg) override {
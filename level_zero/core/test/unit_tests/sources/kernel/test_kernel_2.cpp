@@ -60,6 +60,49 @@ TEST_F(KernelImp, GivenCrossThreadDataThenIsCorrectlyPatchedWithGlobalWorkSizeAn
     alignedFree(crossThreadData);
 }
 
+TEST_F(KernelImp, givenUnchangedGroupCountAndGroupSizeWhenSettingGroupCountAgainThenCrossThreadDataIsPatchedOnlyAfterDimensionsChange) {
+    uint32_t *crossThreadData =
+        reinterpret_cast<uint32_t *>(alignedMalloc(sizeof(uint32_t[6]), 32));
+
+    WhiteBox<::L0::KernelImmutableData> kernelInfo = {};
+    NEO::KernelDescriptor descriptor;
+    kernelInfo.kernelDescriptor = &descriptor;
+    for (uint32_t i = 0u; i < 3u; i++) {
+        kernelInfo.kernelDescriptor->payloadMappings.dispatchTraits.globalWorkSize[i] = i * sizeof(uint32_t);
+        kernelInfo.kernelDescriptor->payloadMappings.dispatchTraits.numWorkGroups[i] = (i + 3) * sizeof(uint32_t);
+    }
+
+    Mock<Kernel> kernel;
+    kernel.kernelImmData = &kernelInfo;
+    kernel.crossThreadData.reset(reinterpret_cast<uint8_t *>(crossThreadData));
+    kernel.crossThreadDataSize = sizeof(uint32_t[6]);
+    kernel.groupSize[0] = 2;
+    kernel.groupSize[1] = 3;
+    kernel.groupSize[2] = 5;
+
+    kernel.KernelImp::setGroupCount(7, 11, 13);
+    EXPECT_EQ(2U * 7U, crossThreadData[0]);
+    EXPECT_EQ(7U, crossThreadData[3]);
+
+    crossThreadData[0] = 0u;
+    crossThreadData[3] = 0u;
+    kernel.KernelImp::setGroupCount(7, 11, 13);
+    EXPECT_EQ(0U, crossThreadData[0]);
+    EXPECT_EQ(0U, crossThreadData[3]);
+
+    kernel.groupSize[0] = 4;
+    kernel.KernelImp::setGroupCount(7, 11, 13);
+    EXPECT_EQ(4U * 7U, crossThreadData[0]);
+    EXPECT_EQ(7U, crossThreadData[3]);
+
+    kernel.KernelImp::setGroupCount(1, 11, 13);
+    EXPECT_EQ(4U, crossThreadData[0]);
+    EXPECT_EQ(1U, crossThreadData[3]);
+
+    kernel.crossThreadData.release();
+    alignedFree(crossThreadData);
+}
+
 TEST_F(KernelImp, givenExecutionMaskWithoutReminderWhenProgrammingItsValueThenSetValidNumberOfBits) {
     NEO::KernelDescriptor descriptor = {};
     WhiteBox<KernelImmutableData> kernelInfo = {};
@@ -106,6 +149,46 @@ TEST_F(KernelImp, WhenSuggestingGroupSizeThenClampToMaxGroupSize) {
     EXPECT_EQ(1U, groupSize[2]);
 }
 
+TEST_F(KernelImp, GivenCachedGroupSizeWhenSuggestingGroupSizeForSameGlobalSizeThenCachedGroupSizeIsReturned) {
+    DebugManagerStateRestore restorer;
+
+    WhiteBox<KernelImmutableData> kernelInfo = {};
+    NEO::KernelDescriptor descriptor;
+    kernelInfo.kernelDescriptor = &descriptor;
+
+    Mock<Module> module(device, nullptr);
+    module.getMaxGroupSizeResult = 8;
+
+    Mock<Kernel> kernel;
+    kernel.kernelImmData = &kernelInfo;
+    kernel.module = &module;
+
+    NEO::WorkGroupSizeCacheKey cacheKey;
+    cacheKey.globalSize[0] = 256u;
+    cacheKey.globalSize[1] = 1u;
+    cacheKey.globalSize[2] = 1u;
+    cacheKey.maxWorkGroupSize = 8u;
+    cacheKey.workDim = 1u;
+    size_t cachedGroupSize[3] = {4u, 1u, 1u};
+    kernel.groupSizeCache.store(cacheKey, cachedGroupSize);
+
+    uint32_t groupSize[3];
+    kernel.KernelImp::suggestGroupSize(256, 1, 1, groupSize, groupSize + 1, groupSize + 2);
+    EXPECT_EQ(4U, groupSize[0]);
+
+    NEO::DebugManager.flags.EnableWorkGroupSizeCache.set(0);
+    kernel.KernelImp::suggestGroupSize(256, 1, 1, groupSize, groupSize + 1, groupSize + 2);
+    EXPECT_EQ(8U, groupSize[0]);
+
+    NEO::DebugManager.flags.EnableWorkGroupSizeCache.set(-1);
+    kernel.KernelImp::suggestGroupSize(128, 1, 1, groupSize, groupSize + 1, groupSize + 2);
+    EXPECT_EQ(8U, groupSize[0]);
+    size_t storedGroupSize[3] = {};
+    cacheKey.globalSize[0] = 128u;
+    EXPECT_TRUE(kernel.groupSizeCache.find(cacheKey, storedGroupSize));
+    EXPECT_EQ(8u, storedGroupSize[0]);
+}
+
 class KernelImpSuggestGroupSize : public DeviceFixture, public ::testing::TestWithParam<uint32_t> {
   public:
     void SetUp() override {
@@ -376,5 +459,29 @@ TEST_F(KernelImpSuggestMaxCooperativeGroupCountTests, GivenUsedSlmSizeWhenCalcul
     EXPECT_EQ(expected, getMaxWorkGroupCount());
 }
 
+TEST_F(KernelImpSuggestMaxCooperativeGroupCountTests, GivenUnchangedGroupSizeWhenCalculatingMaxCooperativeGroupCountAgainThenCachedResultIsReturned) {
+    Mock<Kernel> kernel;
+    kernel.kernelImmData = &kernelInfo;
+    auto module = std::make_unique<ModuleImp>(device, nullptr, ModuleType::User);
+    kernel.module = module.get();
+    kernel.groupSize[0] = lws[0];
+    kernel.groupSize[1] = lws[1];
+    kernel.groupSize[2] = lws[2];
+
+    uint32_t totalGroupCount = 0;
+    kernel.KernelImp::suggestMaxCooperativeGroupCount(&totalGroupCount, NEO::EngineGroupType::CooperativeCompute, true);
+    auto expected = availableThreadCount / Math::divideAndRoundUp(lws[0] * lws[1] * lws[2], simd);
+    EXPECT_EQ(expected, totalGroupCount);
+
+    kernelInfo.kernelDescriptor->kernelAttributes.barrierCount = 1;
+    totalGroupCount = 0;
+    kernel.KernelImp::suggestMaxCooperativeGroupCount(&totalGroupCount, NEO::EngineGroupType::CooperativeCompute, true);
+    EXPECT_EQ(expected, totalGroupCount);
+
+    kernel.groupSize[0] = 2 * simd;
+    kernel.KernelImp::suggestMaxCooperativeGroupCount(&totalGroupCount, NEO::EngineGroupType::CooperativeCompute, true);
+    EXPECT_EQ(std::min(availableThreadCount / 2, dssCount * maxBarrierCount), totalGroupCount);
+}
+
 } // namespace ult
 } // namespace L0
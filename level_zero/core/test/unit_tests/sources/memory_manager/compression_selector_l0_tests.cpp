@@ -5,8 +5,10 @@
  *
  */
 
+#include "shared/source/helpers/hw_helper.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/compression_selector.h"
+#include "shared/source/os_interface/hw_info_config.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/default_hw_info.h"
 #include "shared/test/common/test_macros/test.h"
@@ -74,5 +76,70 @@ TEST(CompressionSelectorL0Tests, GivenEnabledDebugFlagWhenProvidingOtherAllocati
     EXPECT_FALSE(NEO::CompressionSelector::preferCompressedAllocation(properties, *defaultHwInfo));
 }
 
+TEST(CompressionSelectorL0Tests, GivenDefaultDebugFlagWhenProvidingLargeUsmDeviceAllocationThenCompressionFollowsPlatformCapabilities) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.EnableStatelessCompression.set(1);
+
+    HardwareInfo hwInfo = *defaultHwInfo;
+    hwInfo.capabilityTable.ftrRenderCompressedBuffers = true;
+    const size_t size = NEO::CompressionSelector::defaultMinDeviceOnlyAllocationSize;
+
+    DeviceBitfield deviceBitfield{0x0};
+    AllocationProperties properties(0, size,
+                                    AllocationType::BUFFER,
+                                    deviceBitfield);
+    properties.flags.isUSMDeviceAllocation = 1u;
+
+    auto expectedCompression = HwHelper::get(hwInfo.platform.eRenderCoreFamily).isBufferSizeSuitableForCompression(size, hwInfo) &&
+                               HwInfoConfig::get(hwInfo.platform.eProductFamily)->allowStatelessCompression(hwInfo);
+    EXPECT_EQ(expectedCompression, NEO::CompressionSelector::preferCompressedAllocation(properties, hwInfo));
+
+    properties.size = size - 1;
+    EXPECT_FALSE(NEO::CompressionSelector::preferCompressedAllocation(properties, hwInfo));
+
+    hwInfo.capabilityTable.ftrRenderCompressedBuffers = false;
+    properties.size = size;
+    EXPECT_FALSE(NEO::CompressionSelector::preferCompressedAllocation(properties, hwInfo));
+}
+
+TEST(CompressionSelectorL0Tests, GivenDisabledAdaptiveCompressionPolicyWhenProvidingLargeUsmDeviceAllocationThenExpectCompressionDisabled) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.EnableAdaptiveCompressionPolicy.set(0);
+    DebugManager.flags.OverrideBufferSuitableForRenderCompression.set(1);
+
+    HardwareInfo hwInfo = *defaultHwInfo;
+    hwInfo.capabilityTable.ftrRenderCompressedBuffers = true;
+
+    DeviceBitfield deviceBitfield{0x0};
+    AllocationProperties properties(0, NEO::CompressionSelector::defaultMinDeviceOnlyAllocationSize,
+                                    AllocationType::BUFFER,
+                                    deviceBitfield);
+    properties.flags.isUSMDeviceAllocation = 1u;
+
+    EXPECT_FALSE(NEO::CompressionSelector::preferCompressedAllocation(properties, hwInfo));
+}
+
+TEST(CompressionSelectorL0Tests, GivenForcedAdaptiveCompressionPolicyWhenProvidingUsmAllocationsThenOnlyLargeDeviceOnlyAllocationIsCompressed) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.EnableAdaptiveCompressionPolicy.set(1);
+    DebugManager.flags.AdaptiveCompressionMinAllocationSizeInKb.set(64);
+    DebugManager.flags.OverrideBufferSuitableForRenderCompression.set(1);
+
+    HardwareInfo hwInfo = *defaultHwInfo;
+    hwInfo.capabilityTable.ftrRenderCompressedBuffers = true;
+
+    DeviceBitfield deviceBitfield{0x0};
+    AllocationProperties properties(0, 64 * MemoryConstants::kiloByte,
+                                    AllocationType::BUFFER,
+                                    deviceBitfield);
+    properties.flags.isUSMDeviceAllocation = 1u;
+    EXPECT_TRUE(NEO::CompressionSelector::preferCompressedAllocation(properties, hwInfo));
+
+    AllocationProperties sharedProperties(0, 64 * MemoryConstants::kiloByte,
+                                          AllocationType::SVM_GPU,
+                                          deviceBitfield);
+    EXPECT_FALSE(NEO::CompressionSelector::preferCompressedAllocation(sharedProperties, hwInfo));
+}
+
 } // namespace ult
 } // namespace L0
@@ -756,6 +756,12 @@ TEST_F(ModuleSpecConstantsCharTests, givenSpecializationConstantsSetWithCharSize
     runTestStatic();
 }
 
+TEST_F(ModuleSpecConstantsLongTests, givenParallelProgramBuildWhenStaticLinkedModuleHasSpecializationConstantsThenTheyAreCorrectlyPassedToTheCompiler) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ParallelProgramBuild.set(1);
+    runTestStatic();
+}
+
 TEST_F(ModuleSpecConstantsLongTests, givenSpecializationConstantsSetWhenCompilerReturnsErrorFromStaticLinkThenModuleInitFails) {
     class FailingMockCompilerInterfaceWithSpecConstants : public MockCompilerInterfaceWithSpecConstants<uint32_t, uint64_t> {
       public:
@@ -1053,6 +1059,69 @@ HWTEST_F(ModuleLinkingTest, givenFailureDuringLinkingWhenCreatingModuleThenModul
     EXPECT_FALSE(success);
 }
 
+using ModuleAsyncBuildTest = Test<DeviceFixture>;
+
+TEST_F(ModuleAsyncBuildTest, givenAsyncModuleBuildThreadsWhenCheckingIfAsyncBuildIsAllowedThenOnlyUserSpirvModulesWithoutBuildLogAreBuiltAsynchronously) {
+    DebugManagerStateRestore restorer;
+    uint8_t spirvData{};
+    ze_module_desc_t moduleDesc = {};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pInputModule = &spirvData;
+    moduleDesc.inputSize = sizeof(spirvData);
+
+    Module userModule(device, nullptr, ModuleType::User);
+    EXPECT_FALSE(userModule.isAsyncBuildAllowed(&moduleDesc));
+
+    DebugManager.flags.AsyncModuleBuildThreads.set(2);
+    if (device->getL0Debugger() || neoDevice->getSourceLevelDebugger()) {
+        GTEST_SKIP();
+    }
+    EXPECT_TRUE(userModule.isAsyncBuildAllowed(&moduleDesc));
+
+    auto moduleBuildLog = ModuleBuildLog::create();
+    Module moduleWithBuildLog(device, moduleBuildLog, ModuleType::User);
+    EXPECT_FALSE(moduleWithBuildLog.isAsyncBuildAllowed(&moduleDesc));
+    moduleBuildLog->destroy();
+
+    Module builtinModule(device, nullptr, ModuleType::Builtin);
+    EXPECT_FALSE(builtinModule.isAsyncBuildAllowed(&moduleDesc));
+
+    moduleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+    EXPECT_FALSE(userModule.isAsyncBuildAllowed(&moduleDesc));
+}
+
+HWTEST_F(ModuleAsyncBuildTest, givenFailureDuringAsyncBuildWhenModuleIsUsedThenBuildFailureIsReturned) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.AsyncModuleBuildThreads.set(1);
+
+    auto mockCompiler = new MockCompilerInterface();
+    auto rootDeviceEnvironment = neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[0].get();
+    rootDeviceEnvironment->compilerInterface.reset(mockCompiler);
+
+    auto mockTranslationUnit = new MockModuleTranslationUnit(device);
+    auto linkerInput = std::make_unique<::WhiteBox<NEO::LinkerInput>>();
+    linkerInput->valid = false;
+    mockTranslationUnit->programInfo.linkerInput = std::move(linkerInput);
+
+    auto spirvData = std::make_unique<uint8_t>(0u);
+    ze_module_desc_t moduleDesc = {};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pInputModule = spirvData.get();
+    moduleDesc.inputSize = sizeof(uint8_t);
+
+    auto module = new Module(device, nullptr, ModuleType::User);
+    module->translationUnit.reset(mockTranslationUnit);
+    module->initializeAsync(&moduleDesc, neoDevice);
+    spirvData.reset();
+
+    ze_module_properties_t moduleProperties = {};
+    EXPECT_EQ(ZE_RESULT_ERROR_MODULE_BUILD_FAILURE, module->getProperties(&moduleProperties));
+    uint32_t kernelsCount = 0u;
+    EXPECT_EQ(ZE_RESULT_ERROR_MODULE_BUILD_FAILURE, module->getKernelNames(&kernelsCount, nullptr));
+    EXPECT_FALSE(module->waitForBuild());
+    module->destroy();
+}
+
 HWTEST_F(ModuleLinkingTest, givenRemainingUnresolvedSymbolsDuringLinkingWhenCreatingModuleThenModuleIsNotLinkedFully) {
     auto mockCompiler = new MockCompilerInterface();
     auto rootDeviceEnvironment = neoDevice->getExecutionEnvironment()->rootDeviceEnvironments[0].get();
@@ -2367,6 +2436,171 @@ TEST(ModuleBuildLog, WhenTooSmallBufferIsPassedToGetStringThenErrorIsReturned) {
     EXPECT_EQ(ZE_RESULT_SUCCESS, destroyResult);
 }
 
+struct ModuleIsaSuballocationTest : public ModuleFixture, public ::testing::Test {
+    void SetUp() override {
+        DebugManager.flags.EnableModuleIsaSuballocation.set(1);
+        ModuleFixture::setUp();
+    }
+
+    void TearDown() override {
+        ModuleFixture::tearDown();
+    }
+
+    DebugManagerStateRestore restorer;
+};
+
+TEST_F(ModuleIsaSuballocationTest, givenIsaSuballocationEnabledWhenModuleIsCreatedThenIsaOfKernelsIsCopiedToModuleParentAllocation) {
+    if (device->getNEODevice()->getDebugger()) {
+        GTEST_SKIP();
+    }
+    auto whiteboxModule = whiteboxCast(module.get());
+    auto parentAllocation = whiteboxModule->kernelsIsaParentAllocation;
+    ASSERT_NE(nullptr, parentAllocation);
+
+    for (auto &kernelImmData : whiteboxModule->kernelImmDatas) {
+        auto &heapInfo = kernelImmData->getKernelInfo()->heapInfo;
+        auto offset = kernelImmData->getIsaOffsetInParentAllocation();
+        EXPECT_EQ(parentAllocation, kernelImmData->getIsaGraphicsAllocation());
+        EXPECT_EQ(0u, offset % MemoryConstants::cacheLineSize);
+        EXPECT_EQ(heapInfo.KernelHeapSize, kernelImmData->getIsaSize());
+        EXPECT_EQ(parentAllocation->getGpuAddress() + offset, kernelImmData->getIsaGpuAddress());
+        EXPECT_TRUE(kernelImmData->isIsaCopiedToAllocation());
+        EXPECT_EQ(0, memcmp(ptrOffset(parentAllocation->getUnderlyingBuffer(), offset), heapInfo.pKernelHeap, heapInfo.KernelHeapSize));
+    }
+
+    ze_kernel_desc_t kernelDesc = {};
+    kernelDesc.pKernelName = kernelName.c_str();
+    ze_kernel_handle_t kernelHandle = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module->createKernel(&kernelDesc, &kernelHandle));
+    auto kernel = Kernel::fromHandle(kernelHandle);
+    EXPECT_EQ(parentAllocation, kernel->getIsaAllocation());
+    EXPECT_EQ(kernel->getImmutableData()->getIsaOffsetInParentAllocation(), kernel->getIsaOffsetInParentAllocation());
+    kernel->destroy();
+}
+
+TEST_F(ModuleTest, givenIsaSuballocationDisabledByDefaultWhenModuleIsCreatedThenEachKernelHasOwnIsaAllocation) {
+    auto whiteboxModule = whiteboxCast(module.get());
+    EXPECT_EQ(nullptr, whiteboxModule->kernelsIsaParentAllocation);
+    for (auto &kernelImmData : whiteboxModule->kernelImmDatas) {
+        EXPECT_NE(nullptr, kernelImmData->getIsaGraphicsAllocation());
+        EXPECT_EQ(0u, kernelImmData->getIsaOffsetInParentAllocation());
+    }
+}
+
+struct ModuleIsaDeduplicationTest : public ModuleFixture, public ::testing::Test {
+    void SetUp() override {
+        DebugManager.flags.EnableIsaDeduplication.set(1);
+        ModuleFixture::setUp();
+    }
+
+    void TearDown() override {
+        ModuleFixture::tearDown();
+    }
+
+    std::unique_ptr<L0::Module> createModule() {
+        ze_module_desc_t moduleDesc = {};
+        moduleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+        moduleDesc.pInputModule = reinterpret_cast<const uint8_t *>(zebinData->storage.data());
+        moduleDesc.inputSize = zebinData->storage.size();
+        return std::unique_ptr<L0::Module>(Module::create(device, &moduleDesc, nullptr, ModuleType::User));
+    }
+
+    DebugManagerStateRestore restorer;
+};
+
+TEST_F(ModuleIsaDeduplicationTest, givenIsaDeduplicationEnabledWhenModulesWithIdenticalKernelsAreCreatedThenIsaAllocationsAreSharedUntilLastModuleIsDestroyed) {
+    if (device->getNEODevice()->getDebugger()) {
+        GTEST_SKIP();
+    }
+    auto memoryManager = device->getNEODevice()->getMemoryManager();
+    auto &sharedIsaAllocations = memoryManager->getSharedIsaAllocationMap();
+    auto firstModule = whiteboxCast(module.get());
+    ASSERT_EQ(firstModule->kernelImmDatas.size(), firstModule->deduplicatedIsaAllocations.size());
+    EXPECT_EQ(firstModule->kernelImmDatas.size(), sharedIsaAllocations.size());
+
+    auto secondModule = createModule();
+    ASSERT_NE(nullptr, secondModule);
+    auto secondModuleWhitebox = whiteboxCast(secondModule.get());
+    ASSERT_EQ(firstModule->kernelImmDatas.size(), secondModuleWhitebox->kernelImmDatas.size());
+    EXPECT_EQ(firstModule->kernelImmDatas.size(), sharedIsaAllocations.size());
+
+    for (size_t i = 0; i < firstModule->kernelImmDatas.size(); i++) {
+        auto &kernelImmData = firstModule->kernelImmDatas[i];
+        auto &heapInfo = kernelImmData->getKernelInfo()->heapInfo;
+        EXPECT_TRUE(kernelImmData->isIsaDeduplicated());
+        EXPECT_TRUE(kernelImmData->isIsaCopiedToAllocation());
+        EXPECT_EQ(0u, kernelImmData->getIsaOffsetInParentAllocation());
+        EXPECT_EQ(heapInfo.KernelHeapSize, kernelImmData->getIsaSize());
+        EXPECT_EQ(kernelImmData->getIsaGraphicsAllocation(), secondModuleWhitebox->kernelImmDatas[i]->getIsaGraphicsAllocation());
+        EXPECT_EQ(0, memcmp(kernelImmData->getIsaGraphicsAllocation()->getUnderlyingBuffer(), heapInfo.pKernelHeap, heapInfo.KernelHeapSize));
+    }
+    for (auto &sharedIsa : sharedIsaAllocations) {
+        EXPECT_EQ(2u, sharedIsa.second.reuseCounter);
+    }
+
+    secondModule.reset();
+    EXPECT_EQ(firstModule->kernelImmDatas.size(), sharedIsaAllocations.size());
+    for (auto &sharedIsa : sharedIsaAllocations) {
+        EXPECT_EQ(1u, sharedIsa.second.reuseCounter);
+    }
+
+    module.reset();
+    EXPECT_TRUE(sharedIsaAllocations.empty());
+}
+
+TEST_F(ModuleIsaDeduplicationTest, givenIsaDeduplicationAndIsaSuballocationEnabledWhenModuleIsCreatedThenIsaIsNotDeduplicated) {
+    DebugManager.flags.EnableModuleIsaSuballocation.set(1);
+    module.reset();
+    auto newModule = createModule();
+    ASSERT_NE(nullptr, newModule);
+    auto whiteboxModule = whiteboxCast(newModule.get());
+    if (nullptr == whiteboxModule->kernelsIsaParentAllocation) {
+        GTEST_SKIP();
+    }
+    EXPECT_TRUE(whiteboxModule->deduplicatedIsaAllocations.empty());
+    for (auto &kernelImmData : whiteboxModule->kernelImmDatas) {
+        EXPECT_FALSE(kernelImmData->isIsaDeduplicated());
+        EXPECT_EQ(whiteboxModule->kernelsIsaParentAllocation, kernelImmData->getIsaGraphicsAllocation());
+    }
+}
+
+TEST_F(ModuleTest, givenIsaDeduplicationDisabledByDefaultWhenModuleIsCreatedThenIsaIsNotShared) {
+    auto whiteboxModule = whiteboxCast(module.get());
+    EXPECT_TRUE(whiteboxModule->deduplicatedIsaAllocations.empty());
+    EXPECT_TRUE(device->getNEODevice()->getMemoryManager()->getSharedIsaAllocationMap().empty());
+    for (auto &kernelImmData : whiteboxModule->kernelImmDatas) {
+        EXPECT_FALSE(kernelImmData->isIsaDeduplicated());
+    }
+}
+
+TEST_F(ModuleTest, givenModuleInitializationThreadsSetWhenModuleIsCreatedThenAllKernelImmutableDatasAreInitialized) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ModuleInitializationThreads.set(4);
+    createModuleFromMockBinary();
+
+    auto whiteboxModule = whiteboxCast(module.get());
+    EXPECT_EQ(2u, whiteboxModule->getKernelsInitializationThreadsCount());
+    ASSERT_EQ(whiteboxModule->translationUnit->programInfo.kernelInfos.size(), whiteboxModule->kernelImmDatas.size());
+    for (size_t i = 0; i < whiteboxModule->kernelImmDatas.size(); i++) {
+        auto &kernelImmData = whiteboxModule->kernelImmDatas[i];
+        auto kernelInfo = whiteboxModule->translationUnit->programInfo.kernelInfos[i];
+        EXPECT_EQ(kernelInfo, kernelImmData->getKernelInfo());
+        EXPECT_EQ(&kernelInfo->kernelDescriptor, &kernelImmData->getDescriptor());
+        EXPECT_EQ(kernelInfo->heapInfo.SurfaceStateHeapSize, kernelImmData->getSurfaceStateHeapSize());
+        EXPECT_NE(nullptr, kernelImmData->getIsaGraphicsAllocation());
+        EXPECT_TRUE(kernelImmData->isIsaCopiedToAllocation());
+    }
+}
+
+TEST_F(ModuleTest, givenModuleInitializationThreadsNotSetWhenModuleHasFewKernelsThenKernelsAreInitializedOnCallingThread) {
+    auto whiteboxModule = whiteboxCast(module.get());
+    EXPECT_EQ(1u, whiteboxModule->getKernelsInitializationThreadsCount());
+
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ModuleInitializationThreads.set(0);
+    EXPECT_EQ(1u, whiteboxModule->getKernelsInitializationThreadsCount());
+}
+
 using PrintfModuleTest = Test<DeviceFixture>;
 
 HWTEST_F(PrintfModuleTest, GivenModuleWithPrintfWhenKernelIsCreatedThenPrintfAllocationIsPlacedInResidencyContainer) {
@@ -2582,6 +2816,43 @@ TEST_F(ModuleTest, GivenInjectInternalBuildOptionsWhenBuildingBuiltinModuleThenI
     EXPECT_FALSE(CompilerOptions::contains(cip->buildInternalOptions, "-abc"));
 };
 
+TEST_F(ModuleTest, GivenBuiltinBinaryCacheEnabledWhenBuildingModulesThenCachingIsAllowedOnlyForBuiltinModules) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.EnableBuiltinBinaryCache.set(1);
+
+    auto cip = new NEO::MockCompilerInterfaceCaptureBuildOptions();
+    device->getNEODevice()->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()]->compilerInterface.reset(cip);
+
+    uint8_t binary[10];
+    ze_module_desc_t moduleDesc = {};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pInputModule = binary;
+    moduleDesc.inputSize = 10;
+
+    auto builtinModule = std::make_unique<L0::ModuleImp>(device, nullptr, ModuleType::Builtin);
+    builtinModule->initialize(&moduleDesc, device->getNEODevice());
+    EXPECT_TRUE(cip->allowCaching);
+
+    auto userModule = std::make_unique<L0::ModuleImp>(device, nullptr, ModuleType::User);
+    userModule->initialize(&moduleDesc, device->getNEODevice());
+    EXPECT_FALSE(cip->allowCaching);
+}
+
+TEST_F(ModuleTest, GivenBuiltinBinaryCacheNotEnabledWhenBuildingBuiltinModuleThenCachingIsNotAllowed) {
+    auto cip = new NEO::MockCompilerInterfaceCaptureBuildOptions();
+    device->getNEODevice()->getExecutionEnvironment()->rootDeviceEnvironments[device->getRootDeviceIndex()]->compilerInterface.reset(cip);
+
+    uint8_t binary[10];
+    ze_module_desc_t moduleDesc = {};
+    moduleDesc.format = ZE_MODULE_FORMAT_IL_SPIRV;
+    moduleDesc.pInputModule = binary;
+    moduleDesc.inputSize = 10;
+
+    auto builtinModule = std::make_unique<L0::ModuleImp>(device, nullptr, ModuleType::Builtin);
+    builtinModule->initialize(&moduleDesc, device->getNEODevice());
+    EXPECT_FALSE(cip->allowCaching);
+}
+
 TEST_F(ModuleTest, whenContainsStatefulAccessIsCalledThenResultIsCorrect) {
     class MyModuleImpl : public ModuleImp {
       public:
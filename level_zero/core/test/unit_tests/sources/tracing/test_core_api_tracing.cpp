@@ -300,6 +300,32 @@ TEST_F(ZeApiTracingCoreTests, WhenCallingTracerWrapperWithOneSetOfPrologEpilogsW
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+TEST_F(ZeApiTracingCoreTests, GivenMoreTracersThanFitOnStackWhenCallingTracerWrapperThenEachTracerGetsItsOwnInstanceData) {
+    MockCommandList commandList;
+    ze_result_t result;
+    int userData = 5;
+    ze_command_list_close_params_t tracerParams;
+
+    ze_command_list_handle_t commandListHandle = commandList.toHandle();
+    tracerParams.phCommandList = &commandListHandle;
+
+    APITracerCallbackDataImp<ze_pfnCommandListCloseCb_t> apiCallbackData;
+    for (size_t i = 0; i < maxTracersOnStack + 1; i++) {
+        APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t> prologCallback;
+        APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t> epilogCallback;
+        prologCallback.current_api_callback = onEnterCommandListCloseWithUserDataAndAllocateInstanceData;
+        epilogCallback.current_api_callback = onExitCommandListCloseWithUserDataAndReadInstanceData;
+        prologCallback.pUserData = &userData;
+        epilogCallback.pUserData = &userData;
+        apiCallbackData.prologCallbacks.push_back(prologCallback);
+        apiCallbackData.epilogCallbacks.push_back(epilogCallback);
+    }
+    EXPECT_TRUE(apiCallbackData.prologCallbacks.usesDynamicMem());
+
+    result = apiTracerWrapperImp(zeCommandListClose, &tracerParams, apiCallbackData.apiOrdinal, apiCallbackData.prologCallbacks, apiCallbackData.epilogCallbacks, *tracerParams.phCommandList);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+}
+
 TEST_F(ZeApiTracingCoreTests, WhenCallingTracerWrapperWithOneSetOfPrologEpilogsWithRecursionHandledThenSuccessIsReturned) {
     MockCommandList commandList;
     ze_result_t result;
@@ -19,6 +19,10 @@
 #include "level_zero/core/test/unit_tests/mocks/mock_cmdqueue.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_module.h"
 
+namespace CpuIntrinsicsTests {
+extern std::atomic<uint32_t> nonTemporalCopyCounter;
+} // namespace CpuIntrinsicsTests
+
 namespace L0 {
 namespace ult {
 
@@ -388,6 +392,92 @@ HWTEST2_F(CommandListStatePrefetchXeHpcCore, givenAppendMemoryPrefetchForKmdMigr
     commandQueue->destroy();
 }
 
+HWTEST2_F(CommandListStatePrefetchXeHpcCore, givenPrefetchOnlyKernelAccessedAllocationsSetWhenKernelDoesNotAccessPrefetchedSharedAllocationThenSetMemPrefetchIsNotCalled, IsXeHpcCore) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.AppendMemoryPrefetchForKmdMigratedSharedAllocations.set(1);
+    DebugManager.flags.UseKmdMigration.set(1);
+    DebugManager.flags.PrefetchOnlyKernelAccessedAllocations.set(1);
+
+    auto memoryManager = static_cast<MockMemoryManager *>(device->getDriverHandle()->getMemoryManager());
+    memoryManager->prefetchManager.reset(new MockPrefetchManager());
+
+    createKernel();
+    ze_result_t returnValue;
+    ze_command_queue_desc_t queueDesc = {};
+    auto commandList = CommandList::createImmediate(productFamily, device, &queueDesc, false, NEO::EngineGroupType::RenderCompute, returnValue);
+
+    size_t size = 10;
+    size_t alignment = 1u;
+    void *ptr = nullptr;
+
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    auto result = context->allocSharedMem(device->toHandle(), &deviceDesc, &hostDesc, size, alignment, &ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_NE(nullptr, ptr);
+
+    result = commandList->appendMemoryPrefetch(ptr, size);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    result = commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, launchParams);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    EXPECT_FALSE(memoryManager->setMemPrefetchCalled);
+    auto prefetchManager = static_cast<MockPrefetchManager *>(memoryManager->prefetchManager.get());
+    EXPECT_EQ(0u, prefetchManager->allocations.size());
+    EXPECT_EQ(0u, prefetchManager->kernelAccessedAllocations.size());
+
+    context->freeMem(ptr);
+    commandList->destroy();
+}
+
+HWTEST2_F(CommandListStatePrefetchXeHpcCore, givenPrefetchOnlyKernelAccessedAllocationsSetWhenKernelAccessesPrefetchedSharedAllocationThenSetMemPrefetchIsCalled, IsXeHpcCore) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.AppendMemoryPrefetchForKmdMigratedSharedAllocations.set(1);
+    DebugManager.flags.UseKmdMigration.set(1);
+    DebugManager.flags.PrefetchOnlyKernelAccessedAllocations.set(1);
+
+    auto memoryManager = static_cast<MockMemoryManager *>(device->getDriverHandle()->getMemoryManager());
+    memoryManager->prefetchManager.reset(new MockPrefetchManager());
+
+    createKernel();
+    ze_result_t returnValue;
+    ze_command_queue_desc_t queueDesc = {};
+    auto commandList = CommandList::createImmediate(productFamily, device, &queueDesc, false, NEO::EngineGroupType::RenderCompute, returnValue);
+
+    size_t size = 10;
+    size_t alignment = 1u;
+    void *ptr = nullptr;
+
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    ze_host_mem_alloc_desc_t hostDesc = {};
+    auto result = context->allocSharedMem(device->toHandle(), &deviceDesc, &hostDesc, size, alignment, &ptr);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_NE(nullptr, ptr);
+
+    auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
+    ASSERT_NE(nullptr, allocData);
+    kernel->residencyContainer.push_back(allocData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex()));
+
+    result = commandList->appendMemoryPrefetch(ptr, size);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    result = commandList->appendLaunchKernel(kernel->toHandle(), &groupCount, nullptr, 0, nullptr, launchParams);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    EXPECT_TRUE(memoryManager->setMemPrefetchCalled);
+    auto prefetchManager = static_cast<MockPrefetchManager *>(memoryManager->prefetchManager.get());
+    EXPECT_EQ(0u, prefetchManager->allocations.size());
+    EXPECT_EQ(0u, prefetchManager->kernelAccessedAllocations.size());
+
+    context->freeMem(ptr);
+    commandList->destroy();
+}
+
 using CommandListEventFenceTestsXeHpcCore = Test<ModuleFixture>;
 
 HWTEST2_F(CommandListEventFenceTestsXeHpcCore, givenCommandListWithProfilingEventAfterCommandWhenRevId03ThenMiFenceIsAdded, IsXeHpcCore) {
@@ -1001,6 +1091,44 @@ HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndNonUsmHostPtrW
     EXPECT_EQ(0, memcmp(lockedPtr, nonUsmHostPtr, 1024));
 }
 
+HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListWhenCpuMemcpyH2DThenNonTemporalStoresAreUsedUnlessDisabled, IsXeHpcCore) {
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+    cmdList.csr = device->getNEODevice()->getInternalEngine().commandStreamReceiver;
+
+    auto nonTemporalCopyCounterBefore = CpuIntrinsicsTests::nonTemporalCopyCounter.load();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendMemoryCopy(devicePtr, nonUsmHostPtr, 1024, nullptr, 0, nullptr));
+    EXPECT_EQ(nonTemporalCopyCounterBefore + 1, CpuIntrinsicsTests::nonTemporalCopyCounter.load());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendMemoryCopy(nonUsmHostPtr, devicePtr, 1024, nullptr, 0, nullptr));
+    EXPECT_EQ(nonTemporalCopyCounterBefore + 1, CpuIntrinsicsTests::nonTemporalCopyCounter.load());
+
+    DebugManager.flags.ExperimentalCpuCopyNonTemporalStores.set(0);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendMemoryCopy(devicePtr, nonUsmHostPtr, 1024, nullptr, 0, nullptr));
+    EXPECT_EQ(nonTemporalCopyCounterBefore + 1, CpuIntrinsicsTests::nonTemporalCopyCounter.load());
+}
+
+HWTEST2_F(AppendMemoryLockedCopyTest, givenCpuCopyThreadsSetWhenCpuMemcpyH2DThenCopyIsSplitAcrossThreadsAndDataIsCopied, IsXeHpcCore) {
+    DebugManager.flags.ExperimentalCpuCopyThreads.set(4);
+    MockCommandListImmediateHw<gfxCoreFamily> cmdList;
+    cmdList.initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
+    cmdList.csr = device->getNEODevice()->getInternalEngine().commandStreamReceiver;
+
+    const size_t copySize = MemoryConstants::megaByte + 100;
+    for (size_t i = 0; i < copySize; i++) {
+        nonUsmHostPtr[i] = static_cast<char>(i % 127);
+    }
+
+    auto nonTemporalCopyCounterBefore = CpuIntrinsicsTests::nonTemporalCopyCounter.load();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendMemoryCopy(devicePtr, nonUsmHostPtr, copySize, nullptr, 0, nullptr));
+    EXPECT_EQ(nonTemporalCopyCounterBefore + 4, CpuIntrinsicsTests::nonTemporalCopyCounter.load());
+
+    NEO::SvmAllocationData *allocData;
+    device->getDriverHandle()->findAllocationDataForRange(devicePtr, copySize, &allocData);
+    auto dstAlloc = allocData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+    EXPECT_EQ(0, memcmp(dstAlloc->getLockedPtr(), nonUsmHostPtr, copySize));
+}
+
 HWTEST2_F(AppendMemoryLockedCopyTest, givenImmediateCommandListAndSignalEventAndNonUsmHostPtrWhenCopyH2DThenSignalEvent, IsXeHpcCore) {
     MockCommandListImmediateHw<gfxCoreFamily> cmdList;
     cmdList.initialize(device, NEO::EngineGroupType::RenderCompute, 0u);
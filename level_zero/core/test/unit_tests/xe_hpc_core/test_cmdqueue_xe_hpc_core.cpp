@@ -8,6 +8,7 @@
 #include "shared/source/os_interface/hw_info_config.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
 #include "shared/test/common/helpers/default_hw_info.h"
+#include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_command_stream_receiver.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
@@ -191,6 +192,47 @@ HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyAndSplitBcsMaskWhenCreateI
     EXPECT_EQ(static_cast<DeviceImp *>(testL0Device.get())->bcsSplit.cmdQs.size(), 3u);
 }
 
+HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsLoadBalancingWhenDistributingCopySizeThenChunksAreWeightedByPendingWorkOfEngines, IsXeHpcCore) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SplitBcsCopy.set(1);
+    DebugManager.flags.SplitBcsMask.set(0b11001);
+
+    ze_result_t returnValue;
+    auto hwInfo = *NEO::defaultHwInfo;
+    hwInfo.featureTable.ftrBcsInfo = 0b111111111;
+    hwInfo.capabilityTable.blitterOperationsSupported = true;
+    auto testNeoDevice = NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo);
+    auto testL0Device = std::unique_ptr<L0::Device>(L0::Device::create(driverHandle.get(), testNeoDevice, false, &returnValue));
+
+    ze_command_queue_desc_t cmdQueueDesc = {};
+    cmdQueueDesc.ordinal = static_cast<uint32_t>(testNeoDevice->getEngineGroupIndexFromEngineGroupType(NEO::EngineGroupType::Copy));
+
+    std::unique_ptr<L0::CommandList> commandList(CommandList::createImmediate(productFamily, testL0Device.get(), &cmdQueueDesc, false, NEO::EngineGroupType::Copy, returnValue));
+    ASSERT_NE(nullptr, commandList);
+    auto &bcsSplit = static_cast<DeviceImp *>(testL0Device.get())->bcsSplit;
+    ASSERT_EQ(3u, bcsSplit.cmdQs.size());
+
+    StackVec<size_t, 4> chunkSizes;
+    bcsSplit.distributeSize(100u, chunkSizes);
+    ASSERT_EQ(3u, chunkSizes.size());
+    EXPECT_EQ(33u, chunkSizes[0]);
+    EXPECT_EQ(33u, chunkSizes[1]);
+    EXPECT_EQ(34u, chunkSizes[2]);
+
+    uint32_t pendingTaskCounts[] = {3u, 0u, 0u};
+    for (size_t i = 0; i < bcsSplit.cmdQs.size(); i++) {
+        auto csr = static_cast<NEO::UltCommandStreamReceiver<FamilyType> *>(static_cast<CommandQueueImp *>(bcsSplit.cmdQs[i])->getCsr());
+        csr->taskCount = 10u;
+        *csr->getTagAddress() = 10u - pendingTaskCounts[i];
+    }
+
+    DebugManager.flags.SplitBcsLoadBalancing.set(1);
+    bcsSplit.distributeSize(57600u, chunkSizes);
+    EXPECT_EQ(6400u, chunkSizes[0]);
+    EXPECT_EQ(25600u, chunkSizes[1]);
+    EXPECT_EQ(25600u, chunkSizes[2]);
+}
+
 HWTEST2_F(CommandQueueCommandsXeHpc, givenSplitBcsCopyWhenCreateImmediateThenInitializeCmdQsOnce, IsXeHpcCore) {
     DebugManagerStateRestore restorer;
     DebugManager.flags.SplitBcsCopy.set(1);
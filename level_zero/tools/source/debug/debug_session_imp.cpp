@@ -660,12 +660,77 @@ bool DebugSessionImp::readSystemRoutineIdent(EuThread *thread, uint64_t memoryHa
     auto threadSlotOffset = calculateThreadSlotOffset(thread->getThreadId());
     auto srMagicOffset = threadSlotOffset + getStateSaveAreaHeader()->regHeader.sr_magic_offset;
 
+    if (readCachedThreadsStateSaveArea(memoryHandle, reinterpret_cast<char *>(&srIdent), sizeof(srIdent), gpuVa + srMagicOffset)) {
+        return true;
+    }
+
     if (ZE_RESULT_SUCCESS != readGpuMemory(memoryHandle, reinterpret_cast<char *>(&srIdent), sizeof(srIdent), gpuVa + srMagicOffset)) {
         return false;
     }
     return true;
 }
 
+void DebugSessionImp::cacheThreadsStateSaveArea(const std::vector<EuThread::ThreadId> &threadIds, uint64_t memoryHandle) {
+    clearThreadsStateSaveAreaCache();
+
+    // Single thread reads its own slot directly, no need for a bulk read.
+    if (threadIds.size() < 2) {
+        return;
+    }
+
+    auto stateSaveAreaHeader = getStateSaveAreaHeader();
+    if (!stateSaveAreaHeader) {
+        return;
+    }
+
+    auto gpuVa = getContextStateSaveAreaGpuVa(memoryHandle);
+    if (gpuVa == 0) {
+        return;
+    }
+
+    size_t minThreadSlotOffset = std::numeric_limits<size_t>::max();
+    size_t maxThreadSlotOffset = 0;
+    for (auto &threadId : threadIds) {
+        auto threadSlotOffset = calculateThreadSlotOffset(threadId);
+        minThreadSlotOffset = std::min(minThreadSlotOffset, threadSlotOffset);
+        maxThreadSlotOffset = std::max(maxThreadSlotOffset, threadSlotOffset);
+    }
+
+    const size_t size = maxThreadSlotOffset - minThreadSlotOffset + stateSaveAreaHeader->regHeader.state_save_size;
+    size_t maxSize = maxCachedThreadsStateSaveAreaSize;
+    if (NEO::DebugManager.flags.DebuggerMaxCachedStateSaveAreaSize.get() != -1) {
+        maxSize = static_cast<size_t>(NEO::DebugManager.flags.DebuggerMaxCachedStateSaveAreaSize.get());
+    }
+    if (size > maxSize) {
+        return;
+    }
+
+    threadsStateSaveAreaCache.data.resize(size);
+    if (ZE_RESULT_SUCCESS != readGpuMemory(memoryHandle, threadsStateSaveAreaCache.data.data(), size, gpuVa + minThreadSlotOffset)) {
+        PRINT_DEBUGGER_ERROR_LOG("Failed to read state save area of %zu threads\n", threadIds.size());
+        clearThreadsStateSaveAreaCache();
+        return;
+    }
+    threadsStateSaveAreaCache.memoryHandle = memoryHandle;
+    threadsStateSaveAreaCache.gpuVa = gpuVa + minThreadSlotOffset;
+}
+
+bool DebugSessionImp::readCachedThreadsStateSaveArea(uint64_t memoryHandle, char *output, size_t size, uint64_t gpuVa) const {
+    const auto &cache = threadsStateSaveAreaCache;
+    if (cache.data.empty() || cache.memoryHandle != memoryHandle ||
+        gpuVa < cache.gpuVa || gpuVa + size > cache.gpuVa + cache.data.size()) {
+        return false;
+    }
+    memcpy_s(output, size, cache.data.data() + (gpuVa - cache.gpuVa), size);
+    return true;
+}
+
+void DebugSessionImp::clearThreadsStateSaveAreaCache() {
+    threadsStateSaveAreaCache.data.clear();
+    threadsStateSaveAreaCache.memoryHandle = 0;
+    threadsStateSaveAreaCache.gpuVa = 0;
+}
+
 void DebugSessionImp::markPendingInterruptsOrAddToNewlyStoppedFromRaisedAttention(EuThread::ThreadId threadId, uint64_t memoryHandle) {
 
     SIP::sr_ident srMagic = {};
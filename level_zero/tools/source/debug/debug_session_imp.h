@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/helpers/constants.h"
+
 #include "level_zero/tools/source/debug/debug_session.h"
 
 #include <atomic>
@@ -60,6 +62,7 @@ struct DebugSessionImp : DebugSession {
     static const SIP::regset_desc *getSbaRegsetDesc();
     static uint32_t typeToRegsetFlags(uint32_t type);
     constexpr static int64_t interruptTimeout = 2000;
+    constexpr static size_t maxCachedThreadsStateSaveAreaSize = 64 * MemoryConstants::megaByte;
 
     using ApiEventQueue = std::queue<zet_debug_event_t>;
 
@@ -104,6 +107,9 @@ struct DebugSessionImp : DebugSession {
     uint32_t getRegisterSize(uint32_t type);
 
     size_t calculateThreadSlotOffset(EuThread::ThreadId threadId);
+    void cacheThreadsStateSaveArea(const std::vector<EuThread::ThreadId> &threadIds, uint64_t memoryHandle);
+    bool readCachedThreadsStateSaveArea(uint64_t memoryHandle, char *output, size_t size, uint64_t gpuVa) const;
+    void clearThreadsStateSaveAreaCache();
     size_t calculateRegisterOffsetInThreadSlot(const SIP::regset_desc *const regdesc, uint32_t start);
 
     void newAttentionRaised(uint32_t deviceIndex) {
@@ -141,6 +147,12 @@ struct DebugSessionImp : DebugSession {
     std::vector<EuThread::ThreadId> newlyStoppedThreads;
     std::vector<char> stateSaveAreaHeader;
 
+    struct {
+        uint64_t memoryHandle = 0;
+        uint64_t gpuVa = 0;
+        std::vector<char> data;
+    } threadsStateSaveAreaCache;
+
     std::vector<std::pair<DebugSessionImp *, bool>> tileSessions; // DebugSession, attached
     bool tileAttachEnabled = false;
     bool tileSessionsEnabled = false;
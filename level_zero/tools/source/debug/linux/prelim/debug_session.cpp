@@ -371,7 +371,7 @@ std::unique_ptr<uint64_t[]> DebugSessionLinux::getInternalEvent() {
         std::unique_lock<std::mutex> lock(internalEventThreadMutex);
 
         if (internalEventQueue.empty()) {
-            apiEventCondition.wait_for(lock, std::chrono::milliseconds(100));
+            internalEventCondition.wait_for(lock, std::chrono::milliseconds(100));
         }
 
         if (!internalEventQueue.empty()) {
@@ -422,6 +422,7 @@ void DebugSessionLinux::readInternalEventsAsync() {
     } else if (numberOfFds > 0) {
 
         ze_result_t result = ZE_RESULT_SUCCESS;
+        std::vector<std::unique_ptr<uint64_t[]>> events;
 
         int maxLoopCount = 3;
         do {
@@ -436,15 +437,21 @@ void DebugSessionLinux::readInternalEventsAsync() {
             maxLoopCount--;
 
             if (result == ZE_RESULT_SUCCESS) {
-                std::lock_guard<std::mutex> lock(internalEventThreadMutex);
-
                 auto memory = std::make_unique<uint64_t[]>(maxEventSize / sizeof(uint64_t));
                 memcpy(memory.get(), event, maxEventSize);
 
-                internalEventQueue.push(std::move(memory));
-                internalEventCondition.notify_one();
+                events.push_back(std::move(memory));
             }
         } while (result == ZE_RESULT_SUCCESS && maxLoopCount > 0);
+
+        // Queue all events read on this wakeup at once, consumer takes the lock once per batch.
+        if (!events.empty()) {
+            std::lock_guard<std::mutex> lock(internalEventThreadMutex);
+            for (auto &memory : events) {
+                internalEventQueue.push(std::move(memory));
+            }
+            internalEventCondition.notify_one();
+        }
     }
 }
 
@@ -1142,6 +1149,13 @@ void DebugSessionLinux::handleAttentionEvent(prelim_drm_i915_debug_event_eu_atte
 
     PRINT_DEBUGGER_THREAD_LOG("ATTENTION for tile = %d thread count = %d\n", tileIndex, (int)threadsWithAttention.size());
 
+    // Read SR idents of all threads with one memory read instead of one per thread.
+    if (tileSessionsEnabled) {
+        static_cast<TileDebugSessionLinux *>(tileSessions[tileIndex].first)->cacheThreadsStateSaveArea(threadsWithAttention, vmHandle);
+    } else {
+        cacheThreadsStateSaveArea(threadsWithAttention, vmHandle);
+    }
+
     for (auto &threadId : threadsWithAttention) {
         PRINT_DEBUGGER_THREAD_LOG("ATTENTION event for thread: %s\n", EuThread::toString(threadId).c_str());
 
@@ -1153,8 +1167,10 @@ void DebugSessionLinux::handleAttentionEvent(prelim_drm_i915_debug_event_eu_atte
     }
 
     if (tileSessionsEnabled) {
+        static_cast<TileDebugSessionLinux *>(tileSessions[tileIndex].first)->clearThreadsStateSaveAreaCache();
         static_cast<TileDebugSessionLinux *>(tileSessions[tileIndex].first)->checkTriggerEventsForAttention();
     } else {
+        clearThreadsStateSaveAreaCache();
         checkTriggerEventsForAttention();
     }
 }
@@ -200,6 +200,40 @@ bool MetricDeviceContext::isImplicitScalingCapable() const {
     return multiDeviceCapable;
 }
 
+zet_metric_group_handle_t MetricDeviceContext::getActivatedEventBasedMetricGroup() const {
+    // Deferred activations are included, they take effect on the next submission.
+    for (auto const &entry : domains) {
+        auto const &metricGroup = entry.second;
+        zet_metric_group_properties_t properties = {ZET_STRUCTURE_TYPE_METRIC_GROUP_PROPERTIES};
+        MetricGroup::fromHandle(metricGroup.first)->getProperties(&properties);
+        if (properties.samplingType & ZET_METRIC_GROUP_SAMPLING_TYPE_FLAG_EVENT_BASED) {
+            return metricGroup.first;
+        }
+    }
+    return nullptr;
+}
+
+ze_result_t MetricDeviceContext::appendKernelSampleBegin(CommandList &commandList, const std::string &kernelName, uint32_t &sampleSlot) {
+    sampleSlot = OaMetricKernelSampler::invalidSlot;
+    auto kernelSampler = getMetricSource<OaMetricSourceImp>().getKernelSampler();
+    if (kernelSampler == nullptr) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    return kernelSampler->appendBegin(commandList, kernelName, sampleSlot);
+}
+
+ze_result_t MetricDeviceContext::appendKernelSampleEnd(CommandList &commandList, uint32_t sampleSlot) {
+    auto kernelSampler = getMetricSource<OaMetricSourceImp>().getKernelSampler();
+    if (kernelSampler == nullptr) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    return kernelSampler->appendEnd(commandList, sampleSlot);
+}
+
+void MetricDeviceContext::releaseKernelSampler() {
+    getMetricSource<OaMetricSourceImp>().releaseKernelSampler();
+}
+
 ze_result_t MetricDeviceContext::activateMetricGroups() {
     return activateAllDomains();
 }
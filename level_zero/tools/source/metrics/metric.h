@@ -11,6 +11,7 @@
 
 #include "metrics_discovery_api.h"
 
+#include <string>
 #include <vector>
 
 struct _zet_metric_group_handle_t {};
@@ -48,6 +49,10 @@ class MetricDeviceContext {
     bool isMetricGroupActivated(const zet_metric_group_handle_t hMetricGroup) const;
     bool isMetricGroupActivated() const;
     bool isImplicitScalingCapable() const;
+    zet_metric_group_handle_t getActivatedEventBasedMetricGroup() const;
+    ze_result_t appendKernelSampleBegin(CommandList &commandList, const std::string &kernelName, uint32_t &sampleSlot);
+    ze_result_t appendKernelSampleEnd(CommandList &commandList, uint32_t sampleSlot);
+    void releaseKernelSampler();
     Device &getDevice() const;
     uint32_t getSubDeviceIndex() const;
     template <typename T>
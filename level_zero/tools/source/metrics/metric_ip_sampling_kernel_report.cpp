@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/tools/source/metrics/metric_ip_sampling_kernel_report.h"
+
+#include "shared/source/memory_manager/graphics_allocation.h"
+
+#include "level_zero/core/source/kernel/kernel.h"
+#include "level_zero/core/source/module/module.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace L0 {
+
+uint64_t IpSamplingKernelStallReport::getSamplesCount(const StallSumIpData_t &stalls) {
+    return stalls.activeCount + stalls.otherCount + stalls.controlCount + stalls.pipeStallCount + stalls.sendCount +
+           stalls.distAccCount + stalls.sbidCount + stalls.syncCount + stalls.instFetchCount;
+}
+
+void IpSamplingKernelStallReport::accumulate(StallSumIpData_t &destination, const StallSumIpData_t &source) {
+    destination.activeCount += source.activeCount;
+    destination.otherCount += source.otherCount;
+    destination.controlCount += source.controlCount;
+    destination.pipeStallCount += source.pipeStallCount;
+    destination.sendCount += source.sendCount;
+    destination.distAccCount += source.distAccCount;
+    destination.sbidCount += source.sbidCount;
+    destination.syncCount += source.syncCount;
+    destination.instFetchCount += source.instFetchCount;
+}
+
+void IpSamplingKernelStallReport::addModule(const Module &module) {
+    for (auto &kernelImmData : module.getKernelImmutableDataVector()) {
+        auto isaAllocation = kernelImmData->getIsaGraphicsAllocation();
+        if (isaAllocation == nullptr) {
+            continue;
+        }
+        auto isaStart = kernelImmData->getIsaGpuAddress() - isaAllocation->getGpuBaseAddress();
+        addKernel(kernelImmData->getDescriptor().kernelMetadata.kernelName, isaStart, kernelImmData->getIsaSize());
+    }
+}
+
+void IpSamplingKernelStallReport::addKernel(const std::string &kernelName, uint64_t isaStart, uint64_t isaSize) {
+    auto &entry = kernelEntries[isaStart];
+    entry.kernelName = kernelName;
+    entry.isaStart = isaStart;
+    entry.isaSize = isaSize;
+}
+
+IpSamplingKernelStallReport::KernelEntry *IpSamplingKernelStallReport::findKernelEntry(uint64_t isaOffset) {
+    auto it = kernelEntries.upper_bound(isaOffset);
+    if (it == kernelEntries.begin()) {
+        return nullptr;
+    }
+    --it;
+    return (isaOffset < it->second.isaStart + it->second.isaSize) ? &it->second : nullptr;
+}
+
+void IpSamplingKernelStallReport::attribute(const StallSumIpDataMap_t &stallSumIpDataMap) {
+    for (auto &ipData : stallSumIpDataMap) {
+        auto isaOffset = ipData.first << ipToIsaOffsetShift;
+        auto entry = findKernelEntry(isaOffset);
+        if (entry == nullptr) {
+            accumulate(unattributedStalls, ipData.second);
+            continue;
+        }
+        accumulate(entry->stalls, ipData.second);
+        accumulate(entry->stallsPerIsaOffset[isaOffset - entry->isaStart], ipData.second);
+    }
+}
+
+const IpSamplingKernelStallReport::KernelEntry *IpSamplingKernelStallReport::getKernelEntry(const std::string &kernelName) const {
+    for (auto &entry : kernelEntries) {
+        if (entry.second.kernelName == kernelName) {
+            return &entry.second;
+        }
+    }
+    return nullptr;
+}
+
+std::string IpSamplingKernelStallReport::getReport() const {
+    std::ostringstream report;
+    auto printStalls = [&report](const StallSumIpData_t &stalls) {
+        report << getSamplesCount(stalls) << " samples: active " << stalls.activeCount
+               << ", control " << stalls.controlCount
+               << ", pipe " << stalls.pipeStallCount
+               << ", send " << stalls.sendCount
+               << ", dist/acc " << stalls.distAccCount
+               << ", sbid " << stalls.sbidCount
+               << ", sync " << stalls.syncCount
+               << ", inst fetch " << stalls.instFetchCount
+               << ", other " << stalls.otherCount << "\n";
+    };
+
+    std::vector<const KernelEntry *> sortedEntries;
+    for (auto &entry : kernelEntries) {
+        if (getSamplesCount(entry.second.stalls) != 0u) {
+            sortedEntries.push_back(&entry.second);
+        }
+    }
+    std::stable_sort(sortedEntries.begin(), sortedEntries.end(),
+                     [](const auto &lhs, const auto &rhs) { return getSamplesCount(lhs->stalls) > getSamplesCount(rhs->stalls); });
+
+    for (auto entry : sortedEntries) {
+        report << "Kernel " << entry->kernelName << ", ";
+        printStalls(entry->stalls);
+
+        std::vector<std::pair<uint64_t, const StallSumIpData_t *>> sortedOffsets;
+        for (auto &offset : entry->stallsPerIsaOffset) {
+            sortedOffsets.emplace_back(offset.first, &offset.second);
+        }
+        auto offsetsToReport = std::min(sortedOffsets.size(), reportedOffsetsCount);
+        std::partial_sort(sortedOffsets.begin(), sortedOffsets.begin() + offsetsToReport, sortedOffsets.end(),
+                          [](const auto &lhs, const auto &rhs) { return getSamplesCount(*lhs.second) > getSamplesCount(*rhs.second); });
+        for (size_t i = 0; i < offsetsToReport; i++) {
+            report << "  ISA offset 0x" << std::hex << sortedOffsets[i].first << std::dec << ", ";
+            printStalls(*sortedOffsets[i].second);
+        }
+    }
+    if (getSamplesCount(unattributedStalls) != 0u) {
+        report << "Unattributed, ";
+        printStalls(unattributedStalls);
+    }
+    return report.str();
+}
+
+} // namespace L0
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "level_zero/tools/source/metrics/metric_ip_sampling_source.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace L0 {
+
+struct Module;
+
+// Attributes EU stall samples calculated by IpSamplingMetricGroupImp to kernels of modules loaded in
+// the process. Sampled IP is an offset of the instruction from instruction base address, so ISA ranges
+// of kernels are registered relative to the same base and samples outside of them are counted separately.
+class IpSamplingKernelStallReport {
+  public:
+    static constexpr uint32_t ipToIsaOffsetShift = 3u;
+    static constexpr size_t reportedOffsetsCount = 8u;
+
+    struct KernelEntry {
+        std::string kernelName;
+        uint64_t isaStart = 0u;
+        uint64_t isaSize = 0u;
+        StallSumIpData_t stalls = {};
+        std::map<uint64_t, StallSumIpData_t> stallsPerIsaOffset;
+    };
+
+    static uint64_t getSamplesCount(const StallSumIpData_t &stalls);
+
+    void addModule(const Module &module);
+    void addKernel(const std::string &kernelName, uint64_t isaStart, uint64_t isaSize);
+    void attribute(const StallSumIpDataMap_t &stallSumIpDataMap);
+
+    const KernelEntry *getKernelEntry(const std::string &kernelName) const;
+    const StallSumIpData_t &getUnattributedStalls() const { return unattributedStalls; }
+    std::string getReport() const;
+
+  protected:
+    static void accumulate(StallSumIpData_t &destination, const StallSumIpData_t &source);
+    KernelEntry *findKernelEntry(uint64_t isaOffset);
+
+    std::map<uint64_t, KernelEntry> kernelEntries;
+    StallSumIpData_t unattributedStalls = {};
+};
+
+} // namespace L0
@@ -7,17 +7,24 @@
 
 #include "level_zero/tools/source/metrics/metric_ip_sampling_source.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/tools/source/metrics/metric.h"
+#include "level_zero/tools/source/metrics/metric_ip_sampling_kernel_report.h"
 #include "level_zero/tools/source/metrics/metric_ip_sampling_streamer.h"
 #include "level_zero/tools/source/metrics/os_metric_ip_sampling.h"
 #include <level_zero/zet_api.h>
 
+#include <algorithm>
 #include <cstring>
+#include <thread>
 
 namespace L0 {
 constexpr uint32_t ipSamplinMetricCount = 10u;
 constexpr uint32_t ipSamplinDomainId = 100u;
+constexpr uint32_t minRawReportsForParallelCalculation = 16384u;
+constexpr uint32_t maxCalculationThreads = 16u;
 
 std::unique_ptr<IpSamplingMetricSourceImp> IpSamplingMetricSourceImp::create(const MetricDeviceContext &metricDeviceContext) {
     return std::unique_ptr<IpSamplingMetricSourceImp>(new (std::nothrow) IpSamplingMetricSourceImp(metricDeviceContext));
@@ -241,9 +248,7 @@ ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric
 
     const uint32_t rawReportCount = static_cast<uint32_t>(rawDataSize) / rawReportSize;
 
-    for (const uint8_t *pRawIpData = pRawData; pRawIpData < pRawData + (rawReportCount * rawReportSize); pRawIpData += rawReportSize) {
-        dataOverflow |= stallIpDataMapUpdate(stallSumIpDataMap, pRawIpData);
-    }
+    dataOverflow = stallIpDataMapUpdateWithReports(stallSumIpDataMap, pRawData, rawReportCount);
 
     metricValueCount = std::min<uint32_t>(metricValueCount, static_cast<uint32_t>(stallSumIpDataMap.size()) * properties.metricCount);
     std::vector<zet_typed_value_t> ipDataValues;
@@ -259,6 +264,80 @@ ze_result_t IpSamplingMetricGroupImp::getCalculatedMetricValues(const zet_metric
     return dataOverflow ? ZE_RESULT_WARNING_DROPPED_DATA : ZE_RESULT_SUCCESS;
 }
 
+ze_result_t IpSamplingMetricGroupImp::calculateKernelStallReport(const size_t rawDataSize, const uint8_t *pRawData, IpSamplingKernelStallReport &report) {
+    uint32_t rawReportSize = 64;
+
+    if ((rawDataSize % rawReportSize) != 0) {
+        return ZE_RESULT_ERROR_INVALID_SIZE;
+    }
+
+    const uint32_t rawReportCount = static_cast<uint32_t>(rawDataSize) / rawReportSize;
+
+    StallSumIpDataMap_t stallSumIpDataMap;
+    bool dataOverflow = stallIpDataMapUpdateWithReports(stallSumIpDataMap, pRawData, rawReportCount);
+    report.attribute(stallSumIpDataMap);
+
+    return dataOverflow ? ZE_RESULT_WARNING_DROPPED_DATA : ZE_RESULT_SUCCESS;
+}
+
+uint32_t IpSamplingMetricGroupImp::getCalculationThreadsCount(const uint32_t rawReportCount) const {
+    if (NEO::DebugManager.flags.IpSamplingCalculationThreads.get() != -1) {
+        return std::max(1u, std::min(static_cast<uint32_t>(NEO::DebugManager.flags.IpSamplingCalculationThreads.get()), rawReportCount));
+    }
+    if (rawReportCount < minRawReportsForParallelCalculation) {
+        return 1u;
+    }
+    return std::max(1u, std::min({std::thread::hardware_concurrency(), rawReportCount / minRawReportsForParallelCalculation, maxCalculationThreads}));
+}
+
+bool IpSamplingMetricGroupImp::stallIpDataMapUpdateWithReports(StallSumIpDataMap_t &stallSumIpDataMap, const uint8_t *pRawData, const uint32_t rawReportCount) {
+    const uint32_t rawReportSize = 64;
+    const auto threadsCount = getCalculationThreadsCount(rawReportCount);
+
+    // Each thread sums its own chunk of reports, partial sums are merged into final map afterwards
+    std::vector<StallSumIpDataMap_t> partialStallSumIpDataMaps(threadsCount);
+    std::vector<uint8_t> partialDataOverflows(threadsCount, 0u);
+    const uint32_t reportsPerThread = (rawReportCount + threadsCount - 1) / threadsCount;
+    auto sumReports = [&](uint32_t threadId) {
+        const uint32_t firstReport = std::min(threadId * reportsPerThread, rawReportCount);
+        const uint32_t lastReport = std::min(firstReport + reportsPerThread, rawReportCount);
+        bool dataOverflow = false;
+        auto &partialStallSumIpDataMap = (threadId == 0) ? stallSumIpDataMap : partialStallSumIpDataMaps[threadId];
+        for (uint32_t report = firstReport; report < lastReport; report++) {
+            dataOverflow |= stallIpDataMapUpdate(partialStallSumIpDataMap, pRawData + report * rawReportSize);
+        }
+        partialDataOverflows[threadId] = dataOverflow;
+    };
+
+    std::vector<std::thread> workers;
+    workers.reserve(threadsCount - 1);
+    for (uint32_t i = 1u; i < threadsCount; i++) {
+        workers.emplace_back(sumReports, i);
+    }
+    sumReports(0u);
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    bool dataOverflow = partialDataOverflows[0];
+    for (uint32_t i = 1u; i < threadsCount; i++) {
+        dataOverflow |= partialDataOverflows[i] != 0;
+        for (const auto &partialStallSumData : partialStallSumIpDataMaps[i]) {
+            StallSumIpData_t &stallSumData = stallSumIpDataMap[partialStallSumData.first];
+            stallSumData.activeCount += partialStallSumData.second.activeCount;
+            stallSumData.otherCount += partialStallSumData.second.otherCount;
+            stallSumData.controlCount += partialStallSumData.second.controlCount;
+            stallSumData.pipeStallCount += partialStallSumData.second.pipeStallCount;
+            stallSumData.sendCount += partialStallSumData.second.sendCount;
+            stallSumData.distAccCount += partialStallSumData.second.distAccCount;
+            stallSumData.sbidCount += partialStallSumData.second.sbidCount;
+            stallSumData.syncCount += partialStallSumData.second.syncCount;
+            stallSumData.instFetchCount += partialStallSumData.second.instFetchCount;
+        }
+    }
+    return dataOverflow;
+}
+
 /*
  * stall sample data item format:
  *
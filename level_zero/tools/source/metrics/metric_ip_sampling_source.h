@@ -15,6 +15,7 @@ namespace L0 {
 struct IpSamplingMetricImp;
 struct IpSamplingMetricGroupImp;
 struct IpSamplingMetricStreamerImp;
+class IpSamplingKernelStallReport;
 
 class IpSamplingMetricSourceImp : public MetricSource {
 
@@ -84,6 +85,7 @@ struct IpSamplingMetricGroupImp : public IpSamplingMetricGroupBase {
         zet_metric_streamer_desc_t *desc,
         ze_event_handle_t hNotificationEvent,
         zet_metric_streamer_handle_t *phMetricStreamer) override;
+    ze_result_t calculateKernelStallReport(const size_t rawDataSize, const uint8_t *pRawData, IpSamplingKernelStallReport &report);
     static std::unique_ptr<IpSamplingMetricGroupImp> create(IpSamplingMetricSourceImp &metricSource,
                                                             std::vector<IpSamplingMetricImp> &ipSamplingMetrics);
     IpSamplingMetricSourceImp &getMetricSource() { return metricSource; }
@@ -96,6 +98,8 @@ struct IpSamplingMetricGroupImp : public IpSamplingMetricGroupBase {
                                           uint32_t &metricValueCount,
                                           zet_typed_value_t *pCalculatedData);
     bool stallIpDataMapUpdate(StallSumIpDataMap_t &, const uint8_t *pRawIpData);
+    bool stallIpDataMapUpdateWithReports(StallSumIpDataMap_t &stallSumIpDataMap, const uint8_t *pRawData, const uint32_t rawReportCount);
+    uint32_t getCalculationThreadsCount(const uint32_t rawReportCount) const;
     void stallSumIpDataToTypedValues(uint64_t ip, StallSumIpData_t &sumIpData, std::vector<zet_typed_value_t> &ipDataValues);
     IpSamplingMetricSourceImp &metricSource;
 };
@@ -0,0 +1,223 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/tools/source/metrics/metric_oa_kernel_sampler.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include "level_zero/core/source/device/device_imp.h"
+#include "level_zero/tools/source/metrics/metric_oa_source.h"
+
+#include <algorithm>
+
+namespace L0 {
+
+namespace {
+double getTypedValueAsDouble(const zet_typed_value_t &typedValue) {
+    switch (typedValue.type) {
+    case ZET_VALUE_TYPE_UINT32:
+        return static_cast<double>(typedValue.value.ui32);
+    case ZET_VALUE_TYPE_UINT64:
+        return static_cast<double>(typedValue.value.ui64);
+    case ZET_VALUE_TYPE_FLOAT32:
+        return static_cast<double>(typedValue.value.fp32);
+    case ZET_VALUE_TYPE_FLOAT64:
+        return typedValue.value.fp64;
+    case ZET_VALUE_TYPE_BOOL8:
+        return typedValue.value.b8 ? 1.0 : 0.0;
+    default:
+        return 0.0;
+    }
+}
+} // namespace
+
+OaMetricKernelSampler::OaMetricKernelSampler(OaMetricSourceImp &metricSource, const uint32_t samplingPeriod, const uint32_t ringSize)
+    : metricSource(metricSource), samplingPeriod(samplingPeriod), ringSize(ringSize) {}
+
+OaMetricKernelSampler::~OaMetricKernelSampler() {
+    release();
+}
+
+bool OaMetricKernelSampler::isLaunchSampled(const uint64_t launchIndex) const {
+    return samplingPeriod > 0 && (launchIndex % samplingPeriod) == 0;
+}
+
+ze_result_t OaMetricKernelSampler::appendBegin(CommandList &commandList, const std::string &kernelName, uint32_t &slot) {
+    slot = invalidSlot;
+
+    std::lock_guard<std::mutex> lock(samplerMutex);
+    if (!isLaunchSampled(++launchCount)) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    auto &deviceImp = static_cast<DeviceImp &>(metricSource.getDevice());
+    auto &activationContext = metricSource.isImplicitScalingCapable()
+                                  ? deviceImp.subDevices[0]->getMetricDeviceContext()
+                                  : deviceImp.getMetricDeviceContext();
+    auto hActivatedMetricGroup = activationContext.getActivatedEventBasedMetricGroup();
+    if (hActivatedMetricGroup == nullptr) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    if (hActivatedMetricGroup != hMetricGroup) {
+        destroyQueryRing();
+        if (!createQueryRing(hActivatedMetricGroup)) {
+            return ZE_RESULT_ERROR_NOT_AVAILABLE;
+        }
+    }
+
+    // Oldest sample is collected before its slot is reused, the ring has to be
+    // large enough to cover samples still in flight.
+    if (!slotKernelNames[nextSlot].empty()) {
+        collectSample(nextSlot);
+    }
+
+    auto result = MetricQuery::fromHandle(queries[nextSlot])->appendBegin(commandList);
+    if (result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
+
+    slotKernelNames[nextSlot] = kernelName;
+    slot = nextSlot;
+    nextSlot = (nextSlot + 1) % ringSize;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t OaMetricKernelSampler::appendEnd(CommandList &commandList, const uint32_t slot) {
+    std::lock_guard<std::mutex> lock(samplerMutex);
+    if (slot >= queries.size()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return MetricQuery::fromHandle(queries[slot])->appendEnd(commandList, nullptr, 0, nullptr);
+}
+
+void OaMetricKernelSampler::release() {
+    std::lock_guard<std::mutex> lock(samplerMutex);
+    destroyQueryRing();
+    if (!kernelSamples.empty()) {
+        printKernelSamples();
+        kernelSamples.clear();
+    }
+}
+
+bool OaMetricKernelSampler::createQueryRing(const zet_metric_group_handle_t hActivatedMetricGroup) {
+    zet_metric_query_pool_desc_t poolDesc = {ZET_STRUCTURE_TYPE_METRIC_QUERY_POOL_DESC};
+    poolDesc.type = ZET_METRIC_QUERY_POOL_TYPE_PERFORMANCE;
+    poolDesc.count = ringSize;
+
+    auto result = OaMetricQueryPoolImp::metricQueryPoolCreate(nullptr, metricSource.getDevice().toHandle(), hActivatedMetricGroup,
+                                                              &poolDesc, &hQueryPool);
+    if (result != ZE_RESULT_SUCCESS) {
+        hQueryPool = nullptr;
+        return false;
+    }
+
+    queries.resize(ringSize, nullptr);
+    for (uint32_t i = 0; i < ringSize; ++i) {
+        if (MetricQueryPool::fromHandle(hQueryPool)->metricQueryCreate(i, &queries[i]) != ZE_RESULT_SUCCESS) {
+            destroyQueryRing();
+            return false;
+        }
+    }
+    slotKernelNames.assign(ringSize, {});
+
+    uint32_t metricCount = 0;
+    auto metricGroup = MetricGroup::fromHandle(hActivatedMetricGroup);
+    metricGroup->metricGet(&metricCount, nullptr);
+    std::vector<zet_metric_handle_t> metrics(metricCount);
+    metricGroup->metricGet(&metricCount, metrics.data());
+    metricNames.clear();
+    for (auto hMetric : metrics) {
+        zet_metric_properties_t metricProperties = {ZET_STRUCTURE_TYPE_METRIC_PROPERTIES};
+        Metric::fromHandle(hMetric)->getProperties(&metricProperties);
+        metricNames.push_back(metricProperties.name);
+    }
+
+    hMetricGroup = hActivatedMetricGroup;
+    nextSlot = 0;
+    return true;
+}
+
+void OaMetricKernelSampler::destroyQueryRing() {
+    if (hQueryPool == nullptr) {
+        return;
+    }
+
+    for (uint32_t slot = 0; slot < queries.size(); ++slot) {
+        if (queries[slot] == nullptr) {
+            continue;
+        }
+        if (!slotKernelNames.empty() && !slotKernelNames[slot].empty()) {
+            collectSample(slot);
+        }
+        MetricQuery::fromHandle(queries[slot])->destroy();
+    }
+    MetricQueryPool::fromHandle(hQueryPool)->destroy();
+
+    queries.clear();
+    slotKernelNames.clear();
+    hQueryPool = nullptr;
+    hMetricGroup = nullptr;
+}
+
+void OaMetricKernelSampler::collectSample(const uint32_t slot) {
+    auto kernelName = std::move(slotKernelNames[slot]);
+    slotKernelNames[slot].clear();
+
+    auto query = MetricQuery::fromHandle(queries[slot]);
+    size_t rawDataSize = 0;
+    if (query->getData(&rawDataSize, nullptr) != ZE_RESULT_SUCCESS || rawDataSize == 0) {
+        return;
+    }
+    std::vector<uint8_t> rawData(rawDataSize);
+    if (query->getData(&rawDataSize, rawData.data()) != ZE_RESULT_SUCCESS) {
+        return;
+    }
+
+    auto metricGroup = MetricGroup::fromHandle(hMetricGroup);
+    uint32_t setCount = 0;
+    uint32_t totalMetricValueCount = 0;
+    if (metricGroup->calculateMetricValuesExp(ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES, rawDataSize, rawData.data(),
+                                              &setCount, &totalMetricValueCount, nullptr, nullptr) != ZE_RESULT_SUCCESS ||
+        totalMetricValueCount == 0) {
+        return;
+    }
+    std::vector<uint32_t> metricCounts(setCount);
+    std::vector<zet_typed_value_t> metricValues(totalMetricValueCount);
+    if (metricGroup->calculateMetricValuesExp(ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES, rawDataSize, rawData.data(),
+                                              &setCount, &totalMetricValueCount, metricCounts.data(), metricValues.data()) != ZE_RESULT_SUCCESS) {
+        return;
+    }
+
+    auto &samples = kernelSamples[kernelName];
+    samples.metricSums.resize(std::max(samples.metricSums.size(), static_cast<size_t>(totalMetricValueCount)), 0.0);
+    for (uint32_t i = 0; i < totalMetricValueCount; ++i) {
+        samples.metricSums[i] += getTypedValueAsDouble(metricValues[i]);
+    }
+    samples.sampleCount++;
+    metricSetCount = setCount;
+}
+
+void OaMetricKernelSampler::printKernelSamples() const {
+    const size_t metricCount = metricNames.size();
+    for (const auto &[kernelName, samples] : kernelSamples) {
+        PRINT_DEBUG_STRING(true, stdout, "Kernel %s: %u samples\n", kernelName.c_str(), samples.sampleCount);
+        if (metricCount == 0 || samples.sampleCount == 0) {
+            continue;
+        }
+        for (size_t i = 0; i < samples.metricSums.size(); ++i) {
+            const auto average = samples.metricSums[i] / samples.sampleCount;
+            if (metricSetCount > 1) {
+                PRINT_DEBUG_STRING(true, stdout, "  [%zu] %s: %f\n", i / metricCount, metricNames[i % metricCount].c_str(), average);
+            } else {
+                PRINT_DEBUG_STRING(true, stdout, "  %s: %f\n", metricNames[i % metricCount].c_str(), average);
+            }
+        }
+    }
+}
+
+} // namespace L0
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "level_zero/tools/source/metrics/metric.h"
+
+#include <limits>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace L0 {
+class OaMetricSourceImp;
+
+// Brackets every N-th kernel launch with a metric query taken from a
+// preallocated ring and accumulates calculated values per kernel name.
+class OaMetricKernelSampler {
+  public:
+    static constexpr uint32_t invalidSlot = std::numeric_limits<uint32_t>::max();
+    static constexpr uint32_t defaultRingSize = 256u;
+
+    struct KernelSamples {
+        uint32_t sampleCount = 0;
+        std::vector<double> metricSums;
+    };
+
+    OaMetricKernelSampler(OaMetricSourceImp &metricSource, const uint32_t samplingPeriod, const uint32_t ringSize);
+    ~OaMetricKernelSampler();
+
+    ze_result_t appendBegin(CommandList &commandList, const std::string &kernelName, uint32_t &slot);
+    ze_result_t appendEnd(CommandList &commandList, const uint32_t slot);
+    void release();
+
+    bool isLaunchSampled(const uint64_t launchIndex) const;
+    const std::map<std::string, KernelSamples> &getKernelSamples() const { return kernelSamples; }
+
+  protected:
+    bool createQueryRing(const zet_metric_group_handle_t hActivatedMetricGroup);
+    void destroyQueryRing();
+    void collectSample(const uint32_t slot);
+    void printKernelSamples() const;
+
+    OaMetricSourceImp &metricSource;
+    const uint32_t samplingPeriod;
+    const uint32_t ringSize;
+    uint64_t launchCount = 0;
+    uint32_t nextSlot = 0;
+    zet_metric_group_handle_t hMetricGroup = nullptr;
+    zet_metric_query_pool_handle_t hQueryPool = nullptr;
+    std::vector<zet_metric_query_handle_t> queries;
+    std::vector<std::string> slotKernelNames;
+    std::vector<std::string> metricNames;
+    uint32_t metricSetCount = 0;
+    std::map<std::string, KernelSamples> kernelSamples;
+    std::mutex samplerMutex;
+};
+
+} // namespace L0
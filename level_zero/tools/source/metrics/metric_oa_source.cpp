@@ -7,6 +7,7 @@
 
 #include "level_zero/tools/source/metrics/metric_oa_source.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/os_interface/os_library.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist.h"
@@ -143,6 +144,24 @@ bool OaMetricSourceImp::isImplicitScalingCapable() const {
     return metricDeviceContext.isImplicitScalingCapable();
 }
 
+OaMetricKernelSampler *OaMetricSourceImp::getKernelSampler() {
+    const auto samplingPeriod = NEO::DebugManager.flags.MetricKernelSamplingPeriod.get();
+    if (samplingPeriod <= 0 || !isInitialized()) {
+        return nullptr;
+    }
+    if (kernelSampler == nullptr) {
+        const auto ringSize = NEO::DebugManager.flags.MetricKernelSamplingRingSize.get() > 0
+                                  ? static_cast<uint32_t>(NEO::DebugManager.flags.MetricKernelSamplingRingSize.get())
+                                  : OaMetricKernelSampler::defaultRingSize;
+        kernelSampler = std::make_unique<OaMetricKernelSampler>(*this, static_cast<uint32_t>(samplingPeriod), ringSize);
+    }
+    return kernelSampler.get();
+}
+
+void OaMetricSourceImp::releaseKernelSampler() {
+    kernelSampler.reset();
+}
+
 template <>
 OaMetricSourceImp &MetricDeviceContext::getMetricSource<OaMetricSourceImp>() const {
     return static_cast<OaMetricSourceImp &>(*metricSources.at(MetricSource::SourceType::Oa));
@@ -9,6 +9,7 @@
 
 #include "level_zero/tools/source/metrics/metric.h"
 #include "level_zero/tools/source/metrics/metric_oa_enumeration_imp.h"
+#include "level_zero/tools/source/metrics/metric_oa_kernel_sampler.h"
 #include "level_zero/tools/source/metrics/metric_oa_query_imp.h"
 #include "level_zero/tools/source/metrics/metric_oa_streamer_imp.h"
 
@@ -47,6 +48,8 @@ class OaMetricSourceImp : public MetricSource {
     bool isComputeUsed() const;
     uint32_t getSubDeviceIndex();
     bool isImplicitScalingCapable() const;
+    OaMetricKernelSampler *getKernelSampler();
+    void releaseKernelSampler();
     const MetricDeviceContext &getMetricDeviceContext() const { return metricDeviceContext; }
     static std::unique_ptr<OaMetricSourceImp> create(const MetricDeviceContext &metricDeviceContext);
     using OsLibraryLoadPtr = std::add_pointer<NEO::OsLibrary *(const std::string &)>::type;
@@ -57,6 +60,7 @@ class OaMetricSourceImp : public MetricSource {
     const MetricDeviceContext &metricDeviceContext;
     std::unique_ptr<MetricEnumeration> metricEnumeration = nullptr;
     std::unique_ptr<MetricsLibrary> metricsLibrary = nullptr;
+    std::unique_ptr<OaMetricKernelSampler> kernelSampler = nullptr;
     MetricStreamer *pMetricStreamer = nullptr;
     bool useCompute = false;
 };
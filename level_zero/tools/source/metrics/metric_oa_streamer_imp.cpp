@@ -7,6 +7,7 @@
 
 #include "level_zero/tools/source/metrics/metric_oa_streamer_imp.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/debug_helpers.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist.h"
@@ -192,15 +193,22 @@ ze_result_t OaMetricStreamerImp::stopMeasurements() {
     return result;
 }
 
+uint32_t OaMetricStreamerImp::getOaBufferReportsMultiplier() const {
+    // By default notification is on half full buffer.
+    uint32_t multiplier = 2u;
+    if (NEO::DebugManager.flags.MetricStreamerOaBufferReportsMultiplier.get() >= 2) {
+        multiplier = static_cast<uint32_t>(NEO::DebugManager.flags.MetricStreamerOaBufferReportsMultiplier.get());
+    }
+    return multiplier;
+}
+
 uint32_t OaMetricStreamerImp::getOaBufferSize(const uint32_t notifyEveryNReports) const {
-    // Notification is on half full buffer, hence multiplication by 2.
-    return notifyEveryNReports * rawReportSize * 2;
+    return notifyEveryNReports * rawReportSize * getOaBufferReportsMultiplier();
 }
 
 uint32_t OaMetricStreamerImp::getNotifyEveryNReports(const uint32_t oaBufferSize) const {
-    // Notification is on half full buffer, hence division by 2.
     return rawReportSize
-               ? oaBufferSize / (rawReportSize * 2)
+               ? oaBufferSize / (rawReportSize * getOaBufferReportsMultiplier())
                : 0;
 }
 
@@ -30,6 +30,7 @@ struct OaMetricStreamerImp : MetricStreamer {
 
   protected:
     ze_result_t stopMeasurements();
+    uint32_t getOaBufferReportsMultiplier() const;
     uint32_t getOaBufferSize(const uint32_t notifyEveryNReports) const;
     uint32_t getNotifyEveryNReports(const uint32_t oaBufferSize) const;
     uint32_t getRequiredBufferSize(const uint32_t maxReportCount) const;
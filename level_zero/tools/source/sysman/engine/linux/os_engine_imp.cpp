@@ -7,6 +7,7 @@
 
 #include "level_zero/tools/source/sysman/engine/linux/os_engine_imp.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/os_interface/linux/engine_info.h"
 #include "shared/source/os_interface/linux/i915.h"
 
@@ -52,7 +53,9 @@ ze_result_t LinuxEngineImp::getActivity(zes_engine_stats_t *pStats) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
     uint64_t data[2] = {};
-    if (pPmuInterface->pmuRead(static_cast<int>(fd), data, sizeof(data)) < 0) {
+    int ret = isEventGroupMember ? pPmuInterface->pmuEventGroupRead(eventGroupIndex, data)
+                                 : pPmuInterface->pmuRead(static_cast<int>(fd), data, sizeof(data));
+    if (ret < 0) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
     // In data[], First u64 is "active time", And second u64 is "timestamp". Both in nanoseconds
@@ -68,10 +71,21 @@ ze_result_t LinuxEngineImp::getProperties(zes_engine_properties_t &properties) {
     return ZE_RESULT_SUCCESS;
 }
 
+void LinuxEngineImp::openPmuEvent(uint64_t config) {
+    if (NEO::DebugManager.flags.EnableSysmanEngineGroupPmuRead.get() == 1) {
+        fd = pPmuInterface->pmuEventGroupOpen(config, eventGroupIndex);
+        if (fd >= 0) {
+            isEventGroupMember = true;
+            return;
+        }
+    }
+    fd = pPmuInterface->pmuInterfaceOpen(config, -1, PERF_FORMAT_TOTAL_TIME_ENABLED);
+}
+
 void LinuxEngineImp::init() {
     auto i915EngineClass = engineToI915Map.find(engineGroup);
     // I915_PMU_ENGINE_BUSY macro provides the perf type config which we want to listen to get the engine busyness.
-    fd = pPmuInterface->pmuInterfaceOpen(I915_PMU_ENGINE_BUSY(i915EngineClass->second, engineInstance), -1, PERF_FORMAT_TOTAL_TIME_ENABLED);
+    openPmuEvent(I915_PMU_ENGINE_BUSY(i915EngineClass->second, engineInstance));
 }
 
 bool LinuxEngineImp::isEngineModuleSupported() {
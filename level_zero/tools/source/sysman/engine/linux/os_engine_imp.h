@@ -24,7 +24,7 @@ class LinuxEngineImp : public OsEngine, NEO::NonCopyableOrMovableClass {
     LinuxEngineImp() = default;
     LinuxEngineImp(OsSysman *pOsSysman, zes_engine_group_t type, uint32_t engineInstance, uint32_t subDeviceId);
     ~LinuxEngineImp() override {
-        if (fd != -1) {
+        if (fd != -1 && !isEventGroupMember) {
             close(static_cast<int>(fd));
             fd = -1;
         }
@@ -41,7 +41,10 @@ class LinuxEngineImp : public OsEngine, NEO::NonCopyableOrMovableClass {
 
   private:
     void init();
+    void openPmuEvent(uint64_t config);
     int64_t fd = -1;
+    bool isEventGroupMember = false;
+    uint32_t eventGroupIndex = 0;
 };
 
 } // namespace L0
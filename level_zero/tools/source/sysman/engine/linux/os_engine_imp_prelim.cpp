@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/os_interface/linux/engine_info.h"
 #include "shared/source/os_interface/linux/i915_prelim.h"
 
@@ -74,7 +75,9 @@ ze_result_t LinuxEngineImp::getActivity(zes_engine_stats_t *pStats) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
     uint64_t data[2] = {};
-    if (pPmuInterface->pmuRead(static_cast<int>(fd), data, sizeof(data)) < 0) {
+    int ret = isEventGroupMember ? pPmuInterface->pmuEventGroupRead(eventGroupIndex, data)
+                                 : pPmuInterface->pmuRead(static_cast<int>(fd), data, sizeof(data));
+    if (ret < 0) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
     // In data[], First u64 is "active time", And second u64 is "timestamp". Both in nanoseconds
@@ -90,6 +93,17 @@ ze_result_t LinuxEngineImp::getProperties(zes_engine_properties_t &properties) {
     return ZE_RESULT_SUCCESS;
 }
 
+void LinuxEngineImp::openPmuEvent(uint64_t config) {
+    if (NEO::DebugManager.flags.EnableSysmanEngineGroupPmuRead.get() == 1) {
+        fd = pPmuInterface->pmuEventGroupOpen(config, eventGroupIndex);
+        if (fd >= 0) {
+            isEventGroupMember = true;
+            return;
+        }
+    }
+    fd = pPmuInterface->pmuInterfaceOpen(config, -1, PERF_FORMAT_TOTAL_TIME_ENABLED);
+}
+
 void LinuxEngineImp::init() {
     uint32_t subDeviceCount = 0;
     pDevice->getSubDevices(&subDeviceCount, nullptr);
@@ -114,7 +128,7 @@ void LinuxEngineImp::init() {
         config = I915_PMU_ENGINE_BUSY(i915EngineClass->second, engineInstance);
         break;
     }
-    fd = pPmuInterface->pmuInterfaceOpen(config, -1, PERF_FORMAT_TOTAL_TIME_ENABLED);
+    openPmuEvent(config);
 }
 
 bool LinuxEngineImp::isEngineModuleSupported() {
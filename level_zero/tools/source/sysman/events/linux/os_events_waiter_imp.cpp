@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/tools/source/sysman/events/linux/os_events_waiter_imp.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+namespace L0 {
+
+const std::string LinuxEventsWaiterImp::varFs("/var/lib/libze_intel_gpu/");
+
+void LinuxEventsWaiterImp::init(int32_t pollingIntervalInMs) {
+    // Attach, detach and fabric port uevents are reported by L0 udev rules through files in varFs,
+    // so listener can sleep until one of these files changes instead of waking up every few milliseconds
+    this->pollingIntervalInMs = pollingIntervalInMs;
+    inotifyFd = this->inotifyInitFunction(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd < 0) {
+        return;
+    }
+    if (this->inotifyAddWatchFunction(inotifyFd, varFs.c_str(), IN_CREATE | IN_MODIFY | IN_CLOSE_WRITE | IN_MOVED_TO) < 0) {
+        this->closeFunction(inotifyFd);
+        inotifyFd = -1;
+    }
+}
+
+void LinuxEventsWaiterImp::wait(uint64_t maxWaitTimeInMs) {
+    if (inotifyFd < 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(defaultSleepTimeInMs));
+        return;
+    }
+    // Device state which is not reported through files (e.g. reset required or memory health)
+    // is still checked at least once per polling interval
+    auto waitTime = static_cast<int>(std::min(maxWaitTimeInMs, static_cast<uint64_t>(pollingIntervalInMs)));
+    struct pollfd pollFd = {inotifyFd, POLLIN, 0};
+    if (this->pollFunction(&pollFd, 1, waitTime) > 0) {
+        char buffer[4096];
+        while (this->readFunction(inotifyFd, buffer, sizeof(buffer)) > 0) {
+        }
+    }
+}
+
+LinuxEventsWaiterImp::~LinuxEventsWaiterImp() {
+    if (inotifyFd >= 0) {
+        this->closeFunction(inotifyFd);
+    }
+}
+
+OsEventsWaiter *OsEventsWaiter::create() {
+    LinuxEventsWaiterImp *pLinuxEventsWaiterImp = new LinuxEventsWaiterImp();
+    auto pollingIntervalInMs = NEO::DebugManager.flags.SysmanEventsListenPollingIntervalInMs.get();
+    if (pollingIntervalInMs > 0) {
+        pLinuxEventsWaiterImp->init(pollingIntervalInMs);
+    }
+    return static_cast<OsEventsWaiter *>(pLinuxEventsWaiterImp);
+}
+
+} // namespace L0
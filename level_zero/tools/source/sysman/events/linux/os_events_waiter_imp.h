@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
+
+#include "level_zero/tools/source/sysman/events/os_events.h"
+
+#include <string>
+#include <sys/inotify.h>
+
+namespace L0 {
+
+class LinuxEventsWaiterImp : public OsEventsWaiter, NEO::NonCopyableOrMovableClass {
+  public:
+    void wait(uint64_t maxWaitTimeInMs) override;
+    void init(int32_t pollingIntervalInMs);
+    LinuxEventsWaiterImp() = default;
+    ~LinuxEventsWaiterImp() override;
+
+  protected:
+    int inotifyFd = -1;
+    int32_t pollingIntervalInMs = 0;
+    decltype(&inotify_init1) inotifyInitFunction = inotify_init1;
+    decltype(&inotify_add_watch) inotifyAddWatchFunction = inotify_add_watch;
+    decltype(&NEO::SysCalls::poll) pollFunction = NEO::SysCalls::poll;
+    decltype(&NEO::SysCalls::read) readFunction = NEO::SysCalls::read;
+    decltype(&NEO::SysCalls::close) closeFunction = NEO::SysCalls::close;
+
+  private:
+    static const std::string varFs;
+    static constexpr uint64_t defaultSleepTimeInMs = 10u;
+};
+
+} // namespace L0
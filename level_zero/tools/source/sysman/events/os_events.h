@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -20,4 +20,11 @@ class OsEvents {
     virtual ~OsEvents() {}
 };
 
+class OsEventsWaiter {
+  public:
+    static OsEventsWaiter *create();
+    virtual void wait(uint64_t maxWaitTimeInMs) = 0;
+    virtual ~OsEventsWaiter() = default;
+};
+
 } // namespace L0
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -147,4 +147,12 @@ OsEvents *OsEvents::create(OsSysman *pOsSysman) {
     return static_cast<OsEvents *>(pWddmEventsImp);
 }
 
+void WddmEventsWaiterImp::wait(uint64_t maxWaitTimeInMs) {
+    // WddmEventsImp::eventListen blocks on event handles, nothing to wait for here
+}
+
+OsEventsWaiter *OsEventsWaiter::create() {
+    return new WddmEventsWaiterImp();
+}
+
 } // namespace L0
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -45,4 +45,9 @@ class WddmEventsImp : public OsEvents, NEO::NonCopyableOrMovableClass {
     std::vector<EventHandler> eventList;
 };
 
+class WddmEventsWaiterImp : public OsEventsWaiter, NEO::NonCopyableOrMovableClass {
+  public:
+    void wait(uint64_t maxWaitTimeInMs) override;
+};
+
 } // namespace L0
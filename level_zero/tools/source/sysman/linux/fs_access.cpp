@@ -10,11 +10,14 @@
 #include <climits>
 
 #include <array>
+#include <cctype>
 #include <cerrno>
 #include <csignal>
 #include <cstdio>
 #include <cstdlib>
 #include <dirent.h>
+#include <fcntl.h>
+#include <limits>
 #include <unistd.h>
 
 namespace L0 {
@@ -31,103 +34,137 @@ static ze_result_t getResult(int err) {
     }
 }
 
-// Generic Filesystem Access
-FsAccess::FsAccess() {
+static bool parseValue(const std::string &str, uint64_t &val) {
+    char *end = nullptr;
+    errno = 0;
+    val = std::strtoull(str.c_str(), &end, 10);
+    return (end != str.c_str()) && (errno != ERANGE);
 }
 
-FsAccess *FsAccess::create() {
-    return new FsAccess();
+static bool parseValue(const std::string &str, uint32_t &val) {
+    uint64_t value = 0;
+    if (!parseValue(str, value) || value > std::numeric_limits<uint32_t>::max()) {
+        return false;
+    }
+    val = static_cast<uint32_t>(value);
+    return true;
 }
 
-ze_result_t FsAccess::read(const std::string file, uint64_t &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
-
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
-    }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+static bool parseValue(const std::string &str, int32_t &val) {
+    char *end = nullptr;
+    errno = 0;
+    auto value = std::strtoll(str.c_str(), &end, 10);
+    if ((end == str.c_str()) || (errno == ERANGE) ||
+        (value > std::numeric_limits<int32_t>::max()) || (value < std::numeric_limits<int32_t>::min())) {
+        return false;
     }
-    fs.close();
-    return ZE_RESULT_SUCCESS;
+    val = static_cast<int32_t>(value);
+    return true;
 }
 
-ze_result_t FsAccess::read(const std::string file, double &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
+static bool parseValue(const std::string &str, double &val) {
+    char *end = nullptr;
+    errno = 0;
+    val = std::strtod(str.c_str(), &end);
+    return (end != str.c_str()) && (errno != ERANGE);
+}
 
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
+template <typename T>
+static ze_result_t readAndParseValue(FsAccess &fsAccess, const std::string &file, T &val) {
+    std::string str;
+    ze_result_t result = fsAccess.FsAccess::read(file, str);
+    if (ZE_RESULT_SUCCESS != result) {
+        return result;
     }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+    if (!parseValue(str, val)) {
+        return ZE_RESULT_ERROR_UNKNOWN;
     }
-    fs.close();
     return ZE_RESULT_SUCCESS;
 }
 
-ze_result_t FsAccess::read(const std::string file, int32_t &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
+// Generic Filesystem Access
+FsAccess::FsAccess() {
+}
 
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
+FsAccess::~FsAccess() {
+    for (auto &cachedFileDescriptor : cachedFileDescriptors) {
+        closeSyscall(cachedFileDescriptor.second);
     }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
-    }
-    fs.close();
-    return ZE_RESULT_SUCCESS;
 }
 
-ze_result_t FsAccess::read(const std::string file, uint32_t &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
+FsAccess *FsAccess::create() {
+    return new FsAccess();
+}
 
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
+ze_result_t FsAccess::readValue(const std::string &file, std::string &val) {
+    // Read first word of text file, file stays open and is read again from offset 0 by next calls
+    std::array<char, 4097> buffer;
+    ssize_t bytesRead = -1;
+
+    std::lock_guard<std::mutex> lock(cachedFileDescriptorsMutex);
+    auto cachedFileDescriptor = cachedFileDescriptors.find(file);
+    if (cachedFileDescriptor != cachedFileDescriptors.end()) {
+        bytesRead = preadSyscall(cachedFileDescriptor->second, buffer.data(), buffer.size() - 1, 0);
+        if (bytesRead < 0) {
+            // file may have been recreated, e.g. after device reset
+            closeSyscall(cachedFileDescriptor->second);
+            cachedFileDescriptors.erase(cachedFileDescriptor);
+        }
     }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+
+    if (bytesRead < 0) {
+        int fd = openSyscall(file.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return getResult(errno);
+        }
+        bytesRead = preadSyscall(fd, buffer.data(), buffer.size() - 1, 0);
+        int err = errno;
+        if ((bytesRead >= 0) && (cachedFileDescriptors.size() < maxCachedFileDescriptors)) {
+            cachedFileDescriptors[file] = fd;
+        } else {
+            closeSyscall(fd);
+        }
+        if (bytesRead < 0) {
+            return getResult(err);
+        }
     }
-    fs.close();
-    return ZE_RESULT_SUCCESS;
-}
-ze_result_t FsAccess::read(const std::string file, std::string &val) {
-    // Read a single line from text file without trailing newline
-    std::ifstream fs;
-    val.clear();
+    buffer[bytesRead] = '\0';
 
-    fs.open(file.c_str());
-    if (fs.fail()) {
-        return getResult(errno);
+    const char *begin = buffer.data();
+    while ((*begin != '\0') && std::isspace(static_cast<unsigned char>(*begin))) {
+        begin++;
     }
-    fs >> val;
-    if (fs.fail()) {
-        fs.close();
-        return getResult(errno);
+    const char *end = begin;
+    while ((*end != '\0') && !std::isspace(static_cast<unsigned char>(*end))) {
+        end++;
     }
-    fs.close();
-    // Strip trailing newline
-    if (val.back() == '\n') {
-        val.pop_back();
+    if (begin == end) {
+        return ZE_RESULT_ERROR_UNKNOWN;
     }
+    val.assign(begin, end);
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t FsAccess::read(const std::string file, uint64_t &val) {
+    return readAndParseValue(*this, file, val);
+}
+
+ze_result_t FsAccess::read(const std::string file, double &val) {
+    return readAndParseValue(*this, file, val);
+}
+
+ze_result_t FsAccess::read(const std::string file, int32_t &val) {
+    return readAndParseValue(*this, file, val);
+}
+
+ze_result_t FsAccess::read(const std::string file, uint32_t &val) {
+    return readAndParseValue(*this, file, val);
+}
+ze_result_t FsAccess::read(const std::string file, std::string &val) {
+    val.clear();
+    return readValue(file, val);
+}
+
 ze_result_t FsAccess::read(const std::string file, std::vector<std::string> &val) {
     // Read a entire text file, one line per vector entry
     std::string line;
@@ -426,75 +463,23 @@ ze_result_t SysfsAccess::read(const std::string file, std::string &val) {
 }
 
 ze_result_t SysfsAccess::read(const std::string file, int32_t &val) {
-    std::string str;
-    ze_result_t result;
-
-    result = FsAccess::read(fullPath(file), str);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
-    }
-
-    std::istringstream stream(str);
-    stream >> val;
-
-    if (stream.fail()) {
-        return ZE_RESULT_ERROR_UNKNOWN;
-    }
-    return ZE_RESULT_SUCCESS;
+    // Prepend sysfs directory path and parse value read by the base read
+    return readAndParseValue(*this, fullPath(file), val);
 }
 
 ze_result_t SysfsAccess::read(const std::string file, uint32_t &val) {
-    std::string str;
-    ze_result_t result;
-
-    result = FsAccess::read(fullPath(file), str);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
-    }
-
-    std::istringstream stream(str);
-    stream >> val;
-
-    if (stream.fail()) {
-        return ZE_RESULT_ERROR_UNKNOWN;
-    }
-    return ZE_RESULT_SUCCESS;
+    // Prepend sysfs directory path and parse value read by the base read
+    return readAndParseValue(*this, fullPath(file), val);
 }
 
 ze_result_t SysfsAccess::read(const std::string file, double &val) {
-    std::string str;
-    ze_result_t result;
-
-    result = FsAccess::read(fullPath(file), str);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
-    }
-
-    std::istringstream stream(str);
-    stream >> val;
-
-    if (stream.fail()) {
-        return ZE_RESULT_ERROR_UNKNOWN;
-    }
-    return ZE_RESULT_SUCCESS;
+    // Prepend sysfs directory path and parse value read by the base read
+    return readAndParseValue(*this, fullPath(file), val);
 }
 
 ze_result_t SysfsAccess::read(const std::string file, uint64_t &val) {
-    std::string str;
-    ze_result_t result;
-
-    result = FsAccess::read(fullPath(file), str);
-    if (ZE_RESULT_SUCCESS != result) {
-        return result;
-    }
-
-    std::istringstream stream(str);
-    stream >> val;
-
-    if (stream.fail()) {
-        return ZE_RESULT_ERROR_UNKNOWN;
-    }
-    return ZE_RESULT_SUCCESS;
+    // Prepend sysfs directory path and parse value read by the base read
+    return readAndParseValue(*this, fullPath(file), val);
 }
 
 ze_result_t SysfsAccess::read(const std::string file, std::vector<std::string> &val) {
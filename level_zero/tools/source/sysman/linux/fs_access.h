@@ -15,12 +15,14 @@
 #include <fstream>
 #include <iostream>
 #include <list>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
 #include <sys/sysmacros.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <unordered_map>
 #include <vector>
 
 namespace L0 {
@@ -28,7 +30,7 @@ namespace L0 {
 class FsAccess {
   public:
     static FsAccess *create();
-    virtual ~FsAccess() = default;
+    virtual ~FsAccess();
 
     virtual ze_result_t canRead(const std::string file);
     virtual ze_result_t canWrite(const std::string file);
@@ -54,8 +56,17 @@ class FsAccess {
 
   protected:
     FsAccess();
+    ze_result_t readValue(const std::string &file, std::string &val);
+
     decltype(&NEO::SysCalls::access) accessSyscall = NEO::SysCalls::access;
     decltype(&stat) statSyscall = stat;
+    decltype(&NEO::SysCalls::open) openSyscall = NEO::SysCalls::open;
+    decltype(&NEO::SysCalls::pread) preadSyscall = NEO::SysCalls::pread;
+    decltype(&NEO::SysCalls::close) closeSyscall = NEO::SysCalls::close;
+
+    static constexpr size_t maxCachedFileDescriptors = 256;
+    std::unordered_map<std::string, int> cachedFileDescriptors;
+    std::mutex cachedFileDescriptorsMutex;
 };
 
 class ProcfsAccess : private FsAccess {
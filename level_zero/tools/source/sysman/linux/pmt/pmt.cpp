@@ -8,6 +8,7 @@
 #include "level_zero/tools/source/sysman/linux/pmt/pmt.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/string.h"
 
 #include "level_zero/tools/source/sysman/sysman_imp.h"
 
@@ -15,24 +16,68 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
 
 namespace L0 {
 const std::string PlatformMonitoringTech::baseTelemSysFS("/sys/class/intel_pmt");
 const std::string PlatformMonitoringTech::telem("telem");
 uint32_t PlatformMonitoringTech::rootDeviceTelemNodeIndex = 0;
 
-ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint32_t &value) {
+size_t PlatformMonitoringTech::getTelemetrySize() {
+    size_t telemetrySize = 0;
+    for (const auto &keyOffset : keyOffsetMap) {
+        telemetrySize = std::max(telemetrySize, static_cast<size_t>(keyOffset.second + sizeof(uint64_t)));
+    }
+    return telemetrySize;
+}
+
+// Telemetry region is mapped once, so that reading a key does not need open, pread and close calls
+bool PlatformMonitoringTech::mapTelemetry() {
+    if (NEO::DebugManager.flags.EnablePmtTelemetryMapping.get() != 1) {
+        return false;
+    }
+    if (telemetryMappingDone) {
+        return mappedTelemetry != nullptr;
+    }
+    telemetryMappingDone = true;
+
+    int fd = this->openFunction(telemetryDeviceEntry.c_str(), O_RDONLY);
+    if (fd == -1) {
+        return false;
+    }
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    mappedTelemetryOffset = static_cast<size_t>(baseOffset) % pageSize;
+    mappedTelemetrySize = mappedTelemetryOffset + getTelemetrySize();
+    void *ptr = this->mmapFunction(nullptr, mappedTelemetrySize, PROT_READ, MAP_SHARED, fd, static_cast<off_t>(baseOffset - mappedTelemetryOffset));
+    // Mapping stays valid after file is closed
+    this->closeFunction(fd);
+    if ((ptr == MAP_FAILED) || (ptr == nullptr)) {
+        NEO::printDebugString(NEO::DebugManager.flags.PrintDebugMessages.get(), stderr,
+                              "Telemetry mapping not available for %s, falling back to pread\n", telemetryDeviceEntry.c_str());
+        return false;
+    }
+    mappedTelemetry = ptr;
+    return true;
+}
+
+template <typename T>
+ze_result_t PlatformMonitoringTech::readValueImpl(const std::string &key, T &value) {
     auto offset = keyOffsetMap.find(key);
     if (offset == keyOffsetMap.end()) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
+    if (mapTelemetry()) {
+        memcpy_s(&value, sizeof(T), reinterpret_cast<uint8_t *>(mappedTelemetry) + mappedTelemetryOffset + offset->second, sizeof(T));
+        return ZE_RESULT_SUCCESS;
+    }
     int fd = this->openFunction(telemetryDeviceEntry.c_str(), O_RDONLY);
     if (fd == -1) {
         return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
     }
 
     ze_result_t res = ZE_RESULT_SUCCESS;
-    if (this->preadFunction(fd, &value, sizeof(uint32_t), baseOffset + offset->second) != sizeof(uint32_t)) {
+    if (this->preadFunction(fd, &value, sizeof(T), baseOffset + offset->second) != sizeof(T)) {
         res = ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
     }
 
@@ -43,18 +88,33 @@ ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint32_t &v
     return res;
 }
 
+ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint32_t &value) {
+    return readValueImpl(key, value);
+}
+
 ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint64_t &value) {
-    auto offset = keyOffsetMap.find(key);
-    if (offset == keyOffsetMap.end()) {
+    return readValueImpl(key, value);
+}
+
+// Copies whole telemetry block with all keys at once, so that values read from snapshot
+// are taken at the same point in time
+ze_result_t PlatformMonitoringTech::readTelemetrySnapshot(std::vector<uint8_t> &snapshot) {
+    auto telemetrySize = getTelemetrySize();
+    if (telemetrySize == 0) {
         return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
+    snapshot.resize(telemetrySize);
+    if (mapTelemetry()) {
+        memcpy_s(snapshot.data(), telemetrySize, reinterpret_cast<uint8_t *>(mappedTelemetry) + mappedTelemetryOffset, telemetrySize);
+        return ZE_RESULT_SUCCESS;
+    }
     int fd = this->openFunction(telemetryDeviceEntry.c_str(), O_RDONLY);
     if (fd == -1) {
         return ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
     }
 
     ze_result_t res = ZE_RESULT_SUCCESS;
-    if (this->preadFunction(fd, &value, sizeof(uint64_t), baseOffset + offset->second) != sizeof(uint64_t)) {
+    if (this->preadFunction(fd, snapshot.data(), telemetrySize, baseOffset) != static_cast<ssize_t>(telemetrySize)) {
         res = ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE;
     }
 
@@ -65,6 +125,27 @@ ze_result_t PlatformMonitoringTech::readValue(const std::string key, uint64_t &v
     return res;
 }
 
+template <typename T>
+ze_result_t PlatformMonitoringTech::readValueFromSnapshot(const std::vector<uint8_t> &snapshot, const std::string &key, T &value) {
+    auto offset = keyOffsetMap.find(key);
+    if (offset == keyOffsetMap.end()) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    if (offset->second + sizeof(T) > snapshot.size()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    memcpy_s(&value, sizeof(T), snapshot.data() + offset->second, sizeof(T));
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t PlatformMonitoringTech::readValue(const std::vector<uint8_t> &snapshot, const std::string key, uint32_t &value) {
+    return readValueFromSnapshot(snapshot, key, value);
+}
+
+ze_result_t PlatformMonitoringTech::readValue(const std::vector<uint8_t> &snapshot, const std::string key, uint64_t &value) {
+    return readValueFromSnapshot(snapshot, key, value);
+}
+
 bool compareTelemNodes(std::string &telemNode1, std::string &telemNode2) {
     std::string telem = "telem";
     auto indexString1 = telemNode1.substr(telem.size(), telemNode1.size());
@@ -202,6 +283,9 @@ void PlatformMonitoringTech::create(const std::vector<ze_device_handle_t> &devic
 }
 
 PlatformMonitoringTech::~PlatformMonitoringTech() {
+    if (mappedTelemetry != nullptr) {
+        this->munmapFunction(mappedTelemetry, mappedTelemetrySize);
+    }
 }
 
 } // namespace L0
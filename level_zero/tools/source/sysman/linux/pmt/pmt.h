@@ -16,6 +16,7 @@
 #include <map>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <vector>
 
 namespace L0 {
 
@@ -27,6 +28,9 @@ class PlatformMonitoringTech : NEO::NonCopyableOrMovableClass {
 
     virtual ze_result_t readValue(const std::string key, uint32_t &value);
     virtual ze_result_t readValue(const std::string key, uint64_t &value);
+    ze_result_t readTelemetrySnapshot(std::vector<uint8_t> &snapshot);
+    ze_result_t readValue(const std::vector<uint8_t> &snapshot, const std::string key, uint32_t &value);
+    ze_result_t readValue(const std::vector<uint8_t> &snapshot, const std::string key, uint64_t &value);
     static ze_result_t enumerateRootTelemIndex(FsAccess *pFsAccess, std::string &gpuUpstreamPortPath);
     static void create(const std::vector<ze_device_handle_t> &deviceHandles,
                        FsAccess *pFsAccess, std::string &gpuUpstreamPortPath,
@@ -43,8 +47,21 @@ class PlatformMonitoringTech : NEO::NonCopyableOrMovableClass {
     decltype(&NEO::SysCalls::open) openFunction = NEO::SysCalls::open;
     decltype(&NEO::SysCalls::close) closeFunction = NEO::SysCalls::close;
     decltype(&NEO::SysCalls::pread) preadFunction = NEO::SysCalls::pread;
+    decltype(&NEO::SysCalls::mmap) mmapFunction = NEO::SysCalls::mmap;
+    decltype(&NEO::SysCalls::munmap) munmapFunction = NEO::SysCalls::munmap;
+    bool mapTelemetry();
+    size_t getTelemetrySize();
+    void *mappedTelemetry = nullptr;
+    size_t mappedTelemetrySize = 0;
+    size_t mappedTelemetryOffset = 0;
+    bool telemetryMappingDone = false;
 
   private:
+    template <typename T>
+    ze_result_t readValueImpl(const std::string &key, T &value);
+    template <typename T>
+    ze_result_t readValueFromSnapshot(const std::vector<uint8_t> &snapshot, const std::string &key, T &value);
+
     static const std::string baseTelemSysFS;
     static const std::string telem;
     uint64_t baseOffset = 0;
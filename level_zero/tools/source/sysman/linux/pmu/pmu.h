@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,8 @@ class PmuInterface {
     virtual ~PmuInterface() = default;
     virtual int64_t pmuInterfaceOpen(uint64_t config, int group, uint32_t format) = 0;
     virtual int pmuRead(int fd, uint64_t *data, ssize_t sizeOfdata) = 0;
+    virtual int64_t pmuEventGroupOpen(uint64_t config, uint32_t &groupIndex) = 0;
+    virtual int pmuEventGroupRead(uint32_t groupIndex, uint64_t *data) = 0;
     static PmuInterface *create(LinuxSysmanImp *pLinuxSysmanImp);
 };
 
@@ -89,6 +89,48 @@ int PmuInterfaceImp::pmuRead(int fd, uint64_t *data, ssize_t sizeOfdata) {
     return 0;
 }
 
+int64_t PmuInterfaceImp::pmuEventGroupOpen(uint64_t config, uint32_t &groupIndex) {
+    std::lock_guard<std::mutex> lock(eventGroupMutex);
+    // First opened event becomes group leader, read of leader returns values of all events in group
+    int group = eventGroupFds.empty() ? -1 : static_cast<int>(eventGroupFds[0]);
+    int64_t fd = pmuInterfaceOpen(config, group, PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_GROUP);
+    if (fd < 0) {
+        return fd;
+    }
+    groupIndex = static_cast<uint32_t>(eventGroupFds.size());
+    eventGroupFds.push_back(fd);
+    // Layout of group read: number of events, time enabled, value of each event
+    eventGroupData.assign(eventGroupFds.size() + 2, 0u);
+    eventGroupValueConsumed.assign(eventGroupFds.size(), true);
+    return fd;
+}
+
+int PmuInterfaceImp::pmuEventGroupRead(uint32_t groupIndex, uint64_t *data) {
+    std::lock_guard<std::mutex> lock(eventGroupMutex);
+    if (groupIndex >= eventGroupFds.size()) {
+        return -ENOENT;
+    }
+    // Group is read again only when value of this event was already returned since last read,
+    // so polling all events of group costs single read call
+    if (eventGroupValueConsumed[groupIndex]) {
+        if (pmuRead(static_cast<int>(eventGroupFds[0]), eventGroupData.data(), static_cast<ssize_t>(eventGroupData.size() * sizeof(uint64_t))) < 0) {
+            return -1;
+        }
+        std::fill(eventGroupValueConsumed.begin(), eventGroupValueConsumed.end(), false);
+    }
+    eventGroupValueConsumed[groupIndex] = true;
+    data[0] = eventGroupData[groupIndex + 2];
+    data[1] = eventGroupData[1];
+    return 0;
+}
+
+PmuInterfaceImp::~PmuInterfaceImp() {
+    // Members are closed before group leader
+    for (auto fd = eventGroupFds.rbegin(); fd != eventGroupFds.rend(); ++fd) {
+        this->closeFunction(static_cast<int>(*fd));
+    }
+}
+
 PmuInterfaceImp::PmuInterfaceImp(LinuxSysmanImp *pLinuxSysmanImp) {
     pSysfsAccess = &pLinuxSysmanImp->getSysfsAccess();
     pFsAccess = &pLinuxSysmanImp->getFsAccess();
@@ -10,8 +10,11 @@
 #include "level_zero/tools/source/sysman/linux/pmu/pmu.h"
 
 #include <linux/perf_event.h>
+#include <mutex>
 #include <string>
 #include <sys/sysinfo.h>
+#include <unistd.h>
+#include <vector>
 
 namespace L0 {
 
@@ -19,15 +22,23 @@ class PmuInterfaceImp : public PmuInterface, NEO::NonCopyableOrMovableClass {
   public:
     PmuInterfaceImp() = delete;
     PmuInterfaceImp(LinuxSysmanImp *pLinuxSysmanImp);
-    ~PmuInterfaceImp() override = default;
+    ~PmuInterfaceImp() override;
     int64_t pmuInterfaceOpen(uint64_t config, int group, uint32_t format) override;
     int pmuRead(int fd, uint64_t *data, ssize_t sizeOfdata) override;
+    int64_t pmuEventGroupOpen(uint64_t config, uint32_t &groupIndex) override;
+    int pmuEventGroupRead(uint32_t groupIndex, uint64_t *data) override;
 
   protected:
     MOCKABLE_VIRTUAL int getErrorNo();
     MOCKABLE_VIRTUAL int64_t perfEventOpen(perf_event_attr *attr, pid_t pid, int cpu, int groupFd, uint64_t flags);
     decltype(&read) readFunction = read;
     decltype(&syscall) syscallFunction = syscall;
+    decltype(&close) closeFunction = close;
+
+    std::mutex eventGroupMutex;
+    std::vector<int64_t> eventGroupFds;
+    std::vector<uint64_t> eventGroupData;
+    std::vector<bool> eventGroupValueConsumed;
 
   private:
     uint32_t getEventType();
@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "level_zero/tools/source/sysman/performance/performance_governor.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include "level_zero/tools/source/sysman/sysman.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace L0 {
+
+std::unique_ptr<PerformanceGovernor> PerformanceGovernor::create(SysmanDevice *pSysmanDevice) {
+    auto samplingIntervalMs = NEO::DebugManager.flags.SysmanPerformanceGovernorIntervalMs.get();
+    if (samplingIntervalMs <= 0) {
+        return nullptr;
+    }
+    auto governor = std::make_unique<PerformanceGovernor>(pSysmanDevice, static_cast<uint32_t>(samplingIntervalMs));
+    governor->start();
+    return governor;
+}
+
+PerformanceGovernor::PerformanceGovernor(SysmanDevice *pSysmanDevice, uint32_t samplingIntervalMs)
+    : pSysmanDevice(pSysmanDevice), samplingIntervalMs(samplingIntervalMs) {}
+
+PerformanceGovernor::~PerformanceGovernor() {
+    stop();
+}
+
+// Idle device is left balanced, otherwise share of memory bandwidth in use lowers the factor in steps
+double PerformanceGovernor::getTargetFactor(double engineUtilization, double memoryUtilization) {
+    if (engineUtilization < idleEngineUtilization) {
+        return balancedFactor;
+    }
+    auto factor = maxFactor * (1.0 - std::clamp(memoryUtilization, 0.0, 1.0));
+    factor = std::round(factor / factorStep) * factorStep;
+    return std::clamp(factor, minFactor, maxFactor);
+}
+
+bool PerformanceGovernor::onSample(double engineUtilization, double memoryUtilization, double &factorToApply) {
+    auto targetFactor = getTargetFactor(engineUtilization, memoryUtilization);
+    if (targetFactor == appliedFactor) {
+        pendingSamplesCount = 0u;
+        return false;
+    }
+    if (targetFactor != pendingFactor) {
+        pendingFactor = targetFactor;
+        pendingSamplesCount = 0u;
+    }
+    if (++pendingSamplesCount < hysteresisSamplesCount) {
+        return false;
+    }
+    appliedFactor = targetFactor;
+    pendingSamplesCount = 0u;
+    factorToApply = targetFactor;
+    return true;
+}
+
+void PerformanceGovernor::start() {
+    thread = std::thread([this]() { this->run(); });
+}
+
+void PerformanceGovernor::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopRequested = true;
+    }
+    condition.notify_all();
+    if (thread.joinable()) {
+        thread.join();
+    }
+}
+
+void PerformanceGovernor::run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!condition.wait_for(lock, std::chrono::milliseconds(samplingIntervalMs), [this]() { return stopRequested; })) {
+        double engineUtilization = 0.0;
+        double memoryUtilization = 0.0;
+        double factor = 0.0;
+        if (sampleUtilization(engineUtilization, memoryUtilization) && onSample(engineUtilization, memoryUtilization, factor)) {
+            applyFactor(factor);
+        }
+    }
+}
+
+bool PerformanceGovernor::sampleUtilization(double &engineUtilization, double &memoryUtilization) {
+    uint32_t count = 0;
+    pSysmanDevice->engineGet(&count, nullptr);
+    std::vector<zes_engine_handle_t> engines(count);
+    pSysmanDevice->engineGet(&count, engines.data());
+
+    std::vector<zes_engine_stats_t> engineStats;
+    for (auto hEngine : engines) {
+        zes_engine_properties_t properties = {};
+        zes_engine_stats_t stats = {};
+        auto pEngine = Engine::fromHandle(hEngine);
+        if (pEngine->engineGetProperties(&properties) != ZE_RESULT_SUCCESS ||
+            (properties.type != ZES_ENGINE_GROUP_COMPUTE_ALL && properties.type != ZES_ENGINE_GROUP_COMPUTE_SINGLE) ||
+            pEngine->engineGetActivity(&stats) != ZE_RESULT_SUCCESS) {
+            continue;
+        }
+        engineStats.push_back(stats);
+    }
+
+    count = 0;
+    pSysmanDevice->memoryGet(&count, nullptr);
+    std::vector<zes_mem_handle_t> memories(count);
+    pSysmanDevice->memoryGet(&count, memories.data());
+
+    std::vector<zes_mem_bandwidth_t> bandwidths;
+    for (auto hMemory : memories) {
+        zes_mem_bandwidth_t bandwidth = {};
+        if (Memory::fromHandle(hMemory)->memoryGetBandwidth(&bandwidth) == ZE_RESULT_SUCCESS) {
+            bandwidths.push_back(bandwidth);
+        }
+    }
+
+    // utilization is computed from counter deltas, first sample and changed handle sets only store counters
+    bool validSample = !engineStats.empty() && engineStats.size() == previousEngineStats.size() && bandwidths.size() == previousBandwidths.size();
+    engineUtilization = 0.0;
+    memoryUtilization = 0.0;
+    for (size_t i = 0; validSample && i < engineStats.size(); i++) {
+        auto elapsed = engineStats[i].timestamp - previousEngineStats[i].timestamp;
+        if (elapsed > 0u) {
+            engineUtilization = std::max(engineUtilization, static_cast<double>(engineStats[i].activeTime - previousEngineStats[i].activeTime) / elapsed);
+        }
+    }
+    for (size_t i = 0; validSample && i < bandwidths.size(); i++) {
+        auto elapsedUs = bandwidths[i].timestamp - previousBandwidths[i].timestamp;
+        if (elapsedUs > 0u && bandwidths[i].maxBandwidth > 0u) {
+            auto transferredBytes = (bandwidths[i].readCounter - previousBandwidths[i].readCounter) + (bandwidths[i].writeCounter - previousBandwidths[i].writeCounter);
+            auto maxBytes = static_cast<double>(bandwidths[i].maxBandwidth) * elapsedUs / 1000000.0;
+            memoryUtilization = std::max(memoryUtilization, static_cast<double>(transferredBytes) / maxBytes);
+        }
+    }
+
+    previousEngineStats = std::move(engineStats);
+    previousBandwidths = std::move(bandwidths);
+    return validSample;
+}
+
+void PerformanceGovernor::applyFactor(double factor) {
+    uint32_t count = 0;
+    pSysmanDevice->performanceGet(&count, nullptr);
+    std::vector<zes_perf_handle_t> performanceHandles(count);
+    pSysmanDevice->performanceGet(&count, performanceHandles.data());
+
+    for (auto hPerformance : performanceHandles) {
+        zes_perf_properties_t properties = {};
+        auto pPerformance = Performance::fromHandle(hPerformance);
+        if (pPerformance->performanceGetProperties(&properties) == ZE_RESULT_SUCCESS &&
+            (properties.engines & ZES_ENGINE_TYPE_FLAG_COMPUTE)) {
+            pPerformance->performanceSetConfig(factor);
+        }
+    }
+}
+
+} // namespace L0
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <level_zero/zes_api.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace L0 {
+
+struct SysmanDevice;
+
+// Opt-in governor adjusting performance factor of compute domains to the running workload phase.
+// Compute engine utilization and memory bandwidth utilization are sampled periodically, memory bound
+// phases get lower factor and compute bound phases get maximal factor. New factor is applied only after
+// consecutive samples requested it, so short phases do not toggle the hardware setting.
+class PerformanceGovernor : NEO::NonCopyableOrMovableClass {
+  public:
+    static constexpr double minFactor = 25.0;
+    static constexpr double maxFactor = 100.0;
+    static constexpr double balancedFactor = 50.0;
+    static constexpr double factorStep = 25.0;
+    static constexpr double idleEngineUtilization = 0.1;
+    static constexpr uint32_t hysteresisSamplesCount = 3u;
+
+    static std::unique_ptr<PerformanceGovernor> create(SysmanDevice *pSysmanDevice);
+    static double getTargetFactor(double engineUtilization, double memoryUtilization);
+
+    PerformanceGovernor(SysmanDevice *pSysmanDevice, uint32_t samplingIntervalMs);
+    MOCKABLE_VIRTUAL ~PerformanceGovernor();
+
+    void start();
+    void stop();
+    bool onSample(double engineUtilization, double memoryUtilization, double &factorToApply);
+
+  protected:
+    void run();
+    MOCKABLE_VIRTUAL bool sampleUtilization(double &engineUtilization, double &memoryUtilization);
+    MOCKABLE_VIRTUAL void applyFactor(double factor);
+
+    SysmanDevice *pSysmanDevice = nullptr;
+    const uint32_t samplingIntervalMs;
+    std::vector<zes_engine_stats_t> previousEngineStats;
+    std::vector<zes_mem_bandwidth_t> previousBandwidths;
+
+    double appliedFactor = -1.0;
+    double pendingFactor = -1.0;
+    uint32_t pendingSamplesCount = 0u;
+
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool stopRequested = false;
+};
+
+} // namespace L0
@@ -10,6 +10,7 @@
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/driver/driver.h"
 #include "level_zero/core/source/driver/driver_handle_imp.h"
+#include "level_zero/tools/source/sysman/events/os_events.h"
 #include "level_zero/tools/source/sysman/sysman_imp.h"
 
 #include <cstring>
@@ -56,6 +57,7 @@ ze_result_t DriverHandleImp::sysmanEventsListen(
     zes_event_type_flags_t *pEvents) {
     bool gotSysmanEvent = false;
     memset(pEvents, 0, count * sizeof(zes_event_type_flags_t));
+    std::unique_ptr<OsEventsWaiter> eventsWaiter(OsEventsWaiter::create());
     auto timeToExitLoop = L0::steadyClock::now() + std::chrono::milliseconds(timeout);
     do {
         for (uint32_t devIndex = 0; devIndex < count; devIndex++) {
@@ -68,7 +70,11 @@ ze_result_t DriverHandleImp::sysmanEventsListen(
         if (gotSysmanEvent) {
             break;
         }
-        std::this_thread::sleep_for(std::chrono::milliseconds(10)); // Sleep for 10 milliseconds before next check of events
+        auto now = L0::steadyClock::now();
+        if (now > timeToExitLoop) {
+            break;
+        }
+        eventsWaiter->wait(std::chrono::duration_cast<std::chrono::milliseconds>(timeToExitLoop - now).count()); // Wait before next check of events
     } while ((L0::steadyClock::now() <= timeToExitLoop));
 
     return ZE_RESULT_SUCCESS;
@@ -82,6 +88,7 @@ ze_result_t DriverHandleImp::sysmanEventsListenEx(
     zes_event_type_flags_t *pEvents) {
     bool gotSysmanEvent = false;
     memset(pEvents, 0, count * sizeof(zes_event_type_flags_t));
+    std::unique_ptr<OsEventsWaiter> eventsWaiter(OsEventsWaiter::create());
     auto timeToExitLoop = L0::steadyClock::now() + std::chrono::duration<uint64_t, std::milli>(timeout);
     do {
         for (uint32_t devIndex = 0; devIndex < count; devIndex++) {
@@ -94,7 +101,11 @@ ze_result_t DriverHandleImp::sysmanEventsListenEx(
         if (gotSysmanEvent) {
             break;
         }
-        std::this_thread::sleep_for(std::chrono::milliseconds(10)); // Sleep for 10 milliseconds before next check of events
+        auto now = L0::steadyClock::now();
+        if (now > timeToExitLoop) {
+            break;
+        }
+        eventsWaiter->wait(std::chrono::duration_cast<std::chrono::milliseconds>(timeToExitLoop - now).count()); // Wait before next check of events
     } while ((L0::steadyClock::now() <= timeToExitLoop));
 
     return ZE_RESULT_SUCCESS;
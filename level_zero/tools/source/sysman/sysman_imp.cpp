@@ -43,6 +43,7 @@ SysmanDeviceImp::SysmanDeviceImp(ze_device_handle_t hDevice) {
 }
 
 SysmanDeviceImp::~SysmanDeviceImp() {
+    performanceGovernor.reset();
     freeResource(pPerformanceHandleContext);
     freeResource(pDiagnosticsHandleContext);
     freeResource(pFirmwareHandleContext);
@@ -101,6 +102,7 @@ ze_result_t SysmanDeviceImp::init() {
     if (ZE_RESULT_SUCCESS != result) {
         return result;
     }
+    performanceGovernor = PerformanceGovernor::create(this);
     return result;
 }
 
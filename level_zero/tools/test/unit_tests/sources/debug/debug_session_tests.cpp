@@ -33,8 +33,10 @@ struct MockDebugSession : public L0::DebugSessionImp {
     using L0::DebugSession::allThreads;
     using L0::DebugSession::debugArea;
 
+    using L0::DebugSessionImp::cacheThreadsStateSaveArea;
     using L0::DebugSessionImp::calculateThreadSlotOffset;
     using L0::DebugSessionImp::checkTriggerEventsForAttention;
+    using L0::DebugSessionImp::clearThreadsStateSaveAreaCache;
     using L0::DebugSessionImp::fillResumeAndStoppedThreadsFromNewlyStopped;
     using L0::DebugSessionImp::generateEventsAndResumeStoppedThreads;
     using L0::DebugSessionImp::generateEventsForPendingInterrupts;
@@ -991,6 +993,85 @@ TEST(DebugSessionTest, givenSrMagicWithCounterLessThanlLastThreadCounterThenThre
     EXPECT_EQ(1u, sessionMock->checkThreadIsResumedCalled);
 }
 
+TEST(DebugSessionTest, givenMultipleThreadsWhenStateSaveAreaIsCachedThenSrIdentsAreReadWithSingleMemoryRead) {
+    class InternalMockDebugSession : public MockDebugSession {
+      public:
+        InternalMockDebugSession(const zet_debug_config_t &config, L0::Device *device) : MockDebugSession(config, device) {}
+        ze_result_t readGpuMemory(uint64_t memoryHandle, char *output, size_t size, uint64_t gpuVa) override {
+            readGpuMemoryCalled++;
+            return MockDebugSession::readGpuMemory(memoryHandle, output, size, gpuVa);
+        }
+        bool readSystemRoutineIdentBase(EuThread *thread, uint64_t vmHandle, SIP::sr_ident &srIdent) {
+            return DebugSessionImp::readSystemRoutineIdent(thread, vmHandle, srIdent);
+        }
+        uint32_t readGpuMemoryCalled = 0;
+    };
+    zet_debug_config_t config = {};
+    config.pid = 0x1234;
+    auto hwInfo = *NEO::defaultHwInfo.get();
+
+    NEO::MockDevice *neoDevice(NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo, 0));
+    Mock<L0::DeviceImp> deviceImp(neoDevice, neoDevice->getExecutionEnvironment());
+
+    auto sessionMock = std::make_unique<InternalMockDebugSession>(config, &deviceImp);
+    ASSERT_NE(nullptr, sessionMock);
+    sessionMock->stateSaveAreaHeader = MockSipData::createStateSaveAreaHeader(2);
+
+    EuThread::ThreadId thread0(0, ze_device_thread_t{0, 0, 0, 0});
+    EuThread::ThreadId thread1(0, ze_device_thread_t{0, 0, 1, 0});
+    auto pStateSaveAreaHeader = reinterpret_cast<const SIP::StateSaveAreaHeader *>(sessionMock->stateSaveAreaHeader.data());
+    const auto srMagicOffset = pStateSaveAreaHeader->regHeader.sr_magic_offset;
+    const auto stateSaveSize = pStateSaveAreaHeader->regHeader.state_save_size;
+    const auto thread0SlotOffset = sessionMock->calculateThreadSlotOffset(thread0);
+    const auto thread1SlotOffset = sessionMock->calculateThreadSlotOffset(thread1);
+    sessionMock->stateSaveAreaHeader.resize(thread1SlotOffset + stateSaveSize);
+
+    reinterpret_cast<SIP::sr_ident *>(sessionMock->stateSaveAreaHeader.data() + thread0SlotOffset + srMagicOffset)->count = 3;
+    reinterpret_cast<SIP::sr_ident *>(sessionMock->stateSaveAreaHeader.data() + thread1SlotOffset + srMagicOffset)->count = 5;
+
+    sessionMock->cacheThreadsStateSaveArea({thread0, thread1}, 1u);
+    EXPECT_EQ(1u, sessionMock->readGpuMemoryCalled);
+
+    SIP::sr_ident srIdent = {};
+    EXPECT_TRUE(sessionMock->readSystemRoutineIdentBase(sessionMock->allThreads[thread0].get(), 1u, srIdent));
+    EXPECT_EQ(3u, srIdent.count);
+    EXPECT_TRUE(sessionMock->readSystemRoutineIdentBase(sessionMock->allThreads[thread1].get(), 1u, srIdent));
+    EXPECT_EQ(5u, srIdent.count);
+    EXPECT_EQ(1u, sessionMock->readGpuMemoryCalled);
+
+    sessionMock->clearThreadsStateSaveAreaCache();
+    srIdent = {};
+    EXPECT_TRUE(sessionMock->readSystemRoutineIdentBase(sessionMock->allThreads[thread1].get(), 1u, srIdent));
+    EXPECT_EQ(5u, srIdent.count);
+    EXPECT_EQ(2u, sessionMock->readGpuMemoryCalled);
+}
+
+TEST(DebugSessionTest, givenSingleThreadWhenStateSaveAreaCacheIsRequestedThenNoMemoryIsRead) {
+    class InternalMockDebugSession : public MockDebugSession {
+      public:
+        InternalMockDebugSession(const zet_debug_config_t &config, L0::Device *device) : MockDebugSession(config, device) {}
+        ze_result_t readGpuMemory(uint64_t memoryHandle, char *output, size_t size, uint64_t gpuVa) override {
+            readGpuMemoryCalled++;
+            return MockDebugSession::readGpuMemory(memoryHandle, output, size, gpuVa);
+        }
+        uint32_t readGpuMemoryCalled = 0;
+    };
+    zet_debug_config_t config = {};
+    config.pid = 0x1234;
+    auto hwInfo = *NEO::defaultHwInfo.get();
+
+    NEO::MockDevice *neoDevice(NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo, 0));
+    Mock<L0::DeviceImp> deviceImp(neoDevice, neoDevice->getExecutionEnvironment());
+
+    auto sessionMock = std::make_unique<InternalMockDebugSession>(config, &deviceImp);
+    ASSERT_NE(nullptr, sessionMock);
+    sessionMock->stateSaveAreaHeader = MockSipData::createStateSaveAreaHeader(2);
+
+    EuThread::ThreadId thread0(0, ze_device_thread_t{0, 0, 0, 0});
+    sessionMock->cacheThreadsStateSaveArea({thread0}, 1u);
+    EXPECT_EQ(0u, sessionMock->readGpuMemoryCalled);
+}
+
 TEST(DebugSessionTest, givenSrMagicWithCounterEqualToPrevousThenThreadHasNotBeenResumed) {
     class InternalMockDebugSession : public MockDebugSession {
       public:
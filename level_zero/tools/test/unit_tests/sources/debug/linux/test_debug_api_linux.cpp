@@ -5535,6 +5535,43 @@ TEST_F(DebugApiLinuxAsyncThreadTest, GivenPollReturnsNonZeroWhenReadingEventsAsy
     EXPECT_EQ(3u, session->internalEventQueue.size());
 }
 
+TEST_F(DebugApiLinuxAsyncThreadTest, GivenMultipleEventsReadOnOnePollWhenReadingEventsAsyncThenEventsAreQueuedInReadOrder) {
+    zet_debug_config_t config = {};
+    config.pid = 0x1234;
+
+    auto session = std::make_unique<MockDebugSessionLinux>(config, device, 10);
+    ASSERT_NE(nullptr, session);
+
+    auto handler = new MockIoctlHandler;
+    handler->pollRetVal = 1;
+    session->ioctlHandler.reset(handler);
+
+    prelim_drm_i915_debug_event_client client = {};
+    client.base.type = PRELIM_DRM_I915_DEBUG_EVENT_CLIENT;
+    client.base.flags = PRELIM_DRM_I915_DEBUG_EVENT_CREATE;
+    client.base.size = sizeof(prelim_drm_i915_debug_event_client);
+    client.handle = 2;
+
+    prelim_drm_i915_debug_event_context context = {};
+    context.base.type = PRELIM_DRM_I915_DEBUG_EVENT_CONTEXT;
+    context.base.flags = PRELIM_DRM_I915_DEBUG_EVENT_CREATE;
+    context.base.size = sizeof(prelim_drm_i915_debug_event_context);
+    context.client_handle = 2;
+    context.handle = 3;
+
+    handler->eventQueue.push({reinterpret_cast<char *>(&client), static_cast<uint64_t>(client.base.size)});
+    handler->eventQueue.push({reinterpret_cast<char *>(&context), static_cast<uint64_t>(context.base.size)});
+
+    session->readInternalEventsAsync();
+
+    ASSERT_EQ(2u, session->internalEventQueue.size());
+    auto firstEvent = reinterpret_cast<prelim_drm_i915_debug_event *>(session->internalEventQueue.front().get());
+    EXPECT_EQ(static_cast<decltype(prelim_drm_i915_debug_event::type)>(PRELIM_DRM_I915_DEBUG_EVENT_CLIENT), firstEvent->type);
+    session->internalEventQueue.pop();
+    auto secondEvent = reinterpret_cast<prelim_drm_i915_debug_event *>(session->internalEventQueue.front().get());
+    EXPECT_EQ(static_cast<decltype(prelim_drm_i915_debug_event::type)>(PRELIM_DRM_I915_DEBUG_EVENT_CONTEXT), secondEvent->type);
+}
+
 TEST_F(DebugApiLinuxAsyncThreadTest, GivenDebugSessionWhenStartingAndClosingAsyncThreadThenThreadIsStartedAndFinishes) {
     zet_debug_config_t config = {};
     config.pid = 0x1234;
@@ -5,6 +5,7 @@
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/test_macros/test_base.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist.h"
@@ -333,6 +334,41 @@ TEST_F(MetricIpSamplingCalculateMetricsTest, GivenEnumerationIsSuccessfulWhenCal
     }
 }
 
+TEST_F(MetricIpSamplingCalculateMetricsTest, GivenMultipleCalculationThreadsWhenCalculateMetricValuesIsCalledThenPartialSumsAreMergedAndValidDataIsReturned) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.IpSamplingCalculationThreads.set(3);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, testDevices[0]->getMetricDeviceContext().enableMetricApi());
+
+    std::vector<zet_typed_value_t> metricValues(30);
+
+    for (auto device : testDevices) {
+
+        uint32_t metricGroupCount = 0;
+        zetMetricGroupGet(device->toHandle(), &metricGroupCount, nullptr);
+        std::vector<zet_metric_group_handle_t> metricGroups;
+        metricGroups.resize(metricGroupCount);
+        ASSERT_EQ(zetMetricGroupGet(device->toHandle(), &metricGroupCount, metricGroups.data()), ZE_RESULT_SUCCESS);
+        ASSERT_NE(metricGroups[0], nullptr);
+
+        uint32_t metricValueCount = 30;
+        EXPECT_EQ(zetMetricGroupCalculateMetricValues(metricGroups[0], ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES,
+                                                      rawDataVectorSize, reinterpret_cast<uint8_t *>(rawDataVector.data()), &metricValueCount, metricValues.data()),
+                  ZE_RESULT_SUCCESS);
+        EXPECT_EQ(20u, metricValueCount);
+        for (uint32_t i = 0; i < metricValueCount; i++) {
+            EXPECT_EQ(expectedMetricValues[i].type, metricValues[i].type);
+            EXPECT_EQ(expectedMetricValues[i].value.ui64, metricValues[i].value.ui64);
+        }
+
+        metricValueCount = 30;
+        EXPECT_EQ(zetMetricGroupCalculateMetricValues(metricGroups[0], ZET_METRIC_GROUP_CALCULATION_TYPE_METRIC_VALUES,
+                                                      rawDataVectorOverflowSize, reinterpret_cast<uint8_t *>(rawDataVectorOverflow.data()), &metricValueCount, metricValues.data()),
+                  ZE_RESULT_WARNING_DROPPED_DATA);
+        EXPECT_EQ(20u, metricValueCount);
+    }
+}
+
 TEST_F(MetricIpSamplingCalculateMetricsTest, GivenEnumerationIsSuccessfulWhenCalculateMetricValuesIsCalledWithSmallValueCountThenValidDataIsReturned) {
 
     EXPECT_EQ(ZE_RESULT_SUCCESS, testDevices[0]->getMetricDeviceContext().enableMetricApi());
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/test_macros/test_base.h"
+
+#include "level_zero/tools/source/metrics/metric_ip_sampling_kernel_report.h"
+#include "level_zero/tools/source/metrics/metric_ip_sampling_source.h"
+#include "level_zero/tools/test/unit_tests/sources/metrics/metric_ip_sampling_fixture.h"
+#include <level_zero/zet_api.h>
+
+namespace L0 {
+namespace ult {
+
+TEST(IpSamplingKernelStallReportTest, givenRegisteredKernelsWhenAttributingStallSamplesThenSamplesAreSummedPerKernelAndIsaOffset) {
+    IpSamplingKernelStallReport report;
+    report.addKernel("kernelA", 0x0, 0x100);
+    report.addKernel("kernelB", 0x100, 0x40);
+
+    StallSumIpDataMap_t stallSumIpDataMap;
+    stallSumIpDataMap[0x2].activeCount = 3;
+    stallSumIpDataMap[0x4].sendCount = 5;
+    stallSumIpDataMap[0x21].sbidCount = 7;
+    stallSumIpDataMap[0x28].controlCount = 11;
+    report.attribute(stallSumIpDataMap);
+
+    auto kernelA = report.getKernelEntry("kernelA");
+    ASSERT_NE(nullptr, kernelA);
+    EXPECT_EQ(8u, IpSamplingKernelStallReport::getSamplesCount(kernelA->stalls));
+    EXPECT_EQ(3u, kernelA->stalls.activeCount);
+    EXPECT_EQ(5u, kernelA->stalls.sendCount);
+    ASSERT_EQ(2u, kernelA->stallsPerIsaOffset.size());
+    EXPECT_EQ(3u, kernelA->stallsPerIsaOffset.at(0x10).activeCount);
+    EXPECT_EQ(5u, kernelA->stallsPerIsaOffset.at(0x20).sendCount);
+
+    auto kernelB = report.getKernelEntry("kernelB");
+    ASSERT_NE(nullptr, kernelB);
+    EXPECT_EQ(7u, kernelB->stalls.sbidCount);
+    EXPECT_EQ(7u, kernelB->stallsPerIsaOffset.at(0x8).sbidCount);
+
+    EXPECT_EQ(11u, report.getUnattributedStalls().controlCount);
+    EXPECT_EQ(nullptr, report.getKernelEntry("kernelC"));
+
+    auto reportString = report.getReport();
+    EXPECT_NE(std::string::npos, reportString.find("Kernel kernelA, 8 samples: active 3, control 0, pipe 0, send 5"));
+    EXPECT_NE(std::string::npos, reportString.find("  ISA offset 0x20, 5 samples"));
+    EXPECT_NE(std::string::npos, reportString.find("Kernel kernelB, 7 samples"));
+    EXPECT_NE(std::string::npos, reportString.find("Unattributed, 11 samples"));
+    EXPECT_LT(reportString.find("Kernel kernelA"), reportString.find("Kernel kernelB"));
+}
+
+using MetricIpSamplingKernelReportTest = MetricIpSamplingCalculateMetricsFixture;
+
+TEST_F(MetricIpSamplingKernelReportTest, givenRawIpSamplesWhenCalculatingKernelStallReportThenSamplesAreAttributedToKernels) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, testDevices[0]->getMetricDeviceContext().enableMetricApi());
+
+    auto device = testDevices[1];
+    uint32_t metricGroupCount = 1;
+    zet_metric_group_handle_t hMetricGroup = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zetMetricGroupGet(device->toHandle(), &metricGroupCount, &hMetricGroup));
+    auto metricGroup = static_cast<IpSamplingMetricGroupImp *>(MetricGroup::fromHandle(hMetricGroup));
+
+    IpSamplingKernelStallReport report;
+    report.addKernel("kernelA", 0x0, 0x40);
+    report.addKernel("kernelB", 0x40, 0x40);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, metricGroup->calculateKernelStallReport(rawDataVectorSize - 1, reinterpret_cast<uint8_t *>(rawDataVector.data()), report));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, metricGroup->calculateKernelStallReport(rawDataVectorSize, reinterpret_cast<uint8_t *>(rawDataVector.data()), report));
+
+    auto kernelA = report.getKernelEntry("kernelA");
+    ASSERT_NE(nullptr, kernelA);
+    EXPECT_EQ(11u, kernelA->stalls.activeCount);
+    EXPECT_EQ(11u, kernelA->stallsPerIsaOffset.at(0x8).instFetchCount);
+
+    auto kernelB = report.getKernelEntry("kernelB");
+    ASSERT_NE(nullptr, kernelB);
+    EXPECT_EQ(110u, kernelB->stalls.sbidCount);
+    EXPECT_EQ(110u, kernelB->stallsPerIsaOffset.at(0x10).activeCount);
+
+    EXPECT_EQ(ZE_RESULT_WARNING_DROPPED_DATA, metricGroup->calculateKernelStallReport(rawDataVectorOverflowSize, reinterpret_cast<uint8_t *>(rawDataVectorOverflow.data()), report));
+    EXPECT_EQ(22u, kernelA->stalls.activeCount);
+}
+
+} // namespace ult
+} // namespace L0
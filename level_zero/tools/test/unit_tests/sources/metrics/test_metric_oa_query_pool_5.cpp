@@ -5,6 +5,8 @@
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
 #include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
 #include "level_zero/tools/source/metrics/metric_oa_source.h"
 #include "level_zero/tools/test/unit_tests/sources/metrics/metric_query_pool_fixture.h"
@@ -489,5 +491,52 @@ TEST_F(MultiDeviceMetricQueryPoolTest, givenMetricQueryPoolIsDestroyedWhenMetric
     EXPECT_EQ(workloadPartition.WorkloadPartition.Enabled, true);
 }
 
+TEST_F(MetricQueryPoolTest, givenKernelSamplingDisabledWhenAppendKernelSampleBeginIsCalledThenNoSampleIsTaken) {
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue));
+
+    auto &metricSource = device->getMetricDeviceContext().getMetricSource<OaMetricSourceImp>();
+    metricSource.setInitializationState(ZE_RESULT_SUCCESS);
+    EXPECT_EQ(nullptr, metricSource.getKernelSampler());
+
+    uint32_t sampleSlot = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, device->getMetricDeviceContext().appendKernelSampleBegin(*commandList, "kernel", sampleSlot));
+    EXPECT_EQ(OaMetricKernelSampler::invalidSlot, sampleSlot);
+}
+
+TEST_F(MetricQueryPoolTest, givenKernelSamplingPeriodWhenCheckingLaunchesThenEveryNthLaunchIsSampled) {
+    auto &metricSource = device->getMetricDeviceContext().getMetricSource<OaMetricSourceImp>();
+    OaMetricKernelSampler kernelSampler(metricSource, 3u, 4u);
+
+    EXPECT_FALSE(kernelSampler.isLaunchSampled(1));
+    EXPECT_FALSE(kernelSampler.isLaunchSampled(2));
+    EXPECT_TRUE(kernelSampler.isLaunchSampled(3));
+    EXPECT_FALSE(kernelSampler.isLaunchSampled(4));
+    EXPECT_FALSE(kernelSampler.isLaunchSampled(5));
+    EXPECT_TRUE(kernelSampler.isLaunchSampled(6));
+}
+
+TEST_F(MetricQueryPoolTest, givenKernelSamplingEnabledAndNoActivatedMetricGroupWhenAppendKernelSampleBeginIsCalledThenNoQueryIsAppended) {
+    DebugManagerStateRestore restorer;
+    NEO::DebugManager.flags.MetricKernelSamplingPeriod.set(1);
+
+    ze_result_t returnValue;
+    std::unique_ptr<L0::CommandList> commandList(CommandList::create(productFamily, device, NEO::EngineGroupType::RenderCompute, 0u, returnValue));
+
+    auto &metricSource = device->getMetricDeviceContext().getMetricSource<OaMetricSourceImp>();
+    metricSource.setInitializationState(ZE_RESULT_SUCCESS);
+    auto kernelSampler = metricSource.getKernelSampler();
+    ASSERT_NE(nullptr, kernelSampler);
+    EXPECT_EQ(kernelSampler, metricSource.getKernelSampler());
+
+    uint32_t sampleSlot = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, device->getMetricDeviceContext().appendKernelSampleBegin(*commandList, "kernel", sampleSlot));
+    EXPECT_EQ(OaMetricKernelSampler::invalidSlot, sampleSlot);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, device->getMetricDeviceContext().appendKernelSampleEnd(*commandList, sampleSlot));
+    EXPECT_TRUE(kernelSampler->getKernelSamples().empty());
+
+    device->getMetricDeviceContext().releaseKernelSampler();
+}
+
 } // namespace ult
 } // namespace L0
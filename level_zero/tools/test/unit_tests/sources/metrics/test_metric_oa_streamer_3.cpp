@@ -5,10 +5,12 @@
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/test_macros/test.h"
 #include "shared/test/common/test_macros/test_base.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist.h"
+#include "level_zero/tools/source/metrics/metric_oa_streamer_imp.h"
 #include "level_zero/tools/test/unit_tests/sources/metrics/mock_metric_oa.h"
 
 using ::testing::_;
@@ -342,5 +344,27 @@ TEST_F(MetricStreamerTest, givenRawReportSizeIsNotAlignedToOaBufferSizeWhenZetMe
     EXPECT_EQ(zetMetricStreamerClose(streamerHandle), ZE_RESULT_SUCCESS);
 }
 
+struct MockOaMetricStreamerImp : public OaMetricStreamerImp {
+    using OaMetricStreamerImp::getNotifyEveryNReports;
+    using OaMetricStreamerImp::getOaBufferSize;
+    using OaMetricStreamerImp::rawReportSize;
+};
+
+TEST(OaMetricStreamerImpTest, givenMetricStreamerOaBufferReportsMultiplierSetWhenGettingOaBufferSizeThenBufferHoldsRequestedMultipleOfNotifiedReports) {
+    DebugManagerStateRestore restorer;
+    MockOaMetricStreamerImp metricStreamer;
+    metricStreamer.rawReportSize = 256;
+
+    EXPECT_EQ(100u * 256u * 2u, metricStreamer.getOaBufferSize(100u));
+    EXPECT_EQ(100u, metricStreamer.getNotifyEveryNReports(100u * 256u * 2u));
+
+    DebugManager.flags.MetricStreamerOaBufferReportsMultiplier.set(8);
+    EXPECT_EQ(100u * 256u * 8u, metricStreamer.getOaBufferSize(100u));
+    EXPECT_EQ(100u, metricStreamer.getNotifyEveryNReports(100u * 256u * 8u));
+
+    DebugManager.flags.MetricStreamerOaBufferReportsMultiplier.set(1);
+    EXPECT_EQ(100u * 256u * 2u, metricStreamer.getOaBufferSize(100u));
+}
+
 } // namespace ult
 } // namespace L0
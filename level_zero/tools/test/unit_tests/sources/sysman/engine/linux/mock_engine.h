@@ -69,6 +69,7 @@ struct Mock<EngineNeoDrm> : public EngineNeoDrm {
 
 class MockPmuInterfaceImp : public PmuInterfaceImp {
   public:
+    using PmuInterfaceImp::closeFunction;
     using PmuInterfaceImp::perfEventOpen;
     MockPmuInterfaceImp(LinuxSysmanImp *pLinuxSysmanImp) : PmuInterfaceImp(pLinuxSysmanImp) {}
 };
@@ -86,6 +87,15 @@ struct Mock<MockPmuInterfaceImp> : public MockPmuInterfaceImp {
         data[1] = mockTimestamp;
         return 0;
     }
+    int mockedPmuGroupReadAndSuccessReturn(int fd, uint64_t *data, ssize_t sizeOfdata) {
+        auto eventCount = static_cast<uint64_t>(sizeOfdata / sizeof(uint64_t)) - 2;
+        data[0] = eventCount;
+        data[1] = mockTimestamp;
+        for (uint64_t i = 0; i < eventCount; i++) {
+            data[i + 2] = mockActiveTime * (i + 1);
+        }
+        return 0;
+    }
     int mockedPmuReadAndFailureReturn(int fd, uint64_t *data, ssize_t sizeOfdata) {
         return -1;
     }
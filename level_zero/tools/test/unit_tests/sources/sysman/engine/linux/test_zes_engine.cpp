@@ -196,6 +196,36 @@ TEST_F(ZesEngineFixture, GivenTestIntegratedDevicesAndValidEngineHandleWhenCalli
     delete pOsEngineTest1;
 }
 
+inline static int closeReturnSuccess(int fd) {
+    return 0;
+}
+
+TEST_F(ZesEngineFixture, GivenEngineGroupPmuReadEnabledWhenCallingGetActivityForAllEnginesThenPmuIsReadOnceAndEachEngineGetsItsOwnValue) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableSysmanEngineGroupPmuRead.set(1);
+    pPmuInterface->closeFunction = closeReturnSuccess;
+    EXPECT_CALL(*pPmuInterface.get(), pmuRead(static_cast<int>(mockPmuFd), _, static_cast<ssize_t>(4 * sizeof(uint64_t))))
+        .Times(2)
+        .WillRepeatedly(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImp>::mockedPmuGroupReadAndSuccessReturn));
+
+    auto pOsEngineTest1 = OsEngine::create(pOsSysman, ZES_ENGINE_GROUP_RENDER_SINGLE, 0u, 0u);
+    auto pOsEngineTest2 = OsEngine::create(pOsSysman, ZES_ENGINE_GROUP_COPY_SINGLE, 0u, 0u);
+    EXPECT_TRUE(pOsEngineTest1->isEngineModuleSupported());
+    EXPECT_TRUE(pOsEngineTest2->isEngineModuleSupported());
+
+    zes_engine_stats_t stats = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pOsEngineTest1->getActivity(&stats));
+    EXPECT_EQ(mockActiveTime / microSecondsToNanoSeconds, stats.activeTime);
+    EXPECT_EQ(mockTimestamp / microSecondsToNanoSeconds, stats.timestamp);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pOsEngineTest2->getActivity(&stats));
+    EXPECT_EQ(2 * mockActiveTime / microSecondsToNanoSeconds, stats.activeTime);
+    EXPECT_EQ(mockTimestamp / microSecondsToNanoSeconds, stats.timestamp);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pOsEngineTest1->getActivity(&stats));
+    delete pOsEngineTest1;
+    delete pOsEngineTest2;
+}
+
 TEST_F(ZesEngineFixture, GivenValidEngineHandleWhenCallingZesEngineGetActivityAndPmuReadFailsThenVerifyEngineGetActivityReturnsFailure) {
     ON_CALL(*pPmuInterface.get(), pmuRead(_, _, _))
         .WillByDefault(::testing::Invoke(pPmuInterface.get(), &Mock<MockPmuInterfaceImp>::mockedPmuReadAndFailureReturn));
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020 Intel Corporation
+ * Copyright (C) 2020-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #pragma once
 #include "level_zero/tools/source/sysman/events/events_imp.h"
 #include "level_zero/tools/source/sysman/events/linux/os_events_imp.h"
+#include "level_zero/tools/source/sysman/events/linux/os_events_waiter_imp.h"
 
 namespace L0 {
 namespace ult {
@@ -88,5 +89,15 @@ class PublicLinuxEventsImp : public L0::LinuxEventsImp {
     using LinuxEventsImp::pciIdPathTag;
 };
 
+class PublicLinuxEventsWaiterImp : public L0::LinuxEventsWaiterImp {
+  public:
+    using LinuxEventsWaiterImp::closeFunction;
+    using LinuxEventsWaiterImp::inotifyAddWatchFunction;
+    using LinuxEventsWaiterImp::inotifyFd;
+    using LinuxEventsWaiterImp::inotifyInitFunction;
+    using LinuxEventsWaiterImp::pollFunction;
+    using LinuxEventsWaiterImp::readFunction;
+};
+
 } // namespace ult
 } // namespace L0
@@ -281,5 +281,73 @@ TEST_F(SysmanEventsFixture, GivenValidDeviceHandleWhenListeningForResetRequiredE
     delete[] pDeviceEvents;
 }
 
+static constexpr int mockInotifyFd = 77;
+static int mockPollTimeout = 0;
+static uint32_t mockInotifyReadCalled = 0u;
+static uint32_t mockInotifyCloseCalled = 0u;
+
+inline static int mockInotifyInit(int flags) {
+    return mockInotifyFd;
+}
+
+inline static int mockInotifyAddWatchSuccess(int fd, const char *pathname, uint32_t mask) {
+    return 1;
+}
+
+inline static int mockInotifyAddWatchFailure(int fd, const char *pathname, uint32_t mask) {
+    return -1;
+}
+
+inline static int mockInotifyPoll(struct pollfd *pollFd, unsigned long int numberOfFds, int timeout) {
+    mockPollTimeout = timeout;
+    pollFd->revents = POLLIN;
+    return 1;
+}
+
+inline static ssize_t mockInotifyRead(int fd, void *buf, size_t count) {
+    mockInotifyReadCalled++;
+    return (mockInotifyReadCalled == 1u) ? static_cast<ssize_t>(sizeof(struct inotify_event)) : -1;
+}
+
+inline static int mockInotifyClose(int fd) {
+    mockInotifyCloseCalled++;
+    return 0;
+}
+
+TEST(SysmanEventsWaiterTest, GivenInotifyWatchCreatedWhenWaitingForEventsThenPollIsCalledWithTimeoutLimitedByPollingIntervalAndNotificationsAreDrained) {
+    mockPollTimeout = 0;
+    mockInotifyReadCalled = 0u;
+    mockInotifyCloseCalled = 0u;
+    {
+        PublicLinuxEventsWaiterImp eventsWaiter;
+        eventsWaiter.inotifyInitFunction = mockInotifyInit;
+        eventsWaiter.inotifyAddWatchFunction = mockInotifyAddWatchSuccess;
+        eventsWaiter.pollFunction = mockInotifyPoll;
+        eventsWaiter.readFunction = mockInotifyRead;
+        eventsWaiter.closeFunction = mockInotifyClose;
+        eventsWaiter.init(500);
+        EXPECT_EQ(mockInotifyFd, eventsWaiter.inotifyFd);
+
+        eventsWaiter.wait(1000u);
+        EXPECT_EQ(500, mockPollTimeout);
+        EXPECT_EQ(2u, mockInotifyReadCalled);
+
+        eventsWaiter.wait(20u);
+        EXPECT_EQ(20, mockPollTimeout);
+    }
+    EXPECT_EQ(1u, mockInotifyCloseCalled);
+}
+
+TEST(SysmanEventsWaiterTest, GivenAddingInotifyWatchFailsWhenInitializingEventsWaiterThenInotifyFdIsClosed) {
+    mockInotifyCloseCalled = 0u;
+    PublicLinuxEventsWaiterImp eventsWaiter;
+    eventsWaiter.inotifyInitFunction = mockInotifyInit;
+    eventsWaiter.inotifyAddWatchFunction = mockInotifyAddWatchFailure;
+    eventsWaiter.closeFunction = mockInotifyClose;
+    eventsWaiter.init(500);
+    EXPECT_EQ(-1, eventsWaiter.inotifyFd);
+    EXPECT_EQ(1u, mockInotifyCloseCalled);
+}
+
 } // namespace ult
 } // namespace L0
@@ -158,6 +158,10 @@ class SysmanMultiDeviceFixture : public MultiDeviceFixture, public ::testing::Te
 class PublicFsAccess : public L0::FsAccess {
   public:
     using FsAccess::accessSyscall;
+    using FsAccess::cachedFileDescriptors;
+    using FsAccess::closeSyscall;
+    using FsAccess::openSyscall;
+    using FsAccess::preadSyscall;
     using FsAccess::statSyscall;
 };
 
@@ -152,6 +152,8 @@ class PublicPlatformMonitoringTech : public L0::PlatformMonitoringTech {
     using PlatformMonitoringTech::doInitPmtObject;
     using PlatformMonitoringTech::init;
     using PlatformMonitoringTech::keyOffsetMap;
+    using PlatformMonitoringTech::mmapFunction;
+    using PlatformMonitoringTech::munmapFunction;
     using PlatformMonitoringTech::openFunction;
     using PlatformMonitoringTech::preadFunction;
     using PlatformMonitoringTech::telemetryDeviceEntry;
@@ -222,6 +222,82 @@ TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenCallingreadValueWithUint6
     EXPECT_EQ(ZE_RESULT_ERROR_DEPENDENCY_UNAVAILABLE, pPmt->readValue("DUMMY_KEY", val));
 }
 
+const std::map<std::string, uint64_t> dummyTwoKeysOffsetMap = {
+    {"DUMMY_KEY0", 0x0},
+    {"DUMMY_KEY1", 0x8}};
+static uint64_t mockTelemetry[2] = {0x1234u, 0x5678u};
+static uint32_t openMockCalled = 0u;
+static uint32_t munmapMockCalled = 0u;
+
+inline static int openMockCounted(const char *pathname, int flags) {
+    openMockCalled++;
+    return openMock(pathname, flags);
+}
+
+inline static void *mmapMockPmt(void *addr, size_t size, int prot, int flags, int fd, off_t off) {
+    return mockTelemetry;
+}
+
+inline static int munmapMockPmt(void *addr, size_t size) {
+    munmapMockCalled++;
+    return 0;
+}
+
+ssize_t preadMockPmtTelemetry(int fd, void *buf, size_t count, off_t offset) {
+    memcpy_s(buf, count, reinterpret_cast<uint8_t *>(mockTelemetry) + offset, count);
+    return count;
+}
+
+TEST_F(ZesPmtFixtureMultiDevice, GivenPmtTelemetryMappingEnabledWhenCallingReadValueMultipleTimesThenTelemetryFileIsOpenedOnceAndValuesAreReadFromMapping) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnablePmtTelemetryMapping.set(1);
+    openMockCalled = 0u;
+    munmapMockCalled = 0u;
+    auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+    pPmt->telemetryDeviceEntry = baseTelemSysFS + "/" + telemNodeForSubdevice0 + "/" + telem;
+    pPmt->openFunction = openMockCounted;
+    pPmt->preadFunction = preadMockPmtFailure;
+    pPmt->closeFunction = closeMock;
+    pPmt->mmapFunction = mmapMockPmt;
+    pPmt->munmapFunction = munmapMockPmt;
+    pPmt->keyOffsetMap = dummyTwoKeysOffsetMap;
+
+    uint64_t val64 = 0;
+    uint32_t val32 = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("DUMMY_KEY1", val64));
+    EXPECT_EQ(mockTelemetry[1], val64);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue("DUMMY_KEY0", val32));
+    EXPECT_EQ(static_cast<uint32_t>(mockTelemetry[0]), val32);
+    EXPECT_EQ(1u, openMockCalled);
+
+    pPmt.reset();
+    EXPECT_EQ(1u, munmapMockCalled);
+}
+
+TEST_F(ZesPmtFixtureMultiDevice, GivenTelemetrySnapshotWhenReadingValuesFromSnapshotThenValuesOfAllKeysAreReturnedFromSingleRead) {
+    auto pPmt = std::make_unique<PublicPlatformMonitoringTech>(pTestFsAccess.get(), 1, 0);
+    pPmt->telemetryDeviceEntry = baseTelemSysFS + "/" + telemNodeForSubdevice0 + "/" + telem;
+    pPmt->openFunction = openMock;
+    pPmt->preadFunction = preadMockPmtTelemetry;
+    pPmt->closeFunction = closeMock;
+    pPmt->keyOffsetMap = dummyTwoKeysOffsetMap;
+
+    std::vector<uint8_t> snapshot;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readTelemetrySnapshot(snapshot));
+    EXPECT_EQ(sizeof(mockTelemetry), snapshot.size());
+
+    uint64_t val64 = 0;
+    uint32_t val32 = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue(snapshot, "DUMMY_KEY0", val64));
+    EXPECT_EQ(mockTelemetry[0], val64);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, pPmt->readValue(snapshot, "DUMMY_KEY1", val32));
+    EXPECT_EQ(static_cast<uint32_t>(mockTelemetry[1]), val32);
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, pPmt->readValue(snapshot, "SOMETHING", val64));
+
+    std::vector<uint8_t> smallSnapshot(4u);
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, pPmt->readValue(smallSnapshot, "DUMMY_KEY1", val64));
+}
+
 TEST_F(ZesPmtFixtureMultiDevice, GivenValidSyscallsWhenDoingPMTInitThenPMTmapOfSubDeviceIdToPmtObjectWouldContainValidEntries) {
     std::map<uint32_t, L0::PlatformMonitoringTech *> mapOfSubDeviceIdToPmtObject;
     for (const auto &deviceHandle : deviceHandles) {
@@ -20,6 +20,8 @@ constexpr uint64_t mockEvent1Val = 100u;
 constexpr uint64_t mockEvent2Val = 150u;
 class MockPmuInterfaceImpForSysman : public PmuInterfaceImp {
   public:
+    using PmuInterfaceImp::closeFunction;
+    using PmuInterfaceImp::eventGroupFds;
     using PmuInterfaceImp::getErrorNo;
     using PmuInterfaceImp::perfEventOpen;
     using PmuInterfaceImp::readFunction;
@@ -31,6 +33,8 @@ struct Mock<MockPmuInterfaceImpForSysman> : public MockPmuInterfaceImpForSysman
     Mock<MockPmuInterfaceImpForSysman>(LinuxSysmanImp *pLinuxSysmanImp) : MockPmuInterfaceImpForSysman(pLinuxSysmanImp) {}
 
     int pmuRead(int fd, uint64_t *data, ssize_t sizeOfdata) override {
+        pmuReadCalled++;
+        pmuReadSize = sizeOfdata;
         data[0] = mockEventCount;
         data[1] = mockTimeStamp;
         data[2] = mockEvent1Val;
@@ -38,6 +42,8 @@ struct Mock<MockPmuInterfaceImpForSysman> : public MockPmuInterfaceImpForSysman
         return 0;
     }
 
+    uint32_t pmuReadCalled = 0u;
+    ssize_t pmuReadSize = 0;
     ADDMETHOD_NOBASE(perfEventOpen, int64_t, mockPmuFd, (perf_event_attr * attr, pid_t pid, int cpu, int groupFd, uint64_t flags));
     ADDMETHOD_NOBASE(getErrorNo, int, EINVAL, ());
 };
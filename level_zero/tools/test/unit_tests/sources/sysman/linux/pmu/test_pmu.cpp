@@ -53,6 +53,10 @@ inline static ssize_t openReadReturnFailure(int fd, void *data, size_t sizeOfdat
     return -1;
 }
 
+inline static int closeReturnSuccess(int fd) {
+    return 0;
+}
+
 inline static long int syscallReturnSuccess(long int sysNo, ...) noexcept {
     return mockPmuFd;
 }
@@ -106,6 +110,41 @@ TEST_F(SysmanPmuFixture, GivenValidPmuHandleWhenReadingGroupOfEventsUsingGroupFd
     EXPECT_EQ(mockEvent2Val, data[3]);
 }
 
+TEST_F(SysmanPmuFixture, GivenEventsOpenedInEventGroupWhenReadingEachEventOnceThenGroupIsReadWithSingleCallAndValuesAreFannedOut) {
+    pPmuInterface->closeFunction = closeReturnSuccess;
+    uint32_t groupIndex1 = UINT32_MAX;
+    uint32_t groupIndex2 = UINT32_MAX;
+    EXPECT_EQ(mockPmuFd, pPmuInterface->pmuEventGroupOpen(10, groupIndex1));
+    EXPECT_EQ(mockPmuFd, pPmuInterface->pmuEventGroupOpen(15, groupIndex2));
+    EXPECT_EQ(0u, groupIndex1);
+    EXPECT_EQ(1u, groupIndex2);
+    EXPECT_EQ(2u, pPmuInterface->eventGroupFds.size());
+
+    uint64_t data[2] = {};
+    EXPECT_EQ(0, pPmuInterface->pmuEventGroupRead(groupIndex1, data));
+    EXPECT_EQ(mockEvent1Val, data[0]);
+    EXPECT_EQ(mockTimeStamp, data[1]);
+    EXPECT_EQ(0, pPmuInterface->pmuEventGroupRead(groupIndex2, data));
+    EXPECT_EQ(mockEvent2Val, data[0]);
+    EXPECT_EQ(mockTimeStamp, data[1]);
+    EXPECT_EQ(1u, pPmuInterface->pmuReadCalled);
+    EXPECT_EQ(static_cast<ssize_t>(4 * sizeof(uint64_t)), pPmuInterface->pmuReadSize);
+
+    EXPECT_EQ(0, pPmuInterface->pmuEventGroupRead(groupIndex1, data));
+    EXPECT_EQ(2u, pPmuInterface->pmuReadCalled);
+    EXPECT_EQ(-ENOENT, pPmuInterface->pmuEventGroupRead(2u, data));
+}
+
+TEST_F(SysmanPmuFixture, GivenPerfEventOpenFailsWhenOpeningEventInEventGroupThenFailureIsReturnedAndEventIsNotAddedToGroup) {
+    pPmuInterface->closeFunction = closeReturnSuccess;
+    pPmuInterface->perfEventOpenResult = -1;
+    pPmuInterface->getErrorNoResult = EBADF;
+    uint32_t groupIndex = UINT32_MAX;
+    EXPECT_EQ(-1, pPmuInterface->pmuEventGroupOpen(10, groupIndex));
+    EXPECT_EQ(UINT32_MAX, groupIndex);
+    EXPECT_TRUE(pPmuInterface->eventGroupFds.empty());
+}
+
 TEST_F(SysmanPmuFixture, GivenValidPmuHandleWhenCallingPmuInterfaceOpenAndPerfEventOpenFailsThenFailureIsReturned) {
     pPmuInterface->perfEventOpenResult = -1;
     uint64_t config = 10;
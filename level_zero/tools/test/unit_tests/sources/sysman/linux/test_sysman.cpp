@@ -38,6 +38,33 @@ inline static int mockStatNoPermissions(const char *pathname, struct stat *sb) n
     return 0;
 }
 
+static uint32_t mockOpenCalled = 0u;
+static uint32_t mockPreadCalled = 0u;
+static uint32_t mockCloseCalled = 0u;
+static bool mockPreadFail = false;
+constexpr int mockCachedFileDescriptor = 0x1234;
+
+inline static int mockOpenSuccess(const char *pathname, int flags) {
+    mockOpenCalled++;
+    return mockCachedFileDescriptor;
+}
+
+inline static ssize_t mockPreadValue(int fd, void *buf, size_t count, off_t offset) {
+    mockPreadCalled++;
+    if (mockPreadFail) {
+        errno = ENODEV;
+        return -1;
+    }
+    const char value[] = "1500\n";
+    memcpy(buf, value, sizeof(value) - 1);
+    return sizeof(value) - 1;
+}
+
+inline static int mockCloseSuccess(int fd) {
+    mockCloseCalled++;
+    return 0;
+}
+
 TEST_F(SysmanDeviceFixture, GivenValidDeviceHandleInSysmanImpCreationWhenAllSysmanInterfacesAreAssignedToNullThenExpectSysmanDeviceModuleContextsAreNull) {
     ze_device_handle_t hSysman = device->toHandle();
     SysmanDeviceImp *sysmanImp = new SysmanDeviceImp(hSysman);
@@ -227,6 +254,55 @@ TEST_F(SysmanDeviceFixture, GivenPublicFsAccessClassWhenCallingCanReadWithUserNo
     delete tempFsAccess;
 }
 
+TEST_F(SysmanDeviceFixture, GivenPublicFsAccessClassWhenReadingSameFileTwiceThenFileIsOpenedOnceAndReadFromOffsetZeroTwice) {
+    mockOpenCalled = 0u;
+    mockPreadCalled = 0u;
+    mockCloseCalled = 0u;
+    mockPreadFail = false;
+    auto tempFsAccess = std::make_unique<PublicFsAccess>();
+    tempFsAccess->openSyscall = mockOpenSuccess;
+    tempFsAccess->preadSyscall = mockPreadValue;
+    tempFsAccess->closeSyscall = mockCloseSuccess;
+
+    uint64_t val64 = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, tempFsAccess->read("/sys/class/drm/card0/gt_cur_freq_mhz", val64));
+    EXPECT_EQ(1500u, val64);
+    uint32_t val32 = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, tempFsAccess->read("/sys/class/drm/card0/gt_cur_freq_mhz", val32));
+    EXPECT_EQ(1500u, val32);
+
+    EXPECT_EQ(1u, mockOpenCalled);
+    EXPECT_EQ(2u, mockPreadCalled);
+    EXPECT_EQ(0u, mockCloseCalled);
+    EXPECT_EQ(1u, tempFsAccess->cachedFileDescriptors.size());
+
+    tempFsAccess.reset();
+    EXPECT_EQ(1u, mockCloseCalled);
+}
+
+TEST_F(SysmanDeviceFixture, GivenPublicFsAccessClassWhenReadOfCachedFileFailsThenFileIsReopened) {
+    mockOpenCalled = 0u;
+    mockPreadCalled = 0u;
+    mockCloseCalled = 0u;
+    mockPreadFail = false;
+    auto tempFsAccess = std::make_unique<PublicFsAccess>();
+    tempFsAccess->openSyscall = mockOpenSuccess;
+    tempFsAccess->preadSyscall = mockPreadValue;
+    tempFsAccess->closeSyscall = mockCloseSuccess;
+
+    std::string val;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, tempFsAccess->read("/sys/class/drm/card0/gt_act_freq_mhz", val));
+    EXPECT_EQ("1500", val);
+
+    mockPreadFail = true;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, tempFsAccess->read("/sys/class/drm/card0/gt_act_freq_mhz", val));
+    EXPECT_EQ(2u, mockOpenCalled);
+    EXPECT_EQ(3u, mockPreadCalled);
+    EXPECT_EQ(2u, mockCloseCalled);
+    EXPECT_EQ(0u, tempFsAccess->cachedFileDescriptors.size());
+    mockPreadFail = false;
+}
+
 TEST_F(SysmanDeviceFixture, GivenPublicFsAccessClassWhenCallingCanReadWithInvalidPathThenErrorIsReturned) {
     PublicFsAccess *tempFsAccess = new PublicFsAccess();
     tempFsAccess->statSyscall = mockStatFailure;
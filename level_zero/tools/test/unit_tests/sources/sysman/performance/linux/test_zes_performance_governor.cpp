@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "level_zero/tools/source/sysman/performance/performance_governor.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace L0 {
+namespace ult {
+
+class MockPerformanceGovernor : public PerformanceGovernor {
+  public:
+    using PerformanceGovernor::PerformanceGovernor;
+
+    ~MockPerformanceGovernor() override {
+        stop();
+    }
+
+    bool sampleUtilization(double &engineUtilization, double &memoryUtilization) override {
+        engineUtilization = engineUtilizationToReturn;
+        memoryUtilization = memoryUtilizationToReturn;
+        sampleUtilizationCalled++;
+        return true;
+    }
+
+    void applyFactor(double factor) override {
+        appliedFactorValue = factor;
+        applyFactorCalled++;
+    }
+
+    double engineUtilizationToReturn = 1.0;
+    double memoryUtilizationToReturn = 0.0;
+    std::atomic<uint32_t> sampleUtilizationCalled{0u};
+    std::atomic<uint32_t> applyFactorCalled{0u};
+    std::atomic<double> appliedFactorValue{0.0};
+};
+
+TEST(PerformanceGovernorTest, givenDefaultSettingsWhenCreatingGovernorThenNothingIsCreated) {
+    DebugManagerStateRestore restore;
+    EXPECT_EQ(nullptr, PerformanceGovernor::create(nullptr));
+
+    NEO::DebugManager.flags.SysmanPerformanceGovernorIntervalMs.set(0);
+    EXPECT_EQ(nullptr, PerformanceGovernor::create(nullptr));
+}
+
+TEST(PerformanceGovernorTest, givenUtilizationWhenGettingTargetFactorThenIdleDeviceIsBalancedAndMemoryBoundPhaseGetsLowerFactor) {
+    EXPECT_EQ(PerformanceGovernor::balancedFactor, PerformanceGovernor::getTargetFactor(0.0, 0.0));
+    EXPECT_EQ(PerformanceGovernor::balancedFactor, PerformanceGovernor::getTargetFactor(0.05, 1.0));
+    EXPECT_EQ(PerformanceGovernor::maxFactor, PerformanceGovernor::getTargetFactor(1.0, 0.0));
+    EXPECT_EQ(PerformanceGovernor::maxFactor, PerformanceGovernor::getTargetFactor(0.9, 0.1));
+    EXPECT_EQ(50.0, PerformanceGovernor::getTargetFactor(0.9, 0.5));
+    EXPECT_EQ(PerformanceGovernor::minFactor, PerformanceGovernor::getTargetFactor(0.9, 0.95));
+    EXPECT_EQ(PerformanceGovernor::minFactor, PerformanceGovernor::getTargetFactor(0.9, 2.0));
+}
+
+TEST(PerformanceGovernorTest, givenNewTargetFactorWhenSamplingThenFactorIsAppliedOnlyAfterConsecutiveSamples) {
+    PerformanceGovernor governor(nullptr, 1u);
+    double factor = 0.0;
+
+    for (uint32_t i = 0; i < PerformanceGovernor::hysteresisSamplesCount - 1; i++) {
+        EXPECT_FALSE(governor.onSample(1.0, 0.0, factor));
+    }
+    EXPECT_TRUE(governor.onSample(1.0, 0.0, factor));
+    EXPECT_EQ(PerformanceGovernor::maxFactor, factor);
+    EXPECT_FALSE(governor.onSample(1.0, 0.0, factor));
+
+    factor = 0.0;
+    EXPECT_FALSE(governor.onSample(1.0, 0.9, factor));
+    EXPECT_FALSE(governor.onSample(1.0, 0.9, factor));
+    EXPECT_FALSE(governor.onSample(1.0, 0.0, factor));
+    EXPECT_FALSE(governor.onSample(1.0, 0.9, factor));
+    EXPECT_FALSE(governor.onSample(1.0, 0.9, factor));
+    EXPECT_EQ(0.0, factor);
+    EXPECT_TRUE(governor.onSample(1.0, 0.9, factor));
+    EXPECT_EQ(PerformanceGovernor::minFactor, factor);
+}
+
+TEST(PerformanceGovernorTest, givenStartedGovernorWhenSamplingThreadRunsThenStableTargetFactorIsAppliedOnce) {
+    auto governor = std::make_unique<MockPerformanceGovernor>(nullptr, 1u);
+    governor->memoryUtilizationToReturn = 0.5;
+    governor->start();
+
+    auto timeout = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (governor->sampleUtilizationCalled < 2 * PerformanceGovernor::hysteresisSamplesCount && std::chrono::steady_clock::now() < timeout) {
+        std::this_thread::yield();
+    }
+    governor->stop();
+
+    EXPECT_LE(2 * PerformanceGovernor::hysteresisSamplesCount, governor->sampleUtilizationCalled.load());
+    EXPECT_EQ(1u, governor->applyFactorCalled.load());
+    EXPECT_EQ(50.0, governor->appliedFactorValue.load());
+}
+
+} // namespace ult
+} // namespace L0
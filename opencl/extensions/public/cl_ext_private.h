@@ -165,6 +165,7 @@ using cl_unified_shared_memory_type_intel = cl_uint;
 #define CL_KERNEL_EXEC_INFO_THREAD_ARBITRATION_POLICY_INTEL 0x10025
 #define CL_KERNEL_EXEC_INFO_THREAD_ARBITRATION_POLICY_STALL_BASED_ROUND_ROBIN_INTEL 0x10026
 #define CL_KERNEL_EXEC_INFO_EU_THREAD_OVER_DISPATCH_INTEL 0x10027
+#define CL_KERNEL_EXEC_INFO_STATEFUL_ACCESS_ONLY_INTEL 0x10028
 
 /******************************
 *    SLICE COUNT SELECTING    *
@@ -342,4 +343,12 @@ typedef cl_bitfield cl_command_queue_mdapi_properties_intel;
 
 // cl_intel_variable_eu_thread_count
 #define CL_DEVICE_EU_THREAD_COUNTS_INTEL 0x1000A // placeholder
-#define CL_KERNEL_EU_THREAD_COUNT_INTEL 0x1000B // placeholder
\ No newline at end of file
+#define CL_KERNEL_EU_THREAD_COUNT_INTEL 0x1000B // placeholder
+
+// performance hints
+typedef struct _cl_performance_hint_intel {
+    cl_uint hintId;
+    const char *callSite;
+    cl_ulong params[4];
+    cl_ulong occurrences;
+} cl_performance_hint_intel;
\ No newline at end of file
@@ -17,6 +17,7 @@
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/debug_env_reader.h"
 #include "shared/source/os_interface/device_factory.h"
+#include "shared/source/utilities/performance_hints_log.h"
 #include "shared/source/utilities/stackvec.h"
 
 #include "opencl/source/accelerators/intel_motion_estimation.h"
@@ -4431,6 +4432,7 @@ void *CL_API_CALL clGetExtensionFunctionAddress(const char *funcName) {
     RETURN_FUNC_PTR_IF_EXIST(clDestroyTracingHandleINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clEnableTracingINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clDisableTracingINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clDrainTracingRecordsINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clGetTracingStateINTEL);
 
     RETURN_FUNC_PTR_IF_EXIST(clHostMemAllocINTEL);
@@ -4450,6 +4452,7 @@ void *CL_API_CALL clGetExtensionFunctionAddress(const char *funcName) {
     RETURN_FUNC_PTR_IF_EXIST(clGetKernelMaxConcurrentWorkGroupCountINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clGetKernelSuggestedLocalWorkSizeINTEL);
     RETURN_FUNC_PTR_IF_EXIST(clEnqueueNDCountKernelINTEL);
+    RETURN_FUNC_PTR_IF_EXIST(clGetPerformanceHintsINTEL);
 
     void *ret = sharingFactory.getExtensionFunctionAddress(funcName);
     if (ret != nullptr) {
@@ -5103,6 +5106,13 @@ cl_int CL_API_CALL clSetKernelExecInfo(cl_kernel kernel,
         retVal = pMultiDeviceKernel->setOverdispatchParam(paramValueSize, paramValue);
         break;
     }
+    case CL_KERNEL_EXEC_INFO_STATEFUL_ACCESS_ONLY_INTEL: {
+        if ((paramValueSize != sizeof(cl_bool)) || (paramValue == nullptr)) {
+            return CL_INVALID_VALUE;
+        }
+        retVal = pMultiDeviceKernel->setStatefulAccessOnlyHint(paramValueSize, paramValue);
+        break;
+    }
     default: {
         retVal = CL_INVALID_VALUE;
         break;
@@ -6108,3 +6118,40 @@ cl_int CL_API_CALL clSetContextDestructorCallback(cl_context context,
 
     return retVal;
 }
+
+cl_int CL_API_CALL clGetPerformanceHintsINTEL(cl_platform_id platform,
+                                              cl_uint numHints,
+                                              cl_performance_hint_intel *hints,
+                                              cl_uint *numHintsRet) {
+    cl_int retVal = CL_SUCCESS;
+    API_ENTER(&retVal);
+    DBG_LOG_INPUTS("platform", platform, "numHints", numHints, "hints", hints, "numHintsRet", numHintsRet);
+
+    if (castToObject<Platform>(platform) == nullptr) {
+        retVal = CL_INVALID_PLATFORM;
+        return retVal;
+    }
+    if ((hints == nullptr && numHintsRet == nullptr) || (hints != nullptr && numHints == 0)) {
+        retVal = CL_INVALID_VALUE;
+        return retVal;
+    }
+
+    std::vector<PerformanceHintRecord> records;
+    if (auto performanceHintsLog = PerformanceHintsLog::get()) {
+        records = performanceHintsLog->getRecords();
+    }
+
+    if (hints != nullptr) {
+        auto hintsToCopy = std::min(static_cast<size_t>(numHints), records.size());
+        for (size_t i = 0; i < hintsToCopy; i++) {
+            hints[i].hintId = static_cast<cl_uint>(records[i].hintId);
+            hints[i].callSite = records[i].callSite;
+            std::copy(records[i].params.begin(), records[i].params.end(), hints[i].params);
+            hints[i].occurrences = records[i].occurrences;
+        }
+    }
+    if (numHintsRet != nullptr) {
+        *numHintsRet = static_cast<cl_uint>(records.size());
+    }
+    return retVal;
+}
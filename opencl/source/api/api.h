@@ -1058,6 +1058,12 @@ cl_int CL_API_CALL clGetKernelMaxConcurrentWorkGroupCountINTEL(
     const size_t *localWorkSize,
     size_t *suggestedWorkGroupCount);
 
+cl_int CL_API_CALL clGetPerformanceHintsINTEL(
+    cl_platform_id platform,
+    cl_uint numHints,
+    cl_performance_hint_intel *hints,
+    cl_uint *numHintsRet);
+
 cl_int CL_API_CALL clEnqueueNDCountKernelINTEL(
     cl_command_queue commandQueue,
     cl_kernel kernel,
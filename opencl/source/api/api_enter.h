@@ -7,10 +7,12 @@
 
 #pragma once
 
+#include "shared/source/utilities/latency_histograms.h"
 #include "shared/source/utilities/logger.h"
 #include "shared/source/utilities/perf_profiler.h"
 
 #define API_ENTER(retValPointer) \
+    LATENCY_SCOPE(__FUNCTION__); \
     LoggerApiEnterWrapper<NEO::FileLogger<globalDebugFunctionalityLevel>::enabled()> ApiWrapperForSingleCall(__FUNCTION__, retValPointer)
 
 #if KMD_PROFILING == 1
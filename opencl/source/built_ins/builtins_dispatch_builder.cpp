@@ -303,6 +303,14 @@ class BuiltInOp<EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
 
         size_t middleAlignment = MemoryConstants::cacheLineSize;
         size_t middleElSize = sizeof(uint32_t);
+        auto middleKernel = kernMiddle;
+
+        // pattern replicated to vector size allows 16 byte stores in middle region
+        DEBUG_BREAK_IF(operationParams.srcMemObj == nullptr);
+        if (kernMiddleVec && (operationParams.srcMemObj->getSize() % fillPatternVecSize) == 0) {
+            middleElSize = fillPatternVecSize;
+            middleKernel = kernMiddleVec;
+        }
 
         uintptr_t leftSize = start % middleAlignment;
         leftSize = (leftSize > 0) ? (middleAlignment - leftSize) : 0; // calc left leftover size
@@ -319,10 +327,10 @@ class BuiltInOp<EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
 
         // Set-up ISA
         kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Left, kernLeftLeftover->getKernel(rootDeviceIndex));
-        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Middle, kernMiddle->getKernel(rootDeviceIndex));
+        kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Middle, middleKernel->getKernel(rootDeviceIndex));
         kernelSplit1DBuilder.setKernel(SplitDispatch::RegionCoordX::Right, kernRightLeftover->getKernel(rootDeviceIndex));
 
-        DEBUG_BREAK_IF((operationParams.srcMemObj == nullptr) || (operationParams.srcOffset != 0));
+        DEBUG_BREAK_IF(operationParams.srcOffset != 0);
         DEBUG_BREAK_IF((operationParams.dstMemObj == nullptr) && (operationParams.dstSvmAlloc == nullptr));
 
         bool isDestinationInSystem = false;
@@ -367,6 +375,7 @@ class BuiltInOp<EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
   protected:
     MultiDeviceKernel *kernLeftLeftover = nullptr;
     MultiDeviceKernel *kernMiddle = nullptr;
+    MultiDeviceKernel *kernMiddleVec = nullptr;
     MultiDeviceKernel *kernRightLeftover = nullptr;
 
     BuiltInOp(BuiltIns &kernelsLib, ClDevice &device, bool populateKernels)
@@ -376,6 +385,7 @@ class BuiltInOp<EBuiltInOps::FillBuffer> : public BuiltinDispatchInfoBuilder {
                      "",
                      "FillBufferLeftLeftover", kernLeftLeftover,
                      "FillBufferMiddle", kernMiddle,
+                     "FillBufferMiddleVec", kernMiddleVec,
                      "FillBufferRightLeftover", kernRightLeftover);
         }
     }
@@ -389,6 +399,7 @@ class BuiltInOp<EBuiltInOps::FillBufferStateless> : public BuiltInOp<EBuiltInOps
                  CompilerOptions::greaterThan4gbBuffersRequired,
                  "FillBufferLeftLeftover", kernLeftLeftover,
                  "FillBufferMiddle", kernMiddle,
+                 "FillBufferMiddleVec", kernMiddleVec,
                  "FillBufferRightLeftover", kernRightLeftover);
     }
     bool buildDispatchInfos(MultiDispatchInfo &multiDispatchInfos) const override {
@@ -8,6 +8,8 @@
 #pragma once
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/built_ins/builtinops/built_in_ops.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/helpers/vec.h"
 
 #include "opencl/source/kernel/multi_device_kernel.h"
@@ -53,9 +55,21 @@ struct BuiltinOpParams {
 
 class BuiltinDispatchInfoBuilder {
   public:
+    static constexpr size_t fillPatternVecSize = 4 * sizeof(uint32_t);
+
     BuiltinDispatchInfoBuilder(BuiltIns &kernelLib, ClDevice &device) : kernelsLib(kernelLib), clDevice(device) {}
     virtual ~BuiltinDispatchInfoBuilder() = default;
 
+    // Replicates power of 2 sized pattern placed at the beginning of storage up to fillPatternVecSize,
+    // so fill builtins can use vector stores. Returns size of replicated pattern.
+    static size_t replicateFillPattern(void *storage, size_t patternSize) {
+        while (patternSize < fillPatternVecSize) {
+            memcpy_s(ptrOffset(storage, patternSize), patternSize, storage, patternSize);
+            patternSize *= 2;
+        }
+        return patternSize;
+    }
+
     template <typename... KernelsDescArgsT>
     void populate(EBuiltInOps::Type operation, ConstStringRef options, KernelsDescArgsT &&...desc);
 
@@ -13,6 +13,7 @@
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/local_work_size.h"
+#include "shared/source/helpers/work_group_size_cache.h"
 
 #include "opencl/source/context/context.h"
 #include "opencl/source/helpers/dispatch_info.h"
@@ -31,27 +32,50 @@ Vec3<size_t> computeWorkgroupSize(const DispatchInfo &dispatchInfo) {
         auto &device = dispatchInfo.getClDevice();
         const auto &hwInfo = device.getHardwareInfo();
         auto &hwHelper = HwHelper::get(hwInfo.platform.eRenderCoreFamily);
-        if (DebugManager.flags.EnableComputeWorkSizeND.get()) {
-            WorkSizeInfo wsInfo = createWorkSizeInfoFromDispatchInfo(dispatchInfo);
-            if (wsInfo.slmTotalSize == 0 && !wsInfo.hasBarriers && !wsInfo.imgUsed && hwHelper.preferSmallWorkgroupSizeForKernel(kernel->getKernelInfo().heapInfo.KernelUnpaddedSize, hwInfo) &&
-                ((dispatchInfo.getDim() == 1) && (dispatchInfo.getGWS().x % wsInfo.simdSize * 2 == 0))) {
-                wsInfo.maxWorkGroupSize = wsInfo.simdSize * 2;
-            }
+        size_t workItems[3] = {dispatchInfo.getGWS().x, dispatchInfo.getGWS().y, dispatchInfo.getGWS().z};
+
+        WorkGroupSizeCacheKey cacheKey;
+        cacheKey.globalSize[0] = workItems[0];
+        cacheKey.globalSize[1] = workItems[1];
+        cacheKey.globalSize[2] = workItems[2];
+        cacheKey.device = &device;
+        cacheKey.slmTotalSize = kernel->getSlmTotalSize();
+        cacheKey.maxWorkGroupSize = kernel->getMaxKernelWorkGroupSize();
+        cacheKey.workDim = dispatchInfo.getDim();
+
+        auto profile = WorkGroupSizeProfile::get();
+        bool workGroupSizeFound = profile && profile->find(kernel->getKernelInfo().kernelDescriptor.kernelMetadata.kernelName, workItems, cacheKey.maxWorkGroupSize, workGroupSize);
+        bool useCache = !workGroupSizeFound && WorkGroupSizeCache::isEnabled();
+        if (useCache) {
+            workGroupSizeFound = kernel->getWorkGroupSizeCache().find(cacheKey, workGroupSize);
+            useCache = !workGroupSizeFound;
+        }
 
-            size_t workItems[3] = {dispatchInfo.getGWS().x, dispatchInfo.getGWS().y, dispatchInfo.getGWS().z};
-            computeWorkgroupSizeND(wsInfo, workGroupSize, workItems, dispatchInfo.getDim());
-        } else {
-            auto maxWorkGroupSize = kernel->getMaxKernelWorkGroupSize();
-            auto simd = kernel->getKernelInfo().getMaxSimdSize();
-            size_t workItems[3] = {dispatchInfo.getGWS().x, dispatchInfo.getGWS().y, dispatchInfo.getGWS().z};
-            if (dispatchInfo.getDim() == 1) {
-                computeWorkgroupSize1D(maxWorkGroupSize, workGroupSize, workItems, simd);
-            } else if (DebugManager.flags.EnableComputeWorkSizeSquared.get() && dispatchInfo.getDim() == 2) {
-                computeWorkgroupSizeSquared(maxWorkGroupSize, workGroupSize, workItems, simd, dispatchInfo.getDim());
+        if (!workGroupSizeFound) {
+            if (DebugManager.flags.EnableComputeWorkSizeND.get()) {
+                WorkSizeInfo wsInfo = createWorkSizeInfoFromDispatchInfo(dispatchInfo);
+                if (wsInfo.slmTotalSize == 0 && !wsInfo.hasBarriers && !wsInfo.imgUsed && hwHelper.preferSmallWorkgroupSizeForKernel(kernel->getKernelInfo().heapInfo.KernelUnpaddedSize, hwInfo) &&
+                    ((dispatchInfo.getDim() == 1) && (dispatchInfo.getGWS().x % wsInfo.simdSize * 2 == 0))) {
+                    wsInfo.maxWorkGroupSize = wsInfo.simdSize * 2;
+                }
+
+                computeWorkgroupSizeND(wsInfo, workGroupSize, workItems, dispatchInfo.getDim());
             } else {
-                computeWorkgroupSize2D(maxWorkGroupSize, workGroupSize, workItems, simd);
+                auto maxWorkGroupSize = kernel->getMaxKernelWorkGroupSize();
+                auto simd = kernel->getKernelInfo().getMaxSimdSize();
+                if (dispatchInfo.getDim() == 1) {
+                    computeWorkgroupSize1D(maxWorkGroupSize, workGroupSize, workItems, simd);
+                } else if (DebugManager.flags.EnableComputeWorkSizeSquared.get() && dispatchInfo.getDim() == 2) {
+                    computeWorkgroupSizeSquared(maxWorkGroupSize, workGroupSize, workItems, simd, dispatchInfo.getDim());
+                } else {
+                    computeWorkgroupSize2D(maxWorkGroupSize, workGroupSize, workItems, simd);
+                }
             }
         }
+
+        if (useCache) {
+            kernel->getWorkGroupSizeCache().store(cacheKey, workGroupSize);
+        }
     }
     DBG_LOG(PrintLWSSizes, "Input GWS enqueueBlocked", dispatchInfo.getGWS().x, dispatchInfo.getGWS().y, dispatchInfo.getGWS().z,
             " Driver deduced LWS", workGroupSize[0], workGroupSize[1], workGroupSize[2]);
@@ -17,9 +17,12 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
+#include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/hw_info_config.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/utilities/api_intercept.h"
+#include "shared/source/utilities/cpuintrinsics.h"
+#include "shared/source/utilities/performance_hints_log.h"
 #include "shared/source/utilities/tag_allocator.h"
 
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
@@ -28,6 +31,7 @@
 #include "opencl/source/event/event_builder.h"
 #include "opencl/source/event/user_event.h"
 #include "opencl/source/gtpin/gtpin_notify.h"
+#include "opencl/source/helpers/cl_blit_properties.h"
 #include "opencl/source/helpers/cl_hw_helper.h"
 #include "opencl/source/helpers/convert_color.h"
 #include "opencl/source/helpers/hardware_commands_helper.h"
@@ -69,6 +73,10 @@ CommandQueue::CommandQueue(Context *context, ClDevice *device, const cl_queue_pr
     commandQueueProperties = getCmdQueueProperties<cl_command_queue_properties>(properties);
     flushStamp.reset(new FlushStampTracker(true));
 
+    if (DebugManager.flags.EnableKernelOperationResourcePool.get() != 0) {
+        kernelOperationResourcePool = std::make_unique<KernelOperationResourcePool>();
+    }
+
     if (device) {
         auto &hwInfo = device->getHardwareInfo();
         auto &hwHelper = HwHelper::get(hwInfo.platform.eRenderCoreFamily);
@@ -120,6 +128,10 @@ CommandQueue::~CommandQueue() {
 
         this->releaseMainCopyEngine();
 
+        if (gpgpuEngineAssignedRoundRobin) {
+            device->getDevice().releaseEngineForCommandQueue(*gpgpuEngine);
+        }
+
         if (NEO::Debugger::isDebugEnabled(isInternalUsage) && device->getDevice().getL0Debugger()) {
             device->getDevice().getL0Debugger()->notifyCommandQueueDestroyed(&device->getDevice());
         }
@@ -157,6 +169,7 @@ void CommandQueue::initializeGpgpu() const {
 
             if (assignEngineRoundRobin) {
                 this->gpgpuEngine = &device->getDevice().getNextEngineForCommandQueue();
+                this->gpgpuEngineAssignedRoundRobin = true;
             } else {
                 this->gpgpuEngine = &device->getDefaultEngine();
             }
@@ -605,7 +618,16 @@ cl_int CommandQueue::enqueueWriteMemObjForUnmap(MemObj *memObj, void *mappedPtr,
         return CL_INVALID_VALUE;
     }
 
-    if (!unmapInfo.readOnly) {
+    auto graphicsAllocation = memObj->getGraphicsAllocation(getDevice().getRootDeviceIndex());
+    if (unmapInfo.graphicsAllocation != nullptr && unmapInfo.graphicsAllocation == graphicsAllocation) {
+        // persistent mapping, data was written directly through locked pointer
+        if (!unmapInfo.readOnly) {
+            CpuIntrinsics::sfence();
+            graphicsAllocation->setAubWritable(true, GraphicsAllocation::defaultBank);
+            graphicsAllocation->setTbxWritable(true, GraphicsAllocation::defaultBank);
+        }
+        retVal = enqueueMarkerWithWaitList(eventsRequest.numEventsInWaitList, eventsRequest.eventWaitList, eventsRequest.outEvent);
+    } else if (!unmapInfo.readOnly) {
         memObj->getMapAllocation(getDevice().getRootDeviceIndex())->setAubWritable(true, GraphicsAllocation::defaultBank);
         memObj->getMapAllocation(getDevice().getRootDeviceIndex())->setTbxWritable(true, GraphicsAllocation::defaultBank);
 
@@ -685,10 +707,49 @@ void *CommandQueue::enqueueReadMemObjForMap(TransferProperties &transferProperti
     return returnPtr;
 }
 
+void *CommandQueue::enqueuePersistentMapBuffer(TransferProperties &transferProperties, EventsRequest &eventsRequest, cl_int &errcodeRet) {
+    auto rootDeviceIndex = getDevice().getRootDeviceIndex();
+    auto buffer = castToObjectOrAbort<Buffer>(transferProperties.memObj);
+    auto lockedPtr = buffer->getPersistentMappingPtr(rootDeviceIndex);
+    if (lockedPtr == nullptr) {
+        return enqueueReadMemObjForMap(transferProperties, eventsRequest, errcodeRet);
+    }
+
+    void *returnPtr = ptrOffset(lockedPtr, buffer->getOffset() + transferProperties.offset[0]);
+    if (!buffer->addMappedPtr(returnPtr, transferProperties.size[0], transferProperties.mapFlags, transferProperties.size, transferProperties.offset,
+                              0, buffer->getGraphicsAllocation(rootDeviceIndex))) {
+        errcodeRet = CL_INVALID_OPERATION;
+        return nullptr;
+    }
+
+    errcodeRet = enqueueMarkerWithWaitList(eventsRequest.numEventsInWaitList, eventsRequest.eventWaitList, eventsRequest.outEvent);
+    if (errcodeRet == CL_SUCCESS && transferProperties.blocking) {
+        errcodeRet = finish();
+    }
+
+    if (errcodeRet != CL_SUCCESS) {
+        buffer->removeMappedPtr(returnPtr);
+        return nullptr;
+    }
+    if (eventsRequest.outEvent) {
+        auto event = castToObject<Event>(*eventsRequest.outEvent);
+        event->setCmdType(transferProperties.cmdType);
+    }
+    return returnPtr;
+}
+
 void *CommandQueue::enqueueMapMemObject(TransferProperties &transferProperties, EventsRequest &eventsRequest, cl_int &errcodeRet) {
+    auto graphicsAllocation = transferProperties.memObj->getGraphicsAllocation(getDevice().getRootDeviceIndex());
+    if (graphicsAllocation) {
+        getDevice().getMemoryManager()->getCompressionHostAccessTracker().recordHostAccess(*graphicsAllocation);
+    }
     if (transferProperties.memObj->mappingOnCpuAllowed()) {
         return cpuDataTransferHandler(transferProperties, eventsRequest, errcodeRet);
+    } else if (transferProperties.memObj->peekClMemObjType() == CL_MEM_OBJECT_BUFFER &&
+               castToObjectOrAbort<Buffer>(transferProperties.memObj)->isPersistentMappingAllowed(getDevice().getDevice())) {
+        return enqueuePersistentMapBuffer(transferProperties, eventsRequest, errcodeRet);
     } else {
+        PERFORMANCE_HINT(PerformanceHintId::NonZeroCopyMap, transferProperties.memObj->getSize(), transferProperties.size[0]);
         return enqueueReadMemObjForMap(transferProperties, eventsRequest, errcodeRet);
     }
 }
@@ -967,6 +1028,25 @@ bool CommandQueue::queueDependenciesClearRequired() const {
     return isOOQEnabled() || DebugManager.flags.OmitTimestampPacketDependencies.get();
 }
 
+bool CommandQueue::isInOrderFastTrackingAllowed(cl_uint numEventsInWaitList, const cl_event *eventWaitList) const {
+    if (DebugManager.flags.EnableInOrderQueueFastTracking.get() != 1) {
+        return false;
+    }
+    if (isOOQEnabled() || this->virtualEvent != nullptr || !getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled()) {
+        return false;
+    }
+    for (auto i = 0u; i < numEventsInWaitList; i++) {
+        auto waitlistEvent = castToObjectOrAbort<Event>(eventWaitList[i]);
+        if (waitlistEvent->peekTaskLevel() == CompletionStamp::notReady) {
+            return false;
+        }
+        if (waitlistEvent->getCommandQueue() != this && waitlistEvent->getTimestampPacketNodes() == nullptr) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool CommandQueue::blitEnqueueAllowed(const CsrSelectionArgs &args) const {
     bool blitEnqueueAllowed = getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled() || this->isCopyOnly;
     if (DebugManager.flags.EnableBlitterForEnqueueOperations.get() != -1) {
@@ -996,6 +1076,10 @@ bool CommandQueue::blitEnqueueAllowed(const CsrSelectionArgs &args) const {
         return blitEnqueueImageAllowed(args.srcResource.imageOrigin, args.size, *args.srcResource.image) &&
                blitEnqueueImageAllowed(args.dstResource.imageOrigin, args.size, *args.dstResource.image);
 
+    case CL_COMMAND_FILL_IMAGE:
+        return ClBlitProperties::isImageFillAllowed(*args.dstResource.image) &&
+               blitEnqueueImageAllowed(args.dstResource.imageOrigin, args.size, *args.dstResource.image);
+
     default:
         return false;
     }
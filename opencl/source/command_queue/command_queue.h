@@ -348,6 +348,8 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     std::unique_ptr<FlushStampTracker> flushStamp;
 
+    KernelOperationResourcePool *getKernelOperationResourcePool() const { return kernelOperationResourcePool.get(); }
+
     // virtual event that holds last Enqueue information
     Event *virtualEvent = nullptr;
 
@@ -363,6 +365,7 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
   protected:
     void *enqueueReadMemObjForMap(TransferProperties &transferProperties, EventsRequest &eventsRequest, cl_int &errcodeRet);
+    void *enqueuePersistentMapBuffer(TransferProperties &transferProperties, EventsRequest &eventsRequest, cl_int &errcodeRet);
     cl_int enqueueWriteMemObjForUnmap(MemObj *memObj, void *mappedPtr, EventsRequest &eventsRequest);
 
     void *enqueueMapMemObject(TransferProperties &transferProperties, EventsRequest &eventsRequest, cl_int &errcodeRet);
@@ -379,6 +382,7 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
                               cl_uint numEventsInWaitList, const cl_event *eventWaitList);
     void providePerformanceHint(TransferProperties &transferProperties);
     bool queueDependenciesClearRequired() const;
+    bool isInOrderFastTrackingAllowed(cl_uint numEventsInWaitList, const cl_event *eventWaitList) const;
     bool blitEnqueueAllowed(const CsrSelectionArgs &args) const;
 
     inline bool shouldFlushDC(uint32_t commandType, PrintfHandler *printfHandler) const {
@@ -398,6 +402,7 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     Context *context = nullptr;
     ClDevice *device = nullptr;
     mutable EngineControl *gpgpuEngine = nullptr;
+    mutable bool gpgpuEngineAssignedRoundRobin = false;
     std::array<EngineControl *, bcsInfoMaskSize> bcsEngines = {};
     std::vector<aub_stream::EngineType> bcsEngineTypes = {};
 
@@ -431,6 +436,7 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
 
     std::unique_ptr<TimestampPacketContainer> deferredTimestampPackets;
     std::unique_ptr<TimestampPacketContainer> timestampPacketContainer;
+    std::unique_ptr<KernelOperationResourcePool> kernelOperationResourcePool;
 
     struct BcsTimestampPacketContainers {
         TimestampPacketContainer lastBarrierToWaitFor;
@@ -45,6 +45,10 @@ class CommandQueueHw : public CommandQueue {
             priority = QueuePriority::MEDIUM;
         } else if (clPriority & static_cast<cl_queue_priority_khr>(CL_QUEUE_PRIORITY_HIGH_KHR)) {
             priority = QueuePriority::HIGH;
+            auto highPriorityEngine = device->getNearestGenericSubDevice(0)->getDevice().tryGetEngine(getChosenEngineType(device->getHardwareInfo()), EngineUsage::HighPriority);
+            if (highPriorityEngine) {
+                this->gpgpuEngine = highPriorityEngine;
+            }
         }
 
         auto clThrottle = getCmdQueueProperties<cl_queue_throttle_khr>(properties, CL_QUEUE_THROTTLE_KHR);
@@ -351,6 +355,9 @@ class CommandQueueHw : public CommandQueue {
                           const cl_event *eventWaitList,
                           cl_event *event);
 
+    bool pushSimpleKernelDispatch(MultiDispatchInfo &multiDispatchInfo, Kernel *kernel, cl_uint workDim, const size_t workItems[3], const size_t *enqueuedWorkSizes,
+                                  const size_t globalOffsets[3], const size_t *localWorkSizesIn, cl_uint numEventsInWaitList);
+
     template <uint32_t cmdType, size_t surfaceCount>
     cl_int dispatchBcsOrGpgpuEnqueue(MultiDispatchInfo &dispatchInfo, Surface *(&surfaces)[surfaceCount], EBuiltInOps::Type builtInOperation, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event, bool blocking, CommandStreamReceiver &csr);
 
@@ -358,6 +365,7 @@ class CommandQueueHw : public CommandQueue {
     cl_int enqueueBlit(const MultiDispatchInfo &multiDispatchInfo, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event, bool blocking, CommandStreamReceiver &bcsCsr);
 
     bool isSplitEnqueueBlitNeeded(TransferDirection transferDirection, size_t transferSize, CommandStreamReceiver &csr);
+    cl_int enqueueStagingWriteBuffer(Buffer *buffer, cl_bool blockingWrite, size_t offset, size_t size, const void *ptr, CommandStreamReceiver &csr);
     size_t getTotalSizeFromRectRegion(const size_t *region);
 
     template <uint32_t cmdType>
@@ -462,12 +470,14 @@ class CommandQueueHw : public CommandQueue {
         if (isBlockedCommandStreamRequired(commandType, eventsRequest, blockedQueue, isMarkerWithProfiling)) {
             constexpr size_t additionalAllocationSize = CSRequirements::csOverfetchSize;
             constexpr size_t allocationSize = MemoryConstants::pageSize64k - CSRequirements::csOverfetchSize;
-            commandStream = new LinearStream();
+            auto resourcePool = getKernelOperationResourcePool();
+            commandStream = resourcePool ? resourcePool->obtainCommandStream() : new LinearStream();
 
             auto &gpgpuCsr = getGpgpuCommandStreamReceiver();
             gpgpuCsr.ensureCommandBufferAllocation(*commandStream, allocationSize, additionalAllocationSize);
 
             blockedCommandsData = std::make_unique<KernelOperation>(commandStream, *gpgpuCsr.getInternalAllocationStorage());
+            blockedCommandsData->setResourcePool(resourcePool);
         } else {
             commandStream = &getCommandStream<GfxFamily, commandType>(*this, csrDependencies, profilingRequired, perfCountersRequired,
                                                                       blitEnqueue, multiDispatchInfo, surfaces, numSurfaces, isMarkerWithProfiling, eventsRequest.numEventsInWaitList > 0);
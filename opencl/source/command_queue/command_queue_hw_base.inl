@@ -148,6 +148,11 @@ inline bool waitForTimestampsWithinContainer(TimestampPacketContainer *container
     if (container) {
         auto lastHangCheckTime = std::chrono::high_resolution_clock::now();
         for (const auto &timestamp : container->peekNodes()) {
+            if (timestamp->getPacketsUsed() > 0 && timestamp->isCompleted()) {
+                status = WaitStatus::Ready;
+                waited = true;
+                continue;
+            }
             for (uint32_t i = 0; i < timestamp->getPacketsUsed(); i++) {
                 while (timestamp->getContextEndValue(i) == 1) {
                     csr.downloadAllocation(*timestamp->getBaseGraphicsAllocation()->getGraphicsAllocation(csr.getRootDeviceIndex()));
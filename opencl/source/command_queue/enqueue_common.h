@@ -81,10 +81,14 @@ cl_int CommandQueueHw<GfxFamily>::enqueueHandler(Surface *(&surfaces)[surfaceCou
     }
 
     if (kernel->getKernelInfo().builtinDispatchBuilder == nullptr) {
-        DispatchInfoBuilder<SplitDispatch::Dim::d3D, SplitDispatch::SplitMode::WalkerSplit> builder(getClDevice());
-        builder.setDispatchGeometry(workDim, workItems, enqueuedWorkSizes, globalOffsets, Vec3<size_t>{0, 0, 0}, localWorkSizesIn);
-        builder.setKernel(kernel);
-        builder.bake(multiDispatchInfo);
+        bool simpleDispatchPushed = (AuxTranslationMode::None == auxTranslationMode) &&
+                                    pushSimpleKernelDispatch(multiDispatchInfo, kernel, workDim, workItems, enqueuedWorkSizes, globalOffsets, localWorkSizesIn, numEventsInWaitList);
+        if (!simpleDispatchPushed) {
+            DispatchInfoBuilder<SplitDispatch::Dim::d3D, SplitDispatch::SplitMode::WalkerSplit> builder(getClDevice());
+            builder.setDispatchGeometry(workDim, workItems, enqueuedWorkSizes, globalOffsets, Vec3<size_t>{0, 0, 0}, localWorkSizesIn);
+            builder.setKernel(kernel);
+            builder.bake(multiDispatchInfo);
+        }
     } else {
         auto builder = kernel->getKernelInfo().builtinDispatchBuilder;
         builder->buildDispatchInfos(multiDispatchInfo, kernel, workDim, workItems, enqueuedWorkSizes, globalOffsets);
@@ -105,6 +109,45 @@ cl_int CommandQueueHw<GfxFamily>::enqueueHandler(Surface *(&surfaces)[surfaceCou
     return enqueueHandler<commandType>(surfaces, blocking, multiDispatchInfo, numEventsInWaitList, eventWaitList, event);
 }
 
+/*
+ * Builds the single walker of an in-order, event-less 1D launch of a uniform
+ * NDRange directly, same as DispatchInfoBuilder::bake would. Returns false
+ * when the launch needs the generic builder (e.g. a non-uniform split).
+ */
+template <typename GfxFamily>
+bool CommandQueueHw<GfxFamily>::pushSimpleKernelDispatch(MultiDispatchInfo &multiDispatchInfo,
+                                                         Kernel *kernel,
+                                                         cl_uint workDim,
+                                                         const size_t workItems[3],
+                                                         const size_t *enqueuedWorkSizes,
+                                                         const size_t globalOffsets[3],
+                                                         const size_t *localWorkSizesIn,
+                                                         cl_uint numEventsInWaitList) {
+    if (DebugManager.flags.EnableSimpleKernelEnqueue.get() == 0) {
+        return false;
+    }
+    if (workDim != 1 || workItems[0] == 0 || numEventsInWaitList > 0 || isOOQEnabled() || kernel->hasPrintfOutput()) {
+        return false;
+    }
+
+    const Vec3<size_t> gws{workItems[0], 1, 1};
+    DispatchInfo dispatchInfo(&getClDevice(), kernel, 1, gws, canonizeWorkgroup(Vec3<size_t>{enqueuedWorkSizes[0], 0, 0}), Vec3<size_t>{globalOffsets[0], 0, 0});
+    dispatchInfo.setActualGlobalWorkgroupSize(gws);
+    dispatchInfo.setLWS(Vec3<size_t>(localWorkSizesIn));
+    if (dispatchInfo.getLocalWorkgroupSize().x == 0) {
+        dispatchInfo.setLWS(generateWorkgroupSize(dispatchInfo));
+    }
+    dispatchInfo.setLWS(canonizeWorkgroup(dispatchInfo.getLocalWorkgroupSize()));
+    if (gws.x % dispatchInfo.getLocalWorkgroupSize().x != 0) {
+        return false;
+    }
+    dispatchInfo.setTotalNumberOfWorkgroups(canonizeWorkgroup(generateWorkgroupsNumber(dispatchInfo)));
+    dispatchInfo.setNumberOfWorkgroups(dispatchInfo.getTotalNumberOfWorkgroups());
+
+    multiDispatchInfo.push(dispatchInfo);
+    return true;
+}
+
 template <typename GfxFamily>
 template <uint32_t commandType>
 cl_int CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
@@ -138,11 +181,20 @@ cl_int CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
     std::unique_ptr<KernelOperation> blockedCommandsData;
     std::unique_ptr<PrintfHandler> printfHandler;
     TakeOwnershipWrapper<CommandQueueHw<GfxFamily>> queueOwnership(*this);
-    auto commandStreamReceiverOwnership = computeCommandStreamReceiver.obtainUniqueOwnership();
+    std::unique_lock<NEO::CommandStreamReceiver::MutexType> commandStreamReceiverOwnership;
 
     auto blockQueue = false;
     auto taskLevel = 0u;
-    obtainTaskLevelAndBlockedStatus(taskLevel, numEventsInWaitList, eventWaitList, blockQueue, commandType);
+    if (isInOrderFastTrackingAllowed(numEventsInWaitList, eventWaitList)) {
+        // in-order dependencies are resolved with queue task count and timestamp packets, wait list is not needed to obtain task level
+        cl_uint numEventsForTaskLevel = 0u;
+        const cl_event *eventsForTaskLevel = nullptr;
+        obtainTaskLevelAndBlockedStatus(taskLevel, numEventsForTaskLevel, eventsForTaskLevel, blockQueue, commandType);
+        commandStreamReceiverOwnership = computeCommandStreamReceiver.obtainUniqueOwnership();
+    } else {
+        commandStreamReceiverOwnership = computeCommandStreamReceiver.obtainUniqueOwnership();
+        obtainTaskLevelAndBlockedStatus(taskLevel, numEventsInWaitList, eventWaitList, blockQueue, commandType);
+    }
 
     enqueueHandlerHook(commandType, multiDispatchInfo);
 
@@ -35,7 +35,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueFillBuffer(
     auto commandStreamReceieverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
     auto storageWithAllocations = getGpgpuCommandStreamReceiver().getInternalAllocationStorage();
     auto allocationType = AllocationType::FILL_PATTERN;
-    auto patternAllocation = storageWithAllocations->obtainReusableAllocation(patternSize, allocationType).release();
+    auto patternAllocation = storageWithAllocations->obtainReusableAllocation(alignUp(patternSize, BuiltinDispatchInfoBuilder::fillPatternVecSize), allocationType).release();
     commandStreamReceieverOwnership.unlock();
 
     if (!patternAllocation) {
@@ -51,6 +51,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueFillBuffer(
     } else {
         memcpy_s(patternAllocation->getUnderlyingBuffer(), patternSize, pattern, patternSize);
     }
+    auto replicatedPatternSize = BuiltinDispatchInfoBuilder::replicateFillPattern(patternAllocation->getUnderlyingBuffer(), alignUp(patternSize, 4));
 
     auto eBuiltInOps = EBuiltInOps::FillBuffer;
     if (forceStateless(buffer->getSize())) {
@@ -66,7 +67,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueFillBuffer(
     auto multiGraphicsAllocation = MultiGraphicsAllocation(getDevice().getRootDeviceIndex());
     multiGraphicsAllocation.addAllocation(patternAllocation);
 
-    MemObj patternMemObj(this->context, 0, {}, 0, 0, alignUp(patternSize, 4), patternAllocation->getUnderlyingBuffer(),
+    MemObj patternMemObj(this->context, 0, {}, 0, 0, replicatedPatternSize, patternAllocation->getUnderlyingBuffer(),
                          patternAllocation->getUnderlyingBuffer(), std::move(multiGraphicsAllocation), false, false, true);
     dc.srcMemObj = &patternMemObj;
     dc.dstMemObj = buffer;
@@ -9,6 +9,7 @@
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/blit_commands_helper.h"
 
 #include "opencl/source/command_queue/command_queue_hw.h"
 #include "opencl/source/helpers/hardware_commands_helper.h"
@@ -29,9 +30,13 @@ cl_int CommandQueueHw<GfxFamily>::enqueueFillImage(
     cl_uint numEventsInWaitList,
     const cl_event *eventWaitList,
     cl_event *event) {
-    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::FillImage3d,
-                                                                            this->getClDevice());
-    BuiltInOwnershipWrapper builtInLock(builder, this->context);
+    constexpr cl_command_type cmdType = CL_COMMAND_FILL_IMAGE;
+
+    CommandStreamReceiver *csr = &getGpgpuCommandStreamReceiver();
+    if (BlitCommandsHelper<GfxFamily>::isImageFillSupported()) {
+        CsrSelectionArgs csrSelectionArgs{cmdType, nullptr, image, device->getRootDeviceIndex(), region, nullptr, origin};
+        csr = &selectCsrForBuiltinOperation(csrSelectionArgs);
+    }
 
     MemObjSurface dstImgSurf(image);
     Surface *surfaces[] = {&dstImgSurf};
@@ -45,14 +50,6 @@ cl_int CommandQueueHw<GfxFamily>::enqueueFillImage(
 
     MultiDispatchInfo di(dc);
 
-    builder.buildDispatchInfos(di);
-
-    return enqueueHandler<CL_COMMAND_FILL_IMAGE>(
-        surfaces,
-        false,
-        di,
-        numEventsInWaitList,
-        eventWaitList,
-        event);
+    return dispatchBcsOrGpgpuEnqueue<CL_COMMAND_FILL_IMAGE>(di, surfaces, EBuiltInOps::FillImage3d, numEventsInWaitList, eventWaitList, event, false, *csr);
 }
 } // namespace NEO
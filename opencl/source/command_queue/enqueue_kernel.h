@@ -100,6 +100,12 @@ cl_int CommandQueueHw<GfxFamily>::enqueueKernel(
         localWkgSizeToPass = reqdWorkgroupSize;
     }
 
+    if (localWkgSizeToPass == nullptr && kernelInfo.builtinDispatchBuilder == nullptr &&
+        getGpgpuCommandStreamReceiver().peekTimestampPacketWriteEnabled() &&
+        kernel.getTunedLocalWorkSize(*device, Vec3<size_t>(region), workDim, workGroupSize)) {
+        localWkgSizeToPass = workGroupSize;
+    }
+
     NullSurface s;
     Surface *surfaces[] = {&s};
 
@@ -485,11 +485,11 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMMemFill(void *svmPtr,
     auto commandStreamReceieverOwnership = getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
     auto storageWithAllocations = getGpgpuCommandStreamReceiver().getInternalAllocationStorage();
     auto allocationType = AllocationType::FILL_PATTERN;
-    auto patternAllocation = storageWithAllocations->obtainReusableAllocation(patternSize, allocationType).release();
+    auto patternAllocation = storageWithAllocations->obtainReusableAllocation(alignUp(patternSize, BuiltinDispatchInfoBuilder::fillPatternVecSize), allocationType).release();
     commandStreamReceieverOwnership.unlock();
 
     if (!patternAllocation) {
-        patternAllocation = memoryManager->allocateGraphicsMemoryWithProperties({getDevice().getRootDeviceIndex(), patternSize, allocationType, getDevice().getDeviceBitfield()});
+        patternAllocation = memoryManager->allocateGraphicsMemoryWithProperties({getDevice().getRootDeviceIndex(), alignUp(patternSize, BuiltinDispatchInfoBuilder::fillPatternVecSize), allocationType, getDevice().getDeviceBitfield()});
     }
 
     if (patternSize == 1) {
@@ -501,6 +501,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMMemFill(void *svmPtr,
     } else {
         memcpy_s(patternAllocation->getUnderlyingBuffer(), patternSize, pattern, patternSize);
     }
+    auto replicatedPatternSize = BuiltinDispatchInfoBuilder::replicateFillPattern(patternAllocation->getUnderlyingBuffer(), alignUp(patternSize, 4));
 
     auto builtInType = EBuiltInOps::FillBuffer;
     if (forceStateless(svmData->size)) {
@@ -516,7 +517,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueSVMMemFill(void *svmPtr,
     auto multiGraphicsAllocation = MultiGraphicsAllocation(getDevice().getRootDeviceIndex());
     multiGraphicsAllocation.addAllocation(patternAllocation);
 
-    MemObj patternMemObj(this->context, 0, {}, 0, 0, alignUp(patternSize, 4), patternAllocation->getUnderlyingBuffer(),
+    MemObj patternMemObj(this->context, 0, {}, 0, 0, replicatedPatternSize, patternAllocation->getUnderlyingBuffer(),
                          patternAllocation->getUnderlyingBuffer(), std::move(multiGraphicsAllocation), false, false, true);
 
     void *alignedDstPtr = alignDown(svmPtr, 4);
@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/memory_manager/staging_buffer_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 
 #include "opencl/source/command_queue/command_queue_hw.h"
@@ -58,6 +59,11 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
                                                   numEventsInWaitList, eventWaitList, event);
     }
 
+    auto stagingBufferManager = context->getStagingBufferManager();
+    if (!mapAllocation && stagingBufferManager && stagingBufferManager->isValidForCopy(ptr, size, numEventsInWaitList > 0 || event != nullptr)) {
+        return enqueueStagingWriteBuffer(buffer, blockingWrite, offset, size, ptr, csr);
+    }
+
     auto eBuiltInOps = EBuiltInOps::CopyBufferToBuffer;
     if (forceStateless(buffer->getSize())) {
         eBuiltInOps = EBuiltInOps::CopyBufferToBufferStateless;
@@ -112,4 +118,34 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteBuffer(
 
     return CL_SUCCESS;
 }
+
+template <typename GfxFamily>
+cl_int CommandQueueHw<GfxFamily>::enqueueStagingWriteBuffer(Buffer *buffer, cl_bool blockingWrite, size_t offset, size_t size, const void *ptr, CommandStreamReceiver &csr) {
+    auto eBuiltInOps = forceStateless(buffer->getSize()) ? EBuiltInOps::CopyBufferToBufferStateless : EBuiltInOps::CopyBufferToBuffer;
+    auto rootDeviceIndex = getDevice().getRootDeviceIndex();
+    auto svmAllocsManager = context->getSVMAllocsManager();
+
+    ChunkCopyFunction chunkWrite = [&](void *stagingBuffer, size_t chunkOffset, size_t chunkSize) -> int32_t {
+        auto stagingAllocation = svmAllocsManager->getSVMAlloc(stagingBuffer)->gpuAllocations.getGraphicsAllocation(rootDeviceIndex);
+        MemObjSurface bufferSurf(buffer);
+        GeneralSurface stagingSurface(stagingAllocation);
+        Surface *surfaces[] = {&bufferSurf, &stagingSurface};
+
+        BuiltinOpParams dc;
+        dc.srcPtr = reinterpret_cast<void *>(stagingAllocation->getGpuAddress());
+        dc.dstMemObj = buffer;
+        dc.dstOffset = {offset + chunkOffset, 0, 0};
+        dc.size = {chunkSize, 0, 0};
+        dc.transferAllocation = stagingAllocation;
+
+        MultiDispatchInfo dispatchInfo(dc);
+        return dispatchBcsOrGpgpuEnqueue<CL_COMMAND_WRITE_BUFFER>(dispatchInfo, surfaces, eBuiltInOps, 0, nullptr, nullptr, false, csr);
+    };
+
+    auto ret = context->getStagingBufferManager()->performCopy(ptr, size, chunkWrite, &csr);
+    if (ret != CL_SUCCESS) {
+        return ret;
+    }
+    return blockingWrite ? finish() : CL_SUCCESS;
+}
 } // namespace NEO
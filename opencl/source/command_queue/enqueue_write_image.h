@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 
@@ -51,6 +52,36 @@ cl_int CommandQueueHw<GfxFamily>::enqueueWriteImage(
                                                   numEventsInWaitList, eventWaitList, event);
     }
 
+    const auto &imageDesc = dstImage->getImageDesc();
+    const auto chunkSize = DebugManager.flags.WriteImageChunkSize.get();
+    const bool chunkingAllowed = chunkSize > 0 && !mapAllocation && !isOOQEnabled() && region[2] == 1u &&
+                                 (imageDesc.image_type == CL_MEM_OBJECT_IMAGE2D ||
+                                  imageDesc.image_type == CL_MEM_OBJECT_IMAGE2D_ARRAY ||
+                                  imageDesc.image_type == CL_MEM_OBJECT_IMAGE3D) &&
+                                 !isMipMapped(imageDesc) && !(event && isProfilingEnabled());
+    if (chunkingAllowed) {
+        // pin and copy row ranges one by one, so staging of the next range overlaps with the copy of the previous one
+        const size_t rowPitch = inputRowPitch ? inputRowPitch : region[0] * dstImage->getSurfaceFormatInfo().surfaceFormat.ImageElementSizeInBytes;
+        const size_t rowsPerChunk = std::max(static_cast<size_t>(chunkSize) / rowPitch, static_cast<size_t>(1u));
+        if (region[1] > rowsPerChunk) {
+            for (size_t row = 0; row < region[1]; row += rowsPerChunk) {
+                const bool isFirstChunk = (row == 0);
+                const bool isLastChunk = (row + rowsPerChunk >= region[1]);
+                const size_t chunkOrigin[] = {origin[0], origin[1] + row, origin[2]};
+                const size_t chunkRegion[] = {region[0], std::min(rowsPerChunk, region[1] - row), 1u};
+
+                auto retVal = enqueueWriteImage(dstImage, isLastChunk ? blockingWrite : CL_FALSE, chunkOrigin, chunkRegion, rowPitch, 0u,
+                                                ptrOffset(ptr, row * rowPitch), nullptr,
+                                                isFirstChunk ? numEventsInWaitList : 0u, isFirstChunk ? eventWaitList : nullptr,
+                                                isLastChunk ? event : nullptr);
+                if (retVal != CL_SUCCESS) {
+                    return retVal;
+                }
+            }
+            return CL_SUCCESS;
+        }
+    }
+
     size_t hostPtrSize = calculateHostPtrSizeForImage(region, inputRowPitch, inputSlicePitch, dstImage);
     void *srcPtr = const_cast<void *>(ptr);
 
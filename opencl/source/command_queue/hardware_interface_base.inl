@@ -11,6 +11,7 @@
 #include "shared/source/helpers/pause_on_gpu_properties.h"
 #include "shared/source/helpers/pipe_control_args.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
+#include "shared/source/utilities/latency_histograms.h"
 
 #include "opencl/source/command_queue/gpgpu_walker.h"
 #include "opencl/source/command_queue/hardware_interface.h"
@@ -65,6 +66,7 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
     const MultiDispatchInfo &multiDispatchInfo,
     const CsrDependencies &csrDependencies,
     HardwareInterfaceWalkerArgs &walkerArgs) {
+    LATENCY_SCOPE("encode");
 
     LinearStream *commandStream = nullptr;
     IndirectHeap *dsh = nullptr, *ioh = nullptr, *ssh = nullptr;
@@ -142,6 +144,7 @@ void HardwareInterface<GfxFamily>::dispatchWalker(
                                     multiDispatchInfo.begin()->getActualWorkgroupSize(),
                                     multiDispatchInfo.begin()->getOffset(),
                                     walkerArgs.currentTimestampPacketNodes);
+    mainKernel->storeLocalWorkSizeTuningTimestamps(walkerArgs.currentTimestampPacketNodes);
 
     walkerArgs.currentDispatchIndex = 0;
     for (auto &dispatchInfo : multiDispatchInfo) {
@@ -254,6 +257,15 @@ void HardwareInterface<GfxFamily>::obtainIndirectHeaps(CommandQueue &commandQueu
 
         dshSize = HardwareCommandsHelper<GfxFamily>::getTotalSizeRequiredDSH(multiDispatchInfo);
 
+        auto resourcePool = commandQueue.getKernelOperationResourcePool();
+        if (resourcePool) {
+            dsh = resourcePool->obtainHeap(IndirectHeap::Type::DYNAMIC_STATE);
+            ssh = resourcePool->obtainHeap(IndirectHeap::Type::SURFACE_STATE);
+            if (!iohEqualsDsh) {
+                ioh = resourcePool->obtainHeap(IndirectHeap::Type::INDIRECT_OBJECT);
+            }
+        }
+
         commandQueue.allocateHeapMemory(IndirectHeap::Type::DYNAMIC_STATE, dshSize, dsh);
         dsh->getSpace(colorCalcSize);
 
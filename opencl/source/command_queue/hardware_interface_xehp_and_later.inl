@@ -127,6 +127,10 @@ inline void HardwareInterface<GfxFamily>::programWalker(
     if (partitionWalker) {
         const uint64_t workPartitionAllocationGpuVa = commandQueue.getDevice().getDefaultEngine().commandStreamReceiver->getWorkPartitionAllocationGpuAddress();
         uint32_t partitionCount = 0u;
+        std::optional<typename GfxFamily::COMPUTE_WALKER::PARTITION_TYPE> requestedPartitionType{};
+        if (kernel.getRequestedWalkerPartitionType() != -1) {
+            requestedPartitionType = static_cast<typename GfxFamily::COMPUTE_WALKER::PARTITION_TYPE>(kernel.getRequestedWalkerPartitionType());
+        }
         ImplicitScalingDispatch<GfxFamily>::dispatchCommands(commandStream,
                                                              walkerCmd,
                                                              devices,
@@ -135,7 +139,8 @@ inline void HardwareInterface<GfxFamily>::programWalker(
                                                              false,
                                                              kernel.usesImages(),
                                                              workPartitionAllocationGpuVa,
-                                                             hwInfo);
+                                                             hwInfo,
+                                                             requestedPartitionType);
         if (queueCsr.isStaticWorkPartitioningEnabled()) {
             queueCsr.setActivePartitions(std::max(queueCsr.getActivePartitions(), partitionCount));
         }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,14 @@ CompilerCacheConfig getDefaultClCompilerCacheConfig() {
     std::unique_ptr<SettingsReader> settingsReader(SettingsReader::createOsReader(false, keyName));
     ret.cacheDir = settingsReader->getSetting(settingsReader->appSpecificLocation(keyName), static_cast<std::string>(CL_CACHE_LOCATION));
 
+    std::string sizeKeyName = oclRegPath;
+    sizeKeyName += "cl_cache_max_size";
+    ret.cacheSize = static_cast<size_t>(settingsReader->getSetting(settingsReader->appSpecificLocation(sizeKeyName), static_cast<int64_t>(0)));
+
+    std::string readOnlyDirKeyName = oclRegPath;
+    readOnlyDirKeyName += "cl_cache_readonly_dir";
+    ret.readOnlyCacheDir = settingsReader->getSetting(settingsReader->appSpecificLocation(readOnlyDirKeyName), std::string(""));
+
     ret.cacheFileExtension = ".cl_cache";
 
     return ret;
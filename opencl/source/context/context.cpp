@@ -11,10 +11,12 @@
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/get_info.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/deferred_deleter.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/staging_buffer_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 
 #include "opencl/source/cl_device/cl_device.h"
@@ -23,6 +25,7 @@
 #include "opencl/source/gtpin/gtpin_notify.h"
 #include "opencl/source/helpers/get_info_status_mapper.h"
 #include "opencl/source/helpers/surface_formats.h"
+#include "opencl/source/mem_obj/buffer.h"
 #include "opencl/source/mem_obj/image.h"
 #include "opencl/source/platform/platform.h"
 #include "opencl/source/sharings/sharing_factory.h"
@@ -36,7 +39,7 @@ namespace NEO {
 
 Context::Context(
     void(CL_CALLBACK *funcNotify)(const char *, const void *, size_t, void *),
-    void *data) {
+    void *data) : smallBufferPoolAllocator(this) {
     contextCallback = funcNotify;
     userData = data;
     sharingFunctions.resize(SharingType::MAX_SHARING_VALUE);
@@ -47,11 +50,16 @@ Context::~Context() {
 
     delete[] properties;
 
+    smallBufferPoolAllocator.releaseSmallBufferPools();
+
     for (auto rootDeviceIndex = 0u; rootDeviceIndex < specialQueues.size(); rootDeviceIndex++) {
         if (specialQueues[rootDeviceIndex]) {
             delete specialQueues[rootDeviceIndex];
         }
     }
+    if (stagingBufferManager) {
+        delete stagingBufferManager;
+    }
     if (svmAllocsManager) {
         delete svmAllocsManager;
     }
@@ -67,6 +75,15 @@ Context::~Context() {
     }
 }
 
+unique_ptr_if_unused<Context> Context::release() {
+    if (getReference() == 1) {
+        // Pools only hold internal references of their main storages from now on,
+        // which are dropped together with the last pooled buffer
+        smallBufferPoolAllocator.releaseSmallBufferPools();
+    }
+    return BaseObject<_cl_context>::release();
+}
+
 cl_int Context::setDestructorCallback(void(CL_CALLBACK *funcNotify)(cl_context, void *),
                                       void *userData) {
     std::unique_lock<std::mutex> theLock(mtx);
@@ -256,6 +273,9 @@ bool Context::createImpl(const cl_context_properties *properties,
         if (anySvmSupport) {
             this->svmAllocsManager = new SVMAllocsManager(this->memoryManager,
                                                           this->areMultiStorageAllocationsPreferred());
+            if (StagingBufferManager::isEnabled()) {
+                this->stagingBufferManager = new StagingBufferManager(this->svmAllocsManager, this->rootDeviceIndices, this->deviceBitfields);
+            }
         }
     }
 
@@ -467,4 +487,137 @@ Platform *Context::getPlatformFromProperties(const cl_context_properties *proper
 bool Context::isSingleDeviceContext() {
     return devices[0]->getNumGenericSubDevices() == 0 && getNumDevices() == 1;
 }
+
+bool Context::BufferPoolAllocator::isAggregatedSmallBuffersEnabled() const {
+    return DebugManager.flags.ExperimentalSmallBufferPoolAllocator.get() == 1 &&
+           context->getNumDevices() > 0 &&
+           context->isSingleDeviceContext() &&
+           !context->isSharedContext;
+}
+
+bool Context::BufferPoolAllocator::areFlagsSupported(const MemoryProperties &memoryProperties, cl_mem_flags flags, cl_mem_flags_intel flagsIntel, void *hostPtr) const {
+    constexpr cl_mem_flags supportedFlags = CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR;
+    if ((flags & ~supportedFlags) != 0 || flagsIntel != 0) {
+        return false;
+    }
+    return memoryProperties.flags.copyHostPtr == (hostPtr != nullptr);
+}
+
+Buffer *Context::BufferPoolAllocator::allocateBufferFromPool(const MemoryProperties &memoryProperties,
+                                                             cl_mem_flags flags,
+                                                             cl_mem_flags_intel flagsIntel,
+                                                             size_t size,
+                                                             void *hostPtr,
+                                                             cl_int &errcodeRet) {
+    errcodeRet = CL_MEM_OBJECT_ALLOCATION_FAILURE;
+    if (size == 0 || !isSizeWithinThreshold(size) || !areFlagsSupported(memoryProperties, flags, flagsIntel, hostPtr)) {
+        return nullptr;
+    }
+    auto rootDeviceIndex = context->getDevice(0)->getRootDeviceIndex();
+    if (hostPtr && !context->getSpecialQueue(rootDeviceIndex)) {
+        return nullptr;
+    }
+
+    Buffer *buffer = nullptr;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        for (auto &bufferPool : bufferPools) {
+            buffer = allocateFromPool(bufferPool, flags, size);
+            if (!buffer) {
+                drain(bufferPool);
+                buffer = allocateFromPool(bufferPool, flags, size);
+            }
+            if (buffer) {
+                break;
+            }
+        }
+        if (!buffer && addNewBufferPool()) {
+            buffer = allocateFromPool(bufferPools.back(), flags, size);
+        }
+    }
+    if (!buffer) {
+        return nullptr;
+    }
+
+    errcodeRet = CL_SUCCESS;
+    if (hostPtr) {
+        errcodeRet = context->getSpecialQueue(rootDeviceIndex)->enqueueWriteBuffer(buffer, CL_TRUE, 0, size, hostPtr, nullptr, 0, nullptr, nullptr);
+        if (errcodeRet != CL_SUCCESS) {
+            buffer->release();
+            return nullptr;
+        }
+    }
+    return buffer;
+}
+
+Buffer *Context::BufferPoolAllocator::allocateFromPool(BufferPool &bufferPool, cl_mem_flags flags, size_t size) {
+    auto chunkSize = alignUp(size, chunkAlignment);
+    auto bufferRegionOrigin = bufferPool.chunkAllocator->allocate(chunkSize);
+    if (bufferRegionOrigin == 0) {
+        return nullptr;
+    }
+
+    cl_buffer_region bufferRegion{static_cast<size_t>(bufferRegionOrigin - startingOffset), size};
+    cl_int errcodeRet = CL_SUCCESS;
+    auto buffer = bufferPool.mainStorage->createSubBuffer(flags, 0, &bufferRegion, errcodeRet);
+    buffer->isParentObjectPool = true;
+    // Chunk may be larger than requested when taken from freed chunks
+    bufferPool.chunkSizes[bufferRegion.origin] = chunkSize;
+    return buffer;
+}
+
+bool Context::BufferPoolAllocator::addNewBufferPool() {
+    cl_int errcodeRet = CL_SUCCESS;
+    auto mainStorage = Buffer::create(context, CL_MEM_READ_WRITE, aggregatedSmallBuffersPoolSize, nullptr, errcodeRet);
+    if (!mainStorage) {
+        return false;
+    }
+
+    BufferPool bufferPool;
+    bufferPool.mainStorage = mainStorage;
+    bufferPool.chunkAllocator = std::make_unique<HeapAllocator>(startingOffset, aggregatedSmallBuffersPoolSize, chunkAlignment);
+    bufferPools.push_back(std::move(bufferPool));
+    return true;
+}
+
+void Context::BufferPoolAllocator::drain(BufferPool &bufferPool) {
+    if (bufferPool.chunksToFree.empty()) {
+        return;
+    }
+    // Freed chunks become reusable only once GPU no longer accesses the main storage
+    for (auto allocation : bufferPool.mainStorage->getMultiGraphicsAllocation().getGraphicsAllocations()) {
+        if (allocation && context->getMemoryManager()->allocInUse(*allocation)) {
+            return;
+        }
+    }
+    for (auto &[offset, size] : bufferPool.chunksToFree) {
+        bufferPool.chunkAllocator->free(offset, size);
+    }
+    bufferPool.chunksToFree.clear();
+}
+
+void Context::BufferPoolAllocator::tryFreeFromPoolBuffer(MemObj *possiblePoolBuffer, size_t offset) {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (auto &bufferPool : bufferPools) {
+        if (bufferPool.mainStorage == possiblePoolBuffer) {
+            auto chunk = bufferPool.chunkSizes.find(offset);
+            if (chunk != bufferPool.chunkSizes.end()) {
+                bufferPool.chunksToFree.push_back({offset + startingOffset, chunk->second});
+                bufferPool.chunkSizes.erase(chunk);
+            }
+            return;
+        }
+    }
+}
+
+void Context::BufferPoolAllocator::releaseSmallBufferPools() {
+    std::vector<BufferPool> bufferPoolsToRelease;
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        bufferPoolsToRelease.swap(bufferPools);
+    }
+    for (auto &bufferPool : bufferPoolsToRelease) {
+        bufferPool.mainStorage->release();
+    }
+}
 } // namespace NEO
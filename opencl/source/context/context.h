@@ -10,6 +10,7 @@
 #include "shared/source/helpers/common_types.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/unified_memory/unified_memory.h"
+#include "shared/source/utilities/heap_allocator.h"
 
 #include "opencl/source/cl_device/cl_device_vector.h"
 #include "opencl/source/context/context_type.h"
@@ -20,18 +21,25 @@
 #include "opencl/source/mem_obj/map_operations_handler.h"
 
 #include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace NEO {
 
 class AsyncEventsHandler;
+class Buffer;
 class CommandQueue;
 class Device;
 class Kernel;
+class MemObj;
 class MemoryManager;
 class SharingFunctions;
+class StagingBufferManager;
 class SVMAllocsManager;
 class Program;
 class Platform;
+struct MemoryProperties;
 
 template <>
 struct OpenCLObjectMapper<_cl_context> {
@@ -42,6 +50,48 @@ class Context : public BaseObject<_cl_context> {
   public:
     static const cl_ulong objectMagic = 0xA4234321DC002130LL;
 
+    // Carves small buffers out of large backing buffers to save allocations, BO handles and VA ranges.
+    // Pooled buffers are sub-buffers of a pool's main storage, so they share its graphics allocation
+    // and residency, but are reported to the application as regular buffers.
+    class BufferPoolAllocator {
+      public:
+        static constexpr size_t aggregatedSmallBuffersPoolSize = 2 * MemoryConstants::megaByte;
+        static constexpr size_t smallBufferThreshold = 64 * MemoryConstants::kiloByte;
+        static constexpr size_t chunkAlignment = 512u;
+        static constexpr size_t startingOffset = chunkAlignment;
+
+        BufferPoolAllocator(Context *context) : context(context) {}
+
+        bool isAggregatedSmallBuffersEnabled() const;
+        Buffer *allocateBufferFromPool(const MemoryProperties &memoryProperties,
+                                       cl_mem_flags flags,
+                                       cl_mem_flags_intel flagsIntel,
+                                       size_t size,
+                                       void *hostPtr,
+                                       cl_int &errcodeRet);
+        void tryFreeFromPoolBuffer(MemObj *possiblePoolBuffer, size_t offset);
+        void releaseSmallBufferPools();
+        size_t getPoolsCount() const { return bufferPools.size(); }
+
+      protected:
+        struct BufferPool {
+            Buffer *mainStorage = nullptr;
+            std::unique_ptr<HeapAllocator> chunkAllocator;
+            std::map<size_t, size_t> chunkSizes;
+            std::vector<std::pair<uint64_t, size_t>> chunksToFree;
+        };
+
+        bool isSizeWithinThreshold(size_t size) const { return size <= smallBufferThreshold; }
+        bool areFlagsSupported(const MemoryProperties &memoryProperties, cl_mem_flags flags, cl_mem_flags_intel flagsIntel, void *hostPtr) const;
+        bool addNewBufferPool();
+        void drain(BufferPool &bufferPool);
+        Buffer *allocateFromPool(BufferPool &bufferPool, cl_mem_flags flags, size_t size);
+
+        Context *context = nullptr;
+        std::vector<BufferPool> bufferPools;
+        std::mutex mutex;
+    };
+
     bool createImpl(const cl_context_properties *properties,
                     const ClDeviceVector &devices,
                     void(CL_CALLBACK *pfnNotify)(const char *, const void *, size_t, void *),
@@ -68,6 +118,8 @@ class Context : public BaseObject<_cl_context> {
 
     ~Context() override;
 
+    unique_ptr_if_unused<Context> release() override;
+
     cl_int setDestructorCallback(void(CL_CALLBACK *funcNotify)(cl_context, void *),
                                  void *userData);
 
@@ -90,8 +142,14 @@ class Context : public BaseObject<_cl_context> {
         return svmAllocsManager;
     }
 
+    StagingBufferManager *getStagingBufferManager() const {
+        return stagingBufferManager;
+    }
+
     auto &getMapOperationsStorage() { return mapOperationsStorage; }
 
+    BufferPoolAllocator &getBufferPoolAllocator() { return smallBufferPoolAllocator; }
+
     cl_int tryGetExistingHostPtrAllocation(const void *ptr,
                                            size_t size,
                                            uint32_t rootDeviceIndex,
@@ -208,7 +266,9 @@ class Context : public BaseObject<_cl_context> {
     void *userData = nullptr;
     MemoryManager *memoryManager = nullptr;
     SVMAllocsManager *svmAllocsManager = nullptr;
+    StagingBufferManager *stagingBufferManager = nullptr;
     MapOperationsStorage mapOperationsStorage = {};
+    BufferPoolAllocator smallBufferPoolAllocator;
     StackVec<CommandQueue *, 1> specialQueues;
     DriverDiagnostics *driverDiagnostics = nullptr;
 
@@ -7,10 +7,13 @@
 
 #include "opencl/source/event/async_events_handler.h"
 
+#include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/wait_status.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/event/event.h"
 
 #include <iterator>
@@ -21,6 +24,7 @@ AsyncEventsHandler::AsyncEventsHandler() {
     registerList.reserve(64);
     list.reserve(64);
     pendingList.reserve(64);
+    readyList.reserve(64);
 }
 
 AsyncEventsHandler::~AsyncEventsHandler() {
@@ -37,14 +41,53 @@ void AsyncEventsHandler::registerEvent(Event *event) {
     asyncCond.notify_one();
 }
 
+bool AsyncEventsHandler::isEventPending(Event *event) {
+    return event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE));
+}
+
+AsyncEventsHandler::TaskCountScanResult AsyncEventsHandler::scanTaskCount(Event *event) {
+    if (event->peekExecutionStatus() != CL_SUBMITTED || event->getCommandQueue() == nullptr || event->getTimestampPacketNodes() != nullptr) {
+        return TaskCountScanResult::Unknown;
+    }
+
+    auto &csr = event->getCommandQueue()->getGpgpuCommandStreamReceiver();
+    auto taskCount = event->peekTaskCount();
+
+    CsrScanState *scanState = nullptr;
+    for (auto &state : csrScanStates) {
+        if (state.csr == &csr) {
+            scanState = &state;
+            break;
+        }
+    }
+    if (scanState == nullptr) {
+        csrScanStates.push_back({&csr, CompletionStamp::notReady, 0u});
+        scanState = &csrScanStates[csrScanStates.size() - 1];
+    }
+
+    if (taskCount >= scanState->lowestNotReadyTaskCount) {
+        return TaskCountScanResult::NotReady;
+    }
+    if (taskCount <= scanState->highestReadyTaskCount) {
+        return TaskCountScanResult::Ready;
+    }
+    if (csr.testTaskCountReady(csr.getTagAddress(), taskCount)) {
+        scanState->highestReadyTaskCount = taskCount;
+        return TaskCountScanResult::Ready;
+    }
+    scanState->lowestNotReadyTaskCount = taskCount;
+    return TaskCountScanResult::NotReady;
+}
+
 Event *AsyncEventsHandler::processList() {
     uint32_t lowestTaskCount = CompletionStamp::notReady;
     Event *sleepCandidate = nullptr;
     pendingList.clear();
+    readyList.clear();
+    csrScanStates.clear();
 
-    for (auto event : list) {
-        event->updateExecutionStatus();
-        if (event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE))) {
+    auto keepOrRelease = [&](Event *event) {
+        if (isEventPending(event)) {
             pendingList.push_back(event);
             if (event->peekTaskCount() < lowestTaskCount) {
                 sleepCandidate = event;
@@ -53,12 +96,78 @@ Event *AsyncEventsHandler::processList() {
         } else {
             event->decRefInternal();
         }
+    };
+
+    for (auto event : list) {
+        auto scanResult = scanTaskCount(event);
+        if (scanResult == TaskCountScanResult::Ready && event->peekHasCallbacks()) {
+            readyList.push_back(event);
+            continue;
+        }
+        if (scanResult != TaskCountScanResult::NotReady) {
+            event->updateExecutionStatus();
+        }
+        keepOrRelease(event);
+    }
+
+    if (!dispatchToCallbackThreads(readyList)) {
+        for (auto event : readyList) {
+            event->updateExecutionStatus();
+            keepOrRelease(event);
+        }
     }
 
     list.swap(pendingList);
     return sleepCandidate;
 }
 
+bool AsyncEventsHandler::dispatchToCallbackThreads(std::vector<Event *> &events) {
+    if (events.empty()) {
+        return true;
+    }
+    std::unique_lock<std::mutex> lock(callbackMtx);
+    if (!allowCallbackProcess) {
+        return false;
+    }
+    callbackQueue.insert(callbackQueue.end(), events.begin(), events.end());
+    callbackCond.notify_all();
+    return true;
+}
+
+void *AsyncEventsHandler::callbackProcess(void *arg) {
+    auto self = reinterpret_cast<AsyncEventsHandler *>(arg);
+    std::unique_lock<std::mutex> lock(self->callbackMtx);
+
+    while (true) {
+        if (self->callbackQueue.empty()) {
+            if (!self->allowCallbackProcess) {
+                break;
+            }
+            self->callbackCond.wait(lock);
+            continue;
+        }
+        auto event = self->callbackQueue.front();
+        self->callbackQueue.pop_front();
+        lock.unlock();
+
+        event->updateExecutionStatus();
+        if (isEventPending(event)) {
+            self->reregisterEvent(event);
+        } else {
+            event->decRefInternal();
+        }
+
+        lock.lock();
+    }
+    return nullptr;
+}
+
+void AsyncEventsHandler::reregisterEvent(Event *event) {
+    std::unique_lock<std::mutex> lock(asyncMtx);
+    registerList.push_back(event);
+    asyncCond.notify_one();
+}
+
 void *AsyncEventsHandler::asyncProcess(void *arg) {
     auto self = reinterpret_cast<AsyncEventsHandler *>(arg);
     std::unique_lock<std::mutex> lock(self->asyncMtx, std::defer_lock);
@@ -93,6 +202,11 @@ void *AsyncEventsHandler::asyncProcess(void *arg) {
 void AsyncEventsHandler::closeThread() {
     std::unique_lock<std::mutex> lock(asyncMtx);
     if (allowAsyncProcess) {
+        // callback threads may return events to registerList, stop them while the main thread still consumes it
+        lock.unlock();
+        closeCallbackThreads();
+        lock.lock();
+
         allowAsyncProcess = false;
         asyncCond.notify_one();
         lock.unlock();
@@ -106,7 +220,34 @@ void AsyncEventsHandler::openThread() {
         DEBUG_BREAK_IF(allowAsyncProcess);
         allowAsyncProcess = true;
         thread = Thread::create(asyncProcess, reinterpret_cast<void *>(this));
+        openCallbackThreads();
+    }
+}
+
+void AsyncEventsHandler::openCallbackThreads() {
+    auto callbackThreadsCount = DebugManager.flags.AsyncEventsHandlerCallbackThreads.get();
+    if (callbackThreadsCount <= 0 || !callbackThreads.empty()) {
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lock(callbackMtx);
+        allowCallbackProcess = true;
+    }
+    for (int32_t i = 0; i < callbackThreadsCount; i++) {
+        callbackThreads.push_back(Thread::create(callbackProcess, reinterpret_cast<void *>(this)));
+    }
+}
+
+void AsyncEventsHandler::closeCallbackThreads() {
+    {
+        std::unique_lock<std::mutex> lock(callbackMtx);
+        allowCallbackProcess = false;
+        callbackCond.notify_all();
+    }
+    for (auto &callbackThread : callbackThreads) {
+        callbackThread->join();
     }
+    callbackThreads.clear();
 }
 
 void AsyncEventsHandler::transferRegisterList() {
@@ -1,18 +1,22 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/utilities/stackvec.h"
+
 #include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <vector>
 
 namespace NEO {
+class CommandStreamReceiver;
 class Event;
 class Thread;
 
@@ -24,18 +28,45 @@ class AsyncEventsHandler {
     void closeThread();
 
   protected:
+    enum class TaskCountScanResult {
+        Unknown,
+        NotReady,
+        Ready
+    };
+
+    struct CsrScanState {
+        CommandStreamReceiver *csr = nullptr;
+        uint32_t lowestNotReadyTaskCount = 0;
+        uint32_t highestReadyTaskCount = 0;
+    };
+
     Event *processList();
     static void *asyncProcess(void *arg);
+    static void *callbackProcess(void *arg);
+    static bool isEventPending(Event *event);
+    TaskCountScanResult scanTaskCount(Event *event);
+    bool dispatchToCallbackThreads(std::vector<Event *> &events);
+    void reregisterEvent(Event *event);
     void releaseEvents();
     MOCKABLE_VIRTUAL void openThread();
+    MOCKABLE_VIRTUAL void openCallbackThreads();
+    void closeCallbackThreads();
     MOCKABLE_VIRTUAL void transferRegisterList();
     std::vector<Event *> registerList;
     std::vector<Event *> list;
     std::vector<Event *> pendingList;
+    std::vector<Event *> readyList;
+    StackVec<CsrScanState, 4> csrScanStates;
 
     std::unique_ptr<Thread> thread;
     std::mutex asyncMtx;
     std::condition_variable asyncCond;
     std::atomic<bool> allowAsyncProcess;
+
+    std::vector<std::unique_ptr<Thread>> callbackThreads;
+    std::deque<Event *> callbackQueue;
+    std::mutex callbackMtx;
+    std::condition_variable callbackCond;
+    bool allowCallbackProcess = false;
 };
 } // namespace NEO
@@ -409,14 +409,11 @@ void Event::getBoundaryTimestampValues(TimestampPacketContainer *timestampContai
         if (!timestamp->isProfilingCapable()) {
             continue;
         }
-        for (auto i = 0u; i < timestamp->getPacketsUsed(); ++i) {
-            if (globalStartTS > timestamp->getGlobalStartValue(i)) {
-                globalStartTS = timestamp->getGlobalStartValue(i);
-            }
-            if (globalEndTS < timestamp->getGlobalEndValue(i)) {
-                globalEndTS = timestamp->getGlobalEndValue(i);
-            }
-        }
+        uint64_t nodeGlobalStartTS = 0;
+        uint64_t nodeGlobalEndTS = 0;
+        timestamp->getGlobalStartEndRange(nodeGlobalStartTS, nodeGlobalEndTS);
+        globalStartTS = std::min(globalStartTS, nodeGlobalStartTS);
+        globalEndTS = std::max(globalEndTS, nodeGlobalEndTS);
     }
 }
 
@@ -713,11 +710,9 @@ bool Event::areTimestampsCompleted() {
     if (this->timestampPacketContainer.get()) {
         if (this->isWaitForTimestampsEnabled()) {
             for (const auto &timestamp : this->timestampPacketContainer->peekNodes()) {
-                for (uint32_t i = 0; i < timestamp->getPacketsUsed(); i++) {
-                    this->cmdQueue->getGpgpuCommandStreamReceiver().downloadAllocation(*timestamp->getBaseGraphicsAllocation()->getGraphicsAllocation(this->cmdQueue->getGpgpuCommandStreamReceiver().getRootDeviceIndex()));
-                    if (timestamp->getContextEndValue(i) == 1) {
-                        return false;
-                    }
+                this->cmdQueue->getGpgpuCommandStreamReceiver().downloadAllocation(*timestamp->getBaseGraphicsAllocation()->getGraphicsAllocation(this->cmdQueue->getGpgpuCommandStreamReceiver().getRootDeviceIndex()));
+                if (!timestamp->isCompleted()) {
+                    return false;
                 }
             }
             return true;
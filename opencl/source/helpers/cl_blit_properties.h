@@ -9,6 +9,8 @@
 #include "shared/source/helpers/blit_commands_helper.h"
 
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
+#include "opencl/source/helpers/convert_color.h"
+#include "opencl/source/helpers/mipmap.h"
 #include "opencl/source/mem_obj/image.h"
 
 #include "CL/cl.h"
@@ -58,6 +60,29 @@ struct ClBlitProperties {
             return blitProperties;
         }
 
+        if (BlitterConstants::BlitDirection::ImageFill == blitDirection) {
+            auto dstAllocation = builtinOpParams.dstMemObj->getGraphicsAllocation(rootDeviceIndex);
+
+            blitProperties.blitDirection = blitDirection;
+            blitProperties.dstAllocation = dstAllocation;
+            // fill has no source, image is used as source to keep residency and workarounds programming uniform
+            blitProperties.srcAllocation = dstAllocation;
+            blitProperties.dstGpuAddress = dstAllocation->getGpuAddress();
+            blitProperties.srcGpuAddress = dstAllocation->getGpuAddress();
+            blitProperties.dstOffset = builtinOpParams.dstOffset;
+            blitProperties.copySize = builtinOpParams.size;
+            blitProperties.clearColorAllocation = clearColorAllocation;
+
+            size_t dstRowPitch = 0;
+            size_t dstSlicePitch = 0;
+            adjustBlitPropertiesForImage(builtinOpParams.dstMemObj, blitProperties, dstRowPitch, dstSlicePitch, false);
+            blitProperties.dstRowPitch = dstRowPitch ? dstRowPitch : blitProperties.dstSize.x * blitProperties.bytesPerPixel;
+            blitProperties.dstSlicePitch = dstSlicePitch ? dstSlicePitch : blitProperties.dstSize.y * blitProperties.dstRowPitch;
+
+            setFillPatternForImage(blitProperties, *castToObject<Image>(builtinOpParams.dstMemObj), builtinOpParams.srcPtr);
+            return blitProperties;
+        }
+
         GraphicsAllocation *gpuAllocation = nullptr;
         Vec3<size_t> copyOffset = 0;
 
@@ -163,6 +188,8 @@ struct ClBlitProperties {
             return BlitterConstants::BlitDirection::ImageToHostPtr;
         case CL_COMMAND_COPY_IMAGE:
             return BlitterConstants::BlitDirection::ImageToImage;
+        case CL_COMMAND_FILL_IMAGE:
+            return BlitterConstants::BlitDirection::ImageFill;
         default:
             UNRECOVERABLE_IF(true);
         }
@@ -214,6 +241,34 @@ struct ClBlitProperties {
         }
     }
 
+    // Pixel has to be composed of whole channels, packed formats and 1D buffer images are filled with builtin kernel
+    static bool isImageFillAllowed(const Image &image) {
+        const auto &surfaceFormat = image.getSurfaceFormatInfo().surfaceFormat;
+        return image.getImageDesc().image_type != CL_MEM_OBJECT_IMAGE1D_BUFFER &&
+               !isMipMapped(image.getImageDesc()) &&
+               surfaceFormat.NumChannels * surfaceFormat.PerChannelSizeInBytes == surfaceFormat.ImageElementSizeInBytes &&
+               isPow2(surfaceFormat.ImageElementSizeInBytes) && surfaceFormat.ImageElementSizeInBytes <= 16;
+    }
+
+    // Fill color is converted the same way as for builtin fill kernel and packed into single pixel
+    static void setFillPatternForImage(BlitProperties &blitProperties, const Image &image, const void *fillColor) {
+        const auto &surfaceFormatInfo = image.getSurfaceFormatInfo();
+        auto perChannelSize = surfaceFormatInfo.surfaceFormat.PerChannelSizeInBytes;
+
+        cl_image_format fillFormat = surfaceFormatInfo.OCLImageFormat;
+        fillFormat.image_channel_data_type = perChannelSize == 1 ? CL_UNSIGNED_INT8 : (perChannelSize == 2 ? CL_UNSIGNED_INT16 : CL_UNSIGNED_INT32);
+
+        int32_t iFillColor[4] = {};
+        convertFillColor(fillColor, iFillColor, surfaceFormatInfo.OCLImageFormat, fillFormat);
+
+        blitProperties.fillPattern = {};
+        auto pattern = reinterpret_cast<uint8_t *>(blitProperties.fillPattern.data());
+        for (uint32_t channel = 0; channel < surfaceFormatInfo.surfaceFormat.NumChannels; channel++) {
+            memcpy_s(ptrOffset(pattern, channel * perChannelSize), sizeof(blitProperties.fillPattern) - channel * perChannelSize,
+                     &iFillColor[channel], perChannelSize);
+        }
+    }
+
     static void setBlitPropertiesForImage(BlitProperties &blitProperties, const BuiltinOpParams &builtinOpParams) {
         size_t srcRowPitch = builtinOpParams.srcRowPitch;
         size_t dstRowPitch = builtinOpParams.dstRowPitch;
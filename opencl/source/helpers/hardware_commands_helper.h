@@ -123,6 +123,9 @@ struct HardwareCommandsHelper : public PerThreadDataHelper {
         const MultiDispatchInfo &multiDispatchInfo);
     static size_t getTotalSizeRequiredIOH(
         const MultiDispatchInfo &multiDispatchInfo);
+    static bool isRuntimeLocalIdsGenerationRequired(
+        const Kernel &kernel,
+        const size_t *localWorkSizes);
     static size_t getTotalSizeRequiredSSH(
         const MultiDispatchInfo &multiDispatchInfo);
 
@@ -92,9 +92,29 @@ size_t HardwareCommandsHelper<GfxFamily>::getTotalSizeRequiredDSH(
 template <typename GfxFamily>
 size_t HardwareCommandsHelper<GfxFamily>::getTotalSizeRequiredIOH(
     const MultiDispatchInfo &multiDispatchInfo) {
-    return getSizeRequired(multiDispatchInfo, [](const DispatchInfo &dispatchInfo) { return getSizeRequiredIOH(
-                                                                                         *dispatchInfo.getKernel(),
-                                                                                         Math::computeTotalElementsCount(dispatchInfo.getLocalWorkgroupSize())); });
+    return getSizeRequired(multiDispatchInfo, [](const DispatchInfo &dispatchInfo) {
+        auto &kernel = *dispatchInfo.getKernel();
+        const auto &lws = dispatchInfo.getLocalWorkgroupSize();
+        size_t localWorkSizes[3] = {lws.x, lws.y, lws.z};
+        // local ids emitted by walker don't need per thread data space in IOH
+        auto localWorkItems = isRuntimeLocalIdsGenerationRequired(kernel, localWorkSizes) ? Math::computeTotalElementsCount(lws) : size_t{0u};
+        return getSizeRequiredIOH(kernel, localWorkItems);
+    });
+}
+
+template <typename GfxFamily>
+bool HardwareCommandsHelper<GfxFamily>::isRuntimeLocalIdsGenerationRequired(const Kernel &kernel, const size_t *localWorkSizes) {
+    const auto &kernelAttributes = kernel.getKernelInfo().kernelDescriptor.kernelAttributes;
+    uint32_t requiredWalkOrder = 0u;
+    return EncodeDispatchKernel<GfxFamily>::isRuntimeLocalIdsGenerationRequired(
+        kernelAttributes.numLocalIdChannels,
+        localWorkSizes,
+        std::array<uint8_t, 3>{{kernelAttributes.workgroupWalkOrder[0],
+                                kernelAttributes.workgroupWalkOrder[1],
+                                kernelAttributes.workgroupWalkOrder[2]}},
+        kernelAttributes.flags.requiresWorkgroupWalkOrder,
+        requiredWalkOrder,
+        kernel.getKernelInfo().getMaxSimdSize());
 }
 
 template <typename GfxFamily>
@@ -98,7 +98,8 @@ void HardwareCommandsHelper<GfxFamily>::programPerThreadData(
         std::array<uint8_t, 3>{{kernel.getKernelInfo().kernelDescriptor.kernelAttributes.workgroupDimensionsOrder[0],
                                 kernel.getKernelInfo().kernelDescriptor.kernelAttributes.workgroupDimensionsOrder[1],
                                 kernel.getKernelInfo().kernelDescriptor.kernelAttributes.workgroupDimensionsOrder[2]}},
-        kernel.usesOnlyImages());
+        kernel.usesOnlyImages(),
+        &kernel.getPerThreadDataCache());
 
     updatePerThreadDataTotal(sizePerThreadData, simd, numChannels, sizePerThreadDataTotal, localWorkItems);
 }
@@ -79,7 +79,8 @@ void HardwareCommandsHelper<GfxFamily>::programPerThreadData(
             numChannels,
             std::array<uint16_t, 3>{{static_cast<uint16_t>(localWorkSize[0]), static_cast<uint16_t>(localWorkSize[1]), static_cast<uint16_t>(localWorkSize[2])}},
             {{0u, 1u, 2u}},
-            kernel.usesOnlyImages());
+            kernel.usesOnlyImages(),
+            &kernel.getPerThreadDataCache());
 
         updatePerThreadDataTotal(sizePerThreadData, simd, numChannels, sizePerThreadDataTotal, localWorkItems);
     }
@@ -29,6 +29,70 @@ namespace NEO {
 template void KernelOperation::ResourceCleaner::operator()<LinearStream>(LinearStream *);
 template void KernelOperation::ResourceCleaner::operator()<IndirectHeap>(IndirectHeap *);
 
+LinearStream *KernelOperationResourcePool::obtainCommandStream() {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (commandStreams.empty()) {
+        return new LinearStream();
+    }
+    auto commandStream = commandStreams.back().release();
+    commandStreams.pop_back();
+    return commandStream;
+}
+
+IndirectHeap *KernelOperationResourcePool::obtainHeap(IndirectHeap::Type heapType) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto &heapsOfType = heaps[heapType];
+    if (heapsOfType.empty()) {
+        return nullptr;
+    }
+    auto heap = heapsOfType.back().release();
+    heapsOfType.pop_back();
+    return heap;
+}
+
+void KernelOperationResourcePool::storeCommandStream(LinearStream *commandStream) {
+    std::unique_ptr<LinearStream> commandStreamToStore(commandStream);
+    std::lock_guard<std::mutex> lock(mtx);
+    if (commandStreams.size() < maxPooledObjectsPerType) {
+        commandStreams.push_back(std::move(commandStreamToStore));
+    }
+}
+
+void KernelOperationResourcePool::storeHeap(IndirectHeap::Type heapType, IndirectHeap *heap) {
+    std::unique_ptr<IndirectHeap> heapToStore(heap);
+    std::lock_guard<std::mutex> lock(mtx);
+    if (heaps[heapType].size() < maxPooledObjectsPerType) {
+        heaps[heapType].push_back(std::move(heapToStore));
+    }
+}
+
+void KernelOperation::recycleResources() {
+    auto releaseAllocation = [this](LinearStream &stream) {
+        if (stream.getGraphicsAllocation()) {
+            resourceCleaner.storageForAllocations->storeAllocation(std::unique_ptr<GraphicsAllocation>(stream.getGraphicsAllocation()),
+                                                                   REUSABLE_ALLOCATION);
+        }
+        stream.replaceGraphicsAllocation(nullptr);
+        stream.replaceBuffer(nullptr, 0);
+    };
+
+    if (commandStream) {
+        releaseAllocation(*commandStream);
+        resourcePool->storeCommandStream(commandStream.release());
+    }
+
+    std::pair<IndirectHeapUniquePtrT *, IndirectHeap::Type> heapsToRecycle[] = {{&dsh, IndirectHeap::Type::DYNAMIC_STATE},
+                                                                               {&ioh, IndirectHeap::Type::INDIRECT_OBJECT},
+                                                                               {&ssh, IndirectHeap::Type::SURFACE_STATE}};
+    for (auto &heapToRecycle : heapsToRecycle) {
+        auto &heap = *heapToRecycle.first;
+        if (heap) {
+            releaseAllocation(*heap);
+            resourcePool->storeHeap(heapToRecycle.second, heap.release());
+        }
+    }
+}
+
 CommandMapUnmap::CommandMapUnmap(MapOperationType operationType, MemObj &memObj, MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset, bool readOnly,
                                  CommandQueue &commandQueue)
     : Command(commandQueue), memObj(memObj), copySize(copySize), copyOffset(copyOffset), readOnly(readOnly), operationType(operationType) {
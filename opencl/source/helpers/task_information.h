@@ -9,13 +9,16 @@
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/helpers/blit_commands_helper.h"
 #include "shared/source/helpers/completion_stamp.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/indirect_heap/indirect_heap.h"
 #include "shared/source/utilities/iflist.h"
 
 #include "opencl/source/helpers/properties_helper.h"
 
+#include <array>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 namespace NEO {
@@ -36,6 +39,22 @@ enum MapOperationType {
     UNMAP
 };
 
+// Recycles streams and heaps of blocked commands, their graphics allocations go back to internal allocation storage
+class KernelOperationResourcePool : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t maxPooledObjectsPerType = 64u;
+
+    LinearStream *obtainCommandStream();
+    IndirectHeap *obtainHeap(IndirectHeap::Type heapType);
+    void storeCommandStream(LinearStream *commandStream);
+    void storeHeap(IndirectHeap::Type heapType, IndirectHeap *heap);
+
+  protected:
+    std::mutex mtx;
+    std::vector<std::unique_ptr<LinearStream>> commandStreams;
+    std::array<std::vector<std::unique_ptr<IndirectHeap>>, IndirectHeap::Type::NUM_TYPES> heaps;
+};
+
 struct KernelOperation {
   protected:
     struct ResourceCleaner {
@@ -64,10 +83,17 @@ struct KernelOperation {
         this->ssh = IndirectHeapUniquePtrT(ssh, resourceCleaner);
     }
 
+    void setResourcePool(KernelOperationResourcePool *pool) {
+        this->resourcePool = pool;
+    }
+
     ~KernelOperation() {
         if (ioh.get() == dsh.get()) {
             ioh.release();
         }
+        if (resourcePool) {
+            recycleResources();
+        }
     }
 
     LinearStreamUniquePtrT commandStream{nullptr, resourceCleaner};
@@ -79,6 +105,11 @@ struct KernelOperation {
     BlitPropertiesContainer blitPropertiesContainer;
     bool blitEnqueue = false;
     size_t surfaceStateHeapSizeEM = 0;
+
+  protected:
+    void recycleResources();
+
+    KernelOperationResourcePool *resourcePool = nullptr;
 };
 
 class Command : public IFNode<Command> {
@@ -25,7 +25,9 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/hw_info_config.h"
+#include "shared/source/os_interface/os_context.h"
 #include "shared/source/program/kernel_info.h"
+#include "shared/source/utilities/performance_hints_log.h"
 
 #include "opencl/source/accelerators/intel_accelerator.h"
 #include "opencl/source/accelerators/intel_motion_estimation.h"
@@ -51,6 +53,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <vector>
 
 using namespace iOpenCL;
@@ -957,6 +960,9 @@ cl_int Kernel::setArgSvmAlloc(uint32_t argIndex, void *svmPtr, GraphicsAllocatio
 void Kernel::storeKernelArg(uint32_t argIndex, kernelArgType argType, void *argObject,
                             const void *argValue, size_t argSize,
                             GraphicsAllocation *argSvmAlloc, cl_mem_flags argSvmFlags) {
+    if (argObject != nullptr || kernelArguments[argIndex].object != nullptr) {
+        argsResidencyCacheValid = false;
+    }
     kernelArguments[argIndex].type = argType;
     kernelArguments[argIndex].object = argObject;
     kernelArguments[argIndex].value = argValue;
@@ -1095,41 +1101,73 @@ uint32_t Kernel::getMaxWorkGroupCount(const cl_uint workDim, const size_t *local
     return maxWorkGroupCount;
 }
 
-inline void Kernel::makeArgsResident(CommandStreamReceiver &commandStreamReceiver) {
+void Kernel::buildArgsResidencyCache(uint32_t rootDeviceIndex) {
+    argsResidencyCache.clear();
+    argsUnifiedMemoryResidencyCache.clear();
+    argsRequireSamplerCacheFlush = false;
+
     auto numArgs = kernelInfo.kernelDescriptor.payloadMappings.explicitArgs.size();
     for (decltype(numArgs) argIndex = 0; argIndex < numArgs; argIndex++) {
         if (kernelArguments[argIndex].object) {
             if (kernelArguments[argIndex].type == SVM_ALLOC_OBJ) {
                 auto pSVMAlloc = (GraphicsAllocation *)kernelArguments[argIndex].object;
-                auto pageFaultManager = executionEnvironment.memoryManager->getPageFaultManager();
-                if (pageFaultManager &&
-                    this->isUnifiedMemorySyncRequired) {
-                    pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(pSVMAlloc->getGpuAddress()));
-                }
-                commandStreamReceiver.makeResident(*pSVMAlloc);
+                argsUnifiedMemoryResidencyCache.push_back(pSVMAlloc);
+                argsResidencyCache.push_back(pSVMAlloc);
             } else if (Kernel::isMemObj(kernelArguments[argIndex].type)) {
                 auto clMem = const_cast<cl_mem>(static_cast<const _cl_mem *>(kernelArguments[argIndex].object));
                 auto memObj = castToObjectOrAbort<MemObj>(clMem);
                 auto image = castToObject<Image>(clMem);
                 if (image && image->isImageFromImage()) {
-                    commandStreamReceiver.setSamplerCacheFlushRequired(CommandStreamReceiver::SamplerCacheFlushState::samplerCacheFlushBefore);
+                    argsRequireSamplerCacheFlush = true;
                 }
-                commandStreamReceiver.makeResident(*memObj->getGraphicsAllocation(commandStreamReceiver.getRootDeviceIndex()));
+                argsResidencyCache.push_back(memObj->getGraphicsAllocation(rootDeviceIndex));
                 if (memObj->getMcsAllocation()) {
-                    commandStreamReceiver.makeResident(*memObj->getMcsAllocation());
+                    argsResidencyCache.push_back(memObj->getMcsAllocation());
                 }
             }
         }
     }
+
+    argsResidencyCacheRootDeviceIndex = rootDeviceIndex;
+    argsResidencyCacheValid = true;
+}
+
+inline void Kernel::makeArgsResident(CommandStreamReceiver &commandStreamReceiver) {
+    auto rootDeviceIndex = commandStreamReceiver.getRootDeviceIndex();
+    if (DebugManager.flags.EnableKernelArgsResidencyCache.get() == 0) {
+        argsResidencyCacheValid = false;
+    }
+    if (!argsResidencyCacheValid || argsResidencyCacheRootDeviceIndex != rootDeviceIndex) {
+        buildArgsResidencyCache(rootDeviceIndex);
+    }
+
+    auto pageFaultManager = executionEnvironment.memoryManager->getPageFaultManager();
+    if (pageFaultManager && this->isUnifiedMemorySyncRequired) {
+        for (auto gfxAlloc : argsUnifiedMemoryResidencyCache) {
+            pageFaultManager->moveAllocationToGpuDomain(reinterpret_cast<void *>(gfxAlloc->getGpuAddress()));
+        }
+    }
+    if (argsRequireSamplerCacheFlush) {
+        commandStreamReceiver.setSamplerCacheFlushRequired(CommandStreamReceiver::SamplerCacheFlushState::samplerCacheFlushBefore);
+    }
+    for (auto gfxAlloc : argsResidencyCache) {
+        commandStreamReceiver.makeResident(*gfxAlloc);
+    }
 }
 
 void Kernel::performKernelTuning(CommandStreamReceiver &commandStreamReceiver, const Vec3<size_t> &lws, const Vec3<size_t> &gws, const Vec3<size_t> &offsets, TimestampPacketContainer *timestampContainer) {
     auto performTunning = TunningType::DISABLED;
+    this->requestedPartitionTypeInCurrentEnqueue = -1;
 
     if (DebugManager.flags.EnableKernelTunning.get() != -1) {
         performTunning = static_cast<TunningType>(DebugManager.flags.EnableKernelTunning.get());
     }
 
+    if (performTunning == TunningType::FULL_WITH_PARTITIONING) {
+        performPartitionTuning(commandStreamReceiver, lws, gws, offsets, timestampContainer);
+        return;
+    }
+
     if (performTunning == TunningType::SIMPLE) {
         this->singleSubdevicePreferredInCurrentEnqueue = !this->kernelInfo.kernelDescriptor.kernelAttributes.flags.useGlobalAtomics;
 
@@ -1173,6 +1211,81 @@ void Kernel::performKernelTuning(CommandStreamReceiver &commandStreamReceiver, c
     }
 }
 
+void Kernel::performPartitionTuning(CommandStreamReceiver &commandStreamReceiver, const Vec3<size_t> &lws, const Vec3<size_t> &gws, const Vec3<size_t> &offsets, TimestampPacketContainer *timestampContainer) {
+    KernelConfig config{gws, lws, offsets};
+    auto &tuningData = this->partitionTuningMap[config];
+
+    if (tuningData.candidates.empty()) {
+        const auto tileCount = commandStreamReceiver.getOsContext().getDeviceBitfield().count();
+        const Vec3<size_t> groupCount = {Math::divideAndRoundUp(gws.x, std::max(lws.x, size_t{1u})),
+                                         Math::divideAndRoundUp(gws.y, std::max(lws.y, size_t{1u})),
+                                         Math::divideAndRoundUp(gws.z, std::max(lws.z, size_t{1u}))};
+        PartitionTuningCandidate defaultCandidate{};
+        tuningData.candidates.push_back(defaultCandidate);
+
+        if (tileCount < 2u) {
+            tuningData.done = true;
+        } else if (groupCount.x * groupCount.y * groupCount.z < tileCount) {
+            // not enough work groups to keep every tile busy, cross tile synchronization would only add latency
+            tuningData.bestCandidate.singleSubdevice = true;
+            tuningData.done = true;
+        } else {
+            // images require partitioning along X, only partition count can be tuned then
+            if (!this->usesImages()) {
+                const size_t groupCounts[] = {groupCount.x, groupCount.y, groupCount.z};
+                for (int32_t dimension = 0; dimension < 3; dimension++) {
+                    if (groupCounts[dimension] > 1u) {
+                        tuningData.candidates.push_back({false, dimension + 1});
+                    }
+                }
+            }
+            tuningData.candidates.push_back({true, -1});
+        }
+    }
+
+    if (!tuningData.done && tuningData.launches.size() >= tuningData.candidates.size()) {
+        this->hasPartitionTuningFinished(tuningData);
+    }
+
+    auto selectedCandidate = tuningData.bestCandidate;
+    if (!tuningData.done && tuningData.launches.size() < tuningData.candidates.size() && timestampContainer) {
+        auto candidateIndex = tuningData.launches.size();
+        auto timestamps = std::make_unique<TimestampPacketContainer>();
+        timestamps->assignAndIncrementNodesRefCounts(*timestampContainer);
+        tuningData.launches.emplace_back(candidateIndex, std::move(timestamps));
+        selectedCandidate = tuningData.candidates[candidateIndex];
+    }
+
+    this->singleSubdevicePreferredInCurrentEnqueue = selectedCandidate.singleSubdevice;
+    this->requestedPartitionTypeInCurrentEnqueue = selectedCandidate.partitionType;
+}
+
+bool Kernel::hasPartitionTuningFinished(PartitionTuningData &tuningData) {
+    for (auto &launch : tuningData.launches) {
+        if (!this->hasRunFinished(launch.second.get())) {
+            return false;
+        }
+    }
+
+    // boundary values span timestamps of all partitions, so imbalance between tiles is accounted for
+    std::vector<uint64_t> durations(tuningData.candidates.size(), std::numeric_limits<uint64_t>::max());
+    for (auto &launch : tuningData.launches) {
+        if (launch.second->peekNodes().empty()) {
+            continue;
+        }
+        uint64_t globalStartTS = 0u;
+        uint64_t globalEndTS = 0u;
+        Event::getBoundaryTimestampValues(launch.second.get(), globalStartTS, globalEndTS);
+        durations[launch.first] = globalEndTS - globalStartTS;
+    }
+
+    auto bestCandidate = std::min_element(durations.begin(), durations.end()) - durations.begin();
+    tuningData.bestCandidate = tuningData.candidates[bestCandidate];
+    tuningData.launches.clear();
+    tuningData.done = true;
+    return true;
+}
+
 bool Kernel::hasTunningFinished(KernelSubmissionData &submissionData) {
     if (!this->hasRunFinished(submissionData.kernelStandardTimestamps.get()) ||
         !this->hasRunFinished(submissionData.kernelSubdeviceTimestamps.get())) {
@@ -1193,12 +1306,97 @@ bool Kernel::hasTunningFinished(KernelSubmissionData &submissionData) {
     return true;
 }
 
+bool Kernel::getTunedLocalWorkSize(ClDevice &device, const Vec3<size_t> &gws, uint32_t workDim, size_t workGroupSize[3]) {
+    auto tuningLaunches = getLocalWorkSizeTuningLaunches();
+    pendingLocalWorkSizeTuningLaunch = nullptr;
+    if (tuningLaunches == 0u) {
+        return false;
+    }
+
+    KernelConfig config{gws, {0, 0, 0}, {0, 0, 0}};
+    auto &tuningData = this->localWorkSizeTuningMap[config];
+
+    if (tuningData.candidates.empty()) {
+        DispatchInfo dispatchInfo(&device, this, workDim, gws, Vec3<size_t>{0, 0, 0}, Vec3<size_t>{0, 0, 0});
+        auto heuristicLws = computeWorkgroupSize(dispatchInfo);
+        size_t heuristicWorkGroupSize[3] = {heuristicLws.x, heuristicLws.y, heuristicLws.z};
+        size_t globalSize[3] = {gws.x, gws.y, gws.z};
+        size_t profiledWorkGroupSize[3] = {};
+
+        auto profile = WorkGroupSizeProfile::get();
+        if (profile && profile->find(kernelInfo.kernelDescriptor.kernelMetadata.kernelName, globalSize, getMaxKernelWorkGroupSize(), profiledWorkGroupSize)) {
+            tuningData.candidates.push_back(heuristicLws);
+            tuningData.bestWorkGroupSize = heuristicLws;
+            tuningData.done = true;
+        } else {
+            generateWorkGroupSizeCandidates(tuningData.candidates, globalSize, workDim, heuristicWorkGroupSize,
+                                            kernelInfo.getMaxSimdSize(), getMaxKernelWorkGroupSize(), tuningLaunches);
+        }
+    }
+
+    if (!tuningData.done && tuningData.launches.size() >= tuningLaunches && this->hasLocalWorkSizeTuningFinished(tuningData)) {
+        size_t globalSize[3] = {gws.x, gws.y, gws.z};
+        size_t bestWorkGroupSize[3] = {tuningData.bestWorkGroupSize.x, tuningData.bestWorkGroupSize.y, tuningData.bestWorkGroupSize.z};
+        WorkGroupSizeProfile::storeTuningResult(kernelInfo.kernelDescriptor.kernelMetadata.kernelName, globalSize, bestWorkGroupSize);
+    }
+
+    Vec3<size_t> selectedWorkGroupSize = tuningData.bestWorkGroupSize;
+    if (!tuningData.done) {
+        if (tuningData.launches.size() >= tuningLaunches) {
+            return false;
+        }
+        pendingLocalWorkSizeTuningLaunch = &tuningData;
+        pendingLocalWorkSizeCandidate = tuningData.launches.size() % tuningData.candidates.size();
+        selectedWorkGroupSize = tuningData.candidates[pendingLocalWorkSizeCandidate];
+    }
+
+    workGroupSize[0] = selectedWorkGroupSize.x;
+    workGroupSize[1] = selectedWorkGroupSize.y;
+    workGroupSize[2] = selectedWorkGroupSize.z;
+    return true;
+}
+
+void Kernel::storeLocalWorkSizeTuningTimestamps(TimestampPacketContainer *timestampContainer) {
+    if (pendingLocalWorkSizeTuningLaunch == nullptr) {
+        return;
+    }
+    auto timestamps = std::make_unique<TimestampPacketContainer>();
+    if (timestampContainer) {
+        timestamps->assignAndIncrementNodesRefCounts(*timestampContainer);
+    }
+    pendingLocalWorkSizeTuningLaunch->launches.emplace_back(pendingLocalWorkSizeCandidate, std::move(timestamps));
+    pendingLocalWorkSizeTuningLaunch = nullptr;
+}
+
+bool Kernel::hasLocalWorkSizeTuningFinished(LocalWorkSizeTuningData &tuningData) {
+    for (auto &launch : tuningData.launches) {
+        if (!this->hasRunFinished(launch.second.get())) {
+            return false;
+        }
+    }
+
+    std::vector<uint64_t> bestDurations(tuningData.candidates.size(), std::numeric_limits<uint64_t>::max());
+    for (auto &launch : tuningData.launches) {
+        if (launch.second->peekNodes().empty()) {
+            continue;
+        }
+        uint64_t globalStartTS = 0u;
+        uint64_t globalEndTS = 0u;
+        Event::getBoundaryTimestampValues(launch.second.get(), globalStartTS, globalEndTS);
+        bestDurations[launch.first] = std::min(bestDurations[launch.first], globalEndTS - globalStartTS);
+    }
+
+    auto bestCandidate = std::min_element(bestDurations.begin(), bestDurations.end()) - bestDurations.begin();
+    tuningData.bestWorkGroupSize = tuningData.candidates[bestCandidate];
+    tuningData.launches.clear();
+    tuningData.done = true;
+    return true;
+}
+
 bool Kernel::hasRunFinished(TimestampPacketContainer *timestampContainer) {
     for (const auto &node : timestampContainer->peekNodes()) {
-        for (uint32_t i = 0; i < node->getPacketsUsed(); i++) {
-            if (node->getContextEndValue(i) == 1) {
-                return false;
-            }
+        if (!node->isCompleted()) {
+            return false;
         }
     }
     return true;
@@ -1254,7 +1452,17 @@ void Kernel::makeResident(CommandStreamReceiver &commandStreamReceiver) {
     if (unifiedMemoryControls.indirectDeviceAllocationsAllowed ||
         unifiedMemoryControls.indirectHostAllocationsAllowed ||
         unifiedMemoryControls.indirectSharedAllocationsAllowed) {
-        this->getContext().getSVMAllocsManager()->makeInternalAllocationsResident(commandStreamReceiver, unifiedMemoryControls.generateMask());
+        auto svmAllocsManager = this->getContext().getSVMAllocsManager();
+        auto submitAsPack = program->peekExecutionEnvironment().memoryManager->allowIndirectAllocationsAsPack(commandStreamReceiver.getRootDeviceIndex());
+        if (DebugManager.flags.MakeIndirectAllocationsResidentAsPack.get() != -1) {
+            submitAsPack = !!DebugManager.flags.MakeIndirectAllocationsResidentAsPack.get();
+        }
+
+        if (submitAsPack) {
+            svmAllocsManager->makeIndirectAllocationsResident(commandStreamReceiver, commandStreamReceiver.peekTaskCount() + 1u);
+        } else {
+            svmAllocsManager->makeInternalAllocationsResident(commandStreamReceiver, unifiedMemoryControls.generateMask());
+        }
     }
 }
 
@@ -1877,6 +2085,7 @@ std::unique_ptr<KernelObjsForAuxTranslation> Kernel::fillWithKernelObjsForAuxTra
             auto buffer = castToObject<Buffer>(getKernelArg(i));
             if (buffer && buffer->getMultiGraphicsAllocation().getDefaultGraphicsAllocation()->isCompressionEnabled()) {
                 kernelObjsForAuxTranslation->insert({KernelObjForAuxTranslation::Type::MEM_OBJ, buffer});
+                PERFORMANCE_HINT(PerformanceHintId::AuxTranslation, i, buffer->getSize());
                 auto &context = this->program->getContext();
                 if (context.isProvidingPerformanceHints()) {
                     const auto &argExtMeta = kernelInfo.kernelDescriptor.explicitArgsExtendedMetadata[i];
@@ -1889,6 +2098,7 @@ std::unique_ptr<KernelObjsForAuxTranslation> Kernel::fillWithKernelObjsForAuxTra
             auto svmAlloc = reinterpret_cast<GraphicsAllocation *>(const_cast<void *>(getKernelArg(i)));
             if (svmAlloc && svmAlloc->isCompressionEnabled()) {
                 kernelObjsForAuxTranslation->insert({KernelObjForAuxTranslation::Type::GFX_ALLOC, svmAlloc});
+                PERFORMANCE_HINT(PerformanceHintId::AuxTranslation, i, svmAlloc->getUnderlyingBufferSize());
                 auto &context = this->program->getContext();
                 if (context.isProvidingPerformanceHints()) {
                     const auto &argExtMeta = kernelInfo.kernelDescriptor.explicitArgsExtendedMetadata[i];
@@ -2277,4 +2487,10 @@ int32_t Kernel::setOverdispatchParam(size_t paramValueSize, const void *paramVal
     return CL_SUCCESS;
 }
 
+// Application guarantees that buffers are accessed only statefully, compressed buffers don't need aux translation
+int32_t Kernel::setStatefulAccessOnlyHint(size_t paramValueSize, const void *paramValue) {
+    statefulAccessOnlyHint = *static_cast<const cl_bool *>(paramValue) == CL_TRUE;
+    return CL_SUCCESS;
+}
+
 } // namespace NEO
@@ -12,8 +12,10 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/address_patch.h"
+#include "shared/source/helpers/per_thread_data.h"
 #include "shared/source/helpers/preamble.h"
 #include "shared/source/helpers/timestamp_packet.h"
+#include "shared/source/helpers/work_group_size_cache.h"
 #include "shared/source/kernel/implicit_args.h"
 #include "shared/source/kernel/kernel_execution_type.h"
 #include "shared/source/program/kernel_info.h"
@@ -81,7 +83,8 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     enum class TunningType {
         DISABLED,
         SIMPLE,
-        FULL
+        FULL,
+        FULL_WITH_PARTITIONING
     };
 
     typedef int32_t (Kernel::*KernelArgHandler)(uint32_t argIndex,
@@ -123,7 +126,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
         return kernelArg == BUFFER_OBJ || kernelArg == IMAGE_OBJ || kernelArg == PIPE_OBJ;
     }
 
-    bool isAuxTranslationRequired() const { return auxTranslationRequired; }
+    bool isAuxTranslationRequired() const { return auxTranslationRequired && !statefulAccessOnlyHint; }
     void setAuxTranslationRequired(bool onOff) { auxTranslationRequired = onOff; }
     void updateAuxTranslationRequired();
 
@@ -286,7 +289,10 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     bool requiresSystolicPipelineSelectMode() const { return systolicPipelineSelectMode; }
 
     void performKernelTuning(CommandStreamReceiver &commandStreamReceiver, const Vec3<size_t> &lws, const Vec3<size_t> &gws, const Vec3<size_t> &offsets, TimestampPacketContainer *timestampContainer);
+    bool getTunedLocalWorkSize(ClDevice &device, const Vec3<size_t> &gws, uint32_t workDim, size_t workGroupSize[3]);
+    void storeLocalWorkSizeTuningTimestamps(TimestampPacketContainer *timestampContainer);
     MOCKABLE_VIRTUAL bool isSingleSubdevicePreferred() const;
+    int32_t getRequestedWalkerPartitionType() const { return requestedPartitionTypeInCurrentEnqueue; }
 
     // residency for kernel surfaces
     MOCKABLE_VIRTUAL void makeResident(CommandStreamReceiver &commandStreamReceiver);
@@ -356,6 +362,7 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
 
     bool isKernelDebugEnabled() const { return debugEnabled; }
     int32_t setOverdispatchParam(size_t paramValueSize, const void *paramValue);
+    int32_t setStatefulAccessOnlyHint(size_t paramValueSize, const void *paramValue);
     void setAdditionalKernelExecInfo(uint32_t additionalKernelExecInfo);
     uint32_t getAdditionalKernelExecInfo() const;
     MOCKABLE_VIRTUAL bool requiresWaDisableRccRhwoOptimization() const;
@@ -408,6 +415,8 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     bool getDestinationAllocationInSystemMemory() const {
         return isDestinationAllocationInSystemMemory;
     }
+    WorkGroupSizeCache &getWorkGroupSizeCache() { return workGroupSizeCache; }
+    PerThreadDataCache &getPerThreadDataCache() { return perThreadDataCache; }
 
   protected:
     struct KernelConfig {
@@ -444,10 +453,27 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
         TunningStatus status;
         bool singleSubdevicePreferred = false;
     };
+    struct PartitionTuningCandidate {
+        bool singleSubdevice = false;
+        int32_t partitionType = -1;
+    };
+    struct PartitionTuningData {
+        std::vector<PartitionTuningCandidate> candidates;
+        std::vector<std::pair<size_t, std::unique_ptr<TimestampPacketContainer>>> launches;
+        PartitionTuningCandidate bestCandidate{};
+        bool done = false;
+    };
+    struct LocalWorkSizeTuningData {
+        std::vector<Vec3<size_t>> candidates;
+        std::vector<std::pair<size_t, std::unique_ptr<TimestampPacketContainer>>> launches;
+        Vec3<size_t> bestWorkGroupSize{0, 0, 0};
+        bool done = false;
+    };
 
     Kernel(Program *programArg, const KernelInfo &kernelInfo, ClDevice &clDevice);
 
     void makeArgsResident(CommandStreamReceiver &commandStreamReceiver);
+    void buildArgsResidencyCache(uint32_t rootDeviceIndex);
 
     void *patchBufferOffset(const ArgDescPointer &argAsPtr, void *svmPtr, GraphicsAllocation *svmAlloc);
 
@@ -473,12 +499,19 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
 
     bool hasTunningFinished(KernelSubmissionData &submissionData);
     bool hasRunFinished(TimestampPacketContainer *timestampContainer);
+    bool hasLocalWorkSizeTuningFinished(LocalWorkSizeTuningData &tuningData);
+    void performPartitionTuning(CommandStreamReceiver &commandStreamReceiver, const Vec3<size_t> &lws, const Vec3<size_t> &gws, const Vec3<size_t> &offsets, TimestampPacketContainer *timestampContainer);
+    bool hasPartitionTuningFinished(PartitionTuningData &tuningData);
 
     UnifiedMemoryControls unifiedMemoryControls{};
 
     std::map<uint32_t, MemObj *> migratableArgsMap{};
 
     std::unordered_map<KernelConfig, KernelSubmissionData, KernelConfigHash> kernelSubmissionMap;
+    std::unordered_map<KernelConfig, LocalWorkSizeTuningData, KernelConfigHash> localWorkSizeTuningMap;
+    std::unordered_map<KernelConfig, PartitionTuningData, KernelConfigHash> partitionTuningMap;
+    LocalWorkSizeTuningData *pendingLocalWorkSizeTuningLaunch = nullptr;
+    size_t pendingLocalWorkSizeCandidate = 0u;
 
     std::vector<SimpleKernelArgInfo> kernelArguments;
     std::vector<KernelArgHandler> kernelArgHandlers;
@@ -486,6 +519,8 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     std::vector<GraphicsAllocation *> kernelUnifiedMemoryGfxAllocations;
     std::vector<PatchInfoData> patchInfoDataList;
     std::vector<GraphicsAllocation *> kernelArgRequiresCacheFlush;
+    std::vector<GraphicsAllocation *> argsResidencyCache;
+    std::vector<GraphicsAllocation *> argsUnifiedMemoryResidencyCache;
     std::vector<size_t> slmSizes;
 
     std::unique_ptr<ImageTransformer> imageTransformer;
@@ -510,6 +545,9 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     uint32_t *preferredWkgMultipleOffset = &Kernel::dummyPatchLocation;
     char *crossThreadData = nullptr;
 
+    WorkGroupSizeCache workGroupSizeCache;
+    PerThreadDataCache perThreadDataCache;
+
     AuxTranslationDirection auxTranslationDirection = AuxTranslationDirection::None;
     KernelExecutionType executionType = KernelExecutionType::Default;
 
@@ -521,17 +559,22 @@ class Kernel : public ReferenceTrackedObject<Kernel> {
     uint32_t slmTotalSize = 0u;
     uint32_t sshLocalSize = 0u;
     uint32_t crossThreadDataSize = 0u;
+    uint32_t argsResidencyCacheRootDeviceIndex = 0u;
 
     bool containsStatelessWrites = true;
     bool usingSharedObjArgs = false;
     bool usingImages = false;
     bool usingImagesOnly = false;
     bool auxTranslationRequired = false;
+    bool statefulAccessOnlyHint = false;
     bool systolicPipelineSelectMode = false;
+    bool argsResidencyCacheValid = false;
+    bool argsRequireSamplerCacheFlush = false;
     bool svmAllocationsRequireCacheFlush = false;
     bool isUnifiedMemorySyncRequired = true;
     bool debugEnabled = false;
     bool singleSubdevicePreferredInCurrentEnqueue = false;
+    int32_t requestedPartitionTypeInCurrentEnqueue = -1;
     bool kernelHasIndirectAccess = true;
     bool anyKernelArgumentUsingSystemMemory = false;
     bool isDestinationAllocationInSystemMemory = false;
@@ -76,7 +76,7 @@ Buffer::Buffer() : MemObj(nullptr, CL_MEM_OBJECT_BUFFER, {}, 0, 0, 0, nullptr, n
 Buffer::~Buffer() = default;
 
 bool Buffer::isSubBuffer() {
-    return this->associatedMemObject != nullptr;
+    return this->associatedMemObject != nullptr && !this->isParentObjectPool;
 }
 
 bool Buffer::isValidSubBufferOffset(size_t offset) {
@@ -185,6 +185,15 @@ Buffer *Buffer::create(Context *context,
 
     errcodeRet = CL_SUCCESS;
 
+    auto &bufferPoolAllocator = context->getBufferPoolAllocator();
+    if (bufferPoolAllocator.isAggregatedSmallBuffersEnabled()) {
+        auto pooledBuffer = bufferPoolAllocator.allocateBufferFromPool(memoryProperties, flags, flagsIntel, size, hostPtr, errcodeRet);
+        if (pooledBuffer) {
+            return pooledBuffer;
+        }
+        errcodeRet = CL_SUCCESS;
+    }
+
     MemoryManager *memoryManager = context->getMemoryManager();
     UNRECOVERABLE_IF(!memoryManager);
 
@@ -567,7 +576,7 @@ Buffer *Buffer::createSubBuffer(cl_mem_flags flags,
     }
 
     buffer->associatedMemObject = this;
-    buffer->offset = region->origin;
+    buffer->offset = this->offset + region->origin;
     buffer->setParentSharingHandler(this->getSharingHandler());
     this->incRefInternal();
 
@@ -670,6 +679,30 @@ bool Buffer::isReadWriteOnCpuAllowed(const Device &device) {
     return true;
 }
 
+bool Buffer::isPersistentMappingAllowed(const Device &device) const {
+    if (DebugManager.flags.EnablePersistentMapForLocalMemoryBuffers.get() != 1) {
+        return false;
+    }
+    if (isValueSet(flags, CL_MEM_USE_HOST_PTR) || peekSharingHandler() || (context && context->getRootDeviceIndices().size() > 1)) {
+        return false;
+    }
+
+    auto rootDeviceIndex = device.getRootDeviceIndex();
+    if (isCompressed(rootDeviceIndex)) {
+        return false;
+    }
+
+    auto graphicsAllocation = multiGraphicsAllocation.getGraphicsAllocation(rootDeviceIndex);
+    return graphicsAllocation->isAllocatedInLocalMemoryPool() &&
+           graphicsAllocation->isAllocationLockable() &&
+           (graphicsAllocation->peekSharedHandle() == 0);
+}
+
+void *Buffer::getPersistentMappingPtr(uint32_t rootDeviceIndex) {
+    // allocation stays locked until it is freed, subsequent maps reuse the same pointer
+    return memoryManager->lockResource(multiGraphicsAllocation.getGraphicsAllocation(rootDeviceIndex));
+}
+
 bool Buffer::isReadWriteOnCpuPreferred(void *ptr, size_t size, const Device &device) {
     auto graphicsAllocation = multiGraphicsAllocation.getGraphicsAllocation(device.getRootDeviceIndex());
     if (MemoryPoolHelper::isSystemMemoryPool(graphicsAllocation->getMemoryPool())) {
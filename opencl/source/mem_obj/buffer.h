@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/constants.h"
+#include "shared/source/utilities/stackvec.h"
 
 #include "opencl/extensions/public/cl_ext_private.h"
 #include "opencl/source/context/context_type.h"
@@ -18,6 +19,7 @@
 #include "memory_properties_flags.h"
 
 #include <functional>
+#include <mutex>
 
 namespace NEO {
 class Buffer;
@@ -157,6 +159,8 @@ class Buffer : public MemObj {
 
     bool isReadWriteOnCpuAllowed(const Device &device);
     bool isReadWriteOnCpuPreferred(void *ptr, size_t size, const Device &device);
+    bool isPersistentMappingAllowed(const Device &device) const;
+    void *getPersistentMappingPtr(uint32_t rootDeviceIndex);
 
     uint32_t getMocsValue(bool disableL3Cache, bool isReadOnlyArgument, uint32_t rootDeviceIndex) const;
     uint32_t getSurfaceSize(bool alignSizeForAuxTranslation, uint32_t rootDeviceIndex) const;
@@ -247,6 +251,30 @@ class BufferHw : public Buffer {
 
     typedef typename GfxFamily::RENDER_SURFACE_STATE SURFACE_STATE;
     typename SURFACE_STATE::SURFACE_TYPE surfaceType;
+
+  protected:
+    struct SurfaceStateCacheEntry {
+        SURFACE_STATE inputState;
+        SURFACE_STATE encodedState;
+        const Device *device;
+        const GraphicsAllocation *allocation;
+        uint64_t graphicsAddress;
+        size_t surfaceSize;
+        bool compressionEnabled;
+        bool isDebuggerActive;
+        bool forceNonAuxMode;
+        bool disableL3;
+        bool alignSizeForAuxTranslation;
+        bool isReadOnlyArgument;
+        bool useGlobalAtomics;
+        bool areMultipleSubDevicesInContext;
+    };
+    static constexpr size_t maxSurfaceStateCacheEntries = 4u;
+
+    // encoded surface states of this (sub-)buffer, reused when setArgStateful is called again with identical inputs
+    StackVec<SurfaceStateCacheEntry, maxSurfaceStateCacheEntries> surfaceStateCache;
+    size_t surfaceStateCacheNextEvicted = 0u;
+    std::mutex surfaceStateCacheMtx;
 };
 
 } // namespace NEO
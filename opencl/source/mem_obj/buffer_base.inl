@@ -7,9 +7,11 @@
 
 #include "shared/source/command_container/command_encoder.h"
 #include "shared/source/command_container/implicit_scaling.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/bit_helpers.h"
 #include "shared/source/helpers/populate_factory.h"
+#include "shared/source/helpers/string.h"
 
 #include "opencl/source/mem_obj/buffer.h"
 
@@ -31,11 +33,45 @@ void BufferHw<GfxFamily>::setArgStateful(void *memory, bool forceNonAuxMode, boo
     auto graphicsAllocation = multiGraphicsAllocation.getGraphicsAllocation(rootDeviceIndex);
     const auto isReadOnly = isValueSet(getFlags(), CL_MEM_READ_ONLY) || isReadOnlyArgument;
     auto isDebuggerActive = device.isDebuggerActive() || device.getDebugger() != nullptr;
+    auto graphicsAddress = getBufferAddress(rootDeviceIndex);
+    auto surfaceSize = getSurfaceSize(alignSizeForAuxTranslation, rootDeviceIndex);
+    auto compressionEnabled = graphicsAllocation ? graphicsAllocation->isCompressionEnabled() : false;
+
+    const bool surfaceStateCacheEnabled = DebugManager.flags.EnableBufferSurfaceStateCache.get() != 0;
+    auto surfaceState = reinterpret_cast<SURFACE_STATE *>(memory);
+    auto matchesCacheEntry = [&](const SurfaceStateCacheEntry &entry) {
+        return entry.device == &device &&
+               entry.allocation == graphicsAllocation &&
+               entry.graphicsAddress == graphicsAddress &&
+               entry.surfaceSize == surfaceSize &&
+               entry.compressionEnabled == compressionEnabled &&
+               entry.isDebuggerActive == isDebuggerActive &&
+               entry.forceNonAuxMode == forceNonAuxMode &&
+               entry.disableL3 == disableL3 &&
+               entry.alignSizeForAuxTranslation == alignSizeForAuxTranslation &&
+               entry.isReadOnlyArgument == isReadOnlyArgument &&
+               entry.useGlobalAtomics == useGlobalAtomics &&
+               entry.areMultipleSubDevicesInContext == areMultipleSubDevicesInContext &&
+               memcmp(&entry.inputState, surfaceState, sizeof(SURFACE_STATE)) == 0;
+    };
+
+    SurfaceStateCacheEntry newEntry;
+    if (surfaceStateCacheEnabled) {
+        std::lock_guard<std::mutex> lock(surfaceStateCacheMtx);
+        for (const auto &entry : surfaceStateCache) {
+            if (matchesCacheEntry(entry)) {
+                memcpy_s(surfaceState, sizeof(SURFACE_STATE), &entry.encodedState, sizeof(SURFACE_STATE));
+                return;
+            }
+        }
+        // encoding modifies the surface state in place, so the initial state is a part of the key
+        memcpy_s(&newEntry.inputState, sizeof(SURFACE_STATE), surfaceState, sizeof(SURFACE_STATE));
+    }
 
     NEO::EncodeSurfaceStateArgs args;
     args.outMemory = memory;
-    args.graphicsAddress = getBufferAddress(rootDeviceIndex);
-    args.size = getSurfaceSize(alignSizeForAuxTranslation, rootDeviceIndex);
+    args.graphicsAddress = graphicsAddress;
+    args.size = surfaceSize;
     args.mocs = getMocsValue(disableL3, isReadOnly, rootDeviceIndex);
     args.cpuCoherent = true;
     args.forceNonAuxMode = forceNonAuxMode;
@@ -49,5 +85,29 @@ void BufferHw<GfxFamily>::setArgStateful(void *memory, bool forceNonAuxMode, boo
     args.isDebuggerActive = isDebuggerActive;
     appendSurfaceStateArgs(args);
     EncodeSurfaceState<GfxFamily>::encodeBuffer(args);
+
+    if (surfaceStateCacheEnabled) {
+        memcpy_s(&newEntry.encodedState, sizeof(SURFACE_STATE), surfaceState, sizeof(SURFACE_STATE));
+        newEntry.device = &device;
+        newEntry.allocation = graphicsAllocation;
+        newEntry.graphicsAddress = graphicsAddress;
+        newEntry.surfaceSize = surfaceSize;
+        newEntry.compressionEnabled = compressionEnabled;
+        newEntry.isDebuggerActive = isDebuggerActive;
+        newEntry.forceNonAuxMode = forceNonAuxMode;
+        newEntry.disableL3 = disableL3;
+        newEntry.alignSizeForAuxTranslation = alignSizeForAuxTranslation;
+        newEntry.isReadOnlyArgument = isReadOnlyArgument;
+        newEntry.useGlobalAtomics = useGlobalAtomics;
+        newEntry.areMultipleSubDevicesInContext = areMultipleSubDevicesInContext;
+
+        std::lock_guard<std::mutex> lock(surfaceStateCacheMtx);
+        if (surfaceStateCache.size() < maxSurfaceStateCacheEntries) {
+            surfaceStateCache.push_back(newEntry);
+        } else {
+            surfaceStateCache[surfaceStateCacheNextEvicted] = newEntry;
+            surfaceStateCacheNextEvicted = (surfaceStateCacheNextEvicted + 1) % maxSurfaceStateCacheEntries;
+        }
+    }
 }
 } // namespace NEO
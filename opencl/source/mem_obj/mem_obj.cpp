@@ -103,6 +103,9 @@ MemObj::~MemObj() {
             }
         }
         if (associatedMemObject) {
+            if (isParentObjectPool) {
+                context->getBufferPoolAllocator().tryFreeFromPoolBuffer(associatedMemObject, offset);
+            }
             associatedMemObject->decRefInternal();
         }
         if (!associatedMemObject) {
@@ -125,7 +128,8 @@ cl_int MemObj::getMemObjectInfo(cl_mem_info paramName,
     cl_bool usesSVMPointer;
     cl_uint refCnt = 0;
     cl_uint mapCount = 0;
-    cl_mem clAssociatedMemObject = static_cast<cl_mem>(this->associatedMemObject);
+    cl_mem clAssociatedMemObject = isParentObjectPool ? nullptr : static_cast<cl_mem>(this->associatedMemObject);
+    size_t offsetToReport = isParentObjectPool ? 0u : offset;
     cl_context ctx = nullptr;
     uint64_t internalHandle = 0llu;
     auto allocation = getMultiGraphicsAllocation().getDefaultGraphicsAllocation();
@@ -165,8 +169,8 @@ cl_int MemObj::getMemObjectInfo(cl_mem_info paramName,
         break;
 
     case CL_MEM_OFFSET:
-        srcParamSize = sizeof(offset);
-        srcParam = &offset;
+        srcParamSize = sizeof(offsetToReport);
+        srcParam = &offsetToReport;
         break;
 
     case CL_MEM_ASSOCIATED_MEMOBJECT:
@@ -124,6 +124,7 @@ class MemObj : public BaseObject<_cl_mem> {
     void setSharingHandler(SharingHandler *sharingHandler) { this->sharingHandler.reset(sharingHandler); }
     void setParentSharingHandler(std::shared_ptr<SharingHandler> &handler) { sharingHandler = handler; }
     unsigned int acquireCount = 0;
+    bool isParentObjectPool = false;
     Context *getContext() const { return context; }
 
     void destroyGraphicsAllocation(GraphicsAllocation *allocation, bool asyncDestroy);
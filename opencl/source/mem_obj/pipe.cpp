@@ -30,7 +30,7 @@ Pipe::Pipe(Context *context,
              ClMemoryPropertiesHelper::createMemoryProperties(flags, 0, 0, &context->getDevice(0)->getDevice()),
              flags,
              0,
-             static_cast<size_t>(packetSize * (maxPackets + 1) + intelPipeHeaderReservedSpace),
+             getPipeSurfaceSize(packetSize, maxPackets),
              memoryStorage,
              nullptr,
              std::move(multiGraphicsAllocation),
@@ -42,6 +42,11 @@ Pipe::Pipe(Context *context,
     magic = objectMagic;
 }
 
+// Ring of maxPackets + 1 packets follows the header, computed in 64 bits to not wrap for large pipes
+size_t Pipe::getPipeSurfaceSize(cl_uint packetSize, cl_uint maxPackets) {
+    return static_cast<size_t>(static_cast<uint64_t>(packetSize) * (static_cast<uint64_t>(maxPackets) + 1) + intelPipeHeaderReservedSpace);
+}
+
 Pipe *Pipe::create(Context *context,
                    cl_mem_flags flags,
                    cl_uint packetSize,
@@ -57,7 +62,7 @@ Pipe *Pipe::create(Context *context,
     MemoryProperties memoryProperties =
         ClMemoryPropertiesHelper::createMemoryProperties(flags, 0, 0, &context->getDevice(0)->getDevice());
     while (true) {
-        auto size = static_cast<size_t>(packetSize * (maxPackets + 1) + intelPipeHeaderReservedSpace);
+        auto size = getPipeSurfaceSize(packetSize, maxPackets);
         auto rootDeviceIndex = context->getDevice(0)->getRootDeviceIndex();
         AllocationProperties allocProperties =
             MemoryPropertiesHelper::getAllocationProperties(rootDeviceIndex, memoryProperties,
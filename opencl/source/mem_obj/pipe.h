@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,7 @@ class Pipe : public MemObj {
         cl_uint maxPackets,
         const cl_pipe_properties *properties,
         cl_int &errcodeRet);
+    static size_t getPipeSurfaceSize(cl_uint packetSize, cl_uint maxPackets);
 
     ~Pipe() override;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -16,16 +16,28 @@ void PageFaultManager::transferToCpu(void *ptr, size_t size, void *cmdQ) {
     auto commandQueue = static_cast<CommandQueue *>(cmdQ);
     auto retVal = commandQueue->enqueueSVMMap(true, CL_MAP_WRITE, ptr, size, 0, nullptr, nullptr, false);
     UNRECOVERABLE_IF(retVal);
+
+    // map operation is recreated on transfer to gpu, which may cover range different than this map
+    auto alloc = findMemoryData(ptr);
+    UNRECOVERABLE_IF(alloc == memoryData.end());
+    auto unifiedMemoryManager = alloc->second.unifiedMemoryManager;
+    if (unifiedMemoryManager->getSvmMapOperation(ptr)) {
+        unifiedMemoryManager->removeSvmMapOperation(ptr);
+    }
 }
-void PageFaultManager::transferToGpu(void *ptr, void *cmdQ) {
+void PageFaultManager::transferToGpu(void *ptr, size_t size, void *cmdQ) {
     auto commandQueue = static_cast<CommandQueue *>(cmdQ);
-    memoryData[ptr].unifiedMemoryManager->insertSvmMapOperation(ptr, memoryData[ptr].size, ptr, 0, false);
+    auto alloc = findMemoryData(ptr);
+    UNRECOVERABLE_IF(alloc == memoryData.end());
+    auto basePtr = alloc->first;
+    auto unifiedMemoryManager = alloc->second.unifiedMemoryManager;
+    unifiedMemoryManager->insertSvmMapOperation(ptr, size, basePtr, ptrDiff(ptr, basePtr), false);
     auto retVal = commandQueue->enqueueSVMUnmap(ptr, 0, nullptr, nullptr, false);
     UNRECOVERABLE_IF(retVal);
     retVal = commandQueue->finish();
     UNRECOVERABLE_IF(retVal);
 
-    auto allocData = memoryData[ptr].unifiedMemoryManager->getSVMAlloc(ptr);
+    auto allocData = unifiedMemoryManager->getSVMAlloc(ptr);
     this->evictMemoryAfterImplCopy(allocData->cpuAllocation, &commandQueue->getDevice());
 }
 } // namespace NEO
@@ -8,11 +8,15 @@
 #include "opencl/source/memory_manager/migration_controller.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/hw_info.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/migration_sync_data.h"
 
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/context/context.h"
+#include "opencl/source/helpers/cl_memory_properties_helpers.h"
+#include "opencl/source/mem_obj/buffer.h"
 #include "opencl/source/mem_obj/image.h"
 #include "opencl/source/mem_obj/mem_obj.h"
 
@@ -25,12 +29,13 @@ void MigrationController::handleMigration(Context &context, CommandStreamReceive
         migrationSyncData->waitOnCpu();
     }
     if (migrationSyncData->getCurrentLocation() != targetRootDeviceIndex) {
-        migrateMemory(context, *memoryManager, memObj, targetRootDeviceIndex);
+        migrateMemory(context, *memoryManager, memObj, targetCsr);
     }
     migrationSyncData->signalUsage(targetCsr.getTagAddress(), targetCsr.peekTaskCount() + 1);
 }
 
-void MigrationController::migrateMemory(Context &context, MemoryManager &memoryManager, MemObj *memObj, uint32_t targetRootDeviceIndex) {
+void MigrationController::migrateMemory(Context &context, MemoryManager &memoryManager, MemObj *memObj, CommandStreamReceiver &targetCsr) {
+    auto targetRootDeviceIndex = targetCsr.getRootDeviceIndex();
     auto &multiGraphicsAllocation = memObj->getMultiGraphicsAllocation();
     auto migrationSyncData = multiGraphicsAllocation.getMigrationSyncData();
 
@@ -42,6 +47,11 @@ void MigrationController::migrateMemory(Context &context, MemoryManager &memoryM
 
     migrationSyncData->startMigration();
 
+    if (migrateMemoryPeerToPeer(context, memoryManager, memObj, targetCsr)) {
+        migrationSyncData->setCurrentLocation(targetRootDeviceIndex);
+        return;
+    }
+
     auto srcMemory = multiGraphicsAllocation.getGraphicsAllocation(sourceRootDeviceIndex);
     auto dstMemory = multiGraphicsAllocation.getGraphicsAllocation(targetRootDeviceIndex);
 
@@ -91,4 +101,54 @@ void MigrationController::migrateMemory(Context &context, MemoryManager &memoryM
     }
     migrationSyncData->setCurrentLocation(targetRootDeviceIndex);
 }
+
+// Source allocation is imported on target root device and copied there directly, without staging in host memory.
+// The copy is not waited for when it is submitted to target csr, following usage of the buffer is ordered after it.
+bool MigrationController::migrateMemoryPeerToPeer(Context &context, MemoryManager &memoryManager, MemObj *memObj, CommandStreamReceiver &targetCsr) {
+    auto &multiGraphicsAllocation = memObj->getMultiGraphicsAllocation();
+    auto sourceRootDeviceIndex = multiGraphicsAllocation.getMigrationSyncData()->getCurrentLocation();
+    auto targetRootDeviceIndex = targetCsr.getRootDeviceIndex();
+    auto srcMemory = multiGraphicsAllocation.getGraphicsAllocation(sourceRootDeviceIndex);
+
+    if (srcMemory->getAllocationType() == AllocationType::IMAGE || srcMemory->isAllocationLockable()) {
+        return false;
+    }
+
+    auto dstCmdQ = context.getSpecialQueue(targetRootDeviceIndex);
+    auto &targetDevice = dstCmdQ->getDevice();
+    bool peerToPeerMigration = targetDevice.getHardwareInfo().capabilityTable.p2pAccessSupported;
+    if (DebugManager.flags.EnablePeerToPeerMigration.get() != -1) {
+        peerToPeerMigration = !!DebugManager.flags.EnablePeerToPeerMigration.get();
+    }
+    if (!peerToPeerMigration) {
+        return false;
+    }
+
+    auto sharedHandle = srcMemory->peekInternalHandle(&memoryManager);
+    if (sharedHandle == 0u) {
+        return false;
+    }
+
+    auto size = srcMemory->getUnderlyingBufferSize();
+    AllocationProperties properties{targetRootDeviceIndex, size, AllocationType::BUFFER, targetDevice.getDeviceBitfield()};
+    auto peerMemory = memoryManager.createGraphicsAllocationFromSharedHandle(static_cast<osHandle>(sharedHandle), properties, false, false);
+    if (peerMemory == nullptr) {
+        return false;
+    }
+
+    MultiGraphicsAllocation peerAllocations(targetRootDeviceIndex);
+    peerAllocations.addAllocation(peerMemory);
+    auto peerBuffer = Buffer::createBufferHw(&context, ClMemoryPropertiesHelper::createMemoryProperties(CL_MEM_READ_ONLY, 0, 0, &targetDevice),
+                                             CL_MEM_READ_ONLY, 0, size, nullptr, nullptr, std::move(peerAllocations), false, false, false);
+
+    auto taskCountBeforeCopy = targetCsr.peekTaskCount();
+    auto retVal = dstCmdQ->enqueueCopyBuffer(peerBuffer, static_cast<Buffer *>(memObj), 0u, 0u, size, 0, nullptr, nullptr);
+    if (retVal == CL_SUCCESS && targetCsr.peekTaskCount() == taskCountBeforeCopy) {
+        // copy was submitted to other engine, it is not ordered with usage on target csr
+        dstCmdQ->finish();
+    }
+    peerBuffer->release();
+
+    return retVal == CL_SUCCESS;
+}
 } // namespace NEO
\ No newline at end of file
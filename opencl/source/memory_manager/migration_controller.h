@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021 Intel Corporation
+ * Copyright (C) 2021-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,6 +17,7 @@ class MemObj;
 class MigrationController {
   public:
     static void handleMigration(Context &context, CommandStreamReceiver &targetCsr, MemObj *memObj);
-    static void migrateMemory(Context &context, MemoryManager &memoryManager, MemObj *memObj, uint32_t targetRootDeviceIndex);
+    static void migrateMemory(Context &context, MemoryManager &memoryManager, MemObj *memObj, CommandStreamReceiver &targetCsr);
+    static bool migrateMemoryPeerToPeer(Context &context, MemoryManager &memoryManager, MemObj *memObj, CommandStreamReceiver &targetCsr);
 };
 } // namespace NEO
\ No newline at end of file
@@ -29,6 +29,7 @@
 #include "opencl/source/gtpin/gtpin_notify.h"
 #include "opencl/source/helpers/get_info_status_mapper.h"
 #include "opencl/source/sharings/sharing_factory.h"
+#include "opencl/source/tracing/tracing_collector.h"
 
 #include "CL/cl_ext.h"
 
@@ -173,6 +174,9 @@ bool Platform::initialize(std::vector<std::unique_ptr<Device>> devices) {
 
     this->fillGlobalDispatchTable();
     DEBUG_BREAK_IF(DebugManager.flags.CreateMultipleSubDevices.get() > 1 && !this->clDevices[0]->getDefaultEngine().commandStreamReceiver->peekTimestampPacketWriteEnabled());
+    if (DebugManager.flags.TracingCollectorRecordsPerThread.get() > 0) {
+        HostSideTracing::TracingCollector::enableGlobalCollector(static_cast<size_t>(DebugManager.flags.TracingCollectorRecordsPerThread.get()));
+    }
     state = StateInited;
     return true;
 }
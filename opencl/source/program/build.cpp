@@ -23,9 +23,12 @@
 #include "opencl/source/platform/platform.h"
 #include "opencl/source/program/program.h"
 
+#include <algorithm>
 #include <cstring>
+#include <functional>
 #include <iterator>
 #include <sstream>
+#include <thread>
 
 namespace NEO {
 
@@ -120,20 +123,65 @@ cl_int Program::build(
                     "Build Options", inputArgs.apiOptions.begin(),
                     "\nBuild Internal Options", inputArgs.internalOptions.begin());
             inputArgs.allowCaching = enableCaching;
-            NEO::TranslationOutput compilerOuput = {};
 
-            for (const auto &clDevice : deviceVector) {
+            // devices are compiled independently, results are processed in devices order
+            std::vector<TranslationOutput> compilerOutputs(deviceVector.size());
+            std::vector<TranslationOutput::ErrorCode> compilerErrors(deviceVector.size(), TranslationOutput::ErrorCode::UnknownError);
+            auto buildForDevice = [&](size_t deviceId, const TranslationInput &input) {
+                compilerErrors[deviceId] = pCompilerInterface->build(deviceVector[deviceId]->getDevice(), input, compilerOutputs[deviceId]);
+            };
+
+            const bool parallelBuild = (DebugManager.flags.ParallelProgramBuild.get() == 1) && (deviceVector.size() > 1);
+            bool frontendOutputShared = false;
+            if (parallelBuild) {
+                // source is translated by frontend once when all devices are of the same product,
+                // remaining devices are built from intermediate representation of the first one
+                auto productFamily = defaultClDevice->getHardwareInfo().platform.eProductFamily;
+                auto sameProduct = std::all_of(deviceVector.begin(), deviceVector.end(), [&](auto clDevice) { return clDevice->getHardwareInfo().platform.eProductFamily == productFamily; });
+                auto remainingDevicesInputArgs = inputArgs;
+                size_t firstParallelDeviceId = 0;
+                if (sameProduct && inputArgs.srcType == IGC::CodeType::oclC) {
+                    buildForDevice(0, inputArgs);
+                    firstParallelDeviceId = 1;
+                    auto &intermediateRepresentation = compilerOutputs[0].intermediateRepresentation;
+                    if (compilerErrors[0] == TranslationOutput::ErrorCode::Success && intermediateRepresentation.mem) {
+                        remainingDevicesInputArgs.srcType = compilerOutputs[0].intermediateCodeType;
+                        remainingDevicesInputArgs.src = ArrayRef<const char>(intermediateRepresentation.mem.get(), intermediateRepresentation.size);
+                        frontendOutputShared = true;
+                    }
+                }
+
+                std::vector<std::thread> workers;
+                workers.reserve(deviceVector.size() - 1);
+                for (size_t deviceId = firstParallelDeviceId + 1; deviceId < deviceVector.size(); deviceId++) {
+                    workers.emplace_back(buildForDevice, deviceId, std::cref(remainingDevicesInputArgs));
+                }
+                if (firstParallelDeviceId < deviceVector.size()) {
+                    buildForDevice(firstParallelDeviceId, firstParallelDeviceId == 0 ? inputArgs : remainingDevicesInputArgs);
+                }
+                for (auto &worker : workers) {
+                    worker.join();
+                }
+            }
+
+            for (size_t deviceId = 0; deviceId < deviceVector.size(); deviceId++) {
+                const auto &clDevice = deviceVector[deviceId];
                 if (requiresRebuild && !shouldSuppressRebuildWarning) {
                     this->updateBuildLog(clDevice->getRootDeviceIndex(), CompilerWarnings::recompiledFromIr.data(), CompilerWarnings::recompiledFromIr.length());
                 }
-                auto compilerErr = pCompilerInterface->build(clDevice->getDevice(), inputArgs, compilerOuput);
-                this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.frontendCompilerLog.c_str(), compilerOuput.frontendCompilerLog.size());
+                if (!parallelBuild) {
+                    buildForDevice(deviceId, inputArgs);
+                }
+                auto compilerErr = compilerErrors[deviceId];
+                auto &compilerOuput = compilerOutputs[deviceId];
+                auto &frontendCompilerLog = frontendOutputShared ? compilerOutputs[0].frontendCompilerLog : compilerOuput.frontendCompilerLog;
+                this->updateBuildLog(clDevice->getRootDeviceIndex(), frontendCompilerLog.c_str(), frontendCompilerLog.size());
                 this->updateBuildLog(clDevice->getRootDeviceIndex(), compilerOuput.backendCompilerLog.c_str(), compilerOuput.backendCompilerLog.size());
                 retVal = asClError(compilerErr);
                 if (retVal != CL_SUCCESS) {
                     break;
                 }
-                if (inputArgs.srcType == IGC::CodeType::oclC) {
+                if (inputArgs.srcType == IGC::CodeType::oclC && !(frontendOutputShared && deviceId > 0)) {
                     this->irBinary = std::move(compilerOuput.intermediateRepresentation.mem);
                     this->irBinarySize = compilerOuput.intermediateRepresentation.size;
                     this->isSpirV = compilerOuput.intermediateCodeType == IGC::CodeType::spirV;
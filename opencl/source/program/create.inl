@@ -133,7 +133,8 @@ T *Program::createBuiltInFromGenBinary(
 
         program = new T(context, true, deviceVector);
         for (const auto &device : deviceVector) {
-            if (program->buildInfos[device->getRootDeviceIndex()].packedDeviceBinarySize == 0) {
+            auto &buildInfo = program->buildInfos[device->getRootDeviceIndex()];
+            if (buildInfo.packedDeviceBinarySize == 0 && buildInfo.unpackedDeviceBinarySize == 0) {
                 program->replaceDeviceBinary(std::move(makeCopy(binary, size)), size, device->getRootDeviceIndex());
             }
         }
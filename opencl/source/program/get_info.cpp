@@ -60,6 +60,7 @@ cl_int Program::getInfo(cl_program_info paramName, size_t paramValueSize,
                 continue;
             }
             auto rootDeviceIndex = clDevices[i]->getRootDeviceIndex();
+            packDeviceBinary(*clDevices[i]);
             auto binarySize = buildInfos[rootDeviceIndex].packedDeviceBinarySize;
             memcpy_s(outputBinaries[i], binarySize, buildInfos[rootDeviceIndex].packedDeviceBinary.get(), binarySize);
         }
@@ -199,8 +199,14 @@ cl_int Program::createProgramFromBinary(
             if ((false == singleDeviceBinary.deviceBinary.empty()) && (false == forceRebuildBuiltInFromIr)) {
                 this->buildInfos[rootDeviceIndex].unpackedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(singleDeviceBinary.deviceBinary.begin()), singleDeviceBinary.deviceBinary.size());
                 this->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize = singleDeviceBinary.deviceBinary.size();
-                this->buildInfos[rootDeviceIndex].packedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(archive.begin()), archive.size());
-                this->buildInfos[rootDeviceIndex].packedDeviceBinarySize = archive.size();
+                // packed copy is created on demand in packDeviceBinary when input container is the unpacked binary itself
+                // or when copying input containers (e.g. fat binaries) is explicitly deferred
+                bool inputIsUnpackedBinary = (singleDeviceBinary.deviceBinary.begin() == archive.begin()) && (singleDeviceBinary.deviceBinary.size() == archive.size()) &&
+                                             isAnyPackedDeviceBinaryFormat(archive);
+                if (false == inputIsUnpackedBinary && DebugManager.flags.DeferPackedProgramBinaryCopy.get() != 1) {
+                    this->buildInfos[rootDeviceIndex].packedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(archive.begin()), archive.size());
+                    this->buildInfos[rootDeviceIndex].packedDeviceBinarySize = archive.size();
+                }
             } else {
                 this->isCreatedFromBinary = false;
                 this->requiresRebuild = true;
@@ -367,15 +373,18 @@ void Program::updateNonUniformFlag(const Program **inputPrograms, size_t numInpu
 }
 
 void Program::replaceDeviceBinary(std::unique_ptr<char[]> &&newBinary, size_t newBinarySize, uint32_t rootDeviceIndex) {
-    if (isAnyPackedDeviceBinaryFormat(ArrayRef<const uint8_t>(reinterpret_cast<uint8_t *>(newBinary.get()), newBinarySize))) {
+    auto newBinaryRef = ArrayRef<const uint8_t>(reinterpret_cast<uint8_t *>(newBinary.get()), newBinarySize);
+    if (isAnyPackedDeviceBinaryFormat(newBinaryRef) && isAnySingleDeviceBinaryFormat(newBinaryRef)) {
+        // same container is valid as both packed and unpacked binary, packed copy is created on demand in packDeviceBinary
+        this->buildInfos[rootDeviceIndex].packedDeviceBinary.reset();
+        this->buildInfos[rootDeviceIndex].packedDeviceBinarySize = 0U;
+        this->buildInfos[rootDeviceIndex].unpackedDeviceBinary = std::move(newBinary);
+        this->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize = newBinarySize;
+    } else if (isAnyPackedDeviceBinaryFormat(newBinaryRef)) {
         this->buildInfos[rootDeviceIndex].packedDeviceBinary = std::move(newBinary);
         this->buildInfos[rootDeviceIndex].packedDeviceBinarySize = newBinarySize;
         this->buildInfos[rootDeviceIndex].unpackedDeviceBinary.reset();
         this->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize = 0U;
-        if (isAnySingleDeviceBinaryFormat(ArrayRef<const uint8_t>(reinterpret_cast<uint8_t *>(this->buildInfos[rootDeviceIndex].packedDeviceBinary.get()), this->buildInfos[rootDeviceIndex].packedDeviceBinarySize))) {
-            this->buildInfos[rootDeviceIndex].unpackedDeviceBinary = makeCopy(buildInfos[rootDeviceIndex].packedDeviceBinary.get(), buildInfos[rootDeviceIndex].packedDeviceBinarySize);
-            this->buildInfos[rootDeviceIndex].unpackedDeviceBinarySize = buildInfos[rootDeviceIndex].packedDeviceBinarySize;
-        }
     } else {
         this->buildInfos[rootDeviceIndex].packedDeviceBinary.reset();
         this->buildInfos[rootDeviceIndex].packedDeviceBinarySize = 0U;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "opencl/source/sharings/gl/gl_sharing.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/helpers/timestamp_packet.h"
 
@@ -99,6 +100,14 @@ cl_int GLSharingFunctions::getSupportedFormats(cl_mem_flags flags,
     return CL_SUCCESS;
 }
 
+// GL writes are expected to be fenced with GL sync objects imported to OpenCL
+SharingFunctions *GlSharing::getProducerWritesTracker() {
+    if (DebugManager.flags.EnableSharingProducerWriteTracking.get() == 1) {
+        return sharingFunctions;
+    }
+    return nullptr;
+}
+
 int GlSharing::synchronizeHandler(UpdateData &updateData) {
     GLContextGuard guard(*sharingFunctions);
     synchronizeObject(updateData);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -71,6 +71,7 @@ class GlSharing : public SharingHandler {
     static const std::unordered_map<GLenum, const cl_image_format> glToCLFormats;
 
   protected:
+    SharingFunctions *getProducerWritesTracker() override;
     int synchronizeHandler(UpdateData &updateData) override;
     GLSharingFunctions *sharingFunctions = nullptr;
     unsigned int clGlObjectType = 0u;
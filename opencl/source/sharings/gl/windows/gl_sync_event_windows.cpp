@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -38,6 +38,7 @@ GlSyncEvent *GlSyncEvent::create(Context &context, cl_GLsync sync, cl_int *errCo
 
     context.getSharing<GLSharingFunctionsWindows>()->retainSync(&syncInfo);
     DEBUG_BREAK_IF(!syncInfo.pSync);
+    context.getSharing<GLSharingFunctionsWindows>()->signalProducerWrite();
 
     EventBuilder eventBuilder;
     eventBuilder.create<GlSyncEvent>(context, syncInfo);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,6 +17,16 @@ namespace NEO {
 
 int SharingHandler::acquire(MemObj *memObj, uint32_t rootDeviceIndex) {
     if (acquireCount == 0) {
+        // objects not written by producer since last synchronization are acquired without round trip to producer API
+        auto producerWritesTracker = getProducerWritesTracker();
+        uint64_t producerWritesCount = producerWritesTracker ? producerWritesTracker->peekProducerWritesCount() : 0u;
+        synchronizationSkipped = producerWritesTracker && synchronizedWithProducer && synchronizedProducerWritesCount == producerWritesCount;
+        if (synchronizationSkipped) {
+            acquireCount++;
+            return CL_SUCCESS;
+        }
+        synchronizedWithProducer = false;
+
         UpdateData updateData{rootDeviceIndex};
         auto graphicsAllocation = memObj->getGraphicsAllocation(rootDeviceIndex);
         auto currentSharedHandle = graphicsAllocation->peekSharedHandle();
@@ -32,6 +42,8 @@ int SharingHandler::acquire(MemObj *memObj, uint32_t rootDeviceIndex) {
         }
 
         DEBUG_BREAK_IF(graphicsAllocation->peekSharedHandle() != updateData.sharedHandle);
+        synchronizedWithProducer = true;
+        synchronizedProducerWritesCount = producerWritesCount;
     }
     acquireCount++;
     return CL_SUCCESS;
@@ -55,7 +67,7 @@ void SharingHandler::resolveGraphicsAllocationChange(osHandle currentSharedHandl
 void SharingHandler::release(MemObj *memObject, uint32_t rootDeviceIndex) {
     DEBUG_BREAK_IF(acquireCount <= 0);
     acquireCount--;
-    if (acquireCount == 0) {
+    if (acquireCount == 0 && !synchronizationSkipped) {
         releaseResource(memObject, rootDeviceIndex);
     }
 }
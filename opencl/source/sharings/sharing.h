@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,8 @@
 #pragma once
 #include "shared/source/memory_manager/graphics_allocation.h"
 
+#include <atomic>
+
 namespace NEO {
 class Context;
 class MemObj;
@@ -33,6 +35,13 @@ class SharingFunctions {
     virtual uint32_t getId() const = 0;
 
     virtual ~SharingFunctions() = default;
+
+    // Producer API signals that it may have written shared resources, e.g. by passing fence to OpenCL
+    void signalProducerWrite() { producerWritesCount++; }
+    uint64_t peekProducerWritesCount() const { return producerWritesCount; }
+
+  protected:
+    std::atomic<uint64_t> producerWritesCount{0u};
 };
 
 class SharingHandler {
@@ -45,11 +54,15 @@ class SharingHandler {
     virtual void releaseReusedGraphicsAllocation(){};
 
   protected:
+    virtual SharingFunctions *getProducerWritesTracker() { return nullptr; }
     virtual int synchronizeHandler(UpdateData &updateData);
     virtual int validateUpdateData(UpdateData &updateData);
     virtual void synchronizeObject(UpdateData &updateData) { updateData.synchronizationStatus = SYNCHRONIZE_ERROR; }
     virtual void resolveGraphicsAllocationChange(osHandle currentSharedHandle, UpdateData *updateData);
     virtual void releaseResource(MemObj *memObject, uint32_t rootDeviceIndex){};
     unsigned int acquireCount = 0u;
+    uint64_t synchronizedProducerWritesCount = 0u;
+    bool synchronizedWithProducer = false;
+    bool synchronizationSkipped = false;
 };
 } // namespace NEO
@@ -8,6 +8,8 @@
 #include "va_sharing_functions.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
 
 #include "opencl/source/sharings/va/va_surface.h"
 
@@ -27,12 +29,40 @@ VASharingFunctions::VASharingFunctions(VADisplay vaDisplay) : vaDisplay(vaDispla
 };
 
 VASharingFunctions::~VASharingFunctions() {
+    for (auto &surfaceImport : surfaceImports) {
+        auto graphicsAllocation = surfaceImport.second.graphicsAllocation;
+        graphicsAllocation->decReuseCount();
+        if (graphicsAllocation->peekReuseCount() == 0) {
+            surfaceImportsMemoryManager->checkGpuUsageAndDestroyGraphicsAllocations(graphicsAllocation);
+        }
+    }
+    surfaceImports.clear();
+
     if (libHandle != nullptr) {
         fdlclose(libHandle);
         libHandle = nullptr;
     }
 }
 
+// Imported surfaces are kept alive for the lifetime of the context, video pipelines cycle through a fixed
+// pool of surfaces and sharing the same surface again skips export, dmabuf import and Gmm creation.
+// Must be called with the mutex held.
+GraphicsAllocation *VASharingFunctions::getCachedSurfaceImport(VASurfaceID surfaceId, cl_uint plane, cl_mem_flags flags, SharedSurfaceInfo &surfaceInfo) {
+    auto surfaceImport = surfaceImports.find(SurfaceImportKey{surfaceId, plane, flags});
+    if (surfaceImport == surfaceImports.end()) {
+        return nullptr;
+    }
+    surfaceInfo = *surfaceImport->second.surfaceInfo;
+    return surfaceImport->second.graphicsAllocation;
+}
+
+void VASharingFunctions::cacheSurfaceImport(VASurfaceID surfaceId, cl_uint plane, cl_mem_flags flags, const SharedSurfaceInfo &surfaceInfo,
+                                            GraphicsAllocation *graphicsAllocation, MemoryManager *memoryManager) {
+    graphicsAllocation->incReuseCount(); // decremented in destructor
+    surfaceImportsMemoryManager = memoryManager;
+    surfaceImports[SurfaceImportKey{surfaceId, plane, flags}] = {graphicsAllocation, std::make_unique<SharedSurfaceInfo>(surfaceInfo)};
+}
+
 bool VASharingFunctions::isVaLibraryAvailable() {
     auto lib = fdlopen(Os::libvaDllName, RTLD_LAZY);
     if (lib) {
@@ -10,10 +10,16 @@
 #include "opencl/source/sharings/va/va_sharing_defines.h"
 
 #include <functional>
+#include <map>
+#include <memory>
 #include <mutex>
+#include <tuple>
 #include <vector>
 
 namespace NEO {
+class GraphicsAllocation;
+class MemoryManager;
+struct SharedSurfaceInfo;
 
 class VASharingFunctions : public SharingFunctions {
   public:
@@ -83,9 +89,22 @@ class VASharingFunctions : public SharingFunctions {
 
     static bool isVaLibraryAvailable();
 
+    GraphicsAllocation *getCachedSurfaceImport(VASurfaceID surfaceId, cl_uint plane, cl_mem_flags flags, SharedSurfaceInfo &surfaceInfo);
+    void cacheSurfaceImport(VASurfaceID surfaceId, cl_uint plane, cl_mem_flags flags, const SharedSurfaceInfo &surfaceInfo,
+                            GraphicsAllocation *graphicsAllocation, MemoryManager *memoryManager);
+
     std::mutex mutex;
 
   protected:
+    struct SurfaceImport {
+        GraphicsAllocation *graphicsAllocation = nullptr;
+        std::unique_ptr<SharedSurfaceInfo> surfaceInfo;
+    };
+    using SurfaceImportKey = std::tuple<VASurfaceID, cl_uint, cl_mem_flags>;
+
+    std::map<SurfaceImportKey, SurfaceImport> surfaceImports;
+    MemoryManager *surfaceImportsMemoryManager = nullptr;
+
     void *libHandle = nullptr;
     VADisplay vaDisplay = nullptr;
     VADisplayIsValidPFN vaDisplayIsValidPFN = [](VADisplay vaDisplay) { return 0; };
@@ -166,6 +166,50 @@ Image *VASurface::createSharedVaSurface(Context *context, VASharingFunctions *sh
 
     std::unique_lock<std::mutex> lock(sharingFunctions->mutex);
 
+    bool surfaceImportCacheEnabled = DebugManager.flags.EnableVaSurfaceImportCache.get() == 1;
+    bool supportOcl21 = context->getDevice(0)->getHardwareInfo().capabilityTable.supportsOcl21Features;
+    GraphicsAllocation *alloc = nullptr;
+    if (surfaceImportCacheEnabled) {
+        alloc = sharingFunctions->getCachedSurfaceImport(*surface, plane, flags, sharedSurfaceInfo);
+    }
+
+    if (alloc == nullptr) {
+        alloc = importSurface(context, sharingFunctions, flags, surface, plane, sharedSurfaceInfo, supportOcl21, errcodeRet);
+        if (alloc == nullptr) {
+            return nullptr;
+        }
+        if (surfaceImportCacheEnabled) {
+            sharingFunctions->cacheSurfaceImport(*surface, plane, flags, sharedSurfaceInfo, alloc, memoryManager);
+        }
+    }
+
+    if (surfaceImportCacheEnabled) {
+        alloc->incReuseCount(); // decremented in releaseReusedGraphicsAllocation() called from MemObj destructor
+    }
+
+    lock.unlock();
+
+    cl_image_format imgFormat = {sharedSurfaceInfo.channelOrder, sharedSurfaceInfo.channelType};
+    auto imgSurfaceFormat = Image::getSurfaceFormatFromTable(flags, &imgFormat, supportOcl21);
+    sharedSurfaceInfo.imgInfo.surfaceFormat = &imgSurfaceFormat->surfaceFormat;
+    sharedSurfaceInfo.imgInfo.imgDesc.imageRowPitch = sharedSurfaceInfo.imgInfo.rowPitch;
+
+    auto vaSurface = new VASurface(sharingFunctions, sharedSurfaceInfo.imageId, plane, surface, context->getInteropUserSyncEnabled());
+    if (surfaceImportCacheEnabled) {
+        vaSurface->reusedAllocation = alloc;
+    }
+    auto multiGraphicsAllocation = MultiGraphicsAllocation(context->getDevice(0)->getRootDeviceIndex());
+    multiGraphicsAllocation.addAllocation(alloc);
+
+    auto image = Image::createSharedImage(context, vaSurface, mcsSurfaceInfo, std::move(multiGraphicsAllocation), nullptr, flags, flagsIntel, imgSurfaceFormat, sharedSurfaceInfo.imgInfo, __GMM_NO_CUBE_MAP, 0, 0);
+    image->setMediaPlaneType(plane);
+    return image;
+}
+
+GraphicsAllocation *VASurface::importSurface(Context *context, VASharingFunctions *sharingFunctions, cl_mem_flags flags, VASurfaceID *surface,
+                                             cl_uint plane, SharedSurfaceInfo &sharedSurfaceInfo, bool supportOcl21, cl_int *errcodeRet) {
+    auto memoryManager = context->getMemoryManager();
+
     auto result = getSurfaceDescription(sharedSurfaceInfo, sharingFunctions, surface);
 
     if (result != VA_STATUS_SUCCESS) {
@@ -175,8 +219,6 @@ Image *VASurface::createSharedVaSurface(Context *context, VASharingFunctions *sh
 
     sharedSurfaceInfo.imgInfo.imgDesc.imageType = ImageType::Image2D;
 
-    bool supportOcl21 = context->getDevice(0)->getHardwareInfo().capabilityTable.supportsOcl21Features;
-
     if (VASurface::isSupportedPlanarFormat(sharedSurfaceInfo.imageFourcc)) {
         applyPlanarOptions(sharedSurfaceInfo, plane, flags, supportOcl21);
     } else if (VASurface::isSupportedPackedFormat(sharedSurfaceInfo.imageFourcc)) {
@@ -203,20 +245,7 @@ Image *VASurface::createSharedVaSurface(Context *context, VASharingFunctions *sh
         sharingFunctions->destroyImage(sharedSurfaceInfo.imageId);
     }
 
-    lock.unlock();
-
-    cl_image_format imgFormat = {sharedSurfaceInfo.channelOrder, sharedSurfaceInfo.channelType};
-    auto imgSurfaceFormat = Image::getSurfaceFormatFromTable(flags, &imgFormat, supportOcl21);
-    sharedSurfaceInfo.imgInfo.surfaceFormat = &imgSurfaceFormat->surfaceFormat;
-    sharedSurfaceInfo.imgInfo.imgDesc.imageRowPitch = sharedSurfaceInfo.imgInfo.rowPitch;
-
-    auto vaSurface = new VASurface(sharingFunctions, sharedSurfaceInfo.imageId, plane, surface, context->getInteropUserSyncEnabled());
-    auto multiGraphicsAllocation = MultiGraphicsAllocation(context->getDevice(0)->getRootDeviceIndex());
-    multiGraphicsAllocation.addAllocation(alloc);
-
-    auto image = Image::createSharedImage(context, vaSurface, mcsSurfaceInfo, std::move(multiGraphicsAllocation), nullptr, flags, flagsIntel, imgSurfaceFormat, sharedSurfaceInfo.imgInfo, __GMM_NO_CUBE_MAP, 0, 0);
-    image->setMediaPlaneType(plane);
-    return image;
+    return alloc;
 }
 
 void VASurface::synchronizeObject(UpdateData &updateData) {
@@ -228,6 +257,13 @@ void VASurface::synchronizeObject(UpdateData &updateData) {
     }
 }
 
+void VASurface::releaseReusedGraphicsAllocation() {
+    if (reusedAllocation != nullptr) {
+        std::unique_lock<std::mutex> lock(sharingFunctions->mutex);
+        reusedAllocation->decReuseCount();
+    }
+}
+
 void VASurface::getMemObjectInfo(size_t &paramValueSize, void *&paramValue) {
     paramValueSize = sizeof(surfaceIdPtr);
     paramValue = &surfaceIdPtr;
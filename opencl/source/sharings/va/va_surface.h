@@ -36,6 +36,7 @@ class VASurface : VASharing {
     void synchronizeObject(UpdateData &updateData) override;
 
     void getMemObjectInfo(size_t &paramValueSize, void *&paramValue) override;
+    void releaseReusedGraphicsAllocation() override;
 
     static bool validate(cl_mem_flags flags, cl_uint plane);
     static const ClSurfaceFormatInfo *getExtendedSurfaceFormatInfo(uint32_t formatFourCC);
@@ -56,9 +57,13 @@ class VASurface : VASharing {
         surfaceIdPtr = &this->surfaceId;
     };
 
+    static GraphicsAllocation *importSurface(Context *context, VASharingFunctions *sharingFunctions, cl_mem_flags flags, VASurfaceID *surface,
+                                             cl_uint plane, SharedSurfaceInfo &sharedSurfaceInfo, bool supportOcl21, cl_int *errcodeRet);
+
     cl_uint plane;
     VASurfaceID surfaceId;
     VASurfaceID *surfaceIdPtr;
     bool interopUserSync;
+    GraphicsAllocation *reusedAllocation = nullptr;
 };
 } // namespace NEO
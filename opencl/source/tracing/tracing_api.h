@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -81,6 +81,22 @@ cl_int CL_API_CALL clDisableTracingINTEL(cl_tracing_handle handle);
 */
 cl_int CL_API_CALL clGetTracingStateINTEL(cl_tracing_handle handle, cl_bool *enable);
 
+/*!
+    Function moves records gathered by the built-in tracing collector into
+    the user-provided array. The collector is enabled with
+    TracingCollectorRecordsPerThread debug variable
+    \param[out] records Array to store the records, can be nullptr to query
+                        the number of available records
+    \param[in] numRecords Number of entries in records array
+    \param[out] numRecordsRet Returns number of records written into the array
+                              or number of available records if records is
+                              nullptr
+    \return Status code for current operation
+
+    Thread Safety: yes
+*/
+cl_int CL_API_CALL clDrainTracingRecordsINTEL(cl_tracing_record_intel *records, size_t numRecords, size_t *numRecordsRet);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,165 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/tracing/tracing_collector.h"
+
+#include "opencl/source/tracing/tracing_api.h"
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+
+namespace HostSideTracing {
+
+TracingRingBuffer::TracingRingBuffer(size_t capacity, uint32_t threadIndex)
+    : records(std::make_unique<cl_tracing_record_intel[]>(capacity)), capacity(capacity), threadIndex(threadIndex) {
+    DEBUG_BREAK_IF(capacity == 0u);
+}
+
+bool TracingRingBuffer::push(const cl_tracing_record_intel &record) {
+    auto currentHead = head.load(std::memory_order_relaxed);
+    if (currentHead - tail.load(std::memory_order_acquire) >= capacity) {
+        droppedRecords.fetch_add(1u, std::memory_order_relaxed);
+        return false;
+    }
+    records[currentHead % capacity] = record;
+    head.store(currentHead + 1, std::memory_order_release);
+    return true;
+}
+
+size_t TracingRingBuffer::pop(cl_tracing_record_intel *outRecords, size_t maxRecords) {
+    auto currentTail = tail.load(std::memory_order_relaxed);
+    auto numRecords = std::min(static_cast<size_t>(head.load(std::memory_order_acquire) - currentTail), maxRecords);
+    for (size_t i = 0; i < numRecords; i++) {
+        outRecords[i] = records[(currentTail + i) % capacity];
+    }
+    tail.store(currentTail + numRecords, std::memory_order_release);
+    return numRecords;
+}
+
+size_t TracingRingBuffer::getNumRecords() const {
+    return static_cast<size_t>(head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire));
+}
+
+std::atomic<uint32_t> TracingCollector::collectorIdCounter{0u};
+
+namespace {
+std::once_flag globalCollectorOnceFlag;
+std::unique_ptr<TracingCollector> globalCollector;
+
+struct ThreadTracingBuffer {
+    uint32_t collectorId = std::numeric_limits<uint32_t>::max();
+    std::shared_ptr<TracingRingBuffer> buffer;
+};
+thread_local ThreadTracingBuffer threadTracingBuffer;
+} // namespace
+
+TracingCollector::TracingCollector(size_t recordsPerThread)
+    : collectorId(collectorIdCounter.fetch_add(1u)), recordsPerThread(recordsPerThread), tracingHandle(callback, this) {
+    for (uint32_t fid = 0; fid < CL_FUNCTION_COUNT; fid++) {
+        tracingHandle.setTracingPoint(static_cast<cl_function_id>(fid), true);
+    }
+    clTracingHandle.device = nullptr;
+    clTracingHandle.handle = &tracingHandle;
+}
+
+TracingCollector::~TracingCollector() {
+    disable();
+}
+
+void TracingCollector::enableGlobalCollector(size_t recordsPerThread) {
+    std::call_once(globalCollectorOnceFlag, [recordsPerThread]() {
+        globalCollector = std::make_unique<TracingCollector>(recordsPerThread);
+        globalCollector->enable();
+    });
+}
+
+TracingCollector *TracingCollector::getGlobalCollector() {
+    return globalCollector.get();
+}
+
+void TracingCollector::callback(cl_function_id fid, cl_callback_data *callbackData, void *userData) {
+    static_cast<TracingCollector *>(userData)->record(fid, *callbackData);
+}
+
+cl_int TracingCollector::enable() {
+    auto retVal = clEnableTracingINTEL(&clTracingHandle);
+    enabled |= (retVal == CL_SUCCESS);
+    return retVal;
+}
+
+cl_int TracingCollector::disable() {
+    if (!enabled) {
+        return CL_INVALID_OPERATION;
+    }
+    enabled = false;
+    return clDisableTracingINTEL(&clTracingHandle);
+}
+
+void TracingCollector::record(cl_function_id fid, const cl_callback_data &callbackData) {
+    cl_tracing_record_intel record = {};
+    record.timestamp = static_cast<cl_ulong>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    record.correlationId = callbackData.correlationId;
+    record.functionId = fid;
+    record.site = callbackData.site;
+
+    auto &buffer = getThreadBuffer();
+    record.threadIndex = buffer.getThreadIndex();
+    buffer.push(record);
+}
+
+TracingRingBuffer &TracingCollector::getThreadBuffer() {
+    if (threadTracingBuffer.collectorId != collectorId) {
+        std::lock_guard<std::mutex> lock(buffersMtx);
+        auto buffer = std::make_shared<TracingRingBuffer>(recordsPerThread, static_cast<uint32_t>(buffers.size()));
+        buffers.push_back(buffer);
+        threadTracingBuffer.buffer = std::move(buffer);
+        threadTracingBuffer.collectorId = collectorId;
+    }
+    return *threadTracingBuffer.buffer;
+}
+
+size_t TracingCollector::drain(cl_tracing_record_intel *outRecords, size_t maxRecords) {
+    std::lock_guard<std::mutex> lock(buffersMtx);
+    size_t numRecords = 0u;
+    for (auto &buffer : buffers) {
+        numRecords += buffer->pop(outRecords + numRecords, maxRecords - numRecords);
+        if (numRecords == maxRecords) {
+            break;
+        }
+    }
+    return numRecords;
+}
+
+size_t TracingCollector::getNumRecords() {
+    std::lock_guard<std::mutex> lock(buffersMtx);
+    size_t numRecords = 0u;
+    for (auto &buffer : buffers) {
+        numRecords += buffer->getNumRecords();
+    }
+    return numRecords;
+}
+
+} // namespace HostSideTracing
+
+using namespace HostSideTracing;
+
+cl_int CL_API_CALL clDrainTracingRecordsINTEL(cl_tracing_record_intel *records, size_t numRecords, size_t *numRecordsRet) {
+    auto collector = TracingCollector::getGlobalCollector();
+    if (collector == nullptr) {
+        return CL_INVALID_OPERATION;
+    }
+    if (records != nullptr && numRecords == 0u) {
+        return CL_INVALID_VALUE;
+    }
+
+    size_t numRecordsProcessed = records ? collector->drain(records, numRecords) : collector->getNumRecords();
+    if (numRecordsRet) {
+        *numRecordsRet = numRecordsProcessed;
+    }
+    return CL_SUCCESS;
+}
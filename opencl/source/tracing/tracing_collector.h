@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include "opencl/source/tracing/tracing_handle.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace HostSideTracing {
+
+// Single producer (owning thread), single consumer (collector drain) ring of tracing records
+class TracingRingBuffer : NEO::NonCopyableOrMovableClass {
+  public:
+    TracingRingBuffer(size_t capacity, uint32_t threadIndex);
+
+    bool push(const cl_tracing_record_intel &record);
+    size_t pop(cl_tracing_record_intel *outRecords, size_t maxRecords);
+    size_t getNumRecords() const;
+    uint64_t getNumDroppedRecords() const { return droppedRecords.load(std::memory_order_relaxed); }
+    uint32_t getThreadIndex() const { return threadIndex; }
+
+  protected:
+    std::unique_ptr<cl_tracing_record_intel[]> records;
+    const size_t capacity;
+    const uint32_t threadIndex;
+    std::atomic<uint64_t> head{0u};
+    std::atomic<uint64_t> tail{0u};
+    std::atomic<uint64_t> droppedRecords{0u};
+};
+
+// Built-in tracing client writing compact records into per-thread ring buffers instead of calling user callbacks
+class TracingCollector : NEO::NonCopyableOrMovableClass {
+  public:
+    TracingCollector(size_t recordsPerThread);
+    ~TracingCollector();
+
+    static void enableGlobalCollector(size_t recordsPerThread);
+    static TracingCollector *getGlobalCollector();
+    static void callback(cl_function_id fid, cl_callback_data *callbackData, void *userData);
+
+    cl_int enable();
+    cl_int disable();
+    void record(cl_function_id fid, const cl_callback_data &callbackData);
+    size_t drain(cl_tracing_record_intel *outRecords, size_t maxRecords);
+    size_t getNumRecords();
+
+  protected:
+    TracingRingBuffer &getThreadBuffer();
+
+    static std::atomic<uint32_t> collectorIdCounter;
+
+    const uint32_t collectorId;
+    const size_t recordsPerThread;
+    TracingHandle tracingHandle;
+    _cl_tracing_handle clTracingHandle;
+    bool enabled = false;
+
+    std::mutex buffersMtx;
+    std::vector<std::shared_ptr<TracingRingBuffer>> buffers;
+};
+
+} // namespace HostSideTracing
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -167,6 +167,21 @@ typedef enum _cl_function_id {
     CL_FUNCTION_COUNT = 118,
 } cl_function_id;
 
+/*!
+    \brief Record written by the built-in tracing collector
+
+    ENTER and EXIT records of a single call share the correlation identifier.
+    Timestamps are taken from a monotonic host clock.
+*/
+typedef struct _cl_tracing_record_intel {
+    cl_ulong timestamp;        //!< Host timestamp in nanoseconds
+    cl_uint correlationId;     //!< Correlation identifier, the same for ENTER
+                               //!< and EXIT records
+    cl_uint threadIndex;       //!< Index of the thread that called the function
+    cl_function_id functionId; //!< Identifier of the traced function
+    cl_callback_site site;     //!< Call site, can be ENTER or EXIT
+} cl_tracing_record_intel;
+
 /*!
     User-defined tracing callback prototype
     \param[in] fid Identifier of the function for which the callback is called
@@ -10,6 +10,7 @@
 #include "opencl/test/unit_test/api/cl_get_kernel_suggested_local_work_size_khr_tests.inl"
 #include "opencl/test/unit_test/api/cl_get_kernel_work_group_info_tests.inl"
 #include "opencl/test/unit_test/api/cl_get_mem_object_info_tests.inl"
+#include "opencl/test/unit_test/api/cl_get_performance_hints_intel_tests.inl"
 #include "opencl/test/unit_test/api/cl_get_pipe_info_tests.inl"
 #include "opencl/test/unit_test/api/cl_get_platform_ids_tests.inl"
 #include "opencl/test/unit_test/api/cl_get_platform_info_tests.inl"
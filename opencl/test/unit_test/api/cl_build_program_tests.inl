@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/helpers/file_io.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/kernel_binary_helper.h"
 #include "shared/test/common/helpers/test_files.h"
 #include "shared/test/common/mocks/mock_compilers.h"
@@ -637,6 +638,59 @@ TEST(clBuildProgramTest, givenMultiDeviceProgramWithProgramBuiltForSingleDeviceW
     EXPECT_EQ(CL_SUCCESS, retVal);
 }
 
+TEST(clBuildProgramTest, givenParallelProgramBuildWhenBuildingSourceProgramForMultipleRootDevicesThenProgramIsBuiltForEachDevice) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ParallelProgramBuild.set(1);
+
+    MockUnrestrictiveContextMultiGPU context;
+    cl_program pProgram = nullptr;
+    size_t sourceSize = 0;
+    cl_int retVal = CL_INVALID_PROGRAM;
+    std::string testFile;
+
+    testFile.append(clFiles);
+    testFile.append("copybuffer.cl");
+    auto pSource = loadDataFromFile(
+        testFile.c_str(),
+        sourceSize);
+
+    ASSERT_NE(0u, sourceSize);
+    ASSERT_NE(nullptr, pSource);
+
+    const char *sources[1] = {pSource.get()};
+    pProgram = clCreateProgramWithSource(
+        &context,
+        1,
+        sources,
+        &sourceSize,
+        &retVal);
+
+    EXPECT_NE(nullptr, pProgram);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    cl_device_id devices[] = {context.pRootDevice0, context.pRootDevice1};
+    retVal = clBuildProgram(
+        pProgram,
+        2,
+        devices,
+        nullptr,
+        nullptr,
+        nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    auto program = castToObject<Program>(pProgram);
+    for (auto device : devices) {
+        cl_build_status buildStatus = CL_BUILD_NONE;
+        retVal = clGetProgramBuildInfo(pProgram, device, CL_PROGRAM_BUILD_STATUS, sizeof(buildStatus), &buildStatus, nullptr);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        EXPECT_EQ(CL_BUILD_SUCCESS, buildStatus);
+        EXPECT_NE(nullptr, program->getKernelInfo("fullCopy", castToObject<ClDevice>(device)->getRootDeviceIndex()));
+    }
+
+    retVal = clReleaseProgram(pProgram);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+}
+
 TEST(clBuildProgramTest, givenMultiDeviceProgramWithProgramBuiltForSingleDeviceWithCreatedKernelWhenBuildingProgramForSecondDeviceThenInvalidOperationReturned) {
     MockUnrestrictiveContextMultiGPU context;
     cl_program pProgram = nullptr;
@@ -472,6 +472,36 @@ HWTEST_F(LowPriorityCommandQueueTest, GivenDeviceWithSubdevicesWhenCreatingLowPr
     clReleaseCommandQueue(cmdQ);
 }
 
+using HighPriorityCommandQueueTest = ::testing::Test;
+HWTEST_F(HighPriorityCommandQueueTest, GivenHighPriorityContextCreationEnabledWhenCreatingHighPriorityCommandQueueThenHighPriorityEngineIsTaken) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CreateHighPriorityContext.set(1);
+    MockContext context;
+    cl_queue_properties properties[] = {CL_QUEUE_PRIORITY_KHR, CL_QUEUE_PRIORITY_HIGH_KHR, 0};
+    auto cmdQ = clCreateCommandQueueWithProperties(&context, context.getDevice(0), properties, nullptr);
+
+    auto commandQueueObj = castToObject<CommandQueue>(cmdQ);
+    auto &osContext = commandQueueObj->getGpgpuCommandStreamReceiver().getOsContext();
+    EXPECT_EQ(getChosenEngineType(context.getDevice(0)->getHardwareInfo()), osContext.getEngineType());
+    EXPECT_TRUE(osContext.isHighPriority());
+    EXPECT_EQ(QueuePriority::HIGH, commandQueueObj->getPriority());
+
+    auto &defaultEngine = context.getDevice(0)->getDevice().getDefaultEngine();
+    EXPECT_NE(defaultEngine.commandStreamReceiver, &commandQueueObj->getGpgpuCommandStreamReceiver());
+    clReleaseCommandQueue(cmdQ);
+}
+
+HWTEST_F(HighPriorityCommandQueueTest, GivenHighPriorityContextCreationDisabledWhenCreatingHighPriorityCommandQueueThenRegularEngineIsTaken) {
+    MockContext context;
+    cl_queue_properties properties[] = {CL_QUEUE_PRIORITY_KHR, CL_QUEUE_PRIORITY_HIGH_KHR, 0};
+    auto cmdQ = clCreateCommandQueueWithProperties(&context, context.getDevice(0), properties, nullptr);
+
+    auto commandQueueObj = castToObject<CommandQueue>(cmdQ);
+    EXPECT_FALSE(commandQueueObj->getGpgpuCommandStreamReceiver().getOsContext().isHighPriority());
+    EXPECT_EQ(QueuePriority::HIGH, commandQueueObj->getPriority());
+    clReleaseCommandQueue(cmdQ);
+}
+
 std::pair<uint32_t, QueuePriority> priorityParams[3]{
     std::make_pair(CL_QUEUE_PRIORITY_LOW_KHR, QueuePriority::LOW),
     std::make_pair(CL_QUEUE_PRIORITY_MED_KHR, QueuePriority::MEDIUM),
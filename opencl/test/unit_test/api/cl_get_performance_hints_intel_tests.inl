@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "cl_api_tests.h"
+
+using namespace NEO;
+
+using clGetPerformanceHintsINTELTests = Test<PlatformFixture>;
+
+namespace ULT {
+
+TEST_F(clGetPerformanceHintsINTELTests, GivenInvalidPlatformWhenGettingPerformanceHintsThenInvalidPlatformErrorIsReturned) {
+    cl_uint numHints = 0;
+    EXPECT_EQ(CL_INVALID_PLATFORM, clGetPerformanceHintsINTEL(nullptr, 0, nullptr, &numHints));
+}
+
+TEST_F(clGetPerformanceHintsINTELTests, GivenInvalidOutputArgumentsWhenGettingPerformanceHintsThenInvalidValueErrorIsReturned) {
+    cl_performance_hint_intel hint = {};
+    EXPECT_EQ(CL_INVALID_VALUE, clGetPerformanceHintsINTEL(pPlatform, 0, nullptr, nullptr));
+    EXPECT_EQ(CL_INVALID_VALUE, clGetPerformanceHintsINTEL(pPlatform, 0, &hint, nullptr));
+}
+
+TEST_F(clGetPerformanceHintsINTELTests, GivenPerformanceHintsDisabledWhenGettingPerformanceHintsThenNoHintsAreReturned) {
+    cl_uint numHints = 1;
+    EXPECT_EQ(CL_SUCCESS, clGetPerformanceHintsINTEL(pPlatform, 0, nullptr, &numHints));
+    EXPECT_EQ(0u, numHints);
+}
+
+} // namespace ULT
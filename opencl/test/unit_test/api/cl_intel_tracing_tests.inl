@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2019-2020 Intel Corporation
+ * Copyright (C) 2019-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "opencl/source/tracing/tracing_api.h"
+#include "opencl/source/tracing/tracing_collector.h"
 #include "opencl/source/tracing/tracing_notify.h"
 #include "opencl/test/unit_test/api/cl_api_tests.h"
 
@@ -940,4 +941,58 @@ TEST_F(IntelClGetDeviceInfoTwoHandlesTracingCollectTest, GivenTwoHandlesWhenTrac
     EXPECT_EQ(2u, exitCount);
 }
 
+TEST_F(IntelTracingTest, GivenTracingCollectorWhenApiFunctionIsCalledThenEnterAndExitRecordsAreStored) {
+    HostSideTracing::TracingCollector collector(16u);
+    EXPECT_EQ(CL_SUCCESS, collector.enable());
+
+    cl_uint computeUnits = 0u;
+    status = clGetDeviceInfo(testedClDevice, CL_DEVICE_MAX_COMPUTE_UNITS, sizeof(computeUnits), &computeUnits, nullptr);
+    EXPECT_EQ(CL_SUCCESS, status);
+    EXPECT_EQ(CL_SUCCESS, collector.disable());
+
+    EXPECT_EQ(2u, collector.getNumRecords());
+    cl_tracing_record_intel records[4] = {};
+    EXPECT_EQ(2u, collector.drain(records, 4u));
+    EXPECT_EQ(0u, collector.getNumRecords());
+
+    EXPECT_EQ(CL_FUNCTION_clGetDeviceInfo, records[0].functionId);
+    EXPECT_EQ(CL_CALLBACK_SITE_ENTER, records[0].site);
+    EXPECT_EQ(CL_FUNCTION_clGetDeviceInfo, records[1].functionId);
+    EXPECT_EQ(CL_CALLBACK_SITE_EXIT, records[1].site);
+    EXPECT_EQ(records[0].correlationId, records[1].correlationId);
+    EXPECT_EQ(records[0].threadIndex, records[1].threadIndex);
+    EXPECT_LE(records[0].timestamp, records[1].timestamp);
+}
+
+TEST(TracingRingBufferTest, GivenFullRingBufferWhenPushingRecordThenRecordIsDroppedAndCounted) {
+    HostSideTracing::TracingRingBuffer ringBuffer(2u, 0u);
+    cl_tracing_record_intel record = {};
+
+    record.correlationId = 1u;
+    EXPECT_TRUE(ringBuffer.push(record));
+    record.correlationId = 2u;
+    EXPECT_TRUE(ringBuffer.push(record));
+    record.correlationId = 3u;
+    EXPECT_FALSE(ringBuffer.push(record));
+    EXPECT_EQ(1u, ringBuffer.getNumDroppedRecords());
+
+    cl_tracing_record_intel records[2] = {};
+    EXPECT_EQ(1u, ringBuffer.pop(records, 1u));
+    EXPECT_EQ(1u, records[0].correlationId);
+
+    record.correlationId = 4u;
+    EXPECT_TRUE(ringBuffer.push(record));
+    EXPECT_EQ(2u, ringBuffer.pop(records, 2u));
+    EXPECT_EQ(2u, records[0].correlationId);
+    EXPECT_EQ(4u, records[1].correlationId);
+    EXPECT_EQ(0u, ringBuffer.getNumRecords());
+}
+
+TEST_F(IntelTracingTest, GivenTracingCollectorDisabledWhenDrainingRecordsThenInvalidOperationErrorIsReturned) {
+    ASSERT_EQ(nullptr, HostSideTracing::TracingCollector::getGlobalCollector());
+    size_t numRecords = 0u;
+    status = clDrainTracingRecordsINTEL(nullptr, 0u, &numRecords);
+    EXPECT_EQ(CL_INVALID_OPERATION, status);
+}
+
 } // namespace ULT
@@ -411,4 +411,28 @@ HWTEST_F(clSetKernelExecInfoTests, givenDifferentExecutionTypesWhenSettingAdditi
     EXPECT_EQ(KernelExecutionType::Concurrent, pMockKernel->executionType);
 }
 
+TEST_F(clSetKernelExecInfoTests, givenStatefulAccessOnlyHintWhenSettingKernelExecInfoThenAuxTranslationIsNotRequired) {
+    pMockKernel->auxTranslationRequired = true;
+    EXPECT_TRUE(pMockKernel->isAuxTranslationRequired());
+
+    cl_bool statefulAccessOnly = CL_TRUE;
+    retVal = clSetKernelExecInfo(pMockMultiDeviceKernel, CL_KERNEL_EXEC_INFO_STATEFUL_ACCESS_ONLY_INTEL, sizeof(cl_bool), &statefulAccessOnly);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_FALSE(pMockKernel->isAuxTranslationRequired());
+
+    statefulAccessOnly = CL_FALSE;
+    retVal = clSetKernelExecInfo(pMockMultiDeviceKernel, CL_KERNEL_EXEC_INFO_STATEFUL_ACCESS_ONLY_INTEL, sizeof(cl_bool), &statefulAccessOnly);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_TRUE(pMockKernel->isAuxTranslationRequired());
+}
+
+TEST_F(clSetKernelExecInfoTests, givenInvalidStatefulAccessOnlyHintParamWhenSettingKernelExecInfoThenInvalidValueIsReturned) {
+    cl_bool statefulAccessOnly = CL_TRUE;
+    retVal = clSetKernelExecInfo(pMockMultiDeviceKernel, CL_KERNEL_EXEC_INFO_STATEFUL_ACCESS_ONLY_INTEL, sizeof(cl_bool) + 1, &statefulAccessOnly);
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+
+    retVal = clSetKernelExecInfo(pMockMultiDeviceKernel, CL_KERNEL_EXEC_INFO_STATEFUL_ACCESS_ONLY_INTEL, sizeof(cl_bool), nullptr);
+    EXPECT_EQ(CL_INVALID_VALUE, retVal);
+}
+
 } // namespace ULT
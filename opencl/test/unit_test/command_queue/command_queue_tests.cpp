@@ -27,6 +27,7 @@
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/mocks/mock_memory_manager.h"
 #include "shared/test/common/mocks/mock_os_context.h"
+#include "shared/test/common/mocks/mock_timestamp_container.h"
 #include "shared/test/common/test_macros/test.h"
 #include "shared/test/common/test_macros/test_checks_shared.h"
 
@@ -415,6 +416,45 @@ HWTEST_F(CommandQueueCommandStreamTest, givenCommandQueueThatWaitsOnAbortedUserE
     EXPECT_EQ(100u, cmdQ.taskLevel);
 }
 
+HWTEST_F(CommandQueueCommandStreamTest, givenInOrderFastTrackingEnabledWhenCheckingIfAllowedThenReturnTrueOnlyForInOrderQueueWithTimestampTrackedDependencies) {
+    DebugManagerStateRestore restorer;
+    MockContext context;
+    auto mockDevice = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    auto &commandStreamReceiver = mockDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.timestampPacketWriteEnabled = true;
+
+    MockCommandQueue cmdQ(&context, mockDevice.get(), 0, false);
+    MockCommandQueue otherCmdQ(&context, mockDevice.get(), 0, false);
+    EXPECT_FALSE(cmdQ.isInOrderFastTrackingAllowed(0, nullptr));
+
+    DebugManager.flags.EnableInOrderQueueFastTracking.set(1);
+    EXPECT_TRUE(cmdQ.isInOrderFastTrackingAllowed(0, nullptr));
+
+    Event ownEvent(&cmdQ, CL_COMMAND_NDRANGE_KERNEL, 0, 0);
+    cl_event ownEventWaitList[] = {&ownEvent};
+    EXPECT_TRUE(cmdQ.isInOrderFastTrackingAllowed(1, ownEventWaitList));
+
+    Event otherQueueEvent(&otherCmdQ, CL_COMMAND_NDRANGE_KERNEL, 10, 0);
+    cl_event otherQueueEventWaitList[] = {&otherQueueEvent};
+    EXPECT_FALSE(cmdQ.isInOrderFastTrackingAllowed(1, otherQueueEventWaitList));
+
+    MockTimestampPacketContainer timestamps(*commandStreamReceiver.getTimestampPacketAllocator(), 1);
+    otherQueueEvent.addTimestampPacketNodes(timestamps);
+    EXPECT_TRUE(cmdQ.isInOrderFastTrackingAllowed(1, otherQueueEventWaitList));
+
+    UserEvent userEvent(&context);
+    cl_event userEventWaitList[] = {&userEvent};
+    EXPECT_FALSE(cmdQ.isInOrderFastTrackingAllowed(1, userEventWaitList));
+
+    commandStreamReceiver.timestampPacketWriteEnabled = false;
+    EXPECT_FALSE(cmdQ.isInOrderFastTrackingAllowed(0, nullptr));
+    commandStreamReceiver.timestampPacketWriteEnabled = true;
+
+    cl_queue_properties ooqProperties[] = {CL_QUEUE_PROPERTIES, CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE, 0};
+    MockCommandQueue ooq(&context, mockDevice.get(), ooqProperties, false);
+    EXPECT_FALSE(ooq.isInOrderFastTrackingAllowed(0, nullptr));
+}
+
 HWTEST_F(CommandQueueCommandStreamTest, WhenCheckIsTextureCacheFlushNeededThenReturnProperValue) {
     MockContext context;
     auto mockDevice = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
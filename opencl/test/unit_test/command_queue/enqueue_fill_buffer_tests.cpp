@@ -180,6 +180,38 @@ HWTEST_F(EnqueueFillBufferCmdTests, GivenMiddleWhenFillingBufferThenFillBufferMi
     context.getMemoryManager()->freeGraphicsMemory(patternAllocation);
 }
 
+HWTEST_F(EnqueueFillBufferCmdTests, GivenPatternReplicatedToVectorSizeWhenFillingBufferMiddleThenFillBufferMiddleVecKernelUsed) {
+    auto patternAllocation = context.getMemoryManager()->allocateGraphicsMemoryWithProperties(MockAllocationProperties{context.getDevice(0)->getRootDeviceIndex(), MemoryConstants::cacheLineSize});
+    uint8_t pattern = 0xAB;
+    memcpy_s(patternAllocation->getUnderlyingBuffer(), sizeof(uint32_t), &pattern, sizeof(pattern));
+    auto replicatedPatternSize = BuiltinDispatchInfoBuilder::replicateFillPattern(patternAllocation->getUnderlyingBuffer(), sizeof(uint32_t));
+    EXPECT_EQ(BuiltinDispatchInfoBuilder::fillPatternVecSize, replicatedPatternSize);
+    for (size_t i = 0; i < replicatedPatternSize; i += sizeof(uint32_t)) {
+        EXPECT_EQ(0, memcmp(ptrOffset(patternAllocation->getUnderlyingBuffer(), i), patternAllocation->getUnderlyingBuffer(), sizeof(uint32_t)));
+    }
+
+    auto &builder = BuiltInDispatchBuilderOp::getBuiltinDispatchInfoBuilder(EBuiltInOps::FillBuffer,
+                                                                            pCmdQ->getClDevice());
+
+    BuiltinOpParams dc;
+    MemObj patternMemObj(&this->context, 0, {}, 0, 0, replicatedPatternSize, patternAllocation->getUnderlyingBuffer(),
+                         patternAllocation->getUnderlyingBuffer(), GraphicsAllocationHelper::toMultiGraphicsAllocation(patternAllocation), false, false, true);
+    dc.srcMemObj = &patternMemObj;
+    dc.dstMemObj = buffer;
+    dc.dstOffset = {0, 0, 0};
+    dc.size = {2 * MemoryConstants::cacheLineSize, 0, 0};
+
+    MultiDispatchInfo mdi(dc);
+    builder.buildDispatchInfos(mdi);
+    EXPECT_EQ(1u, mdi.size());
+
+    auto kernel = mdi.begin()->getKernel();
+    EXPECT_STREQ("FillBufferMiddleVec", kernel->getKernelInfo().kernelDescriptor.kernelMetadata.kernelName.c_str());
+    EXPECT_EQ(Vec3<size_t>(2 * MemoryConstants::cacheLineSize / BuiltinDispatchInfoBuilder::fillPatternVecSize, 1, 1), mdi.begin()->getGWS());
+
+    context.getMemoryManager()->freeGraphicsMemory(patternAllocation);
+}
+
 HWTEST_F(EnqueueFillBufferCmdTests, GivenLeftLeftoverWhenFillingBufferThenFillBufferLeftLeftoverKernelUsed) {
     auto patternAllocation = context.getMemoryManager()->allocateGraphicsMemoryWithProperties(MockAllocationProperties{context.getDevice(0)->getRootDeviceIndex(), EnqueueFillBufferTraits::patternSize});
 
@@ -756,6 +756,40 @@ HWTEST_F(EnqueueKernelTest, givenGpuHangAndBlockingCallAndEnqueueWithGlobalWorkS
     EXPECT_EQ(1, mockCommandQueueHw.waitForAllEnginesCalledCount);
 }
 
+HWTEST_F(EnqueueKernelTest, givenSimple1DLaunchWhenEnqueueKernelIsCalledThenDispatchInfoMatchesTheOneBuiltByDispatchInfoBuilder) {
+    DebugManagerStateRestore stateRestore;
+    MockCommandQueueHw<FamilyType> mockCommandQueueHw(context, pClDevice, nullptr);
+    mockCommandQueueHw.storeMultiDispatchInfo = true;
+    MockKernelWithInternals mockKernel(*pClDevice);
+
+    size_t gwsOffset[3] = {16, 0, 0};
+    size_t gws[3] = {256, 1, 1};
+    size_t lws[3] = {32, 1, 1};
+    for (auto localWorkSize : {static_cast<size_t *>(nullptr), lws}) {
+        DebugManager.flags.EnableSimpleKernelEnqueue.set(-1);
+        EXPECT_EQ(CL_SUCCESS, mockCommandQueueHw.enqueueKernel(mockKernel.mockKernel, 1, gwsOffset, gws, localWorkSize, 0, nullptr, nullptr));
+        DebugManager.flags.EnableSimpleKernelEnqueue.set(0);
+        EXPECT_EQ(CL_SUCCESS, mockCommandQueueHw.enqueueKernel(mockKernel.mockKernel, 1, gwsOffset, gws, localWorkSize, 0, nullptr, nullptr));
+    }
+
+    auto &storedDispatchInfos = mockCommandQueueHw.storedMultiDispatchInfo;
+    ASSERT_EQ(4u, storedDispatchInfos.size());
+    for (auto i = 0u; i < storedDispatchInfos.size(); i += 2) {
+        auto &simpleDispatchInfo = *(storedDispatchInfos.begin() + i);
+        auto &builtDispatchInfo = *(storedDispatchInfos.begin() + i + 1);
+        EXPECT_EQ(builtDispatchInfo.getKernel(), simpleDispatchInfo.getKernel());
+        EXPECT_EQ(builtDispatchInfo.getDim(), simpleDispatchInfo.getDim());
+        EXPECT_EQ(builtDispatchInfo.getGWS(), simpleDispatchInfo.getGWS());
+        EXPECT_EQ(builtDispatchInfo.getEnqueuedWorkgroupSize(), simpleDispatchInfo.getEnqueuedWorkgroupSize());
+        EXPECT_EQ(builtDispatchInfo.getOffset(), simpleDispatchInfo.getOffset());
+        EXPECT_EQ(builtDispatchInfo.getActualWorkgroupSize(), simpleDispatchInfo.getActualWorkgroupSize());
+        EXPECT_EQ(builtDispatchInfo.getLocalWorkgroupSize(), simpleDispatchInfo.getLocalWorkgroupSize());
+        EXPECT_EQ(builtDispatchInfo.getTotalNumberOfWorkgroups(), simpleDispatchInfo.getTotalNumberOfWorkgroups());
+        EXPECT_EQ(builtDispatchInfo.getNumberOfWorkgroups(), simpleDispatchInfo.getNumberOfWorkgroups());
+        EXPECT_EQ(builtDispatchInfo.getStartOfWorkgroups(), simpleDispatchInfo.getStartOfWorkgroups());
+    }
+}
+
 HWTEST_F(EnqueueKernelTest, givenCommandStreamReceiverInBatchingModeWhenEnqueueKernelIsCalledThenKernelIsRecorded) {
     auto mockCsr = new MockCsrHw2<FamilyType>(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
     mockCsr->useNewResourceImplicitFlush = false;
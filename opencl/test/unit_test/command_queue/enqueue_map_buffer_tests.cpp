@@ -7,6 +7,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/memory_manager/os_agnostic_memory_manager.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_gmm.h"
 #include "shared/test/common/test_macros/test.h"
@@ -771,3 +772,61 @@ HWTEST_F(EnqueueMapBufferTest, givenMapBufferOnGpuWhenMappingBufferThenStoreGrap
     EXPECT_TRUE(bufferForGpuMap->findMappedPtr(pointerMappedOnGpu, mapInfo));
     EXPECT_NE(nullptr, mapInfo.graphicsAllocation);
 }
+
+HWTEST_F(EnqueueMapBufferTest, givenPersistentMapEnabledAndLocalMemoryBufferWhenMappingAndUnmappingThenLockedPointerIsReturnedWithoutTransfers) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnablePersistentMapForLocalMemoryBuffers.set(1);
+
+    std::unique_ptr<Buffer> buffer(Buffer::create(context, CL_MEM_READ_WRITE, 64, nullptr, retVal));
+    ASSERT_NE(nullptr, buffer);
+    auto graphicsAllocation = buffer->getGraphicsAllocation(pClDevice->getRootDeviceIndex());
+    static_cast<MemoryAllocation *>(graphicsAllocation)->overrideMemoryPool(MemoryPool::LocalMemory);
+    ASSERT_FALSE(buffer->mappingOnCpuAllowed());
+    ASSERT_TRUE(buffer->isPersistentMappingAllowed(pClDevice->getDevice()));
+    graphicsAllocation->setAubWritable(false, GraphicsAllocation::defaultBank);
+    graphicsAllocation->setTbxWritable(false, GraphicsAllocation::defaultBank);
+
+    size_t mapOffset = 8;
+    size_t mapSize = 16;
+    auto mappedPtr = pCmdQ->enqueueMapBuffer(buffer.get(), CL_TRUE, CL_MAP_WRITE, mapOffset, mapSize, 0, nullptr, nullptr, retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_TRUE(graphicsAllocation->isLocked());
+    EXPECT_EQ(ptrOffset(graphicsAllocation->getLockedPtr(), mapOffset), mappedPtr);
+    EXPECT_EQ(nullptr, buffer->getMapAllocation(pClDevice->getRootDeviceIndex()));
+
+    MapInfo mapInfo{};
+    EXPECT_TRUE(buffer->findMappedPtr(mappedPtr, mapInfo));
+    EXPECT_EQ(graphicsAllocation, mapInfo.graphicsAllocation);
+    EXPECT_EQ(mapSize, mapInfo.size[0]);
+    EXPECT_EQ(mapOffset, mapInfo.offset[0]);
+
+    memset(mappedPtr, 0xAB, mapSize);
+    retVal = pCmdQ->enqueueUnmapMemObject(buffer.get(), mappedPtr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_FALSE(buffer->findMappedPtr(mappedPtr, mapInfo));
+    EXPECT_TRUE(graphicsAllocation->isAubWritable(GraphicsAllocation::defaultBank));
+    EXPECT_TRUE(graphicsAllocation->isTbxWritable(GraphicsAllocation::defaultBank));
+    EXPECT_EQ(0xAB, *reinterpret_cast<uint8_t *>(ptrOffset(graphicsAllocation->getUnderlyingBuffer(), mapOffset)));
+    EXPECT_EQ(nullptr, buffer->getMapAllocation(pClDevice->getRootDeviceIndex()));
+
+    auto mappedAgainPtr = pCmdQ->enqueueMapBuffer(buffer.get(), CL_TRUE, CL_MAP_READ, mapOffset, mapSize, 0, nullptr, nullptr, retVal);
+    EXPECT_EQ(mappedPtr, mappedAgainPtr);
+    EXPECT_EQ(CL_SUCCESS, pCmdQ->enqueueUnmapMemObject(buffer.get(), mappedAgainPtr, 0, nullptr, nullptr));
+
+    static_cast<MemoryAllocation *>(graphicsAllocation)->overrideMemoryPool(MemoryPool::System4KBPages);
+}
+
+TEST_F(EnqueueMapBufferTest, givenPersistentMapDisabledWhenCheckingIfPersistentMappingIsAllowedThenReturnFalse) {
+    std::unique_ptr<Buffer> buffer(Buffer::create(context, CL_MEM_READ_WRITE, 64, nullptr, retVal));
+    ASSERT_NE(nullptr, buffer);
+    auto graphicsAllocation = buffer->getGraphicsAllocation(pClDevice->getRootDeviceIndex());
+    static_cast<MemoryAllocation *>(graphicsAllocation)->overrideMemoryPool(MemoryPool::LocalMemory);
+    EXPECT_FALSE(buffer->isPersistentMappingAllowed(pClDevice->getDevice()));
+
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnablePersistentMapForLocalMemoryBuffers.set(1);
+    EXPECT_TRUE(buffer->isPersistentMappingAllowed(pClDevice->getDevice()));
+
+    static_cast<MemoryAllocation *>(graphicsAllocation)->overrideMemoryPool(MemoryPool::System4KBPages);
+    EXPECT_FALSE(buffer->isPersistentMappingAllowed(pClDevice->getDevice()));
+}
@@ -777,3 +777,35 @@ HWTEST_F(EnqueueWriteImageTest, givenMultiRootDeviceImageWhenNonBlockedEnqueueWr
     pCmdQ1->release();
     pImage->release();
 }
+
+HWTEST_F(EnqueueWriteImageTest, givenWriteImageChunkSizeSetWhenWritingImageFromHostMemoryThenRowRangesAreEnqueuedSeparately) {
+    DebugManagerStateRestore restorer;
+
+    const auto &imageDesc = dstImage->getImageDesc();
+    const size_t rowPitch = imageDesc.image_width * dstImage->getSurfaceFormatInfo().surfaceFormat.ImageElementSizeInBytes;
+    const size_t rowsPerChunk = 4u;
+    DebugManager.flags.WriteImageChunkSize.set(static_cast<int32_t>(rowsPerChunk * rowPitch));
+
+    size_t origin[] = {0, 0, 0};
+    size_t region[] = {imageDesc.image_width, imageDesc.image_height, 1};
+    cl_event event = nullptr;
+    auto taskCountBefore = pCmdQ->taskCount;
+
+    auto retVal = pCmdQ->enqueueWriteImage(dstImage, CL_TRUE, origin, region, rowPitch, 0, srcPtr, nullptr, 0, nullptr, &event);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    auto expectedChunks = static_cast<uint32_t>(Math::divideAndRoundUp(imageDesc.image_height, rowsPerChunk));
+    EXPECT_EQ(taskCountBefore + expectedChunks, pCmdQ->taskCount);
+
+    ASSERT_NE(nullptr, event);
+    auto pEvent = castToObject<Event>(event);
+    EXPECT_EQ(static_cast<cl_command_type>(CL_COMMAND_WRITE_IMAGE), pEvent->getCommandType());
+    EXPECT_EQ(pCmdQ->taskCount, pEvent->peekTaskCount());
+    pEvent->release();
+
+    DebugManager.flags.WriteImageChunkSize.set(-1);
+    taskCountBefore = pCmdQ->taskCount;
+    retVal = pCmdQ->enqueueWriteImage(dstImage, CL_TRUE, origin, region, rowPitch, 0, srcPtr, nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(taskCountBefore + 1, pCmdQ->taskCount);
+}
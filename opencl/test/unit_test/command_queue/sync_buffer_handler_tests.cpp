@@ -189,6 +189,26 @@ HWTEST_TEMPLATED_F(SyncBufferHandlerTest, GivenSyncBufferFullWhenEnqueuingKernel
     EXPECT_EQ(workItemsCount, syncBufferHandler->usedBufferSize);
 }
 
+HWTEST_TEMPLATED_F(SyncBufferHandlerTest, GivenSyncBufferFullAndNotUsedByGpuWhenEnqueuingKernelThenBufferIsClearedAndReused) {
+    patchAllocateSyncBuffer();
+    enqueueNDCount();
+    commandQueue->flush();
+    auto syncBufferHandler = getSyncBufferHandler();
+    auto syncBufferAllocation = syncBufferHandler->graphicsAllocation;
+    auto syncBufferMemory = static_cast<uint8_t *>(syncBufferAllocation->getUnderlyingBuffer());
+
+    auto &csr = commandQueue->getGpgpuCommandStreamReceiver();
+    *csr.getTagAddress() = csr.peekTaskCount();
+    memset(syncBufferMemory, 1, syncBufferHandler->bufferSize);
+
+    syncBufferHandler->usedBufferSize = syncBufferHandler->bufferSize;
+    enqueueNDCount();
+    EXPECT_EQ(syncBufferAllocation, syncBufferHandler->graphicsAllocation);
+    EXPECT_EQ(workItemsCount, syncBufferHandler->usedBufferSize);
+    EXPECT_EQ(0u, syncBufferMemory[0]);
+    EXPECT_EQ(0u, syncBufferMemory[syncBufferHandler->bufferSize - 1]);
+}
+
 HWTEST_TEMPLATED_F(SyncBufferHandlerTest, GivenSshRequiredWhenPatchingSyncBufferThenSshIsProperlyPatched) {
     using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
     kernelInternals->kernelInfo.setBufferAddressingMode(KernelDescriptor::BindfulAndStateless);
@@ -1998,3 +1998,54 @@ HWTEST_F(CommandStreamReceiverFlushTaskTests, givenWaitForCompletionWithTimeoutI
     mockCsr.submissionAggregator->recordCommandBuffer(cmdBuffer.release());
     EXPECT_EQ(NEO::WaitStatus::NotReady, mockCsr.waitForCompletionWithTimeout(WaitParams{false, false, 0}, 1));
 }
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenTagWriteCoalescingEnabledWhenNonBlockingTasksAreFlushedThenTagIsWrittenEveryNthTaskAndOnFlush) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CoalesceTaskCountTagWrites.set(3);
+
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.overrideDispatchPolicy(DispatchMode::ImmediateDispatch);
+
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+
+    auto flushTask = [&]() {
+        auto flags = dispatchFlags;
+        commandStreamReceiver.flushTask(commandStream, 0, &dsh, &ioh, &ssh, taskLevel, flags, *pDevice);
+    };
+
+    flushTask();
+    flushTask();
+    EXPECT_EQ(2u, commandStreamReceiver.coalescedTagWrites);
+    EXPECT_EQ(0u, commandStreamReceiver.peekLatestFlushedTaskCount());
+
+    flushTask();
+    EXPECT_EQ(0u, commandStreamReceiver.coalescedTagWrites);
+    EXPECT_EQ(3u, commandStreamReceiver.peekLatestFlushedTaskCount());
+
+    flushTask();
+    EXPECT_EQ(1u, commandStreamReceiver.coalescedTagWrites);
+    EXPECT_EQ(3u, commandStreamReceiver.peekLatestFlushedTaskCount());
+
+    EXPECT_TRUE(commandStreamReceiver.flushBatchedSubmissions());
+    EXPECT_EQ(0u, commandStreamReceiver.coalescedTagWrites);
+    EXPECT_EQ(commandStreamReceiver.peekTaskCount(), commandStreamReceiver.peekLatestFlushedTaskCount());
+}
+
+HWTEST_F(CommandStreamReceiverFlushTaskTests, givenTagWriteCoalescingEnabledWhenBlockingTaskIsFlushedThenTagIsAlwaysWritten) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.CoalesceTaskCountTagWrites.set(3);
+
+    auto &commandStreamReceiver = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.overrideDispatchPolicy(DispatchMode::ImmediateDispatch);
+
+    DispatchFlags dispatchFlags = DispatchFlagsHelper::createDefaultDispatchFlags();
+    dispatchFlags.preemptionMode = PreemptionHelper::getDefaultPreemptionMode(pDevice->getHardwareInfo());
+    dispatchFlags.guardCommandBufferWithPipeControl = true;
+    dispatchFlags.blocking = true;
+
+    commandStreamReceiver.flushTask(commandStream, 0, &dsh, &ioh, &ssh, taskLevel, dispatchFlags, *pDevice);
+    EXPECT_EQ(0u, commandStreamReceiver.coalescedTagWrites);
+    EXPECT_EQ(1u, commandStreamReceiver.peekLatestFlushedTaskCount());
+}
@@ -1166,6 +1166,52 @@ HWTEST_F(EngineInstancedDeviceTests, givenCmdQRoundRobindEngineAssignNTo1AndCmdQ
     }
 }
 
+HWTEST_F(EngineInstancedDeviceTests, givenCmdQRoundRobindEngineAssignLeastLoadedWhenCommandQueuesAreReleasedAndCreatedThenEnginesWithFewestQueuesAreAssigned) {
+    constexpr uint32_t genericDevicesCount = 1;
+    constexpr uint32_t ccsCount = 4;
+
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableCmdQRoundRobindEngineAssign.set(1);
+    DebugManager.flags.CmdQRoundRobindEngineAssignLeastLoaded.set(1);
+
+    if (!createDevices(genericDevicesCount, ccsCount)) {
+        GTEST_SKIP();
+    }
+
+    auto &hwInfo = rootDevice->getHardwareInfo();
+    const auto &hwHelper = NEO::HwHelper::get(hwInfo.platform.eRenderCoreFamily);
+
+    if (!hwHelper.isAssignEngineRoundRobinSupported(hwInfo)) {
+        GTEST_SKIP();
+    }
+
+    auto clRootDevice = std::make_unique<ClDevice>(*rootDevice, nullptr);
+    cl_device_id deviceIds[] = {clRootDevice.get()};
+    ClDeviceVector deviceVector{deviceIds, 1};
+    MockContext context(deviceVector);
+
+    const auto &defaultEngine = clRootDevice->getDefaultEngine();
+    const auto engineGroupType = hwHelper.getEngineGroupType(defaultEngine.getEngineType(), defaultEngine.getEngineUsage(), hwInfo);
+
+    auto defaultEngineGroupIndex = clRootDevice->getDevice().getEngineGroupIndexFromEngineGroupType(engineGroupType);
+    auto engines = clRootDevice->getDevice().getRegularEngineGroups()[defaultEngineGroupIndex].engines;
+    ASSERT_EQ(ccsCount, engines.size());
+
+    std::array<std::unique_ptr<MockCommandQueueHw<FamilyType>>, ccsCount> cmdQs;
+    for (size_t i = 0; i < cmdQs.size(); i++) {
+        cmdQs[i] = std::make_unique<MockCommandQueueHw<FamilyType>>(&context, clRootDevice.get(), nullptr);
+        EXPECT_EQ(engines[i].commandStreamReceiver, &cmdQs[i]->getGpgpuCommandStreamReceiver());
+    }
+
+    cmdQs[1].reset();
+    cmdQs[2].reset();
+
+    cmdQs[1] = std::make_unique<MockCommandQueueHw<FamilyType>>(&context, clRootDevice.get(), nullptr);
+    EXPECT_EQ(engines[1].commandStreamReceiver, &cmdQs[1]->getGpgpuCommandStreamReceiver());
+    cmdQs[2] = std::make_unique<MockCommandQueueHw<FamilyType>>(&context, clRootDevice.get(), nullptr);
+    EXPECT_EQ(engines[2].commandStreamReceiver, &cmdQs[2]->getGpgpuCommandStreamReceiver());
+}
+
 HWTEST_F(EngineInstancedDeviceTests, givenEnableCmdQRoundRobindEngineAssignDisabledWenCreateMultipleCommandQueuesThenDefaultEngineAssigned) {
     constexpr uint32_t genericDevicesCount = 1;
     constexpr uint32_t ccsCount = 4;
@@ -388,3 +388,85 @@ TEST_F(AsyncEventsHandlerTests, WhenReturningThenAsyncProcessWillCallProcessList
 
     event->release();
 }
+
+TEST_F(AsyncEventsHandlerTests, givenSubmittedEventsWhenTagIsBelowTaskCountThenExecutionStatusIsNotUpdated) {
+    struct CountingEvent : Event {
+        using Event::Event;
+        void updateExecutionStatus() override {
+            ++updateCount;
+            Event::updateExecutionStatus();
+        }
+        int updateCount = 0;
+    };
+
+    auto countingEvent1 = makeReleaseable<CountingEvent>(commandQueue.get(), CL_COMMAND_BARRIER, 0u, 5u);
+    auto countingEvent2 = makeReleaseable<CountingEvent>(commandQueue.get(), CL_COMMAND_BARRIER, 0u, 6u);
+    *(commandQueue->getGpgpuCommandStreamReceiver().getTagAddress()) = 4;
+
+    countingEvent1->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+    countingEvent2->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+    handler->registerEvent(countingEvent1.get());
+    handler->registerEvent(countingEvent2.get());
+
+    handler->process();
+    EXPECT_EQ(CL_SUBMITTED, countingEvent1->peekExecutionStatus());
+    EXPECT_EQ(CL_SUBMITTED, countingEvent2->peekExecutionStatus());
+    countingEvent1->updateCount = 0;
+    countingEvent2->updateCount = 0;
+
+    handler->process();
+    EXPECT_EQ(0, countingEvent1->updateCount);
+    EXPECT_EQ(0, countingEvent2->updateCount);
+    EXPECT_EQ(0, counter);
+
+    *(commandQueue->getGpgpuCommandStreamReceiver().getTagAddress()) = 5;
+    handler->process();
+    EXPECT_EQ(1, countingEvent1->updateCount);
+    EXPECT_EQ(0, countingEvent2->updateCount);
+    EXPECT_EQ(CL_COMPLETE, countingEvent1->peekExecutionStatus());
+    EXPECT_EQ(1, counter);
+    EXPECT_FALSE(handler->peekIsListEmpty());
+
+    *(commandQueue->getGpgpuCommandStreamReceiver().getTagAddress()) = 6;
+    handler->process();
+    EXPECT_EQ(2, counter);
+    EXPECT_TRUE(handler->peekIsListEmpty());
+}
+
+TEST_F(AsyncEventsHandlerTests, givenCallbackProcessAllowedWhenReadyEventIsProcessedThenItIsPassedToCallbackQueue) {
+    event1->setTaskStamp(0, 1);
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+    handler->registerEvent(event1.get());
+    handler->process();
+    EXPECT_EQ(CL_SUBMITTED, event1->getExecutionStatus());
+
+    handler->allowCallbackProcess = true;
+    *(commandQueue->getGpgpuCommandStreamReceiver().getTagAddress()) = 1;
+    handler->process();
+    EXPECT_TRUE(handler->peekIsListEmpty());
+    ASSERT_EQ(1u, handler->callbackQueue.size());
+    EXPECT_EQ(event1.get(), handler->callbackQueue.front());
+    EXPECT_EQ(0, counter);
+    EXPECT_EQ(3, event1->getRefInternalCount());
+
+    handler->allowCallbackProcess = false;
+    MockHandler::callbackProcess(handler.get()); // drain callback queue and exit because of allowCallbackProcess == false
+    EXPECT_TRUE(handler->callbackQueue.empty());
+    EXPECT_EQ(1, counter);
+    EXPECT_EQ(CL_COMPLETE, event1->getExecutionStatus());
+    EXPECT_EQ(1, event1->getRefInternalCount());
+    EXPECT_TRUE(handler->peekIsRegisterListEmpty());
+}
+
+TEST_F(AsyncEventsHandlerTests, givenCallbackThreadsCountSetWhenThreadIsOpenedThenCallbackThreadsAreCreatedAndClosedWithHandlerThread) {
+    DebugManager.flags.AsyncEventsHandlerCallbackThreads.set(2);
+    handler->allowThreadCreating = true;
+    handler->openThread();
+    EXPECT_EQ(2u, handler->callbackThreads.size());
+    EXPECT_TRUE(handler->allowCallbackProcess);
+
+    handler->closeThread();
+    EXPECT_EQ(0u, handler->callbackThreads.size());
+    EXPECT_FALSE(handler->allowCallbackProcess);
+    EXPECT_EQ(nullptr, handler->thread.get());
+}
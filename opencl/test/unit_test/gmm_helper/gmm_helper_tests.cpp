@@ -1126,6 +1126,48 @@ TEST(GmmHelperTest, givenGmmHelperAndForceAllResourcesUncachedDebugVariableSetTh
     GmmHelper::createGmmContextWrapperFunc = createGmmContextSave;
 }
 
+TEST(GmmHelperTest, givenGmmHelperWhenGettingMocsOfSameUsageMultipleTimesThenGmmIsQueriedOnce) {
+    VariableBackup<decltype(GmmHelper::createGmmContextWrapperFunc)> createGmmContextBackup(&GmmHelper::createGmmContextWrapperFunc, GmmClientContext::create<MockGmmClientContext>);
+
+    auto gmmHelper = std::make_unique<GmmHelper>(nullptr, defaultHwInfo.get());
+    auto gmmClientContext = static_cast<MockGmmClientContext *>(gmmHelper->getClientContext());
+
+    EXPECT_EQ(16u, gmmHelper->getMOCS(GMM_RESOURCE_USAGE_OCL_BUFFER));
+    EXPECT_EQ(16u, gmmHelper->getMOCS(GMM_RESOURCE_USAGE_OCL_BUFFER));
+    EXPECT_EQ(1u, gmmClientContext->cachePolicyGetMemoryObjectCalled);
+
+    EXPECT_EQ(2u, gmmHelper->getMOCS(GMM_RESOURCE_USAGE_OCL_STATE_HEAP_BUFFER));
+    EXPECT_EQ(2u, gmmClientContext->cachePolicyGetMemoryObjectCalled);
+
+    gmmHelper->forceAllResourcesUncached();
+    EXPECT_EQ(0u, gmmHelper->getMOCS(GMM_RESOURCE_USAGE_OCL_BUFFER));
+    EXPECT_EQ(0u, gmmHelper->getMOCS(GMM_RESOURCE_USAGE_OCL_STATE_HEAP_BUFFER));
+    EXPECT_EQ(3u, gmmClientContext->cachePolicyGetMemoryObjectCalled);
+}
+
+TEST(GmmHelperTest, givenDeferGmmClientContextCreationWhenCreatingGmmHelperThenClientContextIsCreatedOnFirstUse) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DeferGmmClientContextCreation.set(1);
+
+    static uint32_t createGmmContextCalled = 0u;
+    createGmmContextCalled = 0u;
+    VariableBackup<decltype(GmmHelper::createGmmContextWrapperFunc)> createGmmContextBackup(&GmmHelper::createGmmContextWrapperFunc, [](OSInterface *osInterface, HardwareInfo *hwInfo) {
+        createGmmContextCalled++;
+        return GmmClientContext::create<MockGmmClientContext>(osInterface, hwInfo);
+    });
+
+    auto gmmHelper = std::make_unique<GmmHelper>(nullptr, defaultHwInfo.get());
+    EXPECT_EQ(0u, createGmmContextCalled);
+
+    EXPECT_EQ(16u, gmmHelper->getMOCS(GMM_RESOURCE_USAGE_OCL_BUFFER));
+    EXPECT_EQ(1u, createGmmContextCalled);
+
+    auto gmmClientContext = gmmHelper->getClientContext();
+    EXPECT_NE(nullptr, gmmClientContext);
+    EXPECT_EQ(gmmClientContext, gmmHelper->getClientContext());
+    EXPECT_EQ(1u, createGmmContextCalled);
+}
+
 struct GmmCompressionTests : public MockExecutionEnvironmentGmmFixtureTest {
     void SetUp() override {
         MockExecutionEnvironmentGmmFixtureTest::SetUp();
@@ -26,6 +26,7 @@
 #include "opencl/source/helpers/hardware_commands_helper.h"
 #include "opencl/test/unit_test/fixtures/hello_world_fixture.h"
 #include "opencl/test/unit_test/fixtures/image_fixture.h"
+#include "opencl/test/unit_test/mocks/mock_mdi.h"
 
 #include <iostream>
 using namespace NEO;
@@ -1497,6 +1498,29 @@ HWCMDTEST_F(IGFX_XE_HP_CORE, HardwareCommandsTestXeHpAndLater, givenSendCrossThr
     EXPECT_EQ(PatchInfoAllocationType::IndirectObjectHeap, kernel->getPatchInfoDataList()[0].targetType);
 }
 
+HWCMDTEST_F(IGFX_XE_HP_CORE, HardwareCommandsTestXeHpAndLater, givenLocalIdsGeneratedByHwWhenGettingTotalSizeRequiredIohThenPerThreadDataIsNotIncluded) {
+    DebugManagerStateRestore restorer;
+    auto &kernelAttributes = mockKernelWithInternal->kernelInfo.kernelDescriptor.kernelAttributes;
+    kernelAttributes.simdSize = 16;
+    kernelAttributes.numLocalIdChannels = 3;
+
+    auto kernel = mockKernelWithInternal->mockKernel;
+    MockMultiDispatchInfo multiDispatchInfo(pClDevice, kernel);
+    multiDispatchInfo.begin()->setLWS({64, 4, 1});
+
+    size_t localWorkSizes[3] = {64, 4, 1};
+    DebugManager.flags.EnableHwGenerationLocalIds.set(1);
+    EXPECT_FALSE(HardwareCommandsHelper<FamilyType>::isRuntimeLocalIdsGenerationRequired(*kernel, localWorkSizes));
+    auto sizeWithHwGeneration = HardwareCommandsHelper<FamilyType>::getTotalSizeRequiredIOH(multiDispatchInfo);
+
+    DebugManager.flags.EnableHwGenerationLocalIds.set(0);
+    EXPECT_TRUE(HardwareCommandsHelper<FamilyType>::isRuntimeLocalIdsGenerationRequired(*kernel, localWorkSizes));
+    auto sizeWithRuntimeGeneration = HardwareCommandsHelper<FamilyType>::getTotalSizeRequiredIOH(multiDispatchInfo);
+
+    EXPECT_EQ(alignUp(HardwareCommandsHelper<FamilyType>::getSizeRequiredIOH(*kernel, 0u), MemoryConstants::pageSize), sizeWithHwGeneration);
+    EXPECT_EQ(alignUp(HardwareCommandsHelper<FamilyType>::getSizeRequiredIOH(*kernel, 256u), MemoryConstants::pageSize), sizeWithRuntimeGeneration);
+}
+
 HWCMDTEST_F(IGFX_XE_HP_CORE, HardwareCommandsTestXeHpAndLater, whenGetSizeRequiredForCacheFlushIsCalledThenExceptionIsThrown) {
     CommandQueueHw<FamilyType> cmdQ(pContext, pClDevice, 0, false);
 
@@ -10,6 +10,7 @@
 #include "shared/source/helpers/local_id_gen.h"
 #include "shared/source/helpers/per_thread_data.h"
 #include "shared/source/program/kernel_info.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
@@ -111,6 +112,46 @@ HWTEST_F(PerThreadDataXYZTests, Given2x4x8WhenSendingPerThreadDataThenCorrectAmo
     EXPECT_EQ(64u * (3u * 2u * 4u * 8u) / 32u, sizeConsumed);
 }
 
+struct MockPerThreadDataCache : public PerThreadDataCache {
+    using PerThreadDataCache::entries;
+};
+
+HWTEST_F(PerThreadDataXYZTests, GivenPerThreadDataCacheWhenSendingPerThreadDataForSameWorkGroupTwiceThenCachedLocalIdsAreCopied) {
+    MockGraphicsAllocation gfxAllocation(indirectHeapMemory, indirectHeapMemorySize);
+    LinearStream indirectHeap(&gfxAllocation);
+    MockPerThreadDataCache perThreadDataCache;
+
+    const std::array<uint16_t, 3> localWorkSizes = {{2, 4, 8}};
+    auto offsetFirst = PerThreadDataHelper::sendPerThreadData(indirectHeap, simd, grfSize, numChannels, localWorkSizes, workgroupWalkOrder, false, &perThreadDataCache);
+    auto sizePerThreadData = indirectHeap.getUsed() - offsetFirst;
+    ASSERT_EQ(1u, perThreadDataCache.entries.size());
+    EXPECT_EQ(sizePerThreadData, perThreadDataCache.entries[0].size);
+    EXPECT_EQ(0, memcmp(ptrOffset(indirectHeapMemory, offsetFirst), perThreadDataCache.entries[0].data.get(), sizePerThreadData));
+
+    perThreadDataCache.entries[0].data[0] = 0xAB;
+    auto offsetSecond = PerThreadDataHelper::sendPerThreadData(indirectHeap, simd, grfSize, numChannels, localWorkSizes, workgroupWalkOrder, false, &perThreadDataCache);
+    EXPECT_EQ(sizePerThreadData, indirectHeap.getUsed() - offsetSecond);
+    EXPECT_EQ(1u, perThreadDataCache.entries.size());
+    EXPECT_EQ(0xAB, *reinterpret_cast<uint8_t *>(ptrOffset(indirectHeapMemory, offsetSecond)));
+    EXPECT_EQ(0, memcmp(ptrOffset(indirectHeapMemory, offsetFirst + 1), ptrOffset(indirectHeapMemory, offsetSecond + 1), sizePerThreadData - 1));
+
+    const std::array<uint16_t, 3> otherLocalWorkSizes = {{4, 4, 4}};
+    PerThreadDataHelper::sendPerThreadData(indirectHeap, simd, grfSize, numChannels, otherLocalWorkSizes, workgroupWalkOrder, false, &perThreadDataCache);
+    EXPECT_EQ(2u, perThreadDataCache.entries.size());
+}
+
+HWTEST_F(PerThreadDataXYZTests, GivenPerThreadDataCacheDisabledWhenSendingPerThreadDataThenCacheIsNotUsed) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnablePerThreadDataCache.set(0);
+    MockGraphicsAllocation gfxAllocation(indirectHeapMemory, indirectHeapMemorySize);
+    LinearStream indirectHeap(&gfxAllocation);
+    MockPerThreadDataCache perThreadDataCache;
+
+    const std::array<uint16_t, 3> localWorkSizes = {{2, 4, 8}};
+    PerThreadDataHelper::sendPerThreadData(indirectHeap, simd, grfSize, numChannels, localWorkSizes, workgroupWalkOrder, false, &perThreadDataCache);
+    EXPECT_EQ(0u, perThreadDataCache.entries.size());
+}
+
 HWTEST_F(PerThreadDataXYZTests, GivenDifferentSimdWhenGettingThreadPayloadSizeThenCorrectSizeIsReturned) {
     kernelInfo.kernelDescriptor.kernelAttributes.simdSize = 32;
     uint32_t size = PerThreadDataHelper::getThreadPayloadSize(kernelInfo.kernelDescriptor, grfSize);
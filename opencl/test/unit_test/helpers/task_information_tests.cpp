@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/memory_manager/internal_allocation_storage.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_csr.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
@@ -216,6 +217,76 @@ TEST(KernelOperationDestruction, givenKernelOperationWhenItIsDestructedThenAllAl
     EXPECT_TRUE(allocationsForReuse.peekContains(heapAllocation3));
 }
 
+TEST(KernelOperationDestruction, givenKernelOperationWithResourcePoolWhenItIsDestructedThenAllocationsAreStoredForReuseAndStreamsAreRecycled) {
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    MockCommandQueue cmdQ(nullptr, device.get(), nullptr, false);
+    InternalAllocationStorage &allocationStorage = *device->getDefaultEngine().commandStreamReceiver->getInternalAllocationStorage();
+    auto &allocationsForReuse = allocationStorage.getAllocationsForReuse();
+    KernelOperationResourcePool resourcePool;
+
+    EXPECT_EQ(nullptr, resourcePool.obtainHeap(IndirectHeap::Type::DYNAMIC_STATE));
+
+    IndirectHeap *ih1 = nullptr, *ih2 = nullptr, *ih3 = nullptr;
+    cmdQ.allocateHeapMemory(IndirectHeap::Type::DYNAMIC_STATE, 1, ih1);
+    cmdQ.allocateHeapMemory(IndirectHeap::Type::INDIRECT_OBJECT, 1, ih2);
+    cmdQ.allocateHeapMemory(IndirectHeap::Type::SURFACE_STATE, 1, ih3);
+    auto cmdStream = resourcePool.obtainCommandStream();
+    ASSERT_NE(nullptr, cmdStream);
+    device->getDefaultEngine().commandStreamReceiver->ensureCommandBufferAllocation(*cmdStream, 1, 0);
+
+    auto &heapAllocation1 = *ih1->getGraphicsAllocation();
+    auto &heapAllocation2 = *ih2->getGraphicsAllocation();
+    auto &heapAllocation3 = *ih3->getGraphicsAllocation();
+    auto &cmdStreamAllocation = *cmdStream->getGraphicsAllocation();
+
+    auto kernelOperation = std::make_unique<KernelOperation>(cmdStream, allocationStorage);
+    kernelOperation->setHeaps(ih1, ih2, ih3);
+    kernelOperation->setResourcePool(&resourcePool);
+
+    kernelOperation.reset();
+    EXPECT_TRUE(allocationsForReuse.peekContains(cmdStreamAllocation));
+    EXPECT_TRUE(allocationsForReuse.peekContains(heapAllocation1));
+    EXPECT_TRUE(allocationsForReuse.peekContains(heapAllocation2));
+    EXPECT_TRUE(allocationsForReuse.peekContains(heapAllocation3));
+
+    auto recycledCmdStream = std::unique_ptr<LinearStream>(resourcePool.obtainCommandStream());
+    EXPECT_EQ(cmdStream, recycledCmdStream.get());
+    EXPECT_EQ(nullptr, recycledCmdStream->getGraphicsAllocation());
+    EXPECT_EQ(0u, recycledCmdStream->getMaxAvailableSpace());
+
+    auto recycledDsh = std::unique_ptr<IndirectHeap>(resourcePool.obtainHeap(IndirectHeap::Type::DYNAMIC_STATE));
+    auto recycledIoh = std::unique_ptr<IndirectHeap>(resourcePool.obtainHeap(IndirectHeap::Type::INDIRECT_OBJECT));
+    auto recycledSsh = std::unique_ptr<IndirectHeap>(resourcePool.obtainHeap(IndirectHeap::Type::SURFACE_STATE));
+    EXPECT_EQ(ih1, recycledDsh.get());
+    EXPECT_EQ(ih2, recycledIoh.get());
+    EXPECT_EQ(ih3, recycledSsh.get());
+    EXPECT_EQ(nullptr, recycledSsh->getGraphicsAllocation());
+
+    IndirectHeap *recycledSshPtr = recycledSsh.release();
+    cmdQ.allocateHeapMemory(IndirectHeap::Type::SURFACE_STATE, 1, recycledSshPtr);
+    recycledSsh.reset(recycledSshPtr);
+    EXPECT_EQ(ih3, recycledSsh.get());
+    ASSERT_NE(nullptr, recycledSsh->getGraphicsAllocation());
+    EXPECT_NE(0u, recycledSsh->getMaxAvailableSpace());
+    allocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(recycledSsh->getGraphicsAllocation()), REUSABLE_ALLOCATION);
+}
+
+TEST(KernelOperationResourcePoolTest, givenEnableKernelOperationResourcePoolFlagWhenCommandQueueIsCreatedThenResourcePoolIsCreatedAccordingly) {
+    DebugManagerStateRestore restorer;
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+
+    {
+        MockCommandQueue cmdQ(nullptr, device.get(), nullptr, false);
+        EXPECT_NE(nullptr, cmdQ.getKernelOperationResourcePool());
+    }
+
+    DebugManager.flags.EnableKernelOperationResourcePool.set(0);
+    {
+        MockCommandQueue cmdQ(nullptr, device.get(), nullptr, false);
+        EXPECT_EQ(nullptr, cmdQ.getKernelOperationResourcePool());
+    }
+}
+
 template <typename GfxFamily>
 class MockCsr1 : public CommandStreamReceiverHw<GfxFamily> {
   public:
@@ -19,12 +19,14 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/test/common/fixtures/memory_management_fixture.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/engine_descriptor_helper.h"
 #include "shared/test/common/helpers/gtest_helpers.h"
 #include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_allocation_properties.h"
 #include "shared/test/common/mocks/mock_cpu_page_fault_manager.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/mocks/mock_memory_manager.h"
+#include "shared/test/common/mocks/mock_os_context.h"
 #include "shared/test/common/mocks/mock_timestamp_container.h"
 #include "shared/test/common/test_macros/hw_test.h"
 #include "shared/test/common/utilities/base_object_utils.h"
@@ -33,6 +35,7 @@
 #include "opencl/source/helpers/cl_hw_helper.h"
 #include "opencl/source/helpers/cl_memory_properties_helpers.h"
 #include "opencl/source/kernel/kernel.h"
+#include "opencl/source/mem_obj/buffer.h"
 #include "opencl/source/mem_obj/image.h"
 #include "opencl/test/unit_test/fixtures/cl_device_fixture.h"
 #include "opencl/test/unit_test/fixtures/multi_root_device_fixture.h"
@@ -1197,6 +1200,42 @@ HWTEST_F(KernelResidencyTest, givenKernelWhenItUsesIndirectUnifiedMemoryDeviceAl
     svmAllocationsManager->freeSVMAlloc(unifiedMemoryAllocation);
 }
 
+HWTEST_F(KernelResidencyTest, givenIndirectAllocationsResidentAsPackWhenKernelIsMadeResidentAgainThenOnlyNewAllocationsAreMadeResident) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.MakeIndirectAllocationsResidentAsPack.set(1);
+
+    MockKernelWithInternals mockKernel(*this->pClDevice);
+    auto &commandStreamReceiver = this->pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto contextId = commandStreamReceiver.getOsContext().getContextId();
+
+    auto svmAllocationsManager = mockKernel.mockContext->getSVMAllocsManager();
+    auto properties = SVMAllocsManager::UnifiedMemoryProperties(InternalMemoryType::DEVICE_UNIFIED_MEMORY, mockKernel.mockContext->getRootDeviceIndices(), mockKernel.mockContext->getDeviceBitfields());
+    properties.device = pDevice;
+    auto unifiedMemoryAllocation = svmAllocationsManager->createUnifiedMemoryAllocation(4096u, properties);
+    auto graphicsAllocation = svmAllocationsManager->getSVMAlloc(unifiedMemoryAllocation)->gpuAllocations.getGraphicsAllocation(pDevice->getRootDeviceIndex());
+
+    mockKernel.mockKernel->setUnifiedMemoryProperty(CL_KERNEL_EXEC_INFO_INDIRECT_DEVICE_ACCESS_INTEL, true);
+    mockKernel.mockKernel->makeResident(commandStreamReceiver);
+    ASSERT_EQ(1u, commandStreamReceiver.getResidencyAllocations().size());
+    EXPECT_EQ(graphicsAllocation, commandStreamReceiver.getResidencyAllocations()[0]);
+    EXPECT_TRUE(graphicsAllocation->isAlwaysResident(contextId));
+
+    commandStreamReceiver.getResidencyAllocations().clear();
+    mockKernel.mockKernel->makeResident(commandStreamReceiver);
+    EXPECT_EQ(0u, commandStreamReceiver.getResidencyAllocations().size());
+
+    auto newUnifiedMemoryAllocation = svmAllocationsManager->createUnifiedMemoryAllocation(4096u, properties);
+    auto newGraphicsAllocation = svmAllocationsManager->getSVMAlloc(newUnifiedMemoryAllocation)->gpuAllocations.getGraphicsAllocation(pDevice->getRootDeviceIndex());
+
+    mockKernel.mockKernel->makeResident(commandStreamReceiver);
+    ASSERT_EQ(1u, commandStreamReceiver.getResidencyAllocations().size());
+    EXPECT_EQ(newGraphicsAllocation, commandStreamReceiver.getResidencyAllocations()[0]);
+    EXPECT_TRUE(newGraphicsAllocation->isAlwaysResident(contextId));
+
+    svmAllocationsManager->freeSVMAlloc(newUnifiedMemoryAllocation);
+    svmAllocationsManager->freeSVMAlloc(unifiedMemoryAllocation);
+}
+
 HWTEST_F(KernelResidencyTest, givenKernelUsingIndirectHostMemoryWhenMakeResidentIsCalledThenOnlyHostAllocationsAreMadeResident) {
     MockKernelWithInternals mockKernel(*this->pClDevice);
     auto &commandStreamReceiver = this->pDevice->getUltCommandStreamReceiver<FamilyType>();
@@ -1338,6 +1377,62 @@ HWTEST_F(KernelResidencyTest, givenSharedUnifiedMemoryAndNotRequiredMemSyncWhenM
     svmAllocationsManager->freeSVMAlloc(unifiedMemoryAllocation);
 }
 
+HWTEST_F(KernelResidencyTest, givenBufferArgsWhenMakeResidentIsCalledAgainWithoutArgObjectChangesThenArgsResidencyCacheIsReused) {
+    MockKernelWithInternals mockKernel(*this->pClDevice, nullptr, true);
+    auto &commandStreamReceiver = this->pDevice->getUltCommandStreamReceiver<FamilyType>();
+    commandStreamReceiver.storeMakeResidentAllocations = true;
+
+    cl_int retVal = CL_SUCCESS;
+    std::unique_ptr<Buffer> buffer0(Buffer::create(mockKernel.mockContext, 0, MemoryConstants::pageSize, nullptr, retVal));
+    std::unique_ptr<Buffer> buffer1(Buffer::create(mockKernel.mockContext, 0, MemoryConstants::pageSize, nullptr, retVal));
+    cl_mem memObj0 = buffer0.get();
+    cl_mem memObj1 = buffer1.get();
+    EXPECT_EQ(CL_SUCCESS, mockKernel.mockKernel->setArg(0, sizeof(cl_mem), &memObj0));
+    EXPECT_EQ(CL_SUCCESS, mockKernel.mockKernel->setArg(1, sizeof(cl_mem), &memObj1));
+    EXPECT_FALSE(mockKernel.mockKernel->argsResidencyCacheValid);
+
+    mockKernel.mockKernel->makeResident(commandStreamReceiver);
+    EXPECT_TRUE(mockKernel.mockKernel->argsResidencyCacheValid);
+    EXPECT_EQ(2u, mockKernel.mockKernel->argsResidencyCache.size());
+    EXPECT_TRUE(commandStreamReceiver.isMadeResident(buffer0->getGraphicsAllocation(pDevice->getRootDeviceIndex())));
+    EXPECT_TRUE(commandStreamReceiver.isMadeResident(buffer1->getGraphicsAllocation(pDevice->getRootDeviceIndex())));
+
+    commandStreamReceiver.makeResidentAllocations.clear();
+    mockKernel.mockKernel->makeResident(commandStreamReceiver);
+    EXPECT_TRUE(mockKernel.mockKernel->argsResidencyCacheValid);
+    EXPECT_TRUE(commandStreamReceiver.isMadeResident(buffer0->getGraphicsAllocation(pDevice->getRootDeviceIndex())));
+    EXPECT_TRUE(commandStreamReceiver.isMadeResident(buffer1->getGraphicsAllocation(pDevice->getRootDeviceIndex())));
+
+    cl_mem nullMemObj = nullptr;
+    EXPECT_EQ(CL_SUCCESS, mockKernel.mockKernel->setArg(1, sizeof(cl_mem), &nullMemObj));
+    EXPECT_FALSE(mockKernel.mockKernel->argsResidencyCacheValid);
+
+    commandStreamReceiver.makeResidentAllocations.clear();
+    mockKernel.mockKernel->makeResident(commandStreamReceiver);
+    EXPECT_EQ(1u, mockKernel.mockKernel->argsResidencyCache.size());
+    EXPECT_TRUE(commandStreamReceiver.isMadeResident(buffer0->getGraphicsAllocation(pDevice->getRootDeviceIndex())));
+    EXPECT_FALSE(commandStreamReceiver.isMadeResident(buffer1->getGraphicsAllocation(pDevice->getRootDeviceIndex())));
+}
+
+HWTEST_F(KernelResidencyTest, givenArgsResidencyCacheDisabledWhenMakeResidentIsCalledThenArgsResidencyIsRebuilt) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableKernelArgsResidencyCache.set(0);
+    MockKernelWithInternals mockKernel(*this->pClDevice, nullptr, true);
+    auto &commandStreamReceiver = this->pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    cl_int retVal = CL_SUCCESS;
+    std::unique_ptr<Buffer> buffer(Buffer::create(mockKernel.mockContext, 0, MemoryConstants::pageSize, nullptr, retVal));
+    cl_mem memObj = buffer.get();
+    EXPECT_EQ(CL_SUCCESS, mockKernel.mockKernel->setArg(0, sizeof(cl_mem), &memObj));
+
+    mockKernel.mockKernel->makeResident(commandStreamReceiver);
+    EXPECT_EQ(1u, mockKernel.mockKernel->argsResidencyCache.size());
+
+    mockKernel.mockKernel->argsResidencyCache.clear();
+    mockKernel.mockKernel->makeResident(commandStreamReceiver);
+    EXPECT_EQ(1u, mockKernel.mockKernel->argsResidencyCache.size());
+}
+
 class MockGeneralSurface : public GeneralSurface {
   public:
     using GeneralSurface::needsMigration;
@@ -1891,6 +1986,134 @@ HWTEST_F(KernelResidencyTest, givenEnableFullKernelTuningWhenPerformTunningThenK
     EXPECT_EQ(result->second.singleSubdevicePreferred, mockKernel.mockKernel->singleSubdevicePreferredInCurrentEnqueue);
 }
 
+HWTEST_F(KernelResidencyTest, givenLocalWorkSizeTuningWhenTuningLaunchesFinishedThenFastestCandidateIsSelected) {
+    using TimestampPacketType = typename FamilyType::TimestampPacketType;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.LocalWorkSizeTuningLaunches.set(2);
+
+    auto &commandStreamReceiver = this->pDevice->getUltCommandStreamReceiver<FamilyType>();
+    MockKernelWithInternals mockKernel(*this->pClDevice);
+    mockKernel.mockKernel->maxKernelWorkGroupSize = 256u;
+
+    Vec3<size_t> gws{1024, 1, 1};
+    MockKernel::KernelConfig config{gws, {0, 0, 0}, {0, 0, 0}};
+    size_t lws[3] = {};
+
+    MockTimestampPacketContainer container0(*commandStreamReceiver.getTimestampPacketAllocator(), 1);
+    MockTimestampPacketContainer container1(*commandStreamReceiver.getTimestampPacketAllocator(), 1);
+
+    EXPECT_TRUE(mockKernel.mockKernel->getTunedLocalWorkSize(*this->pClDevice, gws, 1, lws));
+    auto &tuningData = mockKernel.mockKernel->localWorkSizeTuningMap[config];
+    ASSERT_LE(2u, tuningData.candidates.size());
+    EXPECT_EQ(tuningData.candidates[0], Vec3<size_t>(lws));
+    mockKernel.mockKernel->storeLocalWorkSizeTuningTimestamps(&container0);
+
+    EXPECT_TRUE(mockKernel.mockKernel->getTunedLocalWorkSize(*this->pClDevice, gws, 1, lws));
+    EXPECT_EQ(tuningData.candidates[1], Vec3<size_t>(lws));
+    mockKernel.mockKernel->storeLocalWorkSizeTuningTimestamps(&container1);
+    EXPECT_EQ(2u, tuningData.launches.size());
+
+    EXPECT_FALSE(mockKernel.mockKernel->getTunedLocalWorkSize(*this->pClDevice, gws, 1, lws));
+    EXPECT_FALSE(tuningData.done);
+
+    TimestampPacketType slowerData[4] = {2, 2, 200, 200};
+    TimestampPacketType fasterData[4] = {2, 2, 20, 20};
+    container0.getNode(0u)->assignDataToAllTimestamps(0, slowerData);
+    container1.getNode(0u)->assignDataToAllTimestamps(0, fasterData);
+
+    EXPECT_TRUE(mockKernel.mockKernel->getTunedLocalWorkSize(*this->pClDevice, gws, 1, lws));
+    EXPECT_TRUE(tuningData.done);
+    EXPECT_TRUE(tuningData.launches.empty());
+    EXPECT_EQ(tuningData.candidates[1], Vec3<size_t>(lws));
+    EXPECT_EQ(tuningData.candidates[1], tuningData.bestWorkGroupSize);
+
+    mockKernel.mockKernel->storeLocalWorkSizeTuningTimestamps(&container0);
+    EXPECT_TRUE(tuningData.launches.empty());
+}
+
+HWTEST_F(KernelResidencyTest, givenFullKernelTuningWithPartitioningOnMultiTileContextWhenTuningLaunchesFinishedThenFastestPartitioningIsSelected) {
+    using TimestampPacketType = typename FamilyType::TimestampPacketType;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableKernelTunning.set(3);
+
+    auto &commandStreamReceiver = this->pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto defaultOsContext = &commandStreamReceiver.getOsContext();
+    MockOsContext multiTileOsContext(0, EngineDescriptorHelper::getDefaultDescriptor(DeviceBitfield(0b11)));
+    commandStreamReceiver.setupContext(multiTileOsContext);
+    MockKernelWithInternals mockKernel(*this->pClDevice);
+
+    Vec3<size_t> lws{16, 1, 1};
+    Vec3<size_t> gws{1024, 1, 1};
+    Vec3<size_t> offsets{0, 0, 0};
+    MockKernel::KernelConfig config{gws, lws, offsets};
+
+    std::vector<std::unique_ptr<MockTimestampPacketContainer>> containers;
+    mockKernel.mockKernel->performKernelTuning(commandStreamReceiver, lws, gws, offsets, nullptr);
+    auto &tuningData = mockKernel.mockKernel->partitionTuningMap[config];
+    // default partitioning, partitioning along X and single tile
+    ASSERT_EQ(3u, tuningData.candidates.size());
+    EXPECT_TRUE(tuningData.launches.empty());
+
+    for (size_t i = 0; i < tuningData.candidates.size(); i++) {
+        containers.push_back(std::make_unique<MockTimestampPacketContainer>(*commandStreamReceiver.getTimestampPacketAllocator(), 1));
+        mockKernel.mockKernel->performKernelTuning(commandStreamReceiver, lws, gws, offsets, containers.back().get());
+        EXPECT_EQ(tuningData.candidates[i].singleSubdevice, mockKernel.mockKernel->isSingleSubdevicePreferred());
+        EXPECT_EQ(tuningData.candidates[i].partitionType, mockKernel.mockKernel->getRequestedWalkerPartitionType());
+    }
+    EXPECT_EQ(1, tuningData.candidates[1].partitionType);
+    EXPECT_TRUE(tuningData.candidates[2].singleSubdevice);
+
+    mockKernel.mockKernel->performKernelTuning(commandStreamReceiver, lws, gws, offsets, nullptr);
+    EXPECT_FALSE(tuningData.done);
+    EXPECT_FALSE(mockKernel.mockKernel->isSingleSubdevicePreferred());
+    EXPECT_EQ(-1, mockKernel.mockKernel->getRequestedWalkerPartitionType());
+
+    TimestampPacketType slowerData[4] = {2, 2, 200, 200};
+    TimestampPacketType fasterData[4] = {2, 2, 20, 20};
+    containers[0]->getNode(0u)->assignDataToAllTimestamps(0, slowerData);
+    containers[1]->getNode(0u)->assignDataToAllTimestamps(0, slowerData);
+    containers[2]->getNode(0u)->assignDataToAllTimestamps(0, fasterData);
+
+    mockKernel.mockKernel->performKernelTuning(commandStreamReceiver, lws, gws, offsets, nullptr);
+    EXPECT_TRUE(tuningData.done);
+    EXPECT_TRUE(tuningData.launches.empty());
+    EXPECT_TRUE(tuningData.bestCandidate.singleSubdevice);
+    EXPECT_TRUE(mockKernel.mockKernel->isSingleSubdevicePreferred());
+
+    commandStreamReceiver.setupContext(*defaultOsContext);
+}
+
+HWTEST_F(KernelResidencyTest, givenFullKernelTuningWithPartitioningWhenGridHasFewerWorkGroupsThanTilesThenSingleTileIsSelectedWithoutMeasurements) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableKernelTunning.set(3);
+
+    auto &commandStreamReceiver = this->pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto defaultOsContext = &commandStreamReceiver.getOsContext();
+    MockOsContext multiTileOsContext(0, EngineDescriptorHelper::getDefaultDescriptor(DeviceBitfield(0b11)));
+    commandStreamReceiver.setupContext(multiTileOsContext);
+    MockKernelWithInternals mockKernel(*this->pClDevice);
+
+    Vec3<size_t> lws{16, 1, 1};
+    Vec3<size_t> gws{16, 1, 1};
+    Vec3<size_t> offsets{0, 0, 0};
+    MockTimestampPacketContainer container(*commandStreamReceiver.getTimestampPacketAllocator(), 1);
+
+    mockKernel.mockKernel->performKernelTuning(commandStreamReceiver, lws, gws, offsets, &container);
+    auto &tuningData = mockKernel.mockKernel->partitionTuningMap[MockKernel::KernelConfig{gws, lws, offsets}];
+    EXPECT_TRUE(tuningData.done);
+    EXPECT_TRUE(tuningData.launches.empty());
+    EXPECT_TRUE(mockKernel.mockKernel->isSingleSubdevicePreferred());
+
+    commandStreamReceiver.setupContext(*defaultOsContext);
+}
+
+HWTEST_F(KernelResidencyTest, givenLocalWorkSizeTuningDisabledWhenGettingTunedLocalWorkSizeThenFalseIsReturned) {
+    MockKernelWithInternals mockKernel(*this->pClDevice);
+    size_t lws[3] = {};
+    EXPECT_FALSE(mockKernel.mockKernel->getTunedLocalWorkSize(*this->pClDevice, {1024, 1, 1}, 1, lws));
+    EXPECT_TRUE(mockKernel.mockKernel->localWorkSizeTuningMap.empty());
+}
+
 HWTEST_F(KernelResidencyTest, givenSimpleKernelTunningAndNoAtomicsWhenPerformTunningThenSingleSubdeviceIsPreferred) {
     DebugManagerStateRestore restorer;
     DebugManager.flags.EnableKernelTunning.set(1u);
@@ -8,6 +8,7 @@
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/register_offsets.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/os_interface/linux/drm_null_device.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/test_macros/test.h"
@@ -60,6 +61,33 @@ TEST_F(DrmNullDeviceTests, GIVENdrmNullDeviceWHENcallIoctlTHENalwaysSuccess) {
     EXPECT_EQ(drmNullDevice->ioctl(DrmIoctl::GemExecbuffer2, nullptr), 0);
 }
 
+TEST_F(DrmNullDeviceTests, GIVENdrmNullDeviceWHENcreatingBufferObjectsTHENuniqueHandlesAreReturned) {
+    GemCreate create = {};
+    create.size = MemoryConstants::pageSize;
+    ASSERT_EQ(0, drmNullDevice->ioctl(DrmIoctl::GemCreate, &create));
+    auto firstHandle = create.handle;
+
+    GemUserPtr userptr = {};
+    ASSERT_EQ(0, drmNullDevice->ioctl(DrmIoctl::GemUserptr, &userptr));
+
+    EXPECT_NE(0u, firstHandle);
+    EXPECT_NE(0u, userptr.handle);
+    EXPECT_NE(firstHandle, userptr.handle);
+}
+
+TEST_F(DrmNullDeviceTests, GIVENprintIoctlTimesWHENcallingSimulatedIoctlTHENioctlIsCounted) {
+    DebugManager.flags.PrintIoctlTimes.set(true);
+
+    EXPECT_EQ(0, drmNullDevice->ioctl(DrmIoctl::GemExecbuffer2, nullptr));
+    EXPECT_EQ(0, drmNullDevice->ioctl(DrmIoctl::GemExecbuffer2, nullptr));
+
+    auto ioctlData = drmNullDevice->ioctlStatistics.find(DrmIoctl::GemExecbuffer2);
+    ASSERT_NE(drmNullDevice->ioctlStatistics.end(), ioctlData);
+    EXPECT_EQ(2u, ioctlData->second.count);
+    EXPECT_EQ(0, ioctlData->second.totalTime);
+    DebugManager.flags.PrintIoctlTimes.set(false);
+}
+
 TEST_F(DrmNullDeviceTests, GIVENdrmNullDeviceWHENregReadOtherThenTimestampReadTHENalwaysSuccess) {
     RegisterRead arg;
 
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "opencl/source/mem_obj/buffer.h"
+#include "opencl/test/unit_test/mocks/mock_context.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+class MockBufferPoolAllocator : public Context::BufferPoolAllocator {
+  public:
+    using Context::BufferPoolAllocator::bufferPools;
+};
+
+template <int32_t poolAllocatorFlag>
+struct AggregatedSmallBuffersTestTemplate : public ::testing::Test {
+    void SetUp() override {
+        DebugManager.flags.ExperimentalSmallBufferPoolAllocator.set(poolAllocatorFlag);
+        context = std::make_unique<MockContext>();
+        poolAllocator = static_cast<MockBufferPoolAllocator *>(&context->getBufferPoolAllocator());
+    }
+
+    Buffer *createBuffer(size_t size) {
+        return Buffer::create(context.get(), CL_MEM_READ_WRITE, size, nullptr, retVal);
+    }
+
+    DebugManagerStateRestore restore;
+    std::unique_ptr<MockContext> context;
+    MockBufferPoolAllocator *poolAllocator = nullptr;
+    cl_int retVal = CL_SUCCESS;
+};
+
+using AggregatedSmallBuffersDefaultTest = AggregatedSmallBuffersTestTemplate<-1>;
+
+TEST_F(AggregatedSmallBuffersDefaultTest, givenDefaultSettingsWhenSmallBufferIsCreatedThenItIsNotPooled) {
+    EXPECT_FALSE(poolAllocator->isAggregatedSmallBuffersEnabled());
+
+    std::unique_ptr<Buffer> buffer(createBuffer(MemoryConstants::pageSize));
+    ASSERT_NE(nullptr, buffer);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_FALSE(buffer->isParentObjectPool);
+    EXPECT_EQ(0u, poolAllocator->getPoolsCount());
+}
+
+using AggregatedSmallBuffersEnabledTest = AggregatedSmallBuffersTestTemplate<1>;
+
+TEST_F(AggregatedSmallBuffersEnabledTest, givenPoolEnabledWhenSmallBuffersAreCreatedThenTheyShareAllocationOfOnePool) {
+    EXPECT_TRUE(poolAllocator->isAggregatedSmallBuffersEnabled());
+
+    std::unique_ptr<Buffer> buffer1(createBuffer(100u));
+    ASSERT_NE(nullptr, buffer1);
+    std::unique_ptr<Buffer> buffer2(createBuffer(100u));
+    ASSERT_NE(nullptr, buffer2);
+
+    EXPECT_EQ(1u, poolAllocator->getPoolsCount());
+    EXPECT_TRUE(buffer1->isParentObjectPool);
+    EXPECT_TRUE(buffer2->isParentObjectPool);
+    EXPECT_FALSE(buffer1->isSubBuffer());
+
+    auto rootDeviceIndex = context->getDevice(0)->getRootDeviceIndex();
+    EXPECT_EQ(buffer1->getGraphicsAllocation(rootDeviceIndex), buffer2->getGraphicsAllocation(rootDeviceIndex));
+    EXPECT_NE(buffer1->getOffset(), buffer2->getOffset());
+    EXPECT_EQ(0u, buffer1->getOffset() % Context::BufferPoolAllocator::chunkAlignment);
+    EXPECT_EQ(0u, buffer2->getOffset() % Context::BufferPoolAllocator::chunkAlignment);
+    EXPECT_EQ(100u, buffer1->getSize());
+}
+
+TEST_F(AggregatedSmallBuffersEnabledTest, givenPooledBufferWhenQueryingAssociatedMemObjectAndOffsetThenRegularBufferValuesAreReturned) {
+    std::unique_ptr<Buffer> buffer1(createBuffer(100u));
+    std::unique_ptr<Buffer> buffer2(createBuffer(100u));
+    ASSERT_NE(nullptr, buffer2);
+    EXPECT_NE(0u, buffer2->getOffset());
+
+    cl_mem associatedMemObject = reinterpret_cast<cl_mem>(0x1234);
+    EXPECT_EQ(CL_SUCCESS, buffer2->getMemObjectInfo(CL_MEM_ASSOCIATED_MEMOBJECT, sizeof(associatedMemObject), &associatedMemObject, nullptr));
+    EXPECT_EQ(nullptr, associatedMemObject);
+
+    size_t offset = 1u;
+    EXPECT_EQ(CL_SUCCESS, buffer2->getMemObjectInfo(CL_MEM_OFFSET, sizeof(offset), &offset, nullptr));
+    EXPECT_EQ(0u, offset);
+}
+
+TEST_F(AggregatedSmallBuffersEnabledTest, givenSubBufferOfPooledBufferWhenCreatedThenOffsetIncludesPooledBufferOffset) {
+    std::unique_ptr<Buffer> buffer1(createBuffer(1024u));
+    std::unique_ptr<Buffer> buffer2(createBuffer(1024u));
+    ASSERT_NE(nullptr, buffer2);
+
+    cl_buffer_region region{64u, 128u};
+    std::unique_ptr<Buffer> subBuffer(buffer2->createSubBuffer(CL_MEM_READ_WRITE, 0, &region, retVal));
+    ASSERT_NE(nullptr, subBuffer);
+    EXPECT_TRUE(subBuffer->isSubBuffer());
+    EXPECT_EQ(buffer2->getOffset() + region.origin, subBuffer->getOffset());
+}
+
+TEST_F(AggregatedSmallBuffersEnabledTest, givenBufferAboveThresholdOrWithHostPtrFlagsWhenCreatedThenItIsNotPooled) {
+    std::unique_ptr<Buffer> largeBuffer(createBuffer(Context::BufferPoolAllocator::smallBufferThreshold + 1));
+    ASSERT_NE(nullptr, largeBuffer);
+    EXPECT_FALSE(largeBuffer->isParentObjectPool);
+
+    uint8_t hostMemory[MemoryConstants::cacheLineSize] = {};
+    std::unique_ptr<Buffer> hostPtrBuffer(Buffer::create(context.get(), CL_MEM_USE_HOST_PTR, sizeof(hostMemory), hostMemory, retVal));
+    ASSERT_NE(nullptr, hostPtrBuffer);
+    EXPECT_FALSE(hostPtrBuffer->isParentObjectPool);
+
+    EXPECT_EQ(0u, poolAllocator->getPoolsCount());
+}
+
+TEST_F(AggregatedSmallBuffersEnabledTest, givenReleasedPooledBufferWhenPoolIsDrainedThenChunkIsReused) {
+    auto buffer = createBuffer(Context::BufferPoolAllocator::smallBufferThreshold);
+    ASSERT_NE(nullptr, buffer);
+    auto releasedOffset = buffer->getOffset();
+    buffer->release();
+
+    ASSERT_EQ(1u, poolAllocator->getPoolsCount());
+    EXPECT_EQ(1u, poolAllocator->bufferPools[0].chunksToFree.size());
+
+    std::vector<std::unique_ptr<Buffer>> buffers;
+    const auto buffersInPool = Context::BufferPoolAllocator::aggregatedSmallBuffersPoolSize / Context::BufferPoolAllocator::smallBufferThreshold;
+    for (size_t i = 0; i < buffersInPool; i++) {
+        buffers.emplace_back(createBuffer(Context::BufferPoolAllocator::smallBufferThreshold));
+        ASSERT_NE(nullptr, buffers.back());
+    }
+
+    EXPECT_EQ(1u, poolAllocator->getPoolsCount());
+    EXPECT_TRUE(poolAllocator->bufferPools[0].chunksToFree.empty());
+    EXPECT_EQ(releasedOffset, buffers.back()->getOffset());
+}
@@ -1609,6 +1609,77 @@ HWTEST_F(BufferSetSurfaceTests, givenBufferWithOffsetWhenSetArgStatefulIsCalledT
     DebugManager.flags.Force32bitAddressing.set(false);
 }
 
+HWTEST_F(BufferSetSurfaceTests, givenSurfaceStateCacheEnabledWhenSetArgStatefulIsCalledAgainWithSameInputsThenCachedSurfaceStateIsReused) {
+    using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableBufferSurfaceStateCache.set(1);
+
+    MockContext context;
+    auto retVal = CL_SUCCESS;
+    auto buffer = std::unique_ptr<Buffer>(Buffer::create(&context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    auto gmmHelper = context.getDevice(0)->getGmmHelper();
+
+    RENDER_SURFACE_STATE surfaceState = {};
+    buffer->setArgStateful(&surfaceState, false, false, false, false, context.getDevice(0)->getDevice(), false, false);
+    auto expectedMocs = surfaceState.getMemoryObjectControlState();
+    EXPECT_NE(gmmHelper->getMOCS(GMM_RESOURCE_USAGE_OCL_BUFFER_CACHELINE_MISALIGNED), expectedMocs);
+
+    DebugManager.flags.DisableCachingForStatefulBufferAccess.set(true);
+    RENDER_SURFACE_STATE cachedSurfaceState = {};
+    buffer->setArgStateful(&cachedSurfaceState, false, false, false, false, context.getDevice(0)->getDevice(), false, false);
+    EXPECT_EQ(0, memcmp(&surfaceState, &cachedSurfaceState, sizeof(RENDER_SURFACE_STATE)));
+
+    DebugManager.flags.EnableBufferSurfaceStateCache.set(0);
+    RENDER_SURFACE_STATE encodedSurfaceState = {};
+    buffer->setArgStateful(&encodedSurfaceState, false, false, false, false, context.getDevice(0)->getDevice(), false, false);
+    EXPECT_EQ(gmmHelper->getMOCS(GMM_RESOURCE_USAGE_OCL_BUFFER_CACHELINE_MISALIGNED), encodedSurfaceState.getMemoryObjectControlState());
+}
+
+HWTEST_F(BufferSetSurfaceTests, givenSurfaceStateCacheEnabledWhenSetArgStatefulIsCalledForSubBuffersWithDifferentInputsThenEachSurfaceStateIsEncodedSeparately) {
+    using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableBufferSurfaceStateCache.set(1);
+
+    MockContext context;
+    auto rootDeviceIndex = context.getDevice(0)->getRootDeviceIndex();
+    auto retVal = CL_SUCCESS;
+    auto buffer = std::unique_ptr<Buffer>(Buffer::create(&context, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    cl_buffer_region region0 = {0, 64};
+    cl_buffer_region region1 = {64, 128};
+    auto subBuffer0 = buffer->createSubBuffer(CL_MEM_READ_WRITE, 0, &region0, retVal);
+    auto subBuffer1 = buffer->createSubBuffer(CL_MEM_READ_WRITE, 0, &region1, retVal);
+    ASSERT_NE(nullptr, subBuffer0);
+    ASSERT_NE(nullptr, subBuffer1);
+    auto bufferAddress = buffer->getGraphicsAllocation(rootDeviceIndex)->getGpuAddress();
+
+    for (uint32_t i = 0; i < 2; i++) {
+        RENDER_SURFACE_STATE surfaceState0 = {};
+        RENDER_SURFACE_STATE surfaceState1 = {};
+        subBuffer0->setArgStateful(&surfaceState0, false, false, false, false, context.getDevice(0)->getDevice(), false, false);
+        subBuffer1->setArgStateful(&surfaceState1, false, false, false, false, context.getDevice(0)->getDevice(), false, false);
+        EXPECT_EQ(bufferAddress + region0.origin, surfaceState0.getSurfaceBaseAddress());
+        EXPECT_EQ(bufferAddress + region1.origin, surfaceState1.getSurfaceBaseAddress());
+        EXPECT_EQ(64u, surfaceState0.getWidth());
+        EXPECT_EQ(128u, surfaceState1.getWidth());
+
+        RENDER_SURFACE_STATE l3DisabledSurfaceState = {};
+        subBuffer0->setArgStateful(&l3DisabledSurfaceState, false, true, false, false, context.getDevice(0)->getDevice(), false, false);
+        auto gmmHelper = context.getDevice(0)->getGmmHelper();
+        EXPECT_EQ(gmmHelper->getMOCS(GMM_RESOURCE_USAGE_OCL_BUFFER_CACHELINE_MISALIGNED), l3DisabledSurfaceState.getMemoryObjectControlState());
+
+        RENDER_SURFACE_STATE preEncodedSurfaceState = surfaceState1;
+        subBuffer0->setArgStateful(&preEncodedSurfaceState, false, false, false, false, context.getDevice(0)->getDevice(), false, false);
+        EXPECT_EQ(bufferAddress + region0.origin, preEncodedSurfaceState.getSurfaceBaseAddress());
+        EXPECT_EQ(64u, preEncodedSurfaceState.getWidth());
+    }
+
+    subBuffer1->release();
+    subBuffer0->release();
+}
+
 HWTEST_F(BufferSetSurfaceTests, givenBufferWhenSetArgStatefulWithL3ChacheDisabledIsCalledThenL3CacheShouldBeOffAndSizeIsAlignedTo512) {
     MockContext context;
     auto size = 128;
@@ -15,6 +15,8 @@
 #include "opencl/test/unit_test/mocks/mock_command_queue.h"
 #include "opencl/test/unit_test/mocks/mock_context.h"
 
+#include <limits>
+
 using namespace NEO;
 
 //Tests for pipes
@@ -54,6 +56,14 @@ TEST_F(PipeTest, WhenCreatingPipeThenHeaderSizeAdditionIsReserved) {
     delete pipe;
 }
 
+TEST(PipeSurfaceSizeTest, GivenMaxPacketsCountWhenGettingPipeSurfaceSizeThenSizeDoesNotOverflow) {
+    EXPECT_EQ((1 * (20 + 1)) + Pipe::intelPipeHeaderReservedSpace, Pipe::getPipeSurfaceSize(1, 20));
+    if (sizeof(size_t) == 8u) {
+        auto expectedSize = 4ull * (static_cast<uint64_t>(std::numeric_limits<cl_uint>::max()) + 1) + Pipe::intelPipeHeaderReservedSpace;
+        EXPECT_EQ(expectedSize, Pipe::getPipeSurfaceSize(4, std::numeric_limits<cl_uint>::max()));
+    }
+}
+
 TEST_F(PipeTest, WhenCreatingPipeThenHeaderIsInitialized) {
     int errCode = CL_SUCCESS;
 
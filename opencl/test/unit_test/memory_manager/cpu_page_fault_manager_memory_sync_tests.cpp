@@ -66,7 +66,7 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenSynchronizeMemoryThenEnq
     EXPECT_EQ(cmdQ->transferToGpuCalled, 0);
     EXPECT_EQ(cmdQ->finishCalled, 0);
 
-    pageFaultManager->baseGpuTransfer(alloc, cmdQ.get());
+    pageFaultManager->baseGpuTransfer(alloc, 256, cmdQ.get());
     EXPECT_EQ(cmdQ->transferToCpuCalled, 1);
     EXPECT_EQ(cmdQ->transferToGpuCalled, 1);
     EXPECT_EQ(cmdQ->finishCalled, 1);
@@ -99,7 +99,7 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenGpuTransferIsInvokedThen
     pageFaultManager->insertAllocation(alloc, 256, svmAllocsManager.get(), cmdQ.get(), {});
 
     EXPECT_EQ(svmAllocsManager->insertSvmMapOperationCalled, 0);
-    pageFaultManager->baseGpuTransfer(alloc, cmdQ.get());
+    pageFaultManager->baseGpuTransfer(alloc, 256, cmdQ.get());
     EXPECT_EQ(svmAllocsManager->insertSvmMapOperationCalled, 1);
 
     svmAllocsManager->freeSVMAlloc(alloc);
@@ -7,6 +7,7 @@
 
 #include "shared/source/memory_manager/migration_sync_data.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/mocks/mock_memory_manager.h"
 #include "shared/test/common/mocks/mock_migration_sync_data.h"
 #include "shared/test/common/mocks/mock_multi_graphics_allocation.h"
@@ -34,6 +35,12 @@ struct MigrationControllerTests : public ::testing::Test {
     MockMemoryManager *memoryManager = nullptr;
 };
 
+class MockSharedAllocation : public MockGraphicsAllocation {
+  public:
+    using MockGraphicsAllocation::MockGraphicsAllocation;
+    uint64_t peekInternalHandle(MemoryManager *memoryManager) override { return 0x1234; }
+};
+
 TEST_F(MigrationControllerTests, givenAllocationWithUndefinedLocationWhenHandleMigrationThenNoMigrationIsPerformedAndProperLocationIsSet) {
     std::unique_ptr<Image> pImage(Image1dHelper<>::create(&context));
     EXPECT_TRUE(pImage->getMultiGraphicsAllocation().requiresMigrations());
@@ -120,6 +127,62 @@ TEST_F(MigrationControllerTests, givenNotLockableBufferAllocationWithDefinedLoca
     EXPECT_EQ(1u, pCsr0->peekLatestFlushedTaskCount());
 }
 
+TEST_F(MigrationControllerTests, givenPeerToPeerMigrationEnabledWhenHandleMigrationOfNotLockableBufferToDifferentLocationThenSourceIsImportedOnTargetDeviceAndCopiedThere) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnablePeerToPeerMigration.set(1);
+    DebugManager.flags.EnableBlitterForEnqueueOperations.set(0);
+
+    std::unique_ptr<Buffer> pBuffer(BufferHelper<>::create(&context));
+    auto &multiGraphicsAllocation = const_cast<MultiGraphicsAllocation &>(pBuffer->getMultiGraphicsAllocation());
+    multiGraphicsAllocation.setMultiStorage(true);
+
+    auto srcAllocation = multiGraphicsAllocation.getGraphicsAllocation(0);
+    MockSharedAllocation sharedSrcAllocation(0u, srcAllocation->getUnderlyingBuffer(), srcAllocation->getUnderlyingBufferSize());
+    std::unique_ptr<Gmm> gmm(new Gmm(context.getDevice(0)->getGmmHelper(), nullptr, 1, 0, GMM_RESOURCE_USAGE_OCL_BUFFER, false, {}, true));
+    gmm->resourceParams.Flags.Info.NotLockable = 1;
+    sharedSrcAllocation.setDefaultGmm(gmm.get());
+    multiGraphicsAllocation.addAllocation(&sharedSrcAllocation);
+
+    multiGraphicsAllocation.getMigrationSyncData()->setCurrentLocation(0);
+    MigrationController::handleMigration(context, *pCsr1, pBuffer.get());
+    EXPECT_EQ(1u, multiGraphicsAllocation.getMigrationSyncData()->getCurrentLocation());
+
+    EXPECT_EQ(0x1234, memoryManager->capturedSharedHandle);
+    EXPECT_EQ(0u, memoryManager->lockResourceCalled);
+    EXPECT_EQ(1u, pCsr1->peekLatestFlushedTaskCount());
+    EXPECT_EQ(0u, pCsr0->peekLatestFlushedTaskCount());
+
+    multiGraphicsAllocation.addAllocation(srcAllocation);
+}
+
+TEST_F(MigrationControllerTests, givenPeerToPeerMigrationDisabledWhenHandleMigrationOfNotLockableBufferToDifferentLocationThenBufferIsMigratedThroughHostMemory) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnablePeerToPeerMigration.set(0);
+    DebugManager.flags.DoCpuCopyOnReadBuffer.set(0);
+    DebugManager.flags.DoCpuCopyOnWriteBuffer.set(0);
+    DebugManager.flags.EnableBlitterForEnqueueOperations.set(0);
+
+    std::unique_ptr<Buffer> pBuffer(BufferHelper<>::create(&context));
+    auto &multiGraphicsAllocation = const_cast<MultiGraphicsAllocation &>(pBuffer->getMultiGraphicsAllocation());
+    multiGraphicsAllocation.setMultiStorage(true);
+
+    auto srcAllocation = multiGraphicsAllocation.getGraphicsAllocation(0);
+    MockSharedAllocation sharedSrcAllocation(0u, srcAllocation->getUnderlyingBuffer(), srcAllocation->getUnderlyingBufferSize());
+    std::unique_ptr<Gmm> gmm(new Gmm(context.getDevice(0)->getGmmHelper(), nullptr, 1, 0, GMM_RESOURCE_USAGE_OCL_BUFFER, false, {}, true));
+    gmm->resourceParams.Flags.Info.NotLockable = 1;
+    sharedSrcAllocation.setDefaultGmm(gmm.get());
+    multiGraphicsAllocation.addAllocation(&sharedSrcAllocation);
+
+    multiGraphicsAllocation.getMigrationSyncData()->setCurrentLocation(0);
+    MigrationController::handleMigration(context, *pCsr1, pBuffer.get());
+    EXPECT_EQ(1u, multiGraphicsAllocation.getMigrationSyncData()->getCurrentLocation());
+
+    EXPECT_NE(0x1234, memoryManager->capturedSharedHandle);
+    EXPECT_EQ(1u, pCsr0->peekLatestFlushedTaskCount());
+
+    multiGraphicsAllocation.addAllocation(srcAllocation);
+}
+
 TEST_F(MigrationControllerTests, givenLockableBufferAllocationWithDefinedLocationWhenHandleMigrationToDifferentLocationThenMigrateMemoryViaLockMemory) {
     std::unique_ptr<Buffer> pBuffer(BufferHelper<>::create(&context));
     const_cast<MultiGraphicsAllocation &>(pBuffer->getMultiGraphicsAllocation()).setMultiStorage(true);
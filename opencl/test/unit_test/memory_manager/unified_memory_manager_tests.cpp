@@ -74,6 +74,61 @@ TEST_F(SVMMemoryAllocatorTest, whenRequestSVMAllocsThenReturnNonNullptr) {
     EXPECT_NE(svmAllocs, nullptr);
 }
 
+TEST_F(SVMMemoryAllocatorTest, givenMultipleSVMAllocationsWhenGettingAllocationByPointerWithinRangeThenMatchingAllocationIsReturned) {
+    constexpr size_t numAllocations = 8u;
+    void *ptrs[numAllocations] = {};
+    for (auto &ptr : ptrs) {
+        ptr = svmManager->createSVMAlloc(MemoryConstants::pageSize, {}, rootDeviceIndices, deviceBitfields);
+        ASSERT_NE(nullptr, ptr);
+    }
+    EXPECT_EQ(numAllocations, svmManager->SVMAllocs.ranges.size());
+    for (size_t i = 1; i < svmManager->SVMAllocs.ranges.size(); i++) {
+        EXPECT_LT(svmManager->SVMAllocs.ranges[i - 1].start, svmManager->SVMAllocs.ranges[i].start);
+    }
+
+    for (auto ptr : ptrs) {
+        auto svmData = svmManager->getSVMAlloc(ptr);
+        ASSERT_NE(nullptr, svmData);
+        EXPECT_EQ(ptr, reinterpret_cast<void *>(svmData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
+        EXPECT_EQ(svmData, svmManager->getSVMAlloc(ptrOffset(ptr, MemoryConstants::pageSize - 1)));
+        EXPECT_EQ(svmData, svmManager->getSVMAlloc(ptrOffset(ptr, MemoryConstants::pageSize / 2)));
+    }
+
+    svmManager->freeSVMAlloc(ptrs[numAllocations / 2]);
+    EXPECT_EQ(numAllocations - 1, svmManager->SVMAllocs.ranges.size());
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptrs[numAllocations / 2]));
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptrOffset(ptrs[numAllocations / 2], MemoryConstants::pageSize / 2)));
+
+    for (size_t i = 0; i < numAllocations; i++) {
+        if (i != numAllocations / 2) {
+            svmManager->freeSVMAlloc(ptrs[i]);
+        }
+    }
+    EXPECT_EQ(0u, svmManager->SVMAllocs.ranges.size());
+}
+
+TEST_F(SVMMemoryAllocatorTest, givenPointerOutsideOfSVMAllocationWhenGettingAllocationThenNullptrIsReturned) {
+    auto ptr = svmManager->createSVMAlloc(MemoryConstants::pageSize, {}, rootDeviceIndices, deviceBitfields);
+    ASSERT_NE(nullptr, ptr);
+
+    EXPECT_NE(nullptr, svmManager->getSVMAlloc(ptr));
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptrOffset(ptr, MemoryConstants::pageSize)));
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(ptr) - 1)));
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(nullptr));
+
+    svmManager->freeSVMAlloc(ptr);
+}
+
+TEST_F(SVMMemoryAllocatorTest, givenCachedLookupWhenAllocationIsFreedThenSubsequentLookupReturnsNullptr) {
+    auto ptr = svmManager->createSVMAlloc(MemoryConstants::pageSize, {}, rootDeviceIndices, deviceBitfields);
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_NE(nullptr, svmManager->getSVMAlloc(ptr));
+    EXPECT_NE(nullptr, svmManager->getSVMAlloc(ptr));
+
+    svmManager->freeSVMAlloc(ptr);
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(ptr));
+}
+
 using MultiDeviceSVMMemoryAllocatorTest = MultiRootDeviceWithSubDevicesFixture;
 
 TEST_F(MultiDeviceSVMMemoryAllocatorTest, givenMultipleDevicesWhenCreatingSVMAllocThenCreateOneGraphicsAllocationPerRootDeviceIndex) {
@@ -795,7 +850,7 @@ TEST(UnifiedMemoryTest, givenInternalAllocationWhenItIsMadeResidentThenSubsequen
     unifiedMemoryManager->freeSVMAlloc(ptr);
 }
 
-TEST(UnifiedMemoryTest, givenInternalAllocationWhenNewAllocationIsCreatedThenItIsMadeResident) {
+TEST(UnifiedMemoryTest, givenInternalAllocationWhenNewAllocationIsCreatedThenOnlyNewAllocationIsMadeResident) {
     MockCommandQueue cmdQ;
     MockDevice device;
     MockExecutionEnvironment executionEnvironment;
@@ -819,17 +874,21 @@ TEST(UnifiedMemoryTest, givenInternalAllocationWhenNewAllocationIsCreatedThenItI
     graphicsAllocation->gpuAllocations.getDefaultGraphicsAllocation()->updateResidencyTaskCount(GraphicsAllocation::objectNotResident, commandStreamReceiver.getOsContext().getContextId());
 
     auto ptr2 = unifiedMemoryManager->createSharedUnifiedMemoryAllocation(4096u, unifiedMemoryProperties, &cmdQ);
-    auto graphicsAllocation2 = unifiedMemoryManager->getSVMAlloc(ptr);
+    auto graphicsAllocation2 = unifiedMemoryManager->getSVMAlloc(ptr2);
 
     EXPECT_FALSE(graphicsAllocation->gpuAllocations.getDefaultGraphicsAllocation()->isResident(commandStreamReceiver.getOsContext().getContextId()));
 
     EXPECT_FALSE(graphicsAllocation2->gpuAllocations.getDefaultGraphicsAllocation()->isResident(commandStreamReceiver.getOsContext().getContextId()));
 
-    // now call with task count 2, both allocations needs to be made resident
+    // now call with task count 2, only allocation created since last call needs to be made resident
     unifiedMemoryManager->makeIndirectAllocationsResident(commandStreamReceiver, 2u);
 
-    EXPECT_TRUE(graphicsAllocation->gpuAllocations.getDefaultGraphicsAllocation()->isResident(commandStreamReceiver.getOsContext().getContextId()));
+    EXPECT_FALSE(graphicsAllocation->gpuAllocations.getDefaultGraphicsAllocation()->isResident(commandStreamReceiver.getOsContext().getContextId()));
     EXPECT_TRUE(graphicsAllocation2->gpuAllocations.getDefaultGraphicsAllocation()->isResident(commandStreamReceiver.getOsContext().getContextId()));
+    EXPECT_EQ(GraphicsAllocation::objectAlwaysResident, graphicsAllocation2->gpuAllocations.getDefaultGraphicsAllocation()->getResidencyTaskCount(commandStreamReceiver.getOsContext().getContextId()));
+
+    auto internalEntry = unifiedMemoryManager->indirectAllocationsResidency.find(&commandStreamReceiver)->second;
+    EXPECT_EQ(unifiedMemoryManager->allocationsCounter.load(), internalEntry.latestResidentObjectId);
 
     unifiedMemoryManager->freeSVMAlloc(ptr);
     unifiedMemoryManager->freeSVMAlloc(ptr2);
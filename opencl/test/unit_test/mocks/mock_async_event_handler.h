@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,8 +23,12 @@ extern bool destructorCalled;
 class MockHandler : public AsyncEventsHandler {
   public:
     using AsyncEventsHandler::allowAsyncProcess;
+    using AsyncEventsHandler::allowCallbackProcess;
     using AsyncEventsHandler::asyncMtx;
     using AsyncEventsHandler::asyncProcess;
+    using AsyncEventsHandler::callbackProcess;
+    using AsyncEventsHandler::callbackQueue;
+    using AsyncEventsHandler::callbackThreads;
     using AsyncEventsHandler::openThread;
     using AsyncEventsHandler::thread;
 
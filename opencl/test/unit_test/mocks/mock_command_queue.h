@@ -31,6 +31,7 @@ class MockCommandQueue : public CommandQueue {
     using CommandQueue::device;
     using CommandQueue::gpgpuEngine;
     using CommandQueue::isCopyOnly;
+    using CommandQueue::isInOrderFastTrackingAllowed;
     using CommandQueue::isTextureCacheFlushNeeded;
     using CommandQueue::obtainNewTimestampPacketNodes;
     using CommandQueue::overrideEngine;
@@ -98,6 +98,8 @@ class MockKernel : public Kernel {
     using Kernel::addAllocationToCacheFlushVector;
     using Kernel::allBufferArgsStateful;
     using Kernel::anyKernelArgumentUsingSystemMemory;
+    using Kernel::argsResidencyCache;
+    using Kernel::argsResidencyCacheValid;
     using Kernel::auxTranslationRequired;
     using Kernel::containsStatelessWrites;
     using Kernel::dataParameterSimdSize;
@@ -117,10 +119,12 @@ class MockKernel : public Kernel {
     using Kernel::kernelSubmissionMap;
     using Kernel::kernelSvmGfxAllocations;
     using Kernel::kernelUnifiedMemoryGfxAllocations;
+    using Kernel::localWorkSizeTuningMap;
     using Kernel::maxKernelWorkGroupSize;
     using Kernel::maxWorkGroupSizeForCrossThreadData;
     using Kernel::numberOfBindingTableStates;
     using Kernel::parentEventOffset;
+    using Kernel::partitionTuningMap;
     using Kernel::patchBufferOffset;
     using Kernel::patchWithImplicitSurface;
     using Kernel::pImplicitArgs;
@@ -229,6 +233,7 @@ class MockKernel : public Kernel {
 
     void setKernelArguments(std::vector<SimpleKernelArgInfo> kernelArguments) {
         this->kernelArguments = kernelArguments;
+        this->argsResidencyCacheValid = false;
     }
 
     KernelInfo *getAllocatedKernelInfo() {
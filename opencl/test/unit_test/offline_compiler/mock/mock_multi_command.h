@@ -20,11 +20,13 @@ class MockMultiCommand : public MultiCommand {
   public:
     using MultiCommand::argHelper;
     using MultiCommand::lines;
+    using MultiCommand::pinnedCompilerLibraries;
     using MultiCommand::quiet;
     using MultiCommand::retValues;
 
     using MultiCommand::addAdditionalOptionsToSingleCommandLine;
     using MultiCommand::initialize;
+    using MultiCommand::pinCompilerLibraries;
     using MultiCommand::printHelp;
     using MultiCommand::runBuilds;
     using MultiCommand::showResults;
@@ -49,10 +51,22 @@ class MockMultiCommand : public MultiCommand {
         return OclocErrorCode::SUCCESS;
     }
 
+    void pinCompilerLibraries() override {
+        ++pinCompilerLibrariesCalledCount;
+        singleBuildsBeforePinningCount = singleBuildCalledCount;
+
+        if (callBasePinCompilerLibraries) {
+            MultiCommand::pinCompilerLibraries();
+        }
+    }
+
     std::map<std::string, std::string> filesMap{};
     std::unique_ptr<MockOclocArgHelper> uniqueHelper{};
     int singleBuildCalledCount{0};
     bool callBaseSingleBuild{true};
+    int pinCompilerLibrariesCalledCount{0};
+    int singleBuildsBeforePinningCount{-1};
+    bool callBasePinCompilerLibraries{true};
 };
 
 } // namespace NEO
@@ -1488,4 +1488,65 @@ TEST(OclocFatBinaryHelpersTest, givenQuietModeWhenBuildingFatbinaryForTargetThen
     EXPECT_TRUE(output.empty()) << output;
 }
 
+TEST(OclocFatBinaryHelpersTest, givenMultipleCompilersWhenBuildingTargetsInParallelThenEachCompilerIsBuiltOnceAndResultsKeepTargetOrder) {
+    constexpr size_t numCompilers = 5u;
+    MockOfflineCompiler mockOfflineCompilers[numCompilers];
+
+    std::vector<OfflineCompiler *> compilers;
+    for (size_t i = 0; i < numCompilers; ++i) {
+        mockOfflineCompilers[i].buildReturnValue = static_cast<int>(i);
+        compilers.push_back(&mockOfflineCompilers[i]);
+    }
+
+    std::vector<int> retVals;
+    buildFatBinaryTargetsInParallel(compilers, retVals, 3u);
+
+    ASSERT_EQ(numCompilers, retVals.size());
+    for (size_t i = 0; i < numCompilers; ++i) {
+        EXPECT_EQ(1, mockOfflineCompilers[i].buildCalledCount);
+        EXPECT_EQ(static_cast<int>(i), retVals[i]);
+    }
+}
+
+TEST(OclocFatBinaryHelpersTest, givenMoreThreadsThanCompilersWhenBuildingTargetsInParallelThenEachCompilerIsBuiltOnce) {
+    MockOfflineCompiler mockOfflineCompilers[2];
+    mockOfflineCompilers[0].buildReturnValue = OclocErrorCode::SUCCESS;
+    mockOfflineCompilers[1].buildReturnValue = OclocErrorCode::BUILD_PROGRAM_FAILURE;
+
+    std::vector<OfflineCompiler *> compilers{&mockOfflineCompilers[0], &mockOfflineCompilers[1]};
+    std::vector<int> retVals;
+    buildFatBinaryTargetsInParallel(compilers, retVals, 8u);
+
+    ASSERT_EQ(2u, retVals.size());
+    EXPECT_EQ(OclocErrorCode::SUCCESS, retVals[0]);
+    EXPECT_EQ(OclocErrorCode::BUILD_PROGRAM_FAILURE, retVals[1]);
+    EXPECT_EQ(1, mockOfflineCompilers[0].buildCalledCount);
+    EXPECT_EQ(1, mockOfflineCompilers[1].buildCalledCount);
+}
+
+TEST(OclocFatBinaryHelpersTest, givenFailedBuildResultWhenAppendingBuiltFatbinaryTargetThenErrorIsReturnedAndBuildIsNotRepeated) {
+    const std::vector<std::string> argv = {
+        "ocloc",
+        "-file",
+        clFiles + "copybuffer.cl",
+        "-device",
+        gEnvironment->devicePrefix.c_str()};
+
+    MockOfflineCompiler mockOfflineCompiler{};
+    mockOfflineCompiler.initialize(argv.size(), argv);
+
+    Ar::ArEncoder ar;
+    const std::string pointerSize{"32"};
+    const auto mockArgHelper = mockOfflineCompiler.uniqueHelper.get();
+    const auto deviceConfig = getDeviceConfig(mockOfflineCompiler, mockArgHelper);
+
+    ::testing::internal::CaptureStdout();
+    const auto result = appendBuiltFatBinaryTarget(OclocErrorCode::INVALID_FILE, argv, pointerSize, ar, &mockOfflineCompiler, mockArgHelper, deviceConfig);
+    const auto output{::testing::internal::GetCapturedStdout()};
+
+    EXPECT_EQ(OclocErrorCode::INVALID_FILE, result);
+    EXPECT_EQ(0, mockOfflineCompiler.buildCalledCount);
+    EXPECT_NE(std::string::npos, output.find("Build failed for : " + deviceConfig));
+}
+
 } // namespace NEO
\ No newline at end of file
@@ -450,6 +450,38 @@ TEST(MultiCommandWhiteboxTest, GivenCommandLineWithMissingApostropheWhenRunningB
     EXPECT_EQ(OclocErrorCode::INVALID_FILE, mockMultiCommand.retValues[0]);
 }
 
+TEST(MultiCommandWhiteboxTest, GivenCommandFileWithTwoBuildsWhenInitializingThenCompilerLibrariesArePinnedOnceBeforeBuildsAreStarted) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.callBaseSingleBuild = false;
+    mockMultiCommand.callBasePinCompilerLibraries = false;
+
+    mockMultiCommand.uniqueHelper->callBaseFileExists = false;
+    mockMultiCommand.uniqueHelper->callBaseReadFileToVectorOfStrings = false;
+    mockMultiCommand.filesMap["commands.txt"] = "";
+
+    const std::string validLine{"-file test_files/copybuffer.cl -device " + gEnvironment->devicePrefix};
+    mockMultiCommand.lines.push_back(validLine);
+    mockMultiCommand.lines.push_back(validLine);
+
+    const std::vector<std::string> args = {"ocloc", "multi", "commands.txt", "-q"};
+    const auto result = mockMultiCommand.initialize(args);
+
+    EXPECT_EQ(OclocErrorCode::SUCCESS, result);
+    EXPECT_EQ(1, mockMultiCommand.pinCompilerLibrariesCalledCount);
+    EXPECT_EQ(0, mockMultiCommand.singleBuildsBeforePinningCount);
+    EXPECT_EQ(2, mockMultiCommand.singleBuildCalledCount);
+}
+
+TEST(MultiCommandWhiteboxTest, WhenPinningCompilerLibrariesThenOnlySuccessfullyLoadedLibrariesAreKept) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.pinCompilerLibraries();
+
+    EXPECT_LE(mockMultiCommand.pinnedCompilerLibraries.size(), 2u);
+    for (const auto &library : mockMultiCommand.pinnedCompilerLibraries) {
+        EXPECT_NE(nullptr, library);
+    }
+}
+
 TEST(MultiCommandWhiteboxTest, GivenTwoValidCommandLinesAndVerboseModeWhenRunningBuildsThenBuildsAreStartedReturnValuesAreStoredAndLogsArePrinted) {
     MockMultiCommand mockMultiCommand{};
     mockMultiCommand.quiet = false;
@@ -587,6 +587,44 @@ HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenPrintBOsForSubmitWhenPrint
     mm->freeGraphicsMemory(buffer);
 }
 
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenAllocationsSharingReusableBufferObjectWhenCollectingBOsThenBufferObjectIsAddedOncePerResidencyEpoch) {
+    BufferObject sharedBo(mock, 3, 1, 0, 1);
+    sharedBo.markAsReusableAllocation();
+    DrmAllocation allocation1(0, AllocationType::UNKNOWN, &sharedBo, nullptr, 0, static_cast<osHandle>(0u), MemoryPool::MemoryNull);
+    DrmAllocation allocation2(0, AllocationType::UNKNOWN, &sharedBo, nullptr, 0, static_cast<osHandle>(0u), MemoryPool::MemoryNull);
+    auto osContextLinux = static_cast<OsContextLinux *>(&csr->getOsContext());
+
+    std::vector<BufferObject *> bos;
+    osContextLinux->startNewResidencyEpoch();
+    allocation1.makeBOsResident(osContextLinux, 0, &bos, true);
+    allocation2.makeBOsResident(osContextLinux, 0, &bos, true);
+    EXPECT_EQ(1u, bos.size());
+
+    bos.clear();
+    osContextLinux->startNewResidencyEpoch();
+    allocation2.makeBOsResident(osContextLinux, 0, &bos, true);
+    allocation1.makeBOsResident(osContextLinux, 0, &bos, true);
+    EXPECT_EQ(1u, bos.size());
+}
+
+HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, givenReusableBufferObjectStampedByAnotherOsContextWhenCollectingBOsThenDuplicatesAreStillFiltered) {
+    BufferObject sharedBo(mock, 3, 1, 0, 1);
+    sharedBo.markAsReusableAllocation();
+    DrmAllocation allocation(0, AllocationType::UNKNOWN, &sharedBo, nullptr, 0, static_cast<osHandle>(0u), MemoryPool::MemoryNull);
+    auto osContextLinux = static_cast<OsContextLinux *>(&csr->getOsContext());
+
+    std::vector<BufferObject *> bos;
+    osContextLinux->startNewResidencyEpoch();
+    allocation.makeBOsResident(osContextLinux, 0, &bos, true);
+    EXPECT_EQ(1u, bos.size());
+
+    constexpr uint64_t otherOsContextStamp = (static_cast<uint64_t>(0xFFu) << 48) | 1u;
+    sharedBo.exchangeResidencyStamp(otherOsContextStamp);
+
+    allocation.makeBOsResident(osContextLinux, 0, &bos, true);
+    EXPECT_EQ(1u, bos.size());
+}
+
 HWTEST_TEMPLATED_F(DrmCommandStreamEnhancedTest, GivenFlushMultipleTimesThenSucceeds) {
     auto &cs = csr->getCS();
     auto commandBuffer = static_cast<DrmAllocation *>(cs.getGraphicsAllocation());
@@ -15,6 +15,7 @@
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/linux/drm_memory_operations_handler.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/os_interface/linux/device_command_stream_fixture.h"
 #include "shared/test/common/test_macros/test.h"
@@ -167,24 +168,51 @@ TEST_F(DrmGemCloseWorkerTests, givenAllocationWhenAskedForUnreferenceWithForceFl
 TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledWithBlockingFlagThenThreadIsClosed) {
     struct mockDrmGemCloseWorker : DrmGemCloseWorker {
         using DrmGemCloseWorker::DrmGemCloseWorker;
-        using DrmGemCloseWorker::thread;
+        using DrmGemCloseWorker::threads;
     };
 
     std::unique_ptr<mockDrmGemCloseWorker> worker(new mockDrmGemCloseWorker(*mm));
-    EXPECT_NE(nullptr, worker->thread);
+    EXPECT_FALSE(worker->threads.empty());
     worker->close(true);
-    EXPECT_EQ(nullptr, worker->thread);
+    EXPECT_TRUE(worker->threads.empty());
 }
 
 TEST_F(DrmGemCloseWorkerTests, givenDrmGemCloseWorkerWhenCloseIsCalledMultipleTimeWithBlockingFlagThenThreadIsClosed) {
     struct mockDrmGemCloseWorker : DrmGemCloseWorker {
         using DrmGemCloseWorker::DrmGemCloseWorker;
-        using DrmGemCloseWorker::thread;
+        using DrmGemCloseWorker::threads;
     };
 
     std::unique_ptr<mockDrmGemCloseWorker> worker(new mockDrmGemCloseWorker(*mm));
     worker->close(true);
     worker->close(true);
     worker->close(true);
-    EXPECT_EQ(nullptr, worker->thread);
+    EXPECT_TRUE(worker->threads.empty());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenDefaultSettingsWhenCreatingWorkerThenSingleThreadIsUsed) {
+    auto worker = std::make_unique<DrmGemCloseWorker>(*mm);
+    EXPECT_EQ(1u, worker->getNumThreads());
+    EXPECT_EQ(0u, worker->getQueueDepth());
+}
+
+TEST_F(DrmGemCloseWorkerTests, givenGemCloseWorkerThreadCountSetWhenClosingManyGemsThenAllAreClosedByWorkerThreads) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.GemCloseWorkerThreadCount.set(4);
+
+    constexpr int numBufferObjects = 64;
+    this->drmMock->gem_close_expected = numBufferObjects;
+
+    auto worker = std::make_unique<DrmGemCloseWorker>(*mm);
+    EXPECT_EQ(4u, worker->getNumThreads());
+
+    for (int i = 0; i < numBufferObjects; i++) {
+        worker->push(new BufferObject(this->drmMock, 3, 1, 0, 1));
+    }
+    EXPECT_LE(worker->getQueueDepth(), static_cast<uint32_t>(numBufferObjects));
+
+    worker->close(true);
+    EXPECT_EQ(0u, worker->getQueueDepth());
+    EXPECT_TRUE(worker->isEmpty());
+    EXPECT_EQ(0u, worker->getNumThreads());
 }
@@ -11,6 +11,7 @@
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/memory_manager/os_agnostic_memory_manager.h"
+#include "shared/source/os_interface/device_factory.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/os_library.h"
 #include "shared/source/os_interface/os_time.h"
@@ -155,6 +156,20 @@ TEST(WddmDiscoverDevices, givenMultipleRootDevicesExposedWhenCreateMultipleRootD
     EXPECT_EQ(requestedNumRootDevices, hwDeviceIds.size());
 }
 
+TEST(WddmDiscoverDevices, givenParallelDeviceInitializationEnabledWhenPreparingDeviceEnvironmentsThenAllRootDeviceEnvironmentsAreInitialized) {
+    DebugManagerStateRestore restorer{};
+    DebugManager.flags.EnableParallelDeviceInitialization.set(1);
+    VariableBackup<uint32_t> backup{&numRootDevicesToEnum, 3u};
+
+    ExecutionEnvironment executionEnvironment;
+    EXPECT_TRUE(DeviceFactory::prepareDeviceEnvironments(executionEnvironment));
+    ASSERT_EQ(numRootDevicesToEnum, executionEnvironment.rootDeviceEnvironments.size());
+    for (auto &rootDeviceEnvironment : executionEnvironment.rootDeviceEnvironments) {
+        EXPECT_NE(nullptr, rootDeviceEnvironment->osInterface);
+        EXPECT_NE(nullptr, rootDeviceEnvironment->getGmmHelper());
+    }
+}
+
 TEST(WddmDiscoverDevices, WhenAdapterDescriptionContainsVirtualRenderThenAdapterIsDiscovered) {
     VariableBackup<const char *> descriptionBackup(&UltDxCoreAdapter::description);
     descriptionBackup = "Virtual Render";
@@ -195,6 +195,23 @@ TEST_F(Wddm23Tests, givenCurrentPendingFenceValueGreaterThanPendingFenceValueWhe
     EXPECT_EQ(1u, wddm->waitOnGPUResult.called);
 }
 
+TEST_F(Wddm23Tests, givenPagingFenceSpinTimeWhenPagingFenceIsNotReachedWithinSpinTimeThenWaitOnGpuIsCalled) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.WddmPagingFenceSpinTime.set(1);
+
+    COMMAND_BUFFER_HEADER cmdBufferHeader = {};
+    WddmSubmitArguments submitArgs = {};
+    submitArgs.contextHandle = osContext->getWddmContextHandle();
+    submitArgs.hwQueueHandle = osContext->getHwQueue().handle;
+    submitArgs.monitorFence = &osContext->getResidencyController().getMonitoredFence();
+
+    *wddm->pagingFenceAddress = 1;
+    wddm->currentPagingFenceValue = 2;
+
+    wddm->submit(123, 456, &cmdBufferHeader, submitArgs);
+    EXPECT_EQ(1u, wddm->waitOnGPUResult.called);
+}
+
 TEST_F(Wddm23Tests, givenDestructionOsContextWinWhenCallingDestroyMonitorFenceThenDoNotCallGdiDestroy) {
     osContext.reset(nullptr);
     EXPECT_EQ(1u, wddmMockInterface->destroyMonitorFenceCalled);
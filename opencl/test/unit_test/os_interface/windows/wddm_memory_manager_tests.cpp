@@ -1639,6 +1639,16 @@ TEST_F(WddmMemoryManagerWithAsyncDeleterTest, givenWddmWhenAsyncDeleterIsDisable
     EXPECT_EQ(1u, wddm->destroyAllocationResult.called);
 }
 
+TEST_F(WddmMemoryManagerWithAsyncDeleterTest, givenAllocationWithMultipleHandlesWhenFreeingThenAllHandlesAreDeferredInSingleDeletion) {
+    auto allocation = new WddmAllocation(0, 2u, AllocationType::BUFFER, reinterpret_cast<void *>(0x1000), 0x1000, MemoryConstants::pageSize, nullptr, MemoryPool::LocalMemory, 0u, 1u);
+    allocation->setHandle(0x10, 0);
+    allocation->setHandle(0x20, 1);
+
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(1, deleter->deferDeletionCalled);
+    EXPECT_EQ(1u, wddm->destroyAllocationResult.called);
+}
+
 TEST_F(WddmMemoryManagerWithAsyncDeleterTest, givenMemoryManagerWithAsyncDeleterWhenCannotAllocateMemoryForTiledImageThenDrainIsCalledAndCreateAllocationIsCalledTwice) {
     UltDeviceFactory deviceFactory{1, 0};
     ImageDescriptor imgDesc = {};
@@ -806,6 +806,81 @@ TEST_F(WddmResidencyControllerWithGdiTest, WhenTrimmingToBudgetThenEvictedAlloca
     EXPECT_TRUE(allocation3.getResidencyData().resident[osContextId]);
 }
 
+TEST_F(WddmResidencyControllerWithGdiTest, givenTrimResidencyByLastUsedFenceWhenTrimmingToBudgetThenLeastRecentlyUsedAllocationsAreEvictedFirst) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.TrimResidencyByLastUsedFence.set(1);
+
+    auto ptr = reinterpret_cast<void *>(0x1000);
+    auto gmmHelper = rootDeviceEnvironment->getGmmHelper();
+    auto canonizedAddress = gmmHelper->canonize(castToUint64(const_cast<void *>(ptr)));
+    WddmAllocation allocation1(0, AllocationType::UNKNOWN, ptr, canonizedAddress, 0x1000, nullptr, MemoryPool::MemoryNull, 0u, 1u);
+    WddmAllocation allocation2(0, AllocationType::UNKNOWN, ptr, canonizedAddress, 0x1000, nullptr, MemoryPool::MemoryNull, 0u, 1u);
+    WddmAllocation allocation3(0, AllocationType::UNKNOWN, ptr, canonizedAddress, 0x1000, nullptr, MemoryPool::MemoryNull, 0u, 1u);
+
+    allocation1.getResidencyData().updateCompletionData(2, osContextId);
+    allocation1.getResidencyData().resident[osContextId] = true;
+
+    allocation2.getResidencyData().updateCompletionData(0, osContextId);
+    allocation2.getResidencyData().resident[osContextId] = true;
+
+    allocation3.getResidencyData().updateCompletionData(1, osContextId);
+    allocation3.getResidencyData().resident[osContextId] = true;
+
+    *residencyController->getMonitoredFence().cpuAddress = 2;
+    residencyController->getMonitoredFence().lastSubmittedFence = 2;
+    residencyController->getMonitoredFence().currentFenceValue = 3;
+
+    wddm->evictResult.called = 0;
+    wddm->waitFromCpuResult.called = 0;
+
+    residencyController->addToTrimCandidateList(&allocation1);
+    residencyController->addToTrimCandidateList(&allocation2);
+    residencyController->addToTrimCandidateList(&allocation3);
+
+    bool status = residencyController->trimResidencyToBudget(0x2000);
+
+    EXPECT_TRUE(status);
+    EXPECT_EQ(2u, wddm->evictResult.called);
+    EXPECT_EQ(0u, wddm->waitFromCpuResult.called);
+    EXPECT_EQ(1u, residencyController->peekTrimCandidatesCount());
+
+    EXPECT_TRUE(allocation1.getResidencyData().resident[osContextId]);
+    EXPECT_FALSE(allocation2.getResidencyData().resident[osContextId]);
+    EXPECT_FALSE(allocation3.getResidencyData().resident[osContextId]);
+    EXPECT_NE(trimListUnusedPosition, allocation1.getTrimCandidateListPosition(osContextId));
+}
+
+TEST_F(WddmResidencyControllerWithGdiTest, givenTrimResidencyByLastUsedFenceWhenAllocationNotSubmittedYetThenItIsNotEvicted) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.TrimResidencyByLastUsedFence.set(1);
+    gdi->setNonZeroNumBytesToTrimInEvict();
+
+    MockWddmAllocation allocation1(rootDeviceEnvironment->getGmmHelper());
+    MockWddmAllocation allocation2(rootDeviceEnvironment->getGmmHelper());
+
+    allocation1.getResidencyData().updateCompletionData(3, osContextId);
+    allocation1.getResidencyData().resident[osContextId] = true;
+
+    allocation2.getResidencyData().updateCompletionData(1, osContextId);
+    allocation2.getResidencyData().resident[osContextId] = true;
+
+    *residencyController->getMonitoredFence().cpuAddress = 2;
+    residencyController->getMonitoredFence().lastSubmittedFence = 2;
+    residencyController->getMonitoredFence().currentFenceValue = 3;
+
+    wddm->evictResult.called = 0;
+
+    residencyController->addToTrimCandidateList(&allocation1);
+    residencyController->addToTrimCandidateList(&allocation2);
+
+    bool status = residencyController->trimResidencyToBudget(3 * 4096);
+
+    EXPECT_FALSE(status);
+    EXPECT_EQ(1u, wddm->evictResult.called);
+    EXPECT_TRUE(allocation1.getResidencyData().resident[osContextId]);
+    EXPECT_FALSE(allocation2.getResidencyData().resident[osContextId]);
+}
+
 TEST_F(WddmResidencyControllerWithGdiTest, GivenLastFenceIsGreaterThanMonitoredWhenTrimmingToBudgetThenWaitForCpu) {
     gdi->setNonZeroNumBytesToTrimInEvict();
 
@@ -1017,6 +1092,51 @@ TEST_F(WddmResidencyControllerWithGdiAndMemoryManagerTest, GivenTripleAllocation
     memoryManager->freeGraphicsMemory(allocationTriple);
 }
 
+TEST_F(WddmResidencyControllerWithGdiAndMemoryManagerTest, givenSkipMakeResidentForResidentTrimCandidateFragmentsWhenMakingResidentTripleAllocationFromTrimCandidateListWithResidentFragmentsThenMakeResidentIsNotCalled) {
+    if (executionEnvironment->memoryManager->isLimitedGPU(0)) {
+        GTEST_SKIP();
+    }
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SkipMakeResidentForResidentTrimCandidateFragments.set(1);
+    void *ptr = reinterpret_cast<void *>(wddm->virtualAllocAddress + 0x1500);
+    wddm->callBaseMakeResident = true;
+
+    WddmAllocation *allocationTriple = (WddmAllocation *)memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), false, 2 * MemoryConstants::pageSize}, ptr);
+    ResidencyContainer residencyPack{allocationTriple};
+
+    residencyController->makeResidentResidencyAllocations(residencyPack);
+    EXPECT_EQ(1u, wddm->makeResidentResult.called);
+
+    residencyController->addToTrimCandidateList(allocationTriple);
+    residencyController->makeResidentResidencyAllocations(residencyPack);
+    EXPECT_EQ(1u, wddm->makeResidentResult.called);
+    EXPECT_EQ(trimListUnusedPosition, allocationTriple->getTrimCandidateListPosition(osContextId));
+
+    memoryManager->freeGraphicsMemory(allocationTriple);
+}
+
+TEST_F(WddmResidencyControllerWithGdiAndMemoryManagerTest, givenResidentTripleAllocationOnTrimCandidateListWhenMakingResidentResidencyAllocationsThenFragmentsAreMadeResidentAgain) {
+    if (executionEnvironment->memoryManager->isLimitedGPU(0)) {
+        GTEST_SKIP();
+    }
+    DebugManagerStateRestore restorer;
+    void *ptr = reinterpret_cast<void *>(wddm->virtualAllocAddress + 0x1500);
+    wddm->callBaseMakeResident = true;
+
+    WddmAllocation *allocationTriple = (WddmAllocation *)memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), false, 2 * MemoryConstants::pageSize}, ptr);
+    ResidencyContainer residencyPack{allocationTriple};
+
+    residencyController->makeResidentResidencyAllocations(residencyPack);
+    EXPECT_EQ(1u, wddm->makeResidentResult.called);
+
+    residencyController->addToTrimCandidateList(allocationTriple);
+    residencyController->makeResidentResidencyAllocations(residencyPack);
+    EXPECT_EQ(2u, wddm->makeResidentResult.called);
+    EXPECT_EQ(trimListUnusedPosition, allocationTriple->getTrimCandidateListPosition(osContextId));
+
+    memoryManager->freeGraphicsMemory(allocationTriple);
+}
+
 TEST_F(WddmResidencyControllerWithGdiAndMemoryManagerTest, GivenTripleAllocationsWhenMakingResidentResidencyAllocationsThenLastFencePlusOneIsSet) {
     MockWddmAllocation allocation1(gmmHelper);
     MockWddmAllocation allocation2(gmmHelper);
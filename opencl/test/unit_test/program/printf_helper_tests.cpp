@@ -924,6 +924,26 @@ TEST_F(PrintFormatterTest, GivenTypeSmallerThan4BThenItIsReadAs4BValue) {
     EXPECT_STREQ(expectedOutput, output);
 }
 
+TEST_F(PrintFormatterTest, GivenMultipleFormatStringsWhenPrintingToStdoutThenWholeOutputIsPrintedInOrder) {
+    storeData(injectFormatString("first %d\\n"));
+    injectValue(1);
+    storeData(injectFormatString("second %d\\n"));
+    injectValue(2);
+
+    testing::internal::CaptureStdout();
+    printFormatter->printKernelOutput();
+    std::string output = testing::internal::GetCapturedStdout();
+    EXPECT_STREQ("first 1\nsecond 2\n", output.c_str());
+}
+
+TEST_F(PrintFormatterTest, GivenEmptyBufferWhenPrintingToStdoutThenNothingIsPrinted) {
+    *reinterpret_cast<uint32_t *>(underlyingBuffer) = 4;
+
+    testing::internal::CaptureStdout();
+    printFormatter->printKernelOutput();
+    EXPECT_TRUE(testing::internal::GetCapturedStdout().empty());
+}
+
 TEST(printToSTDOUTTest, GivenStringWhenPrintingToStdoutThenOutputOccurs) {
     testing::internal::CaptureStdout();
     printToSTDOUT("test");
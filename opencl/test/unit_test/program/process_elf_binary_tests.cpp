@@ -15,6 +15,7 @@
 #include "shared/source/helpers/string.h"
 #include "shared/test/common/device_binary_format/elf/elf_tests_data.h"
 #include "shared/test/common/device_binary_format/patchtokens_tests.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/gtest_helpers.h"
 #include "shared/test/common/helpers/test_files.h"
 #include "shared/test/common/mocks/mock_device.h"
@@ -65,6 +66,25 @@ TEST_F(ProcessElfBinaryTests, GivenValidBinaryWhenCreatingProgramFromBinaryThenS
     EXPECT_EQ(0, memcmp(pBinary.data(), program->buildInfos[rootDeviceIndex].packedDeviceBinary.get(), binarySize));
 }
 
+TEST_F(ProcessElfBinaryTests, GivenDeferPackedProgramBinaryCopyWhenCreatingProgramFromBinaryThenPackedBinaryIsCreatedOnDemand) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DeferPackedProgramBinaryCopy.set(1);
+
+    auto mockElf = std::make_unique<MockElfBinaryPatchtokens<>>(device->getHardwareInfo());
+    auto pBinary = mockElf->storage;
+    auto binarySize = mockElf->storage.size();
+
+    cl_int retVal = program->createProgramFromBinary(pBinary.data(), binarySize, *device);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(nullptr, program->buildInfos[rootDeviceIndex].packedDeviceBinary);
+    EXPECT_NE(nullptr, program->buildInfos[rootDeviceIndex].unpackedDeviceBinary);
+
+    retVal = program->packDeviceBinary(*device);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_NE(nullptr, program->buildInfos[rootDeviceIndex].packedDeviceBinary);
+    EXPECT_NE(0u, program->buildInfos[rootDeviceIndex].packedDeviceBinarySize);
+}
+
 TEST_F(ProcessElfBinaryTests, GivenValidSpirBinaryWhenCreatingProgramFromBinaryThenSuccessIsReturned) {
     //clCreateProgramWithIL => SPIR-V stored as source code
     const uint32_t spirvBinary[2] = {0x03022307, 0x07230203};
@@ -58,6 +58,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -2085,6 +2086,33 @@ TEST_F(ProgramTests, whenCreatingFromZebinThenAppendAllowZebinFlagToBuildOptions
     EXPECT_STREQ(expectedOptions.c_str(), program->options.c_str());
 }
 
+TEST_F(ProgramTests, whenCreatingFromZebinThenPackedBinaryIsNotCopiedUntilRequested) {
+    if (sizeof(void *) != 8U) {
+        GTEST_SKIP();
+    }
+
+    auto copyHwInfo = *defaultHwInfo;
+    CompilerHwInfoConfig::get(copyHwInfo.platform.eProductFamily)->adjustHwInfoForIgc(copyHwInfo);
+
+    ZebinTestData::ValidEmptyProgram zebin;
+    zebin.elfHeader->machine = copyHwInfo.platform.eProductFamily;
+
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr, mockRootDeviceIndex));
+    auto program = std::make_unique<MockProgram>(toClDeviceVector(*device));
+    cl_int retVal = program->createProgramFromBinary(zebin.storage.data(), zebin.storage.size(), *device);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    auto &buildInfo = program->buildInfos[mockRootDeviceIndex];
+    EXPECT_EQ(nullptr, buildInfo.packedDeviceBinary);
+    EXPECT_EQ(0u, buildInfo.packedDeviceBinarySize);
+    ASSERT_EQ(zebin.storage.size(), buildInfo.unpackedDeviceBinarySize);
+
+    retVal = program->packDeviceBinary(*device);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    ASSERT_EQ(zebin.storage.size(), buildInfo.packedDeviceBinarySize);
+    EXPECT_EQ(0, memcmp(zebin.storage.data(), buildInfo.packedDeviceBinary.get(), buildInfo.packedDeviceBinarySize));
+}
+
 TEST_F(ProgramTests, givenProgramFromGenBinaryWhenSLMSizeIsBiggerThenDeviceLimitThenReturnError) {
     PatchTokensTestData::ValidProgramWithKernelUsingSlm patchtokensProgram;
     patchtokensProgram.slmMutable->TotalInlineLocalMemorySize = static_cast<uint32_t>(pDevice->getDeviceInfo().localMemSize * 2);
@@ -3057,6 +3085,55 @@ TEST_F(ProgramMultiRootDeviceTests, WhenProgramIsCreatedThenBuildInfosVectorIsPr
     }
 }
 
+struct MockCompilerInterfaceCaptureBuildSources : MockCompilerInterfaceCaptureBuildOptions {
+    TranslationOutput::ErrorCode build(const NEO::Device &device, const TranslationInput &input, TranslationOutput &out) override {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            buildSourceTypes[device.getRootDeviceIndex()] = input.srcType;
+            buildSources[device.getRootDeviceIndex()].assign(input.src.begin(), input.src.end());
+        }
+        if (input.srcType == IGC::CodeType::oclC) {
+            out.intermediateCodeType = IGC::CodeType::spirV;
+            out.intermediateRepresentation.mem = makeCopy(intermediateRepresentation.c_str(), intermediateRepresentation.size());
+            out.intermediateRepresentation.size = intermediateRepresentation.size();
+            out.frontendCompilerLog = "frontend log";
+        }
+        return TranslationOutput::ErrorCode::Success;
+    }
+
+    std::mutex mutex;
+    std::map<uint32_t, IGC::CodeType::CodeType_t> buildSourceTypes;
+    std::map<uint32_t, std::string> buildSources;
+    const std::string intermediateRepresentation = "intermediate representation";
+};
+
+TEST_F(ProgramMultiRootDeviceTests, givenParallelProgramBuildWhenBuildingSourceForDevicesOfSameProductThenFrontendOutputOfFirstDeviceIsUsedByRemainingDevices) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ParallelProgramBuild.set(1);
+
+    auto compilerInterface = new MockCompilerInterfaceCaptureBuildSources();
+    device1->getExecutionEnvironment()->rootDeviceEnvironments[device1->getRootDeviceIndex()]->compilerInterface.reset(compilerInterface);
+
+    ClDeviceVector deviceVector;
+    deviceVector.push_back(device1);
+    deviceVector.push_back(device2);
+    auto program = std::make_unique<SucceedingGenBinaryProgram>(deviceVector);
+    program->sourceCode = "__kernel mock() {}";
+    program->createdFrom = Program::CreatedFrom::SOURCE;
+
+    EXPECT_EQ(CL_SUCCESS, program->build(deviceVector, nullptr, false));
+
+    EXPECT_EQ(IGC::CodeType::oclC, compilerInterface->buildSourceTypes[device1->getRootDeviceIndex()]);
+    EXPECT_EQ(program->sourceCode, compilerInterface->buildSources[device1->getRootDeviceIndex()]);
+    EXPECT_EQ(IGC::CodeType::spirV, compilerInterface->buildSourceTypes[device2->getRootDeviceIndex()]);
+    EXPECT_EQ(compilerInterface->intermediateRepresentation, compilerInterface->buildSources[device2->getRootDeviceIndex()]);
+
+    EXPECT_TRUE(program->isSpirV);
+    ASSERT_NE(nullptr, program->irBinary);
+    EXPECT_EQ(compilerInterface->intermediateRepresentation, std::string(program->irBinary.get(), program->irBinarySize));
+    EXPECT_TRUE(hasSubstr(program->getBuildLog(device2->getRootDeviceIndex()), "frontend log"));
+}
+
 class MockCompilerInterfaceWithGtpinParam : public CompilerInterface {
   public:
     TranslationOutput::ErrorCode link(
@@ -3100,6 +3177,8 @@ TEST(ProgramReplaceDeviceBinary, GivenBinaryZebinThenUseAsBothPackedAndUnpackedB
     auto rootDeviceIndex = device->getRootDeviceIndex();
     MockProgram program{&context, false, toClDeviceVector(*device)};
     program.replaceDeviceBinary(std::move(src), zebin.storage.size(), rootDeviceIndex);
+    EXPECT_EQ(nullptr, program.buildInfos[rootDeviceIndex].packedDeviceBinary);
+    EXPECT_EQ(CL_SUCCESS, program.packDeviceBinary(*device));
     ASSERT_EQ(zebin.storage.size(), program.buildInfos[rootDeviceIndex].packedDeviceBinarySize);
     ASSERT_EQ(zebin.storage.size(), program.buildInfos[rootDeviceIndex].unpackedDeviceBinarySize);
     ASSERT_NE(nullptr, program.buildInfos[rootDeviceIndex].packedDeviceBinary);
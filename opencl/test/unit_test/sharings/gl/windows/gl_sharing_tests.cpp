@@ -293,6 +293,30 @@ TEST_F(glSharingTests, givenClGLBufferWhenItIsAcquiredTwiceAfterReleaseThenAcuqi
     EXPECT_EQ(CL_SUCCESS, retVal);
 }
 
+TEST_F(glSharingTests, givenProducerWriteTrackingEnabledWhenGlBufferIsAcquiredAgainWithoutGlSyncThenGlIsNotCalled) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableSharingProducerWriteTracking.set(1);
+
+    std::unique_ptr<Buffer> buffer(GlBuffer::createSharedGlBuffer(&context, CL_MEM_READ_WRITE, bufferId, nullptr));
+    auto sharingHandler = buffer->peekSharingHandler();
+
+    sharingHandler->acquire(buffer.get(), rootDeviceIndex);
+    sharingHandler->release(buffer.get(), rootDeviceIndex);
+    EXPECT_EQ(2, mockGlSharing->dllParam->getParam("GLAcquireSharedBufferCalled"));
+    EXPECT_EQ(1, mockGlSharing->dllParam->getParam("GLReleaseSharedBufferCalled"));
+
+    sharingHandler->acquire(buffer.get(), rootDeviceIndex);
+    sharingHandler->release(buffer.get(), rootDeviceIndex);
+    EXPECT_EQ(2, mockGlSharing->dllParam->getParam("GLAcquireSharedBufferCalled"));
+    EXPECT_EQ(1, mockGlSharing->dllParam->getParam("GLReleaseSharedBufferCalled"));
+
+    mockGlSharingFunctions->signalProducerWrite();
+    sharingHandler->acquire(buffer.get(), rootDeviceIndex);
+    sharingHandler->release(buffer.get(), rootDeviceIndex);
+    EXPECT_EQ(3, mockGlSharing->dllParam->getParam("GLAcquireSharedBufferCalled"));
+    EXPECT_EQ(2, mockGlSharing->dllParam->getParam("GLReleaseSharedBufferCalled"));
+}
+
 TEST_F(glSharingTests, givenClGLBufferWhenItIsAcquireCountIsDecrementedToZeroThenCallReleaseFunction) {
     std::unique_ptr<Buffer> buffer(GlBuffer::createSharedGlBuffer(&context, CL_MEM_READ_WRITE, bufferId, nullptr));
     auto sharingHandler = buffer->peekSharingHandler();
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -115,3 +115,55 @@ TEST(sharingHandler, givenSharingHandlerWhenAcquiringThenReturnErrorCode) {
     auto result = sharingHandler.acquire(&memObj, graphicsAllocation->getRootDeviceIndex());
     EXPECT_NE(CL_SUCCESS, result);
 }
+
+TEST(sharingHandler, givenProducerWritesTrackerWhenAcquiringWithoutNewProducerWritesThenSynchronizationAndReleaseAreSkipped) {
+    char buffer[64];
+    MockContext context;
+    MockGraphicsAllocation *mockAllocation = new MockGraphicsAllocation(buffer, sizeof(buffer));
+    std::unique_ptr<MemObj> memObj(
+        new MemObj(&context, CL_MEM_OBJECT_BUFFER,
+                   ClMemoryPropertiesHelper::createMemoryProperties(CL_MEM_USE_HOST_PTR, 0, 0, &context.getDevice(0)->getDevice()),
+                   CL_MEM_USE_HOST_PTR, 0, sizeof(buffer), buffer, buffer, GraphicsAllocationHelper::toMultiGraphicsAllocation(mockAllocation), true, false, false));
+
+    struct MockSharingFunctions : SharingFunctions {
+        uint32_t getId() const override { return 0u; }
+    } sharingFunctions;
+
+    struct MockSharingHandler : SharingHandler {
+        SharingFunctions *getProducerWritesTracker() override { return producerWritesTracker; }
+        void synchronizeObject(UpdateData &updateData) override {
+            synchronizeCount++;
+            updateData.synchronizationStatus = ACQUIRE_SUCCESFUL;
+        }
+        void releaseResource(MemObj *memObject, uint32_t rootDeviceIndex) override {
+            releaseCount++;
+        };
+        SharingFunctions *producerWritesTracker = nullptr;
+        int synchronizeCount = 0;
+        int releaseCount = 0;
+    } sharingHandler;
+    sharingHandler.producerWritesTracker = &sharingFunctions;
+
+    auto rootDeviceIndex = mockAllocation->getRootDeviceIndex();
+    EXPECT_EQ(CL_SUCCESS, sharingHandler.acquire(memObj.get(), rootDeviceIndex));
+    sharingHandler.release(memObj.get(), rootDeviceIndex);
+    EXPECT_EQ(1, sharingHandler.synchronizeCount);
+    EXPECT_EQ(1, sharingHandler.releaseCount);
+
+    EXPECT_EQ(CL_SUCCESS, sharingHandler.acquire(memObj.get(), rootDeviceIndex));
+    sharingHandler.release(memObj.get(), rootDeviceIndex);
+    EXPECT_EQ(1, sharingHandler.synchronizeCount);
+    EXPECT_EQ(1, sharingHandler.releaseCount);
+
+    sharingFunctions.signalProducerWrite();
+    EXPECT_EQ(CL_SUCCESS, sharingHandler.acquire(memObj.get(), rootDeviceIndex));
+    sharingHandler.release(memObj.get(), rootDeviceIndex);
+    EXPECT_EQ(2, sharingHandler.synchronizeCount);
+    EXPECT_EQ(2, sharingHandler.releaseCount);
+
+    sharingHandler.producerWritesTracker = nullptr;
+    EXPECT_EQ(CL_SUCCESS, sharingHandler.acquire(memObj.get(), rootDeviceIndex));
+    sharingHandler.release(memObj.get(), rootDeviceIndex);
+    EXPECT_EQ(3, sharingHandler.synchronizeCount);
+    EXPECT_EQ(3, sharingHandler.releaseCount);
+}
@@ -280,6 +280,48 @@ TEST_F(VaSharingTests, givenMockVaWhenVaSurfaceIsCreatedThenMemObjectHasVaHandle
     delete vaSurface;
 }
 
+TEST_F(VaSharingTests, givenSurfaceImportCacheEnabledWhenSameVaSurfaceIsSharedAgainThenImportedAllocationIsReused) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableVaSurfaceImportCache.set(1);
+
+    auto vaSurface1 = VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
+                                                       CL_MEM_READ_WRITE, 0, &vaSurfaceId, 0, &errCode);
+    ASSERT_NE(nullptr, vaSurface1);
+    auto graphicsAllocation = vaSurface1->getGraphicsAllocation(rootDeviceIndex);
+    EXPECT_EQ(2u, graphicsAllocation->peekReuseCount());
+    EXPECT_TRUE(vaSharing->sharingFunctions.deriveImageCalled);
+
+    vaSharing->sharingFunctions.deriveImageCalled = false;
+    vaSharing->sharingFunctions.extGetSurfaceHandleCalled = false;
+    auto vaSurface2 = VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
+                                                       CL_MEM_READ_WRITE, 0, &vaSurfaceId, 0, &errCode);
+    ASSERT_NE(nullptr, vaSurface2);
+    EXPECT_FALSE(vaSharing->sharingFunctions.deriveImageCalled);
+    EXPECT_FALSE(vaSharing->sharingFunctions.extGetSurfaceHandleCalled);
+    EXPECT_EQ(graphicsAllocation, vaSurface2->getGraphicsAllocation(rootDeviceIndex));
+    EXPECT_EQ(vaSurface1->getSize(), vaSurface2->getSize());
+    EXPECT_EQ(3u, graphicsAllocation->peekReuseCount());
+
+    delete vaSurface1;
+    delete vaSurface2;
+    EXPECT_EQ(1u, graphicsAllocation->peekReuseCount());
+
+    auto vaSurfaceOtherFlags = VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
+                                                                CL_MEM_READ_ONLY, 0, &vaSurfaceId, 0, &errCode);
+    ASSERT_NE(nullptr, vaSurfaceOtherFlags);
+    EXPECT_TRUE(vaSharing->sharingFunctions.deriveImageCalled);
+    EXPECT_NE(graphicsAllocation, vaSurfaceOtherFlags->getGraphicsAllocation(rootDeviceIndex));
+    delete vaSurfaceOtherFlags;
+}
+
+TEST_F(VaSharingTests, givenDefaultSettingsWhenVaSurfaceIsSharedThenAllocationIsNotCached) {
+    auto vaSurface = VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
+                                                      CL_MEM_READ_WRITE, 0, &vaSurfaceId, 0, &errCode);
+    ASSERT_NE(nullptr, vaSurface);
+    EXPECT_EQ(0u, vaSurface->getGraphicsAllocation(rootDeviceIndex)->peekReuseCount());
+    delete vaSurface;
+}
+
 TEST_F(VaSharingTests, givenSupportedFourccFormatWhenIsSupportedPlanarFormatThenSuccessIsReturned) {
     EXPECT_TRUE(VASurface::isSupportedPlanarFormat(VA_FOURCC_P010));
     EXPECT_TRUE(VASurface::isSupportedPlanarFormat(VA_FOURCC_P016));
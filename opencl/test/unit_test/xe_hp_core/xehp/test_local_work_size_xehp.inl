@@ -18,6 +18,9 @@ using namespace NEO;
 using XeHPComputeWorkgroupSizeTest = Test<ClDeviceFixture>;
 
 XEHPTEST_F(XeHPComputeWorkgroupSizeTest, giveXeHpA0WhenKernelIsaIsBelowThresholdAndThereAreNoImageBarriersAndSlmThenSmallWorkgorupSizeIsSelected) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableWorkGroupSizeCache.set(0);
+
     auto program = std::make_unique<MockProgram>(toClDeviceVector(*pClDevice));
 
     MockKernelWithInternals mockKernel(*pClDevice);
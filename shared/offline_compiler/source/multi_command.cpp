@@ -9,6 +9,7 @@
 
 #include "shared/offline_compiler/source/ocloc_error_code.h"
 #include "shared/offline_compiler/source/ocloc_fatbinary.h"
+#include "shared/source/os_interface/os_inc_base.h"
 #include "shared/source/utilities/const_stringref.h"
 
 #include <memory>
@@ -124,6 +125,7 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
         return OclocErrorCode::INVALID_FILE;
     }
 
+    pinCompilerLibraries();
     runBuilds(args[0]);
 
     if (outputFileList != "") {
@@ -152,6 +154,18 @@ void MultiCommand::runBuilds(const std::string &argZero) {
     }
 }
 
+// Every single build creates its own compiler facades, which load and unload FCL and IGC.
+// Holding an extra reference for the whole run keeps libraries mapped, so that subsequent
+// builds only bump the reference count instead of loading and initializing them again.
+void MultiCommand::pinCompilerLibraries() {
+    for (auto libraryName : {Os::frontEndDllName, Os::igcDllName}) {
+        std::unique_ptr<OsLibrary> library{OsLibrary::load(libraryName)};
+        if (library) {
+            pinnedCompilerLibraries.push_back(std::move(library));
+        }
+    }
+}
+
 void MultiCommand::printHelp() {
     argHelper->printf(R"===(Compiles multiple files using a config file.
 
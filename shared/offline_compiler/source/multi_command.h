@@ -42,8 +42,10 @@ class MultiCommand {
     void addAdditionalOptionsToSingleCommandLine(std::vector<std::string> &, size_t buildId);
     void printHelp();
     void runBuilds(const std::string &argZero);
+    MOCKABLE_VIRTUAL void pinCompilerLibraries();
 
     OclocArgHelper *argHelper = nullptr;
+    std::vector<std::unique_ptr<OsLibrary>> pinnedCompilerLibraries;
     std::vector<int> retValues;
     std::vector<std::string> lines;
     std::string outFileName;
@@ -17,6 +17,7 @@
 #include <fstream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -56,6 +57,7 @@ class OclocArgHelper {
     uint64_t **lenOutputs = nullptr;
     bool hasOutput = false;
     MessagePrinter messagePrinter;
+    std::mutex printMutex;
     const std::vector<DeviceProduct> deviceProductTable;
     void moveOutputs();
     Source *findSourceFile(const std::string &filename);
@@ -98,10 +100,12 @@ class OclocArgHelper {
 
     MessagePrinter &getPrinterRef() { return messagePrinter; }
     void printf(const char *message) {
+        std::lock_guard<std::mutex> lock(printMutex);
         messagePrinter.printf(message);
     }
     template <typename... Args>
     void printf(const char *format, Args... args) {
+        std::lock_guard<std::mutex> lock(printMutex);
         messagePrinter.printf(format, std::forward<Args>(args)...);
     }
     template <typename EqComparableT>
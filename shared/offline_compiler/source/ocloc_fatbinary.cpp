@@ -19,9 +19,13 @@
 #include "igfxfmid.h"
 #include "platforms.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
+#include <thread>
 
 namespace NEO {
 bool requestedFatBinary(const std::vector<std::string> &args, OclocArgHelper *helper) {
@@ -225,23 +229,27 @@ int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy
 
     if (retVal == 0) {
         retVal = buildWithSafetyGuard(pCompiler);
-        std::string buildLog = pCompiler->getBuildLog();
-        if (buildLog.empty() == false) {
-            argHelper->printf("%s\n", buildLog.c_str());
-        }
-        if (retVal == 0) {
-            if (!pCompiler->isQuiet())
-                argHelper->printf("Build succeeded for : %s.\n", product.c_str());
-        } else {
-            argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), retVal);
-            argHelper->printf("Command was:");
-            for (const auto &arg : argsCopy)
-                argHelper->printf(" %s", arg.c_str());
-            argHelper->printf("\n");
-        }
+        retVal = appendBuiltFatBinaryTarget(retVal, argsCopy, pointerSize, fatbinary, pCompiler, argHelper, product);
     }
-    if (retVal) {
-        return retVal;
+    return retVal;
+}
+
+int appendBuiltFatBinaryTarget(int buildRetVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
+                               OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
+    std::string buildLog = pCompiler->getBuildLog();
+    if (buildLog.empty() == false) {
+        argHelper->printf("%s\n", buildLog.c_str());
+    }
+    if (buildRetVal == 0) {
+        if (!pCompiler->isQuiet())
+            argHelper->printf("Build succeeded for : %s.\n", product.c_str());
+    } else {
+        argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), buildRetVal);
+        argHelper->printf("Command was:");
+        for (const auto &arg : argsCopy)
+            argHelper->printf(" %s", arg.c_str());
+        argHelper->printf("\n");
+        return buildRetVal;
     }
 
     std::string productConfig("");
@@ -252,7 +260,28 @@ int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy
     }
 
     fatbinary.appendFileEntry(pointerSize + "." + productConfig, pCompiler->getPackedDeviceBinaryOutput());
-    return retVal;
+    return buildRetVal;
+}
+
+void buildFatBinaryTargetsInParallel(const std::vector<OfflineCompiler *> &compilers, std::vector<int> &retVals, uint32_t numThreads) {
+    retVals.assign(compilers.size(), 0);
+    std::atomic<size_t> nextTarget{0u};
+
+    // safety guard relies on process-wide state, so builds on worker threads are not guarded
+    auto worker = [&]() {
+        for (auto target = nextTarget++; target < compilers.size(); target = nextTarget++) {
+            retVals[target] = compilers[target]->build();
+        }
+    };
+
+    std::vector<std::thread> workers;
+    numThreads = std::min(numThreads, static_cast<uint32_t>(compilers.size()));
+    for (uint32_t i = 0; i < numThreads; i++) {
+        workers.emplace_back(worker);
+    }
+    for (auto &thread : workers) {
+        thread.join();
+    }
 }
 
 int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelper) {
@@ -264,10 +293,21 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
     bool spirvInput = false;
     bool excludeIr = false;
 
-    std::vector<std::string> argsCopy(args);
-    for (size_t argIndex = 1; argIndex < args.size(); argIndex++) {
-        const auto &currArg = args[argIndex];
-        const bool hasMoreArgs = (argIndex + 1 < args.size());
+    uint32_t numThreads = 1u;
+
+    std::vector<std::string> argsCopy;
+    for (size_t argIndex = 0; argIndex < args.size(); argIndex++) {
+        if ((argIndex > 0) && (ConstStringRef("-j") == args[argIndex]) && (argIndex + 1 < args.size())) {
+            numThreads = static_cast<uint32_t>(std::max(1, atoi(args[argIndex + 1].c_str())));
+            ++argIndex;
+            continue;
+        }
+        argsCopy.push_back(args[argIndex]);
+    }
+
+    for (size_t argIndex = 1; argIndex < argsCopy.size(); argIndex++) {
+        const auto &currArg = argsCopy[argIndex];
+        const bool hasMoreArgs = (argIndex + 1 < argsCopy.size());
         if ((ConstStringRef("-device") == currArg) && hasMoreArgs) {
             deviceArgIndex = argIndex + 1;
             ++argIndex;
@@ -276,13 +316,13 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         } else if ((CompilerOptions::arch64bit == currArg) || (ConstStringRef("-64") == currArg)) {
             pointerSizeInBits = "64";
         } else if ((ConstStringRef("-file") == currArg) && hasMoreArgs) {
-            inputFileName = args[argIndex + 1];
+            inputFileName = argsCopy[argIndex + 1];
             ++argIndex;
         } else if ((ConstStringRef("-output") == currArg) && hasMoreArgs) {
-            outputFileName = args[argIndex + 1];
+            outputFileName = argsCopy[argIndex + 1];
             ++argIndex;
         } else if ((ConstStringRef("-out_dir") == currArg) && hasMoreArgs) {
-            outputDirectory = args[argIndex + 1];
+            outputDirectory = argsCopy[argIndex + 1];
             ++argIndex;
         } else if (ConstStringRef("-exclude_ir") == currArg) {
             excludeIr = true;
@@ -303,24 +343,55 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
 
     Ar::ArEncoder fatbinary(true);
     std::vector<ConstStringRef> targetProducts;
-    targetProducts = getTargetProductsForFatbinary(ConstStringRef(args[deviceArgIndex]), argHelper);
+    targetProducts = getTargetProductsForFatbinary(ConstStringRef(argsCopy[deviceArgIndex]), argHelper);
     if (targetProducts.empty()) {
-        argHelper->printf("Failed to parse target devices from : %s\n", args[deviceArgIndex].c_str());
+        argHelper->printf("Failed to parse target devices from : %s\n", argsCopy[deviceArgIndex].c_str());
         return 1;
     }
-    for (const auto &product : targetProducts) {
-        int retVal = 0;
-        argsCopy[deviceArgIndex] = product.str();
 
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
-        if (OclocErrorCode::SUCCESS != retVal) {
-            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
-            return retVal;
+    if (numThreads > 1u && targetProducts.size() > 1u) {
+        // compilers are created sequentially since they share argHelper inputs,
+        // only builds run concurrently and results are packed in target order
+        std::vector<std::vector<std::string>> targetArgs;
+        std::vector<std::unique_ptr<OfflineCompiler>> targetCompilers;
+        std::vector<OfflineCompiler *> compilers;
+        for (const auto &product : targetProducts) {
+            int retVal = 0;
+            targetArgs.push_back(argsCopy);
+            targetArgs.back()[deviceArgIndex] = product.str();
+
+            targetCompilers.emplace_back(OfflineCompiler::create(targetArgs.back().size(), targetArgs.back(), false, retVal, argHelper));
+            if (OclocErrorCode::SUCCESS != retVal) {
+                argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+                return retVal;
+            }
+            compilers.push_back(targetCompilers.back().get());
         }
 
-        retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str());
-        if (retVal) {
-            return retVal;
+        std::vector<int> retVals;
+        buildFatBinaryTargetsInParallel(compilers, retVals, numThreads);
+
+        for (size_t target = 0; target < targetProducts.size(); target++) {
+            auto retVal = appendBuiltFatBinaryTarget(retVals[target], targetArgs[target], pointerSizeInBits, fatbinary, compilers[target], argHelper, targetProducts[target].str());
+            if (retVal) {
+                return retVal;
+            }
+        }
+    } else {
+        for (const auto &product : targetProducts) {
+            int retVal = 0;
+            argsCopy[deviceArgIndex] = product.str();
+
+            std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
+            if (OclocErrorCode::SUCCESS != retVal) {
+                argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+                return retVal;
+            }
+
+            retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str());
+            if (retVal) {
+                return retVal;
+            }
         }
     }
 
@@ -39,6 +39,9 @@ void getProductsAcronymsForTarget(std::vector<NEO::ConstStringRef> &out, Target
 std::vector<ConstStringRef> getTargetProductsForFatbinary(ConstStringRef deviceArg, OclocArgHelper *argHelper);
 int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
                             OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &deviceConfig);
+int appendBuiltFatBinaryTarget(int buildRetVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
+                               OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &deviceConfig);
+void buildFatBinaryTargetsInParallel(const std::vector<OfflineCompiler *> &compilers, std::vector<int> &retVals, uint32_t numThreads);
 int appendGenericIr(Ar::ArEncoder &fatbinary, const std::string &inputFile, OclocArgHelper *argHelper);
 std::vector<uint8_t> createEncodedElfWithSpirv(const ArrayRef<const uint8_t> &spirv);
 
@@ -898,6 +898,12 @@ Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename
                                 <device_type> can be: %s
                                 - can be single target device.
 
+  -j <num_threads>              Optional number of threads used to compile
+                                targets of a fatbinary concurrently.
+                                Device binaries are packed in the same order
+                                regardless of the number of threads.
+                                Default is 1.
+
   -output <filename>            Optional output file base name.
                                 Default is input file's base name.
                                 This base name will be used for all output
@@ -7,12 +7,48 @@
 
 #include "shared/source/ail/ail_configuration.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hash.h"
+#include "shared/source/utilities/debug_file_reader.h"
 
+#include "os_inc.h"
+
+#include <sstream>
 #include <string>
 #include <string_view>
 
 namespace NEO {
+void AILConfiguration::applyPerformanceProfile() {
+    auto profilesDirectory = DebugManager.flags.AILPerformanceProfilesDirectory.get();
+    if (profilesDirectory == "unk" || processName.empty()) {
+        return;
+    }
+
+    std::stringstream processNameHash;
+    processNameHash << std::hex << Hash::hash(processName.c_str(), processName.length());
+
+    for (const auto &profileName : {processName, processNameHash.str()}) {
+        auto profilePath = profilesDirectory + PATH_SEPARATOR + profileName + ".config";
+        if (fileExists(profilePath)) {
+            SettingsFileReader profileReader(profilePath.c_str());
+            applyPerformanceProfile(profileReader);
+            return;
+        }
+    }
+}
+
+void AILConfiguration::applyPerformanceProfile(SettingsReader &profileReader) {
+    // settings set explicitly by the user take precedence over the profile
+#define DECLARE_DEBUG_VARIABLE(dataType, variableName, defaultValue, description)                                        \
+    if (DebugManager.flags.variableName.get() == defaultValue) {                                                         \
+        DebugManager.flags.variableName.set(profileReader.getSetting(#variableName, DebugManager.flags.variableName.get())); \
+    }
+#include "debug_variables.inl"
+#undef DECLARE_DEBUG_VARIABLE
+}
+
+
 bool AILConfiguration::isKernelHashCorrect(const std::string &kernelsSources, uint64_t expectedHash) const {
     const auto hash = Hash::hash(kernelsSources.c_str(), kernelsSources.length());
     return hash == expectedHash;
@@ -26,6 +26,7 @@
  */
 
 namespace NEO {
+class SettingsReader;
 
 enum class AILEnumeration : uint32_t {
     DISABLE_BLITTER,
@@ -44,6 +45,11 @@ class AILConfiguration {
 
     virtual void apply(RuntimeCapabilityTable &runtimeCapabilityTable);
 
+    // Performance profile of the application is a file named <process name>.config or <process name hash>.config
+    // in AILPerformanceProfilesDirectory, with tunables in the debug settings file format.
+    void applyPerformanceProfile();
+    void applyPerformanceProfile(SettingsReader &profileReader);
+
     virtual void modifyKernelIfRequired(std::string &kernel) = 0;
 
   protected:
@@ -13,6 +13,7 @@
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/heap_helper.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/string.h"
@@ -28,7 +29,9 @@ CommandContainer::~CommandContainer() {
         return;
     }
 
+    this->maxLocalCmdBufferAllocations = 0u;
     this->handleCmdBufferAllocations(0u);
+    this->releaseLocalCmdBufferAllocations();
 
     for (auto allocationIndirectHeap : allocationIndirectHeaps) {
         if (heapHelper) {
@@ -56,6 +59,10 @@ CommandContainer::CommandContainer() {
     if (DebugManager.flags.RemoveUserFenceInCmdlistResetAndDestroy.get() != -1) {
         isHandleFenceCompletionRequired = !static_cast<bool>(DebugManager.flags.RemoveUserFenceInCmdlistResetAndDestroy.get());
     }
+
+    if (DebugManager.flags.CommandContainerLocalCmdBufferCacheSize.get() != -1) {
+        maxLocalCmdBufferAllocations = static_cast<size_t>(DebugManager.flags.CommandContainerLocalCmdBufferCacheSize.get());
+    }
 }
 
 CommandContainer::CommandContainer(uint32_t maxNumAggregatedIdds) : CommandContainer() {
@@ -85,6 +92,8 @@ CommandContainer::ErrorCode CommandContainer::initialize(Device *device, Allocat
     if (!getFlushTaskUsedForImmediate()) {
         addToResidencyContainer(cmdBufferAllocation);
     }
+    heapStateDeduplication = DebugManager.flags.EnableHeapStateDeduplication.get() == 1;
+
     if (requireHeaps) {
         constexpr size_t heapSize = 65536u;
         heapHelper = std::unique_ptr<HeapHelper>(new HeapHelper(device->getMemoryManager(), device->getDefaultEngine().commandStreamReceiver->getInternalAllocationStorage(), device->getNumGenericSubDevices() > 1u));
@@ -140,8 +149,15 @@ void CommandContainer::reset() {
     setDirtyStateForAllHeaps(true);
     slmSize = std::numeric_limits<uint32_t>::max();
     getResidencyContainer().clear();
+    for (auto deallocation : deallocationContainer) {
+        if (heapHelper && ((deallocation->getAllocationType() == AllocationType::INTERNAL_HEAP) || (deallocation->getAllocationType() == AllocationType::LINEAR_STREAM))) {
+            heapHelper->storeHeapAllocation(deallocation);
+        }
+    }
     getDeallocationContainer().clear();
     sshAllocations.clear();
+    clearDeduplicatedHeapStates();
+    resizeRolledOverHeaps();
 
     this->handleCmdBufferAllocations(1u);
     cmdBufferAllocations.erase(cmdBufferAllocations.begin() + 1, cmdBufferAllocations.end());
@@ -219,6 +235,7 @@ IndirectHeap *CommandContainer::getHeapWithRequiredSizeAndAlignment(HeapType hea
     }
 
     if (indirectHeap->getAvailableSpace() < sizeRequested) {
+        rolledOverHeapsUsage[heapType] += indirectHeap->getUsed();
         size_t newSize = indirectHeap->getUsed() + indirectHeap->getAvailableSpace();
         newSize = alignUp(newSize, MemoryConstants::pageSize);
         auto oldAlloc = getIndirectHeapAllocation(heapType);
@@ -249,6 +266,51 @@ IndirectHeap *CommandContainer::getHeapWithRequiredSizeAndAlignment(HeapType hea
     return indirectHeap;
 }
 
+uint32_t CommandContainer::findDeduplicatedHeapState(HeapType heapType, const void *stateData, size_t stateSize, uint64_t stateLayout) {
+    if (!heapStateDeduplication) {
+        return noDeduplicatedHeapState;
+    }
+    auto currentHeapAllocation = getIndirectHeap(heapType)->getGraphicsAllocation();
+    auto hash = Hash::hash(reinterpret_cast<const char *>(stateData), stateSize);
+    auto range = deduplicatedHeapStates[heapType].equal_range(hash);
+    for (auto it = range.first; it != range.second; it++) {
+        auto &heapState = it->second;
+        // states written to heap allocation that was since replaced are not visible through current heap base
+        if (heapState.heapAllocation == currentHeapAllocation &&
+            heapState.stateLayout == stateLayout &&
+            heapState.stateData.size() == stateSize &&
+            memcmp(heapState.stateData.data(), stateData, stateSize) == 0) {
+            return heapState.offsetInHeap;
+        }
+    }
+    return noDeduplicatedHeapState;
+}
+
+void CommandContainer::addDeduplicatedHeapState(HeapType heapType, const void *stateData, size_t stateSize, uint64_t stateLayout, uint32_t offsetInHeap) {
+    if (!heapStateDeduplication) {
+        return;
+    }
+    auto &heapStates = deduplicatedHeapStates[heapType];
+    auto currentHeapAllocation = getIndirectHeap(heapType)->getGraphicsAllocation();
+    if (heapStates.size() >= maxDeduplicatedHeapStates ||
+        (!heapStates.empty() && heapStates.begin()->second.heapAllocation != currentHeapAllocation)) {
+        heapStates.clear();
+    }
+
+    DeduplicatedHeapState heapState;
+    heapState.heapAllocation = currentHeapAllocation;
+    heapState.stateLayout = stateLayout;
+    heapState.offsetInHeap = offsetInHeap;
+    heapState.stateData.assign(reinterpret_cast<const uint8_t *>(stateData), reinterpret_cast<const uint8_t *>(stateData) + stateSize);
+    heapStates.insert({Hash::hash(reinterpret_cast<const char *>(stateData), stateSize), std::move(heapState)});
+}
+
+void CommandContainer::clearDeduplicatedHeapStates() {
+    for (auto &heapStates : deduplicatedHeapStates) {
+        heapStates.clear();
+    }
+}
+
 void CommandContainer::handleCmdBufferAllocations(size_t startIndex) {
     for (size_t i = startIndex; i < cmdBufferAllocations.size(); i++) {
         if (this->reusableAllocationList) {
@@ -256,6 +318,10 @@ void CommandContainer::handleCmdBufferAllocations(size_t startIndex) {
             if (isHandleFenceCompletionRequired) {
                 this->device->getMemoryManager()->handleFenceCompletion(cmdBufferAllocations[i]);
             }
+            if (localCmdBufferAllocations.size() < maxLocalCmdBufferAllocations) {
+                localCmdBufferAllocations.push_back(cmdBufferAllocations[i]);
+                continue;
+            }
             reusableAllocationList->pushFrontOne(*cmdBufferAllocations[i]);
 
         } else {
@@ -264,9 +330,22 @@ void CommandContainer::handleCmdBufferAllocations(size_t startIndex) {
     }
 }
 
+void CommandContainer::releaseLocalCmdBufferAllocations() {
+    for (auto cmdBufferAllocation : localCmdBufferAllocations) {
+        reusableAllocationList->pushFrontOne(*cmdBufferAllocation);
+    }
+    localCmdBufferAllocations.clear();
+}
+
 GraphicsAllocation *CommandContainer::obtainNextCommandBufferAllocation() {
     size_t alignedSize = alignUp<size_t>(this->getTotalCmdBufferSize(), MemoryConstants::pageSize64k);
 
+    if (!localCmdBufferAllocations.empty()) {
+        auto cmdBufferAllocation = localCmdBufferAllocations.back();
+        localCmdBufferAllocations.pop_back();
+        return cmdBufferAllocation;
+    }
+
     GraphicsAllocation *cmdBufferAllocation = nullptr;
     if (this->reusableAllocationList) {
         cmdBufferAllocation = this->reusableAllocationList->detachAllocation(alignedSize, nullptr, nullptr, AllocationType::COMMAND_BUFFER).release();
@@ -310,6 +389,30 @@ void CommandContainer::closeAndAllocateNextCommandBuffer() {
     currentLinearStreamStartOffset = 0u;
 }
 
+// Heaps which rolled over during recording are reallocated with size of the whole recording, so recording
+// the same commands again does not reprogram heap base addresses in the middle of the command list.
+// Surface state heap keeps its size, binding tables have to fit in 64KB window from surface state base address.
+void CommandContainer::resizeRolledOverHeaps() {
+    for (uint32_t heapType = 0; heapType < HeapType::NUM_TYPES; heapType++) {
+        auto rolledOverUsage = rolledOverHeapsUsage[heapType];
+        rolledOverHeapsUsage[heapType] = 0u;
+        if (rolledOverUsage == 0u || heapType == HeapType::SURFACE_STATE || DebugManager.flags.ResizeRolledOverCommandListHeaps.get() != 1) {
+            continue;
+        }
+        auto indirectHeap = indirectHeaps[heapType].get();
+        auto oldAlloc = allocationIndirectHeaps[heapType];
+        auto newSize = alignUp(rolledOverUsage + indirectHeap->getUsed(), MemoryConstants::pageSize64k);
+        auto newAlloc = heapHelper->getHeapAllocation(heapType, newSize, MemoryConstants::pageSize64k, device->getRootDeviceIndex());
+        if (!newAlloc) {
+            continue;
+        }
+        heapHelper->storeHeapAllocation(oldAlloc);
+        indirectHeap->replaceGraphicsAllocation(newAlloc);
+        indirectHeap->replaceBuffer(newAlloc->getUnderlyingBuffer(), newAlloc->getUnderlyingBufferSize());
+        allocationIndirectHeaps[heapType] = newAlloc;
+    }
+}
+
 void CommandContainer::prepareBindfulSsh() {
     if (ApiSpecificConfig::getBindlessConfiguration()) {
         if (allocationIndirectHeaps[IndirectHeap::Type::SURFACE_STATE] == nullptr) {
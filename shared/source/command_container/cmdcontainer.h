@@ -14,6 +14,7 @@
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace NEO {
@@ -40,12 +41,15 @@ class CommandContainer : public NonCopyableOrMovableClass {
                                                     CSRequirements::csOverfetchSize;
     static constexpr size_t totalCmdBufferSize = defaultListCmdBufferSize + cmdBufferReservedSize;
     static constexpr size_t startingResidencyContainerSize = 128;
+    static constexpr size_t maxDeduplicatedHeapStates = 4096;
+    static constexpr uint32_t noDeduplicatedHeapState = std::numeric_limits<uint32_t>::max();
 
     CommandContainer();
 
     CommandContainer(uint32_t maxNumAggregatedIdds);
 
     CmdBufferContainer &getCmdBufferAllocations() { return cmdBufferAllocations; }
+    const CmdBufferContainer &getLocalCmdBufferAllocations() const { return localCmdBufferAllocations; }
 
     ResidencyContainer &getResidencyContainer() { return residencyContainer; }
 
@@ -98,6 +102,11 @@ class CommandContainer : public NonCopyableOrMovableClass {
         reservedSshSize = reserveSize;
     }
 
+    uint32_t findDeduplicatedHeapState(HeapType heapType, const void *stateData, size_t stateSize, uint64_t stateLayout);
+    void addDeduplicatedHeapState(HeapType heapType, const void *stateData, size_t stateSize, uint64_t stateLayout, uint32_t offsetInHeap);
+    bool isHeapStateDeduplicationEnabled() const { return heapStateDeduplication; }
+    void setHeapStateDeduplicationEnabled(bool enabled) { heapStateDeduplication = enabled; }
+
     bool getFlushTaskUsedForImmediate() const { return isFlushTaskUsedForImmediate; }
     void setFlushTaskUsedForImmediate(bool flushTaskUsedForImmediate) { isFlushTaskUsedForImmediate = flushTaskUsedForImmediate; }
 
@@ -110,15 +119,29 @@ class CommandContainer : public NonCopyableOrMovableClass {
     bool systolicModeSupport = false;
 
   protected:
+    struct DeduplicatedHeapState {
+        GraphicsAllocation *heapAllocation = nullptr;
+        uint64_t stateLayout = 0u;
+        uint32_t offsetInHeap = 0u;
+        std::vector<uint8_t> stateData;
+    };
+
     size_t getTotalCmdBufferSize();
+    void clearDeduplicatedHeapStates();
+    void releaseLocalCmdBufferAllocations();
+    void resizeRolledOverHeaps();
 
     GraphicsAllocation *allocationIndirectHeaps[HeapType::NUM_TYPES] = {};
     std::unique_ptr<IndirectHeap> indirectHeaps[HeapType::NUM_TYPES];
+    size_t rolledOverHeapsUsage[HeapType::NUM_TYPES] = {};
 
     CmdBufferContainer cmdBufferAllocations;
+    CmdBufferContainer localCmdBufferAllocations; // released on reset and reused before going to reusableAllocationList
     ResidencyContainer residencyContainer;
     std::vector<GraphicsAllocation *> deallocationContainer;
 
+    std::unordered_multimap<uint64_t, DeduplicatedHeapState> deduplicatedHeapStates[HeapType::NUM_TYPES];
+
     std::unique_ptr<HeapHelper> heapHelper;
     std::unique_ptr<LinearStream> commandStream;
 
@@ -129,12 +152,14 @@ class CommandContainer : public NonCopyableOrMovableClass {
     Device *device = nullptr;
     AllocationsList *reusableAllocationList = nullptr;
     size_t reservedSshSize = 0;
+    size_t maxLocalCmdBufferAllocations = 0u;
 
     uint32_t dirtyHeaps = std::numeric_limits<uint32_t>::max();
     uint32_t numIddsPerBlock = 64;
 
     bool isFlushTaskUsedForImmediate = false;
     bool isHandleFenceCompletionRequired = true;
+    bool heapStateDeduplication = false;
 };
 
 } // namespace NEO
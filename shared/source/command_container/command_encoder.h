@@ -51,6 +51,8 @@ struct EncodeDispatchKernelArgs {
     bool isKernelUsingSystemAllocation = false;
     bool isKernelDispatchedFromImmediateCmdList = false;
     bool isRcs = false;
+    void *outWalkerPtr = nullptr;
+    void *outIndirectDataPtr = nullptr;
 };
 
 struct EncodeWalkerArgs {
@@ -85,6 +87,11 @@ struct EncodeDispatchKernel {
 
     static bool inlineDataProgrammingRequired(const KernelDescriptor &kernelDesc);
 
+    static void patchCrossThreadData(void *walker, void *indirectData, const KernelDescriptor &kernelDescriptor,
+                                     const void *crossThreadData, uint32_t crossThreadDataSize);
+
+    static void patchThreadGroupCount(void *walker, const uint32_t *threadGroupCount, const HardwareInfo &hwInfo, const uint32_t numGrf);
+
     static void encodeThreadData(WALKER_TYPE &walkerCmd,
                                  const uint32_t *startWorkGroup,
                                  const uint32_t *numWorkGroups,
@@ -131,6 +138,19 @@ struct EncodeStates {
                                      const void *fnDynamicStateHeap,
                                      BindlessHeapsHelper *bindlessHeapHelper,
                                      const HardwareInfo &hwInfo);
+    static uint32_t copyDeduplicatedSamplerState(CommandContainer &container,
+                                                 IndirectHeap *dsh,
+                                                 uint32_t samplerStateOffset,
+                                                 uint32_t samplerCount,
+                                                 uint32_t borderColorOffset,
+                                                 const void *fnDynamicStateHeap,
+                                                 BindlessHeapsHelper *bindlessHeapHelper,
+                                                 const HardwareInfo &hwInfo);
+    static void programSamplerStates(SAMPLER_STATE *dstSamplerState,
+                                     const SAMPLER_STATE *srcSamplerState,
+                                     uint32_t samplerCount,
+                                     uint32_t borderColorOffsetInDsh,
+                                     const HardwareInfo &hwInfo);
 };
 
 template <typename GfxFamily>
@@ -308,6 +328,9 @@ struct EncodeSurfaceState {
     static size_t pushBindingTableAndSurfaceStates(IndirectHeap &dstHeap, size_t bindingTableCount,
                                                    const void *srcKernelSsh, size_t srcKernelSshSize,
                                                    size_t numberOfBindingTableStates, size_t offsetOfBindingTable);
+    static uint32_t pushDeduplicatedBindingTableAndSurfaceStates(CommandContainer &container, size_t bindingTableCount,
+                                                                 const void *srcKernelSsh, size_t srcKernelSshSize,
+                                                                 size_t offsetOfBindingTable);
 
     static void appendImageCompressionParams(R_SURFACE_STATE *surfaceState, GraphicsAllocation *allocation, GmmHelper *gmmHelper,
                                              bool imageFromBuffer, GMM_YUV_PLANE_ENUM plane);
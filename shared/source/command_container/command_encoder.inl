@@ -80,18 +80,72 @@ uint32_t EncodeStates<Family>::copySamplerState(IndirectHeap *dsh,
     }
 
     auto srcSamplerState = reinterpret_cast<const SAMPLER_STATE *>(ptrOffset(fnDynamicStateHeap, samplerStateOffset));
+    programSamplerStates(dstSamplerState, srcSamplerState, samplerCount, borderColorOffsetInDsh, hwInfo);
+
+    return samplerStateOffsetInDsh;
+}
+
+template <typename Family>
+void EncodeStates<Family>::programSamplerStates(SAMPLER_STATE *dstSamplerState,
+                                                const SAMPLER_STATE *srcSamplerState,
+                                                uint32_t samplerCount,
+                                                uint32_t borderColorOffsetInDsh,
+                                                const HardwareInfo &hwInfo) {
     SAMPLER_STATE state = {};
     for (uint32_t i = 0; i < samplerCount; i++) {
         state = srcSamplerState[i];
-        state.setIndirectStatePointer(static_cast<uint32_t>(borderColorOffsetInDsh));
+        state.setIndirectStatePointer(borderColorOffsetInDsh);
 
         HwInfoConfig::get(hwInfo.platform.eProductFamily)->adjustSamplerState(&state, hwInfo);
 
         dstSamplerState[i] = state;
     }
+}
+
+template <typename Family>
+uint32_t EncodeStates<Family>::copyDeduplicatedSamplerState(CommandContainer &container,
+                                                            IndirectHeap *dsh,
+                                                            uint32_t samplerStateOffset,
+                                                            uint32_t samplerCount,
+                                                            uint32_t borderColorOffset,
+                                                            const void *fnDynamicStateHeap,
+                                                            BindlessHeapsHelper *bindlessHeapHelper,
+                                                            const HardwareInfo &hwInfo) {
+    if (ApiSpecificConfig::getBindlessConfiguration() || !container.isHeapStateDeduplicationEnabled()) {
+        return copySamplerState(dsh, samplerStateOffset, samplerCount, borderColorOffset, fnDynamicStateHeap, bindlessHeapHelper, hwInfo);
+    }
+
+    // border color and sampler states are copied as one block, so identical blocks share both
+    auto stateData = ptrOffset(fnDynamicStateHeap, borderColorOffset);
+    auto borderColorSize = samplerStateOffset - borderColorOffset;
+    auto stateSize = borderColorSize + sizeof(SAMPLER_STATE) * samplerCount;
+    uint64_t stateLayout = (static_cast<uint64_t>(borderColorSize) << 32) | samplerCount;
+
+    auto samplerStateOffsetInDsh = container.findDeduplicatedHeapState(HeapType::DYNAMIC_STATE, stateData, stateSize, stateLayout);
+    if (samplerStateOffsetInDsh != CommandContainer::noDeduplicatedHeapState) {
+        return samplerStateOffsetInDsh;
+    }
 
+    // sampler sets differing only in sampler states point to border color written by previous dispatch
+    uint64_t borderColorLayout = static_cast<uint64_t>(borderColorSize) << 32;
+    auto borderColorOffsetInDsh = container.findDeduplicatedHeapState(HeapType::DYNAMIC_STATE, stateData, borderColorSize, borderColorLayout);
+    if (borderColorOffsetInDsh == CommandContainer::noDeduplicatedHeapState) {
+        dsh->align(EncodeStates<Family>::alignIndirectStatePointer);
+        borderColorOffsetInDsh = static_cast<uint32_t>(dsh->getUsed());
+        auto borderColor = dsh->getSpace(borderColorSize);
+        memcpy_s(borderColor, borderColorSize, stateData, borderColorSize);
+        container.addDeduplicatedHeapState(HeapType::DYNAMIC_STATE, stateData, borderColorSize, borderColorLayout, borderColorOffsetInDsh);
+    }
+
+    dsh->align(INTERFACE_DESCRIPTOR_DATA::SAMPLERSTATEPOINTER_ALIGN_SIZE);
+    samplerStateOffsetInDsh = static_cast<uint32_t>(dsh->getUsed());
+    auto dstSamplerState = reinterpret_cast<SAMPLER_STATE *>(dsh->getSpace(sizeof(SAMPLER_STATE) * samplerCount));
+    auto srcSamplerState = reinterpret_cast<const SAMPLER_STATE *>(ptrOffset(fnDynamicStateHeap, samplerStateOffset));
+    programSamplerStates(dstSamplerState, srcSamplerState, samplerCount, borderColorOffsetInDsh, hwInfo);
+
+    container.addDeduplicatedHeapState(HeapType::DYNAMIC_STATE, stateData, stateSize, stateLayout, samplerStateOffsetInDsh);
     return samplerStateOffsetInDsh;
-} // namespace NEO
+}
 
 template <typename Family>
 void EncodeMathMMIO<Family>::encodeMulRegVal(CommandContainer &container, uint32_t offset, uint32_t val, uint64_t dstAddress) {
@@ -481,6 +535,27 @@ size_t EncodeSurfaceState<Family>::pushBindingTableAndSurfaceStates(IndirectHeap
     return ptrDiff(dstBtiTableBase, dstHeap.getCpuBase());
 }
 
+template <typename Family>
+uint32_t EncodeSurfaceState<Family>::pushDeduplicatedBindingTableAndSurfaceStates(CommandContainer &container, size_t bindingTableCount,
+                                                                                 const void *srcKernelSsh, size_t srcKernelSshSize,
+                                                                                 size_t offsetOfBindingTable) {
+    using BINDING_TABLE_STATE = typename Family::BINDING_TABLE_STATE;
+
+    // binding table pointer is fully determined by kernel ssh content and its layout, identical blocks previously pushed to current heap are reused
+    uint64_t stateLayout = (static_cast<uint64_t>(offsetOfBindingTable) << 32) | static_cast<uint32_t>(bindingTableCount);
+    auto bindingTablePointer = container.findDeduplicatedHeapState(HeapType::SURFACE_STATE, srcKernelSsh, srcKernelSshSize, stateLayout);
+    if (bindingTablePointer != CommandContainer::noDeduplicatedHeapState) {
+        return bindingTablePointer;
+    }
+
+    auto ssh = container.getHeapWithRequiredSizeAndAlignment(HeapType::SURFACE_STATE, srcKernelSshSize, BINDING_TABLE_STATE::SURFACESTATEPOINTER_ALIGN_SIZE);
+    bindingTablePointer = static_cast<uint32_t>(pushBindingTableAndSurfaceStates(*ssh, bindingTableCount,
+                                                                                 srcKernelSsh, srcKernelSshSize,
+                                                                                 bindingTableCount, offsetOfBindingTable));
+    container.addDeduplicatedHeapState(HeapType::SURFACE_STATE, srcKernelSsh, srcKernelSshSize, stateLayout, bindingTablePointer);
+    return bindingTablePointer;
+}
+
 template <typename Family>
 inline void EncodeSurfaceState<Family>::encodeExtraCacheSettings(R_SURFACE_STATE *surfaceState, const EncodeSurfaceStateArgs &args) {}
 
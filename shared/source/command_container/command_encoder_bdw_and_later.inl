@@ -72,7 +72,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     {
         auto alloc = args.dispatchInterface->getIsaAllocation();
         UNRECOVERABLE_IF(nullptr == alloc);
-        auto offset = alloc->getGpuAddressToPatch();
+        auto offset = alloc->getGpuAddressToPatch() + args.dispatchInterface->getIsaOffsetInParentAllocation();
         idd.setKernelStartPointer(offset);
         idd.setKernelStartPointerHigh(0u);
     }
@@ -93,12 +93,11 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     if (!isBindlessKernel) {
         container.prepareBindfulSsh();
         if (bindingTableStateCount > 0u) {
-            auto ssh = container.getHeapWithRequiredSizeAndAlignment(HeapType::SURFACE_STATE, args.dispatchInterface->getSurfaceStateHeapDataSize(), BINDING_TABLE_STATE::SURFACESTATEPOINTER_ALIGN_SIZE);
-            bindingTablePointer = static_cast<uint32_t>(EncodeSurfaceState<Family>::pushBindingTableAndSurfaceStates(
-                *ssh, bindingTableStateCount,
+            bindingTablePointer = EncodeSurfaceState<Family>::pushDeduplicatedBindingTableAndSurfaceStates(
+                container, bindingTableStateCount,
                 args.dispatchInterface->getSurfaceStateHeapData(),
-                args.dispatchInterface->getSurfaceStateHeapDataSize(), bindingTableStateCount,
-                kernelDescriptor.payloadMappings.bindingTable.tableOffset));
+                args.dispatchInterface->getSurfaceStateHeapDataSize(),
+                kernelDescriptor.payloadMappings.bindingTable.tableOffset);
         }
     }
     idd.setBindingTablePointer(bindingTablePointer);
@@ -113,11 +112,11 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
 
     if (kernelDescriptor.payloadMappings.samplerTable.numSamplers > 0) {
         samplerCount = kernelDescriptor.payloadMappings.samplerTable.numSamplers;
-        samplerStateOffset = EncodeStates<Family>::copySamplerState(heap, kernelDescriptor.payloadMappings.samplerTable.tableOffset,
-                                                                    kernelDescriptor.payloadMappings.samplerTable.numSamplers,
-                                                                    kernelDescriptor.payloadMappings.samplerTable.borderColor,
-                                                                    args.dispatchInterface->getDynamicStateHeapData(),
-                                                                    args.device->getBindlessHeapsHelper(), hwInfo);
+        samplerStateOffset = EncodeStates<Family>::copyDeduplicatedSamplerState(container, heap, kernelDescriptor.payloadMappings.samplerTable.tableOffset,
+                                                                                kernelDescriptor.payloadMappings.samplerTable.numSamplers,
+                                                                                kernelDescriptor.payloadMappings.samplerTable.borderColor,
+                                                                                args.dispatchInterface->getDynamicStateHeapData(),
+                                                                                args.device->getBindlessHeapsHelper(), hwInfo);
     }
 
     idd.setSamplerStatePointer(samplerStateOffset);
@@ -150,6 +149,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
             ptr = NEO::ImplicitArgsHelper::patchImplicitArgs(ptr, *pImplicitArgs, kernelDescriptor, hwInfo, {});
         }
 
+        args.outIndirectDataPtr = ptr;
         memcpy_s(ptr, sizeCrossThreadData,
                  args.dispatchInterface->getCrossThreadData(), sizeCrossThreadData);
 
@@ -247,6 +247,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
 
     auto buffer = listCmdBufferStream->getSpace(sizeof(cmd));
     *(decltype(cmd) *)buffer = cmd;
+    args.outWalkerPtr = buffer;
 
     PreemptionHelper::applyPreemptionWaCmdsEnd<Family>(listCmdBufferStream, *args.device);
     {
@@ -363,6 +364,20 @@ inline void EncodeDispatchKernel<Family>::encodeAdditionalWalkerFields(const Har
 template <typename Family>
 void EncodeDispatchKernel<Family>::appendAdditionalIDDFields(INTERFACE_DESCRIPTOR_DATA *pInterfaceDescriptor, const HardwareInfo &hwInfo, const uint32_t threadsPerThreadGroup, uint32_t slmTotalSize, SlmPolicy slmPolicy) {}
 
+template <typename Family>
+void EncodeDispatchKernel<Family>::patchCrossThreadData(void *walker, void *indirectData, const KernelDescriptor &kernelDescriptor,
+                                                        const void *crossThreadData, uint32_t crossThreadDataSize) {
+    memcpy_s(indirectData, crossThreadDataSize, crossThreadData, crossThreadDataSize);
+}
+
+template <typename Family>
+void EncodeDispatchKernel<Family>::patchThreadGroupCount(void *walker, const uint32_t *threadGroupCount, const HardwareInfo &hwInfo, const uint32_t numGrf) {
+    auto &walkerCmd = *reinterpret_cast<WALKER_TYPE *>(walker);
+    walkerCmd.setThreadGroupIdXDimension(threadGroupCount[0]);
+    walkerCmd.setThreadGroupIdYDimension(threadGroupCount[1]);
+    walkerCmd.setThreadGroupIdZDimension(threadGroupCount[2]);
+}
+
 template <typename Family>
 inline void EncodeComputeMode<Family>::adjustPipelineSelect(CommandContainer &container, const NEO::KernelDescriptor &kernelDescriptor) {
 }
@@ -87,7 +87,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     {
         auto alloc = args.dispatchInterface->getIsaAllocation();
         UNRECOVERABLE_IF(nullptr == alloc);
-        auto offset = alloc->getGpuAddressToPatch();
+        auto offset = alloc->getGpuAddressToPatch() + args.dispatchInterface->getIsaOffsetInParentAllocation();
         if (!localIdsGenerationByRuntime) {
             offset += kernelDescriptor.entryPoints.skipPerThreadDataLoad;
         }
@@ -115,12 +115,11 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         kernelDescriptor.kernelAttributes.flags.usesImages) {
         container.prepareBindfulSsh();
         if (bindingTableStateCount > 0u) {
-            auto ssh = container.getHeapWithRequiredSizeAndAlignment(HeapType::SURFACE_STATE, args.dispatchInterface->getSurfaceStateHeapDataSize(), BINDING_TABLE_STATE::SURFACESTATEPOINTER_ALIGN_SIZE);
-            bindingTablePointer = static_cast<uint32_t>(EncodeSurfaceState<Family>::pushBindingTableAndSurfaceStates(
-                *ssh, bindingTableStateCount,
+            bindingTablePointer = EncodeSurfaceState<Family>::pushDeduplicatedBindingTableAndSurfaceStates(
+                container, bindingTableStateCount,
                 args.dispatchInterface->getSurfaceStateHeapData(),
-                args.dispatchInterface->getSurfaceStateHeapDataSize(), bindingTableStateCount,
-                kernelDescriptor.payloadMappings.bindingTable.tableOffset));
+                args.dispatchInterface->getSurfaceStateHeapDataSize(),
+                kernelDescriptor.payloadMappings.bindingTable.tableOffset);
         }
     }
     idd.setBindingTablePointer(bindingTablePointer);
@@ -136,8 +135,8 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
 
         if (kernelDescriptor.payloadMappings.samplerTable.numSamplers > 0) {
             samplerCount = kernelDescriptor.payloadMappings.samplerTable.numSamplers;
-            samplerStateOffset = EncodeStates<Family>::copySamplerState(
-                heap, kernelDescriptor.payloadMappings.samplerTable.tableOffset,
+            samplerStateOffset = EncodeStates<Family>::copyDeduplicatedSamplerState(
+                container, heap, kernelDescriptor.payloadMappings.samplerTable.tableOffset,
                 kernelDescriptor.payloadMappings.samplerTable.numSamplers, kernelDescriptor.payloadMappings.samplerTable.borderColor,
                 args.dispatchInterface->getDynamicStateHeapData(),
                 args.device->getBindlessHeapsHelper(), hwInfo);
@@ -185,6 +184,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
             ptr = NEO::ImplicitArgsHelper::patchImplicitArgs(ptr, *pImplicitArgs, kernelDescriptor, hwInfo, std::make_pair(localIdsGenerationByRuntime, requiredWorkgroupOrder));
         }
 
+        args.outIndirectDataPtr = ptr;
         if (sizeCrossThreadData > 0) {
             memcpy_s(ptr, sizeCrossThreadData,
                      crossThreadData, sizeCrossThreadData);
@@ -309,6 +309,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
         args.partitionCount = 1;
         auto buffer = listCmdBufferStream->getSpace(sizeof(walkerCmd));
         *(decltype(walkerCmd) *)buffer = walkerCmd;
+        args.outWalkerPtr = buffer;
     }
 
     PreemptionHelper::applyPreemptionWaCmdsEnd<Family>(listCmdBufferStream, *args.device);
@@ -323,6 +324,34 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     }
 }
 
+template <typename Family>
+void EncodeDispatchKernel<Family>::patchCrossThreadData(void *walker, void *indirectData, const KernelDescriptor &kernelDescriptor,
+                                                        const void *crossThreadData, uint32_t crossThreadDataSize) {
+    using INLINE_DATA = typename Family::INLINE_DATA;
+
+    uint32_t inlineDataProgrammingOffset = 0u;
+    if (EncodeDispatchKernel<Family>::inlineDataProgrammingRequired(kernelDescriptor)) {
+        auto &walkerCmd = *reinterpret_cast<WALKER_TYPE *>(walker);
+        inlineDataProgrammingOffset = std::min(static_cast<uint32_t>(sizeof(INLINE_DATA)), crossThreadDataSize);
+        memcpy_s(walkerCmd.getInlineDataPointer(), inlineDataProgrammingOffset, crossThreadData, inlineDataProgrammingOffset);
+    }
+    if (crossThreadDataSize > inlineDataProgrammingOffset) {
+        memcpy_s(indirectData, crossThreadDataSize - inlineDataProgrammingOffset,
+                 ptrOffset(crossThreadData, inlineDataProgrammingOffset), crossThreadDataSize - inlineDataProgrammingOffset);
+    }
+}
+
+template <typename Family>
+void EncodeDispatchKernel<Family>::patchThreadGroupCount(void *walker, const uint32_t *threadGroupCount, const HardwareInfo &hwInfo, const uint32_t numGrf) {
+    auto &walkerCmd = *reinterpret_cast<WALKER_TYPE *>(walker);
+    walkerCmd.setThreadGroupIdXDimension(threadGroupCount[0]);
+    walkerCmd.setThreadGroupIdYDimension(threadGroupCount[1]);
+    walkerCmd.setThreadGroupIdZDimension(threadGroupCount[2]);
+
+    auto totalThreadGroupCount = threadGroupCount[0] * threadGroupCount[1] * threadGroupCount[2];
+    EncodeDispatchKernel<Family>::adjustInterfaceDescriptorData(walkerCmd.getInterfaceDescriptor(), hwInfo, totalThreadGroupCount, numGrf);
+}
+
 template <typename Family>
 inline void EncodeDispatchKernel<Family>::setupPostSyncMocs(WALKER_TYPE &walkerCmd, const RootDeviceEnvironment &rootDeviceEnvironment) {
     auto &postSyncData = walkerCmd.getPostSync();
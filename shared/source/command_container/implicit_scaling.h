@@ -10,6 +10,8 @@
 #include "shared/source/helpers/common_types.h"
 #include "shared/source/helpers/vec.h"
 
+#include <optional>
+
 namespace WalkerPartition {
 struct WalkerPartitionArgs;
 }
@@ -52,7 +54,8 @@ struct ImplicitScalingDispatch {
                                  bool apiSelfCleanup,
                                  bool usesImages,
                                  uint64_t workPartitionAllocationGpuVa,
-                                 const HardwareInfo &hwInfo);
+                                 const HardwareInfo &hwInfo,
+                                 std::optional<typename WALKER_TYPE::PARTITION_TYPE> requestedPartitionType = std::nullopt);
 
     static bool &getPipeControlStallRequired();
 
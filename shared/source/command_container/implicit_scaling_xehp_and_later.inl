@@ -84,13 +84,14 @@ void ImplicitScalingDispatch<GfxFamily>::dispatchCommands(LinearStream &commandS
                                                           bool apiSelfCleanup,
                                                           bool usesImages,
                                                           uint64_t workPartitionAllocationGpuVa,
-                                                          const HardwareInfo &hwInfo) {
+                                                          const HardwareInfo &hwInfo,
+                                                          std::optional<typename WALKER_TYPE::PARTITION_TYPE> requestedPartitionType) {
     uint32_t totalProgrammedSize = 0u;
     const uint32_t tileCount = static_cast<uint32_t>(devices.count());
     const bool preferStaticPartitioning = workPartitionAllocationGpuVa != 0u;
 
     bool staticPartitioning = false;
-    partitionCount = WalkerPartition::computePartitionCountAndSetPartitionType<GfxFamily>(&walkerCmd, tileCount, preferStaticPartitioning, usesImages, &staticPartitioning);
+    partitionCount = WalkerPartition::computePartitionCountAndSetPartitionType<GfxFamily>(&walkerCmd, tileCount, preferStaticPartitioning, usesImages, &staticPartitioning, requestedPartitionType);
 
     WalkerPartition::WalkerPartitionArgs args = prepareWalkerPartitionArgs<GfxFamily>(workPartitionAllocationGpuVa,
                                                                                       tileCount,
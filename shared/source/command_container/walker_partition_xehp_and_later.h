@@ -186,10 +186,10 @@ uint32_t computePartitionCountAndSetPartitionType(COMPUTE_WALKER<GfxFamily> *wal
                                                   uint32_t preferredMinimalPartitionCount,
                                                   bool preferStaticPartitioning,
                                                   bool usesImages,
-                                                  bool *outSelectStaticPartitioning) {
+                                                  bool *outSelectStaticPartitioning,
+                                                  std::optional<typename COMPUTE_WALKER<GfxFamily>::PARTITION_TYPE> requestedPartitionType = std::nullopt) {
     const Vec3<size_t> groupStart = {walker->getThreadGroupIdStartingX(), walker->getThreadGroupIdStartingY(), walker->getThreadGroupIdStartingZ()};
     const Vec3<size_t> groupCount = {walker->getThreadGroupIdXDimension(), walker->getThreadGroupIdYDimension(), walker->getThreadGroupIdZDimension()};
-    std::optional<typename COMPUTE_WALKER<GfxFamily>::PARTITION_TYPE> requestedPartitionType{};
     if (usesImages) {
         requestedPartitionType = COMPUTE_WALKER<GfxFamily>::PARTITION_TYPE::PARTITION_TYPE_X;
     }
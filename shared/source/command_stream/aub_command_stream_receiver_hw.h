@@ -19,6 +19,8 @@
 
 #include "aub_mapper.h"
 
+#include <unordered_map>
+
 namespace NEO {
 
 class AubSubCaptureManager;
@@ -113,8 +115,15 @@ class AUBCommandStreamReceiverHw : public CommandStreamReceiverSimulatedHw<GfxFa
     }
 
     int getAddressSpaceFromPTEBits(uint64_t entryBits) const;
+    bool isPageWriteRequired(uint64_t physAddress, const void *data, size_t size, uint64_t entryBits);
 
   protected:
+    struct WrittenPage {
+        uint64_t hash = 0u;
+        uint64_t entryBits = 0u;
+        size_t size = 0u;
+    };
+
     constexpr static uint32_t getMaskAndValueForPollForCompletion();
 
     bool dumpAubNonWritable = false;
@@ -123,5 +132,8 @@ class AUBCommandStreamReceiverHw : public CommandStreamReceiverSimulatedHw<GfxFa
 
     uint32_t pollForCompletionTaskCount = 0u;
     SpinLock pollForCompletionLock;
+
+    std::unordered_map<uint64_t, WrittenPage> writtenPages;
+    std::string writtenPagesFileName;
 };
 } // namespace NEO
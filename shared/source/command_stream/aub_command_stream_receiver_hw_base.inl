@@ -641,7 +641,19 @@ void AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(uint64_t gpuAddress, voi
 
     AubHelperHw<GfxFamily> aubHelperHw(this->isLocalMemoryEnabled());
 
+    if (DebugManager.flags.AUBDumpSkipUnchangedPages.get() == 1) {
+        auto fileName = getFileName();
+        if (fileName != writtenPagesFileName) {
+            // new capture file, e.g. next subcapture, has to contain every page
+            writtenPages.clear();
+            writtenPagesFileName = fileName;
+        }
+    }
+
     PageWalker walker = [&](uint64_t physAddress, size_t size, size_t offset, uint64_t entryBits) {
+        if (!isPageWriteRequired(physAddress, cpuAddress ? ptrOffset(cpuAddress, offset) : nullptr, size, entryBits)) {
+            return;
+        }
         AUB::reserveAddressGGTTAndWriteMmeory(*stream, static_cast<uintptr_t>(gpuAddress), cpuAddress, physAddress, size, offset, entryBits,
                                               aubHelperHw);
     };
@@ -649,6 +661,27 @@ void AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(uint64_t gpuAddress, voi
     ppgtt->pageWalk(static_cast<uintptr_t>(gpuAddress), size, 0, entryBits, walker, memoryBank);
 }
 
+// Pages already written to the current file with the same content and PTE bits are skipped
+template <typename GfxFamily>
+bool AUBCommandStreamReceiverHw<GfxFamily>::isPageWriteRequired(uint64_t physAddress, const void *data, size_t size, uint64_t entryBits) {
+    if (DebugManager.flags.AUBDumpSkipUnchangedPages.get() != 1 || data == nullptr) {
+        return true;
+    }
+
+    WrittenPage page;
+    page.hash = Hash::hash(static_cast<const char *>(data), size);
+    page.entryBits = entryBits;
+    page.size = size;
+
+    auto writtenPage = writtenPages.find(physAddress);
+    if (writtenPage != writtenPages.end() && writtenPage->second.hash == page.hash &&
+        writtenPage->second.entryBits == page.entryBits && writtenPage->second.size == page.size) {
+        return false;
+    }
+    writtenPages[physAddress] = page;
+    return true;
+}
+
 template <typename GfxFamily>
 bool AUBCommandStreamReceiverHw<GfxFamily>::writeMemory(GraphicsAllocation &gfxAllocation) {
     UNRECOVERABLE_IF(!isEngineInitialized);
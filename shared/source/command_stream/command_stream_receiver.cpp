@@ -10,8 +10,10 @@
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/command_container/implicit_scaling.h"
 #include "shared/source/command_stream/experimental_command_buffer.h"
+#include "shared/source/command_stream/gpu_hang_dump.h"
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/command_stream/scratch_space_controller.h"
+#include "shared/source/command_stream/submission_timeline.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/direct_submission/direct_submission_controller.h"
@@ -20,6 +22,8 @@
 #include "shared/source/gmm_helper/page_table_mngr.h"
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/array_count.h"
+#include "shared/source/helpers/engine_node_helper.h"
+#include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/logical_state_helper.h"
@@ -35,8 +39,10 @@
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/sys_calls_common.h"
 #include "shared/source/utilities/hw_timestamps.h"
+#include "shared/source/utilities/latency_histograms.h"
 #include "shared/source/utilities/perf_counter.h"
 #include "shared/source/utilities/tag_allocator.h"
+#include "shared/source/utilities/trace_points.h"
 #include "shared/source/utilities/wait_util.h"
 
 namespace NEO {
@@ -126,6 +132,7 @@ void CommandStreamReceiver::makeResident(MultiGraphicsAllocation &gfxAllocation)
 }
 
 void CommandStreamReceiver::makeResident(GraphicsAllocation &gfxAllocation) {
+    TRACE_POINT(MakeResident, gfxAllocation.getGpuAddress(), gfxAllocation.getUnderlyingBufferSize());
     auto submissionTaskCount = this->taskCount + 1;
     if (gfxAllocation.isResidencyTaskCountBelow(submissionTaskCount, osContext->getContextId())) {
         auto pushAllocations = true;
@@ -180,6 +187,7 @@ void CommandStreamReceiver::makeResidentHostPtrAllocation(GraphicsAllocation *gf
 }
 
 WaitStatus CommandStreamReceiver::waitForTaskCount(uint32_t requiredTaskCount) {
+    TRACE_POINT(WaitForTaskCount, requiredTaskCount, osContext ? osContext->getContextId() : 0u);
     auto address = getTagAddress();
     if (!skipResourceCleanup() && address) {
         this->downloadTagAllocation(requiredTaskCount);
@@ -329,6 +337,8 @@ void CommandStreamReceiver::cleanupResources() {
         workPartitionAllocation = nullptr;
     }
 
+    submissionTimeline.reset();
+
     if (kernelArgsBufferAllocation) {
         getMemoryManager()->freeGraphicsMemory(kernelArgsBufferAllocation);
         kernelArgsBufferAllocation = nullptr;
@@ -336,6 +346,7 @@ void CommandStreamReceiver::cleanupResources() {
 }
 
 WaitStatus CommandStreamReceiver::waitForCompletionWithTimeout(const WaitParams &params, uint32_t taskCountToWait) {
+    LATENCY_SCOPE("wait");
     bool printWaitForCompletion = DebugManager.flags.LogWaitingForCompletion.get();
     if (printWaitForCompletion) {
         printTagAddressContent(taskCountToWait, params.waitTimeout, true);
@@ -345,6 +356,9 @@ WaitStatus CommandStreamReceiver::waitForCompletionWithTimeout(const WaitParams
     if (latestSentTaskCount < taskCountToWait) {
         if (!this->flushBatchedSubmissions()) {
             const auto isGpuHang{isGpuHangDetected()};
+            if (isGpuHang) {
+                dumpGpuHangState(taskCountToWait);
+            }
             return isGpuHang ? WaitStatus::GpuHang : WaitStatus::NotReady;
         }
     }
@@ -368,6 +382,111 @@ bool CommandStreamReceiver::checkGpuHangDetected(TimeType currentTime, TimeType
     return false;
 }
 
+// Contexts of a hung engine are banned by the kernel driver, they are recreated together with direct submission rings.
+// Work submitted so far is treated as completed, allocations, heaps and caches stay valid and states are reprogrammed on next submission.
+bool CommandStreamReceiver::recoverFromGpuHang() {
+    auto lock = obtainUniqueOwnership();
+    if (!isGpuHangDetected()) {
+        return false;
+    }
+
+    auto partitionTagAddress = tagAddress;
+    for (uint32_t i = 0; i < activePartitions; i++) {
+        *partitionTagAddress = taskCount;
+        partitionTagAddress = ptrOffset(partitionTagAddress, this->postSyncWriteOffset);
+    }
+    latestSentTaskCount = taskCount.load();
+    latestFlushedTaskCount = taskCount.load();
+
+    bool directSubmissionEnabled = isAnyDirectSubmissionEnabled();
+    releaseDirectSubmission();
+    osContext->reInitializeContext();
+
+    streamProperties = {};
+    lastPreemptionMode = PreemptionMode::Initial;
+    lastSentL3Config = 0;
+    lastSentSliceCount = QueueSliceCount::defaultSliceCount;
+    lastMediaSamplerConfig = -1;
+    isPreambleSent = false;
+    isStateSipSent = false;
+    isEnginePrologueSent = false;
+    isPerDssBackedBufferSent = false;
+    GSBAStateDirty = true;
+    mediaVfeStateDirty = true;
+    pageTableManagerInitialized = false;
+    gpuHangStateDumped = false;
+
+    if (directSubmissionEnabled) {
+        return initDirectSubmission();
+    }
+    return true;
+}
+
+void CommandStreamReceiver::dumpGpuHangState(uint32_t taskCountToWait) {
+    const auto &dumpDirectory = DebugManager.flags.GpuHangDumpDirectory.get();
+    if (dumpDirectory == "unk" || gpuHangStateDumped || osContext == nullptr) {
+        return;
+    }
+    gpuHangStateDumped = true;
+
+    std::vector<uint8_t> dump(sizeof(GpuHangDump::Header));
+    uint32_t sectionCount = 0;
+    auto appendSection = [&](GpuHangDump::SectionType type, uint64_t gpuAddress, const void *data, size_t size) {
+        GpuHangDump::SectionHeader sectionHeader = {type, 0u, gpuAddress, size};
+        auto offset = dump.size();
+        dump.resize(offset + sizeof(sectionHeader) + size);
+        memcpy_s(dump.data() + offset, sizeof(sectionHeader), &sectionHeader, sizeof(sectionHeader));
+        if (size > 0) {
+            memcpy_s(dump.data() + offset + sizeof(sectionHeader), size, data, size);
+        }
+        sectionCount++;
+    };
+
+    if (commandStream.getCpuBase()) {
+        appendSection(GpuHangDump::SectionType::CommandStream, commandStream.getGraphicsAllocation()->getGpuAddress(),
+                      commandStream.getCpuBase(), commandStream.getUsed());
+    }
+
+    if (debugSurface) {
+        auto stateSaveArea = debugSurface->getUnderlyingBuffer();
+        const bool locked = stateSaveArea == nullptr;
+        if (locked) {
+            stateSaveArea = getMemoryManager()->lockResource(debugSurface);
+        }
+        if (stateSaveArea) {
+            appendSection(GpuHangDump::SectionType::StateSaveArea, debugSurface->getGpuAddress(),
+                          stateSaveArea, debugSurface->getUnderlyingBufferSize());
+        }
+        if (locked) {
+            getMemoryManager()->unlockResource(debugSurface);
+        }
+    }
+
+    std::vector<GpuHangDump::ResidencyEntry> residencyEntries;
+    residencyEntries.reserve(getResidencyAllocations().size());
+    for (auto allocation : getResidencyAllocations()) {
+        residencyEntries.push_back({allocation->getGpuAddress(), allocation->getUnderlyingBufferSize(),
+                                    static_cast<uint32_t>(allocation->getAllocationType()), 0u});
+    }
+    appendSection(GpuHangDump::SectionType::ResidencyList, 0u, residencyEntries.data(),
+                  residencyEntries.size() * sizeof(GpuHangDump::ResidencyEntry));
+
+    GpuHangDump::Header header = {};
+    memcpy_s(header.magic, sizeof(header.magic), GpuHangDump::magic, sizeof(GpuHangDump::magic));
+    header.version = GpuHangDump::version;
+    header.sectionCount = sectionCount;
+    header.contextId = osContext->getContextId();
+    header.taskCountToWait = taskCountToWait;
+    header.latestFlushedTaskCount = latestFlushedTaskCount;
+    header.completedTaskCount = tagAddress ? *tagAddress : 0u;
+    memcpy_s(dump.data(), sizeof(header), &header, sizeof(header));
+
+    auto fileName = dumpDirectory + "/gpu_hang_" + std::to_string(SysCalls::getProcessId()) + "_" +
+                    std::to_string(header.contextId) + "_" + std::to_string(taskCountToWait) + ".bin";
+    writeDataToFile(fileName.c_str(), dump.data(), dump.size());
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stderr, "GPU hang state dumped to %s\n", fileName.c_str());
+}
+
 WaitStatus CommandStreamReceiver::baseWaitFunction(volatile uint32_t *pollAddress, const WaitParams &params, uint32_t taskCountToWait) {
     std::chrono::high_resolution_clock::time_point waitStartTime, lastHangCheckTime, currentTime;
     int64_t timeDiff = 0;
@@ -377,6 +496,8 @@ WaitStatus CommandStreamReceiver::baseWaitFunction(volatile uint32_t *pollAddres
         this->flushTagUpdate();
     }
     volatile uint32_t *partitionAddress = pollAddress;
+    const int64_t spinTime = adaptiveWaitPolicy.getSpinTime();
+    int64_t elapsedTime = 0;
 
     waitStartTime = std::chrono::high_resolution_clock::now();
     lastHangCheckTime = waitStartTime;
@@ -384,17 +505,19 @@ WaitStatus CommandStreamReceiver::baseWaitFunction(volatile uint32_t *pollAddres
         while (*partitionAddress < taskCountToWait && timeDiff <= params.waitTimeout) {
             this->downloadTagAllocation(taskCountToWait);
 
-            if (!params.indefinitelyPoll && WaitUtils::waitFunction(partitionAddress, taskCountToWait)) {
+            if (!params.indefinitelyPoll && WaitUtils::waitFunction(partitionAddress, taskCountToWait, elapsedTime >= spinTime)) {
                 break;
             }
 
             currentTime = std::chrono::high_resolution_clock::now();
             if (checkGpuHangDetected(currentTime, lastHangCheckTime)) {
+                dumpGpuHangState(taskCountToWait);
                 return WaitStatus::GpuHang;
             }
 
+            elapsedTime = std::chrono::duration_cast<std::chrono::microseconds>(currentTime - waitStartTime).count();
             if (params.enableTimeout) {
-                timeDiff = std::chrono::duration_cast<std::chrono::microseconds>(currentTime - waitStartTime).count();
+                timeDiff = elapsedTime;
             }
         }
 
@@ -409,6 +532,11 @@ WaitStatus CommandStreamReceiver::baseWaitFunction(volatile uint32_t *pollAddres
         partitionAddress = ptrOffset(partitionAddress, this->postSyncWriteOffset);
     }
 
+    if (WaitUtils::adaptiveWaitEnabled) {
+        currentTime = std::chrono::high_resolution_clock::now();
+        adaptiveWaitPolicy.recordWaitTime(std::chrono::duration_cast<std::chrono::microseconds>(currentTime - waitStartTime).count());
+    }
+
     return WaitStatus::Ready;
 }
 
@@ -674,6 +802,10 @@ bool CommandStreamReceiver::initializeTagAllocation() {
         userPauseConfirmation = Thread::create(CommandStreamReceiver::asyncDebugBreakConfirmation, reinterpret_cast<void *>(this));
     }
 
+    if (osContext && !EngineHelpers::isBcs(osContext->getEngineType())) {
+        submissionTimeline = SubmissionTimeline::create(*getMemoryManager(), rootDeviceIndex, deviceBitfield);
+    }
+
     return true;
 }
 
@@ -720,6 +852,10 @@ bool CommandStreamReceiver::createGlobalFenceAllocation() {
 }
 
 bool CommandStreamReceiver::createPreemptionAllocation() {
+    // copy engines don't save thread state on preemption, the context save area is never used
+    if (osContext && EngineHelpers::isBcs(osContext->getEngineType())) {
+        return true;
+    }
     auto hwInfo = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getHardwareInfo();
     size_t preemptionSurfaceSize = hwInfo->capabilityTable.requiredPreemptionSurfaceSize;
     if (DebugManager.flags.OverrideCsrAllocationSize.get() > 0) {
@@ -732,6 +868,20 @@ bool CommandStreamReceiver::createPreemptionAllocation() {
     return this->preemptionAllocation != nullptr;
 }
 
+// Preemption and kernel args buffer allocations of engines not used so far are created on first use
+bool CommandStreamReceiver::ensureDeferredResourcesCreated() {
+    if (!resourcesCreationDeferred) {
+        return true;
+    }
+    std::call_once(deferredResourcesCreatedFlag, [this] {
+        createKernelArgsBufferAllocation();
+        if (osContext->getPreemptionMode() == PreemptionMode::MidThread) {
+            deferredResourcesCreated = createPreemptionAllocation();
+        }
+    });
+    return deferredResourcesCreated;
+}
+
 std::unique_lock<CommandStreamReceiver::MutexType> CommandStreamReceiver::obtainUniqueOwnership() {
     return std::unique_lock<CommandStreamReceiver::MutexType>(this->ownershipMutex);
 }
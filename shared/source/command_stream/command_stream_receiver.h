@@ -24,10 +24,12 @@
 #include "shared/source/os_interface/os_thread.h"
 #include "shared/source/utilities/spinlock.h"
 #include "shared/source/utilities/stackvec.h"
+#include "shared/source/utilities/wait_util.h"
 
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <mutex>
 #include <optional>
 
 namespace NEO {
@@ -46,6 +48,7 @@ class MultiGraphicsAllocation;
 class OsContext;
 class OSInterface;
 class ScratchSpaceController;
+class SubmissionTimeline;
 class HwPerfCounter;
 class HwTimeStamps;
 class GmmHelper;
@@ -162,6 +165,7 @@ class CommandStreamReceiver {
     GraphicsAllocation *getGlobalFenceAllocation() const { return globalFenceAllocation; }
     GraphicsAllocation *getWorkPartitionAllocation() const { return workPartitionAllocation; }
     GraphicsAllocation *getKernelArgsBufferAllocation() const { return kernelArgsBufferAllocation; }
+    SubmissionTimeline *getSubmissionTimeline() const { return submissionTimeline.get(); }
 
     void requestStallingCommandsOnNextFlush() { stallingCommandsOnNextFlushRequired = true; }
     bool isStallingCommandsOnNextFlushRequired() const { return stallingCommandsOnNextFlushRequired; }
@@ -193,6 +197,8 @@ class CommandStreamReceiver {
     MOCKABLE_VIRTUAL bool createWorkPartitionAllocation(const Device &device);
     MOCKABLE_VIRTUAL bool createGlobalFenceAllocation();
     MOCKABLE_VIRTUAL bool createPreemptionAllocation();
+    void deferResourcesCreation() { resourcesCreationDeferred = true; }
+    bool ensureDeferredResourcesCreated();
     MOCKABLE_VIRTUAL bool createPerDssBackedBuffer(Device &device);
     virtual void createKernelArgsBufferAllocation() = 0;
     [[nodiscard]] MOCKABLE_VIRTUAL std::unique_lock<MutexType> obtainUniqueOwnership();
@@ -273,6 +279,8 @@ class CommandStreamReceiver {
 
     virtual void stopDirectSubmission() {}
 
+    virtual void releaseDirectSubmission() {}
+
     bool isStaticWorkPartitioningEnabled() const {
         return staticWorkPartitioningEnabled;
     }
@@ -327,6 +335,8 @@ class CommandStreamReceiver {
 
     MOCKABLE_VIRTUAL bool isGpuHangDetected() const;
     MOCKABLE_VIRTUAL bool checkGpuHangDetected(TimeType currentTime, TimeType &lastHangCheckTime) const;
+    MOCKABLE_VIRTUAL void dumpGpuHangState(uint32_t taskCountToWait);
+    MOCKABLE_VIRTUAL bool recoverFromGpuHang();
 
     uint64_t getCompletionAddress() const {
         uint64_t completionFenceAddress = castToUint64(const_cast<uint32_t *>(getTagAddress()));
@@ -383,6 +393,7 @@ class CommandStreamReceiver {
     std::unique_ptr<TagAllocatorBase> timestampPacketAllocator;
     std::unique_ptr<Thread> userPauseConfirmation;
     std::unique_ptr<LogicalStateHelper> logicalStateHelper;
+    std::unique_ptr<SubmissionTimeline> submissionTimeline;
 
     ResidencyContainer residencyAllocations;
     ResidencyContainer evictionAllocations;
@@ -402,6 +413,7 @@ class CommandStreamReceiver {
     volatile uint32_t *tagAddress = nullptr;
     volatile DebugPauseState *debugPauseStateAddress = nullptr;
     SpinLock debugPauseStateLock;
+    std::once_flag deferredResourcesCreatedFlag;
     static void *asyncDebugBreakConfirmation(void *arg);
     std::function<void()> debugConfirmationFunction = []() { std::cin.get(); };
     std::function<void(GraphicsAllocation &)> downloadAllocationImpl;
@@ -433,6 +445,8 @@ class CommandStreamReceiver {
     PreemptionMode lastPreemptionMode = PreemptionMode::Initial;
 
     std::chrono::microseconds gpuHangCheckPeriod{500'000};
+    bool gpuHangStateDumped = false;
+    WaitUtils::AdaptiveWaitPolicy adaptiveWaitPolicy;
     uint32_t lastSentL3Config = 0;
     uint32_t latestSentStatelessMocsConfig = 0;
     uint64_t lastSentSliceCount = QueueSliceCount::defaultSliceCount;
@@ -471,6 +485,8 @@ class CommandStreamReceiver {
 
     bool localMemoryEnabled = false;
     bool pageTableManagerInitialized = false;
+    bool resourcesCreationDeferred = false;
+    bool deferredResourcesCreated = true;
 
     bool useNewResourceImplicitFlush = false;
     bool newResources = false;
@@ -121,6 +121,8 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
     }
 
     void stopDirectSubmission() override;
+    void releaseDirectSubmission() override;
+    bool isRingDependencyDispatchAllowed(bool blitter) const;
 
     virtual bool isKmdWaitModeActive() { return true; }
 
@@ -161,6 +163,9 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
     void programEnginePrologue(LinearStream &csr);
     size_t getCmdSizeForPrologue() const;
 
+    void programSubmissionTimelineTimestamp(LinearStream &csr, uint64_t address);
+    size_t getCmdSizeForSubmissionTimelineTimestamp() const;
+
     void setClearSlmWorkAroundParameter(PipeControlArgs &args);
     void addPipeControlBeforeStateSip(LinearStream &commandStream, Device &device);
     void addPipeControlBefore3dState(LinearStream &commandStream, DispatchFlags &dispatchFlags);
@@ -171,6 +176,7 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
     void createScratchSpaceController();
 
     bool detectInitProgrammingFlagsRequired(const DispatchFlags &dispatchFlags) const;
+    bool isTagWriteCoalescingAllowed(const DispatchFlags &dispatchFlags) const;
     bool checkPlatformSupportsNewResourceImplicitFlush() const;
     bool checkPlatformSupportsGpuIdleImplicitFlush() const;
     void configurePostSyncWriteOffset();
@@ -193,6 +199,8 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
 
     size_t cmdStreamStart = 0;
     uint32_t latestSentBcsWaValue = std::numeric_limits<uint32_t>::max();
+    uint32_t submissionTimelineSlot = 0;
+    uint32_t coalescedTagWrites = 0;
 };
 
 } // namespace NEO
@@ -13,6 +13,7 @@
 #include "shared/source/command_stream/preemption.h"
 #include "shared/source/command_stream/scratch_space_controller_base.h"
 #include "shared/source/command_stream/stream_properties.h"
+#include "shared/source/command_stream/submission_timeline.h"
 #include "shared/source/command_stream/wait_status.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
@@ -37,7 +38,9 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/hw_info_config.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/utilities/performance_hints_log.h"
 #include "shared/source/utilities/tag_allocator.h"
+#include "shared/source/utilities/trace_points.h"
 
 #include "command_stream_receiver_hw_ext.inl"
 
@@ -182,6 +185,16 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     DEBUG_BREAK_IF(taskLevel >= CompletionStamp::notReady);
 
     DBG_LOG(LogTaskCounts, __FUNCTION__, "Line: ", __LINE__, "taskLevel", taskLevel);
+    TRACE_POINT(FlushTask, taskCount + 1, osContext->getContextId());
+
+    if (submissionTimeline) {
+        submissionTimelineSlot = submissionTimeline->beginEntry(taskCount + 1);
+        dispatchFlags.epilogueRequired = true;
+        makeResident(*submissionTimeline->getGpuTimestampsAllocation());
+    }
+
+    [[maybe_unused]] auto deferredResourcesCreated = this->ensureDeferredResourcesCreated();
+    DEBUG_BREAK_IF(!deferredResourcesCreated);
 
     auto levelClosed = false;
     bool implicitFlush = dispatchFlags.implicitFlush || dispatchFlags.blocking || DebugManager.flags.ForceImplicitFlush.get();
@@ -204,7 +217,14 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     const auto &hwInfo = peekHwInfo();
     auto &hwHelper = HwHelper::get(hwInfo.platform.eRenderCoreFamily);
 
+    if (isTagWriteCoalescingAllowed(dispatchFlags)) {
+        // tag and cache flush are deferred to the next submission that needs them, wait or flush
+        dispatchFlags.guardCommandBufferWithPipeControl = false;
+        coalescedTagWrites++;
+    }
+
     if (dispatchFlags.blocking || dispatchFlags.dcFlush || dispatchFlags.guardCommandBufferWithPipeControl) {
+        coalescedTagWrites = 0;
         if (this->dispatchMode == DispatchMode::ImmediateDispatch) {
             // for ImmediateDispatch we will send this right away, therefore this pipe control will close the level
             // for BatchedSubmissions it will be nooped and only last ppc in batch will be emitted.
@@ -312,8 +332,16 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     auto &commandStreamCSR = this->getCS(getRequiredCmdStreamSizeAligned(dispatchFlags, device));
     auto commandStreamStartCSR = commandStreamCSR.getUsed();
 
+    if (submissionTimeline) {
+        programSubmissionTimelineTimestamp(commandStreamCSR, submissionTimeline->getGpuStartAddress(submissionTimelineSlot));
+    }
+
+    bool dispatchDependenciesInRing = isRingDependencyDispatchAllowed(false);
+
     TimestampPacketHelper::programCsrDependenciesForTimestampPacketContainer<GfxFamily>(commandStreamCSR, dispatchFlags.csrDependencies);
-    TimestampPacketHelper::programCsrDependenciesForForTaskCountContainer<GfxFamily>(commandStreamCSR, dispatchFlags.csrDependencies);
+    if (!dispatchDependenciesInRing) {
+        TimestampPacketHelper::programCsrDependenciesForForTaskCountContainer<GfxFamily>(commandStreamCSR, dispatchFlags.csrDependencies);
+    }
 
     programActivePartitionConfigFlushTask(commandStreamCSR);
     programEngineModeCommands(commandStreamCSR, dispatchFlags);
@@ -381,6 +409,9 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
 
     // Reprogram state base address if required
     if (isStateBaseAddressDirty || sourceLevelDebuggerActive) {
+        if (taskCount > 0u) {
+            PERFORMANCE_HINT(PerformanceHintId::StateBaseAddressReprogramming, dshDirty, iohDirty, sshDirty, taskCount.load());
+        }
         EncodeWA<GfxFamily>::addPipeControlBeforeStateBaseAddress(commandStreamCSR, hwInfo, isRcs());
         EncodeWA<GfxFamily>::encodeAdditionalPipelineSelect(commandStreamCSR, dispatchFlags.pipelineSelectArgs, true, hwInfo, isRcs());
 
@@ -436,10 +467,14 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
             bindingTableBaseAddressRequired = true;
         }
 
+        int64_t bindingTablePoolBaseAddress = -1;
         if (bindingTableBaseAddressRequired) {
             StateBaseAddressHelper<GfxFamily>::programBindingTableBaseAddress(commandStreamCSR, *ssh, device.getGmmHelper());
+            bindingTablePoolBaseAddress = static_cast<int64_t>(ssh->getHeapGpuBase());
             bindingTableBaseAddressRequired = false;
         }
+        streamProperties.stateBaseAddress.setProperties(static_cast<int64_t>(newGSHbase), static_cast<int64_t>(indirectObjectStateBaseAddress),
+                                                        bindingTablePoolBaseAddress, static_cast<int32_t>(mocsIndex));
 
         EncodeWA<GfxFamily>::encodeAdditionalPipelineSelect(commandStreamCSR, dispatchFlags.pipelineSelectArgs, false, hwInfo, isRcs());
 
@@ -596,12 +631,24 @@ CompletionStamp CommandStreamReceiverHw<GfxFamily>::flushTask(
     BatchBuffer batchBuffer{streamToSubmit.getGraphicsAllocation(), startOffset, chainedBatchBufferStartOffset, chainedBatchBuffer,
                             dispatchFlags.requiresCoherency, dispatchFlags.lowPriority, dispatchFlags.throttle, dispatchFlags.sliceCount,
                             streamToSubmit.getUsed(), &streamToSubmit, bbEndLocation, dispatchFlags.useSingleSubdevice};
+    if (dispatchDependenciesInRing) {
+        for (auto &taskCountDependency : dispatchFlags.csrDependencies.taskCountContainer) {
+            batchBuffer.ringDependencies.push_back(taskCountDependency);
+        }
+    }
     streamToSubmit.getGraphicsAllocation()->updateTaskCount(this->taskCount + 1, this->osContext->getContextId());
     streamToSubmit.getGraphicsAllocation()->updateResidencyTaskCount(this->taskCount + 1, this->osContext->getContextId());
 
+    if (submissionTimeline) {
+        submissionTimeline->markEncodeComplete(submissionTimelineSlot);
+    }
+
     if (submitCSR || submitTask) {
         if (this->dispatchMode == DispatchMode::ImmediateDispatch) {
             flushHandler(batchBuffer, this->getResidencyAllocations());
+            if (submissionTimeline) {
+                submissionTimeline->markSubmitted(submissionTimelineSlot);
+            }
             if (dispatchFlags.blocking || dispatchFlags.dcFlush || dispatchFlags.guardCommandBufferWithPipeControl) {
                 this->latestFlushedTaskCount = this->taskCount + 1;
             }
@@ -696,6 +743,9 @@ inline void CommandStreamReceiverHw<GfxFamily>::programStallingCommandsForBarrie
 template <typename GfxFamily>
 inline bool CommandStreamReceiverHw<GfxFamily>::flushBatchedSubmissions() {
     if (this->dispatchMode == DispatchMode::ImmediateDispatch) {
+        if (coalescedTagWrites > 0) {
+            flushTagUpdate();
+        }
         return true;
     }
     typedef typename GfxFamily::MI_BATCH_BUFFER_START MI_BATCH_BUFFER_START;
@@ -851,6 +901,9 @@ size_t CommandStreamReceiverHw<GfxFamily>::getRequiredCmdStreamSize(const Dispat
     }
     size += getCmdSizeForEpilogue(dispatchFlags);
     size += getCmdsSizeForHardwareContext();
+    if (submissionTimeline) {
+        size += getCmdSizeForSubmissionTimelineTimestamp();
+    }
     if (csrSizeRequestFlags.activePartitionsChanged) {
         size += getCmdSizeForActivePartitionConfig();
     }
@@ -1078,9 +1131,13 @@ std::optional<uint32_t> CommandStreamReceiverHw<GfxFamily>::flushBcsTask(const B
         logicalStateHelper->writeStreamInline(commandStream, false);
     }
 
+    bool dispatchDependenciesInRing = isRingDependencyDispatchAllowed(true);
+
     for (auto &blitProperties : blitPropertiesContainer) {
         TimestampPacketHelper::programCsrDependenciesForTimestampPacketContainer<GfxFamily>(commandStream, blitProperties.csrDependencies);
-        TimestampPacketHelper::programCsrDependenciesForForTaskCountContainer<GfxFamily>(commandStream, blitProperties.csrDependencies);
+        if (!dispatchDependenciesInRing) {
+            TimestampPacketHelper::programCsrDependenciesForForTaskCountContainer<GfxFamily>(commandStream, blitProperties.csrDependencies);
+        }
 
         BlitCommandsHelper<GfxFamily>::encodeWa(commandStream, blitProperties, latestSentBcsWaValue);
 
@@ -1148,6 +1205,13 @@ std::optional<uint32_t> CommandStreamReceiverHw<GfxFamily>::flushBcsTask(const B
 
     BatchBuffer batchBuffer{commandStream.getGraphicsAllocation(), commandStreamStart, 0, nullptr, false, false, QueueThrottle::MEDIUM, QueueSliceCount::defaultSliceCount,
                             commandStream.getUsed(), &commandStream, endingCmdPtr, false};
+    if (dispatchDependenciesInRing) {
+        for (auto &blitProperties : blitPropertiesContainer) {
+            for (auto &taskCountDependency : blitProperties.csrDependencies.taskCountContainer) {
+                batchBuffer.ringDependencies.push_back(taskCountDependency);
+            }
+        }
+    }
 
     commandStream.getGraphicsAllocation()->updateTaskCount(newTaskCount, this->osContext->getContextId());
     commandStream.getGraphicsAllocation()->updateResidencyTaskCount(newTaskCount, this->osContext->getContextId());
@@ -1230,6 +1294,7 @@ void CommandStreamReceiverHw<GfxFamily>::flushPipeControl() {
 
     this->flushSmallTask(commandStream, commandStreamStart);
     this->latestFlushedTaskCount = taskCount.load();
+    this->coalescedTagWrites = 0;
 }
 
 template <typename GfxFamily>
@@ -1296,6 +1361,19 @@ inline bool CommandStreamReceiverHw<GfxFamily>::isUpdateTagFromWaitEnabled() {
     return enabled;
 }
 
+template <typename GfxFamily>
+inline bool CommandStreamReceiverHw<GfxFamily>::isTagWriteCoalescingAllowed(const DispatchFlags &dispatchFlags) const {
+    auto maxCoalescedTagWrites = DebugManager.flags.CoalesceTaskCountTagWrites.get();
+    if (maxCoalescedTagWrites <= 0 || this->dispatchMode != DispatchMode::ImmediateDispatch) {
+        return false;
+    }
+    if (!dispatchFlags.guardCommandBufferWithPipeControl || dispatchFlags.blocking || dispatchFlags.dcFlush ||
+        dispatchFlags.memoryMigrationRequired || dispatchFlags.textureCacheFlush) {
+        return false;
+    }
+    return coalescedTagWrites + 1 < static_cast<uint32_t>(maxCoalescedTagWrites);
+}
+
 template <typename GfxFamily>
 inline void CommandStreamReceiverHw<GfxFamily>::updateTagFromWait() {
     flushBatchedSubmissions();
@@ -1322,6 +1400,12 @@ inline void CommandStreamReceiverHw<GfxFamily>::programEpilogue(LinearStream &cs
         auto gpuAddress = ptrOffset(csr.getGraphicsAllocation()->getGpuAddress(), currentOffset);
 
         addBatchBufferStart(reinterpret_cast<typename GfxFamily::MI_BATCH_BUFFER_START *>(*batchBufferEndLocation), gpuAddress, false);
+        if (submissionTimeline) {
+            PipeControlArgs args;
+            args.csStall = true;
+            MemorySynchronizationCommands<GfxFamily>::addSingleBarrier(csr, args);
+            programSubmissionTimelineTimestamp(csr, submissionTimeline->getGpuEndAddress(submissionTimelineSlot));
+        }
         this->programEpliogueCommands(csr, dispatchFlags);
         programEndingCmd(csr, device, batchBufferEndLocation, isDirectSubmissionEnabled());
         EncodeNoop<GfxFamily>::alignToCacheLine(csr);
@@ -1336,10 +1420,25 @@ inline size_t CommandStreamReceiverHw<GfxFamily>::getCmdSizeForEpilogue(const Di
             terminateCmd = sizeof(typename GfxFamily::MI_BATCH_BUFFER_START);
         }
         auto size = getCmdSizeForEpilogueCommands(dispatchFlags) + terminateCmd;
+        if (submissionTimeline) {
+            size += MemorySynchronizationCommands<GfxFamily>::getSizeForSingleBarrier(false);
+            size += getCmdSizeForSubmissionTimelineTimestamp();
+        }
         return alignUp(size, MemoryConstants::cacheLineSize);
     }
     return 0u;
 }
+
+template <typename GfxFamily>
+inline void CommandStreamReceiverHw<GfxFamily>::programSubmissionTimelineTimestamp(LinearStream &csr, uint64_t address) {
+    EncodeStoreMMIO<GfxFamily>::encode(csr, REG_GLOBAL_TIMESTAMP_LDW, address, false);
+    EncodeStoreMMIO<GfxFamily>::encode(csr, REG_GLOBAL_TIMESTAMP_UN, address + sizeof(uint32_t), false);
+}
+
+template <typename GfxFamily>
+inline size_t CommandStreamReceiverHw<GfxFamily>::getCmdSizeForSubmissionTimelineTimestamp() const {
+    return 2 * EncodeStoreMMIO<GfxFamily>::size;
+}
 template <typename GfxFamily>
 inline void CommandStreamReceiverHw<GfxFamily>::programEnginePrologue(LinearStream &csr) {
 }
@@ -1358,8 +1457,42 @@ inline void CommandStreamReceiverHw<GfxFamily>::stopDirectSubmission() {
     }
 }
 
+template <typename GfxFamily>
+void CommandStreamReceiverHw<GfxFamily>::releaseDirectSubmission() {
+    if (!this->isAnyDirectSubmissionEnabled()) {
+        return;
+    }
+    auto directSubmissionController = executionEnvironment.directSubmissionController.get();
+    if (directSubmissionController) {
+        directSubmissionController->unregisterDirectSubmission(this);
+    }
+    if (directSubmission) {
+        directSubmission->abandonRingBuffer();
+        directSubmission.reset();
+    }
+    if (blitterDirectSubmission) {
+        blitterDirectSubmission->abandonRingBuffer();
+        blitterDirectSubmission.reset();
+    }
+    completionFenceValuePointer = nullptr;
+}
+
+template <typename GfxFamily>
+bool CommandStreamReceiverHw<GfxFamily>::isRingDependencyDispatchAllowed(bool blitter) const {
+    if (DebugManager.flags.DirectSubmissionRingDependencies.get() != 1) {
+        return false;
+    }
+    if (blitter) {
+        return isBlitterDirectSubmissionEnabled();
+    }
+    return isDirectSubmissionEnabled() && this->dispatchMode == DispatchMode::ImmediateDispatch;
+}
+
 template <typename GfxFamily>
 inline bool CommandStreamReceiverHw<GfxFamily>::initDirectSubmission() {
+    if (!this->ensureDeferredResourcesCreated()) {
+        return false;
+    }
     bool ret = true;
 
     bool submitOnInit = false;
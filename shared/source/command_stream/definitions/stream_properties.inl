@@ -90,4 +90,18 @@ struct PipelineSelectProperties {
     bool propertiesSupportLoaded = false;
 };
 
+struct StateBaseAddressProperties {
+    StreamProperty64 generalStateBaseAddress{};
+    StreamProperty64 indirectObjectBaseAddress{};
+    StreamProperty64 bindingTablePoolBaseAddress{};
+    StreamProperty statelessMocs{};
+
+    void setProperties(int64_t generalStateBaseAddress, int64_t indirectObjectBaseAddress, int64_t bindingTablePoolBaseAddress, int32_t statelessMocs);
+    void setProperties(const StateBaseAddressProperties &properties);
+    bool isDirty() const;
+
+  protected:
+    void clearIsDirty();
+};
+
 } // namespace NEO
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace NEO {
+namespace GpuHangDump {
+
+// File layout: Header, then Header::sectionCount x (SectionHeader + SectionHeader::size bytes).
+constexpr char magic[8] = "NEOHANG";
+constexpr uint32_t version = 1u;
+
+enum class SectionType : uint32_t {
+    CommandStream = 1,
+    StateSaveArea = 2,
+    ResidencyList = 3,
+};
+
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t sectionCount;
+    uint32_t contextId;
+    uint32_t taskCountToWait;
+    uint32_t latestFlushedTaskCount;
+    uint32_t completedTaskCount;
+};
+static_assert(sizeof(Header) == 32, "");
+
+struct SectionHeader {
+    SectionType type;
+    uint32_t reserved;
+    uint64_t gpuAddress;
+    uint64_t size;
+};
+static_assert(sizeof(SectionHeader) == 24, "");
+
+struct ResidencyEntry {
+    uint64_t gpuAddress;
+    uint64_t size;
+    uint32_t allocationType;
+    uint32_t reserved;
+};
+static_assert(sizeof(ResidencyEntry) == 24, "");
+
+} // namespace GpuHangDump
+} // namespace NEO
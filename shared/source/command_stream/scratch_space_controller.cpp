@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,12 +7,14 @@
 
 #include "shared/source/command_stream/scratch_space_controller.h"
 
+#include "shared/source/command_stream/scratch_space_pool.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
 
 namespace NEO {
 ScratchSpaceController::ScratchSpaceController(uint32_t rootDeviceIndex, ExecutionEnvironment &environment, InternalAllocationStorage &allocationStorage)
@@ -20,14 +22,15 @@ ScratchSpaceController::ScratchSpaceController(uint32_t rootDeviceIndex, Executi
     auto hwInfo = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getHardwareInfo();
     auto &hwHelper = HwHelper::get(hwInfo->platform.eRenderCoreFamily);
     computeUnitsUsedForScratch = hwHelper.getComputeUnitsUsedForScratch(hwInfo);
+    scratchSpacePool = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getScratchSpacePool();
 }
 
 ScratchSpaceController::~ScratchSpaceController() {
     if (scratchAllocation) {
-        getMemoryManager()->freeGraphicsMemory(scratchAllocation);
+        releaseScratchAllocation(scratchAllocation);
     }
     if (privateScratchAllocation) {
-        getMemoryManager()->freeGraphicsMemory(privateScratchAllocation);
+        releaseScratchAllocation(privateScratchAllocation);
     }
 }
 
@@ -35,4 +38,29 @@ MemoryManager *ScratchSpaceController::getMemoryManager() const {
     UNRECOVERABLE_IF(executionEnvironment.memoryManager.get() == nullptr);
     return executionEnvironment.memoryManager.get();
 }
+
+GraphicsAllocation *ScratchSpaceController::obtainScratchAllocation(const AllocationProperties &properties) {
+    if (scratchSpacePool) {
+        return scratchSpacePool->obtainAllocation(properties);
+    }
+    return getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+}
+
+void ScratchSpaceController::retireScratchAllocation(GraphicsAllocation *allocation, uint32_t currentTaskCount, OsContext &osContext) {
+    allocation->updateTaskCount(currentTaskCount, osContext.getContextId());
+    if (scratchSpacePool) {
+        // pooled allocation becomes reusable by any engine as soon as gpu is done with it
+        scratchSpacePool->releaseAllocation(allocation);
+        return;
+    }
+    csrAllocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(allocation), TEMPORARY_ALLOCATION);
+}
+
+void ScratchSpaceController::releaseScratchAllocation(GraphicsAllocation *allocation) {
+    if (scratchSpacePool) {
+        scratchSpacePool->releaseAllocation(allocation);
+        return;
+    }
+    getMemoryManager()->freeGraphicsMemory(allocation);
+}
 } // namespace NEO
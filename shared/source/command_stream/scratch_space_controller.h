@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -21,6 +21,8 @@ class MemoryManager;
 struct HardwareInfo;
 class OsContext;
 class CommandStreamReceiver;
+class ScratchSpacePool;
+struct AllocationProperties;
 
 namespace ScratchSpaceConstants {
 constexpr size_t scratchSpaceOffsetFor64Bit = 4096u;
@@ -77,12 +79,16 @@ class ScratchSpaceController {
 
   protected:
     MemoryManager *getMemoryManager() const;
+    GraphicsAllocation *obtainScratchAllocation(const AllocationProperties &properties);
+    void retireScratchAllocation(GraphicsAllocation *allocation, uint32_t currentTaskCount, OsContext &osContext);
+    void releaseScratchAllocation(GraphicsAllocation *allocation);
 
     const uint32_t rootDeviceIndex;
     ExecutionEnvironment &executionEnvironment;
     GraphicsAllocation *scratchAllocation = nullptr;
     GraphicsAllocation *privateScratchAllocation = nullptr;
     InternalAllocationStorage &csrAllocationStorage;
+    ScratchSpacePool *scratchSpacePool = nullptr;
     size_t scratchSizeBytes = 0;
     size_t privateScratchSizeBytes = 0;
     bool force32BitAllocation = false;
@@ -163,28 +163,26 @@ void ScratchSpaceControllerXeHPAndLater::prepareScratchAllocation(uint32_t requi
     auto multiTileCapable = osContext.getNumSupportedDevices() > 1;
     if (scratchSizeBytes < requiredScratchSizeInBytes) {
         if (scratchAllocation) {
-            scratchAllocation->updateTaskCount(currentTaskCount, osContext.getContextId());
-            csrAllocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(scratchAllocation), TEMPORARY_ALLOCATION);
+            retireScratchAllocation(scratchAllocation, currentTaskCount, osContext);
         }
         scratchSurfaceDirty = true;
         scratchSizeBytes = requiredScratchSizeInBytes;
         perThreadScratchSize = requiredPerThreadScratchSizeAlignedUp;
         AllocationProperties properties{this->rootDeviceIndex, true, scratchSizeBytes, AllocationType::SCRATCH_SURFACE, multiTileCapable, false, osContext.getDeviceBitfield()};
-        scratchAllocation = getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+        scratchAllocation = obtainScratchAllocation(properties);
     }
     if (privateScratchSpaceSupported) {
         uint32_t requiredPerThreadPrivateScratchSizeAlignedUp = alignUp(requiredPerThreadPrivateScratchSize, 64);
         size_t requiredPrivateScratchSizeInBytes = requiredPerThreadPrivateScratchSizeAlignedUp * computeUnitsUsedForScratch;
         if (privateScratchSizeBytes < requiredPrivateScratchSizeInBytes) {
             if (privateScratchAllocation) {
-                privateScratchAllocation->updateTaskCount(currentTaskCount, osContext.getContextId());
-                csrAllocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(privateScratchAllocation), TEMPORARY_ALLOCATION);
+                retireScratchAllocation(privateScratchAllocation, currentTaskCount, osContext);
             }
             privateScratchSizeBytes = requiredPrivateScratchSizeInBytes;
             perThreadPrivateScratchSize = requiredPerThreadPrivateScratchSizeAlignedUp;
             scratchSurfaceDirty = true;
             AllocationProperties properties{this->rootDeviceIndex, true, privateScratchSizeBytes, AllocationType::PRIVATE_SURFACE, multiTileCapable, false, osContext.getDeviceBitfield()};
-            privateScratchAllocation = getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+            privateScratchAllocation = obtainScratchAllocation(properties);
         }
     }
 }
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/scratch_space_pool.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/memory_manager/allocation_properties.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
+
+#include <algorithm>
+
+namespace NEO {
+ScratchSpacePool::ScratchSpacePool(MemoryManager &memoryManager, size_t maxPooledSize)
+    : memoryManager(memoryManager), maxPooledSize(maxPooledSize) {
+}
+
+ScratchSpacePool::~ScratchSpacePool() {
+    for (auto &pooledAllocation : pooledAllocations) {
+        memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(pooledAllocation.allocation);
+    }
+    for (auto &allocationInUse : allocationsInUse) {
+        memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(allocationInUse.allocation);
+    }
+}
+
+size_t ScratchSpacePool::getSizeClass(size_t size) {
+    return std::max(static_cast<size_t>(Math::nextPowerOfTwo(static_cast<uint64_t>(size))), minSizeClass);
+}
+
+GraphicsAllocation *ScratchSpacePool::obtainAllocation(const AllocationProperties &properties) {
+    auto sizeClass = getSizeClass(properties.size);
+    bool multiOsContextCapable = !!properties.flags.multiOsContextCapable;
+
+    std::unique_lock<std::mutex> lock(mtx);
+
+    // reuse smallest idle allocation of matching kind that fits, allocations retired by any engine qualify
+    auto bestFit = pooledAllocations.end();
+    for (auto it = pooledAllocations.begin(); it != pooledAllocations.end(); it++) {
+        auto allocationSize = it->allocation->getUnderlyingBufferSize();
+        if (it->allocationType != properties.allocationType ||
+            it->deviceBitfield != properties.subDevicesBitfield ||
+            it->multiOsContextCapable != multiOsContextCapable ||
+            it->multiStorageResource != properties.multiStorageResource ||
+            allocationSize < sizeClass) {
+            continue;
+        }
+        if (bestFit != pooledAllocations.end() && bestFit->allocation->getUnderlyingBufferSize() <= allocationSize) {
+            continue;
+        }
+        if (isAllocationIdle(*it->allocation)) {
+            bestFit = it;
+        }
+    }
+
+    if (bestFit != pooledAllocations.end()) {
+        auto pooledAllocation = *bestFit;
+        pooledSize -= pooledAllocation.allocation->getUnderlyingBufferSize();
+        pooledAllocations.erase(bestFit);
+        allocationsInUse.push_back(pooledAllocation);
+        return pooledAllocation.allocation;
+    }
+
+    lock.unlock();
+
+    auto allocationProperties = properties;
+    allocationProperties.size = sizeClass;
+    auto allocation = memoryManager.allocateGraphicsMemoryWithProperties(allocationProperties);
+    if (allocation == nullptr) {
+        return nullptr;
+    }
+
+    lock.lock();
+    allocationsInUse.push_back({allocation, properties.allocationType, properties.subDevicesBitfield, multiOsContextCapable, properties.multiStorageResource});
+    return allocation;
+}
+
+void ScratchSpacePool::releaseAllocation(GraphicsAllocation *allocation) {
+    std::unique_lock<std::mutex> lock(mtx);
+
+    auto it = std::find_if(allocationsInUse.begin(), allocationsInUse.end(), [allocation](const PooledAllocation &allocationInUse) {
+        return allocationInUse.allocation == allocation;
+    });
+    if (it == allocationsInUse.end()) {
+        lock.unlock();
+        memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(allocation);
+        return;
+    }
+
+    pooledAllocations.push_back(*it);
+    allocationsInUse.erase(it);
+    pooledSize += allocation->getUnderlyingBufferSize();
+
+    trim();
+}
+
+bool ScratchSpacePool::isAllocationIdle(GraphicsAllocation &allocation) {
+    for (auto &engine : memoryManager.getRegisteredEngines()) {
+        auto contextId = engine.osContext->getContextId();
+        if (allocation.isUsedByOsContext(contextId) &&
+            !engine.commandStreamReceiver->testTaskCountReady(engine.commandStreamReceiver->getTagAddress(), allocation.getTaskCount(contextId))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ScratchSpacePool::trim() {
+    // shrink policy: drop oldest pooled allocations first, busy ones are released once gpu is done with them
+    while (pooledSize > maxPooledSize && !pooledAllocations.empty()) {
+        auto allocation = pooledAllocations.front().allocation;
+        pooledSize -= allocation->getUnderlyingBufferSize();
+        pooledAllocations.erase(pooledAllocations.begin());
+        memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(allocation);
+    }
+}
+} // namespace NEO
@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/common_types.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/memory_manager/allocation_type.h"
+
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class GraphicsAllocation;
+class MemoryManager;
+struct AllocationProperties;
+
+class ScratchSpacePool : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t minSizeClass = MemoryConstants::pageSize64k;
+    static constexpr size_t defaultMaxPooledSize = 256 * MemoryConstants::megaByte;
+
+    ScratchSpacePool(MemoryManager &memoryManager, size_t maxPooledSize);
+    ~ScratchSpacePool();
+
+    static size_t getSizeClass(size_t size);
+
+    GraphicsAllocation *obtainAllocation(const AllocationProperties &properties);
+    void releaseAllocation(GraphicsAllocation *allocation);
+
+  protected:
+    struct PooledAllocation {
+        GraphicsAllocation *allocation;
+        AllocationType allocationType;
+        DeviceBitfield deviceBitfield;
+        bool multiOsContextCapable;
+        bool multiStorageResource;
+    };
+
+    MOCKABLE_VIRTUAL bool isAllocationIdle(GraphicsAllocation &allocation);
+    void trim();
+
+    MemoryManager &memoryManager;
+    std::vector<PooledAllocation> pooledAllocations;
+    std::vector<PooledAllocation> allocationsInUse;
+    std::mutex mtx;
+    size_t pooledSize = 0;
+    const size_t maxPooledSize;
+};
+} // namespace NEO
@@ -200,3 +200,33 @@ void PipelineSelectProperties::clearIsDirty() {
     mediaSamplerDopClockGate.isDirty = false;
     systolicMode.isDirty = false;
 }
+
+void StateBaseAddressProperties::setProperties(int64_t generalStateBaseAddress, int64_t indirectObjectBaseAddress, int64_t bindingTablePoolBaseAddress, int32_t statelessMocs) {
+    clearIsDirty();
+
+    this->generalStateBaseAddress.set(generalStateBaseAddress);
+    this->indirectObjectBaseAddress.set(indirectObjectBaseAddress);
+    this->bindingTablePoolBaseAddress.set(bindingTablePoolBaseAddress);
+    this->statelessMocs.set(statelessMocs);
+}
+
+void StateBaseAddressProperties::setProperties(const StateBaseAddressProperties &properties) {
+    clearIsDirty();
+
+    generalStateBaseAddress.set(properties.generalStateBaseAddress.value);
+    indirectObjectBaseAddress.set(properties.indirectObjectBaseAddress.value);
+    bindingTablePoolBaseAddress.set(properties.bindingTablePoolBaseAddress.value);
+    statelessMocs.set(properties.statelessMocs.value);
+}
+
+bool StateBaseAddressProperties::isDirty() const {
+    return generalStateBaseAddress.isDirty || indirectObjectBaseAddress.isDirty ||
+           bindingTablePoolBaseAddress.isDirty || statelessMocs.isDirty;
+}
+
+void StateBaseAddressProperties::clearIsDirty() {
+    generalStateBaseAddress.isDirty = false;
+    indirectObjectBaseAddress.isDirty = false;
+    bindingTablePoolBaseAddress.isDirty = false;
+    statelessMocs.isDirty = false;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021 Intel Corporation
+ * Copyright (C) 2021-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,4 +22,15 @@ struct StreamProperty {
     }
 };
 
+struct StreamProperty64 {
+    int64_t value = -1;
+    bool isDirty = false;
+    void set(int64_t newValue) {
+        if ((value != newValue) && (newValue != -1)) {
+            value = newValue;
+            isDirty = true;
+        }
+    }
+};
+
 } // namespace NEO
@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/submission_timeline.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/memory_manager/allocation_properties.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+
+namespace NEO {
+
+std::unique_ptr<SubmissionTimeline> SubmissionTimeline::create(MemoryManager &memoryManager, uint32_t rootDeviceIndex, DeviceBitfield deviceBitfield) {
+    if (DebugManager.flags.EnableSubmissionTimeline.get() != 1) {
+        return nullptr;
+    }
+    AllocationProperties properties{rootDeviceIndex, entriesCount * sizeof(GpuTimestamps), AllocationType::PROFILING_TAG_BUFFER, deviceBitfield};
+    auto allocation = memoryManager.allocateGraphicsMemoryWithProperties(properties);
+    if (allocation == nullptr) {
+        return nullptr;
+    }
+    return std::make_unique<SubmissionTimeline>(memoryManager, allocation);
+}
+
+SubmissionTimeline::SubmissionTimeline(MemoryManager &memoryManager, GraphicsAllocation *gpuTimestampsAllocation)
+    : memoryManager(memoryManager), gpuTimestampsAllocation(gpuTimestampsAllocation) {
+    gpuTimestamps = reinterpret_cast<GpuTimestamps *>(gpuTimestampsAllocation->getUnderlyingBuffer());
+    memset(gpuTimestamps, 0, entriesCount * sizeof(GpuTimestamps));
+}
+
+SubmissionTimeline::~SubmissionTimeline() {
+    memoryManager.freeGraphicsMemory(gpuTimestampsAllocation);
+}
+
+uint64_t SubmissionTimeline::getHostTimeNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+uint32_t SubmissionTimeline::beginEntry(uint32_t taskCount) {
+    std::lock_guard<std::mutex> lock(mutex);
+    auto slot = static_cast<uint32_t>(entriesUsed % entriesCount);
+    entriesUsed++;
+
+    hostEntries[slot] = {};
+    hostEntries[slot].taskCount = taskCount;
+    hostEntries[slot].encodeStartNs = getHostTimeNs();
+    gpuTimestamps[slot] = {};
+    return slot;
+}
+
+void SubmissionTimeline::markEncodeComplete(uint32_t slot) {
+    std::lock_guard<std::mutex> lock(mutex);
+    hostEntries[slot].encodeCompleteNs = getHostTimeNs();
+}
+
+void SubmissionTimeline::markSubmitted(uint32_t slot) {
+    std::lock_guard<std::mutex> lock(mutex);
+    hostEntries[slot].submittedNs = getHostTimeNs();
+}
+
+uint64_t SubmissionTimeline::getGpuStartAddress(uint32_t slot) const {
+    return gpuTimestampsAllocation->getGpuAddress() + slot * sizeof(GpuTimestamps) + offsetof(GpuTimestamps, start);
+}
+
+uint64_t SubmissionTimeline::getGpuEndAddress(uint32_t slot) const {
+    return gpuTimestampsAllocation->getGpuAddress() + slot * sizeof(GpuTimestamps) + offsetof(GpuTimestamps, end);
+}
+
+// Entries are returned oldest first, GPU timestamps of submissions still in flight are 0
+std::vector<SubmissionTimeline::Entry> SubmissionTimeline::getTimeline() {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<Entry> timeline;
+    auto first = entriesUsed > entriesCount ? entriesUsed - entriesCount : 0u;
+    for (auto index = first; index < entriesUsed; index++) {
+        auto slot = static_cast<uint32_t>(index % entriesCount);
+        auto entry = hostEntries[slot];
+        entry.gpuStartTicks = gpuTimestamps[slot].start;
+        entry.gpuEndTicks = gpuTimestamps[slot].end;
+        timeline.push_back(entry);
+    }
+    return timeline;
+}
+
+} // namespace NEO
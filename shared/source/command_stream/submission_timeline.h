@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/common_types.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class GraphicsAllocation;
+class MemoryManager;
+
+// Ring of paired host and GPU timestamps of submissions. Host times are taken when flushTask starts encoding,
+// when encoding completes and when the batch buffer was handed over to the KMD. GPU global timestamps are
+// stored with MI_STORE_REGISTER_MEM at the start of the submission and in its epilogue.
+class SubmissionTimeline : NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t entriesCount = 256u;
+
+    struct GpuTimestamps {
+        uint64_t start;
+        uint64_t end;
+    };
+
+    struct Entry {
+        uint32_t taskCount = 0u;
+        uint64_t encodeStartNs = 0u;
+        uint64_t encodeCompleteNs = 0u;
+        uint64_t submittedNs = 0u;
+        uint64_t gpuStartTicks = 0u;
+        uint64_t gpuEndTicks = 0u;
+    };
+
+    static std::unique_ptr<SubmissionTimeline> create(MemoryManager &memoryManager, uint32_t rootDeviceIndex, DeviceBitfield deviceBitfield);
+
+    SubmissionTimeline(MemoryManager &memoryManager, GraphicsAllocation *gpuTimestampsAllocation);
+    ~SubmissionTimeline();
+
+    uint32_t beginEntry(uint32_t taskCount);
+    void markEncodeComplete(uint32_t slot);
+    void markSubmitted(uint32_t slot);
+
+    uint64_t getGpuStartAddress(uint32_t slot) const;
+    uint64_t getGpuEndAddress(uint32_t slot) const;
+    GraphicsAllocation *getGpuTimestampsAllocation() const { return gpuTimestampsAllocation; }
+
+    std::vector<Entry> getTimeline();
+
+  protected:
+    static uint64_t getHostTimeNs();
+
+    MemoryManager &memoryManager;
+    GraphicsAllocation *gpuTimestampsAllocation = nullptr;
+    GpuTimestamps *gpuTimestamps = nullptr;
+    std::array<Entry, entriesCount> hostEntries{};
+    uint64_t entriesUsed = 0u;
+    std::mutex mutex;
+};
+
+} // namespace NEO
@@ -50,6 +50,9 @@ struct BatchBuffer {
 
     bool useSingleSubdevice = false;
     bool ringBufferRestartRequest = false;
+
+    // task count and tag address pairs waited on by direct submission ring before starting this buffer
+    StackVec<std::pair<uint32_t, uint64_t>, 4> ringDependencies;
 };
 
 struct CommandBuffer : public IDNode<CommandBuffer> {
@@ -13,26 +13,97 @@
 #include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/os_interface/sys_calls_common.h"
 #include "shared/source/utilities/debug_settings_reader.h"
+#include "shared/source/utilities/directory.h"
 #include "shared/source/utilities/io_functions.h"
+#include "shared/source/utilities/performance_hints_log.h"
 
 #include "config.h"
 #include "os_inc.h"
 
+#include <algorithm>
+#include <cstdio>
 #include <cstring>
 #include <iomanip>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <sys/stat.h>
+#include <vector>
 
 namespace NEO {
-std::mutex CompilerCache::cacheAccessMtx;
+std::atomic<uint32_t> CompilerCache::tmpFileCounter{0u};
+
+// Hashes of large inputs can be memoized per input pointer and size, the recorded hash is reused only
+// when the beginning and the end of the input did not change
+FastHash::Digest CompilerCache::getInputDigest(ArrayRef<const char> input) {
+    if (DebugManager.flags.BinaryCacheMemoizeInputHash.get() != 1 || input.size() < minMemoizedInputSize) {
+        return FastHash::hash(input.begin(), input.size());
+    }
+
+    auto key = std::make_pair(input.begin(), input.size());
+    auto sampleDigest = getInputSampleDigest(input);
+    {
+        std::lock_guard<std::mutex> lock(memoizedInputDigestsMtx);
+        auto memoized = memoizedInputDigests.find(key);
+        if (memoized != memoizedInputDigests.end() && memoized->second.sampleDigest == sampleDigest) {
+            return memoized->second.digest;
+        }
+    }
+
+    auto digest = FastHash::hash(input.begin(), input.size());
+    std::lock_guard<std::mutex> lock(memoizedInputDigestsMtx);
+    if (memoizedInputDigests.size() >= maxMemoizedInputs) {
+        memoizedInputDigests.clear();
+    }
+    memoizedInputDigests[key] = {digest, sampleDigest};
+    return digest;
+}
+
+FastHash::Digest CompilerCache::getInputSampleDigest(ArrayRef<const char> input) {
+    auto sampleSize = std::min(input.size(), inputSampleSize);
+    FastHash hash;
+    hash.update(input.begin(), sampleSize);
+    hash.update(input.end() - sampleSize, sampleSize);
+    return hash.finish();
+}
+
+// Key of frontend compiler output, platform is not part of it so the entry is reused by builds for all devices
+const std::string CompilerCache::getCachedIntermediateFileName(const ArrayRef<const char> input, const ArrayRef<const char> options, const ArrayRef<const char> internalOptions,
+                                                               uint64_t intermediateCodeType, uint32_t apiVersion) {
+    FastHash hash;
+
+    auto inputDigest = getInputDigest(input);
+    hash.update("--ir--", 6);
+    hash.update(reinterpret_cast<const char *>(&inputDigest), sizeof(inputDigest));
+    hash.update("----", 4);
+    hash.update(&*options.begin(), options.size());
+    hash.update("----", 4);
+    hash.update(&*internalOptions.begin(), internalOptions.size());
+    hash.update("----", 4);
+    hash.update(reinterpret_cast<const char *>(&intermediateCodeType), sizeof(intermediateCodeType));
+    hash.update(reinterpret_cast<const char *>(&apiVersion), sizeof(apiVersion));
+
+    auto res = hash.finish();
+    std::stringstream stream;
+    stream << "ir_"
+           << std::setfill('0')
+           << std::hex
+           << std::setw(sizeof(res.high) * 2)
+           << res.high
+           << std::setw(sizeof(res.low) * 2)
+           << res.low;
+    return stream.str();
+}
+
 const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
                                                    const ArrayRef<const char> options, const ArrayRef<const char> internalOptions) {
-    Hash hash;
+    FastHash hash;
 
+    auto inputDigest = getInputDigest(input);
     hash.update("----", 4);
-    hash.update(&*input.begin(), input.size());
+    hash.update(reinterpret_cast<const char *>(&inputDigest), sizeof(inputDigest));
     hash.update("----", 4);
     hash.update(&*options.begin(), options.size());
     hash.update("----", 4);
@@ -51,14 +122,16 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
     auto res = hash.finish();
     std::stringstream stream;
     stream << std::setfill('0')
-           << std::setw(sizeof(res) * 2)
            << std::hex
-           << res;
+           << std::setw(sizeof(res.high) * 2)
+           << res.high
+           << std::setw(sizeof(res.low) * 2)
+           << res.low;
 
     if (DebugManager.flags.BinaryCacheTrace.get()) {
         std::string traceFilePath = config.cacheDir + PATH_SEPARATOR + stream.str() + ".trace";
         std::string inputFilePath = config.cacheDir + PATH_SEPARATOR + stream.str() + ".input";
-        std::lock_guard<std::mutex> lock(cacheAccessMtx);
+        std::lock_guard<std::mutex> lock(getIndexShard(stream.str()).mtx);
         auto fp = NEO::IoFunctions::fopenPtr(traceFilePath.c_str(), "w");
         if (fp) {
             NEO::IoFunctions::fprintf(fp, "---- input ----\n");
@@ -109,20 +182,221 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
 CompilerCache::CompilerCache(const CompilerCacheConfig &cacheConfig)
     : config(cacheConfig){};
 
+CompilerCache::~CompilerCache() {
+    auto hits = getHitsCount(CacheTier::Memory) + getHitsCount(CacheTier::Writable) + getHitsCount(CacheTier::ReadOnly);
+    if (hits + getMissesCount() == 0u) {
+        return;
+    }
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get(), stdout,
+                       "Compiler cache %s: memory hits %llu, writable tier hits %llu, read-only tier hits %llu, misses %llu\n",
+                       config.cacheDir.c_str(),
+                       static_cast<unsigned long long>(getHitsCount(CacheTier::Memory)),
+                       static_cast<unsigned long long>(getHitsCount(CacheTier::Writable)),
+                       static_cast<unsigned long long>(getHitsCount(CacheTier::ReadOnly)),
+                       static_cast<unsigned long long>(getMissesCount()));
+}
+
+CompilerCache::IndexShard &CompilerCache::getIndexShard(const std::string &kernelFileHash) {
+    return indexShards[std::hash<std::string>{}(kernelFileHash) % numIndexShards];
+}
+
+std::string CompilerCache::getCachedFilePath(const std::string &kernelFileHash) const {
+    return getCachedFilePath(config.cacheDir, kernelFileHash);
+}
+
+std::string CompilerCache::getCachedFilePath(const std::string &cacheDir, const std::string &kernelFileHash) const {
+    return cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
+}
+
+void CompilerCache::initializeIndex() {
+    struct FoundFile {
+        std::string hash;
+        size_t size;
+        time_t modificationTime;
+    };
+    std::vector<FoundFile> foundFiles;
+
+    const auto &extension = config.cacheFileExtension;
+    for (const auto &filePath : Directory::getFiles(config.cacheDir)) {
+        if (filePath.size() <= extension.size() || filePath.compare(filePath.size() - extension.size(), extension.size(), extension) != 0) {
+            continue;
+        }
+        struct stat fileStat = {};
+        if (stat(filePath.c_str(), &fileStat) != 0) {
+            continue;
+        }
+        auto nameBegin = filePath.find_last_of("/\\");
+        nameBegin = (nameBegin == std::string::npos) ? 0 : nameBegin + 1;
+        foundFiles.push_back({filePath.substr(nameBegin, filePath.size() - extension.size() - nameBegin), static_cast<size_t>(fileStat.st_size), fileStat.st_mtime});
+    }
+
+    std::sort(foundFiles.begin(), foundFiles.end(), [](const FoundFile &lhs, const FoundFile &rhs) { return lhs.modificationTime < rhs.modificationTime; });
+    for (const auto &foundFile : foundFiles) {
+        updateIndex(foundFile.hash, foundFile.size);
+    }
+}
+
+void CompilerCache::updateIndex(const std::string &kernelFileHash, size_t size) {
+    auto &shard = getIndexShard(kernelFileHash);
+    std::lock_guard<std::mutex> lock(shard.mtx);
+    auto &entry = shard.entries[kernelFileHash];
+    indexedSize += size;
+    indexedSize -= entry.size;
+    entry.size = size;
+    entry.lastAccess = ++accessClock;
+}
+
+void CompilerCache::evictIfNeeded(const std::string &protectedHash) {
+    if (indexedSize <= config.cacheSize) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> evictionLock(evictionMtx);
+    std::vector<std::pair<uint64_t, std::string>> candidates;
+    for (auto &shard : indexShards) {
+        std::lock_guard<std::mutex> lock(shard.mtx);
+        for (const auto &entry : shard.entries) {
+            if (entry.first != protectedHash) {
+                candidates.emplace_back(entry.second.lastAccess, entry.first);
+            }
+        }
+    }
+    std::sort(candidates.begin(), candidates.end());
+
+    for (const auto &candidate : candidates) {
+        if (indexedSize <= config.cacheSize) {
+            break;
+        }
+        auto &shard = getIndexShard(candidate.second);
+        std::lock_guard<std::mutex> lock(shard.mtx);
+        auto entry = shard.entries.find(candidate.second);
+        if (entry == shard.entries.end() || entry->second.lastAccess != candidate.first) {
+            continue;
+        }
+        std::remove(getCachedFilePath(candidate.second).c_str());
+        indexedSize -= entry->second.size;
+        shard.entries.erase(entry);
+    }
+}
+
+CompilerCache::MemoryCache &CompilerCache::getMemoryCache() {
+    static MemoryCache memoryCache;
+    return memoryCache;
+}
+
+size_t CompilerCache::getMemoryCacheCapacity() {
+    auto capacityInMb = DebugManager.flags.BinaryCacheInMemorySize.get();
+    return capacityInMb > 0 ? static_cast<size_t>(capacityInMb) * 1024u * 1024u : 0u;
+}
+
+bool CompilerCache::isMemoryCacheEnabled() {
+    return getMemoryCacheCapacity() > 0u;
+}
+
+void CompilerCache::storeInMemoryCache(const std::string &kernelFileHash, const char *pBinary, size_t binarySize) {
+    auto capacity = getMemoryCacheCapacity();
+    if (pBinary == nullptr || binarySize == 0u || binarySize > capacity) {
+        return;
+    }
+
+    auto &memoryCache = getMemoryCache();
+    std::lock_guard<std::mutex> lock(memoryCache.mtx);
+    if (memoryCache.entries.find(kernelFileHash) != memoryCache.entries.end()) {
+        return;
+    }
+    while (memoryCache.usedSize + binarySize > capacity) {
+        auto &leastRecentlyUsed = memoryCache.lru.back();
+        memoryCache.usedSize -= memoryCache.entries[leastRecentlyUsed].size;
+        memoryCache.entries.erase(leastRecentlyUsed);
+        memoryCache.lru.pop_back();
+    }
+
+    memoryCache.lru.push_front(kernelFileHash);
+    auto &entry = memoryCache.entries[kernelFileHash];
+    entry.binary = std::make_unique<char[]>(binarySize);
+    memcpy(entry.binary.get(), pBinary, binarySize);
+    entry.size = binarySize;
+    entry.lruPosition = memoryCache.lru.begin();
+    memoryCache.usedSize += binarySize;
+}
+
+std::unique_ptr<char[]> CompilerCache::loadFromMemoryCache(const std::string &kernelFileHash, size_t &cachedBinarySize) {
+    if (!isMemoryCacheEnabled()) {
+        return nullptr;
+    }
+
+    auto &memoryCache = getMemoryCache();
+    std::lock_guard<std::mutex> lock(memoryCache.mtx);
+    auto entry = memoryCache.entries.find(kernelFileHash);
+    if (entry == memoryCache.entries.end()) {
+        return nullptr;
+    }
+    memoryCache.lru.splice(memoryCache.lru.begin(), memoryCache.lru, entry->second.lruPosition);
+
+    auto binary = std::make_unique<char[]>(entry->second.size);
+    memcpy(binary.get(), entry->second.binary.get(), entry->second.size);
+    cachedBinarySize = entry->second.size;
+    return binary;
+}
+
 bool CompilerCache::cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) {
     if (pBinary == nullptr || binarySize == 0) {
         return false;
     }
-    std::string filePath = config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
-    std::lock_guard<std::mutex> lock(cacheAccessMtx);
-    return 0 != writeDataToFile(filePath.c_str(), pBinary, binarySize);
+    storeInMemoryCache(kernelFileHash, pBinary, binarySize);
+
+    if (config.cacheSize > 0u) {
+        std::call_once(indexInitialized, [this]() { initializeIndex(); });
+    }
+
+    std::string filePath = getCachedFilePath(kernelFileHash);
+    std::string tmpFilePath = filePath + "." + std::to_string(SysCalls::getProcessId()) + "." + std::to_string(tmpFileCounter++) + ".tmp";
+    if (0 == writeDataToFile(tmpFilePath.c_str(), pBinary, binarySize)) {
+        return false;
+    }
+
+    // publish atomically, readers in other processes see either nothing or complete binary
+    if (0 != std::rename(tmpFilePath.c_str(), filePath.c_str())) {
+        std::remove(tmpFilePath.c_str());
+        if (!fileExists(filePath)) {
+            return false;
+        }
+    }
+
+    if (config.cacheSize > 0u) {
+        updateIndex(kernelFileHash, binarySize);
+        evictIfNeeded(kernelFileHash);
+    }
+    return true;
 }
 
 std::unique_ptr<char[]> CompilerCache::loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize) {
-    std::string filePath = config.cacheDir + PATH_SEPARATOR + kernelFileHash + config.cacheFileExtension;
+    auto binary = loadFromMemoryCache(kernelFileHash, cachedBinarySize);
+    if (binary) {
+        hitsCount[static_cast<size_t>(CacheTier::Memory)]++;
+        return binary;
+    }
 
-    std::lock_guard<std::mutex> lock(cacheAccessMtx);
-    return loadDataFromFile(filePath.c_str(), cachedBinarySize);
+    auto tier = CacheTier::Writable;
+    binary = loadDataFromFile(getCachedFilePath(kernelFileHash).c_str(), cachedBinarySize);
+    if (!binary && !config.readOnlyCacheDir.empty()) {
+        tier = CacheTier::ReadOnly;
+        binary = loadDataFromFile(getCachedFilePath(config.readOnlyCacheDir, kernelFileHash).c_str(), cachedBinarySize);
+    }
+    if (!binary) {
+        missesCount++;
+        PERFORMANCE_HINT(PerformanceHintId::CompilerCacheMiss, missesCount);
+        return binary;
+    }
+    hitsCount[static_cast<size_t>(tier)]++;
+
+    storeInMemoryCache(kernelFileHash, binary.get(), cachedBinarySize);
+    // read-only tier is not indexed, its binaries are never evicted
+    if (tier == CacheTier::Writable && config.cacheSize > 0u) {
+        std::call_once(indexInitialized, [this]() { initializeIndex(); });
+        updateIndex(kernelFileHash, cachedBinarySize);
+    }
+    return binary;
 }
 
 } // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,27 +7,47 @@
 
 #pragma once
 
+#include "shared/source/helpers/hash.h"
 #include "shared/source/utilities/arrayref.h"
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <list>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 
 namespace NEO {
 struct HardwareInfo;
 
 struct CompilerCacheConfig {
     bool enabled = true;
+    size_t cacheSize = 0u; // 0 - no limit
     std::string cacheFileExtension;
     std::string cacheDir;
+    std::string readOnlyCacheDir; // optional shared tier consulted after cacheDir, binaries are never written to it
 };
 
 class CompilerCache {
   public:
+    static constexpr size_t numIndexShards = 16u;
+    static constexpr size_t minMemoizedInputSize = 64u * 1024u;
+    static constexpr size_t inputSampleSize = 4096u;
+    static constexpr size_t maxMemoizedInputs = 256u;
+
+    enum class CacheTier : uint32_t {
+        Memory = 0u,
+        Writable,
+        ReadOnly,
+        Count
+    };
+
     CompilerCache(const CompilerCacheConfig &config);
-    virtual ~CompilerCache() = default;
+    virtual ~CompilerCache();
 
     CompilerCache(const CompilerCache &) = delete;
     CompilerCache(CompilerCache &&) = delete;
@@ -36,12 +56,73 @@ class CompilerCache {
 
     const std::string getCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
                                         ArrayRef<const char> options, ArrayRef<const char> internalOptions);
+    const std::string getCachedIntermediateFileName(ArrayRef<const char> input, ArrayRef<const char> options, ArrayRef<const char> internalOptions,
+                                                    uint64_t intermediateCodeType, uint32_t apiVersion);
 
     MOCKABLE_VIRTUAL bool cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize);
     MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize);
 
+    static bool isMemoryCacheEnabled();
+    static void storeInMemoryCache(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
+    static std::unique_ptr<char[]> loadFromMemoryCache(const std::string &kernelFileHash, size_t &cachedBinarySize);
+
+    uint64_t getHitsCount(CacheTier tier) const { return hitsCount[static_cast<size_t>(tier)]; }
+    uint64_t getMissesCount() const { return missesCount; }
+
   protected:
-    static std::mutex cacheAccessMtx;
+    struct IndexEntry {
+        size_t size = 0u;
+        uint64_t lastAccess = 0u;
+    };
+
+    struct IndexShard {
+        std::mutex mtx;
+        std::unordered_map<std::string, IndexEntry> entries;
+    };
+
+    struct MemoryCacheEntry {
+        std::unique_ptr<char[]> binary;
+        size_t size = 0u;
+        std::list<std::string>::iterator lruPosition;
+    };
+
+    // Process wide LRU of device binaries shared by compiler caches of all root devices,
+    // cache keys contain platform so binaries are reused only by devices of the same family
+    struct MemoryCache {
+        std::mutex mtx;
+        std::list<std::string> lru;
+        std::unordered_map<std::string, MemoryCacheEntry> entries;
+        size_t usedSize = 0u;
+    };
+
+    static MemoryCache &getMemoryCache();
+    static size_t getMemoryCacheCapacity();
+
+    struct MemoizedInputDigest {
+        FastHash::Digest digest;
+        FastHash::Digest sampleDigest;
+    };
+
+    FastHash::Digest getInputDigest(ArrayRef<const char> input);
+    static FastHash::Digest getInputSampleDigest(ArrayRef<const char> input);
+    IndexShard &getIndexShard(const std::string &kernelFileHash);
+    std::string getCachedFilePath(const std::string &kernelFileHash) const;
+    std::string getCachedFilePath(const std::string &cacheDir, const std::string &kernelFileHash) const;
+    MOCKABLE_VIRTUAL void initializeIndex();
+    void updateIndex(const std::string &kernelFileHash, size_t size);
+    MOCKABLE_VIRTUAL void evictIfNeeded(const std::string &protectedHash);
+
+    static std::atomic<uint32_t> tmpFileCounter;
+
     CompilerCacheConfig config;
+    std::array<IndexShard, numIndexShards> indexShards;
+    std::atomic<size_t> indexedSize{0u};
+    std::atomic<uint64_t> accessClock{0u};
+    std::once_flag indexInitialized;
+    std::mutex evictionMtx;
+    std::mutex memoizedInputDigestsMtx;
+    std::map<std::pair<const char *, size_t>, MemoizedInputDigest> memoizedInputDigests;
+    std::array<std::atomic<uint64_t>, static_cast<size_t>(CacheTier::Count)> hitsCount{};
+    std::atomic<uint64_t> missesCount{0u};
 };
 } // namespace NEO
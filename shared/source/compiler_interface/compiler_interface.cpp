@@ -56,7 +56,12 @@ TranslationOutput::ErrorCode CompilerInterface::build(
 
     CachingMode cachingMode = None;
 
-    if (input.allowCaching) {
+    // builds not allowed to use the binary cache can still reuse binaries built earlier in this process,
+    // cache key doesn't cover specialization constants, debug data and instrumentation
+    bool memoryCachingOnly = !input.allowCaching && CompilerCache::isMemoryCacheEnabled() && input.specializedValues.empty() &&
+                             input.GTPinInput == nullptr && device.getDebugger() == nullptr;
+
+    if (input.allowCaching || memoryCachingOnly) {
         if ((srcCodeType == IGC::CodeType::oclC) && (std::strstr(input.src.begin(), "#include") == nullptr)) {
             cachingMode = CachingMode::Direct;
         } else {
@@ -70,7 +75,8 @@ TranslationOutput::ErrorCode CompilerInterface::build(
                                                   input.src,
                                                   input.apiOptions,
                                                   input.internalOptions);
-        output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
+        output.deviceBinary.mem = memoryCachingOnly ? CompilerCache::loadFromMemoryCache(kernelFileHash, output.deviceBinary.size)
+                                                    : cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
         if (output.deviceBinary.mem) {
             return TranslationOutput::ErrorCode::Success;
         }
@@ -94,25 +100,43 @@ TranslationOutput::ErrorCode CompilerInterface::build(
             intermediateCodeType = getPreferredIntermediateRepresentation(device);
         }
 
-        auto fclTranslationCtx = createFclTranslationCtx(device, srcCodeType, intermediateCodeType);
-        auto fclOutput = translate(fclTranslationCtx.get(), inSrc.get(),
-                                   fclOptions.get(), fclInternalOptions.get());
-
-        if (fclOutput == nullptr) {
-            return TranslationOutput::ErrorCode::UnknownError;
+        // frontend output doesn't depend on device binary, it's shared by builds of the same source for all devices;
+        // sources with includes are not cached, included files are not part of the key
+        std::string irFileHash;
+        if (input.allowCaching && (cachingMode == CachingMode::Direct) && (DebugManager.flags.BinaryCacheIntermediateRepresentation.get() == 1)) {
+            irFileHash = cache->getCachedIntermediateFileName(input.src, input.apiOptions, input.internalOptions, intermediateCodeType,
+                                                              device.getHardwareInfo().capabilityTable.clVersionSupport);
+            output.intermediateRepresentation.mem = cache->loadCachedBinary(irFileHash, output.intermediateRepresentation.size);
         }
 
-        TranslationOutput::makeCopy(output.frontendCompilerLog, fclOutput->GetBuildLog());
+        if (output.intermediateRepresentation.mem) {
+            output.intermediateCodeType = intermediateCodeType;
+            intermediateRepresentation = CIF::Builtins::CreateConstBuffer(igcMain.get(), output.intermediateRepresentation.mem.get(), output.intermediateRepresentation.size);
+        } else {
+            auto fclTranslationCtx = createFclTranslationCtx(device, srcCodeType, intermediateCodeType);
+            auto fclOutput = translate(fclTranslationCtx.get(), inSrc.get(),
+                                       fclOptions.get(), fclInternalOptions.get());
 
-        if (fclOutput->Successful() == false) {
-            return TranslationOutput::ErrorCode::BuildFailure;
-        }
+            if (fclOutput == nullptr) {
+                return TranslationOutput::ErrorCode::UnknownError;
+            }
+
+            TranslationOutput::makeCopy(output.frontendCompilerLog, fclOutput->GetBuildLog());
+
+            if (fclOutput->Successful() == false) {
+                return TranslationOutput::ErrorCode::BuildFailure;
+            }
 
-        output.intermediateCodeType = intermediateCodeType;
-        TranslationOutput::makeCopy(output.intermediateRepresentation, fclOutput->GetOutput());
+            output.intermediateCodeType = intermediateCodeType;
+            TranslationOutput::makeCopy(output.intermediateRepresentation, fclOutput->GetOutput());
 
-        fclOutput->GetOutput()->Retain(); // will be used as input to compiler
-        intermediateRepresentation.reset(fclOutput->GetOutput());
+            if (!irFileHash.empty()) {
+                cache->cacheBinary(irFileHash, fclOutput->GetOutput()->GetMemory<char>(), static_cast<uint32_t>(fclOutput->GetOutput()->GetSize<char>()));
+            }
+
+            fclOutput->GetOutput()->Retain(); // will be used as input to compiler
+            intermediateRepresentation.reset(fclOutput->GetOutput());
+        }
     } else {
         inSrc->Retain(); // will be used as input to compiler directly
         intermediateRepresentation.reset(inSrc.get());
@@ -123,7 +147,8 @@ TranslationOutput::ErrorCode CompilerInterface::build(
         kernelFileHash = cache->getCachedFileName(device.getHardwareInfo(), ArrayRef<const char>(intermediateRepresentation->GetMemory<char>(), intermediateRepresentation->GetSize<char>()),
                                                   input.apiOptions,
                                                   input.internalOptions);
-        output.deviceBinary.mem = cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
+        output.deviceBinary.mem = memoryCachingOnly ? CompilerCache::loadFromMemoryCache(kernelFileHash, output.deviceBinary.size)
+                                                    : cache->loadCachedBinary(kernelFileHash, output.deviceBinary.size);
         if (output.deviceBinary.mem) {
             return TranslationOutput::ErrorCode::Success;
         }
@@ -146,6 +171,8 @@ TranslationOutput::ErrorCode CompilerInterface::build(
 
     if (input.allowCaching) {
         cache->cacheBinary(kernelFileHash, igcOutput->GetOutput()->GetMemory<char>(), static_cast<uint32_t>(igcOutput->GetOutput()->GetSize<char>()));
+    } else if (memoryCachingOnly) {
+        CompilerCache::storeInMemoryCache(kernelFileHash, igcOutput->GetOutput()->GetMemory<char>(), igcOutput->GetOutput()->GetSize<char>());
     }
 
     TranslationOutput::makeCopy(output.deviceBinary, igcOutput->GetOutput());
@@ -303,6 +330,23 @@ TranslationOutput::ErrorCode CompilerInterface::createLibrary(
 
 TranslationOutput::ErrorCode CompilerInterface::getSipKernelBinary(NEO::Device &device, SipKernelType type, std::vector<char> &retBinary,
                                                                    std::vector<char> &stateSaveAreaHeader) {
+    std::string sipKernelHash;
+    const bool useCache = (cache != nullptr) && (DebugManager.flags.EnableBuiltinBinaryCache.get() == 1);
+    if (useCache) {
+        const std::string sipKernelName = "sip_kernel_" + std::to_string(static_cast<uint32_t>(type));
+        sipKernelHash = cache->getCachedFileName(device.getHardwareInfo(), ArrayRef<const char>(sipKernelName.c_str(), sipKernelName.size()),
+                                                 ArrayRef<const char>(), ArrayRef<const char>());
+        size_t cachedSipSize = 0u;
+        auto cachedSip = cache->loadCachedBinary(sipKernelHash, cachedSipSize);
+        if (cachedSip) {
+            size_t cachedHeaderSize = 0u;
+            auto cachedHeader = cache->loadCachedBinary(sipKernelHash + "_header", cachedHeaderSize);
+            retBinary.assign(cachedSip.get(), cachedSip.get() + cachedSipSize);
+            stateSaveAreaHeader.assign(cachedHeader.get(), cachedHeader.get() + cachedHeaderSize);
+            return TranslationOutput::ErrorCode::Success;
+        }
+    }
+
     if (false == isIgcAvailable()) {
         return TranslationOutput::ErrorCode::CompilerNotAvailable;
     }
@@ -348,6 +392,12 @@ TranslationOutput::ErrorCode CompilerInterface::getSipKernelBinary(NEO::Device &
     retBinary.assign(systemRoutineBuffer->GetMemory<char>(), systemRoutineBuffer->GetMemory<char>() + systemRoutineBuffer->GetSizeRaw());
     stateSaveAreaHeader.assign(stateSaveAreaBuffer->GetMemory<char>(), stateSaveAreaBuffer->GetMemory<char>() + stateSaveAreaBuffer->GetSizeRaw());
 
+    if (useCache) {
+        // header is published first, binary presence marks complete entry
+        cache->cacheBinary(sipKernelHash + "_header", stateSaveAreaHeader.data(), static_cast<uint32_t>(stateSaveAreaHeader.size()));
+        cache->cacheBinary(sipKernelHash, retBinary.data(), static_cast<uint32_t>(retBinary.size()));
+    }
+
     return TranslationOutput::ErrorCode::Success;
 }
 
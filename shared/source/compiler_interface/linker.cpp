@@ -9,6 +9,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/compiler_interface/linker.inl"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/elf/zebin_elf.h"
 #include "shared/source/helpers/blit_commands_helper.h"
@@ -23,7 +24,10 @@
 
 #include "RelocationInfo.h"
 
+#include <algorithm>
+#include <atomic>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 
 namespace NEO {
@@ -118,6 +122,7 @@ bool LinkerInput::decodeRelocationTable(const void *data, uint32_t numEntries, u
         RelocationInfo relocInfo{};
         relocInfo.offset = relocEntryIt->r_offset;
         relocInfo.symbolName = relocEntryIt->r_symbol;
+        relocInfo.symbolId = internSymbolName(relocInfo.symbolName);
         relocInfo.relocationSegment = SegmentType::Instructions;
         switch (relocEntryIt->r_type) {
         default:
@@ -160,10 +165,22 @@ void LinkerInput::addElfTextSegmentRelocation(RelocationInfo relocationInfo, uin
     auto &outRelocInfo = textRelocations[instructionsSegmentId];
 
     relocationInfo.relocationSegment = SegmentType::Instructions;
+    relocationInfo.symbolId = internSymbolName(relocationInfo.symbolName);
 
     outRelocInfo.push_back(std::move(relocationInfo));
 }
 
+uint32_t LinkerInput::internSymbolName(const std::string &symbolName) {
+    auto symbolIt = symbolNameToId.find(symbolName);
+    if (symbolIt != symbolNameToId.end()) {
+        return symbolIt->second;
+    }
+    auto symbolId = static_cast<uint32_t>(internedSymbolNames.size());
+    internedSymbolNames.push_back(symbolName);
+    symbolNameToId.emplace(symbolName, symbolId);
+    return symbolId;
+}
+
 template void LinkerInput::decodeElfSymbolTableAndRelocations<Elf::EI_CLASS_32>(Elf::Elf<Elf::EI_CLASS_32> &elf, const SectionNameToSegmentIdMap &nameToSegmentId);
 template void LinkerInput::decodeElfSymbolTableAndRelocations<Elf::EI_CLASS_64>(Elf::Elf<Elf::EI_CLASS_64> &elf, const SectionNameToSegmentIdMap &nameToSegmentId);
 template <Elf::ELF_IDENTIFIER_CLASS numBits>
@@ -339,57 +356,121 @@ void Linker::patchAddress(void *relocAddress, const uint64_t value, const Linker
     }
 }
 
-void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &instructionsSegments, std::vector<UnresolvedExternal> &outUnresolvedExternals, const KernelDescriptorsT &kernelDescriptors) {
-    if (false == data.getTraits().requiresPatchingOfInstructionSegments) {
-        return;
+Linker::ResolvedSymbol Linker::resolveSymbol(const std::string &symbolName) const {
+    ResolvedSymbol resolvedSymbol;
+    resolvedSymbol.isImplicitArgs = (symbolName == implicitArgsRelocationSymbolName);
+    auto symbolIt = relocatedSymbols.find(symbolName);
+    if (symbolIt != relocatedSymbols.end()) {
+        resolvedSymbol.symbol = &symbolIt->second;
     }
-    UNRECOVERABLE_IF(data.getRelocationsInInstructionSegments().size() > instructionsSegments.size());
-    auto segIt = instructionsSegments.begin();
-    uint32_t segId = 0u;
-    for (auto relocsIt = data.getRelocationsInInstructionSegments().begin(), relocsEnd = data.getRelocationsInInstructionSegments().end();
-         relocsIt != relocsEnd; ++relocsIt, ++segIt, ++segId) {
-        auto &thisSegmentRelocs = *relocsIt;
-        const PatchableSegment &instSeg = *segIt;
-        for (const auto &relocation : thisSegmentRelocs) {
-            UNRECOVERABLE_IF(nullptr == instSeg.hostPointer);
-            bool invalidOffset = relocation.offset + addressSizeInBytes(relocation.type) > instSeg.segmentSize;
-            DEBUG_BREAK_IF(invalidOffset);
-
-            auto relocAddress = ptrOffset(instSeg.hostPointer, static_cast<uintptr_t>(relocation.offset));
-            if (relocation.type == LinkerInput::RelocationInfo::Type::PerThreadPayloadOffset) {
-                *reinterpret_cast<uint32_t *>(relocAddress) = kernelDescriptors.at(segId)->kernelAttributes.crossThreadDataSize;
-                continue;
-            };
-            if (relocation.symbolName == implicitArgsRelocationSymbolName) {
-                if (pImplicitArgsRelocationAddresses.find(segId) == pImplicitArgsRelocationAddresses.end()) {
-                    pImplicitArgsRelocationAddresses.insert({segId, {}});
-                }
-                pImplicitArgsRelocationAddresses[segId].push_back(reinterpret_cast<uint32_t *>(relocAddress));
-                continue;
-            }
-            auto symbolIt = relocatedSymbols.find(relocation.symbolName);
-            if (symbolIt == relocatedSymbols.end()) {
-                auto localSymbolIt = localRelocatedSymbols.find(relocation.symbolName);
-                if (localRelocatedSymbols.end() != localSymbolIt) {
-                    if (localSymbolIt->first == kernelDescriptors[segId]->kernelMetadata.kernelName) {
-                        uint64_t patchValue = localSymbolIt->second.gpuAddress + relocation.addend;
-                        patchAddress(relocAddress, patchValue, relocation);
-                        continue;
-                    }
-                } else if (relocation.symbolName.empty()) {
-                    uint64_t patchValue = 0;
+    auto localSymbolIt = localRelocatedSymbols.find(symbolName);
+    if (localSymbolIt != localRelocatedSymbols.end()) {
+        resolvedSymbol.localSymbol = &localSymbolIt->second;
+    }
+    return resolvedSymbol;
+}
+
+uint32_t Linker::getRelocationThreadsCount(size_t segmentsCount, size_t relocationsCount) const {
+    if (DebugManager.flags.LinkerRelocationThreads.get() != -1) {
+        return static_cast<uint32_t>(std::max(size_t{1u}, std::min(static_cast<size_t>(DebugManager.flags.LinkerRelocationThreads.get()), segmentsCount)));
+    }
+    if (relocationsCount < minRelocationsForParallelPatching) {
+        return 1u;
+    }
+    size_t threadsCount = std::min({static_cast<size_t>(std::thread::hardware_concurrency()), segmentsCount, static_cast<size_t>(maxRelocationThreads)});
+    return static_cast<uint32_t>(std::max(size_t{1u}, threadsCount));
+}
+
+void Linker::patchInstructionsSegment(uint32_t segId, const PatchableSegment &instSeg, const std::vector<ResolvedSymbol> &resolvedSymbols,
+                                      const KernelDescriptorsT &kernelDescriptors, PatchedInstructionsSegment &outPatchedSegment) const {
+    for (const auto &relocation : data.getRelocationsInInstructionSegments()[segId]) {
+        UNRECOVERABLE_IF(nullptr == instSeg.hostPointer);
+        bool invalidOffset = relocation.offset + addressSizeInBytes(relocation.type) > instSeg.segmentSize;
+        DEBUG_BREAK_IF(invalidOffset);
+
+        auto relocAddress = ptrOffset(instSeg.hostPointer, static_cast<uintptr_t>(relocation.offset));
+        if (relocation.type == LinkerInput::RelocationInfo::Type::PerThreadPayloadOffset) {
+            *reinterpret_cast<uint32_t *>(relocAddress) = kernelDescriptors.at(segId)->kernelAttributes.crossThreadDataSize;
+            continue;
+        };
+        auto resolvedSymbol = (relocation.symbolId < resolvedSymbols.size()) ? resolvedSymbols[relocation.symbolId]
+                                                                              : resolveSymbol(relocation.symbolName);
+        if (resolvedSymbol.isImplicitArgs) {
+            outPatchedSegment.implicitArgsRelocationAddresses.push_back(reinterpret_cast<uint32_t *>(relocAddress));
+            continue;
+        }
+        if (nullptr == resolvedSymbol.symbol) {
+            if (nullptr != resolvedSymbol.localSymbol) {
+                if (relocation.symbolName == kernelDescriptors[segId]->kernelMetadata.kernelName) {
+                    uint64_t patchValue = resolvedSymbol.localSymbol->gpuAddress + relocation.addend;
                     patchAddress(relocAddress, patchValue, relocation);
                     continue;
                 }
-            }
-            bool unresolvedExternal = (symbolIt == relocatedSymbols.end());
-            if (invalidOffset || unresolvedExternal) {
-                uint32_t segId = static_cast<uint32_t>(segIt - instructionsSegments.begin());
-                outUnresolvedExternals.push_back(UnresolvedExternal{relocation, segId, invalidOffset});
+            } else if (relocation.symbolName.empty()) {
+                uint64_t patchValue = 0;
+                patchAddress(relocAddress, patchValue, relocation);
                 continue;
             }
-            uint64_t patchValue = symbolIt->second.gpuAddress + relocation.addend;
-            patchAddress(relocAddress, patchValue, relocation);
+        }
+        bool unresolvedExternal = (nullptr == resolvedSymbol.symbol);
+        if (invalidOffset || unresolvedExternal) {
+            outPatchedSegment.unresolvedExternals.push_back(UnresolvedExternal{relocation, segId, invalidOffset});
+            continue;
+        }
+        uint64_t patchValue = resolvedSymbol.symbol->gpuAddress + relocation.addend;
+        patchAddress(relocAddress, patchValue, relocation);
+    }
+}
+
+void Linker::patchInstructionsSegments(const std::vector<PatchableSegment> &instructionsSegments, std::vector<UnresolvedExternal> &outUnresolvedExternals, const KernelDescriptorsT &kernelDescriptors) {
+    if (false == data.getTraits().requiresPatchingOfInstructionSegments) {
+        return;
+    }
+    const auto &relocationsPerSegment = data.getRelocationsInInstructionSegments();
+    UNRECOVERABLE_IF(relocationsPerSegment.size() > instructionsSegments.size());
+
+    // every distinct symbol is looked up once, relocations refer to it by id interned in linker input
+    const auto &internedSymbolNames = data.getInternedSymbolNames();
+    std::vector<ResolvedSymbol> resolvedSymbols;
+    resolvedSymbols.reserve(internedSymbolNames.size());
+    for (const auto &symbolName : internedSymbolNames) {
+        resolvedSymbols.push_back(resolveSymbol(symbolName));
+    }
+
+    size_t relocationsCount = 0u;
+    for (const auto &segmentRelocations : relocationsPerSegment) {
+        relocationsCount += segmentRelocations.size();
+    }
+
+    auto segmentsCount = relocationsPerSegment.size();
+    std::vector<PatchedInstructionsSegment> patchedSegments(segmentsCount);
+    std::atomic<size_t> nextSegment{0u};
+    auto patchRemainingSegments = [&]() {
+        for (auto segId = nextSegment++; segId < segmentsCount; segId = nextSegment++) {
+            patchInstructionsSegment(static_cast<uint32_t>(segId), instructionsSegments[segId], resolvedSymbols, kernelDescriptors, patchedSegments[segId]);
+        }
+    };
+
+    // segments are patched independently, each one writes only to its own host storage
+    auto threadsCount = getRelocationThreadsCount(segmentsCount, relocationsCount);
+    std::vector<std::thread> workers;
+    workers.reserve(threadsCount - 1);
+    for (uint32_t i = 1u; i < threadsCount; i++) {
+        workers.emplace_back(patchRemainingSegments);
+    }
+    patchRemainingSegments();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    for (uint32_t segId = 0u; segId < segmentsCount; segId++) {
+        auto &patchedSegment = patchedSegments[segId];
+        outUnresolvedExternals.insert(outUnresolvedExternals.end(), patchedSegment.unresolvedExternals.begin(), patchedSegment.unresolvedExternals.end());
+        if (false == patchedSegment.implicitArgsRelocationAddresses.empty()) {
+            auto &implicitArgsAddresses = pImplicitArgsRelocationAddresses[segId];
+            for (auto address : patchedSegment.implicitArgsRelocationAddresses) {
+                implicitArgsAddresses.push_back(address);
+            }
         }
     }
 }
@@ -93,11 +93,14 @@ struct LinkerInput {
             RelocTypeMax
         };
 
+        static constexpr uint32_t invalidSymbolId = std::numeric_limits<uint32_t>::max();
+
         std::string symbolName;
         uint64_t offset = std::numeric_limits<uint64_t>::max();
         Type type = Type::Unknown;
         SegmentType relocationSegment = SegmentType::Unknown;
         int64_t addend = 0U;
+        uint32_t symbolId = invalidSymbolId;
     };
 
     using SectionNameToSegmentIdMap = std::unordered_map<std::string, uint32_t>;
@@ -148,6 +151,10 @@ struct LinkerInput {
         return dataRelocations;
     }
 
+    const std::vector<std::string> &getInternedSymbolNames() const {
+        return internedSymbolNames;
+    }
+
     void setPointerSize(Traits::PointerSize pointerSize) {
         traits.pointerSize = pointerSize;
     }
@@ -166,12 +173,15 @@ struct LinkerInput {
 
   protected:
     void parseRelocationForExtFuncUsage(const RelocationInfo &relocInfo, const std::string &kernelName);
+    uint32_t internSymbolName(const std::string &symbolName);
 
     Traits traits;
     SymbolMap symbols;
     LocalSymbolMap localSymbols;
     RelocationsPerInstSegment textRelocations;
     Relocations dataRelocations;
+    std::vector<std::string> internedSymbolNames;
+    std::unordered_map<std::string, uint32_t> symbolNameToId;
     std::vector<std::pair<std::string, SymbolInfo>> extFuncSymbols;
     int32_t exportedFunctionsSegmentId = -1;
     std::vector<ExternalFunctionUsageKernel> kernelDependencies;
@@ -254,10 +264,29 @@ struct Linker {
                                           const SegmentInfo &constData);
 
   protected:
+    struct ResolvedSymbol {
+        const RelocatedSymbol<SymbolInfo> *symbol = nullptr;
+        const RelocatedSymbol<LocalFuncSymbolInfo> *localSymbol = nullptr;
+        bool isImplicitArgs = false;
+    };
+
+    struct PatchedInstructionsSegment {
+        UnresolvedExternals unresolvedExternals;
+        StackVec<uint32_t *, 2> implicitArgsRelocationAddresses;
+    };
+
+    static constexpr size_t minRelocationsForParallelPatching = 4096u;
+    static constexpr uint32_t maxRelocationThreads = 8u;
+
     const LinkerInput &data;
     RelocatedSymbolsMap relocatedSymbols;
     LocalsRelocatedSymbolsMap localRelocatedSymbols;
 
+    ResolvedSymbol resolveSymbol(const std::string &symbolName) const;
+    uint32_t getRelocationThreadsCount(size_t segmentsCount, size_t relocationsCount) const;
+    void patchInstructionsSegment(uint32_t segId, const PatchableSegment &instSeg, const std::vector<ResolvedSymbol> &resolvedSymbols,
+                                  const KernelDescriptorsT &kernelDescriptors, PatchedInstructionsSegment &outPatchedSegment) const;
+
     bool processRelocations(const SegmentInfo &globalVariables, const SegmentInfo &globalConstants, const SegmentInfo &exportedFunctions, const SegmentInfo &globalStrings, const PatchableSegments &instructionsSegments);
 
     void patchInstructionsSegments(const std::vector<PatchableSegment> &instructionsSegments, std::vector<UnresolvedExternal> &outUnresolvedExternals, const KernelDescriptorsT &kernelDescriptors);
@@ -94,6 +94,8 @@ void DebugSettingsManager<DebugLevel>::dumpFlags() const {
 
 template <DebugFunctionalityLevel DebugLevel>
 void DebugSettingsManager<DebugLevel>::injectSettingsFromReader() {
+    readerImpl->prefetchSettings();
+
 #undef DECLARE_DEBUG_VARIABLE
 #define DECLARE_DEBUG_VARIABLE(dataType, variableName, defaultValue, description)                                  \
     {                                                                                                              \
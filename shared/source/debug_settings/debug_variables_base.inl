@@ -47,6 +47,13 @@ DECLARE_DEBUG_VARIABLE(bool, EnableDebugBreak, true, "Enable DEBUG_BREAKs")
 DECLARE_DEBUG_VARIABLE(bool, FlushAllCaches, false, "pipe controls between enqueues flush all possible caches")
 DECLARE_DEBUG_VARIABLE(bool, DoNotFlushCaches, false, "clear all possible cache flush flags from pipe controls between enqueue flush")
 DECLARE_DEBUG_VARIABLE(bool, MakeEachEnqueueBlocking, false, "equivalent of finish after each enqueue")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSimpleKernelEnqueue, -1, "-1: default (enabled), 0: disabled, 1: enabled. Build in-order, event-less 1D NDRange launches without DispatchInfoBuilder")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelArgsResidencyCache, -1, "-1: default (enabled), 0: disabled, 1: enabled. Reuse allocations collected from kernel arguments across enqueues until an argument object changes")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableInOrderQueueFastTracking, -1, "-1: default (disabled), 0: disabled, 1: enabled. In-order queues with timestamp packets obtain task level without walking the wait list and before taking command stream receiver ownership")
+DECLARE_DEBUG_VARIABLE(int32_t, EnablePersistentMapForLocalMemoryBuffers, -1, "-1: default (disabled), 0: disabled, 1: enabled. Map lockable local memory buffers through persistently locked pointer instead of transfers to map allocation")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBufferSurfaceStateCache, -1, "-1: default (enabled), 0: disabled, 1: enabled. Reuse buffer surface states encoded for identical kernel argument inputs")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelOperationResourcePool, -1, "-1: default (enabled), 0: disabled, 1: enabled. Recycle command streams and heaps of blocked enqueues per command queue")
+DECLARE_DEBUG_VARIABLE(int32_t, TracingCollectorRecordsPerThread, -1, "-1: default (disabled), >0: enable built-in OpenCL tracing collector with per-thread ring buffers of given number of records, drained with clDrainTracingRecordsINTEL")
 DECLARE_DEBUG_VARIABLE(bool, DisableResourceRecycling, false, "when set to true disables resource recycling optimization")
 DECLARE_DEBUG_VARIABLE(bool, TrackParentEvents, false, "events track their parents")
 DECLARE_DEBUG_VARIABLE(bool, RebuildPrecompiledKernels, false, "forces driver to recompile precompiled kernels from sources")
@@ -160,7 +167,9 @@ DECLARE_DEBUG_VARIABLE(int32_t, EnableImmediateVmBindExt, -1, "Use immediate bin
 DECLARE_DEBUG_VARIABLE(int32_t, ForceExecutionTile, -1, "-1: default, 0+: given tile is chosen as submission, must be used with EnableWalkerPartition = 0.")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideTimestampPacketSize, -1, "-1: default, >0: size in bytes. 4 and 8 supported for experiments")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideMaxWorkGroupCount, -1, "-1: default, >0: Max WG size")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBatchedTimestampPacketReturn, -1, "Return all nodes of released timestamp packet container to tag allocator with single lock per list: -1: default disabled, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideCmdQueueSynchronousMode, -1, "Overrides all command queues synchronous mode: -1: do not override, 0: implicit driver behavior, 1: synchronous, 2: asynchronous")
+DECLARE_DEBUG_VARIABLE(int32_t, CommandQueueSubmissionAggregationWindow, -1, "Coalesce concurrent executeCommandLists calls on asynchronous L0 command queues into one submission: -1: disabled, >=0: time in microseconds to wait for other callers before submitting")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableStatelessCompression, -1, "-1: default, 0: disable, 1: Enable E2EC in SBA for all stateless accesses")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableMultiTileCompression, -1, "-1: default, 0: disable, 1: enable, Enables compression in multi tile scenarios.")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideGmmResourceUsageField, -1, "-1: default, >=0: gmm.resourceParams.Usage is set to this value")
@@ -201,6 +210,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, LimitEngineCountForVirtualBcs, -1, "-1: default,
 DECLARE_DEBUG_VARIABLE(int32_t, LimitEngineCountForVirtualCcs, -1, "-1: default, >0 Only use VirtualEngine with limited amount of engines, not max ")
 DECLARE_DEBUG_VARIABLE(int32_t, CreateContextWithAccessCounters, -1, "-1: default, 0: ignore, 1: create context with Access Counter programming")
 DECLARE_DEBUG_VARIABLE(int32_t, AppendMemoryPrefetchForKmdMigratedSharedAllocations, -1, "-1: default, 0: ignore, 1: allow prefetching shared memory to the device associated with the specified command list")
+DECLARE_DEBUG_VARIABLE(int32_t, PrefetchOnlyKernelAccessedAllocations, -1, "-1: default: disabled, 0: disabled, 1: enabled. Shared allocations appended for prefetch are migrated only when kernels appended before submission access them directly or through indirect shared access")
 DECLARE_DEBUG_VARIABLE(int32_t, AccessCountersTrigger, -1, "-1: default - disabled, 0: disabled, >= 0: triggering thresholds")
 DECLARE_DEBUG_VARIABLE(int32_t, AccessCountersGranularity, -1, "-1: default - ACG_2MB, >= 0: granularites - 0: ACG_128K, 1: ACG_2M, 2: ACG_16M, 3: ACG_16M")
 DECLARE_DEBUG_VARIABLE(int32_t, OverridePatIndex, -1, "-1: default, >=0: PatIndex to override")
@@ -215,6 +225,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, ForceWddmLowPriorityContextValue, -1, "Force sch
 DECLARE_DEBUG_VARIABLE(int32_t, FailBuildProgramWithStatefulAccess, -1, "-1: default, 0: disable, 1: enable, Fail build program/module creation whenever stateful access is discovered (except built in kernels).")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceImagesSupport, -1, "-1: default, 0: disable, 1: enable. Override support for Images.")
 DECLARE_DEBUG_VARIABLE(int32_t, RemoveUserFenceInCmdlistResetAndDestroy, -1, "-1: default - disabled, 0: disable, 1: enable. If enabled remove user fence during cmdlist reset and destroy.")
+DECLARE_DEBUG_VARIABLE(int32_t, CommandContainerLocalCmdBufferCacheSize, -1, "-1: default - disabled, >=0: number of command buffers kept by command container on reset and reused without accessing device reusable allocations list")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideCmdListCmdBufferSizeInKb, -1, "-1: default, 0: disable, >0: size in KB. Override cmd list command buffer size in KB.")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideL1CachePolicyInSurfaceStateAndStateless, -1, "-1: default, >=0 : following policy will be programmed in render surface state (for regular buffers) and stateless L1 caching")
 DECLARE_DEBUG_VARIABLE(int32_t, PlaformSupportEvictIfNecessaryFlag, -1, "-1: default - platform specific, 0: disable, 1: enable")
@@ -265,7 +276,7 @@ DECLARE_DEBUG_VARIABLE(bool, LogGdiCallsToFile, false, "Log GDI calls to file")
 /*PERFORMANCE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, DisableZeroCopyForBuffers, false, "When active all buffer allocations will not share memory with CPU.")
 DECLARE_DEBUG_VARIABLE(bool, DisableDcFlushInEpilogue, false, "Disable DC flush in epilogue")
-DECLARE_DEBUG_VARIABLE(bool, EnableNullHardware, false, "works on Windows only, sets the Null Hardware flag that makes all Command buffers completed while GPU does nothing")
+DECLARE_DEBUG_VARIABLE(bool, EnableNullHardware, false, "sets the Null Hardware flag that makes all Command buffers completed while GPU does nothing, on Linux all ioctls except device queries are simulated at zero cost")
 DECLARE_DEBUG_VARIABLE(bool, ForceLinearImages, false, "Force linear images. Default is Y-tiled.")
 DECLARE_DEBUG_VARIABLE(bool, ForceSLML3Config, false, "Forces L3Config with SLM for all kernels")
 DECLARE_DEBUG_VARIABLE(bool, Force32bitAddressing, false, "Forces 32 bit addresses to be used in 64 bit dll")
@@ -294,7 +305,14 @@ DECLARE_DEBUG_VARIABLE(int32_t, DeferCmdQBcsInitialization, -1, "-1: default, 0:
 DECLARE_DEBUG_VARIABLE(int32_t, PreferInternalBcsEngine, -1, "-1: default, 0:disabled, 1: enabled. When enabled use internal BCS engine for internal transfers, when disabled use regular engine")
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsCopy, -1, "-1: default, 0:disabled, 1: enabled. When enqueues copy to main copy engine then split between even linked copy engines")
 DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsMask, 0, "0: default, >0: bitmask: indicates bcs engines for split")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsLoadBalancing, -1, "-1: default, 0: split copy evenly, 1: size split copy chunks by the pending work of each copy engine")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCopyWithStagingBuffers, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, copies from pageable host memory are chunked through double buffered USM host staging buffers")
+DECLARE_DEBUG_VARIABLE(int32_t, StagingBufferSize, -1, "-1: default (2MB), >0: size of a single staging buffer in KB")
 DECLARE_DEBUG_VARIABLE(int32_t, ReuseKernelBinaries, -1, "-1: default, 0:disabled, 1: enabled. If enabled, driver reuses kernel binaries.")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHeapAllocatorSizeClassCache, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, GPU VA heap allocator keeps freed 4KB and 64KB chunks in per size class free lists for constant time reuse")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHostUsmAllocationCache, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, freed host USM allocations are kept in cache and reused by subsequent host allocations with matching properties")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSharedUsmAllocationCache, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, freed shared USM allocations without CPU storage are kept in cache and reused by subsequent shared allocations with matching properties")
+DECLARE_DEBUG_VARIABLE(int64_t, UsmAllocationCacheMaxSize, -1, "-1: default (no limit), >=0: maximum total size in bytes of allocations kept in each USM allocation cache, allocations freed above this limit are released")
 
 /*DIRECT SUBMISSION FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmission, -1, "-1: default (disabled), 0: disable, 1:enable. Enables direct submission of command buffers bypassing KMD")
@@ -315,6 +333,9 @@ DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionDisableMonitorFence, -1, "Disabl
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmissionController, -1, "Enable direct submission terminating after given timeout, -1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerTimeout, -1, "Set direct submission controller timeout, -1: default 5000 us, >=0: timeout in us")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerDivisor, -1, "Set direct submission controller timeout divider, -1: default 1, >0: divider value")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerAdaptiveTimeout, -1, "Stop each ring after an idle time derived from its own submission gaps instead of the fixed timeout, -1: default disabled, 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerRingRestartCost, -1, "Minimal idle time before adaptive controller stops a ring, -1: default 500 us, >=0: time in us")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionRingDependencies, -1, "Wait for task count dependencies on other engines with semaphores in direct submission ring instead of command buffer, -1: default disabled, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionForceLocalMemoryStorageMode, -1, "Force local memory storage for command/ring/semaphore buffer, -1: default - for all engines, 0: disabled, 1: for multiOsContextCapable engine, 2: for all engines")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableRingSwitchTagUpdateWa, -1, "-1: default, 0 - disable, 1 - enable. If enabled, completionFences wont be updated if ring is not running.")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionReadBackCommandBuffer, -1, "-1: default - disabled, 0 - disable, 1 - enable. If enabled, read first dword of cmd buffer after handling residency.")
@@ -324,6 +345,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionInsertSfenceInstructionPriorToSu
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionMaxRingBuffers, -1, "-1: default, >0: max ring buffer count, During switch ring buffer, if there is no available ring, wait for completion instead of allocating new one if DirectSubmissionMaxRingBuffers is reached")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionDisablePrefetcher, -1, "-1: default, 0 - disable, 1 - enable. If enabled, disable prefetcher is being dispatched")
 DECLARE_DEBUG_VARIABLE(bool, DirectSubmissionPrintBuffers, false, "Print address of submitted command buffers")
+DECLARE_DEBUG_VARIABLE(bool, DirectSubmissionPrintCounters, false, "Print direct submission ring counters when direct submission is destroyed")
 
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, USMEvictAfterMigration, false, "Evict USM allocation after implicit migration to GPU")
@@ -332,10 +354,18 @@ DECLARE_DEBUG_VARIABLE(bool, EnablePackedYuv, true, "Enables cl_packed_yuv exten
 DECLARE_DEBUG_VARIABLE(bool, EnableDeferredDeleter, true, "Enables async deleter")
 DECLARE_DEBUG_VARIABLE(bool, EnableAsyncDestroyAllocations, true, "Enables async destroying graphics allocations in mem obj destructor")
 DECLARE_DEBUG_VARIABLE(bool, EnableAsyncEventsHandler, true, "Enables async events handler")
+DECLARE_DEBUG_VARIABLE(int32_t, AsyncEventsHandlerCallbackThreads, 0, "0: default, callbacks are executed on async events handler thread, >0: number of threads executing callbacks of events found completed by async events handler")
 DECLARE_DEBUG_VARIABLE(bool, EnableForcePin, true, "Enables early pinning for memory object")
 DECLARE_DEBUG_VARIABLE(bool, EnableComputeWorkSizeND, true, "Enables different algorithm to compute local work size")
 DECLARE_DEBUG_VARIABLE(bool, EnableMultiRootDeviceContexts, true, "Enables support for multi root device contexts")
 DECLARE_DEBUG_VARIABLE(bool, EnableComputeWorkSizeSquared, false, "Enables algorithm to compute the most squared work group as possible")
+DECLARE_DEBUG_VARIABLE(int32_t, EnablePerThreadDataCache, -1, "-1: default (enabled), 0: disabled, 1: enabled. Copy local IDs generated per kernel for previously used work group size instead of generating them again")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableWorkGroupSizeCache, -1, "-1: default (enabled), 0: disabled, 1: enabled. Memoize local work sizes computed per kernel for given global size")
+DECLARE_DEBUG_VARIABLE(int32_t, LinkerRelocationThreads, -1, "-1: default (parallel when module has many relocations), >0: number of threads patching relocations of instruction segments")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableModuleIsaSuballocation, -1, "-1: default (disabled), 0: disabled, 1: enabled. Place ISA of all kernels of L0 user module in one allocation uploaded with single copy, not used when debugger is active")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableIsaDeduplication, -1, "-1: default (disabled), 0: disabled, 1: enabled. Share identical relocation free ISA of L0 user modules between modules and sub-devices of root device, not used when debugger is active")
+DECLARE_DEBUG_VARIABLE(int32_t, ModuleInitializationThreads, -1, "-1: default (parallel when module has many kernels), >0: number of threads initializing kernels of L0 module")
+DECLARE_DEBUG_VARIABLE(std::string, WorkGroupSizeProfileFile, std::string("unk"), "Path to file with local work sizes tuned per kernel name and global size, consulted before computing local work size")
 DECLARE_DEBUG_VARIABLE(bool, EnableExtendedVaFormats, false, "Enable more formats in cl-va sharing")
 DECLARE_DEBUG_VARIABLE(bool, EnableFormatQuery, true, "Enable sharing format querying")
 DECLARE_DEBUG_VARIABLE(bool, EnableFreeMemory, false, "Enable freeMemory in memory manager")
@@ -346,15 +376,18 @@ DECLARE_DEBUG_VARIABLE(bool, EnablePrivateBO, false, "Enable PRELIM_I915_GEM_CRE
 DECLARE_DEBUG_VARIABLE(int32_t, ReturnSubDevicesAsApiDevices, -1, "Expose each subdevice as a separate device during clGetDeviceIDs or zeDeviceGet API call")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceRunAloneContext, -1, "Control creation of run-alone HW context, -1:default, 0:disable, 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, AddClGlSharing, -1, "Add cl-gl extension")
-DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelTunning, -1, "Perform a tunning of enqueue kernel, -1:default(disabled), 0:disable, 1:enable simple kernel tunning, 2:enable full kernel tunning")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelTunning, -1, "Perform a tunning of enqueue kernel, -1:default(disabled), 0:disable, 1:enable simple kernel tunning, 2:enable full kernel tunning, 3:enable full kernel tunning including walker partition type")
+DECLARE_DEBUG_VARIABLE(int32_t, LocalWorkSizeTuningLaunches, -1, "-1: default (disabled), >0: number of launches of each kernel and global size without local size that try candidate local sizes measured with timestamp packets, fastest one is used afterwards and stored in compiler cache directory")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBOMmapCreate, -1, "Create BOs using mmap, -1:default, 0:disable(GEM_USERPTR), 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableGemCloseWorker, -1, "Use asynchronous gem object closing, -1:default, 0:disable, 1:enable")
+DECLARE_DEBUG_VARIABLE(int32_t, GemCloseWorkerThreadCount, -1, "-1: default (1), >0: number of threads used by asynchronous gem object closing")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableHostPtrValidation, -1, "Validate BO from GEM_USERPTR, -1:default(enable), 0:disable, 1:enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableIntelVme, -1, "-1: default, 0: disabled, 1: Enables cl_intel_motion_estimation extension")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableIntelAdvancedVme, -1, "-1: default, 0: disabled, 1: Enables cl_intel_advanced_motion_estimation extension")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterOperationsSupport, -1, "-1: default, 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterForEnqueueOperations, -1, "Use Blitter engine for enqueue operations. -1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableBlitterForEnqueueImageOperations, -1, "Use Blitter engine for read/write/copy image operations. -1: default, 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, WriteImageChunkSize, -1, "-1: default (disabled), >0: split in-order clEnqueueWriteImage from host memory into row ranges of at most given size in bytes, each staged and copied separately")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCacheFlushAfterWalker, -1, "-1: platform behavior, 0: disabled, 1: enabled. Adds dedicated cache flush command after WALKER command when surfaces used by kernel require to flush the cache")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableLocalMemory, -1, "-1: default behavior, 0: disabled, 1: enabled, Allows allocating graphics memory in Local Memory")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableStatelessToStatefulBufferOffsetOpt, -1, "-1: don't override, 0: disable, 1: enable, Enables buffer-offset improvement of the stateless to stateful optimization")
@@ -385,15 +418,20 @@ DECLARE_DEBUG_VARIABLE(int32_t, UseBindlessMode, -1, "Use precompiled builtins i
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideSlmSize, -1, "Force different slm size than default in kB")
 DECLARE_DEBUG_VARIABLE(int32_t, UseCyclesPerSecondTimer, 0, "0: default behavior, 0: disabled: Report L0 timer in nanosecond units, 1: enabled: Report L0 timer in cycles per second")
 DECLARE_DEBUG_VARIABLE(int32_t, WaitLoopCount, -1, "-1: use default, >=0: number of iterations in wait loop")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAdaptiveWaitPolicy, -1, "-1: default (disabled), 0: disable, 1: enable : spin without yielding while waiting for task count when previous waits on the same CSR completed quickly")
+DECLARE_DEBUG_VARIABLE(int32_t, AdaptiveWaitMaxSpinTime, -1, "-1: use default, >=0: max time in microseconds to spin without yielding when adaptive wait policy is enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableWaitpkg, -1, "-1: default (disabled), 0: disable, 1: enable : use umonitor/umwait instead of pause loop when polling for completion on CPUs supporting WAITPKG")
+DECLARE_DEBUG_VARIABLE(int64_t, WaitpkgCounterValue, -1, "-1: use default, >=0: number of TSC cycles passed to umwait as timeout when waiting for completion")
 DECLARE_DEBUG_VARIABLE(int32_t, GTPinAllocateBufferInSharedMemory, -1, "Force GTPin to allocate buffer in shared memory")
 DECLARE_DEBUG_VARIABLE(int32_t, AlignLocalMemoryVaTo2MB, -1, "Allow 2MB pages for allocations with size>=2MB. On Linux it means aligned VA, on Windows it means aligned size. -1: default, 0: disabled, 1: enabled")
-DECLARE_DEBUG_VARIABLE(int32_t, EnableUserFenceForCompletionWait, -1, "-1: default (disabled), 0: disable, 1: enable : Use Wait User Fence instead Gem Wait")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableUserFenceForCompletionWait, -1, "-1: default (enabled when VM bind is available), 0: disable, 1: enable : Use Wait User Fence instead Gem Wait")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableUserFenceUseCtxId, -1, "-1: default (disabled), 0: disable, 1: enable : Use Context Id in Wait User Fence when waiting for completion tag")
 DECLARE_DEBUG_VARIABLE(int32_t, SetKmdWaitTimeout, -1, "-1: default (infinity), >0: amount of time units for wait function timeout")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideNotifyEnableForTagUpdatePostSync, -1, "-1: default (usage determined by user fence wait call), 0: disable use of NotifyEnable flag, 1: enable use NotifyEnable flag")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCmdQRoundRobindEngineAssign, -1, "-1: default, 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, CmdQRoundRobindEngineAssignBitfield, -1, "-1: default, >0: bitfield with supported engines")
 DECLARE_DEBUG_VARIABLE(int32_t, CmdQRoundRobindEngineAssignNTo1, -1, "-1: default, >0: assign same engine to N queues")
+DECLARE_DEBUG_VARIABLE(int32_t, CmdQRoundRobindEngineAssignLeastLoaded, -1, "-1: default(disabled), 0: disabled, 1: assign engine with fewest alive command queues instead of next engine in order")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCopyEngineSelector, -1, "Do not choose only main copy engine, -1: default, 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCmdQRoundRobindBcsEngineAssign, -1, "-1: default, 0: disable, 1: enable")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCmdQRoundRobindBcsEngineAssignLimit, -1, "-1: default, >=0: round robin limit")
@@ -427,6 +465,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableCustomLocalMemoryAlignment, 0,
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableDeviceAllocationCache, -1, "Experimentally enable allocation cache.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalH2DCpuCopyThreshold, -1, "Override default treshold (in bytes) for H2D CPU copy.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalD2HCpuCopyThreshold, -1, "Override default treshold (in bytes) for D2H CPU copy.")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCpuCopyNonTemporalStores, -1, "-1: default (enabled), 0: disabled, 1: enabled. Use streaming stores for H2D CPU copy through locked pointer")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCpuCopyThreads, -1, "-1: default (1), >1: number of threads used for CPU copy through locked pointer")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLock, -1, "Experimentally copy memory through locked ptr. -1: default 0: disable 1: enable ")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableSourceLevelDebugger, false, "Experimentally enable source level debugger.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableL0DebuggerForOpenCL, false, "Experimentally enable debugging OCL with L0 Debug API.")
@@ -481,5 +521,73 @@ DECLARE_DEBUG_VARIABLE(int32_t, OverrideDrmRegion, -1, "-1: disable, 0+: overrid
 DECLARE_DEBUG_VARIABLE(int32_t, EnableFrontEndTracking, -1, "-1: default: disabled, 0: disabled, 1: enabled. This flag creates multiple return point from List to Queue for Front End reconfiguration on Queue buffer for single List")
 DECLARE_DEBUG_VARIABLE(int32_t, EnablePipelineSelectTracking, -1, "-1: default: disabled, 0: disabled, 1: enabled. This flag enables optimization that limits number of pipeline select dispatched by command lists")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableStateComputeModeTracking, -1, "-1: default: disabled, 0: disabled, 1: enabled. This flag enables tracking state compute mode changes in command lists")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableScratchSpacePooling, -1, "-1: default: disabled, 0: disabled, 1: enabled. Scratch allocations of all command stream receivers of root device are taken from and returned to shared pool with power of two size classes")
+DECLARE_DEBUG_VARIABLE(int32_t, ScratchSpacePoolMaxSizeInMb, -1, "-1: default (256), >=0: maximal size of idle scratch allocations kept in scratch space pool, oldest ones above limit are released")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableStateBaseAddressTracking, -1, "-1: default: disabled, 0: disabled, 1: enabled. This flag enables tracking state base address and binding table pool changes between command lists executed on command queue")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableHeapStateDeduplication, -1, "-1: default: disabled, 0: disabled, 1: enabled. Identical surface state and sampler state blocks dispatched to command container are written to its heaps once and reused")
+DECLARE_DEBUG_VARIABLE(int32_t, SharedAllocationMigrationChunkSizeInKb, -1, "-1: default: whole allocation is migrated, >0: shared allocations larger than given size are migrated between CPU and GPU domains in chunks of this size, only chunks accessed by CPU are migrated back to GPU")
+DECLARE_DEBUG_VARIABLE(int32_t, RegisterPageFaultHandlerOnMigration, -1, "-1: default: disabled, 0: disabled, 1: enabled. Before migrating shared allocations to GPU, page fault handler is registered again if it was replaced by application, previous handler is chained")
+DECLARE_DEBUG_VARIABLE(int32_t, TrimResidencyByLastUsedFence, -1, "-1: default: disabled, 0: disabled, 1: enabled. When trimming to budget on Windows, trim candidates are evicted in order of last used fence value instead of order of becoming trim candidate")
+DECLARE_DEBUG_VARIABLE(int32_t, SkipMakeResidentForResidentTrimCandidateFragments, -1, "-1: default: disabled, 0: disabled, 1: enabled. Fragments of host pointer allocations from trim candidate list that are still resident are not passed to MakeResident again, submission with unchanged working set does not call MakeResident")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSysmanEngineGroupPmuRead, -1, "-1: default: disabled, 0: disabled, 1: enabled. Busy counters of all sysman engine handles of device are opened as one perf event group and read with single read call, engines that already reported activity trigger new group read")
+DECLARE_DEBUG_VARIABLE(int32_t, EnablePmtTelemetryMapping, -1, "-1: default: disabled, 0: disabled, 1: enabled. Sysman PMT telemetry region is mapped once and keys are read from mapping instead of opening and reading telemetry file for each key")
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanEventsListenPollingIntervalInMs, -1, "-1: default: device events are checked every 10 ms, >0: on Linux zesDriverEventListen sleeps until L0 udev rules report event or given time passes")
+DECLARE_DEBUG_VARIABLE(int32_t, MetricStreamerOaBufferReportsMultiplier, -1, "-1: default (2), >=2: OA buffer of metric streamer holds given multiple of notifyEveryNReports reports, gives more room before reports are dropped when notifications are handled late")
+DECLARE_DEBUG_VARIABLE(int32_t, IpSamplingCalculationThreads, -1, "-1: default: based on raw report count, >0: number of threads summing IP sampling raw reports in zetMetricGroupCalculateMetricValues")
+DECLARE_DEBUG_VARIABLE(int32_t, MetricKernelSamplingPeriod, -1, "-1: default: disabled, >0: every N-th kernel launch is bracketed with a metric query of the activated event based metric group, values are averaged per kernel name and printed when device is destroyed")
+DECLARE_DEBUG_VARIABLE(int32_t, MetricKernelSamplingRingSize, -1, "-1: default (256), >0: number of preallocated metric queries used by MetricKernelSamplingPeriod, oldest sample is read when its query is reused")
+DECLARE_DEBUG_VARIABLE(int32_t, DebuggerMaxCachedStateSaveAreaSize, -1, "-1: default (64MB), >=0: max size of state save area read at once for all threads raising attention, larger spans are read per thread")
+DECLARE_DEBUG_VARIABLE(std::string, GpuHangDumpDirectory, std::string("unk"), "unk: disabled, otherwise directory where command stream, state save area and residency list of a command stream receiver are dumped once when GPU hang is detected")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSmallBufferPoolAllocator, -1, "Experimental implementation: Carve small OpenCL buffers out of shared 2MB pool buffers, -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, PrewarmedBufferObjectsCount, -1, "-1: default (disabled), >0: number of buffer objects up to 2MB created in one pass, with mmap offsets, when free list for given size, memory banks and PAT index runs empty")
+DECLARE_DEBUG_VARIABLE(int32_t, PrewarmBufferObjectsInBackground, -1, "-1: default (disabled), 0: disabled, 1: refill free lists of prewarmed buffer objects on a background thread instead of the allocating thread")
+DECLARE_DEBUG_VARIABLE(int32_t, UserptrPinningCacheSizeInMb, -1, "-1: default (disabled), >0: size of host memory ranges whose userptr buffer objects are kept pinned after release for reuse by later transfers")
+DECLARE_DEBUG_VARIABLE(int32_t, AllocationProfilerSamplingInterval, -1, "-1: default (disabled), >=0: profile sizes, lifetimes and types of graphics allocations, capture call stack of every N-th allocation, 0: no call stacks")
+DECLARE_DEBUG_VARIABLE(int32_t, AllocationProfilerDumpSignal, -1, "-1: default (none), >0: Linux only, signal number requesting dump of allocation profile on next allocation or free")
+DECLARE_DEBUG_VARIABLE(std::string, AllocationProfilerDumpFile, std::string("unk"), "unk: default (stdout), otherwise file to which allocation profile is written")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableTileAccessBasedPlacement, -1, "-1: default (disabled), 0: disabled, 1: place device buffers on multi tile devices in local memory of tile dominating accesses of freed buffers of similar size")
+DECLARE_DEBUG_VARIABLE(int32_t, DeviceUsmPreferredTile, -1, "-1: default (no hint), >=0: hint placing device USM allocations on multi tile devices in local memory of given tile")
+DECLARE_DEBUG_VARIABLE(int32_t, Enable2MBPagesForLargeAllocations, -1, "-1: default (disabled), 0: disabled, 1: align VA and size of allocations with size>=2MB to 2MB, on Linux host allocations are advised to use transparent huge pages")
+DECLARE_DEBUG_VARIABLE(int32_t, SplitBcsForPeerCopies, -1, "-1: default, 0: disabled, 1: enabled. Stripes copies to memory of peer device connected with device link across split copy engines")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableVaSurfaceImportCache, -1, "-1: default, 0: disabled, 1: enabled. Keeps VA surfaces imported to context and reuses them when the same surface and plane is shared again")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSharingProducerWriteTracking, -1, "-1: default, 0: disabled, 1: enabled. Skips synchronization of acquired GL objects until producer signals writes with GL sync object")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAdaptiveCompressionPolicy, -1, "-1: default: large device only USM allocations are compressed when stateless compression is supported, 0: disabled, 1: large device only USM allocations are compressed whenever platform supports buffer compression. Compressed buffer types frequently accessed on host are no longer compressed")
+DECLARE_DEBUG_VARIABLE(int32_t, AdaptiveCompressionMinAllocationSizeInKb, -1, "-1: default: 2048, >=0: minimal size of device only USM allocation compressed by adaptive compression policy")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableParallelDeviceInitialization, -1, "-1: default: disabled, 0: disabled, 1: enabled. OS interface and GMM of root devices are initialized concurrently, one thread per root device")
+DECLARE_DEBUG_VARIABLE(int32_t, DeferEngineResourcesCreation, -1, "-1: default: disabled, 0: disabled, 1: enabled. Preemption and kernel args buffer allocations of engines with deferred OS context initialization are created when engine is used for the first time")
+DECLARE_DEBUG_VARIABLE(std::string, DrmQueryCacheDir, std::string("unk"), "unk: default: disabled, otherwise: directory where static DRM query results are cached per device, cache is invalidated on reboot, kernel or driver change")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuGpuTimeCalibrationIntervalMs, -1, "-1: default: disabled, >0: CPU-GPU timestamp pairs are sampled at most once per given interval in ms, queries in between are answered from fitted offset and drift model")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuGpuTimeCalibrationMaxErrorNs, -1, "-1: default: 1000, >=0: maximal error in ns of CPU-GPU time model measured against latest sample, above it every query samples device timestamp")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLatencyHistograms, -1, "-1: default: disabled, 0: disabled, 1: enabled. Latency of API calls and encode, flush, wait and residency phases is recorded in per thread histograms")
+DECLARE_DEBUG_VARIABLE(std::string, LatencyHistogramsDumpFile, std::string("unk"), "unk: default: not dumped, otherwise: file where latency histograms are written in Prometheus text format at process exit")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableTracePoints, -1, "-1: default: disabled, 0: disabled, 1: enabled. Trace points in flushTask, executeCommandLists, appendLaunchKernel, makeResident and waitForTaskCount write binary records to per thread rings")
+DECLARE_DEBUG_VARIABLE(std::string, TracePointsDumpFile, std::string("unk"), "unk: default: not dumped, otherwise: file where trace point records are written in binary format at process exit")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSubmissionTimeline, -1, "-1: default, 0: disabled, 1: record host and GPU timestamps of each flushTask submission in a ring of entries per command stream receiver")
+DECLARE_DEBUG_VARIABLE(int32_t, CoalesceTaskCountTagWrites, -1, "-1: default(disabled), 0: disabled, N > 0: in immediate dispatch skip tag PIPE_CONTROL of non-blocking submissions not requiring cache flush, tag is written every N-th submission, on wait and on flush")
+DECLARE_DEBUG_VARIABLE(int32_t, AUBDumpSkipUnchangedPages, -1, "-1: default(disabled), 0: disabled, 1: skip writing pages to AUB file when their content and page table entry bits did not change since they were last written to that file")
+DECLARE_DEBUG_VARIABLE(int32_t, BinaryCacheMemoizeInputHash, -1, "-1: default(disabled), 0: disabled, 1: reuse hash of large compiler cache input passed again with the same pointer and size when its beginning and end did not change")
+DECLARE_DEBUG_VARIABLE(int32_t, BinaryCacheInMemorySize, -1, "-1: default(disabled), 0: disabled, N > 0: keep up to N MB of device binaries built or loaded from binary cache in a process wide LRU reused by identical builds")
+DECLARE_DEBUG_VARIABLE(int32_t, BinaryCacheIntermediateRepresentation, -1, "-1: default(disabled), 0: disabled, 1: cache frontend compiler output of OpenCL C sources without includes, builds of the same source for other devices start at backend compiler")
+DECLARE_DEBUG_VARIABLE(int32_t, AsyncModuleBuildThreads, -1, "-1: default(disabled), 0: disabled, N > 0: build SPIR-V user modules in background on N driver worker threads, zeModuleCreate returns before build is done")
+DECLARE_DEBUG_VARIABLE(int32_t, ParallelProgramBuild, -1, "-1: default(disabled), 0: disabled, 1: build programs for multiple root devices and query specialization constants of statically linked SPIR-V modules on parallel threads")
+DECLARE_DEBUG_VARIABLE(int32_t, DeferGmmClientContextCreation, -1, "-1: default(disabled), 0: disabled, 1: create GMM client context of root device on first use instead of GMM helper creation")
+DECLARE_DEBUG_VARIABLE(int32_t, CreateHighPriorityContext, -1, "-1: default(disabled), 0: disabled, 1: create additional high priority context on default engine of each device, used by high priority queues")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableThreadSafeImmediateCommandList, -1, "-1: default, 0: disabled, 1: appends to the same immediate command list from multiple threads are serialized")
+DECLARE_DEBUG_VARIABLE(int32_t, FencePoolSize, -1, "-1: default(disabled), >0: number of destroyed fences kept by command queue for reuse by next fence creation")
+DECLARE_DEBUG_VARIABLE(int32_t, PerformanceHintsRecordsPerCallSite, -1, "-1: default: disabled, >0: structured performance hints are collected, number of hints recorded per driver call site, further occurrences are only counted")
+DECLARE_DEBUG_VARIABLE(int32_t, DeferPackedProgramBinaryCopy, -1, "-1: default: disabled, 0: disabled, 1: binary passed to clCreateProgramWithBinary is not kept, CL_PROGRAM_BINARIES returns binary packed on demand for the queried device only")
+DECLARE_DEBUG_VARIABLE(int32_t, TbxWriteBatchSize, -1, "-1: default: 1MB, 0: send each request without response to TBX server separately, >0: size in bytes of buffered requests sent to TBX server at once")
+DECLARE_DEBUG_VARIABLE(int32_t, EnablePeerToPeerMigration, -1, "-1: default: enabled when device supports p2p access, 0: disable, 1: enable. Buffers are migrated between root devices with a copy from source allocation imported on target device instead of through host memory")
+DECLARE_DEBUG_VARIABLE(std::string, DriverThreadsCpuList, std::string("unk"), "unk: default: driver threads inherit cpu affinity of application, otherwise: list of cpus in 0-3,8 format all driver threads are pinned to, e.g. local_cpulist of the GPU in sysfs")
+DECLARE_DEBUG_VARIABLE(int32_t, NumaLocalSystemMemory, -1, "-1: default: system memory of driver allocations is bound to NUMA node of the device, 0: disabled, 1: host USM allocations are bound to NUMA node of the device too")
+DECLARE_DEBUG_VARIABLE(int32_t, WddmPagingFenceSpinTime, -1, "-1: default: 20 when UMD-KMD data is translated (GPU-PV), 0 otherwise, >0: time in microseconds to poll paging fence on CPU before submitting wait on GPU")
+DECLARE_DEBUG_VARIABLE(int32_t, ImageResourceInfoCacheSize, -1, "-1: default: disabled, >0: number of GMM resource infos of recently created images kept, images with the same descriptor are created as copies without layout computation")
+DECLARE_DEBUG_VARIABLE(int32_t, ReleaseIdleRayTracingAllocations, -1, "-1: default: disabled, 0: disabled, 1: ray tracing allocations of device are freed when last kernel using ray tracing is destroyed and allocated again by next one")
+DECLARE_DEBUG_VARIABLE(int32_t, MemoryFillStoreDataImmMaxSize, -1, "-1: default: disabled, 0: disabled, >0: max size in bytes of dword aligned L0 memory fills programmed with MI_STORE_DATA_IMM instead of fill kernel")
+DECLARE_DEBUG_VARIABLE(int32_t, CacheCommandListBatchBufferStarts, -1, "-1: default: disabled, 0: disabled, 1: enabled, batch buffer starts of closed regular command list are encoded once and copied on next executions until list is reset")
+DECLARE_DEBUG_VARIABLE(int64_t, EvictUnusedAllocationsBudget, -1, "-1: default: all idle allocations are evicted, >0: when vm bind runs out of memory, least recently used idle allocations are evicted until given amount of bytes is released, idle allocations are evicted on next retry")
+DECLARE_DEBUG_VARIABLE(int32_t, ResizeRolledOverCommandListHeaps, -1, "-1: default: disabled, 0: disabled, 1: enabled, on command list reset dynamic state and indirect object heaps which rolled over are reallocated with size of whole recording")
+DECLARE_DEBUG_VARIABLE(int32_t, SysmanPerformanceGovernorIntervalMs, -1, "-1: default: disabled, 0: disabled, >0: sampling interval in ms of governor adjusting performance factor of compute domains to engine and memory bandwidth utilization")
 /* Binary Cache */
 DECLARE_DEBUG_VARIABLE(bool, BinaryCacheTrace, false, "enable cl_cache to produce .trace files with information about hash computation")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBuiltinBinaryCache, -1, "-1: default (disabled), 0: disabled, 1: enabled. Store SIP and Level Zero builtin kernel binaries in compiler cache so other processes can reuse them")
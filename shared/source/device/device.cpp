@@ -287,6 +287,11 @@ bool Device::createEngines() {
     auto &hwInfo = getHardwareInfo();
     auto gpgpuEngines = HwHelper::get(hwInfo.platform.eRenderCoreFamily).getGpgpuEngineInstances(hwInfo);
 
+    // separate context, with its own ring, keeps high priority submissions from queuing behind regular work
+    if (EngineHelpers::isHighPriorityContextEnabled()) {
+        gpgpuEngines.push_back({getChosenEngineType(hwInfo), EngineUsage::HighPriority});
+    }
+
     uint32_t deviceCsrIndex = 0;
     for (auto &engine : gpgpuEngines) {
         if (!createEngine(deviceCsrIndex++, engine)) {
@@ -347,7 +352,8 @@ bool Device::createEngine(uint32_t deviceCsrIndex, EngineTypeUsage engineTypeUsa
     EngineDescriptor engineDescriptor(engineTypeUsage, getDeviceBitfield(), preemptionMode, false, createAsEngineInstanced);
 
     auto osContext = executionEnvironment->memoryManager->createAndRegisterOsContext(commandStreamReceiver.get(), engineDescriptor);
-    if (osContext->isImmediateContextInitializationEnabled(isDefaultEngine)) {
+    const bool immediateContextInitialization = osContext->isImmediateContextInitializationEnabled(isDefaultEngine);
+    if (immediateContextInitialization) {
         osContext->ensureContextInitialized();
     }
     commandStreamReceiver->setupContext(*osContext);
@@ -360,7 +366,12 @@ bool Device::createEngine(uint32_t deviceCsrIndex, EngineTypeUsage engineTypeUsa
         return false;
     }
 
-    commandStreamReceiver->createKernelArgsBufferAllocation();
+    const bool deferResourcesCreation = !immediateContextInitialization && DebugManager.flags.DeferEngineResourcesCreation.get() == 1;
+    if (deferResourcesCreation) {
+        commandStreamReceiver->deferResourcesCreation();
+    } else {
+        commandStreamReceiver->createKernelArgsBufferAllocation();
+    }
 
     if (isDefaultEngine) {
         defaultEngineIndex = deviceCsrIndex;
@@ -370,7 +381,7 @@ bool Device::createEngine(uint32_t deviceCsrIndex, EngineTypeUsage engineTypeUsa
         }
     }
 
-    if (preemptionMode == PreemptionMode::MidThread && !commandStreamReceiver->createPreemptionAllocation()) {
+    if (!deferResourcesCreation && preemptionMode == PreemptionMode::MidThread && !commandStreamReceiver->createPreemptionAllocation()) {
         return false;
     }
 
@@ -596,9 +607,43 @@ EngineControl &Device::getNextEngineForCommandQueue() {
     do {
         engineIndex = (this->regularCommandQueuesCreatedWithinDeviceCount++ / this->queuesPerEngineCount) % engineGroup.engines.size();
     } while (!this->availableEnginesForCommandQueueusRoundRobin.test(engineIndex));
+
+    if (DebugManager.flags.CmdQRoundRobindEngineAssignLeastLoaded.get() == 1) {
+        // round robin index only breaks ties, so few heavy and many light queues both spread evenly
+        const auto enginesCount = std::min(engineGroup.engines.size(), commandQueuesAssignedToEngineCount.size());
+        auto leastLoadedEngineIndex = engineIndex;
+        for (auto offset = 1u; offset < enginesCount; offset++) {
+            auto candidateIndex = static_cast<uint32_t>((engineIndex + offset) % enginesCount);
+            if (this->availableEnginesForCommandQueueusRoundRobin.test(candidateIndex) &&
+                commandQueuesAssignedToEngineCount[candidateIndex] < commandQueuesAssignedToEngineCount[leastLoadedEngineIndex]) {
+                leastLoadedEngineIndex = candidateIndex;
+            }
+        }
+        engineIndex = leastLoadedEngineIndex;
+    }
+
+    if (engineIndex < commandQueuesAssignedToEngineCount.size()) {
+        commandQueuesAssignedToEngineCount[engineIndex]++;
+    }
     return engineGroup.engines[engineIndex];
 }
 
+void Device::releaseEngineForCommandQueue(const EngineControl &engine) {
+    const auto &hardwareInfo = this->getHardwareInfo();
+    const auto &hwHelper = NEO::HwHelper::get(hardwareInfo.platform.eRenderCoreFamily);
+    const auto engineGroupType = hwHelper.getEngineGroupType(engine.getEngineType(), engine.getEngineUsage(), hardwareInfo);
+    const auto &engineGroup = this->getRegularEngineGroups()[this->getEngineGroupIndexFromEngineGroupType(engineGroupType)];
+
+    for (auto engineIndex = 0u; engineIndex < std::min(engineGroup.engines.size(), commandQueuesAssignedToEngineCount.size()); engineIndex++) {
+        if (engineGroup.engines[engineIndex].commandStreamReceiver == engine.commandStreamReceiver) {
+            if (commandQueuesAssignedToEngineCount[engineIndex] > 0u) {
+                commandQueuesAssignedToEngineCount[engineIndex]--;
+            }
+            return;
+        }
+    }
+}
+
 EngineControl *Device::getInternalCopyEngine() {
     if (!getHardwareInfo().capabilityTable.blitterOperationsSupported) {
         return nullptr;
@@ -613,6 +658,7 @@ EngineControl *Device::getInternalCopyEngine() {
 }
 
 RTDispatchGlobalsInfo *Device::getRTDispatchGlobals(uint32_t maxBvhLevels) {
+    std::lock_guard<std::mutex> lock(rayTracingMutex);
     if (rtDispatchGlobalsInfos.size() == 0) {
         return nullptr;
     }
@@ -637,6 +683,8 @@ RTDispatchGlobalsInfo *Device::getRTDispatchGlobals(uint32_t maxBvhLevels) {
 }
 
 void Device::initializeRayTracing(uint32_t maxBvhLevels) {
+    std::lock_guard<std::mutex> lock(rayTracingMutex);
+    rayTracingUsersCount++;
     if (rtMemoryBackedBuffer == nullptr) {
         auto size = RayTracingHelper::getTotalMemoryBackedFifoSize(*this);
 
@@ -652,8 +700,34 @@ void Device::initializeRayTracing(uint32_t maxBvhLevels) {
     }
 }
 
+// RT allocations are sized for all threads of the device, they are freed after last user is gone
+// and allocated again by next user
+void Device::releaseRayTracing() {
+    std::lock_guard<std::mutex> lock(rayTracingMutex);
+    UNRECOVERABLE_IF(rayTracingUsersCount == 0);
+    rayTracingUsersCount--;
+    if (rayTracingUsersCount == 0 && DebugManager.flags.ReleaseIdleRayTracingAllocations.get() == 1) {
+        freeRayTracingAllocations(true);
+    }
+}
+
 void Device::finalizeRayTracing() {
-    getMemoryManager()->freeGraphicsMemory(rtMemoryBackedBuffer);
+    freeRayTracingAllocations(false);
+}
+
+void Device::freeRayTracingAllocations(bool checkGpuUsage) {
+    auto freeAllocation = [this, checkGpuUsage](GraphicsAllocation *allocation) {
+        if (allocation == nullptr) {
+            return;
+        }
+        if (checkGpuUsage) {
+            getMemoryManager()->checkGpuUsageAndDestroyGraphicsAllocations(allocation);
+        } else {
+            getMemoryManager()->freeGraphicsMemory(allocation);
+        }
+    };
+
+    freeAllocation(rtMemoryBackedBuffer);
     rtMemoryBackedBuffer = nullptr;
 
     for (size_t i = 0; i < rtDispatchGlobalsInfos.size(); i++) {
@@ -662,11 +736,11 @@ void Device::finalizeRayTracing() {
             continue;
         }
         for (size_t j = 0; j < rtDispatchGlobalsInfo->rtDispatchGlobals.size(); j++) {
-            getMemoryManager()->freeGraphicsMemory(rtDispatchGlobalsInfo->rtDispatchGlobals[j]);
+            freeAllocation(rtDispatchGlobalsInfo->rtDispatchGlobals[j]);
             rtDispatchGlobalsInfo->rtDispatchGlobals[j] = nullptr;
         }
 
-        getMemoryManager()->freeGraphicsMemory(rtDispatchGlobalsInfo->rtDispatchGlobalsArrayAllocation);
+        freeAllocation(rtDispatchGlobalsInfo->rtDispatchGlobalsArrayAllocation);
         rtDispatchGlobalsInfo->rtDispatchGlobalsArrayAllocation = nullptr;
 
         delete rtDispatchGlobalsInfos[i];
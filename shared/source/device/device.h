@@ -21,6 +21,8 @@
 #include "shared/source/os_interface/performance_counters.h"
 #include "shared/source/program/sync_buffer_handler.h"
 
+#include <mutex>
+
 namespace NEO {
 class DebuggerL0;
 class OSTime;
@@ -79,6 +81,7 @@ class Device : public ReferenceTrackedObject<Device> {
     EngineControl &getEngine(uint32_t index);
     EngineControl &getDefaultEngine();
     EngineControl &getNextEngineForCommandQueue();
+    void releaseEngineForCommandQueue(const EngineControl &engine);
     EngineControl &getInternalEngine();
     EngineControl *getInternalCopyEngine();
     SelectorCopyEngine &getSelectorCopyEngine();
@@ -141,6 +144,7 @@ class Device : public ReferenceTrackedObject<Device> {
     RTDispatchGlobalsInfo *getRTDispatchGlobals(uint32_t maxBvhLevels);
     bool rayTracingIsInitialized() const { return rtMemoryBackedBuffer != nullptr; }
     void initializeRayTracing(uint32_t maxBvhLevels);
+    void releaseRayTracing();
     void allocateRTDispatchGlobals(uint32_t maxBvhLevels);
 
     uint64_t getGlobalMemorySize(uint32_t deviceBitfield) const;
@@ -186,6 +190,7 @@ class Device : public ReferenceTrackedObject<Device> {
     bool engineInstancedSubDevicesAllowed();
     void setAsEngineInstanced();
     void finalizeRayTracing();
+    void freeRayTracingAllocations(bool checkGpuUsage);
 
     DeviceInfo deviceInfo = {};
 
@@ -203,6 +208,7 @@ class Device : public ReferenceTrackedObject<Device> {
     std::atomic_uint32_t regularCommandQueuesCreatedWithinDeviceCount{0};
     std::bitset<8> availableEnginesForCommandQueueusRoundRobin = 0;
     uint32_t queuesPerEngineCount = 1;
+    std::array<std::atomic_uint32_t, 8> commandQueuesAssignedToEngineCount{};
     void initializeEngineRoundRobinControls();
     bool hasGenericSubDevices = false;
     bool engineInstanced = false;
@@ -217,6 +223,8 @@ class Device : public ReferenceTrackedObject<Device> {
 
     GraphicsAllocation *rtMemoryBackedBuffer = nullptr;
     std::vector<RTDispatchGlobalsInfo *> rtDispatchGlobalsInfos;
+    uint32_t rayTracingUsersCount = 0;
+    std::mutex rayTracingMutex;
 
     struct {
         bool isValid = false;
@@ -35,7 +35,6 @@ ArFileEntryHeader *ArEncoder::appendFileEntry(const ConstStringRef fileName, con
         size_t paddingSize = 8U - ((fileEntries.size() + 2 * sizeof(ArFileEntryHeader)) % 8);
         auto padSizeString = std::to_string(paddingSize);
         memcpy_s(paddingHeader.fileSizeInBytes, sizeof(paddingHeader.fileSizeInBytes), padSizeString.c_str(), padSizeString.size());
-        this->fileEntries.reserve(this->fileEntries.size() + sizeof(paddingHeader) + paddingSize + sizeof(header) + alignedFileSize);
         this->fileEntries.insert(this->fileEntries.end(), reinterpret_cast<uint8_t *>(&paddingHeader), reinterpret_cast<uint8_t *>(&paddingHeader + 1));
         this->fileEntries.resize(this->fileEntries.size() + paddingSize, ' ');
     }
@@ -45,7 +44,6 @@ ArFileEntryHeader *ArEncoder::appendFileEntry(const ConstStringRef fileName, con
     auto sizeString = std::to_string(fileData.size());
     UNRECOVERABLE_IF(sizeString.length() > sizeof(header.fileSizeInBytes));
     memcpy_s(header.fileSizeInBytes, sizeof(header.fileSizeInBytes), sizeString.c_str(), sizeString.size());
-    this->fileEntries.reserve(this->fileEntries.size() + sizeof(header) + alignedFileSize);
     auto newFileHeaderOffset = this->fileEntries.size();
     this->fileEntries.insert(this->fileEntries.end(), reinterpret_cast<uint8_t *>(&header), reinterpret_cast<uint8_t *>(&header + 1));
     this->fileEntries.insert(this->fileEntries.end(), fileData.begin(), fileData.end());
@@ -55,7 +53,7 @@ ArFileEntryHeader *ArEncoder::appendFileEntry(const ConstStringRef fileName, con
 
 std::vector<uint8_t> ArEncoder::encode() const {
     std::vector<uint8_t> ret;
-    ret.reserve(arMagic.size() + 1);
+    ret.reserve(arMagic.size() + this->fileEntries.size());
     ret.insert(ret.end(), reinterpret_cast<const uint8_t *>(arMagic.begin()), reinterpret_cast<const uint8_t *>(arMagic.end()));
     ret.insert(ret.end(), this->fileEntries.begin(), this->fileEntries.end());
     return ret;
@@ -43,7 +43,7 @@ std::vector<uint8_t> createDebugZebin(ArrayRef<const uint8_t> zebinBin, const Se
     auto dzc = DebugZebinCreator(zebin, gpuSegments);
     dzc.createDebugZebin();
     dzc.applyRelocations();
-    return dzc.getDebugZebin();
+    return std::move(dzc.getDebugZebin());
 }
 
 void DebugZebinCreator::createDebugZebin() {
@@ -55,6 +55,12 @@ void DebugZebinCreator::createDebugZebin() {
     header.version = zebin.elfFileHeader->version;
     header.shStrNdx = zebin.elfFileHeader->shStrNdx;
 
+    size_t dataSize = 0U;
+    for (const auto &section : zebin.sectionHeaders) {
+        dataSize += alignUp(section.data.size(), 4U);
+    }
+    elfEncoder.reserveData(dataSize);
+
     for (uint32_t i = 0; i < zebin.sectionHeaders.size(); i++) {
         const auto &section = zebin.sectionHeaders[i];
         auto sectionName = zebin.getSectionName(i);
@@ -45,7 +45,7 @@ class DebugZebinCreator {
 
     void applyRelocations();
     void createDebugZebin();
-    inline std::vector<uint8_t> getDebugZebin() { return debugZebin; }
+    inline std::vector<uint8_t> &getDebugZebin() { return debugZebin; }
 
   protected:
     void applyRelocation(uint64_t addr, uint64_t value, NEO::Elf::RELOC_TYPE_ZEBIN type);
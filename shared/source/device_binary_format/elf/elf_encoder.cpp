@@ -35,7 +35,6 @@ void ElfEncoder<NumBits>::appendSection(const ElfSectionHeader<NumBits> &section
         auto sectionDataAlignment = std::min<uint64_t>(defaultDataAlignment, 8U);
         auto alignedOffset = alignUp(this->data.size(), static_cast<size_t>(sectionDataAlignment));
         auto alignedSize = alignUp(sectionData.size(), static_cast<size_t>(sectionDataAlignment));
-        this->data.reserve(alignedOffset + alignedSize);
         this->data.resize(alignedOffset, 0U);
         this->data.insert(this->data.end(), sectionData.begin(), sectionData.end());
         this->data.resize(alignedOffset + alignedSize, 0U);
@@ -52,7 +51,6 @@ void ElfEncoder<NumBits>::appendSegment(const ElfProgramHeader<NumBits> &program
         UNRECOVERABLE_IF(programHeader.align == 0);
         auto alignedOffset = alignUp(this->data.size(), static_cast<size_t>(programHeader.align));
         auto alignedSize = alignUp(segmentData.size(), static_cast<size_t>(programHeader.align));
-        this->data.reserve(alignedOffset + alignedSize);
         this->data.resize(alignedOffset, 0U);
         this->data.insert(this->data.end(), segmentData.begin(), segmentData.end());
         this->data.resize(alignedOffset + alignedSize, 0U);
@@ -163,7 +161,7 @@ std::vector<uint8_t> ElfEncoder<NumBits>::encode() const {
     auto stringTabOffset = dataOffset + data.size();
 
     std::vector<uint8_t> ret;
-    ret.reserve(stringTabOffset + alignedSectionNamesDataSize);
+    ret.reserve(stringTabOffset + dataPaddingBeforeSectionNames + alignedSectionNamesDataSize);
     ret.insert(ret.end(), reinterpret_cast<uint8_t *>(&elfFileHeader), reinterpret_cast<uint8_t *>(&elfFileHeader + 1));
     ret.resize(programHeadersOffset, 0U);
 
@@ -76,6 +76,11 @@ struct ElfEncoder {
 
     uint32_t appendSectionName(ConstStringRef str);
 
+    // appended data grows geometrically, callers knowing the total size up front can avoid regrowing
+    void reserveData(size_t dataSize) {
+        data.reserve(dataSize);
+    }
+
     std::vector<uint8_t> encode() const;
 
     ElfFileHeader<NumBits> &getElfFileHeader() {
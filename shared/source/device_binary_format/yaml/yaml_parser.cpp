@@ -7,10 +7,84 @@
 
 #include "shared/source/device_binary_format/yaml/yaml_parser.h"
 
+#include "shared/source/helpers/basic_math.h"
+
+#if defined(__ARM_ARCH)
+#include <sse2neon.h>
+#else
+#include <emmintrin.h>
+#endif
+
 namespace NEO {
 
 namespace Yaml {
 
+constexpr size_t scanBlockSize = sizeof(__m128i);
+
+inline __m128i isInRange(__m128i block, char first, char last) {
+    return _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8(first - 1)), _mm_cmplt_epi8(block, _mm_set1_epi8(last + 1)));
+}
+
+// returns position of first character in block for which matchMask bit is not set or nullptr if all matched
+inline const char *findFirstUnmatched(const char *blockBeg, int matchMask) {
+    constexpr int allMatched = 0xFFFF;
+    matchMask &= allMatched;
+    if (allMatched == matchMask) {
+        return nullptr;
+    }
+    return blockBeg + Math::getMinLsbSet(static_cast<uint32_t>(~matchMask & allMatched));
+}
+
+const char *consumeSpaces(const char *parsePos, const char *parseEnd) {
+    const auto spaces = _mm_set1_epi8(' ');
+    while (parsePos + scanBlockSize <= parseEnd) {
+        auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(parsePos));
+        auto unmatched = findFirstUnmatched(parsePos, _mm_movemask_epi8(_mm_cmpeq_epi8(block, spaces)));
+        if (nullptr != unmatched) {
+            return unmatched;
+        }
+        parsePos += scanBlockSize;
+    }
+    while ((parsePos < parseEnd) && (' ' == *parsePos)) {
+        ++parsePos;
+    }
+    return parsePos;
+}
+
+const char *findNewLine(const char *parsePos, const char *parseEnd) {
+    const auto newLines = _mm_set1_epi8('\n');
+    while (parsePos + scanBlockSize <= parseEnd) {
+        auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(parsePos));
+        auto unmatched = findFirstUnmatched(parsePos, ~_mm_movemask_epi8(_mm_cmpeq_epi8(block, newLines)));
+        if (nullptr != unmatched) {
+            return unmatched;
+        }
+        parsePos += scanBlockSize;
+    }
+    while ((parsePos < parseEnd) && ('\n' != *parsePos)) {
+        ++parsePos;
+    }
+    return parsePos;
+}
+
+const char *consumeNameIdentifierCharacters(const char *parsePos, const char *parseEnd) {
+    const auto underscores = _mm_set1_epi8('_');
+    while (parsePos + scanBlockSize <= parseEnd) {
+        auto block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(parsePos));
+        auto matched = _mm_or_si128(_mm_or_si128(isInRange(block, 'a', 'z'), isInRange(block, 'A', 'Z')),
+                                    _mm_or_si128(isInRange(block, '0', '9'), _mm_cmpeq_epi8(block, underscores)));
+        auto unmatched = findFirstUnmatched(parsePos, _mm_movemask_epi8(matched));
+        if (nullptr != unmatched) {
+            return unmatched;
+        }
+        parsePos += scanBlockSize;
+    }
+    while ((parsePos < parseEnd) && isNameIdentifierCharacter(*parsePos)) {
+        ++parsePos;
+    }
+    return parsePos;
+}
+
 std::string constructYamlError(size_t lineNumber, const char *lineBeg, const char *parsePos, const char *reason) {
     auto ret = "NEO::Yaml : Could not parse line : [" + std::to_string(lineNumber) + "] : [" + ConstStringRef(lineBeg, parsePos - lineBeg + 1).str() + "] <-- parser position on error";
     if (nullptr != reason) {
@@ -157,10 +231,12 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
     while (context.pos < context.end) {
         reserveBasedOnEstimates(outTokens, text.begin(), text.end(), context.pos);
         switch (context.pos[0]) {
-        case ' ':
-            context.lineIndent += context.isParsingIdent ? 1 : 0;
-            ++context.pos;
+        case ' ': {
+            auto spacesEnd = consumeSpaces(context.pos, context.end);
+            context.lineIndent += context.isParsingIdent ? static_cast<uint32_t>(spacesEnd - context.pos) : 0;
+            context.pos = spacesEnd;
             break;
+        }
         case '\t':
             if (context.isParsingIdent) {
                 context.lineIndent += 4U;
@@ -175,13 +251,7 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
         case '#': {
             context.isParsingIdent = false;
             outTokens.push_back(Token(ConstStringRef(context.pos, 1), Token::SingleCharacter));
-            auto commentIt = context.pos + 1;
-            while (commentIt < context.end) {
-                if ('\n' == commentIt[0]) {
-                    break;
-                }
-                ++commentIt;
-            }
+            auto commentIt = findNewLine(context.pos + 1, context.end);
             if (context.pos + 1 != commentIt) {
                 outTokens.push_back(Token(ConstStringRef(context.pos + 1, commentIt - (context.pos + 1)), Token::Comment));
             }
@@ -273,7 +343,7 @@ bool tokenize(ConstStringRef text, LinesCache &outLines, TokensCache &outTokens,
             break;
         default: {
             context.isParsingIdent = false;
-            auto tokEnd = consumeNameIdentifier(text, context.pos);
+            auto tokEnd = isNameIdentifierBeginningCharacter(*context.pos) ? consumeNameIdentifierCharacters(context.pos + 1, context.end) : context.pos;
             if (tokEnd != context.pos) {
                 if (context.lineTraits.hasDictionaryEntry) {
                     outTokens.push_back(Token(ConstStringRef(context.pos, tokEnd - context.pos), Token::LiteralString));
@@ -112,6 +112,12 @@ constexpr const char *consumeNameIdentifier(ConstStringRef wholeText, const char
     return parsePos;
 }
 
+// Block-scanning counterparts of the per-character loops above, used by the tokenizer.
+// Each returns the first position in [parsePos, parseEnd) that does not belong to the scanned run.
+const char *consumeSpaces(const char *parsePos, const char *parseEnd);
+const char *findNewLine(const char *parsePos, const char *parseEnd);
+const char *consumeNameIdentifierCharacters(const char *parsePos, const char *parseEnd);
+
 constexpr const char *consumeStringLiteral(ConstStringRef wholeText, const char *parsePos) {
     auto stringLiteralBeg = *parsePos;
     switch (stringLiteralBeg) {
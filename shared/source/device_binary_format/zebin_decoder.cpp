@@ -1082,6 +1082,25 @@ NEO::DecodeError populateKernelDescriptor(const NEO::Elf::ZebinKernelMetadata::T
     return DecodeError::Success;
 }
 
+template <Elf::ELF_IDENTIFIER_CLASS numBits>
+typename ZebinSections<numBits>::SectionHeaderData *getKernelTextSection(NEO::Elf::Elf<numBits> &elf, NEO::ZebinSections<numBits> &zebinSections, const std::string &kernelName) {
+    if (zebinSections.textKernelSectionsIndexedCount != zebinSections.textKernelSections.size()) {
+        zebinSections.textKernelSectionsByName.clear();
+        zebinSections.textKernelSectionsByName.reserve(zebinSections.textKernelSections.size());
+        auto sectionHeaderNamesData = elf.sectionHeaders[elf.elfFileHeader->shStrNdx].data;
+        ConstStringRef sectionHeaderNamesString(reinterpret_cast<const char *>(sectionHeaderNamesData.begin()), sectionHeaderNamesData.size());
+        for (auto *textSection : zebinSections.textKernelSections) {
+            ConstStringRef sectionName = ConstStringRef(sectionHeaderNamesString.begin() + textSection->header->name);
+            auto sufix = sectionName.substr(static_cast<int>(NEO::Elf::SectionsNamesZebin::textPrefix.length()));
+            zebinSections.textKernelSectionsByName[sufix.str()] = textSection;
+        }
+        zebinSections.textKernelSectionsIndexedCount = zebinSections.textKernelSections.size();
+    }
+
+    auto it = zebinSections.textKernelSectionsByName.find(kernelName);
+    return (it != zebinSections.textKernelSectionsByName.end()) ? it->second : nullptr;
+}
+
 template <Elf::ELF_IDENTIFIER_CLASS numBits>
 NEO::DecodeError populateKernelDescriptor(NEO::ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, NEO::ZebinSections<numBits> &zebinSections,
                                           NEO::Yaml::YamlParser &yamlParser, const NEO::Yaml::Node &kernelNd, std::string &outErrReason, std::string &outWarning) {
@@ -1322,17 +1341,7 @@ NEO::DecodeError populateKernelDescriptor(NEO::ProgramInfo &dst, NEO::Elf::Elf<n
         kernelDescriptor.generatedHeaps.resize(kernelDescriptor.generatedHeaps.size() + generatedDshSize);
     }
 
-    typename ZebinSections<numBits>::SectionHeaderData *correspondingTextSegment = nullptr;
-    auto sectionHeaderNamesData = elf.sectionHeaders[elf.elfFileHeader->shStrNdx].data;
-    ConstStringRef sectionHeaderNamesString(reinterpret_cast<const char *>(sectionHeaderNamesData.begin()), sectionHeaderNamesData.size());
-    for (auto *textSection : zebinSections.textKernelSections) {
-        ConstStringRef sectionName = ConstStringRef(sectionHeaderNamesString.begin() + textSection->header->name);
-        auto sufix = sectionName.substr(static_cast<int>(NEO::Elf::SectionsNamesZebin::textPrefix.length()));
-        if (sufix == kernelDescriptor.kernelMetadata.kernelName) {
-            correspondingTextSegment = textSection;
-        }
-    }
-
+    auto correspondingTextSegment = getKernelTextSection(elf, zebinSections, kernelDescriptor.kernelMetadata.kernelName);
     if (nullptr == correspondingTextSegment) {
         outErrReason.append("DeviceBinaryFormat::Zebin : Could not find text section for kernel " + kernelDescriptor.kernelMetadata.kernelName + "\n");
         return DecodeError::InvalidBinary;
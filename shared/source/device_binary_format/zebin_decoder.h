@@ -15,6 +15,7 @@
 #include "shared/source/utilities/stackvec.h"
 
 #include <string>
+#include <unordered_map>
 
 namespace NEO {
 
@@ -32,6 +33,10 @@ struct ZebinSections {
     StackVec<SectionHeaderData *, 1> spirvSections;
     StackVec<SectionHeaderData *, 1> noteIntelGTSections;
     StackVec<SectionHeaderData *, 1> buildOptionsSection;
+
+    // kernel name -> text section, built on first lookup so that per-kernel decoding does not rescan all text sections
+    std::unordered_map<std::string, SectionHeaderData *> textKernelSectionsByName;
+    size_t textKernelSectionsIndexedCount = 0U;
 };
 
 using UniqueNode = StackVec<const NEO::Yaml::Node *, 1>;
@@ -116,6 +121,9 @@ NEO::DecodeError populateArgDescriptor(const NEO::Elf::ZebinKernelMetadata::Type
 NEO::DecodeError populateArgDescriptor(const NEO::Elf::ZebinKernelMetadata::Types::Kernel::PayloadArgument::PayloadArgumentBaseT &src, NEO::KernelDescriptor &dst, uint32_t &crossThreadDataSize,
                                        std::string &outErrReason, std::string &outWarning);
 
+template <Elf::ELF_IDENTIFIER_CLASS numBits>
+typename ZebinSections<numBits>::SectionHeaderData *getKernelTextSection(NEO::Elf::Elf<numBits> &elf, NEO::ZebinSections<numBits> &zebinSections, const std::string &kernelName);
+
 template <Elf::ELF_IDENTIFIER_CLASS numBits>
 NEO::DecodeError populateKernelDescriptor(NEO::ProgramInfo &dst, NEO::Elf::Elf<numBits> &elf, NEO::ZebinSections<numBits> &zebinSections,
                                           NEO::Yaml::YamlParser &yamlParser, const NEO::Yaml::Node &kernelNd, std::string &outErrReason, std::string &outWarning);
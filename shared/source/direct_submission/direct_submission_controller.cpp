@@ -11,6 +11,7 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include <algorithm>
 #include <chrono>
 
 namespace NEO {
@@ -22,6 +23,13 @@ DirectSubmissionController::DirectSubmissionController() {
     if (DebugManager.flags.DirectSubmissionControllerDivisor.get() != -1) {
         timeoutDivisor = DebugManager.flags.DirectSubmissionControllerDivisor.get();
     }
+    if (DebugManager.flags.DirectSubmissionControllerAdaptiveTimeout.get() != -1) {
+        adaptiveTimeout = !!DebugManager.flags.DirectSubmissionControllerAdaptiveTimeout.get();
+    }
+    if (DebugManager.flags.DirectSubmissionControllerRingRestartCost.get() != -1) {
+        ringRestartCost = DebugManager.flags.DirectSubmissionControllerRingRestartCost.get();
+    }
+    sleepTime = timeout;
 
     directSubmissionControllingThread = Thread::create(controlDirectSubmissionsState, reinterpret_cast<void *>(this));
 };
@@ -73,6 +81,12 @@ void *DirectSubmissionController::controlDirectSubmissionsState(void *self) {
 void DirectSubmissionController::checkNewSubmissions() {
     std::lock_guard<std::mutex> lock(this->directSubmissionsMutex);
 
+    SteadyClock::time_point now{};
+    int64_t nextCheck = this->timeout;
+    if (this->adaptiveTimeout) {
+        now = this->getCpuTimestamp();
+    }
+
     for (auto &directSubmission : this->directSubmissions) {
         auto csr = directSubmission.first;
         auto &state = directSubmission.second;
@@ -82,19 +96,49 @@ void DirectSubmissionController::checkNewSubmissions() {
             if (state.isStopped) {
                 continue;
             } else {
+                if (this->adaptiveTimeout) {
+                    auto idleTime = std::chrono::duration_cast<std::chrono::microseconds>(now - state.lastSubmissionTime).count();
+                    auto idleThreshold = this->getIdleThreshold(state);
+                    if (idleTime < idleThreshold) {
+                        nextCheck = std::min(nextCheck, idleThreshold - idleTime);
+                        continue;
+                    }
+                }
                 auto lock = csr->obtainUniqueOwnership();
                 csr->stopDirectSubmission();
                 state.isStopped = true;
             }
         } else {
+            if (this->adaptiveTimeout) {
+                if (!state.isStopped) {
+                    auto submissionGap = std::chrono::duration_cast<std::chrono::microseconds>(now - state.lastSubmissionTime).count();
+                    state.averageSubmissionGap = state.averageSubmissionGap < 0 ? submissionGap : (3 * state.averageSubmissionGap + submissionGap) / 4;
+                }
+                state.lastSubmissionTime = now;
+                nextCheck = std::min(nextCheck, this->getIdleThreshold(state));
+            }
             state.isStopped = false;
             state.taskCount = taskCount;
         }
     }
+
+    this->sleepTime = std::max(nextCheck, int64_t{1});
 }
 
 void DirectSubmissionController::sleep() {
-    std::this_thread::sleep_for(std::chrono::microseconds(this->timeout));
+    std::this_thread::sleep_for(std::chrono::microseconds(this->adaptiveTimeout ? this->sleepTime : this->timeout));
+}
+
+int64_t DirectSubmissionController::getIdleThreshold(const DirectSubmissionState &state) const {
+    if (state.averageSubmissionGap < 0) {
+        return this->timeout;
+    }
+    int64_t minThreshold = std::min(this->ringRestartCost, this->timeout);
+    return std::clamp(2 * state.averageSubmissionGap, minThreshold, static_cast<int64_t>(this->timeout));
+}
+
+DirectSubmissionController::SteadyClock::time_point DirectSubmissionController::getCpuTimestamp() {
+    return SteadyClock::now();
 }
 
 void DirectSubmissionController::adjustTimeout(CommandStreamReceiver *csr) {
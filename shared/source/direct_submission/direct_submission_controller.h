@@ -11,6 +11,7 @@
 
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -33,9 +34,13 @@ class DirectSubmissionController {
     static bool isSupported();
 
   protected:
+    using SteadyClock = std::chrono::steady_clock;
+
     struct DirectSubmissionState {
         bool isStopped = true;
         uint32_t taskCount = 0u;
+        SteadyClock::time_point lastSubmissionTime{};
+        int64_t averageSubmissionGap = -1;
     };
 
     static void *controlDirectSubmissionsState(void *self);
@@ -43,6 +48,8 @@ class DirectSubmissionController {
     MOCKABLE_VIRTUAL void sleep();
 
     void adjustTimeout(CommandStreamReceiver *csr);
+    int64_t getIdleThreshold(const DirectSubmissionState &state) const;
+    MOCKABLE_VIRTUAL SteadyClock::time_point getCpuTimestamp();
 
     uint32_t maxCcsCount = 1u;
     std::array<uint32_t, DeviceBitfield().size()> ccsCount = {};
@@ -55,5 +62,8 @@ class DirectSubmissionController {
 
     int timeout = 5000;
     int timeoutDivisor = 1;
+    int ringRestartCost = 500;
+    int64_t sleepTime = 5000;
+    bool adaptiveTimeout = false;
 };
 } // namespace NEO
\ No newline at end of file
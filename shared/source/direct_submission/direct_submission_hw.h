@@ -39,6 +39,16 @@ struct TagData {
     uint64_t tagValue = 0ull;
 };
 
+struct DirectSubmissionCounters {
+    uint64_t dispatchedBuffers = 0u;
+    uint64_t ringStarts = 0u;
+    uint64_t ringStops = 0u;
+    uint64_t ringSwitches = 0u;
+    uint64_t ringBufferAllocations = 0u;
+    uint64_t semaphoreSections = 0u;
+    uint64_t prefetchMitigationBytes = 0u;
+};
+
 enum class DirectSubmissionSfenceMode : int32_t {
     Disabled = 0,
     BeforeSemaphoreOnly = 1,
@@ -82,6 +92,9 @@ class DirectSubmissionHw {
 
     MOCKABLE_VIRTUAL bool stopRingBuffer();
 
+    // ring of a hung context is neither stopped nor awaited on destruction
+    virtual void abandonRingBuffer();
+
     bool startRingBuffer();
 
     MOCKABLE_VIRTUAL bool dispatchCommandBuffer(BatchBuffer &batchBuffer, FlushStampTracker &flushStamp);
@@ -90,6 +103,9 @@ class DirectSubmissionHw {
 
     virtual uint32_t *getCompletionValuePointer() { return nullptr; }
 
+    // counters are updated under csr ownership, read them with csr ownership held to get a consistent snapshot
+    const DirectSubmissionCounters &getCounters() const { return counters; }
+
   protected:
     static constexpr size_t prefetchSize = 8 * MemoryConstants::cacheLineSize;
     static constexpr size_t prefetchNoops = prefetchSize / sizeof(uint32_t);
@@ -122,6 +138,8 @@ class DirectSubmissionHw {
     void setReturnAddress(void *returnCmd, uint64_t returnAddress);
 
     void *dispatchWorkloadSection(BatchBuffer &batchBuffer);
+    void dispatchRingDependenciesSection(const BatchBuffer &batchBuffer);
+    size_t getSizeRingDependenciesSection(const BatchBuffer &batchBuffer);
     size_t getSizeDispatch();
 
     void dispatchPrefetchMitigation();
@@ -165,6 +183,7 @@ class DirectSubmissionHw {
 
     LinearStream ringCommandStream;
     std::unique_ptr<DirectSubmissionDiagnosticsCollector> diagnostic;
+    DirectSubmissionCounters counters;
 
     uint64_t semaphoreGpuVa = 0u;
     uint64_t gpuVaForMiFlush = 0u;
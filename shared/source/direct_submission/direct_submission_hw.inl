@@ -77,7 +77,14 @@ DirectSubmissionHw<GfxFamily, Dispatcher>::DirectSubmissionHw(const DirectSubmis
 }
 
 template <typename GfxFamily, typename Dispatcher>
-DirectSubmissionHw<GfxFamily, Dispatcher>::~DirectSubmissionHw() = default;
+DirectSubmissionHw<GfxFamily, Dispatcher>::~DirectSubmissionHw() {
+    if (DebugManager.flags.DirectSubmissionPrintCounters.get()) {
+        printf("Direct submission counters: dispatched buffers: %" PRIu64 ", ring starts: %" PRIu64 ", ring stops: %" PRIu64
+               ", ring switches: %" PRIu64 ", ring buffer allocations: %" PRIu64 ", semaphore sections: %" PRIu64 ", prefetch mitigation bytes: %" PRIu64 "\n",
+               counters.dispatchedBuffers, counters.ringStarts, counters.ringStops,
+               counters.ringSwitches, counters.ringBufferAllocations, counters.semaphoreSections, counters.prefetchMitigationBytes);
+    }
+}
 
 template <typename GfxFamily, typename Dispatcher>
 bool DirectSubmissionHw<GfxFamily, Dispatcher>::allocateResources() {
@@ -206,6 +213,7 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::initialize(bool submitOnInit, bo
         dispatchSemaphoreSection(currentQueueWorkCount);
 
         ringStart = submit(ringCommandStream.getGraphicsAllocation()->getGpuAddress(), startBufferSize);
+        counters.ringStarts++;
         performDiagnosticMode();
         return ringStart;
     }
@@ -246,6 +254,7 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::startRingBuffer() {
     dispatchSemaphoreSection(currentQueueWorkCount);
 
     ringStart = submit(gpuStartVa, startSize);
+    counters.ringStarts++;
 
     return ringStart;
 }
@@ -276,10 +285,16 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::stopRingBuffer() {
 
     this->handleStopRingBuffer();
     this->ringStart = false;
+    counters.ringStops++;
 
     return true;
 }
 
+template <typename GfxFamily, typename Dispatcher>
+void DirectSubmissionHw<GfxFamily, Dispatcher>::abandonRingBuffer() {
+    ringStart = false;
+}
+
 template <typename GfxFamily, typename Dispatcher>
 inline void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchSemaphoreSection(uint32_t value) {
     using MI_SEMAPHORE_WAIT = typename GfxFamily::MI_SEMAPHORE_WAIT;
@@ -297,6 +312,9 @@ inline void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchSemaphoreSection(
 
     dispatchPrefetchMitigation();
     dispatchDisablePrefetcher(false);
+
+    counters.semaphoreSections++;
+    counters.prefetchMitigationBytes += getSizePrefetchMitigation();
 }
 
 template <typename GfxFamily, typename Dispatcher>
@@ -411,6 +429,7 @@ void *DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchWorkloadSection(BatchBu
         auto commandStreamAddress = ptrOffset(batchBuffer.commandBufferAllocation->getGpuAddress(), batchBuffer.startOffset);
         void *returnCmd = batchBuffer.endCmdPtr;
 
+        dispatchRingDependenciesSection(batchBuffer);
         dispatchStartSection(commandStreamAddress);
         void *returnPosition = ringCommandStream.getSpace(0);
 
@@ -435,6 +454,23 @@ void *DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchWorkloadSection(BatchBu
     return currentPosition;
 }
 
+template <typename GfxFamily, typename Dispatcher>
+void DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchRingDependenciesSection(const BatchBuffer &batchBuffer) {
+    using COMPARE_OPERATION = typename GfxFamily::MI_SEMAPHORE_WAIT::COMPARE_OPERATION;
+
+    for (auto &[taskCount, tagAddress] : batchBuffer.ringDependencies) {
+        EncodeSempahore<GfxFamily>::addMiSemaphoreWaitCommand(ringCommandStream,
+                                                              tagAddress,
+                                                              taskCount,
+                                                              COMPARE_OPERATION::COMPARE_OPERATION_SAD_GREATER_THAN_OR_EQUAL_SDD);
+    }
+}
+
+template <typename GfxFamily, typename Dispatcher>
+size_t DirectSubmissionHw<GfxFamily, Dispatcher>::getSizeRingDependenciesSection(const BatchBuffer &batchBuffer) {
+    return batchBuffer.ringDependencies.size() * EncodeSempahore<GfxFamily>::getSizeMiSemaphoreWait();
+}
+
 template <typename GfxFamily, typename Dispatcher>
 bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffer &batchBuffer, FlushStampTracker &flushStamp) {
     //for now workloads requiring cache coherency are not supported
@@ -446,7 +482,7 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffe
 
     this->startRingBuffer();
 
-    size_t dispatchSize = getSizeDispatch();
+    size_t dispatchSize = getSizeDispatch() + getSizeRingDependenciesSection(batchBuffer);
     size_t cycleSize = getSizeSwitchRingBufferSection();
     size_t requiredMinimalSize = dispatchSize + cycleSize + getSizeEnd();
 
@@ -486,6 +522,7 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffe
 
     cpuCachelineFlush(semaphorePtr, MemoryConstants::cacheLineSize);
     currentQueueWorkCount++;
+    counters.dispatchedBuffers++;
     DirectSubmissionDiagnostics::diagnosticModeOneSubmit(diagnostic.get());
 
     uint64_t flushValue = updateTagValue();
@@ -530,6 +567,7 @@ inline uint64_t DirectSubmissionHw<GfxFamily, Dispatcher>::switchRingBuffers() {
     ringCommandStream.replaceGraphicsAllocation(nextRingBuffer);
 
     handleSwitchRingBuffers();
+    counters.ringSwitches++;
 
     return currentBufferGpuVa;
 }
@@ -562,6 +600,7 @@ inline GraphicsAllocation *DirectSubmissionHw<GfxFamily, Dispatcher>::switchRing
             nextAllocation = memoryManager->allocateGraphicsMemoryWithProperties(commandStreamAllocationProperties);
             this->currentRingBuffer = static_cast<uint32_t>(this->ringBuffers.size());
             this->ringBuffers.emplace_back(0ull, nextAllocation);
+            counters.ringBufferAllocations++;
             auto ret = memoryOperationHandler->makeResidentWithinOsContext(&this->osContext, ArrayRef<GraphicsAllocation *>(&nextAllocation, 1u), false) == MemoryOperationsStatus::SUCCESS;
             UNRECOVERABLE_IF(!ret);
         }
@@ -21,6 +21,7 @@ class DrmDirectSubmission : public DirectSubmissionHw<GfxFamily, Dispatcher> {
     ~DrmDirectSubmission() override;
 
     uint32_t *getCompletionValuePointer() override;
+    void abandonRingBuffer() override;
 
   protected:
     bool allocateOsResources() override;
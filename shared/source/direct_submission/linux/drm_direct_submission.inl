@@ -74,6 +74,18 @@ inline DrmDirectSubmission<GfxFamily, Dispatcher>::~DrmDirectSubmission() {
     this->deallocateResources();
 }
 
+template <typename GfxFamily, typename Dispatcher>
+void DrmDirectSubmission<GfxFamily, Dispatcher>::abandonRingBuffer() {
+    DirectSubmissionHw<GfxFamily, Dispatcher>::abandonRingBuffer();
+    if (this->isCompletionFenceSupported()) {
+        auto completionFenceCpuAddress = ptrOffset(this->completionFenceAllocation->getUnderlyingBuffer(), Drm::completionFenceOffset);
+        for (uint32_t i = 0; i < this->activeTiles; i++) {
+            *reinterpret_cast<volatile uint32_t *>(completionFenceCpuAddress) = this->completionFenceValue;
+            completionFenceCpuAddress = ptrOffset(completionFenceCpuAddress, this->postSyncOffset);
+        }
+    }
+}
+
 template <typename GfxFamily, typename Dispatcher>
 uint32_t *DrmDirectSubmission<GfxFamily, Dispatcher>::getCompletionValuePointer() {
     if (this->isCompletionFenceSupported()) {
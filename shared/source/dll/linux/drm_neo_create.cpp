@@ -99,6 +99,8 @@ Drm *Drm::create(std::unique_ptr<HwDeviceIdDrm> &&hwDeviceId, RootDeviceEnvironm
         printDebugString(DebugManager.flags.PrintDebugMessages.get(), stderr, "%s", "WARNING: Failed to query engine info\n");
     }
 
+    drm->persistQueryCache();
+
     drm->checkContextDebugSupport();
 
     drm->queryPageFaultSupport();
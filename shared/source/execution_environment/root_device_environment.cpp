@@ -10,6 +10,7 @@
 #include "shared/source/ail/ail_configuration.h"
 #include "shared/source/aub/aub_center.h"
 #include "shared/source/built_ins/built_ins.h"
+#include "shared/source/command_stream/scratch_space_pool.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/compiler_interface/default_cache_config.h"
 #include "shared/source/debugger/debugger.h"
@@ -103,6 +104,7 @@ bool RootDeviceEnvironment::initAilConfiguration() {
         return false;
     }
 
+    ailConfiguration->applyPerformanceProfile();
     ailConfiguration->apply(hwInfo->capabilityTable);
 
     return true;
@@ -124,6 +126,24 @@ BindlessHeapsHelper *RootDeviceEnvironment::getBindlessHeapsHelper() const {
     return bindlessHeapsHelper.get();
 }
 
+ScratchSpacePool *RootDeviceEnvironment::getScratchSpacePool() {
+    if (DebugManager.flags.EnableScratchSpacePooling.get() != 1) {
+        return nullptr;
+    }
+    if (this->scratchSpacePool.get() == nullptr) {
+        std::lock_guard<std::mutex> autolock(this->mtx);
+        if (this->scratchSpacePool.get() == nullptr) {
+            size_t maxPooledSize = ScratchSpacePool::defaultMaxPooledSize;
+            if (DebugManager.flags.ScratchSpacePoolMaxSizeInMb.get() != -1) {
+                maxPooledSize = static_cast<size_t>(DebugManager.flags.ScratchSpacePoolMaxSizeInMb.get()) * MemoryConstants::megaByte;
+            }
+            UNRECOVERABLE_IF(executionEnvironment.memoryManager.get() == nullptr);
+            this->scratchSpacePool = std::make_unique<ScratchSpacePool>(*executionEnvironment.memoryManager, maxPooledSize);
+        }
+    }
+    return this->scratchSpacePool.get();
+}
+
 void RootDeviceEnvironment::createBindlessHeapsHelper(MemoryManager *memoryManager, bool availableDevices, uint32_t rootDeviceIndex, DeviceBitfield deviceBitfield) {
     bindlessHeapsHelper = std::make_unique<BindlessHeapsHelper>(memoryManager, availableDevices, rootDeviceIndex, deviceBitfield);
 }
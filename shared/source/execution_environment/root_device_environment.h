@@ -32,6 +32,7 @@ class MemoryManager;
 class MemoryOperationsHandler;
 class OSInterface;
 class OSTime;
+class ScratchSpacePool;
 class SipKernel;
 class SWTagsManager;
 struct HardwareInfo;
@@ -63,6 +64,7 @@ struct RootDeviceEnvironment {
     MOCKABLE_VIRTUAL CompilerInterface *getCompilerInterface();
     BuiltIns *getBuiltIns();
     BindlessHeapsHelper *getBindlessHeapsHelper() const;
+    ScratchSpacePool *getScratchSpacePool();
     void createBindlessHeapsHelper(MemoryManager *memoryManager, bool availableDevices, uint32_t rootDeviceIndex, DeviceBitfield deviceBitfield);
     void limitNumberOfCcs(uint32_t numberOfCcs);
     bool isNumberOfCcsLimited() const;
@@ -79,6 +81,7 @@ struct RootDeviceEnvironment {
     std::unique_ptr<BuiltIns> builtins;
     std::unique_ptr<Debugger> debugger;
     std::unique_ptr<SWTagsManager> tagsManager;
+    std::unique_ptr<ScratchSpacePool> scratchSpacePool;
     ExecutionEnvironment &executionEnvironment;
 
     AffinityMaskHelper deviceAffinityMask{true};
@@ -9,6 +9,7 @@
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/gmm_helper/client_context/gmm_client_context.h"
+#include "shared/source/gmm_helper/image_resource_info_cache.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/hw_info.h"
@@ -21,9 +22,15 @@
 namespace NEO {
 
 GmmClientContext *GmmHelper::getClientContext() const {
+    std::call_once(gmmClientContextCreated, [this]() { createClientContext(); });
     return gmmClientContext.get();
 }
 
+void GmmHelper::createClientContext() const {
+    gmmClientContext = GmmHelper::createGmmContextWrapperFunc(osInterface, const_cast<HardwareInfo *>(hwInfo));
+    UNRECOVERABLE_IF(!gmmClientContext);
+}
+
 const HardwareInfo *GmmHelper::getHardwareInfo() {
     return hwInfo;
 }
@@ -33,8 +40,20 @@ uint32_t GmmHelper::getMOCS(uint32_t type) const {
         type = GMM_RESOURCE_USAGE_OCL_BUFFER_CACHELINE_MISALIGNED;
     }
 
-    MEMORY_OBJECT_CONTROL_STATE mocs = gmmClientContext->cachePolicyGetMemoryObject(nullptr, static_cast<GMM_RESOURCE_USAGE_TYPE>(type));
+    // cache policy of client context doesn't change, so MOCS of each usage is queried from GMM only once
+    auto cachedMocs = (type < GMM_RESOURCE_USAGE_MAX) ? &mocsCache[type] : nullptr;
+    if (cachedMocs) {
+        auto mocs = cachedMocs->load(std::memory_order_relaxed);
+        if (mocs != invalidMocs) {
+            return mocs;
+        }
+    }
+
+    MEMORY_OBJECT_CONTROL_STATE mocs = getClientContext()->cachePolicyGetMemoryObject(nullptr, static_cast<GMM_RESOURCE_USAGE_TYPE>(type));
 
+    if (cachedMocs) {
+        cachedMocs->store(static_cast<uint32_t>(mocs.DwordValue), std::memory_order_relaxed);
+    }
     return static_cast<uint32_t>(mocs.DwordValue);
 }
 
@@ -44,12 +63,22 @@ void GmmHelper::applyMocsEncryptionBit(uint32_t &index) {
     }
 }
 
-GmmHelper::GmmHelper(OSInterface *osInterface, const HardwareInfo *pHwInfo) : hwInfo(pHwInfo) {
+GmmHelper::GmmHelper(OSInterface *osInterface, const HardwareInfo *pHwInfo) : hwInfo(pHwInfo), osInterface(osInterface) {
     auto hwInfoAddressWidth = Math::log2(hwInfo->capabilityTable.gpuAddressSpace + 1);
     addressWidth = std::max(hwInfoAddressWidth, 48u);
 
-    gmmClientContext = GmmHelper::createGmmContextWrapperFunc(osInterface, const_cast<HardwareInfo *>(pHwInfo));
-    UNRECOVERABLE_IF(!gmmClientContext);
+    mocsCache.reset(new std::atomic<uint32_t>[GMM_RESOURCE_USAGE_MAX]);
+    for (uint32_t usage = 0; usage < GMM_RESOURCE_USAGE_MAX; usage++) {
+        mocsCache[usage] = invalidMocs;
+    }
+
+    if (DebugManager.flags.ImageResourceInfoCacheSize.get() > 0) {
+        imageResourceInfoCache = std::make_unique<ImageResourceInfoCache>(static_cast<size_t>(DebugManager.flags.ImageResourceInfoCacheSize.get()));
+    }
+
+    if (DebugManager.flags.DeferGmmClientContextCreation.get() != 1) {
+        std::call_once(gmmClientContextCreated, [this]() { createClientContext(); });
+    }
 }
 
 uint64_t GmmHelper::canonize(uint64_t address) {
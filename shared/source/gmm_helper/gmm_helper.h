@@ -7,10 +7,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <limits>
 #include <memory>
+#include <mutex>
 
 namespace NEO {
 class GmmClientContext;
+class ImageResourceInfoCache;
 class OSInterface;
 struct HardwareInfo;
 
@@ -36,13 +40,22 @@ class GmmHelper {
     bool isValidCanonicalGpuAddress(uint64_t address);
 
     GmmClientContext *getClientContext() const;
+    ImageResourceInfoCache *getImageResourceInfoCache() const { return imageResourceInfoCache.get(); }
 
     static std::unique_ptr<GmmClientContext> (*createGmmContextWrapperFunc)(OSInterface *, HardwareInfo *);
 
   protected:
+    static constexpr uint32_t invalidMocs = std::numeric_limits<uint32_t>::max();
+
+    void createClientContext() const;
+
     uint32_t addressWidth;
     const HardwareInfo *hwInfo = nullptr;
-    std::unique_ptr<GmmClientContext> gmmClientContext;
+    OSInterface *osInterface = nullptr;
+    mutable std::unique_ptr<GmmClientContext> gmmClientContext;
+    mutable std::once_flag gmmClientContextCreated;
+    mutable std::unique_ptr<std::atomic<uint32_t>[]> mocsCache;
+    std::unique_ptr<ImageResourceInfoCache> imageResourceInfoCache;
     bool allResourcesUncached = false;
 };
 } // namespace NEO
@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/gmm_helper/image_resource_info_cache.h"
+
+#include "shared/source/gmm_helper/resource_info.h"
+
+#include <cstring>
+
+namespace NEO {
+
+ImageResourceInfoCache::ImageResourceInfoCache(size_t maxEntriesCount) : maxEntriesCount(maxEntriesCount) {}
+
+ImageResourceInfoCache::~ImageResourceInfoCache() = default;
+
+bool ImageResourceInfoCache::isCacheable(const GMM_RESCREATE_PARAMS &resourceParams) {
+    return !resourceParams.Flags.Info.ExistingSysMem;
+}
+
+GmmResourceInfo *ImageResourceInfoCache::create(GmmClientContext *clientContext, GMM_RESCREATE_PARAMS *resourceParams) {
+    if (!isCacheable(*resourceParams)) {
+        return GmmResourceInfo::create(clientContext, resourceParams);
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto &entry : entries) {
+        if (memcmp(&entry.first, resourceParams, sizeof(GMM_RESCREATE_PARAMS)) == 0) {
+            return GmmResourceInfo::create(clientContext, entry.second->peekGmmResourceInfo());
+        }
+    }
+
+    auto resourceInfo = GmmResourceInfo::create(clientContext, resourceParams);
+    if (resourceInfo == nullptr) {
+        return nullptr;
+    }
+    if (entries.size() >= maxEntriesCount) {
+        entries.erase(entries.begin());
+    }
+    entries.emplace_back(*resourceParams, std::unique_ptr<GmmResourceInfo>(GmmResourceInfo::create(clientContext, resourceInfo->peekGmmResourceInfo())));
+    return resourceInfo;
+}
+
+} // namespace NEO
@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/gmm_helper/gmm_lib.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+class GmmClientContext;
+class GmmResourceInfo;
+
+// Keeps resource infos of recently created images keyed by their GMM create params. Images of the same
+// shape are created as copies of the cached resource info, layout is not computed by GMM again.
+class ImageResourceInfoCache : NonCopyableOrMovableClass {
+  public:
+    ImageResourceInfoCache(size_t maxEntriesCount);
+    ~ImageResourceInfoCache();
+
+    GmmResourceInfo *create(GmmClientContext *clientContext, GMM_RESCREATE_PARAMS *resourceParams);
+
+  protected:
+    static bool isCacheable(const GMM_RESCREATE_PARAMS &resourceParams);
+
+    const size_t maxEntriesCount;
+    std::vector<std::pair<GMM_RESCREATE_PARAMS, std::unique_ptr<GmmResourceInfo>>> entries;
+    std::mutex mutex;
+};
+} // namespace NEO
@@ -7,9 +7,11 @@
 
 #include "shared/source/helpers/bindless_heaps_helper.h"
 
+#include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/indirect_heap/indirect_heap.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
 
 namespace NEO {
 
@@ -53,19 +55,21 @@ GraphicsAllocation *BindlessHeapsHelper::getHeapAllocation(size_t heapSize, size
 
 SurfaceStateInHeapInfo BindlessHeapsHelper::allocateSSInHeap(size_t ssSize, GraphicsAllocation *surfaceAllocation, BindlesHeapType heapType) {
     auto heap = surfaceStateHeaps[heapType].get();
+    std::lock_guard<std::mutex> autolock(this->mtx);
     if (heapType == BindlesHeapType::GLOBAL_SSH) {
         auto ssAllocatedInfo = surfaceStateInHeapAllocationMap.find(surfaceAllocation);
         if (ssAllocatedInfo != surfaceStateInHeapAllocationMap.end()) {
             return *ssAllocatedInfo->second.get();
-        } else {
-            std::lock_guard<std::mutex> autolock(this->mtx);
-            if (surfaceStateInHeapVectorReuse.size()) {
-                SurfaceStateInHeapInfo surfaceStateFromVector = *(surfaceStateInHeapVectorReuse.back());
-                surfaceStateInHeapVectorReuse.pop_back();
-                std::pair<GraphicsAllocation *, std::unique_ptr<SurfaceStateInHeapInfo>> pair(surfaceAllocation, std::make_unique<SurfaceStateInHeapInfo>(surfaceStateFromVector));
-                surfaceStateInHeapAllocationMap.insert(std::move(pair));
-                return surfaceStateFromVector;
-            }
+        }
+        reclaimCompletedSurfaceStates();
+        auto &reuseVector = surfaceStateInHeapVectorReuse[ssSize];
+        if (reuseVector.size()) {
+            SurfaceStateInHeapInfo surfaceStateFromVector = *(reuseVector.back());
+            reuseVector.pop_back();
+            memset(surfaceStateFromVector.ssPtr, 0, ssSize);
+            std::pair<GraphicsAllocation *, std::unique_ptr<SurfaceStateInHeapInfo>> pair(surfaceAllocation, std::make_unique<SurfaceStateInHeapInfo>(surfaceStateFromVector));
+            surfaceStateInHeapAllocationMap.insert(std::move(pair));
+            return surfaceStateFromVector;
         }
     }
     void *ptrInHeap = getSpaceInHeap(ssSize, heapType);
@@ -73,11 +77,11 @@ SurfaceStateInHeapInfo BindlessHeapsHelper::allocateSSInHeap(size_t ssSize, Grap
     auto bindlessOffset = heap->getGraphicsAllocation()->getGpuAddress() - heap->getGraphicsAllocation()->getGpuBaseAddress() + heap->getUsed() - ssSize;
     SurfaceStateInHeapInfo bindlesInfo;
     if (heapType == BindlesHeapType::GLOBAL_SSH) {
-        std::pair<GraphicsAllocation *, std::unique_ptr<SurfaceStateInHeapInfo>> pair(surfaceAllocation, std::make_unique<SurfaceStateInHeapInfo>(SurfaceStateInHeapInfo{heap->getGraphicsAllocation(), bindlessOffset, ptrInHeap}));
+        std::pair<GraphicsAllocation *, std::unique_ptr<SurfaceStateInHeapInfo>> pair(surfaceAllocation, std::make_unique<SurfaceStateInHeapInfo>(SurfaceStateInHeapInfo{heap->getGraphicsAllocation(), bindlessOffset, ptrInHeap, ssSize}));
         bindlesInfo = *pair.second;
         surfaceStateInHeapAllocationMap.insert(std::move(pair));
     } else {
-        bindlesInfo = SurfaceStateInHeapInfo{heap->getGraphicsAllocation(), bindlessOffset, ptrInHeap};
+        bindlesInfo = SurfaceStateInHeapInfo{heap->getGraphicsAllocation(), bindlessOffset, ptrInHeap, ssSize};
     }
     return bindlesInfo;
 }
@@ -117,13 +121,54 @@ void BindlessHeapsHelper::growHeap(BindlesHeapType heapType) {
 }
 
 void BindlessHeapsHelper::placeSSAllocationInReuseVectorOnFreeMemory(GraphicsAllocation *gfxAllocation) {
+    std::lock_guard<std::mutex> autolock(this->mtx);
     auto ssAllocatedInfo = surfaceStateInHeapAllocationMap.find(gfxAllocation);
-    if (ssAllocatedInfo != surfaceStateInHeapAllocationMap.end()) {
-        std::lock_guard<std::mutex> autolock(this->mtx);
-        surfaceStateInHeapVectorReuse.push_back(std::move(ssAllocatedInfo->second));
-        surfaceStateInHeapAllocationMap.erase(ssAllocatedInfo);
+    if (ssAllocatedInfo == surfaceStateInHeapAllocationMap.end()) {
+        return;
+    }
+
+    // surface state may still be referenced by submissions that used the surface, slot is reused once they complete
+    PendingSurfaceStateInHeapInfo pendingSurfaceState;
+    pendingSurfaceState.surfaceStateInHeapInfo = std::move(ssAllocatedInfo->second);
+    for (auto &engine : memManager->getRegisteredEngines()) {
+        auto contextId = engine.osContext->getContextId();
+        if (gfxAllocation->isUsedByOsContext(contextId)) {
+            pendingSurfaceState.contextTaskCounts.push_back({contextId, gfxAllocation->getTaskCount(contextId)});
+        }
+    }
+    surfaceStateInHeapAllocationMap.erase(ssAllocatedInfo);
+
+    if (pendingSurfaceState.contextTaskCounts.empty()) {
+        auto ssSize = pendingSurfaceState.surfaceStateInHeapInfo->ssSize;
+        surfaceStateInHeapVectorReuse[ssSize].push_back(std::move(pendingSurfaceState.surfaceStateInHeapInfo));
+    } else {
+        surfaceStateInHeapPendingReuse.push_back(std::move(pendingSurfaceState));
+    }
+}
+
+void BindlessHeapsHelper::reclaimCompletedSurfaceStates() {
+    for (auto it = surfaceStateInHeapPendingReuse.begin(); it != surfaceStateInHeapPendingReuse.end();) {
+        if (isSurfaceStateIdle(*it)) {
+            auto ssSize = it->surfaceStateInHeapInfo->ssSize;
+            surfaceStateInHeapVectorReuse[ssSize].push_back(std::move(it->surfaceStateInHeapInfo));
+            it = surfaceStateInHeapPendingReuse.erase(it);
+        } else {
+            it++;
+        }
+    }
+}
+
+bool BindlessHeapsHelper::isSurfaceStateIdle(const PendingSurfaceStateInHeapInfo &pendingSurfaceState) {
+    auto &registeredEngines = memManager->getRegisteredEngines();
+    for (auto &contextTaskCount : pendingSurfaceState.contextTaskCounts) {
+        for (auto &engine : registeredEngines) {
+            if (engine.osContext->getContextId() == contextTaskCount.first &&
+                !engine.commandStreamReceiver->testTaskCountReady(engine.commandStreamReceiver->getTagAddress(), contextTaskCount.second)) {
+                return false;
+            }
+        }
     }
-    return;
+    return true;
 }
 
-} // namespace NEO
\ No newline at end of file
+} // namespace NEO
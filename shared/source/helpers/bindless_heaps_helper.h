@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/heap_helper.h"
+#include "shared/source/utilities/stackvec.h"
 
 #include <memory>
 #include <mutex>
@@ -23,6 +24,7 @@ struct SurfaceStateInHeapInfo {
     GraphicsAllocation *heapAllocation;
     uint64_t surfaceStateOffset;
     void *ssPtr;
+    size_t ssSize = 0;
 };
 
 class BindlessHeapsHelper {
@@ -51,14 +53,22 @@ class BindlessHeapsHelper {
     void placeSSAllocationInReuseVectorOnFreeMemory(GraphicsAllocation *gfxAllocation);
 
   protected:
+    struct PendingSurfaceStateInHeapInfo {
+        std::unique_ptr<SurfaceStateInHeapInfo> surfaceStateInHeapInfo;
+        StackVec<std::pair<uint32_t, uint32_t>, 4> contextTaskCounts;
+    };
+
     void growHeap(BindlesHeapType heapType);
+    void reclaimCompletedSurfaceStates();
+    bool isSurfaceStateIdle(const PendingSurfaceStateInHeapInfo &pendingSurfaceState);
     MemoryManager *memManager = nullptr;
     bool isMultiOsContextCapable = false;
     const uint32_t rootDeviceIndex;
     std::unique_ptr<IndirectHeap> surfaceStateHeaps[BindlesHeapType::NUM_HEAP_TYPES];
     GraphicsAllocation *borderColorStates;
     std::vector<GraphicsAllocation *> ssHeapsAllocations;
-    std::vector<std::unique_ptr<SurfaceStateInHeapInfo>> surfaceStateInHeapVectorReuse;
+    std::unordered_map<size_t, std::vector<std::unique_ptr<SurfaceStateInHeapInfo>>> surfaceStateInHeapVectorReuse;
+    std::vector<PendingSurfaceStateInHeapInfo> surfaceStateInHeapPendingReuse;
     std::unordered_map<GraphicsAllocation *, std::unique_ptr<SurfaceStateInHeapInfo>> surfaceStateInHeapAllocationMap;
     std::mutex mtx;
     DeviceBitfield deviceBitfield;
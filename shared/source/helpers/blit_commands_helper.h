@@ -14,6 +14,7 @@
 #include "shared/source/helpers/vec.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <array>
 #include <cstdint>
 #include <functional>
 
@@ -83,13 +84,15 @@ struct BlitProperties {
     Vec3<size_t> dstSize = 0;
     Vec3<size_t> srcSize = 0;
     size_t bytesPerPixel = 1;
+    std::array<uint32_t, 4> fillPattern = {};
     GMM_YUV_PLANE_ENUM dstPlane = GMM_YUV_PLANE_ENUM::GMM_NO_PLANE;
     GMM_YUV_PLANE_ENUM srcPlane = GMM_YUV_PLANE_ENUM::GMM_NO_PLANE;
 
     bool isImageOperation() const {
         return blitDirection == BlitterConstants::BlitDirection::HostPtrToImage ||
                blitDirection == BlitterConstants::BlitDirection::ImageToHostPtr ||
-               blitDirection == BlitterConstants::BlitDirection::ImageToImage;
+               blitDirection == BlitterConstants::BlitDirection::ImageToImage ||
+               blitDirection == BlitterConstants::BlitDirection::ImageFill;
     }
 };
 
@@ -141,7 +144,11 @@ struct BlitCommandsHelper {
     static void dispatchBlitCommandsForBufferRegion(const BlitProperties &blitProperties, LinearStream &linearStream, const RootDeviceEnvironment &rootDeviceEnvironment);
     static void dispatchBlitCommandsForBufferPerRow(const BlitProperties &blitProperties, LinearStream &linearStream, const RootDeviceEnvironment &rootDeviceEnvironment);
     static void dispatchBlitCommandsForImageRegion(const BlitProperties &blitProperties, LinearStream &linearStream, const RootDeviceEnvironment &rootDeviceEnvironment);
+    static void dispatchBlitCommandsForImageFill(const BlitProperties &blitProperties, LinearStream &linearStream, const RootDeviceEnvironment &rootDeviceEnvironment);
+    static bool isImageFillSupported();
     static void dispatchBlitMemoryColorFill(NEO::GraphicsAllocation *dstAlloc, uint64_t offset, uint32_t *pattern, size_t patternSize, LinearStream &linearStream, size_t size, const RootDeviceEnvironment &rootDeviceEnvironment);
+    static void dispatchBlitMemoryPatternFill(NEO::GraphicsAllocation *dstAlloc, uint64_t offset, NEO::GraphicsAllocation *patternAlloc, size_t patternAllocSize, LinearStream &linearStream, size_t size,
+                                              GraphicsAllocation *clearColorAllocation, const RootDeviceEnvironment &rootDeviceEnvironment);
     template <size_t patternSize>
     static void dispatchBlitMemoryFill(NEO::GraphicsAllocation *dstAlloc, uint64_t offset, uint32_t *pattern, LinearStream &linearStream, size_t size, const RootDeviceEnvironment &rootDeviceEnvironment, COLOR_DEPTH depth);
 
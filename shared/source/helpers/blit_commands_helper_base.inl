@@ -231,6 +231,30 @@ void BlitCommandsHelper<GfxFamily>::dispatchBlitCommandsForBufferPerRow(const Bl
     }
 }
 
+// Fills memory with pattern not supported natively by blitter. Pattern replicated in staging allocation is copied once,
+// then already filled part of destination is doubled with copies, each copy waits for the previous one.
+template <typename GfxFamily>
+void BlitCommandsHelper<GfxFamily>::dispatchBlitMemoryPatternFill(NEO::GraphicsAllocation *dstAlloc, uint64_t offset, NEO::GraphicsAllocation *patternAlloc, size_t patternAllocSize, LinearStream &linearStream, size_t size,
+                                                                  GraphicsAllocation *clearColorAllocation, const RootDeviceEnvironment &rootDeviceEnvironment) {
+    const auto &hwInfo = *rootDeviceEnvironment.getHardwareInfo();
+    size_t filledSize = std::min(size, patternAllocSize);
+
+    auto blitProperties = BlitProperties::constructPropertiesForCopy(dstAlloc, patternAlloc, {static_cast<size_t>(offset), 0, 0}, {0, 0, 0}, {filledSize, 0, 0},
+                                                                     0, 0, 0, 0, clearColorAllocation);
+    dispatchBlitCommandsForBufferPerRow(blitProperties, linearStream, rootDeviceEnvironment);
+
+    while (filledSize < size) {
+        MiFlushArgs args;
+        EncodeMiFlushDW<GfxFamily>::programMiFlushDw(linearStream, 0, 0, args, hwInfo);
+
+        auto copySize = std::min(filledSize, size - filledSize);
+        blitProperties = BlitProperties::constructPropertiesForCopy(dstAlloc, dstAlloc, {static_cast<size_t>(offset) + filledSize, 0, 0}, {static_cast<size_t>(offset), 0, 0}, {copySize, 0, 0},
+                                                                    0, 0, 0, 0, clearColorAllocation);
+        dispatchBlitCommandsForBufferPerRow(blitProperties, linearStream, rootDeviceEnvironment);
+        filledSize += copySize;
+    }
+}
+
 template <typename GfxFamily>
 template <size_t patternSize>
 void BlitCommandsHelper<GfxFamily>::dispatchBlitMemoryFill(NEO::GraphicsAllocation *dstAlloc, uint64_t offset, uint32_t *pattern, LinearStream &linearStream, size_t size, const RootDeviceEnvironment &rootDeviceEnvironment, COLOR_DEPTH depth) {
@@ -343,7 +367,9 @@ uint32_t BlitCommandsHelper<GfxFamily>::getAvailableBytesPerPixel(size_t copySiz
 
 template <typename GfxFamily>
 void BlitCommandsHelper<GfxFamily>::dispatchBlitCommands(const BlitProperties &blitProperties, LinearStream &linearStream, const RootDeviceEnvironment &rootDeviceEnvironment) {
-    if (blitProperties.isImageOperation()) {
+    if (blitProperties.blitDirection == BlitterConstants::BlitDirection::ImageFill) {
+        dispatchBlitCommandsForImageFill(blitProperties, linearStream, rootDeviceEnvironment);
+    } else if (blitProperties.isImageOperation()) {
         dispatchBlitCommandsForImageRegion(blitProperties, linearStream, rootDeviceEnvironment);
     } else {
         bool preferCopyBufferRegion = isCopyRegionPreferred(blitProperties.copySize, rootDeviceEnvironment);
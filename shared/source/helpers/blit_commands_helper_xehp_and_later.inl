@@ -171,6 +171,113 @@ void BlitCommandsHelper<GfxFamily>::dispatchBlitMemoryColorFill(NEO::GraphicsAll
     }
 }
 
+// Fills region of tiled or linear image with XY_FAST_COLOR_BLT, one command per slice
+template <typename GfxFamily>
+void BlitCommandsHelper<GfxFamily>::dispatchBlitCommandsForImageFill(const BlitProperties &blitProperties, LinearStream &linearStream, const RootDeviceEnvironment &rootDeviceEnvironment) {
+    using XY_COLOR_BLT = typename GfxFamily::XY_COLOR_BLT;
+
+    UNRECOVERABLE_IF(blitProperties.copySize.x > BlitterConstants::maxBlitWidth || blitProperties.copySize.y > BlitterConstants::maxBlitHeight);
+    auto dstAllocation = blitProperties.dstAllocation;
+    auto blitCmd = GfxFamily::cmdInitXyColorBlt;
+
+    blitCmd.setFillColor(blitProperties.fillPattern.data());
+    switch (blitProperties.bytesPerPixel) {
+    default:
+        UNRECOVERABLE_IF(true);
+        break;
+    case 1:
+        blitCmd.setColorDepth(XY_COLOR_BLT::COLOR_DEPTH::COLOR_DEPTH_8_BIT_COLOR);
+        break;
+    case 2:
+        blitCmd.setColorDepth(XY_COLOR_BLT::COLOR_DEPTH::COLOR_DEPTH_16_BIT_COLOR);
+        break;
+    case 4:
+        blitCmd.setColorDepth(XY_COLOR_BLT::COLOR_DEPTH::COLOR_DEPTH_32_BIT_COLOR);
+        break;
+    case 8:
+        blitCmd.setColorDepth(XY_COLOR_BLT::COLOR_DEPTH::COLOR_DEPTH_64_BIT_COLOR);
+        break;
+    case 16:
+        blitCmd.setColorDepth(XY_COLOR_BLT::COLOR_DEPTH::COLOR_DEPTH_128_BIT_COLOR);
+        break;
+    }
+
+    blitCmd.setDestinationX1CoordinateLeft(static_cast<uint32_t>(blitProperties.dstOffset.x));
+    blitCmd.setDestinationY1CoordinateTop(static_cast<uint32_t>(blitProperties.dstOffset.y));
+    blitCmd.setDestinationX2CoordinateRight(static_cast<uint32_t>(blitProperties.dstOffset.x + blitProperties.copySize.x));
+    blitCmd.setDestinationY2CoordinateBottom(static_cast<uint32_t>(blitProperties.dstOffset.y + blitProperties.copySize.y));
+
+    auto tileType = GMM_NOT_TILED;
+    auto rowPitch = static_cast<uint32_t>(blitProperties.dstRowPitch);
+    auto qPitch = static_cast<uint32_t>(blitProperties.dstSize.y);
+    auto mipTailLod = 0u;
+    auto compressionFormat = blitCmd.getDestinationCompressionFormat();
+    auto compressionType = 0u;
+    getBlitAllocationProperties(*dstAllocation, rowPitch, qPitch, tileType, mipTailLod, compressionFormat,
+                                compressionType, rootDeviceEnvironment, blitProperties.dstPlane);
+    auto slicePitch = std::max(static_cast<uint32_t>(blitProperties.dstSlicePitch), rowPitch * qPitch);
+
+    if (tileType == GMM_TILED_4) {
+        blitCmd.setDestinationTiling(XY_COLOR_BLT::DESTINATION_TILING::DESTINATION_TILING_TILE4);
+    } else if (tileType == GMM_TILED_64) {
+        blitCmd.setDestinationTiling(XY_COLOR_BLT::DESTINATION_TILING::DESTINATION_TILING_TILE64);
+    } else {
+        blitCmd.setDestinationTiling(XY_COLOR_BLT::DESTINATION_TILING::DESTINATION_TILING_LINEAR);
+    }
+    blitCmd.setDestinationPitch(tileType == GMM_NOT_TILED ? rowPitch : rowPitch / 4);
+    blitCmd.setDestinationSurfaceQpitch(qPitch / 4);
+    blitCmd.setDestinationMipTailStartLOD(mipTailLod);
+    blitCmd.setDestinationSurfaceWidth(static_cast<uint32_t>(blitProperties.dstSize.x));
+    blitCmd.setDestinationSurfaceHeight(static_cast<uint32_t>(blitProperties.dstSize.y));
+    blitCmd.setDestinationSurfaceDepth(static_cast<uint32_t>(blitProperties.dstSize.z));
+
+    if (dstAllocation->getDefaultGmm()) {
+        auto resInfo = dstAllocation->getDefaultGmm()->gmmResourceInfo.get();
+        auto resourceType = resInfo->getResourceType();
+        if (resourceType == GMM_RESOURCE_TYPE::RESOURCE_1D && resInfo->getArraySize() <= 1) {
+            blitCmd.setDestinationSurfaceType(XY_COLOR_BLT::DESTINATION_SURFACE_TYPE::DESTINATION_SURFACE_TYPE_1D);
+        } else if (resourceType == GMM_RESOURCE_TYPE::RESOURCE_3D) {
+            blitCmd.setDestinationSurfaceType(XY_COLOR_BLT::DESTINATION_SURFACE_TYPE::DESTINATION_SURFACE_TYPE_3D);
+        } else {
+            blitCmd.setDestinationSurfaceType(XY_COLOR_BLT::DESTINATION_SURFACE_TYPE::DESTINATION_SURFACE_TYPE_2D);
+        }
+    }
+
+    if (dstAllocation->isCompressionEnabled()) {
+        setCompressionParamsForFillOperation<GfxFamily>(blitCmd);
+        blitCmd.setDestinationCompressionFormat(compressionFormat);
+    }
+
+    blitCmd.setDestinationTargetMemory(dstAllocation->isAllocatedInLocalMemoryPool() ? XY_COLOR_BLT::DESTINATION_TARGET_MEMORY::DESTINATION_TARGET_MEMORY_LOCAL_MEM
+                                                                                     : XY_COLOR_BLT::DESTINATION_TARGET_MEMORY::DESTINATION_TARGET_MEMORY_SYSTEM_MEM);
+    blitCmd.setDestinationMOCS(rootDeviceEnvironment.getGmmHelper()->getMOCS(GMM_RESOURCE_USAGE_OCL_BUFFER_CACHELINE_MISALIGNED));
+    if (DebugManager.flags.OverrideBlitterMocs.get() != -1) {
+        blitCmd.setDestinationMOCS(DebugManager.flags.OverrideBlitterMocs.get());
+    }
+    appendExtraMemoryProperties(blitCmd, rootDeviceEnvironment);
+
+    const auto &hwInfo = *rootDeviceEnvironment.getHardwareInfo();
+    dispatchPreBlitCommand(linearStream, hwInfo);
+    for (uint32_t i = 0; i < blitProperties.copySize.z; i++) {
+        auto tmpCmd = blitCmd;
+        auto slice = i + static_cast<uint32_t>(blitProperties.dstOffset.z);
+        if (tileType == GMM_NOT_TILED) {
+            tmpCmd.setDestinationBaseAddress(ptrOffset(blitProperties.dstGpuAddress, static_cast<size_t>(slicePitch) * slice));
+        } else {
+            tmpCmd.setDestinationBaseAddress(blitProperties.dstGpuAddress);
+            tmpCmd.setDestinationArrayIndex(slice + 1);
+        }
+        auto cmd = linearStream.getSpaceForCmd<XY_COLOR_BLT>();
+        *cmd = tmpCmd;
+        dispatchPostBlitCommand(linearStream, hwInfo);
+    }
+}
+
+template <typename GfxFamily>
+bool BlitCommandsHelper<GfxFamily>::isImageFillSupported() {
+    return true;
+}
+
 template <typename GfxFamily>
 void BlitCommandsHelper<GfxFamily>::appendSurfaceType(const BlitProperties &blitProperties, typename GfxFamily::XY_BLOCK_COPY_BLT &blitCmd) {
     using XY_BLOCK_COPY_BLT = typename GfxFamily::XY_BLOCK_COPY_BLT;
@@ -74,7 +74,8 @@ enum class BlitDirection : uint32_t {
     BufferToBuffer,
     HostPtrToImage,
     ImageToHostPtr,
-    ImageToImage
+    ImageToImage,
+    ImageFill
 };
 
 enum PostBlitMode : int32_t {
@@ -23,11 +23,17 @@ std::string engineUsageToString(EngineUsage usage) {
         return "Internal";
     case EngineUsage::Cooperative:
         return "Cooperative";
+    case EngineUsage::HighPriority:
+        return "HighPriority";
     default:
         return "Unknown";
     }
 }
 
+bool isHighPriorityContextEnabled() {
+    return DebugManager.flags.CreateHighPriorityContext.get() == 1;
+}
+
 std::string engineTypeToString(aub_stream::EngineType engineType) {
     switch (engineType) {
     case aub_stream::EngineType::ENGINE_RCS:
@@ -26,6 +26,7 @@ enum class EngineUsage : uint32_t {
     LowPriority,
     Internal,
     Cooperative,
+    HighPriority,
 
     EngineUsageCount,
 };
@@ -57,6 +58,7 @@ aub_stream::EngineType mapBcsIndexToEngineType(uint32_t index, bool includeMainC
 aub_stream::EngineType mapCcsIndexToEngineType(uint32_t index);
 std::string engineTypeToString(aub_stream::EngineType engineType);
 std::string engineUsageToString(EngineUsage usage);
+bool isHighPriorityContextEnabled();
 
 bool isBcsEnabled(const HardwareInfo &hwInfo, aub_stream::EngineType engineType);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,10 +33,10 @@ std::unique_ptr<char[]> loadDataFromFile(
         ret.reset(new (std::nothrow) char[nsize + 1]);
 
         if (ret) {
-            // we initialize to all zeroes before reading in data
-            memset(ret.get(), 0x00, nsize + 1);
+            // whole buffer is overwritten by file contents, only terminate it
             [[maybe_unused]] auto read = fread(ret.get(), sizeof(unsigned char), nsize, fp);
             DEBUG_BREAK_IF(read != nsize);
+            memset(ret.get() + read, 0x00, nsize + 1 - read);
         } else {
             nsize = 0;
         }
@@ -6,8 +6,11 @@
  */
 
 #pragma once
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 namespace NEO {
 // clang-format off
@@ -104,6 +107,162 @@ class Hash {
     uint32_t a, hi, lo;
 };
 
+// 128-bit hash of large inputs e.g. compiler cache keys. Input is consumed in 32-byte stripes by four
+// independent 64-bit multiply-rotate lanes, which keeps several multiplies in flight per cycle.
+class FastHash {
+  public:
+    static constexpr size_t laneSize = sizeof(uint64_t);
+    static constexpr size_t lanesCount = 4u;
+    static constexpr size_t stripeSize = laneSize * lanesCount;
+
+    struct Digest {
+        uint64_t low = 0u;
+        uint64_t high = 0u;
+
+        bool operator==(const Digest &rhs) const { return low == rhs.low && high == rhs.high; }
+        bool operator!=(const Digest &rhs) const { return !(*this == rhs); }
+    };
+
+    FastHash() {
+        reset();
+    }
+
+    void reset() {
+        lanes = {prime1 + prime2, prime2, 0u, 0u - prime1};
+        bufferUsed = 0u;
+        totalSize = 0u;
+    }
+
+    void update(const char *buff, size_t size) {
+        if (buff == nullptr) {
+            return;
+        }
+        totalSize += size;
+
+        if (bufferUsed > 0u) {
+            auto bytesToCopy = std::min(stripeSize - bufferUsed, size);
+            memcpy(buffer.data() + bufferUsed, buff, bytesToCopy);
+            bufferUsed += bytesToCopy;
+            buff += bytesToCopy;
+            size -= bytesToCopy;
+            if (bufferUsed < stripeSize) {
+                return;
+            }
+            processStripe(buffer.data());
+            bufferUsed = 0u;
+        }
+
+        while (size >= stripeSize) {
+            processStripe(buff);
+            buff += stripeSize;
+            size -= stripeSize;
+        }
+
+        if (size > 0u) {
+            memcpy(buffer.data(), buff, size);
+            bufferUsed = size;
+        }
+    }
+
+    Digest finish() const {
+        uint64_t low = prime5;
+        uint64_t high = prime4;
+        if (totalSize >= stripeSize) {
+            low = rotl(lanes[0], 1) + rotl(lanes[1], 7) + rotl(lanes[2], 12) + rotl(lanes[3], 18);
+            high = rotl(lanes[0], 18) + rotl(lanes[1], 12) + rotl(lanes[2], 7) + rotl(lanes[3], 1);
+            for (size_t lane = 0; lane < lanesCount; lane++) {
+                low = mergeRound(low, lanes[lane]);
+                high = mergeRound(high, lanes[lanesCount - 1 - lane]);
+            }
+        }
+        low += totalSize;
+        high ^= totalSize * prime1;
+
+        auto tail = buffer.data();
+        auto tailSize = bufferUsed;
+        while (tailSize >= laneSize) {
+            auto value = round(0u, read64(tail));
+            low = rotl(low ^ value, 27) * prime1 + prime4;
+            high = rotl(high ^ rotl(value, 29), 31) * prime2 + prime3;
+            tail += laneSize;
+            tailSize -= laneSize;
+        }
+        if (tailSize >= sizeof(uint32_t)) {
+            uint32_t value = 0u;
+            memcpy(&value, tail, sizeof(value));
+            low = rotl(low ^ (value * prime1), 23) * prime2 + prime3;
+            high = rotl(high ^ (value * prime2), 19) * prime1 + prime4;
+            tail += sizeof(uint32_t);
+            tailSize -= sizeof(uint32_t);
+        }
+        while (tailSize > 0u) {
+            uint64_t value = static_cast<unsigned char>(*tail);
+            low = rotl(low ^ (value * prime5), 11) * prime1;
+            high = rotl(high ^ (value * prime3), 13) * prime2;
+            tail++;
+            tailSize--;
+        }
+
+        Digest digest;
+        digest.low = avalanche(low);
+        digest.high = avalanche(high + digest.low);
+        return digest;
+    }
+
+    static Digest hash(const char *buff, size_t size) {
+        FastHash hash;
+        hash.update(buff, size);
+        return hash.finish();
+    }
+
+  protected:
+    static constexpr uint64_t prime1 = 0x9E3779B185EBCA87ull;
+    static constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4Full;
+    static constexpr uint64_t prime3 = 0x165667B19E3779F9ull;
+    static constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ull;
+    static constexpr uint64_t prime5 = 0x27D4EB2F165667C5ull;
+
+    static uint64_t rotl(uint64_t value, uint32_t shift) {
+        return (value << shift) | (value >> (64u - shift));
+    }
+
+    static uint64_t read64(const char *data) {
+        uint64_t value = 0u;
+        memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    static uint64_t round(uint64_t accumulator, uint64_t input) {
+        accumulator += input * prime2;
+        return rotl(accumulator, 31) * prime1;
+    }
+
+    static uint64_t mergeRound(uint64_t accumulator, uint64_t lane) {
+        accumulator ^= round(0u, lane);
+        return accumulator * prime1 + prime4;
+    }
+
+    static uint64_t avalanche(uint64_t value) {
+        value ^= value >> 33;
+        value *= prime2;
+        value ^= value >> 29;
+        value *= prime3;
+        value ^= value >> 32;
+        return value;
+    }
+
+    void processStripe(const char *stripe) {
+        for (size_t lane = 0; lane < lanesCount; lane++) {
+            lanes[lane] = round(lanes[lane], read64(stripe + lane * laneSize));
+        }
+    }
+
+    std::array<uint64_t, lanesCount> lanes;
+    std::array<char, stripeSize> buffer;
+    size_t bufferUsed;
+    uint64_t totalSize;
+};
+
 template <typename T>
 uint32_t hashPtrToU32(const T *src) {
     auto asInt = reinterpret_cast<uintptr_t>(src);
@@ -8,7 +8,9 @@
 #include "shared/source/helpers/per_thread_data.h"
 
 #include "shared/source/command_stream/linear_stream.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/string.h"
 #include "shared/source/kernel/kernel_descriptor.h"
 
 #include <array>
@@ -22,7 +24,8 @@ size_t PerThreadDataHelper::sendPerThreadData(
     uint32_t numChannels,
     const std::array<uint16_t, 3> &localWorkSizes,
     const std::array<uint8_t, 3> &workgroupWalkOrder,
-    bool hasKernelOnlyImages) {
+    bool hasKernelOnlyImages,
+    PerThreadDataCache *perThreadDataCache) {
     auto offsetPerThreadData = indirectHeap.getUsed();
     if (numChannels) {
         size_t localWorkSize = static_cast<size_t>(localWorkSizes[0]) * static_cast<size_t>(localWorkSizes[1]) * static_cast<size_t>(localWorkSizes[2]);
@@ -31,7 +34,15 @@ size_t PerThreadDataHelper::sendPerThreadData(
 
         // Generate local IDs
         DEBUG_BREAK_IF(numChannels != 3);
-        generateLocalIDs(pDest, static_cast<uint16_t>(simd), localWorkSizes, workgroupWalkOrder, hasKernelOnlyImages, grfSize);
+        if (perThreadDataCache && PerThreadDataCache::isEnabled()) {
+            if (perThreadDataCache->copy(pDest, sizePerThreadDataTotal, simd, grfSize, localWorkSizes, workgroupWalkOrder, hasKernelOnlyImages)) {
+                return offsetPerThreadData;
+            }
+            generateLocalIDs(pDest, static_cast<uint16_t>(simd), localWorkSizes, workgroupWalkOrder, hasKernelOnlyImages, grfSize);
+            perThreadDataCache->store(pDest, sizePerThreadDataTotal, simd, grfSize, localWorkSizes, workgroupWalkOrder, hasKernelOnlyImages);
+        } else {
+            generateLocalIDs(pDest, static_cast<uint16_t>(simd), localWorkSizes, workgroupWalkOrder, hasKernelOnlyImages, grfSize);
+        }
     }
     return offsetPerThreadData;
 }
@@ -45,4 +56,36 @@ uint32_t PerThreadDataHelper::getThreadPayloadSize(const KernelDescriptor &kerne
     threadPayloadSize += (kernelDescriptor.kernelAttributes.flags.perThreadDataUnusedGrfIsPresent) ? grfSize : 0;
     return threadPayloadSize;
 }
+
+bool PerThreadDataCache::isEnabled() {
+    return DebugManager.flags.EnablePerThreadDataCache.get() != 0;
+}
+
+bool PerThreadDataCache::copy(void *destination, size_t size, uint32_t simd, uint32_t grfSize, const std::array<uint16_t, 3> &localWorkSizes,
+                              const std::array<uint8_t, 3> &workgroupWalkOrder, bool hasKernelOnlyImages) {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (const auto &entry : entries) {
+        if (entry.size == size && entry.simd == simd && entry.grfSize == grfSize && entry.localWorkSizes == localWorkSizes &&
+            entry.workgroupWalkOrder == workgroupWalkOrder && entry.hasKernelOnlyImages == hasKernelOnlyImages) {
+            memcpy_s(destination, size, entry.data.get(), entry.size);
+            return true;
+        }
+    }
+    return false;
+}
+
+void PerThreadDataCache::store(const void *source, size_t size, uint32_t simd, uint32_t grfSize, const std::array<uint16_t, 3> &localWorkSizes,
+                               const std::array<uint8_t, 3> &workgroupWalkOrder, bool hasKernelOnlyImages) {
+    Entry newEntry = {localWorkSizes, workgroupWalkOrder, simd, grfSize, hasKernelOnlyImages, size, std::make_unique<uint8_t[]>(size)};
+    memcpy_s(newEntry.data.get(), size, source, size);
+
+    std::lock_guard<std::mutex> lock(mtx);
+    if (entries.size() < maxEntries) {
+        entries.push_back(std::move(newEntry));
+        return;
+    }
+    entries[nextEvictedEntry] = std::move(newEntry);
+    nextEvictedEntry = (nextEvictedEntry + 1) % maxEntries;
+}
+
 } // namespace NEO
@@ -7,17 +7,48 @@
 
 #pragma once
 #include "shared/source/helpers/local_id_gen.h"
+#include "shared/source/utilities/stackvec.h"
 
 #include "patch_shared.h"
 
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <mutex>
 
 namespace NEO {
 class LinearStream;
 struct KernelDescriptor;
 
+// Per-thread local IDs generated for recently used work group shapes, copied to indirect heap on repeated launches
+class PerThreadDataCache {
+  public:
+    static constexpr size_t maxEntries = 4u;
+
+    static bool isEnabled();
+
+    bool copy(void *destination, size_t size, uint32_t simd, uint32_t grfSize, const std::array<uint16_t, 3> &localWorkSizes,
+              const std::array<uint8_t, 3> &workgroupWalkOrder, bool hasKernelOnlyImages);
+    void store(const void *source, size_t size, uint32_t simd, uint32_t grfSize, const std::array<uint16_t, 3> &localWorkSizes,
+               const std::array<uint8_t, 3> &workgroupWalkOrder, bool hasKernelOnlyImages);
+
+  protected:
+    struct Entry {
+        std::array<uint16_t, 3> localWorkSizes;
+        std::array<uint8_t, 3> workgroupWalkOrder;
+        uint32_t simd;
+        uint32_t grfSize;
+        bool hasKernelOnlyImages;
+        size_t size;
+        std::unique_ptr<uint8_t[]> data;
+    };
+
+    std::mutex mtx;
+    StackVec<Entry, maxEntries> entries;
+    size_t nextEvictedEntry = 0u;
+};
+
 struct PerThreadDataHelper {
     static inline uint32_t getLocalIdSizePerThread(
         uint32_t simd,
@@ -41,7 +72,8 @@ struct PerThreadDataHelper {
         uint32_t numChannels,
         const std::array<uint16_t, 3> &localWorkSizes,
         const std::array<uint8_t, 3> &workgroupWalkOrder,
-        bool hasKernelOnlyImages);
+        bool hasKernelOnlyImages,
+        PerThreadDataCache *perThreadDataCache = nullptr);
 
     static uint32_t getThreadPayloadSize(const KernelDescriptor &kernelDescriptor, uint32_t grfSize);
 };
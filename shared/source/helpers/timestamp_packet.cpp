@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/linear_stream.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/utilities/tag_allocator.h"
 
 using namespace NEO;
@@ -18,11 +19,35 @@ void TimestampPacketContainer::add(TagNodeBase *timestampPacketNode) {
 }
 
 TimestampPacketContainer::~TimestampPacketContainer() {
+    if (DebugManager.flags.EnableBatchedTimestampPacketReturn.get() == 1) {
+        returnNodesInBatches();
+        return;
+    }
     for (auto node : timestampPacketNodes) {
         node->returnTag();
     }
 }
 
+void TimestampPacketContainer::returnNodesInBatches() {
+    size_t batchStart = 0;
+    while (batchStart < timestampPacketNodes.size()) {
+        auto allocator = timestampPacketNodes[batchStart]->getAllocator();
+        size_t batchEnd = batchStart + 1;
+        while (batchEnd < timestampPacketNodes.size() && timestampPacketNodes[batchEnd]->getAllocator() == allocator) {
+            batchEnd++;
+        }
+
+        if (allocator) {
+            allocator->returnTags(ArrayRef<TagNodeBase *const>(&timestampPacketNodes[batchStart], batchEnd - batchStart));
+        } else {
+            for (auto i = batchStart; i < batchEnd; i++) {
+                timestampPacketNodes[i]->returnTag();
+            }
+        }
+        batchStart = batchEnd;
+    }
+}
+
 void TimestampPacketContainer::swapNodes(TimestampPacketContainer &timestampPacketContainer) {
     timestampPacketNodes.swap(timestampPacketContainer.timestampPacketNodes);
 }
@@ -16,6 +16,7 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/utilities/tag_allocator.h"
 
+#include <algorithm>
 #include <cstdint>
 
 namespace NEO {
@@ -72,6 +73,26 @@ class TimestampPackets : public TagTypeBase {
     void const *getContextEndAddress(uint32_t packetIndex) const { return static_cast<void const *>(&packets[packetIndex].contextEnd); }
     void const *getContextStartAddress(uint32_t packetIndex) const { return static_cast<void const *>(&packets[packetIndex].contextStart); }
 
+    // Reductions below walk the contiguous packet array without early exits, so the loops can be vectorized
+    bool isCompleted(uint32_t packetsUsed) const {
+        bool completed = true;
+        for (uint32_t i = 0; i < packetsUsed; i++) {
+            completed &= (packets[i].contextEnd != 1u);
+        }
+        return completed;
+    }
+
+    void getGlobalStartEndRange(uint32_t packetsUsed, uint64_t &globalStart, uint64_t &globalEnd) const {
+        TSize minGlobalStart = packets[0].globalStart;
+        TSize maxGlobalEnd = packets[0].globalEnd;
+        for (uint32_t i = 1; i < packetsUsed; i++) {
+            minGlobalStart = std::min(minGlobalStart, packets[i].globalStart);
+            maxGlobalEnd = std::max(maxGlobalEnd, packets[i].globalEnd);
+        }
+        globalStart = static_cast<uint64_t>(minGlobalStart);
+        globalEnd = static_cast<uint64_t>(maxGlobalEnd);
+    }
+
   protected:
     Packet packets[TimestampPacketSizeControl::preferredPacketCount];
 };
@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/work_group_size_cache.h"
+
+#include "shared/source/compiler_interface/default_cache_config.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/file_io.h"
+
+#include "os_inc.h"
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <sstream>
+
+namespace NEO {
+
+uint32_t WorkGroupSizeCacheKey::getCurrentAlgorithm() {
+    return (DebugManager.flags.EnableComputeWorkSizeND.get() ? 1u : 0u) |
+           (DebugManager.flags.EnableComputeWorkSizeSquared.get() ? 2u : 0u);
+}
+
+bool WorkGroupSizeCache::isEnabled() {
+    return DebugManager.flags.EnableWorkGroupSizeCache.get() != 0;
+}
+
+bool WorkGroupSizeCache::find(const WorkGroupSizeCacheKey &key, size_t workGroupSize[3]) {
+    std::lock_guard<std::mutex> lock(mtx);
+    for (const auto &entry : entries) {
+        if (entry.key == key) {
+            workGroupSize[0] = entry.workGroupSize[0];
+            workGroupSize[1] = entry.workGroupSize[1];
+            workGroupSize[2] = entry.workGroupSize[2];
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkGroupSizeCache::store(const WorkGroupSizeCacheKey &key, const size_t workGroupSize[3]) {
+    std::lock_guard<std::mutex> lock(mtx);
+    Entry newEntry = {key, {workGroupSize[0], workGroupSize[1], workGroupSize[2]}};
+    if (entries.size() < maxEntries) {
+        entries.push_back(newEntry);
+        return;
+    }
+    entries[nextEvictedEntry] = newEntry;
+    nextEvictedEntry = (nextEvictedEntry + 1) % maxEntries;
+}
+
+const WorkGroupSizeProfile *WorkGroupSizeProfile::get() {
+    static std::once_flag loadOnce;
+    static std::unique_ptr<WorkGroupSizeProfile> profile;
+
+    std::call_once(loadOnce, []() {
+        auto fileName = DebugManager.flags.WorkGroupSizeProfileFile.get();
+        if (fileName == "unk") {
+            fileName = (getLocalWorkSizeTuningLaunches() > 0u) ? getTuningResultsFilePath() : "";
+        }
+        if (fileName.empty() || !fileExists(fileName)) {
+            return;
+        }
+        size_t size = 0u;
+        auto data = loadDataFromFile(fileName.c_str(), size);
+        if (data == nullptr) {
+            return;
+        }
+        profile = std::make_unique<WorkGroupSizeProfile>();
+        profile->parse(data.get(), size);
+    });
+
+    return profile.get();
+}
+
+std::string WorkGroupSizeProfile::getTuningResultsFilePath() {
+    auto cacheConfig = getDefaultCompilerCacheConfig();
+    if (!cacheConfig.enabled || cacheConfig.cacheDir.empty()) {
+        return "";
+    }
+    return cacheConfig.cacheDir + PATH_SEPARATOR + tuningResultsFileName;
+}
+
+void WorkGroupSizeProfile::storeTuningResult(const std::string &kernelName, const size_t globalSize[3], const size_t workGroupSize[3]) {
+    static std::mutex storeMtx;
+
+    auto filePath = getTuningResultsFilePath();
+    if (filePath.empty() || kernelName.empty()) {
+        return;
+    }
+
+    std::ostringstream line;
+    line << kernelName << " " << globalSize[0] << " " << globalSize[1] << " " << globalSize[2] << " "
+         << workGroupSize[0] << " " << workGroupSize[1] << " " << workGroupSize[2] << "\n";
+    auto lineStr = line.str();
+
+    std::lock_guard<std::mutex> lock(storeMtx);
+    std::ofstream outFile(filePath, std::ios::app);
+    if (outFile.is_open()) {
+        outFile.write(lineStr.c_str(), lineStr.size());
+    }
+}
+
+// Each line: <kernel name> <gws x> <gws y> <gws z> <lws x> <lws y> <lws z>, lines starting with # are ignored
+void WorkGroupSizeProfile::parse(const char *data, size_t size) {
+    std::istringstream stream(std::string(data, size));
+    std::string line;
+    while (std::getline(stream, line)) {
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+        std::istringstream lineStream(line);
+        std::string kernelName;
+        Entry entry = {};
+        if (!(lineStream >> kernelName >> entry.globalSize[0] >> entry.globalSize[1] >> entry.globalSize[2] >>
+              entry.workGroupSize[0] >> entry.workGroupSize[1] >> entry.workGroupSize[2])) {
+            continue;
+        }
+        entries[kernelName].push_back(entry);
+    }
+}
+
+bool WorkGroupSizeProfile::find(const std::string &kernelName, const size_t globalSize[3], uint32_t maxWorkGroupSize, size_t workGroupSize[3]) const {
+    auto kernelEntries = entries.find(kernelName);
+    if (kernelEntries == entries.end()) {
+        return false;
+    }
+    for (const auto &entry : kernelEntries->second) {
+        if (entry.globalSize[0] != globalSize[0] || entry.globalSize[1] != globalSize[1] || entry.globalSize[2] != globalSize[2]) {
+            continue;
+        }
+        bool isValid = entry.workGroupSize[0] * entry.workGroupSize[1] * entry.workGroupSize[2] <= maxWorkGroupSize;
+        for (uint32_t i = 0; i < 3; i++) {
+            isValid &= (entry.workGroupSize[i] != 0u) && (globalSize[i] % entry.workGroupSize[i] == 0u);
+        }
+        if (!isValid) {
+            continue;
+        }
+        workGroupSize[0] = entry.workGroupSize[0];
+        workGroupSize[1] = entry.workGroupSize[1];
+        workGroupSize[2] = entry.workGroupSize[2];
+        return true;
+    }
+    return false;
+}
+
+uint32_t getLocalWorkSizeTuningLaunches() {
+    return static_cast<uint32_t>(std::max(0, DebugManager.flags.LocalWorkSizeTuningLaunches.get()));
+}
+
+void generateWorkGroupSizeCandidates(std::vector<Vec3<size_t>> &candidates, const size_t globalSize[3], uint32_t workDim,
+                                     const size_t workGroupSize[3], uint32_t simdSize, uint32_t maxWorkGroupSize, size_t maxCandidates) {
+    auto addCandidate = [&](const Vec3<size_t> &candidate) {
+        if (candidates.size() >= maxCandidates || candidate.x * candidate.y * candidate.z > maxWorkGroupSize ||
+            std::find(candidates.begin(), candidates.end(), candidate) != candidates.end()) {
+            return;
+        }
+        candidates.push_back(candidate);
+    };
+
+    const Vec3<size_t> base{workGroupSize[0], workGroupSize[1], workGroupSize[2]};
+    addCandidate(base);
+
+    for (size_t x = std::max(simdSize, 1u); x <= maxWorkGroupSize; x *= 2) {
+        if (globalSize[0] % x == 0) {
+            addCandidate({x, base.y, base.z});
+        }
+    }
+    if (workDim < 2) {
+        return;
+    }
+    for (size_t y = 1; y <= maxWorkGroupSize; y *= 2) {
+        if (globalSize[1] % y == 0) {
+            addCandidate({base.x, y, base.z});
+        }
+    }
+}
+
+} // namespace NEO
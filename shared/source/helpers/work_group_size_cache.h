@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/vec.h"
+#include "shared/source/utilities/stackvec.h"
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+
+struct WorkGroupSizeCacheKey {
+    bool operator==(const WorkGroupSizeCacheKey &other) const {
+        return globalSize[0] == other.globalSize[0] && globalSize[1] == other.globalSize[1] && globalSize[2] == other.globalSize[2] &&
+               device == other.device && slmTotalSize == other.slmTotalSize && maxWorkGroupSize == other.maxWorkGroupSize &&
+               workDim == other.workDim && algorithm == other.algorithm;
+    }
+
+    size_t globalSize[3] = {};
+    const void *device = nullptr;
+    uint32_t slmTotalSize = 0u;
+    uint32_t maxWorkGroupSize = 0u;
+    uint32_t workDim = 0u;
+    uint32_t algorithm = getCurrentAlgorithm();
+
+  protected:
+    static uint32_t getCurrentAlgorithm();
+};
+
+// Per-kernel memo of local work sizes computed for recently used dispatch shapes
+class WorkGroupSizeCache {
+  public:
+    static constexpr size_t maxEntries = 16u;
+
+    static bool isEnabled();
+
+    bool find(const WorkGroupSizeCacheKey &key, size_t workGroupSize[3]);
+    void store(const WorkGroupSizeCacheKey &key, const size_t workGroupSize[3]);
+
+  protected:
+    struct Entry {
+        WorkGroupSizeCacheKey key;
+        size_t workGroupSize[3];
+    };
+
+    std::mutex mtx;
+    StackVec<Entry, maxEntries> entries;
+    size_t nextEvictedEntry = 0u;
+};
+
+// Local work sizes measured as the best ones by auto-tuning runs, loaded from WorkGroupSizeProfileFile
+// or from local work size tuning results stored in compiler cache directory
+class WorkGroupSizeProfile {
+  public:
+    static constexpr const char *tuningResultsFileName = "lws_tuning.profile";
+
+    static const WorkGroupSizeProfile *get();
+    static std::string getTuningResultsFilePath();
+    static void storeTuningResult(const std::string &kernelName, const size_t globalSize[3], const size_t workGroupSize[3]);
+
+    void parse(const char *data, size_t size);
+    bool find(const std::string &kernelName, const size_t globalSize[3], uint32_t maxWorkGroupSize, size_t workGroupSize[3]) const;
+
+  protected:
+    struct Entry {
+        size_t globalSize[3];
+        size_t workGroupSize[3];
+    };
+
+    std::unordered_map<std::string, std::vector<Entry>> entries;
+};
+
+uint32_t getLocalWorkSizeTuningLaunches();
+
+// Candidates start with given work group size, followed by its variants along X (multiples of SIMD) and Y (powers of 2)
+void generateWorkGroupSizeCandidates(std::vector<Vec3<size_t>> &candidates, const size_t globalSize[3], uint32_t workDim,
+                                     const size_t workGroupSize[3], uint32_t simdSize, uint32_t maxWorkGroupSize, size_t maxCandidates);
+
+} // namespace NEO
@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/allocation_profiler.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/utilities/logger.h"
+
+#include <algorithm>
+#include <limits>
+#include <sstream>
+
+#if defined(__linux__)
+#include <csignal>
+#include <cstdlib>
+#include <execinfo.h>
+#elif defined(_WIN32)
+#include "shared/source/os_interface/windows/windows_wrapper.h"
+#endif
+
+namespace NEO {
+
+std::atomic<bool> AllocationProfiler::dumpRequested{false};
+
+std::unique_ptr<AllocationProfiler> AllocationProfiler::create() {
+    auto samplingInterval = DebugManager.flags.AllocationProfilerSamplingInterval.get();
+    if (samplingInterval < 0) {
+        return nullptr;
+    }
+
+#if defined(__linux__)
+    auto dumpSignal = DebugManager.flags.AllocationProfilerDumpSignal.get();
+    if (dumpSignal > 0) {
+        struct sigaction dumpHandler = {};
+        dumpHandler.sa_handler = [](int) { AllocationProfiler::requestDump(); };
+        dumpHandler.sa_flags = SA_RESTART;
+        sigemptyset(&dumpHandler.sa_mask);
+        sigaction(dumpSignal, &dumpHandler, nullptr);
+    }
+#endif
+
+    std::string dumpFile = DebugManager.flags.AllocationProfilerDumpFile.get();
+    if (dumpFile == "unk") {
+        dumpFile.clear();
+    }
+    return std::make_unique<AllocationProfiler>(static_cast<uint32_t>(samplingInterval), dumpFile);
+}
+
+// Called from signal handler, the dump is written on next allocation or free
+void AllocationProfiler::requestDump() {
+    dumpRequested = true;
+}
+
+AllocationProfiler::AllocationProfiler(uint32_t samplingInterval, const std::string &dumpFile)
+    : samplingInterval(samplingInterval), dumpFile(dumpFile) {}
+
+size_t AllocationProfiler::getHistogramBucket(uint64_t value) {
+    return value == 0u ? 0u : Math::log2(value);
+}
+
+void AllocationProfiler::recordAllocation(const GraphicsAllocation &allocation) {
+    dumpIfRequested();
+
+    auto allocationType = allocation.getAllocationType();
+    auto size = allocation.getUnderlyingBufferSize();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (aliveAllocations.find(&allocation) != aliveAllocations.end()) {
+            return;
+        }
+        aliveAllocations[&allocation] = {allocationType, size, std::chrono::steady_clock::now()};
+
+        sizeHistogram[getHistogramBucket(size)]++;
+        auto &statistics = typeStatistics[static_cast<size_t>(allocationType)];
+        statistics.allocationsCount++;
+        statistics.aliveBytes += size;
+        statistics.peakAliveBytes = std::max(statistics.peakAliveBytes, statistics.aliveBytes);
+
+        if (samplingInterval == 0u || (sampleCounter++ % samplingInterval) != 0u) {
+            return;
+        }
+    }
+
+    // stack is walked outside of the lock, sampled allocations don't stall other threads
+    auto callStack = captureCallStack();
+    if (callStack.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    auto &hotspot = hotspots[callStack];
+    hotspot.allocationsCount++;
+    hotspot.bytes += size;
+}
+
+void AllocationProfiler::recordFree(const GraphicsAllocation &allocation) {
+    dumpIfRequested();
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto aliveAllocation = aliveAllocations.find(&allocation);
+    if (aliveAllocation == aliveAllocations.end()) {
+        return;
+    }
+
+    auto lifetime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - aliveAllocation->second.allocationTime);
+    lifetimeHistogram[getHistogramBucket(static_cast<uint64_t>(lifetime.count()))]++;
+
+    auto &statistics = typeStatistics[static_cast<size_t>(aliveAllocation->second.allocationType)];
+    statistics.freesCount++;
+    statistics.aliveBytes -= aliveAllocation->second.size;
+    aliveAllocations.erase(aliveAllocation);
+}
+
+AllocationProfiler::CallStack AllocationProfiler::captureCallStack() {
+    CallStack callStack(maxCallStackFrames);
+    size_t framesCount = 0u;
+#if defined(__linux__)
+    framesCount = static_cast<size_t>(backtrace(callStack.data(), static_cast<int>(maxCallStackFrames)));
+#elif defined(_WIN32)
+    framesCount = CaptureStackBackTrace(0, static_cast<DWORD>(maxCallStackFrames), callStack.data(), nullptr);
+#endif
+    callStack.resize(framesCount);
+    return callStack;
+}
+
+std::string AllocationProfiler::getCallStackString(const CallStack &callStack) {
+    std::ostringstream stream;
+#if defined(__linux__)
+    auto symbols = backtrace_symbols(callStack.data(), static_cast<int>(callStack.size()));
+    for (size_t i = 0; i < callStack.size(); i++) {
+        stream << "    " << (symbols ? symbols[i] : "") << " [" << callStack[i] << "]\n";
+    }
+    free(symbols);
+#else
+    for (auto frame : callStack) {
+        stream << "    [" << frame << "]\n";
+    }
+#endif
+    return stream.str();
+}
+
+std::string AllocationProfiler::getReport() {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::ostringstream report;
+
+    report << "Allocation profile: " << aliveAllocations.size() << " allocations alive\n";
+
+    auto printHistogram = [&report](const auto &histogram) {
+        for (size_t bucket = 0; bucket < histogramBucketsCount; bucket++) {
+            if (histogram[bucket] == 0u) {
+                continue;
+            }
+            auto lowerBound = (bucket == 0u) ? 0ull : (1ull << bucket);
+            auto upperBound = (bucket + 1 < histogramBucketsCount) ? (1ull << (bucket + 1)) : std::numeric_limits<uint64_t>::max();
+            report << "  [" << lowerBound << ", " << upperBound << "): " << histogram[bucket] << "\n";
+        }
+    };
+
+    report << "Allocation sizes (bytes):\n";
+    printHistogram(sizeHistogram);
+    report << "Allocation lifetimes (us):\n";
+    printHistogram(lifetimeHistogram);
+
+    report << "Allocation types:\n";
+    for (size_t type = 0; type < typeStatistics.size(); type++) {
+        auto &statistics = typeStatistics[type];
+        if (statistics.allocationsCount == 0u) {
+            continue;
+        }
+        report << "  " << getAllocationTypeString(static_cast<AllocationType>(type))
+               << ": allocated " << statistics.allocationsCount
+               << ", freed " << statistics.freesCount
+               << ", alive " << statistics.aliveBytes << " bytes"
+               << ", peak alive " << statistics.peakAliveBytes << " bytes\n";
+    }
+
+    std::vector<std::pair<const CallStack *, Hotspot>> sortedHotspots;
+    for (auto &hotspot : hotspots) {
+        sortedHotspots.emplace_back(&hotspot.first, hotspot.second);
+    }
+    auto hotspotsToReport = std::min(sortedHotspots.size(), reportedHotspotsCount);
+    std::partial_sort(sortedHotspots.begin(), sortedHotspots.begin() + hotspotsToReport, sortedHotspots.end(),
+                      [](const auto &lhs, const auto &rhs) { return lhs.second.bytes > rhs.second.bytes; });
+
+    report << "Allocation hotspots (sampled):\n";
+    for (size_t i = 0; i < hotspotsToReport; i++) {
+        report << "  #" << i << ": " << sortedHotspots[i].second.allocationsCount << " allocations, " << sortedHotspots[i].second.bytes << " bytes\n";
+        report << getCallStackString(*sortedHotspots[i].first);
+    }
+    return report.str();
+}
+
+void AllocationProfiler::dump() {
+    auto report = getReport();
+    if (dumpFile.empty()) {
+        PRINT_DEBUG_STRING(true, stdout, "%s", report.c_str());
+    } else {
+        writeDataToFile(dumpFile.c_str(), report.c_str(), report.size());
+    }
+}
+
+void AllocationProfiler::dumpIfRequested() {
+    if (dumpRequested.exchange(false)) {
+        dump();
+    }
+}
+
+} // namespace NEO
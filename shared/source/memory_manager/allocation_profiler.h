@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/memory_manager/allocation_type.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+class GraphicsAllocation;
+
+// Collects size and lifetime histograms and alive bytes per allocation type of graphics allocations,
+// call stacks are captured for every N-th allocation and aggregated into allocation hotspots.
+class AllocationProfiler : NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t maxCallStackFrames = 16u;
+    static constexpr size_t histogramBucketsCount = 64u;
+    static constexpr size_t reportedHotspotsCount = 10u;
+
+    static std::unique_ptr<AllocationProfiler> create();
+    static void requestDump();
+
+    AllocationProfiler(uint32_t samplingInterval, const std::string &dumpFile);
+    MOCKABLE_VIRTUAL ~AllocationProfiler() = default;
+
+    void recordAllocation(const GraphicsAllocation &allocation);
+    void recordFree(const GraphicsAllocation &allocation);
+
+    std::string getReport();
+    void dump();
+
+  protected:
+    using CallStack = std::vector<void *>;
+
+    struct TypeStatistics {
+        uint64_t allocationsCount = 0u;
+        uint64_t freesCount = 0u;
+        uint64_t aliveBytes = 0u;
+        uint64_t peakAliveBytes = 0u;
+    };
+
+    struct AliveAllocation {
+        AllocationType allocationType = AllocationType::UNKNOWN;
+        size_t size = 0u;
+        std::chrono::steady_clock::time_point allocationTime;
+    };
+
+    struct Hotspot {
+        uint64_t allocationsCount = 0u;
+        uint64_t bytes = 0u;
+    };
+
+    MOCKABLE_VIRTUAL CallStack captureCallStack();
+    std::string getCallStackString(const CallStack &callStack);
+    void dumpIfRequested();
+    static size_t getHistogramBucket(uint64_t value);
+
+    const uint32_t samplingInterval;
+    const std::string dumpFile;
+    uint64_t sampleCounter = 0u;
+    std::array<uint64_t, histogramBucketsCount> sizeHistogram{};
+    std::array<uint64_t, histogramBucketsCount> lifetimeHistogram{};
+    std::array<TypeStatistics, static_cast<size_t>(AllocationType::COUNT)> typeStatistics{};
+    std::unordered_map<const GraphicsAllocation *, AliveAllocation> aliveAllocations;
+    std::map<CallStack, Hotspot> hotspots;
+    std::mutex mutex;
+
+    static std::atomic<bool> dumpRequested;
+};
+
+} // namespace NEO
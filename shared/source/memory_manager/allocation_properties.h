@@ -44,6 +44,7 @@ struct AllocationProperties {
     ColouringPolicy colouringPolicy = ColouringPolicy::DeviceCountBased;
     size_t colouringGranularity = MemoryConstants::pageSize64k;
     DeviceBitfield subDevicesBitfield{};
+    DeviceBitfield preferredTileHint{};
     uint64_t gpuAddress = 0;
     OsContext *osContext = nullptr;
     bool useMmapObject = true;
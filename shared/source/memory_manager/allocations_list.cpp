@@ -20,6 +20,11 @@ struct ReusableAllocationRequirements {
     uint32_t tagOffset;
 };
 
+struct CompletedAllocationsRequirements {
+    uint32_t waitTaskCount;
+    uint32_t contextId;
+};
+
 bool checkTagAddressReady(ReusableAllocationRequirements *requirements, NEO::GraphicsAllocation *gfxAllocation) {
     auto tagAddress = requirements->csrTagAddress;
     auto taskCount = gfxAllocation->getTaskCount(requirements->contextId);
@@ -75,6 +80,51 @@ GraphicsAllocation *AllocationsList::detachAllocationImpl(GraphicsAllocation *,
     return nullptr;
 }
 
+void AllocationsList::pushByTaskCount(GraphicsAllocation &allocation, uint32_t contextId) {
+    processLocked<AllocationsList, &AllocationsList::pushByTaskCountImpl>(&allocation, static_cast<void *>(&contextId));
+}
+
+GraphicsAllocation *AllocationsList::pushByTaskCountImpl(GraphicsAllocation *allocation, void *data) {
+    auto contextId = *static_cast<uint32_t *>(data);
+    auto taskCount = allocation->getTaskCount(contextId);
+
+    // task counts are mostly monotonic, so the position is found at the tail right away
+    auto *curr = tail;
+    while (curr != nullptr && curr->getTaskCount(contextId) > taskCount) {
+        curr = curr->prev;
+    }
+    if (curr == nullptr) {
+        return pushFrontOneImpl(allocation, nullptr);
+    }
+    if (curr == tail) {
+        return pushTailOneImpl(allocation, nullptr);
+    }
+    curr->insertOneNext(*allocation);
+    return nullptr;
+}
+
+GraphicsAllocation *AllocationsList::detachCompletedAllocations(uint32_t waitTaskCount, uint32_t contextId) {
+    CompletedAllocationsRequirements req{waitTaskCount, contextId};
+    GraphicsAllocation *a = nullptr;
+    return processLocked<AllocationsList, &AllocationsList::detachCompletedAllocationsImpl>(a, static_cast<void *>(&req));
+}
+
+GraphicsAllocation *AllocationsList::detachCompletedAllocationsImpl(GraphicsAllocation *, void *data) {
+    auto req = static_cast<CompletedAllocationsRequirements *>(data);
+    IDList<GraphicsAllocation, false, true> completedAllocations;
+
+    // only the completed prefix is visited, allocations with host ptr task count assigned stay in place
+    auto *curr = head;
+    while (curr != nullptr && curr->getTaskCount(req->contextId) <= req->waitTaskCount) {
+        auto *next = curr->next;
+        if (curr->hostPtrTaskCountAssignment == 0) {
+            completedAllocations.pushTailOne(*removeOneImpl(curr, nullptr));
+        }
+        curr = next;
+    }
+    return completedAllocations.detachNodes();
+}
+
 void AllocationsList::freeAllGraphicsAllocations(Device *neoDevice) {
     auto *curr = head;
     while (curr != nullptr) {
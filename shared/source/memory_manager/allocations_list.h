@@ -23,8 +23,15 @@ class AllocationsList : public IDList<GraphicsAllocation, true, true> {
     std::unique_ptr<GraphicsAllocation> detachAllocation(size_t requiredMinimalSize, const void *requiredPtr, CommandStreamReceiver *commandStreamReceiver, AllocationType allocationType);
     void freeAllGraphicsAllocations(Device *neoDevice);
 
+    // Allocations are kept ordered by task count of given context, so allocations waiting for
+    // the same task count form buckets and completed allocations always form a prefix of the list.
+    void pushByTaskCount(GraphicsAllocation &allocation, uint32_t contextId);
+    GraphicsAllocation *detachCompletedAllocations(uint32_t waitTaskCount, uint32_t contextId);
+
   private:
     GraphicsAllocation *detachAllocationImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *pushByTaskCountImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *detachCompletedAllocationsImpl(GraphicsAllocation *, void *);
 
     const AllocationUsage allocationUsage{REUSABLE_ALLOCATION};
 };
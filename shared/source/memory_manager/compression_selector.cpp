@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/compression_selector.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/hw_helper.h"
+#include "shared/source/helpers/hw_info.h"
+#include "shared/source/memory_manager/allocation_properties.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/os_interface/hw_info_config.h"
+
+namespace NEO {
+
+bool CompressionSelector::allowCompressionForDeviceOnlyAllocation(const AllocationProperties &properties, const HardwareInfo &hwInfo) {
+    auto policy = DebugManager.flags.EnableAdaptiveCompressionPolicy.get();
+    if (policy == 0 || !properties.flags.isUSMDeviceAllocation) {
+        return false;
+    }
+
+    size_t minAllocationSize = defaultMinDeviceOnlyAllocationSize;
+    if (DebugManager.flags.AdaptiveCompressionMinAllocationSizeInKb.get() != -1) {
+        minAllocationSize = static_cast<size_t>(DebugManager.flags.AdaptiveCompressionMinAllocationSizeInKb.get()) * KB;
+    }
+    if (properties.size < minAllocationSize) {
+        return false;
+    }
+
+    if (!HwHelper::compressedBuffersSupported(hwInfo) ||
+        !HwHelper::get(hwInfo.platform.eRenderCoreFamily).isBufferSizeSuitableForCompression(properties.size, hwInfo)) {
+        return false;
+    }
+    if (policy == -1) {
+        // device only allocations are accessed statelessly by kernels
+        return HwInfoConfig::get(hwInfo.platform.eProductFamily)->allowStatelessCompression(hwInfo);
+    }
+    return true;
+}
+
+bool CompressionHostAccessTracker::isTracked(AllocationType allocationType) {
+    if (DebugManager.flags.EnableAdaptiveCompressionPolicy.get() == 0) {
+        return false;
+    }
+    return allocationType == AllocationType::BUFFER ||
+           allocationType == AllocationType::SVM_GPU;
+}
+
+void CompressionHostAccessTracker::recordCompressedAllocation(const GraphicsAllocation &allocation) {
+    if (isTracked(allocation.getAllocationType()) && allocation.isCompressionEnabled()) {
+        compressedAllocations[static_cast<size_t>(allocation.getAllocationType())]++;
+    }
+}
+
+void CompressionHostAccessTracker::recordHostAccess(const GraphicsAllocation &allocation) {
+    if (isTracked(allocation.getAllocationType()) && allocation.isCompressionEnabled()) {
+        hostAccesses[static_cast<size_t>(allocation.getAllocationType())]++;
+    }
+}
+
+bool CompressionHostAccessTracker::isHostAccessFrequent(AllocationType allocationType) const {
+    if (!isTracked(allocationType)) {
+        return false;
+    }
+    auto accessesCount = hostAccesses[static_cast<size_t>(allocationType)].load();
+    return accessesCount >= minHostAccessesCount &&
+           accessesCount > compressedAllocations[static_cast<size_t>(allocationType)].load();
+}
+
+} // namespace NEO
@@ -6,15 +6,42 @@
  */
 
 #pragma once
+#include "shared/source/memory_manager/allocation_type.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 
 namespace NEO {
 
 struct AllocationProperties;
 struct HardwareInfo;
+class GraphicsAllocation;
 
 class CompressionSelector {
   public:
+    static constexpr size_t defaultMinDeviceOnlyAllocationSize = 2 * 1024 * 1024;
+
     static bool preferCompressedAllocation(const AllocationProperties &properties, const HardwareInfo &hwInfo);
+    static bool allowCompressionForDeviceOnlyAllocation(const AllocationProperties &properties, const HardwareInfo &hwInfo);
+};
+
+// Counts compressed buffers and their host accesses per allocation type,
+// buffer types observed to be frequently accessed on host are no longer compressed.
+class CompressionHostAccessTracker {
+  public:
+    static constexpr uint32_t minHostAccessesCount = 16u;
+
+    void recordCompressedAllocation(const GraphicsAllocation &allocation);
+    void recordHostAccess(const GraphicsAllocation &allocation);
+    bool isHostAccessFrequent(AllocationType allocationType) const;
+
+  protected:
+    static bool isTracked(AllocationType allocationType);
+
+    std::array<std::atomic<uint32_t>, static_cast<size_t>(AllocationType::COUNT)> compressedAllocations{};
+    std::array<std::atomic<uint32_t>, static_cast<size_t>(AllocationType::COUNT)> hostAccesses{};
 };
 
 } // namespace NEO
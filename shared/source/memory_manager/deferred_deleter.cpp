@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -114,13 +114,17 @@ void DeferredDeleter::drain(bool blocking) {
 
 void DeferredDeleter::clearQueue() {
     do {
-        auto deletion = queue.removeFrontOne();
-        if (deletion) {
+        // take whole queue at once, producers are not blocked by each released element
+        auto deletions = queue.detachNodes();
+        while (deletions) {
+            auto nextDeletion = deletions->slice();
+            std::unique_ptr<DeferrableDeletion> deletion(deletions);
             if (deletion->apply()) {
                 elementsToRelease--;
             } else {
                 queue.pushTailOne(*deletion.release());
             }
+            deletions = nextDeletion;
         }
     } while (!queue.peekIsEmpty());
 }
@@ -7,8 +7,10 @@
 
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/app_resource_helper.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/tile_placement_policy.h"
 
 #include <bitset>
 
@@ -119,7 +121,21 @@ StorageInfo MemoryManager::createStorageInfoFromProperties(const AllocationPrope
 
         DEBUG_BREAK_IF(colouringPolicy == ColouringPolicy::DeviceCountBased && granularity != MemoryConstants::pageSize64k);
 
-        if (this->supportsMultiStorageResources &&
+        uint32_t placementTile = 0u;
+        bool placeOnSingleTile = false;
+        if (properties.subDevicesBitfield.count() > 1u) {
+            if (properties.preferredTileHint.count() == 1u && (properties.preferredTileHint & properties.subDevicesBitfield).any()) {
+                placementTile = Math::log2(static_cast<uint64_t>(properties.preferredTileHint.to_ulong()));
+                placeOnSingleTile = true;
+            } else if (auto tilePlacementPolicy = getTilePlacementPolicy(properties.rootDeviceIndex)) {
+                placeOnSingleTile = tilePlacementPolicy->getDominantTile(properties.subDevicesBitfield, properties.size, placementTile);
+            }
+        }
+
+        if (placeOnSingleTile) {
+            storageInfo.memoryBanks = DeviceBitfield{};
+            storageInfo.memoryBanks.set(placementTile);
+        } else if (this->supportsMultiStorageResources &&
             properties.multiStorageResource &&
             properties.size >= deviceCount * granularity &&
             properties.subDevicesBitfield.count() != 1u) {
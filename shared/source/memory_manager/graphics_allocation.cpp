@@ -22,27 +22,29 @@ void GraphicsAllocation::setAllocationType(AllocationType allocationType) {
 
 GraphicsAllocation::GraphicsAllocation(uint32_t rootDeviceIndex, size_t numGmms, AllocationType allocationType, void *cpuPtrIn, uint64_t canonizedGpuAddress,
                                        uint64_t baseAddress, size_t sizeIn, MemoryPool pool, size_t maxOsContextCount)
-    : rootDeviceIndex(rootDeviceIndex),
-      gpuBaseAddress(baseAddress),
-      gpuAddress(canonizedGpuAddress),
+    : gpuAddress(canonizedGpuAddress),
       size(sizeIn),
+      usageInfos(maxOsContextCount),
+      rootDeviceIndex(rootDeviceIndex),
+      gpuBaseAddress(baseAddress),
       cpuPtr(cpuPtrIn),
       memoryPool(pool),
       allocationType(allocationType),
-      usageInfos(maxOsContextCount),
+      inspectionIds(maxOsContextCount),
       residency(maxOsContextCount) {
     gmms.resize(numGmms);
 }
 
 GraphicsAllocation::GraphicsAllocation(uint32_t rootDeviceIndex, size_t numGmms, AllocationType allocationType, void *cpuPtrIn, size_t sizeIn,
                                        osHandle sharedHandleIn, MemoryPool pool, size_t maxOsContextCount, uint64_t canonizedGpuAddress)
-    : rootDeviceIndex(rootDeviceIndex),
-      gpuAddress(canonizedGpuAddress),
+    : gpuAddress(canonizedGpuAddress),
       size(sizeIn),
+      usageInfos(maxOsContextCount),
+      rootDeviceIndex(rootDeviceIndex),
       cpuPtr(cpuPtrIn),
       memoryPool(pool),
       allocationType(allocationType),
-      usageInfos(maxOsContextCount),
+      inspectionIds(maxOsContextCount),
       residency(maxOsContextCount) {
     sharingInfo.sharedHandle = sharedHandleIn;
     gmms.resize(numGmms);
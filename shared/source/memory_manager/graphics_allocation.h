@@ -50,6 +50,19 @@ struct AubInfo {
 };
 
 class GraphicsAllocation : public IDNode<GraphicsAllocation> {
+  protected:
+    struct UsageInfo {
+        uint32_t taskCount = objectNotUsed;
+        uint32_t residencyTaskCount = objectNotResident;
+    };
+
+    // State read and written by every residency walk is declared first, right after the list links,
+    // so that makeResident touches the leading cachelines of an allocation only.
+    uint64_t gpuAddress = 0;
+    size_t size = 0;
+    StackVec<UsageInfo, 32> usageInfos;
+    std::atomic<uint32_t> registeredContextsNum{0};
+
   public:
     enum UsmInitialPlacement {
         DEFAULT,
@@ -155,8 +168,8 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
     MOCKABLE_VIRTUAL void updateTaskCount(uint32_t newTaskCount, uint32_t contextId);
     MOCKABLE_VIRTUAL uint32_t getTaskCount(uint32_t contextId) const { return usageInfos[contextId].taskCount; }
     void releaseUsageInOsContext(uint32_t contextId) { updateTaskCount(objectNotUsed, contextId); }
-    uint32_t getInspectionId(uint32_t contextId) const { return usageInfos[contextId].inspectionId; }
-    void setInspectionId(uint32_t newInspectionId, uint32_t contextId) { usageInfos[contextId].inspectionId = newInspectionId; }
+    uint32_t getInspectionId(uint32_t contextId) const { return inspectionIds[contextId]; }
+    void setInspectionId(uint32_t newInspectionId, uint32_t contextId) { inspectionIds[contextId] = newInspectionId; }
 
     MOCKABLE_VIRTUAL bool isResident(uint32_t contextId) const { return GraphicsAllocation::objectNotResident != getResidencyTaskCount(contextId); }
     bool isAlwaysResident(uint32_t contextId) const { return GraphicsAllocation::objectAlwaysResident == getResidencyTaskCount(contextId); }
@@ -270,12 +283,6 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
     bool isShareableHostMemory = false;
 
   protected:
-    struct UsageInfo {
-        uint32_t taskCount = objectNotUsed;
-        uint32_t residencyTaskCount = objectNotResident;
-        uint32_t inspectionId = 0u;
-    };
-
     struct SharingInfo {
         uint32_t reuseCount = 0;
         osHandle sharedHandle = Sharing::nonSharedResource;
@@ -316,17 +323,14 @@ class GraphicsAllocation : public IDNode<GraphicsAllocation> {
 
     uint64_t allocationOffset = 0u;
     uint64_t gpuBaseAddress = 0;
-    uint64_t gpuAddress = 0;
     void *driverAllocatedCpuPointer = nullptr;
-    size_t size = 0;
     void *cpuPtr = nullptr;
     void *lockedPtr = nullptr;
 
     MemoryPool memoryPool = MemoryPool::MemoryNull;
     AllocationType allocationType = AllocationType::UNKNOWN;
 
-    StackVec<UsageInfo, 32> usageInfos;
-    std::atomic<uint32_t> registeredContextsNum{0};
+    StackVec<uint32_t, 32> inspectionIds;
     StackVec<Gmm *, EngineLimits::maxHandleCount> gmms;
     ResidencyData residency;
 };
@@ -10,33 +10,48 @@
 #include "shared/source/helpers/abort.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
+#include <algorithm>
+
 using namespace NEO;
 
-HostPtrFragmentsContainer::iterator HostPtrManager::findElement(HostPtrEntryKey key) {
-    auto nextElement = partialAllocations.lower_bound(key);
-    auto element = nextElement;
-    if (element != partialAllocations.end()) {
+namespace {
+uintptr_t getFragmentEnd(const FragmentStorage &fragment) {
+    // zero sized fragments still occupy their start address
+    return reinterpret_cast<uintptr_t>(fragment.fragmentCpuPointer) + std::max(fragment.fragmentSize, static_cast<size_t>(1u));
+}
+} // namespace
 
-        auto &storedFragment = element->second;
-        if (element->first.rootDeviceIndex == key.rootDeviceIndex && storedFragment.fragmentCpuPointer == key.ptr) {
-            return element;
-        }
+HostPtrFragmentsContainer *HostPtrManager::getFragmentsContainer(uint32_t rootDeviceIndex) {
+    auto fragments = partialAllocations.find(rootDeviceIndex);
+    if (fragments == partialAllocations.end()) {
+        return nullptr;
     }
-    if (element != partialAllocations.begin()) {
-        element--;
-        if (element->first.rootDeviceIndex != key.rootDeviceIndex) {
-            return partialAllocations.end();
-        }
-        auto &storedFragment = element->second;
-        auto storedEndAddress = reinterpret_cast<uintptr_t>(storedFragment.fragmentCpuPointer) + storedFragment.fragmentSize;
-        if (storedFragment.fragmentSize == 0) {
-            storedEndAddress++;
-        }
-        if (reinterpret_cast<uintptr_t>(key.ptr) < storedEndAddress) {
-            return element;
-        }
+    return &fragments->second;
+}
+
+size_t HostPtrManager::getFragmentsCount() {
+    std::shared_lock<std::shared_mutex> fragmentsLock(fragmentsMutex);
+    size_t fragmentsCount = 0u;
+    for (auto &fragments : partialAllocations) {
+        fragmentsCount += fragments.second.size();
     }
-    return partialAllocations.end();
+    return fragmentsCount;
+}
+
+FragmentStorage *HostPtrManager::findElement(HostPtrEntryKey key) {
+    auto fragments = getFragmentsContainer(key.rootDeviceIndex);
+    if (fragments == nullptr) {
+        return nullptr;
+    }
+    auto address = reinterpret_cast<uintptr_t>(key.ptr);
+    auto element = fragments->find(address);
+    if (element == nullptr) {
+        fragments->forEachOverlapping(address, address + 1, [&element](uintptr_t, uintptr_t, FragmentStorage &storedFragment) {
+            element = &storedFragment;
+            return true;
+        });
+    }
+    return element;
 }
 
 AllocationRequirements HostPtrManager::getAllocationRequirements(uint32_t rootDeviceIndex, const void *inputPtr, size_t size) {
@@ -122,13 +137,14 @@ OsHandleStorage HostPtrManager::populateAlreadyAllocatedFragments(AllocationRequ
 
 void HostPtrManager::storeFragment(uint32_t rootDeviceIndex, FragmentStorage &fragment) {
     std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
+    std::unique_lock<std::shared_mutex> fragmentsLock(fragmentsMutex);
     HostPtrEntryKey key{fragment.fragmentCpuPointer, rootDeviceIndex};
     auto element = findElement(key);
-    if (element != partialAllocations.end()) {
-        element->second.refCount++;
+    if (element != nullptr) {
+        element->refCount++;
     } else {
         fragment.refCount++;
-        partialAllocations.insert(std::pair<HostPtrEntryKey, FragmentStorage>(key, fragment));
+        partialAllocations[rootDeviceIndex].insert(reinterpret_cast<uintptr_t>(fragment.fragmentCpuPointer), getFragmentEnd(fragment), fragment);
     }
 }
 
@@ -155,94 +171,56 @@ void HostPtrManager::releaseHandleStorage(uint32_t rootDeviceIndex, OsHandleStor
 
 bool HostPtrManager::releaseHostPtr(uint32_t rootDeviceIndex, const void *ptr) {
     std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
+    std::unique_lock<std::shared_mutex> fragmentsLock(fragmentsMutex);
     bool fragmentReadyToBeReleased = false;
 
     auto element = findElement({ptr, rootDeviceIndex});
 
-    DEBUG_BREAK_IF(element == partialAllocations.end());
+    DEBUG_BREAK_IF(element == nullptr);
 
-    element->second.refCount--;
-    if (element->second.refCount <= 0) {
+    element->refCount--;
+    if (element->refCount <= 0) {
         fragmentReadyToBeReleased = true;
-        partialAllocations.erase(element);
+        partialAllocations[rootDeviceIndex].erase(reinterpret_cast<uintptr_t>(element->fragmentCpuPointer));
     }
 
     return fragmentReadyToBeReleased;
 }
 
 FragmentStorage *HostPtrManager::getFragment(HostPtrEntryKey key) {
-    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
-    auto element = findElement(key);
-    if (element != partialAllocations.end()) {
-        return &element->second;
-    }
-    return nullptr;
+    std::shared_lock<std::shared_mutex> fragmentsLock(fragmentsMutex);
+    return findElement(key);
 }
 
 // for given inputs see if any allocation overlaps
 FragmentStorage *HostPtrManager::getFragmentAndCheckForOverlaps(uint32_t rootDeviceIndex, const void *inPtr, size_t size, OverlapStatus &overlappingStatus) {
-    std::lock_guard<decltype(allocationsMutex)> lock(allocationsMutex);
-    void *inputPtr = const_cast<void *>(inPtr);
-    auto nextElement = partialAllocations.lower_bound({inputPtr, rootDeviceIndex});
-    auto element = nextElement;
+    std::shared_lock<std::shared_mutex> fragmentsLock(fragmentsMutex);
     overlappingStatus = OverlapStatus::FRAGMENT_NOT_OVERLAPING_WITH_ANY_OTHER;
 
-    if (element != partialAllocations.begin()) {
-        element--;
+    auto fragments = getFragmentsContainer(rootDeviceIndex);
+    if (fragments == nullptr) {
+        return nullptr;
     }
 
-    if (element != partialAllocations.end()) {
-        if (element->first.rootDeviceIndex != rootDeviceIndex) {
-            return nullptr;
-        }
-        auto &storedFragment = element->second;
-        if (storedFragment.fragmentCpuPointer == inputPtr && storedFragment.fragmentSize == size) {
-            overlappingStatus = OverlapStatus::FRAGMENT_WITH_EXACT_SIZE_AS_STORED_FRAGMENT;
-            return &element->second;
-        }
-
-        auto storedEndAddress = (uintptr_t)storedFragment.fragmentCpuPointer + storedFragment.fragmentSize;
-        auto inputEndAddress = (uintptr_t)inputPtr + size;
+    auto inputStartAddress = reinterpret_cast<uintptr_t>(inPtr);
+    auto inputEndAddress = inputStartAddress + size;
+    FragmentStorage *matchingFragment = nullptr;
 
-        if (inputPtr >= storedFragment.fragmentCpuPointer && (uintptr_t)inputPtr < (uintptr_t)storedEndAddress) {
-            if (inputEndAddress <= storedEndAddress) {
-                overlappingStatus = OverlapStatus::FRAGMENT_WITHIN_STORED_FRAGMENT;
-                return &element->second;
-            } else {
-                overlappingStatus = OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT;
-                return nullptr;
-            }
-        }
-        // next fragment doesn't have to be after the inputPtr
-        if (nextElement != partialAllocations.end()) {
-            if (nextElement->first.rootDeviceIndex != rootDeviceIndex) {
-                return nullptr;
-            }
-            auto &storedNextElement = nextElement->second;
-            auto storedNextEndAddress = (uintptr_t)storedNextElement.fragmentCpuPointer + storedNextElement.fragmentSize;
-            auto storedNextStartAddress = (uintptr_t)storedNextElement.fragmentCpuPointer;
-            // check if this allocation is after the inputPtr
-            if ((uintptr_t)inputPtr < storedNextStartAddress) {
-                if (inputEndAddress > storedNextStartAddress) {
-                    overlappingStatus = OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT;
-                    return nullptr;
-                }
-            } else if (inputEndAddress > storedNextEndAddress) {
-                overlappingStatus = OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT;
-                return nullptr;
-            } else {
-                DEBUG_BREAK_IF((uintptr_t)inputPtr != storedNextStartAddress);
-                if (inputEndAddress < storedNextEndAddress) {
-                    overlappingStatus = OverlapStatus::FRAGMENT_WITHIN_STORED_FRAGMENT;
-                } else {
-                    DEBUG_BREAK_IF(inputEndAddress != storedNextEndAddress);
-                    overlappingStatus = OverlapStatus::FRAGMENT_WITH_EXACT_SIZE_AS_STORED_FRAGMENT;
-                }
-                return &nextElement->second;
-            }
+    // fragment containing the input range takes precedence over partially overlapping ones
+    fragments->forEachOverlapping(inputStartAddress, inputEndAddress, [&](uintptr_t storedStartAddress, uintptr_t, FragmentStorage &storedFragment) {
+        auto storedEndAddress = storedStartAddress + storedFragment.fragmentSize;
+        if (storedStartAddress == inputStartAddress && storedEndAddress == inputEndAddress) {
+            overlappingStatus = OverlapStatus::FRAGMENT_WITH_EXACT_SIZE_AS_STORED_FRAGMENT;
+        } else if (storedStartAddress <= inputStartAddress && inputEndAddress <= storedEndAddress) {
+            overlappingStatus = OverlapStatus::FRAGMENT_WITHIN_STORED_FRAGMENT;
+        } else {
+            overlappingStatus = OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT;
+            return false;
         }
-    }
-    return nullptr;
+        matchingFragment = &storedFragment;
+        return true;
+    });
+    return matchingFragment;
 }
 
 OsHandleStorage HostPtrManager::prepareOsStorageForAllocation(MemoryManager &memoryManager, size_t size, const void *ptr, uint32_t rootDeviceIndex) {
@@ -7,9 +7,11 @@
 
 #pragma once
 #include "shared/source/memory_manager/host_ptr_defines.h"
+#include "shared/source/utilities/interval_tree.h"
 
-#include <map>
 #include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
 
 namespace NEO {
 
@@ -23,7 +25,7 @@ struct HostPtrEntryKey {
     }
 };
 
-using HostPtrFragmentsContainer = std::map<HostPtrEntryKey, FragmentStorage>;
+using HostPtrFragmentsContainer = IntervalTree<FragmentStorage>;
 class MemoryManager;
 class HostPtrManager {
   public:
@@ -41,8 +43,13 @@ class HostPtrManager {
     FragmentStorage *getFragmentAndCheckForOverlaps(uint32_t rootDeviceIndex, const void *inputPtr, size_t size, OverlapStatus &overlappingStatus);
     RequirementsStatus checkAllocationsForOverlapping(MemoryManager &memoryManager, AllocationRequirements *requirements);
 
-    HostPtrFragmentsContainer::iterator findElement(HostPtrEntryKey key);
-    HostPtrFragmentsContainer partialAllocations;
+    FragmentStorage *findElement(HostPtrEntryKey key);
+    HostPtrFragmentsContainer *getFragmentsContainer(uint32_t rootDeviceIndex);
+    size_t getFragmentsCount();
+
+    std::unordered_map<uint32_t, HostPtrFragmentsContainer> partialAllocations;
     std::recursive_mutex allocationsMutex;
+    // Guards the containers only: lookups take it shared, fragment insertion and removal exclusively
+    std::shared_mutex fragmentsMutex;
 };
 } // namespace NEO
@@ -33,8 +33,9 @@ void InternalAllocationStorage::storeAllocationWithTaskCount(std::unique_ptr<Gra
         }
     }
     auto &allocationsList = allocationLists[allocationUsage];
-    gfxAllocation->updateTaskCount(taskCount, commandStreamReceiver.getOsContext().getContextId());
-    allocationsList.pushTailOne(*gfxAllocation.release());
+    auto contextId = commandStreamReceiver.getOsContext().getContextId();
+    gfxAllocation->updateTaskCount(taskCount, contextId);
+    allocationsList.pushByTaskCount(*gfxAllocation.release(), contextId);
 }
 
 void InternalAllocationStorage::cleanAllocationList(uint32_t waitTaskCount, uint32_t allocationUsage) {
@@ -49,22 +50,12 @@ void InternalAllocationStorage::freeAllocationsList(uint32_t waitTaskCount, Allo
     auto memoryManager = commandStreamReceiver.getMemoryManager();
     auto lock = memoryManager->getHostPtrManager()->obtainOwnership();
 
-    GraphicsAllocation *curr = allocationsList.detachNodes();
-
-    IDList<GraphicsAllocation, false, true> allocationsLeft;
+    GraphicsAllocation *curr = allocationsList.detachCompletedAllocations(waitTaskCount, commandStreamReceiver.getOsContext().getContextId());
     while (curr != nullptr) {
         auto *next = curr->next;
-        if (curr->hostPtrTaskCountAssignment == 0 && curr->getTaskCount(commandStreamReceiver.getOsContext().getContextId()) <= waitTaskCount) {
-            memoryManager->freeGraphicsMemory(curr);
-        } else {
-            allocationsLeft.pushTailOne(*curr);
-        }
+        memoryManager->freeGraphicsMemory(curr);
         curr = next;
     }
-
-    if (allocationsLeft.peekIsEmpty() == false) {
-        allocationsList.splice(*allocationsLeft.detachNodes());
-    }
 }
 
 std::unique_ptr<GraphicsAllocation> InternalAllocationStorage::obtainReusableAllocation(size_t requiredSize, AllocationType allocationType) {
@@ -22,12 +22,14 @@
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/helpers/surface_format_info.h"
+#include "shared/source/memory_manager/allocation_profiler.h"
 #include "shared/source/memory_manager/compression_selector.h"
 #include "shared/source/memory_manager/deferrable_allocation_deletion.h"
 #include "shared/source/memory_manager/deferred_deleter.h"
 #include "shared/source/memory_manager/host_ptr_manager.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/prefetch_manager.h"
+#include "shared/source/memory_manager/tile_placement_policy.h"
 #include "shared/source/os_interface/hw_info_config.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_interface.h"
@@ -52,6 +54,11 @@ MemoryManager::MemoryManager(ExecutionEnvironment &executionEnvironment) : execu
         auto hwInfo = executionEnvironment.rootDeviceEnvironments[rootDeviceIndex]->getHardwareInfo();
         internalLocalMemoryUsageBankSelector.emplace_back(new LocalMemoryUsageBankSelector(HwHelper::getSubDevicesCount(hwInfo)));
         externalLocalMemoryUsageBankSelector.emplace_back(new LocalMemoryUsageBankSelector(HwHelper::getSubDevicesCount(hwInfo)));
+        if (DebugManager.flags.EnableTileAccessBasedPlacement.get() == 1 && HwHelper::getSubDevicesCount(hwInfo) > 1) {
+            tilePlacementPolicies.emplace_back(new TilePlacementPolicy(HwHelper::getSubDevicesCount(hwInfo)));
+        } else {
+            tilePlacementPolicies.emplace_back(nullptr);
+        }
         this->localMemorySupported.push_back(HwHelper::get(hwInfo->platform.eRenderCoreFamily).getEnableLocalMemory(*hwInfo));
         this->enable64kbpages.push_back(OSInterface::osEnabled64kbPages && hwInfo->capabilityTable.ftr64KBpages && !!DebugManager.flags.Enable64kbpages.get());
 
@@ -69,9 +76,15 @@ MemoryManager::MemoryManager(ExecutionEnvironment &executionEnvironment) : execu
     if (DebugManager.flags.EnableMultiStorageResources.get() != -1) {
         supportsMultiStorageResources = !!DebugManager.flags.EnableMultiStorageResources.get();
     }
+
+    allocationProfiler = AllocationProfiler::create();
 }
 
 MemoryManager::~MemoryManager() {
+    if (allocationProfiler) {
+        // allocations still alive at this point were leaked
+        allocationProfiler->dump();
+    }
     for (auto &engine : registeredEngines) {
         engine.osContext->decRefInternal();
     }
@@ -210,7 +223,11 @@ void MemoryManager::freeGraphicsMemory(GraphicsAllocation *gfxAllocation, bool i
         freeAssociatedResourceImpl(*gfxAllocation);
     }
 
+    recordTileAccesses(*gfxAllocation);
     getLocalMemoryUsageBankSelector(gfxAllocation->getAllocationType(), gfxAllocation->getRootDeviceIndex())->freeOnBanks(gfxAllocation->storageInfo.getMemoryBanks(), gfxAllocation->getUnderlyingBufferSize());
+    if (allocationProfiler) {
+        allocationProfiler->recordFree(*gfxAllocation);
+    }
     freeGraphicsMemoryImpl(gfxAllocation, isImportedAllocation);
 }
 
@@ -421,6 +438,9 @@ bool MemoryManager::getAllocationData(AllocationData &allocationData, const Allo
         (mayRequireL3Flush ? properties.flags.flushL3RequiredForRead | properties.flags.flushL3RequiredForWrite : 0u);
     allocationData.flags.preferCompressed = properties.flags.preferCompressed;
     allocationData.flags.preferCompressed |= CompressionSelector::preferCompressedAllocation(properties, *hwInfo);
+    if (allocationData.flags.preferCompressed && compressionHostAccessTracker.isHostAccessFrequent(properties.allocationType)) {
+        allocationData.flags.preferCompressed = false;
+    }
     allocationData.flags.multiOsContextCapable = properties.flags.multiOsContextCapable;
     allocationData.usmInitialPlacement = properties.usmInitialPlacement;
 
@@ -492,6 +512,10 @@ GraphicsAllocation *MemoryManager::allocateGraphicsMemoryInPreferredPool(const A
     }
 
     fileLoggerInstance().logAllocation(allocation);
+    if (allocationProfiler) {
+        allocationProfiler->recordAllocation(*allocation);
+    }
+    compressionHostAccessTracker.recordCompressedAllocation(*allocation);
     registerAllocationInOs(allocation);
     return allocation;
 }
@@ -587,6 +611,20 @@ EngineControlContainer &MemoryManager::getRegisteredEngines() {
     return registeredEngines;
 }
 
+// Rebinds physical memory of the allocation at given canonized address without copying its contents,
+// mapping it back at its own address unmaps it from the virtual memory reservation.
+bool MemoryManager::mapPhysicalToVirtualMemory(GraphicsAllocation *physicalAllocation, uint64_t gpuRange, size_t bufferSize) {
+    if (bufferSize != physicalAllocation->getUnderlyingBufferSize()) {
+        return false;
+    }
+    physicalAllocation->setCpuPtrAndGpuAddress(physicalAllocation->getUnderlyingBuffer(), gpuRange);
+    return true;
+}
+
+bool MemoryManager::is2MBPageAlignmentRequired(size_t size) {
+    return DebugManager.flags.Enable2MBPagesForLargeAllocations.get() == 1 && size >= MemoryConstants::pageSize2Mb;
+}
+
 bool MemoryManager::isExternalAllocation(AllocationType allocationType) {
     if (allocationType == AllocationType::BUFFER ||
         allocationType == AllocationType::BUFFER_HOST_MEMORY ||
@@ -609,6 +647,24 @@ bool MemoryManager::isExternalAllocation(AllocationType allocationType) {
     return false;
 }
 
+void MemoryManager::recordTileAccesses(GraphicsAllocation &gfxAllocation) {
+    auto tilePlacementPolicy = getTilePlacementPolicy(gfxAllocation.getRootDeviceIndex());
+    if (tilePlacementPolicy == nullptr ||
+        (gfxAllocation.getAllocationType() != AllocationType::BUFFER && gfxAllocation.getAllocationType() != AllocationType::SVM_GPU) ||
+        !gfxAllocation.isUsed()) {
+        return;
+    }
+
+    // partitioned workloads are submitted on contexts of all tiles, so only sub device submissions make a tile dominant
+    DeviceBitfield accessingTiles;
+    for (auto &engine : registeredEngines) {
+        if (gfxAllocation.isUsedByOsContext(engine.osContext->getContextId())) {
+            accessingTiles |= engine.osContext->getDeviceBitfield();
+        }
+    }
+    tilePlacementPolicy->recordAccesses(accessingTiles, gfxAllocation.getUnderlyingBufferSize());
+}
+
 LocalMemoryUsageBankSelector *MemoryManager::getLocalMemoryUsageBankSelector(AllocationType allocationType, uint32_t rootDeviceIndex) {
     if (isExternalAllocation(allocationType)) {
         return externalLocalMemoryUsageBankSelector[rootDeviceIndex].get();
@@ -651,6 +707,7 @@ void *MemoryManager::lockResource(GraphicsAllocation *graphicsAllocation) {
     if (!retVal) {
         return nullptr;
     }
+    compressionHostAccessTracker.recordHostAccess(*graphicsAllocation);
 
     graphicsAllocation->lock(retVal);
     return retVal;
@@ -720,6 +777,19 @@ void MemoryManager::waitForEnginesCompletion(GraphicsAllocation &graphicsAllocat
     }
 }
 
+bool MemoryManager::allocInUse(GraphicsAllocation &graphicsAllocation) {
+    for (auto &engine : getRegisteredEngines()) {
+        auto osContextId = engine.osContext->getContextId();
+        auto allocationTaskCount = graphicsAllocation.getTaskCount(osContextId);
+        if (graphicsAllocation.isUsedByOsContext(osContextId) &&
+            engine.commandStreamReceiver->getTagAllocation() != nullptr &&
+            allocationTaskCount > *engine.commandStreamReceiver->getTagAddress()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void MemoryManager::cleanTemporaryAllocationListOnAllEngines(bool waitForCompletion) {
     for (auto &engine : getRegisteredEngines()) {
         auto csr = engine.commandStreamReceiver;
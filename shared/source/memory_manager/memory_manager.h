@@ -14,6 +14,7 @@
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/memory_manager/alignment_selector.h"
 #include "shared/source/memory_manager/allocation_properties.h"
+#include "shared/source/memory_manager/compression_selector.h"
 #include "shared/source/memory_manager/gfx_partition.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/host_ptr_defines.h"
@@ -26,15 +27,18 @@
 #include <cstdint>
 #include <map>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace NEO {
+class AllocationProfiler;
 class DeferredDeleter;
 class ExecutionEnvironment;
 class Gmm;
 class HostPtrManager;
 class OsContext;
 class PrefetchManager;
+class TilePlacementPolicy;
 
 enum AllocationUsage {
     TEMPORARY_ALLOCATION,
@@ -161,6 +165,7 @@ class MemoryManager {
 
     void waitForDeletions();
     MOCKABLE_VIRTUAL void waitForEnginesCompletion(GraphicsAllocation &graphicsAllocation);
+    MOCKABLE_VIRTUAL bool allocInUse(GraphicsAllocation &graphicsAllocation);
     void cleanTemporaryAllocationListOnAllEngines(bool waitForCompletion);
 
     bool isAsyncDeleterEnabled() const;
@@ -196,6 +201,8 @@ class MemoryManager {
     EngineControl *getRegisteredEngineForCsr(CommandStreamReceiver *commandStreamReceiver);
     void unregisterEngineForCsr(CommandStreamReceiver *commandStreamReceiver);
     HostPtrManager *getHostPtrManager() const { return hostPtrManager.get(); }
+    AllocationProfiler *getAllocationProfiler() const { return allocationProfiler.get(); }
+    CompressionHostAccessTracker &getCompressionHostAccessTracker() { return compressionHostAccessTracker; }
     void setDefaultEngineIndex(uint32_t rootDeviceIndex, uint32_t engineIndex) { defaultEngineIndex[rootDeviceIndex] = engineIndex; }
     virtual bool copyMemoryToAllocation(GraphicsAllocation *graphicsAllocation, size_t destinationOffset, const void *memoryToCopy, size_t sizeToCopy);
     virtual bool copyMemoryToAllocationBanks(GraphicsAllocation *graphicsAllocation, size_t destinationOffset, const void *memoryToCopy, size_t sizeToCopy, DeviceBitfield handleMask);
@@ -210,11 +217,13 @@ class MemoryManager {
     }
     virtual AddressRange reserveGpuAddress(size_t size, uint32_t rootDeviceIndex) = 0;
     virtual void freeGpuAddress(AddressRange addressRange, uint32_t rootDeviceIndex) = 0;
+    virtual bool mapPhysicalToVirtualMemory(GraphicsAllocation *physicalAllocation, uint64_t gpuRange, size_t bufferSize);
     static HeapIndex selectInternalHeap(bool useLocalMemory) { return useLocalMemory ? HeapIndex::HEAP_INTERNAL_DEVICE_MEMORY : HeapIndex::HEAP_INTERNAL; }
     static HeapIndex selectExternalHeap(bool useLocalMemory) { return useLocalMemory ? HeapIndex::HEAP_EXTERNAL_DEVICE_MEMORY : HeapIndex::HEAP_EXTERNAL; }
 
     static uint32_t maxOsContextCount;
     virtual void commonCleanup(){};
+    virtual void releaseCachedHostPtrPinning(const void *ptr, size_t size){};
     virtual bool isCpuCopyRequired(const void *ptr) { return false; }
     virtual bool isWCMemory(const void *ptr) { return false; }
 
@@ -226,6 +235,8 @@ class MemoryManager {
 
     bool isExternalAllocation(AllocationType allocationType);
     LocalMemoryUsageBankSelector *getLocalMemoryUsageBankSelector(AllocationType allocationType, uint32_t rootDeviceIndex);
+    TilePlacementPolicy *getTilePlacementPolicy(uint32_t rootDeviceIndex) const { return tilePlacementPolicies[rootDeviceIndex].get(); }
+    void recordTileAccesses(GraphicsAllocation &gfxAllocation);
 
     bool isLocalMemoryUsedForIsa(uint32_t rootDeviceIndex);
     MOCKABLE_VIRTUAL bool isNonSvmBuffer(const void *hostPtr, AllocationType allocationType, uint32_t rootDeviceIndex) {
@@ -262,11 +273,33 @@ class MemoryManager {
     std::unordered_map<std::string, KernelAllocationInfo> &getKernelAllocationMap() { return this->kernelAllocationMap; };
     [[nodiscard]] std::unique_lock<std::mutex> lockKernelAllocationMap() { return std::unique_lock<std::mutex>(this->kernelAllocationMutex); };
 
+    bool isIsaDeduplicationEnabled() {
+        auto deduplicateIsa = false;
+
+        if (DebugManager.flags.EnableIsaDeduplication.get() != -1) {
+            deduplicateIsa = DebugManager.flags.EnableIsaDeduplication.get();
+        }
+
+        return deduplicateIsa;
+    }
+
+    struct SharedIsaAllocationInfo {
+        SharedIsaAllocationInfo(GraphicsAllocation *allocation, const uint8_t *isa, size_t isaSize) : isaAllocation(allocation), isa(isa, isa + isaSize), reuseCounter(1u) {}
+
+        GraphicsAllocation *isaAllocation;
+        std::vector<uint8_t> isa;
+        uint32_t reuseCounter;
+    };
+
+    std::unordered_multimap<uint64_t /*isa hash*/, SharedIsaAllocationInfo> &getSharedIsaAllocationMap() { return this->sharedIsaAllocationMap; };
+    [[nodiscard]] std::unique_lock<std::mutex> lockSharedIsaAllocationMap() { return std::unique_lock<std::mutex>(this->sharedIsaAllocationMutex); };
+
   protected:
     bool getAllocationData(AllocationData &allocationData, const AllocationProperties &properties, const void *hostPtr, const StorageInfo &storageInfo);
     static void overrideAllocationData(AllocationData &allocationData, const AllocationProperties &properties);
 
     static bool isCopyRequired(ImageInfo &imgInfo, const void *hostPtr);
+    static bool is2MBPageAlignmentRequired(size_t size);
 
     bool useNonSvmHostPtrAlloc(AllocationType allocationType, uint32_t rootDeviceIndex);
     StorageInfo createStorageInfoFromProperties(const AllocationProperties &properties);
@@ -316,9 +349,12 @@ class MemoryManager {
     std::vector<std::unique_ptr<GfxPartition>> gfxPartitions;
     std::vector<std::unique_ptr<LocalMemoryUsageBankSelector>> internalLocalMemoryUsageBankSelector;
     std::vector<std::unique_ptr<LocalMemoryUsageBankSelector>> externalLocalMemoryUsageBankSelector;
+    std::vector<std::unique_ptr<TilePlacementPolicy>> tilePlacementPolicies;
     void *reservedMemory = nullptr;
     std::unique_ptr<PageFaultManager> pageFaultManager;
     std::unique_ptr<PrefetchManager> prefetchManager;
+    std::unique_ptr<AllocationProfiler> allocationProfiler;
+    CompressionHostAccessTracker compressionHostAccessTracker;
     OSMemory::ReservedCpuAddressRange reservedCpuAddressRange;
     HeapAssigner heapAssigner;
     AlignmentSelector alignmentSelector = {};
@@ -326,6 +362,8 @@ class MemoryManager {
     std::vector<bool> isaInLocalMemory;
     std::unordered_map<std::string, KernelAllocationInfo> kernelAllocationMap;
     std::mutex kernelAllocationMutex;
+    std::unordered_multimap<uint64_t, SharedIsaAllocationInfo> sharedIsaAllocationMap;
+    std::mutex sharedIsaAllocationMutex;
 };
 
 std::unique_ptr<DeferredDeleter> createDeferredDeleter();
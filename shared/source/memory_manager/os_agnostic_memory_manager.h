@@ -53,10 +53,12 @@ class MemoryAllocation : public GraphicsAllocation {
 
     void clearUsageInfo() {
         for (auto &info : usageInfos) {
-            info.inspectionId = 0u;
             info.residencyTaskCount = objectNotResident;
             info.taskCount = objectNotUsed;
         }
+        for (auto &inspectionId : inspectionIds) {
+            inspectionId = 0u;
+        }
     }
 };
 
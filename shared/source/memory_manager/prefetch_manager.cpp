@@ -7,6 +7,7 @@
 
 #include "shared/source/memory_manager/prefetch_manager.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 
@@ -23,12 +24,34 @@ void PrefetchManager::insertAllocation(SvmAllocationData &svmData) {
     }
 }
 
+void PrefetchManager::registerKernelAccessedAllocations(const ResidencyContainer &kernelAllocations, bool indirectSharedAllocationsAllowed) {
+    std::unique_lock<SpinLock> lock{mtx};
+    for (auto allocation : kernelAllocations) {
+        if (allocation) {
+            kernelAccessedAllocations.insert(allocation);
+        }
+    }
+    indirectSharedAccessByKernel |= indirectSharedAllocationsAllowed;
+}
+
+bool PrefetchManager::isAllocationAccessedByKernel(SvmAllocationData &svmData, uint32_t rootDeviceIndex) const {
+    if (DebugManager.flags.PrefetchOnlyKernelAccessedAllocations.get() != 1 || indirectSharedAccessByKernel) {
+        return true;
+    }
+    auto gpuAllocation = svmData.gpuAllocations.getGraphicsAllocation(rootDeviceIndex);
+    return kernelAccessedAllocations.find(gpuAllocation) != kernelAccessedAllocations.end();
+}
+
 void PrefetchManager::migrateAllocationsToGpu(SVMAllocsManager &unifiedMemoryManager, Device &device) {
     std::unique_lock<SpinLock> lock{mtx};
     for (auto allocData : allocations) {
-        unifiedMemoryManager.prefetchMemory(device, allocData);
+        if (isAllocationAccessedByKernel(allocData, device.getRootDeviceIndex())) {
+            unifiedMemoryManager.prefetchMemory(device, allocData);
+        }
     }
     allocations.clear();
+    kernelAccessedAllocations.clear();
+    indirectSharedAccessByKernel = false;
 }
 
 } // namespace NEO
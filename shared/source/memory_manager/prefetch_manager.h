@@ -8,15 +8,18 @@
 #pragma once
 
 #include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/memory_manager/residency_container.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/utilities/spinlock.h"
 
 #include <memory>
+#include <unordered_set>
 #include <vector>
 
 namespace NEO {
 
 class Device;
+class GraphicsAllocation;
 class SVMAllocsManager;
 
 class PrefetchManager : public NonCopyableOrMovableClass {
@@ -27,10 +30,16 @@ class PrefetchManager : public NonCopyableOrMovableClass {
 
     void insertAllocation(SvmAllocationData &svmData);
 
+    void registerKernelAccessedAllocations(const ResidencyContainer &kernelAllocations, bool indirectSharedAllocationsAllowed);
+
     MOCKABLE_VIRTUAL void migrateAllocationsToGpu(SVMAllocsManager &unifiedMemoryManager, Device &device);
 
   protected:
+    bool isAllocationAccessedByKernel(SvmAllocationData &svmData, uint32_t rootDeviceIndex) const;
+
     std::vector<SvmAllocationData> allocations;
+    std::unordered_set<const GraphicsAllocation *> kernelAccessedAllocations;
+    bool indirectSharedAccessByKernel = false;
     SpinLock mtx;
 };
 
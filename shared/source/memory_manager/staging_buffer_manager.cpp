@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/staging_buffer_manager.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/ptr_math.h"
+
+#include <cstring>
+
+namespace NEO {
+
+StagingBufferManager::StagingBufferManager(SVMAllocsManager *svmAllocsManager, const RootDeviceIndicesContainer &rootDeviceIndices, const std::map<uint32_t, DeviceBitfield> &deviceBitfields)
+    : svmAllocsManager(svmAllocsManager) {
+    if (DebugManager.flags.StagingBufferSize.get() > 0) {
+        chunkSize = static_cast<size_t>(DebugManager.flags.StagingBufferSize.get()) * MemoryConstants::kiloByte;
+    }
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    stagingBuffers.resize(stagingBuffersCount);
+    for (auto &stagingBuffer : stagingBuffers) {
+        stagingBuffer.baseAddress = svmAllocsManager->createHostUnifiedMemoryAllocation(chunkSize, unifiedMemoryProperties);
+    }
+}
+
+StagingBufferManager::~StagingBufferManager() {
+    for (auto &stagingBuffer : stagingBuffers) {
+        if (stagingBuffer.baseAddress) {
+            svmAllocsManager->freeSVMAlloc(stagingBuffer.baseAddress, true);
+        }
+    }
+}
+
+/*
+ * Staging copy pays off only for pageable host memory large enough to span
+ * several chunks. USM and imported pointers are already GPU accessible.
+ */
+bool StagingBufferManager::isValidForCopy(const void *srcPtr, size_t size, bool hasDependencies) const {
+    if (hasDependencies || size < 2 * chunkSize) {
+        return false;
+    }
+    for (auto &stagingBuffer : stagingBuffers) {
+        if (stagingBuffer.baseAddress == nullptr) {
+            return false;
+        }
+    }
+    return svmAllocsManager->getSVMAlloc(srcPtr) == nullptr;
+}
+
+/*
+ * Double buffered copy: while the engine transfers one staging buffer,
+ * the next chunk is copied by the CPU into the other one. A staging buffer
+ * is reused only after the task which consumed it has completed.
+ */
+int32_t StagingBufferManager::performCopy(const void *srcPtr, size_t size, ChunkCopyFunction &chunkCopyFunc, CommandStreamReceiver *csr) {
+    std::lock_guard<std::mutex> lock(mtx);
+    size_t chunkIndex = 0u;
+    for (size_t chunkOffset = 0u; chunkOffset < size; chunkOffset += chunkSize, chunkIndex++) {
+        auto &stagingBuffer = stagingBuffers[chunkIndex % stagingBuffersCount];
+        waitForStagingBuffer(stagingBuffer);
+        auto stagingPtr = stagingBuffer.baseAddress;
+
+        auto currentChunkSize = std::min(chunkSize, size - chunkOffset);
+        memcpy(stagingPtr, ptrOffset(srcPtr, chunkOffset), currentChunkSize);
+
+        auto ret = chunkCopyFunc(stagingPtr, chunkOffset, currentChunkSize);
+        if (ret != 0) {
+            return ret;
+        }
+        stagingBuffer.csr = csr;
+        stagingBuffer.taskCount = csr->peekTaskCount();
+    }
+    return 0;
+}
+
+void StagingBufferManager::waitForStagingBuffer(StagingBuffer &stagingBuffer) {
+    if (stagingBuffer.csr) {
+        stagingBuffer.csr->waitForTaskCount(stagingBuffer.taskCount);
+        stagingBuffer.csr = nullptr;
+    }
+}
+
+} // namespace NEO
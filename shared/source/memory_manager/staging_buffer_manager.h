@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/utilities/stackvec.h"
+
+#include <functional>
+#include <mutex>
+
+namespace NEO {
+
+class CommandStreamReceiver;
+
+// Copies a chunk already placed in the staging buffer to the destination; returns 0 on success
+using ChunkCopyFunction = std::function<int32_t(void *stagingBuffer, size_t chunkOffset, size_t chunkSize)>;
+
+struct StagingBuffer {
+    void *baseAddress = nullptr;
+    CommandStreamReceiver *csr = nullptr;
+    uint32_t taskCount = 0u;
+};
+
+class StagingBufferManager : public NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t stagingBuffersCount = 2u;
+
+    StagingBufferManager(SVMAllocsManager *svmAllocsManager, const RootDeviceIndicesContainer &rootDeviceIndices, const std::map<uint32_t, DeviceBitfield> &deviceBitfields);
+    ~StagingBufferManager();
+
+    bool isValidForCopy(const void *srcPtr, size_t size, bool hasDependencies) const;
+    int32_t performCopy(const void *srcPtr, size_t size, ChunkCopyFunction &chunkCopyFunc, CommandStreamReceiver *csr);
+
+    size_t getChunkSize() const { return chunkSize; }
+    static bool isEnabled() { return DebugManager.flags.EnableCopyWithStagingBuffers.get() == 1; }
+
+  protected:
+    void waitForStagingBuffer(StagingBuffer &stagingBuffer);
+
+    StackVec<StagingBuffer, stagingBuffersCount> stagingBuffers;
+    size_t chunkSize = MemoryConstants::pageSize2Mb;
+    SVMAllocsManager *svmAllocsManager;
+    std::mutex mtx;
+};
+
+} // namespace NEO
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/tile_placement_policy.h"
+
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/debug_helpers.h"
+
+namespace NEO {
+
+TilePlacementPolicy::TilePlacementPolicy(uint32_t tilesCount) : tilesCount(tilesCount) {
+    UNRECOVERABLE_IF(tilesCount == 0);
+
+    accessedBytes.reset(new std::array<std::atomic<uint64_t>, sizeClassesCount>[tilesCount]);
+    for (uint32_t i = 0; i < tilesCount; i++) {
+        for (auto &bytes : accessedBytes[i]) {
+            bytes = 0;
+        }
+    }
+}
+
+size_t TilePlacementPolicy::getSizeClass(uint64_t allocationSize) {
+    return allocationSize == 0u ? 0u : Math::log2(allocationSize);
+}
+
+void TilePlacementPolicy::recordAccesses(DeviceBitfield accessingTiles, uint64_t allocationSize) {
+    auto sizeClass = getSizeClass(allocationSize);
+    for (uint32_t tileIndex = 0; tileIndex < tilesCount; tileIndex++) {
+        if (accessingTiles.test(tileIndex)) {
+            accessedBytes[tileIndex][sizeClass] += allocationSize;
+        }
+    }
+}
+
+bool TilePlacementPolicy::getDominantTile(DeviceBitfield candidateTiles, uint64_t allocationSize, uint32_t &dominantTile) const {
+    auto sizeClass = getSizeClass(allocationSize);
+    uint64_t totalBytes = 0u;
+    uint64_t maxBytes = 0u;
+    for (uint32_t tileIndex = 0; tileIndex < tilesCount; tileIndex++) {
+        uint64_t bytes = accessedBytes[tileIndex][sizeClass];
+        totalBytes += bytes;
+        if (candidateTiles.test(tileIndex) && bytes > maxBytes) {
+            maxBytes = bytes;
+            dominantTile = tileIndex;
+        }
+    }
+    return maxBytes > 0u && maxBytes * 100u >= totalBytes * dominantAccessPercentage;
+}
+
+uint64_t TilePlacementPolicy::getAccessedBytes(uint32_t tileIndex, uint64_t allocationSize) const {
+    UNRECOVERABLE_IF(tileIndex >= tilesCount);
+    return accessedBytes[tileIndex][getSizeClass(allocationSize)];
+}
+
+} // namespace NEO
@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/common_types.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <array>
+#include <atomic>
+#include <memory>
+
+namespace NEO {
+// Learns which tiles access device allocations of given size class, allocations are
+// recorded when freed and new allocations of the same size class are placed in local
+// memory of the tile which dominates the accesses.
+class TilePlacementPolicy : public NonCopyableOrMovableClass {
+  public:
+    static constexpr size_t sizeClassesCount = 64u;
+    static constexpr uint32_t dominantAccessPercentage = 75u;
+
+    TilePlacementPolicy() = delete;
+    TilePlacementPolicy(uint32_t tilesCount);
+
+    void recordAccesses(DeviceBitfield accessingTiles, uint64_t allocationSize);
+    bool getDominantTile(DeviceBitfield candidateTiles, uint64_t allocationSize, uint32_t &dominantTile) const;
+
+    uint64_t getAccessedBytes(uint32_t tileIndex, uint64_t allocationSize) const;
+
+  protected:
+    static size_t getSizeClass(uint64_t allocationSize);
+
+    uint32_t tilesCount = 0;
+    std::unique_ptr<std::array<std::atomic<uint64_t>, sizeClassesCount>[]> accessedBytes;
+};
+} // namespace NEO
@@ -16,19 +16,67 @@
 
 namespace NEO {
 
+struct SvmAllocationLookupCache {
+    const void *tracker = nullptr;
+    uint64_t generation = 0u;
+    uintptr_t start = 0u;
+    uintptr_t end = 0u;
+    SvmAllocationData *allocationData = nullptr;
+};
+
+static std::atomic<uint64_t> svmAllocationTrackerGeneration{0u};
+static thread_local SvmAllocationLookupCache lastSvmAllocationLookup;
+
 void SVMAllocsManager::MapBasedAllocationTracker::insert(SvmAllocationData allocationsPair) {
-    allocations.insert(std::make_pair(reinterpret_cast<void *>(allocationsPair.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()), allocationsPair));
+    auto result = allocations.insert(std::make_pair(reinterpret_cast<void *>(allocationsPair.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()), allocationsPair));
+    if (!result.second) {
+        return;
+    }
+    auto start = reinterpret_cast<uintptr_t>(result.first->first);
+    auto &allocationData = result.first->second;
+    auto rangeIter = std::lower_bound(ranges.begin(), ranges.end(), start,
+                                      [](const SvmAllocationRange &range, uintptr_t address) { return range.start < address; });
+    ranges.insert(rangeIter, {start, start + allocationData.size, &allocationData});
+    generation = ++svmAllocationTrackerGeneration;
 }
 
 void SVMAllocsManager::MapBasedAllocationTracker::remove(SvmAllocationData allocationsPair) {
     SvmAllocationContainer::iterator iter;
     iter = allocations.find(reinterpret_cast<void *>(allocationsPair.gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
+    auto start = reinterpret_cast<uintptr_t>(iter->first);
+    auto rangeIter = std::lower_bound(ranges.begin(), ranges.end(), start,
+                                      [](const SvmAllocationRange &range, uintptr_t address) { return range.start < address; });
+    if (rangeIter != ranges.end() && rangeIter->start == start) {
+        ranges.erase(rangeIter);
+    }
     allocations.erase(iter);
+    generation = ++svmAllocationTrackerGeneration;
 }
 
-void SVMAllocsManager::SvmAllocationCache::insert(size_t size, void *ptr) {
+static bool isAllocatedOnRootDevices(const SvmAllocationData &svmAllocData, const RootDeviceIndicesContainer &rootDeviceIndices) {
+    size_t numAllocations = 0u;
+    for (auto allocation : svmAllocData.gpuAllocations.getGraphicsAllocations()) {
+        numAllocations += (allocation != nullptr) ? 1u : 0u;
+    }
+    if (numAllocations != rootDeviceIndices.size()) {
+        return false;
+    }
+    for (auto rootDeviceIndex : rootDeviceIndices) {
+        if (svmAllocData.gpuAllocations.getGraphicsAllocation(rootDeviceIndex) == nullptr) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SVMAllocsManager::SvmAllocationCache::insert(size_t size, void *ptr) {
     std::lock_guard<std::mutex> lock(this->mtx);
+    if (maxTotalSize != 0u && totalSize + size > maxTotalSize) {
+        return false;
+    }
     allocations.emplace(std::lower_bound(allocations.begin(), allocations.end(), size), size, ptr);
+    totalSize += size;
+    return true;
 }
 
 void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const UnifiedMemoryProperties &unifiedMemoryProperties, SVMAllocsManager *svmAllocsManager) {
@@ -36,12 +84,18 @@ void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const UnifiedMemory
     for (auto allocationIter = std::lower_bound(allocations.begin(), allocations.end(), size);
          allocationIter != allocations.end();
          ++allocationIter) {
+        if (maxReuseRatio != 0u && allocationIter->allocationSize > size * maxReuseRatio) {
+            break;
+        }
         void *allocationPtr = allocationIter->allocation;
         SvmAllocationData *svmAllocData = svmAllocsManager->getSVMAlloc(allocationPtr);
         UNRECOVERABLE_IF(!svmAllocData);
         if (svmAllocData->device == unifiedMemoryProperties.device &&
+            svmAllocData->memoryType == unifiedMemoryProperties.memoryType &&
             svmAllocData->allocationFlagsProperty.allFlags == unifiedMemoryProperties.allocationFlags.allFlags &&
-            svmAllocData->allocationFlagsProperty.allAllocFlags == unifiedMemoryProperties.allocationFlags.allAllocFlags) {
+            svmAllocData->allocationFlagsProperty.allAllocFlags == unifiedMemoryProperties.allocationFlags.allAllocFlags &&
+            (unifiedMemoryProperties.device != nullptr || isAllocatedOnRootDevices(*svmAllocData, unifiedMemoryProperties.rootDeviceIndices))) {
+            totalSize -= allocationIter->allocationSize;
             allocations.erase(allocationIter);
             return allocationPtr;
         }
@@ -57,32 +111,35 @@ void SVMAllocsManager::SvmAllocationCache::trim(SVMAllocsManager *svmAllocsManag
         svmAllocsManager->freeSVMAllocImpl(cachedAllocationInfo.allocation, false, svmData);
     }
     this->allocations.clear();
+    this->totalSize = 0u;
 }
 
 SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::get(const void *ptr) {
-    SvmAllocationContainer::iterator iter, end;
-    SvmAllocationData *svmAllocData;
-    if ((ptr == nullptr) || (allocations.size() == 0)) {
+    if ((ptr == nullptr) || (ranges.size() == 0)) {
         return nullptr;
     }
-    end = allocations.end();
-    iter = allocations.lower_bound(ptr);
-    if (((iter != end) && (iter->first != ptr)) ||
-        (iter == end)) {
-        if (iter == allocations.begin()) {
-            iter = end;
-        } else {
-            iter--;
-        }
+    auto address = reinterpret_cast<uintptr_t>(ptr);
+    auto &lastLookup = lastSvmAllocationLookup;
+    if (lastLookup.tracker == this && lastLookup.generation == generation &&
+        address >= lastLookup.start && address < lastLookup.end) {
+        return lastLookup.allocationData;
     }
-    if (iter != end) {
-        svmAllocData = &iter->second;
-        char *charPtr = reinterpret_cast<char *>(svmAllocData->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress());
-        if (ptr < (charPtr + svmAllocData->size)) {
-            return svmAllocData;
-        }
+
+    auto rangeIter = std::upper_bound(ranges.begin(), ranges.end(), address,
+                                      [](uintptr_t address, const SvmAllocationRange &range) { return address < range.start; });
+    if (rangeIter == ranges.begin()) {
+        return nullptr;
     }
-    return nullptr;
+    --rangeIter;
+    if (address >= rangeIter->end) {
+        return nullptr;
+    }
+    lastLookup.tracker = this;
+    lastLookup.generation = generation;
+    lastLookup.start = rangeIter->start;
+    lastLookup.end = rangeIter->end;
+    lastLookup.allocationData = rangeIter->allocationData;
+    return rangeIter->allocationData;
 }
 
 void SVMAllocsManager::MapOperationsTracker::insert(SvmMapOperation mapOperation) {
@@ -145,10 +202,24 @@ SVMAllocsManager::SVMAllocsManager(MemoryManager *memoryManager, bool multiOsCon
     if (this->usmDeviceAllocationsCacheEnabled) {
         this->initUsmDeviceAllocationsCache();
     }
+    this->usmHostAllocationsCacheEnabled = DebugManager.flags.EnableHostUsmAllocationCache.get() == 1;
+    if (this->usmHostAllocationsCacheEnabled) {
+        this->initUsmHostAllocationsCache();
+    }
+    this->usmSharedAllocationsCacheEnabled = DebugManager.flags.EnableSharedUsmAllocationCache.get() == 1;
+    if (this->usmSharedAllocationsCacheEnabled) {
+        this->initUsmSharedAllocationsCache();
+    }
+    if (DebugManager.flags.UsmAllocationCacheMaxSize.get() != -1) {
+        auto maxTotalSize = static_cast<size_t>(DebugManager.flags.UsmAllocationCacheMaxSize.get());
+        this->usmDeviceAllocationsCache.maxTotalSize = maxTotalSize;
+        this->usmHostAllocationsCache.maxTotalSize = maxTotalSize;
+        this->usmSharedAllocationsCache.maxTotalSize = maxTotalSize;
+    }
 }
 
 SVMAllocsManager::~SVMAllocsManager() {
-    this->trimUSMDeviceAllocCache();
+    this->trimUSMAllocCaches();
 }
 
 void *SVMAllocsManager::createSVMAlloc(size_t size, const SvmAllocationProperties svmProperties,
@@ -170,6 +241,13 @@ void *SVMAllocsManager::createSVMAlloc(size_t size, const SvmAllocationPropertie
 
 void *SVMAllocsManager::createHostUnifiedMemoryAllocation(size_t size,
                                                           const UnifiedMemoryProperties &memoryProperties) {
+    if (this->usmHostAllocationsCacheEnabled && memoryProperties.allocationFlags.hostptr == 0u) {
+        void *allocationFromCache = this->usmHostAllocationsCache.get(size, memoryProperties, this);
+        if (allocationFromCache) {
+            return allocationFromCache;
+        }
+    }
+
     size_t pageSizeForAlignment = MemoryConstants::pageSize;
     size_t alignedSize = alignUp<size_t>(size, pageSizeForAlignment);
 
@@ -199,6 +277,10 @@ void *SVMAllocsManager::createHostUnifiedMemoryAllocation(size_t size,
     void *externalHostPointer = reinterpret_cast<void *>(memoryProperties.allocationFlags.hostptr);
 
     void *usmPtr = memoryManager->createMultiGraphicsAllocationInSystemMemoryPool(rootDeviceIndicesVector, unifiedMemoryProperties, allocData.gpuAllocations, externalHostPointer);
+    if (!usmPtr && this->usmHostAllocationsCacheEnabled) {
+        this->trimUSMHostAllocCache();
+        usmPtr = memoryManager->createMultiGraphicsAllocationInSystemMemoryPool(rootDeviceIndicesVector, unifiedMemoryProperties, allocData.gpuAllocations, externalHostPointer);
+    }
     if (!usmPtr) {
         return nullptr;
     }
@@ -209,9 +291,9 @@ void *SVMAllocsManager::createHostUnifiedMemoryAllocation(size_t size,
     allocData.allocationFlagsProperty = memoryProperties.allocationFlags;
     allocData.device = nullptr;
     allocData.pageSizeForAlignment = pageSizeForAlignment;
-    allocData.setAllocId(this->allocationsCounter++);
 
     std::unique_lock<std::shared_mutex> lock(mtx);
+    allocData.setAllocId(this->allocationsCounter++);
     this->SVMAllocs.insert(allocData);
 
     return usmPtr;
@@ -255,6 +337,9 @@ void *SVMAllocsManager::createUnifiedMemoryAllocation(size_t size,
 
     if (memoryProperties.memoryType == InternalMemoryType::DEVICE_UNIFIED_MEMORY) {
         unifiedMemoryProperties.flags.isUSMDeviceAllocation = true;
+        if (DebugManager.flags.DeviceUsmPreferredTile.get() != -1) {
+            unifiedMemoryProperties.preferredTileHint.set(DebugManager.flags.DeviceUsmPreferredTile.get());
+        }
         if (this->usmDeviceAllocationsCacheEnabled) {
             void *allocationFromCache = this->usmDeviceAllocationsCache.get(size, memoryProperties, this);
             if (allocationFromCache) {
@@ -271,6 +356,10 @@ void *SVMAllocsManager::createUnifiedMemoryAllocation(size_t size,
             this->usmDeviceAllocationsCacheEnabled) {
             this->trimUSMDeviceAllocCache();
             unifiedMemoryAllocation = memoryManager->allocateGraphicsMemoryWithProperties(unifiedMemoryProperties);
+        } else if (memoryProperties.memoryType == InternalMemoryType::SHARED_UNIFIED_MEMORY &&
+                   this->usmSharedAllocationsCacheEnabled) {
+            this->trimUSMSharedAllocCache();
+            unifiedMemoryAllocation = memoryManager->allocateGraphicsMemoryWithProperties(unifiedMemoryProperties);
         }
         if (!unifiedMemoryAllocation) {
             return nullptr;
@@ -286,9 +375,9 @@ void *SVMAllocsManager::createUnifiedMemoryAllocation(size_t size,
     allocData.memoryType = memoryProperties.memoryType;
     allocData.allocationFlagsProperty = memoryProperties.allocationFlags;
     allocData.device = memoryProperties.device;
-    allocData.setAllocId(this->allocationsCounter++);
 
     std::unique_lock<std::shared_mutex> lock(mtx);
+    allocData.setAllocId(this->allocationsCounter++);
     this->SVMAllocs.insert(allocData);
     return reinterpret_cast<void *>(unifiedMemoryAllocation->getGpuAddress());
 }
@@ -300,6 +389,13 @@ void *SVMAllocsManager::createSharedUnifiedMemoryAllocation(size_t size,
         return createHostUnifiedMemoryAllocation(size, memoryProperties);
     }
 
+    if (this->usmSharedAllocationsCacheEnabled) {
+        void *allocationFromCache = this->usmSharedAllocationsCache.get(size, memoryProperties, this);
+        if (allocationFromCache) {
+            return allocationFromCache;
+        }
+    }
+
     auto supportDualStorageSharedMemory = memoryManager->isLocalMemorySupported(*memoryProperties.rootDeviceIndices.begin());
 
     if (DebugManager.flags.AllocateSharedAllocationsWithCpuAndGpuStorage.get() != -1) {
@@ -368,9 +464,9 @@ void *SVMAllocsManager::createUnifiedKmdMigratedAllocation(size_t size, const Sv
     allocData.device = unifiedMemoryProperties.device;
     allocData.size = size;
     allocData.pageSizeForAlignment = pageSizeForAlignment;
-    allocData.setAllocId(this->allocationsCounter++);
 
     std::unique_lock<std::shared_mutex> lock(mtx);
+    allocData.setAllocId(this->allocationsCounter++);
     this->SVMAllocs.insert(allocData);
     return allocationGpu->getUnderlyingBuffer();
 }
@@ -400,8 +496,22 @@ bool SVMAllocsManager::freeSVMAlloc(void *ptr, bool blocking) {
     if (svmData) {
         if (InternalMemoryType::DEVICE_UNIFIED_MEMORY == svmData->memoryType &&
             this->usmDeviceAllocationsCacheEnabled) {
-            this->usmDeviceAllocationsCache.insert(svmData->size, ptr);
-            return true;
+            if (this->usmDeviceAllocationsCache.insert(svmData->size, ptr)) {
+                return true;
+            }
+        } else if (InternalMemoryType::HOST_UNIFIED_MEMORY == svmData->memoryType &&
+                   this->usmHostAllocationsCacheEnabled &&
+                   false == svmData->isImportedAllocation &&
+                   svmData->allocationFlagsProperty.hostptr == 0u) {
+            if (this->usmHostAllocationsCache.insert(svmData->size, ptr)) {
+                return true;
+            }
+        } else if (InternalMemoryType::SHARED_UNIFIED_MEMORY == svmData->memoryType &&
+                   this->usmSharedAllocationsCacheEnabled &&
+                   isCacheableSharedAllocation(*svmData)) {
+            if (this->usmSharedAllocationsCache.insert(svmData->size, ptr)) {
+                return true;
+            }
         }
         this->freeSVMAllocImpl(ptr, blocking, svmData);
         return true;
@@ -441,6 +551,25 @@ void SVMAllocsManager::trimUSMDeviceAllocCache() {
     this->usmDeviceAllocationsCache.trim(this);
 }
 
+void SVMAllocsManager::trimUSMHostAllocCache() {
+    this->usmHostAllocationsCache.trim(this);
+}
+
+void SVMAllocsManager::trimUSMSharedAllocCache() {
+    this->usmSharedAllocationsCache.trim(this);
+}
+
+void SVMAllocsManager::trimUSMAllocCaches() {
+    this->trimUSMDeviceAllocCache();
+    this->trimUSMHostAllocCache();
+    this->trimUSMSharedAllocCache();
+}
+
+bool SVMAllocsManager::isCacheableSharedAllocation(const SvmAllocationData &svmData) const {
+    // allocations with CPU storage are tracked by page fault manager together with their command queue
+    return svmData.cpuAllocation == nullptr && false == svmData.isImportedAllocation;
+}
+
 void *SVMAllocsManager::createZeroCopySvmAllocation(size_t size, const SvmAllocationProperties &svmProperties,
                                                     const RootDeviceIndicesContainer &rootDeviceIndices,
                                                     const std::map<uint32_t, DeviceBitfield> &subdeviceBitfields) {
@@ -533,9 +662,9 @@ void *SVMAllocsManager::createUnifiedAllocationWithDeviceStorage(size_t size, co
     allocData.device = unifiedMemoryProperties.device;
     allocData.pageSizeForAlignment = pageSizeForAlignment;
     allocData.size = size;
-    allocData.setAllocId(this->allocationsCounter++);
 
     std::unique_lock<std::shared_mutex> lock(mtx);
+    allocData.setAllocId(this->allocationsCounter++);
     this->SVMAllocs.insert(allocData);
     return svmPtr;
 }
@@ -552,6 +681,16 @@ void SVMAllocsManager::initUsmDeviceAllocationsCache() {
     this->usmDeviceAllocationsCache.allocations.reserve(128u);
 }
 
+void SVMAllocsManager::initUsmHostAllocationsCache() {
+    this->usmHostAllocationsCache.allocations.reserve(128u);
+    this->usmHostAllocationsCache.maxReuseRatio = 2u;
+}
+
+void SVMAllocsManager::initUsmSharedAllocationsCache() {
+    this->usmSharedAllocationsCache.allocations.reserve(128u);
+    this->usmSharedAllocationsCache.maxReuseRatio = 2u;
+}
+
 void SVMAllocsManager::freeSvmAllocationWithDeviceStorage(SvmAllocationData *svmData) {
     auto graphicsAllocations = svmData->gpuAllocations.getGraphicsAllocations();
     GraphicsAllocation *cpuAllocation = svmData->cpuAllocation;
@@ -576,11 +715,12 @@ bool SVMAllocsManager::hasHostAllocations() {
 
 void SVMAllocsManager::makeIndirectAllocationsResident(CommandStreamReceiver &commandStreamReceiver, uint32_t taskCount) {
     std::unique_lock<std::shared_mutex> lock(mtx);
-    bool parseAllAllocations = false;
+    bool parseAllocations = false;
+    uint32_t firstNewObjectId = 0u;
     auto entry = indirectAllocationsResidency.find(&commandStreamReceiver);
 
     if (entry == indirectAllocationsResidency.end()) {
-        parseAllAllocations = true;
+        parseAllocations = true;
 
         InternalAllocationsTracker tracker = {};
         tracker.latestResidentObjectId = this->allocationsCounter;
@@ -589,14 +729,19 @@ void SVMAllocsManager::makeIndirectAllocationsResident(CommandStreamReceiver &co
         this->indirectAllocationsResidency.insert(std::make_pair(&commandStreamReceiver, tracker));
     } else {
         if (this->allocationsCounter > entry->second.latestResidentObjectId) {
-            parseAllAllocations = true;
+            parseAllocations = true;
+            // allocations from previous generations are already always resident for this csr
+            firstNewObjectId = entry->second.latestResidentObjectId;
 
             entry->second.latestResidentObjectId = this->allocationsCounter;
         }
         entry->second.latestSentTaskCount = taskCount;
     }
-    if (parseAllAllocations) {
+    if (parseAllocations) {
         for (auto &allocation : this->SVMAllocs.allocations) {
+            if (allocation.second.getAllocId() < firstNewObjectId) {
+                continue;
+            }
             auto gpuAllocation = allocation.second.gpuAllocations.getGraphicsAllocation(commandStreamReceiver.getRootDeviceIndex());
             if (gpuAllocation == nullptr) {
                 continue;
@@ -19,6 +19,7 @@
 #include <mutex>
 #include <set>
 #include <shared_mutex>
+#include <vector>
 
 namespace NEO {
 class CommandStreamReceiver;
@@ -80,12 +81,19 @@ class SVMAllocsManager {
 
       public:
         using SvmAllocationContainer = std::map<const void *, SvmAllocationData>;
+        struct SvmAllocationRange {
+            uintptr_t start;
+            uintptr_t end;
+            SvmAllocationData *allocationData;
+        };
         void insert(SvmAllocationData);
         void remove(SvmAllocationData);
         SvmAllocationData *get(const void *);
         size_t getNumAllocs() const { return allocations.size(); };
 
         SvmAllocationContainer allocations;
+        std::vector<SvmAllocationRange> ranges; // sorted by start address, used for lookups by get()
+        uint64_t generation = 0u;
     };
 
     struct MapOperationsTracker {
@@ -136,11 +144,14 @@ class SVMAllocsManager {
     };
 
     struct SvmAllocationCache {
-        void insert(size_t size, void *);
+        bool insert(size_t size, void *);
         void *get(size_t size, const UnifiedMemoryProperties &unifiedMemoryProperties, SVMAllocsManager *svmAllocsManager);
         void trim(SVMAllocsManager *svmAllocsManager);
         std::vector<SvmCacheAllocationInfo> allocations;
         std::mutex mtx;
+        size_t totalSize = 0u;
+        size_t maxTotalSize = 0u;  // 0 - no limit
+        size_t maxReuseRatio = 0u; // 0 - any cached allocation not smaller than requested size can be reused
     };
 
     SVMAllocsManager(MemoryManager *memoryManager, bool multiOsContextSupport);
@@ -165,6 +176,9 @@ class SVMAllocsManager {
     MOCKABLE_VIRTUAL void freeSVMAllocImpl(void *ptr, bool blocking, SvmAllocationData *svmData);
     bool freeSVMAlloc(void *ptr) { return freeSVMAlloc(ptr, false); }
     void trimUSMDeviceAllocCache();
+    void trimUSMHostAllocCache();
+    void trimUSMSharedAllocCache();
+    void trimUSMAllocCaches();
     void insertSVMAlloc(const SvmAllocationData &svmData);
     void removeSVMAlloc(const SvmAllocationData &svmData);
     size_t getNumAllocs() const { return SVMAllocs.getNumAllocs(); }
@@ -200,6 +214,9 @@ class SVMAllocsManager {
     void freeZeroCopySvmAllocation(SvmAllocationData *svmData);
 
     void initUsmDeviceAllocationsCache();
+    void initUsmHostAllocationsCache();
+    void initUsmSharedAllocationsCache();
+    bool isCacheableSharedAllocation(const SvmAllocationData &svmData) const;
 
     MapBasedAllocationTracker SVMAllocs;
     MapOperationsTracker svmMapOperations;
@@ -208,6 +225,10 @@ class SVMAllocsManager {
     std::mutex mtxForIndirectAccess;
     bool multiOsContextSupport;
     SvmAllocationCache usmDeviceAllocationsCache;
+    SvmAllocationCache usmHostAllocationsCache;
+    SvmAllocationCache usmSharedAllocationsCache;
     bool usmDeviceAllocationsCacheEnabled = false;
+    bool usmHostAllocationsCacheEnabled = false;
+    bool usmSharedAllocationsCacheEnabled = false;
 };
 } // namespace NEO
@@ -9,8 +9,33 @@
 
 #include "shared/source/utilities/io_functions.h"
 
+#include <string_view>
+
 namespace NEO {
 
+// Environment is walked once and lookups of all debug variables are served from the snapshot,
+// instead of getenv scanning whole environment for every declared variable.
+void EnvironmentVariableReader::prefetchSettings() {
+    environmentSnapshot.clear();
+    for (auto entry = IoFunctions::getEnvironmentPtr(); entry != nullptr && *entry != nullptr; entry++) {
+        std::string_view variable{*entry};
+        auto separator = variable.find('=');
+        if (separator == std::string_view::npos || separator == 0) {
+            continue;
+        }
+        environmentSnapshot.emplace(variable.substr(0, separator), variable.substr(separator + 1));
+    }
+    environmentSnapshotLoaded = true;
+}
+
+const char *EnvironmentVariableReader::getEnvValue(const char *settingName) {
+    if (!environmentSnapshotLoaded) {
+        return IoFunctions::getenvPtr(settingName);
+    }
+    auto variable = environmentSnapshot.find(settingName);
+    return variable != environmentSnapshot.end() ? variable->second.c_str() : nullptr;
+}
+
 const char *EnvironmentVariableReader::appSpecificLocation(const std::string &name) {
     return name.c_str();
 }
@@ -25,9 +50,9 @@ int32_t EnvironmentVariableReader::getSetting(const char *settingName, int32_t d
 
 int64_t EnvironmentVariableReader::getSetting(const char *settingName, int64_t defaultValue) {
     int64_t value = defaultValue;
-    char *envValue;
+    const char *envValue;
 
-    envValue = IoFunctions::getenvPtr(settingName);
+    envValue = getEnvValue(settingName);
     if (envValue) {
         value = atoll(envValue);
     }
@@ -35,11 +60,11 @@ int64_t EnvironmentVariableReader::getSetting(const char *settingName, int64_t d
 }
 
 std::string EnvironmentVariableReader::getSetting(const char *settingName, const std::string &value) {
-    char *envValue;
+    const char *envValue;
     std::string keyValue;
     keyValue.assign(value);
 
-    envValue = IoFunctions::getenvPtr(settingName);
+    envValue = getEnvValue(settingName);
     if (envValue) {
         keyValue.assign(envValue);
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,6 +10,8 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/utilities/debug_settings_reader.h"
 
+#include <unordered_map>
+
 namespace NEO {
 
 class EnvironmentVariableReader : public SettingsReader {
@@ -19,5 +21,12 @@ class EnvironmentVariableReader : public SettingsReader {
     bool getSetting(const char *settingName, bool defaultValue) override;
     std::string getSetting(const char *settingName, const std::string &value) override;
     const char *appSpecificLocation(const std::string &name) override;
+    void prefetchSettings() override;
+
+  protected:
+    const char *getEnvValue(const char *settingName);
+
+    std::unordered_map<std::string, std::string> environmentSnapshot;
+    bool environmentSnapshotLoaded = false;
 };
 } // namespace NEO
@@ -21,6 +21,9 @@
 
 #include "hw_device_id.h"
 
+#include <algorithm>
+#include <thread>
+
 namespace NEO {
 
 bool DeviceFactory::prepareDeviceEnvironmentsForProductFamilyOverride(ExecutionEnvironment &executionEnvironment) {
@@ -146,14 +149,32 @@ bool DeviceFactory::prepareDeviceEnvironments(ExecutionEnvironment &executionEnv
 
     executionEnvironment.prepareRootDeviceEnvironments(static_cast<uint32_t>(hwDeviceIds.size()));
 
-    uint32_t rootDeviceIndex = 0u;
-
-    for (auto &hwDeviceId : hwDeviceIds) {
-        if (initHwDeviceIdResources(executionEnvironment, std::move(hwDeviceId), rootDeviceIndex) == false) {
+    if (DebugManager.flags.EnableParallelDeviceInitialization.get() == 1 && hwDeviceIds.size() > 1) {
+        // OS interface and GMM initialization of each root device is independent, devices are queried concurrently
+        std::vector<uint8_t> initResults(hwDeviceIds.size(), false);
+        std::vector<std::thread> workers;
+        workers.reserve(hwDeviceIds.size());
+        for (uint32_t rootDeviceIndex = 0u; rootDeviceIndex < hwDeviceIds.size(); rootDeviceIndex++) {
+            workers.emplace_back([&, rootDeviceIndex]() {
+                initResults[rootDeviceIndex] = initHwDeviceIdResources(executionEnvironment, std::move(hwDeviceIds[rootDeviceIndex]), rootDeviceIndex);
+            });
+        }
+        for (auto &worker : workers) {
+            worker.join();
+        }
+        if (std::find(initResults.begin(), initResults.end(), false) != initResults.end()) {
             return false;
         }
+    } else {
+        uint32_t rootDeviceIndex = 0u;
+
+        for (auto &hwDeviceId : hwDeviceIds) {
+            if (initHwDeviceIdResources(executionEnvironment, std::move(hwDeviceId), rootDeviceIndex) == false) {
+                return false;
+            }
 
-        rootDeviceIndex++;
+            rootDeviceIndex++;
+        }
     }
 
     executionEnvironment.sortNeoDevices();
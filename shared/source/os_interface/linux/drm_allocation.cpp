@@ -13,6 +13,7 @@
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/linux/ioctl_helper.h"
+#include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/os_context.h"
 
 #include <sstream>
@@ -96,6 +97,18 @@ bool DrmAllocation::setCacheAdvice(Drm *drm, size_t regionSize, CacheRegion regi
     return true;
 }
 
+bool DrmAllocation::canTrackBoundOsContexts() const {
+    if (this->fragmentsStorage.fragmentCount) {
+        return false;
+    }
+    for (auto bo : this->bufferObjects) {
+        if (bo && bo->peekIsReusableAllocation()) {
+            return false;
+        }
+    }
+    return true;
+}
+
 int DrmAllocation::makeBOsResident(OsContext *osContext, uint32_t vmHandleId, std::vector<BufferObject *> *bufferObjects, bool bind) {
     if (this->fragmentsStorage.fragmentCount) {
         for (unsigned int f = 0; f < this->fragmentsStorage.fragmentCount; f++) {
@@ -117,17 +130,34 @@ int DrmAllocation::makeBOsResident(OsContext *osContext, uint32_t vmHandleId, st
     return 0;
 }
 
+bool DrmAllocation::isBufferObjectAlreadyCollected(BufferObject *bo, OsContext *osContext, const std::vector<BufferObject *> &bufferObjects) {
+    constexpr uint32_t epochBits = 48u;
+    auto osContextLinux = static_cast<OsContextLinux *>(osContext);
+    auto stamp = (static_cast<uint64_t>(osContextLinux->getContextId()) << epochBits) | (osContextLinux->getResidencyEpoch() & maxNBitValue(epochBits));
+
+    auto previousStamp = bo->exchangeResidencyStamp(stamp);
+    if (previousStamp == stamp) {
+        return true;
+    }
+    if (previousStamp == 0u || (previousStamp >> epochBits) == (stamp >> epochBits)) {
+        return false;
+    }
+    // stamp was overwritten by collection in another os context, fall back to search
+    for (auto bufferObject : bufferObjects) {
+        if (bufferObject == bo) {
+            return true;
+        }
+    }
+    return false;
+}
+
 int DrmAllocation::bindBO(BufferObject *bo, OsContext *osContext, uint32_t vmHandleId, std::vector<BufferObject *> *bufferObjects, bool bind) {
     auto retVal = 0;
     if (bo) {
         bo->requireExplicitResidency(bo->peekDrm()->hasPageFaultSupport() && !shouldAllocationPageFault(bo->peekDrm()));
         if (bufferObjects) {
-            if (bo->peekIsReusableAllocation()) {
-                for (auto bufferObject : *bufferObjects) {
-                    if (bufferObject == bo) {
-                        return 0;
-                    }
-                }
+            if (bo->peekIsReusableAllocation() && isBufferObjectAlreadyCollected(bo, osContext, *bufferObjects)) {
+                return 0;
             }
 
             bufferObjects->push_back(bo);
@@ -136,6 +166,8 @@ int DrmAllocation::bindBO(BufferObject *bo, OsContext *osContext, uint32_t vmHan
             if (bind) {
                 retVal = bo->bind(osContext, vmHandleId);
             } else {
+                // VM may be shared between OS contexts, forget all contexts in which allocation was bound
+                boundInOsContexts.clear();
                 retVal = bo->unbind(osContext, vmHandleId);
             }
         }
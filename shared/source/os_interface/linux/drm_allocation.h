@@ -103,7 +103,19 @@ class DrmAllocation : public GraphicsAllocation {
     size_t getMmapSize() { return this->mmapSize; }
     void setMmapSize(size_t size) { this->mmapSize = size; }
 
+    bool isBoundInOsContext(uint32_t contextId) const {
+        return contextId < boundInOsContexts.size() && boundInOsContexts[contextId];
+    }
+    void markBoundInOsContext(uint32_t contextId) {
+        if (contextId >= boundInOsContexts.size()) {
+            boundInOsContexts.resize(contextId + 1, false);
+        }
+        boundInOsContexts[contextId] = true;
+    }
+    bool canTrackBoundOsContexts() const;
+
     MOCKABLE_VIRTUAL int makeBOsResident(OsContext *osContext, uint32_t vmHandleId, std::vector<BufferObject *> *bufferObjects, bool bind);
+    static bool isBufferObjectAlreadyCollected(BufferObject *bo, OsContext *osContext, const std::vector<BufferObject *> &bufferObjects);
     MOCKABLE_VIRTUAL int bindBO(BufferObject *bo, OsContext *osContext, uint32_t vmHandleId, std::vector<BufferObject *> *bufferObjects, bool bind);
     MOCKABLE_VIRTUAL int bindBOs(OsContext *osContext, uint32_t vmHandleId, std::vector<BufferObject *> *bufferObjects, bool bind);
     MOCKABLE_VIRTUAL void registerBOBindExtHandle(Drm *drm);
@@ -117,6 +129,7 @@ class DrmAllocation : public GraphicsAllocation {
     BufferObjects bufferObjects{};
     StackVec<uint32_t, 1> registeredBoBindHandles;
     MemAdviseFlags enabledMemAdviseFlags{};
+    std::vector<bool> boundInOsContexts;
     StackVec<MemoryToUnmap, 1> memoryToUnmap;
     uint32_t numHandles = 0u;
 
@@ -76,6 +76,7 @@ class BufferObject {
     uint64_t peekUnmapSize() const { return unmapSize; }
     bool peekIsReusableAllocation() const { return this->isReused; }
     void markAsReusableAllocation() { this->isReused = true; }
+    uint64_t exchangeResidencyStamp(uint64_t stamp) { return this->residencyStamp.exchange(stamp); }
     void addBindExtHandle(uint32_t handle);
     const StackVec<uint32_t, 2> &getBindExtHandles() const { return bindExtHandles; }
     void markForCapture() {
@@ -139,6 +140,19 @@ class BufferObject {
     uint64_t peekPatIndex() const { return patIndex; }
     void setPatIndex(uint64_t newPatIndex) { this->patIndex = newPatIndex; }
 
+    void setMmapOffset(uint64_t flags, uint64_t offset) {
+        this->mmapOffsetFlags = flags;
+        this->mmapOffset = offset;
+        this->mmapOffsetRetrieved = true;
+    }
+    bool peekMmapOffset(uint64_t flags, uint64_t &offset) const {
+        if (!mmapOffsetRetrieved || mmapOffsetFlags != flags) {
+            return false;
+        }
+        offset = mmapOffset;
+        return true;
+    }
+
     static constexpr int gpuHangDetected{-7171};
 
     uint32_t getOsContextId(OsContext *osContext);
@@ -155,6 +169,7 @@ class BufferObject {
     int handle; // i915 gem object handle
     uint64_t size;
     bool isReused = false;
+    std::atomic<uint64_t> residencyStamp{0u}; // os context id and residency epoch in which bo was last added to exec list
 
     uint32_t tilingMode;
     bool allowCapture = false;
@@ -168,6 +183,9 @@ class BufferObject {
 
     uint64_t unmapSize = 0;
     uint64_t patIndex = CommonConstants::unsupportedPatIndex;
+    uint64_t mmapOffset = 0;
+    uint64_t mmapOffsetFlags = 0;
+    bool mmapOffsetRetrieved = false;
 
     CacheRegion cacheRegion = CacheRegion::Default;
     CachePolicy cachePolicy = CachePolicy::WriteBack;
@@ -26,6 +26,7 @@
 #include "shared/source/os_interface/linux/drm_wrappers.h"
 #include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/utilities/latency_histograms.h"
 
 #include <cstdlib>
 #include <cstring>
@@ -92,6 +93,7 @@ inline DrmCommandStreamReceiver<GfxFamily>::~DrmCommandStreamReceiver() {
 
 template <typename GfxFamily>
 SubmissionStatus DrmCommandStreamReceiver<GfxFamily>::flush(BatchBuffer &batchBuffer, ResidencyContainer &allocationsForResidency) {
+    LATENCY_SCOPE("flush");
     this->printDeviceIndex();
     DrmAllocation *alloc = static_cast<DrmAllocation *>(batchBuffer.commandBufferAllocation);
     DEBUG_BREAK_IF(!alloc);
@@ -183,6 +185,7 @@ template <typename GfxFamily>
 void DrmCommandStreamReceiver<GfxFamily>::printBOsForSubmit(ResidencyContainer &allocationsForResidency, GraphicsAllocation &cmdBufferAllocation) {
     if (DebugManager.flags.PrintBOsForSubmit.get()) {
         std::vector<BufferObject *> bosForSubmit;
+        static_cast<OsContextLinux *>(osContext)->startNewResidencyEpoch();
         for (auto drmIterator = 0u; drmIterator < osContext->getDeviceBitfield().size(); drmIterator++) {
             if (osContext->getDeviceBitfield().test(drmIterator)) {
                 for (auto gfxAllocation = allocationsForResidency.begin(); gfxAllocation != allocationsForResidency.end(); gfxAllocation++) {
@@ -243,8 +246,10 @@ int DrmCommandStreamReceiver<GfxFamily>::exec(const BatchBuffer &batchBuffer, ui
 
 template <typename GfxFamily>
 bool DrmCommandStreamReceiver<GfxFamily>::processResidency(const ResidencyContainer &inputAllocationsForResidency, uint32_t handleId) {
+    LATENCY_SCOPE("residency");
     bool ret = 0;
     if ((!drm->isVmBindAvailable()) || (DebugManager.flags.PassBoundBOToExec.get() == 1)) {
+        static_cast<OsContextLinux *>(osContext)->startNewResidencyEpoch();
         for (auto &alloc : inputAllocationsForResidency) {
             auto drmAlloc = static_cast<DrmAllocation *>(alloc);
             ret = drmAlloc->makeBOsResident(osContext, handleId, &this->residency, false);
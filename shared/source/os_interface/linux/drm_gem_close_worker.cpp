@@ -7,12 +7,14 @@
 
 #include "shared/source/os_interface/linux/drm_gem_close_worker.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 #include "shared/source/os_interface/linux/drm_command_stream.h"
 #include "shared/source/os_interface/linux/drm_memory_manager.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include <algorithm>
 #include <atomic>
 #include <iostream>
 #include <queue>
@@ -20,17 +22,24 @@
 namespace NEO {
 
 DrmGemCloseWorker::DrmGemCloseWorker(DrmMemoryManager &memoryManager) : memoryManager(memoryManager) {
-    thread = Thread::create(worker, reinterpret_cast<void *>(this));
+    if (DebugManager.flags.GemCloseWorkerThreadCount.get() > 0) {
+        numThreads = static_cast<uint32_t>(DebugManager.flags.GemCloseWorkerThreadCount.get());
+    }
+    for (uint32_t i = 0; i < numThreads; i++) {
+        threads.push_back(Thread::create(worker, reinterpret_cast<void *>(this)));
+    }
 }
 
 void DrmGemCloseWorker::closeThread() {
-    if (thread) {
-        while (!workerDone.load()) {
+    if (!threads.empty()) {
+        while (numWorkersDone.load() < threads.size()) {
             condition.notify_all();
         }
 
-        thread->join();
-        thread.reset();
+        for (auto &thread : threads) {
+            thread->join();
+        }
+        threads.clear();
     }
 }
 
@@ -74,6 +83,19 @@ inline void DrmGemCloseWorker::processQueue(std::queue<BufferObject *> &inputQue
     }
 }
 
+void DrmGemCloseWorker::takeWorkItems(std::queue<BufferObject *> &localQueue) {
+    if (numThreads == 1u) {
+        localQueue.swap(queue);
+        return;
+    }
+    // share the backlog between all workers, each one takes its part in a single wake up
+    auto batchSize = std::max(static_cast<size_t>(1u), queue.size() / numThreads);
+    while (!queue.empty() && localQueue.size() < batchSize) {
+        localQueue.push(queue.front());
+        queue.pop();
+    }
+}
+
 void *DrmGemCloseWorker::worker(void *arg) {
     DrmGemCloseWorker *self = reinterpret_cast<DrmGemCloseWorker *>(arg);
     std::queue<BufferObject *> localQueue;
@@ -88,7 +110,7 @@ void *DrmGemCloseWorker::worker(void *arg) {
         }
 
         if (!self->queue.empty()) {
-            localQueue.swap(self->queue);
+            self->takeWorkItems(localQueue);
         }
 
         lock.unlock();
@@ -99,7 +121,7 @@ void *DrmGemCloseWorker::worker(void *arg) {
     self->processQueue(self->queue);
 
     lock.unlock();
-    self->workerDone.store(true);
+    self->numWorkersDone++;
     return nullptr;
 }
 } // namespace NEO
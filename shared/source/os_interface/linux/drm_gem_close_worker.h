@@ -13,6 +13,7 @@
 #include <mutex>
 #include <queue>
 #include <set>
+#include <vector>
 
 namespace NEO {
 class DrmMemoryManager;
@@ -36,15 +37,20 @@ class DrmGemCloseWorker {
     MOCKABLE_VIRTUAL void close(bool blocking);
 
     bool isEmpty();
+    uint32_t getQueueDepth() const { return workCount.load(); }
+    size_t getNumThreads() const { return threads.size(); }
 
   protected:
     void close(BufferObject *workItem);
     void closeThread();
     void processQueue(std::queue<BufferObject *> &inputQueue);
+    void takeWorkItems(std::queue<BufferObject *> &localQueue);
     static void *worker(void *arg);
     std::atomic<bool> active{true};
 
-    std::unique_ptr<Thread> thread;
+    std::vector<std::unique_ptr<Thread>> threads;
+    uint32_t numThreads = 1u;
+    std::atomic<uint32_t> numWorkersDone{0u};
 
     std::queue<BufferObject *> queue;
     std::atomic<uint32_t> workCount{0};
@@ -53,6 +59,5 @@ class DrmGemCloseWorker {
 
     std::mutex closeWorkerMutex;
     std::condition_variable condition;
-    std::atomic<bool> workerDone{false};
 };
 } // namespace NEO
@@ -33,8 +33,12 @@
 #include "shared/source/os_interface/linux/drm_neo.h"
 #include "shared/source/os_interface/linux/drm_wrappers.h"
 #include "shared/source/os_interface/linux/os_context_linux.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/os_interface/os_thread.h"
 
+#include <algorithm>
+#include <array>
 #include <cstring>
 #include <iostream>
 #include <memory>
@@ -127,6 +131,8 @@ void DrmMemoryManager::createDeviceSpecificMemResources(uint32_t rootDeviceIndex
 }
 
 DrmMemoryManager::~DrmMemoryManager() {
+    releaseUserptrPinningCache();
+    releasePrewarmedBufferObjects();
     for (auto &memoryForPinBB : memoryForPinBBs) {
         if (memoryForPinBB) {
             MemoryManager::alignedFreeWrapper(memoryForPinBB);
@@ -149,6 +155,9 @@ void DrmMemoryManager::releaseBufferObject(uint32_t rootDeviceIndex) {
 }
 
 void DrmMemoryManager::commonCleanup() {
+    releaseUserptrPinningCache();
+    releasePrewarmedBufferObjects();
+
     if (gemCloseWorker) {
         gemCloseWorker->close(true);
     }
@@ -311,6 +320,10 @@ DrmAllocation *DrmMemoryManager::allocateGraphicsMemoryWithAlignmentImpl(const A
     // When size == 0 allocate allocationAlignment
     // It's needed to prevent overlapping pages with user pointers
     size_t cSize = std::max(alignUp(allocationData.size, minAlignment), minAlignment);
+    if (is2MBPageAlignmentRequired(cSize)) {
+        cAlignment = std::max(cAlignment, MemoryConstants::pageSize2Mb);
+        cSize = alignUp(cSize, MemoryConstants::pageSize2Mb);
+    }
 
     uint64_t gpuReservationAddress = 0;
     uint64_t alignedGpuAddress = 0;
@@ -349,6 +362,12 @@ DrmAllocation *DrmMemoryManager::createAllocWithAlignmentFromUserptr(const Alloc
     if (!res) {
         return nullptr;
     }
+    if (is2MBPageAlignmentRequired(size) && isAligned(res, MemoryConstants::pageSize2Mb)) {
+        // best effort, without transparent huge pages memory stays backed by 4KB pages
+        [[maybe_unused]] auto ret = this->madviseFunction(res, size, MADV_HUGEPAGE);
+    }
+
+    bindToDeviceNumaNode(res, size, allocationData);
 
     std::unique_ptr<BufferObject, BufferObject::Deleter> bo(allocUserptr(reinterpret_cast<uintptr_t>(res), size, allocationData.rootDeviceIndex));
     if (!bo) {
@@ -375,6 +394,32 @@ DrmAllocation *DrmMemoryManager::createAllocWithAlignmentFromUserptr(const Alloc
     return allocation.release();
 }
 
+// System memory of driver allocations prefers NUMA node of the device, so it is not accessed by DMA across sockets.
+// Host USM is placed by application's memory policy unless NumaLocalSystemMemory forces binding of all allocations.
+void DrmMemoryManager::bindToDeviceNumaNode(void *ptr, size_t size, const AllocationData &allocationData) {
+    constexpr int mpolPreferred = 1;
+    constexpr unsigned int mpolMfMove = 1u << 1;
+    constexpr size_t maxNumaNodes = 1024u;
+    constexpr size_t bitsPerMaskEntry = sizeof(unsigned long) * 8;
+
+    auto numaLocalSystemMemory = DebugManager.flags.NumaLocalSystemMemory.get();
+    if (numaLocalSystemMemory == 0 || (allocationData.flags.isUSMHostAllocation && numaLocalSystemMemory != 1)) {
+        return;
+    }
+    if (!isAligned(ptr, MemoryConstants::pageSize)) {
+        return;
+    }
+    auto numaNode = getDrm(allocationData.rootDeviceIndex).getNumaNode();
+    if (numaNode < 0 || static_cast<size_t>(numaNode) >= maxNumaNodes) {
+        return;
+    }
+
+    std::array<unsigned long, maxNumaNodes / bitsPerMaskEntry> nodeMask = {};
+    nodeMask[numaNode / bitsPerMaskEntry] = 1ul << (numaNode % bitsPerMaskEntry);
+    // best effort, preferred policy falls back to other nodes when device's node is out of memory
+    [[maybe_unused]] auto ret = SysCalls::mbind(ptr, size, mpolPreferred, nodeMask.data(), maxNumaNodes + 1, mpolMfMove);
+}
+
 void DrmMemoryManager::obtainGpuAddress(const AllocationData &allocationData, BufferObject *bo, uint64_t gpuAddress) {
     if ((isLimitedRange(allocationData.rootDeviceIndex) || allocationData.type == AllocationType::SVM_CPU) &&
         !allocationData.flags.isUSMHostAllocation) {
@@ -449,6 +494,8 @@ GraphicsAllocation *DrmMemoryManager::allocateGraphicsMemoryWithGpuVa(const Allo
     if (!res)
         return nullptr;
 
+    bindToDeviceNumaNode(res, alignedSize, allocationData);
+
     std::unique_ptr<BufferObject, BufferObject::Deleter> bo(allocUserptr(reinterpret_cast<uintptr_t>(res), alignedSize, allocationData.rootDeviceIndex));
 
     if (!bo) {
@@ -997,8 +1044,12 @@ MemoryManager::AllocationStatus DrmMemoryManager::populateOsHandles(OsHandleStor
             handleStorage.fragmentStorageData[i].osHandleStorage = osHandle;
             handleStorage.fragmentStorageData[i].residency = new ResidencyData(maxOsContextCount);
 
-            osHandle->bo = allocUserptr((uintptr_t)handleStorage.fragmentStorageData[i].cpuPtr,
-                                        handleStorage.fragmentStorageData[i].fragmentSize, rootDeviceIndex);
+            osHandle->bo = takeCachedUserptr((uintptr_t)handleStorage.fragmentStorageData[i].cpuPtr,
+                                             handleStorage.fragmentStorageData[i].fragmentSize, rootDeviceIndex);
+            if (!osHandle->bo) {
+                osHandle->bo = allocUserptr((uintptr_t)handleStorage.fragmentStorageData[i].cpuPtr,
+                                            handleStorage.fragmentStorageData[i].fragmentSize, rootDeviceIndex);
+            }
             if (!osHandle->bo) {
                 handleStorage.fragmentStorageData[i].freeTheFragment = true;
                 return AllocationStatus::Error;
@@ -1016,6 +1067,12 @@ MemoryManager::AllocationStatus DrmMemoryManager::populateOsHandles(OsHandleStor
         if (result == EFAULT) {
             for (uint32_t i = 0; i < numberOfBosAllocated; i++) {
                 handleStorage.fragmentStorageData[indexesOfAllocatedBos[i]].freeTheFragment = true;
+                if (isUserptrPinningCacheEnabled()) {
+                    // Buffer objects of an invalid host range must not be kept for reuse
+                    auto osHandle = static_cast<OsHandleLinux *>(handleStorage.fragmentStorageData[indexesOfAllocatedBos[i]].osHandleStorage);
+                    unreference(osHandle->bo, true);
+                    osHandle->bo = nullptr;
+                }
             }
             return AllocationStatus::InvalidHostPointer;
         } else if (result != 0) {
@@ -1035,9 +1092,12 @@ void DrmMemoryManager::cleanOsHandles(OsHandleStorage &handleStorage, uint32_t r
             auto osHandle = static_cast<OsHandleLinux *>(handleStorage.fragmentStorageData[i].osHandleStorage);
             if (osHandle->bo) {
                 BufferObject *search = osHandle->bo;
-                search->wait(-1);
-                [[maybe_unused]] auto refCount = unreference(search, true);
-                DEBUG_BREAK_IF(refCount != 1u);
+                if (!storeCachedUserptr(search, (uintptr_t)handleStorage.fragmentStorageData[i].cpuPtr,
+                                        handleStorage.fragmentStorageData[i].fragmentSize, rootDeviceIndex)) {
+                    search->wait(-1);
+                    [[maybe_unused]] auto refCount = unreference(search, true);
+                    DEBUG_BREAK_IF(refCount != 1u);
+                }
             }
             delete handleStorage.fragmentStorageData[i].osHandleStorage;
             handleStorage.fragmentStorageData[i].osHandleStorage = nullptr;
@@ -1047,6 +1107,95 @@ void DrmMemoryManager::cleanOsHandles(OsHandleStorage &handleStorage, uint32_t r
     }
 }
 
+BufferObject *DrmMemoryManager::takeCachedUserptr(uintptr_t address, size_t size, uint32_t rootDeviceIndex) {
+    if (!isUserptrPinningCacheEnabled()) {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lock(userptrPinningCacheMutex);
+    auto cachedUserptr = userptrPinningCache.find({address, size, rootDeviceIndex});
+    if (cachedUserptr == userptrPinningCache.end()) {
+        return nullptr;
+    }
+    auto bo = cachedUserptr->second.bo;
+    userptrPinningCache.erase(cachedUserptr);
+    userptrPinningCacheSize -= size;
+    return bo;
+}
+
+bool DrmMemoryManager::storeCachedUserptr(BufferObject *bo, uintptr_t address, size_t size, uint32_t rootDeviceIndex) {
+    if (!isUserptrPinningCacheEnabled()) {
+        return false;
+    }
+    const size_t maxCacheSize = static_cast<size_t>(DebugManager.flags.UserptrPinningCacheSizeInMb.get()) * MemoryConstants::megaByte;
+    if (size > maxCacheSize) {
+        return false;
+    }
+
+    std::vector<BufferObject *> evictedBufferObjects;
+    {
+        std::lock_guard<std::mutex> lock(userptrPinningCacheMutex);
+        if (!userptrPinningCache.insert({{address, size, rootDeviceIndex}, {bo, ++userptrPinningCacheUseCounter}}).second) {
+            return false;
+        }
+        userptrPinningCacheSize += size;
+
+        while (userptrPinningCacheSize > maxCacheSize) {
+            auto leastRecentlyUsed = std::min_element(userptrPinningCache.begin(), userptrPinningCache.end(), [](const auto &lhs, const auto &rhs) {
+                return lhs.second.lastUsed < rhs.second.lastUsed;
+            });
+            evictedBufferObjects.push_back(leastRecentlyUsed->second.bo);
+            userptrPinningCacheSize -= std::get<size_t>(leastRecentlyUsed->first);
+            userptrPinningCache.erase(leastRecentlyUsed);
+        }
+    }
+    releaseCachedUserptrs(evictedBufferObjects);
+    return true;
+}
+
+void DrmMemoryManager::releaseCachedUserptrs(const std::vector<BufferObject *> &bufferObjects) {
+    for (auto bo : bufferObjects) {
+        bo->wait(-1);
+        [[maybe_unused]] auto refCount = unreference(bo, true);
+        DEBUG_BREAK_IF(refCount != 1u);
+    }
+}
+
+void DrmMemoryManager::releaseCachedHostPtrPinning(const void *ptr, size_t size) {
+    auto startAddress = reinterpret_cast<uintptr_t>(ptr);
+    auto endAddress = startAddress + size;
+
+    std::vector<BufferObject *> releasedBufferObjects;
+    {
+        std::lock_guard<std::mutex> lock(userptrPinningCacheMutex);
+        auto firstPastEnd = userptrPinningCache.lower_bound({endAddress, 0u, 0u});
+        for (auto it = userptrPinningCache.begin(); it != firstPastEnd;) {
+            auto &[address, rangeSize, rootDeviceIndex] = it->first;
+            if (address + rangeSize > startAddress) {
+                releasedBufferObjects.push_back(it->second.bo);
+                userptrPinningCacheSize -= rangeSize;
+                it = userptrPinningCache.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+    releaseCachedUserptrs(releasedBufferObjects);
+}
+
+void DrmMemoryManager::releaseUserptrPinningCache() {
+    std::vector<BufferObject *> releasedBufferObjects;
+    {
+        std::lock_guard<std::mutex> lock(userptrPinningCacheMutex);
+        for (auto &[key, cachedUserptr] : userptrPinningCache) {
+            releasedBufferObjects.push_back(cachedUserptr.bo);
+        }
+        userptrPinningCache.clear();
+        userptrPinningCacheSize = 0;
+    }
+    releaseCachedUserptrs(releasedBufferObjects);
+}
+
 bool DrmMemoryManager::setDomainCpu(GraphicsAllocation &graphicsAllocation, bool writeEnable) {
     DEBUG_BREAK_IF(writeEnable); // unsupported path (for CPU writes call SW_FINISH ioctl in unlockResource)
 
@@ -1139,6 +1288,27 @@ void DrmMemoryManager::freeGpuAddress(AddressRange addressRange, uint32_t rootDe
     releaseGpuRange(reinterpret_cast<void *>(addressRange.address), addressRange.size, rootDeviceIndex);
 }
 
+bool DrmMemoryManager::mapPhysicalToVirtualMemory(GraphicsAllocation *physicalAllocation, uint64_t gpuRange, size_t bufferSize) {
+    auto drmAllocation = static_cast<DrmAllocation *>(physicalAllocation);
+    if (bufferSize != physicalAllocation->getUnderlyingBufferSize() || drmAllocation->fragmentsStorage.fragmentCount != 0) {
+        return false;
+    }
+
+    // bindings at previous address are dropped, following residency binds pages at the new address
+    auto memoryOperationsInterface = static_cast<DrmMemoryOperationsHandler *>(executionEnvironment.rootDeviceEnvironments[physicalAllocation->getRootDeviceIndex()]->memoryOperationsInterface.get());
+    for (auto &engine : this->registeredEngines) {
+        memoryOperationsInterface->evictWithinOsContext(engine.osContext, *physicalAllocation);
+    }
+
+    auto currentGpuAddress = physicalAllocation->getGpuAddress();
+    for (auto bo : drmAllocation->getBOs()) {
+        if (bo != nullptr) {
+            bo->setAddress(gpuRange + (bo->peekAddress() - currentGpuAddress));
+        }
+    }
+    return MemoryManager::mapPhysicalToVirtualMemory(physicalAllocation, gpuRange, bufferSize);
+}
+
 std::unique_lock<std::mutex> DrmMemoryManager::acquireAllocLock() {
     return std::unique_lock<std::mutex>(this->allocMutex);
 }
@@ -1396,6 +1566,8 @@ GraphicsAllocation *DrmMemoryManager::allocateGraphicsMemoryInDevicePool(const A
     } else {
         if (allocationData.type == AllocationType::WRITE_COMBINED) {
             sizeAligned = alignUp(allocationData.size + MemoryConstants::pageSize64k, 2 * MemoryConstants::megaByte) + 2 * MemoryConstants::megaByte;
+        } else if (is2MBPageAlignmentRequired(allocationData.size)) {
+            sizeAligned = alignUp(allocationData.size, MemoryConstants::pageSize2Mb);
         } else {
             sizeAligned = alignUp(allocationData.size, MemoryConstants::pageSize64k);
         }
@@ -1493,32 +1665,159 @@ BufferObject *DrmMemoryManager::createBufferObjectInMemoryRegion(Drm *drm, Gmm *
         return nullptr;
     }
 
-    uint32_t handle = 0;
-    uint32_t ret = 0;
+    auto patIndex = drm->getPatIndex(gmm, allocationType, CacheRegion::Default, CachePolicy::WriteBack, false);
 
-    auto banks = std::bitset<4>(memoryBanks);
-    if (banks.count() > 1) {
-        ret = memoryInfo->createGemExtWithMultipleRegions(memoryBanks, size, handle);
-    } else {
-        ret = memoryInfo->createGemExtWithSingleRegion(memoryBanks, size, handle);
+    auto bo = takePrewarmedBufferObject({drm, patIndex, size, memoryBanks, maxOsContextCount});
+    if (!bo) {
+        std::vector<BufferObject *> bufferObjects;
+        if (!createBufferObjectsInMemoryRegion(drm, patIndex, size, memoryBanks, maxOsContextCount, 1u, false, bufferObjects)) {
+            return nullptr;
+        }
+        bo = bufferObjects[0];
     }
 
-    if (ret != 0) {
-        return nullptr;
+    bo->setAddress(gpuAddress);
+
+    return bo;
+}
+
+bool DrmMemoryManager::createBufferObjectsInMemoryRegion(Drm *drm, uint64_t patIndex, size_t size, uint32_t memoryBanks, size_t maxOsContextCount,
+                                                         uint32_t count, bool retrieveMmapOffsets, std::vector<BufferObject *> &bufferObjects) {
+    auto memoryInfo = drm->getMemoryInfo();
+    if (!memoryInfo) {
+        return false;
     }
 
-    auto patIndex = drm->getPatIndex(gmm, allocationType, CacheRegion::Default, CachePolicy::WriteBack, false);
+    auto rootDeviceIndex = retrieveMmapOffsets ? this->getRootDeviceIndex(drm) : 0u;
+    uint64_t mmapOffsetWc = retrieveMmapOffsets ? drm->getIoctlHelper()->getDrmParamValue(DrmParam::MmapOffsetWc) : 0u;
+    auto multipleRegions = std::bitset<4>(memoryBanks).count() > 1;
+    auto firstCreated = bufferObjects.size();
+    bufferObjects.reserve(firstCreated + count);
 
-    auto bo = new (std::nothrow) BufferObject(drm, patIndex, handle, size, maxOsContextCount);
-    if (!bo) {
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t handle = 0;
+        auto ret = multipleRegions ? memoryInfo->createGemExtWithMultipleRegions(memoryBanks, size, handle)
+                                   : memoryInfo->createGemExtWithSingleRegion(memoryBanks, size, handle);
+        BufferObject *bo = nullptr;
+        if (ret == 0) {
+            bo = new (std::nothrow) BufferObject(drm, patIndex, handle, size, maxOsContextCount);
+        }
+
+        if (!bo) {
+            for (auto it = bufferObjects.begin() + firstCreated; it != bufferObjects.end(); ++it) {
+                BufferObject::Deleter()(*it);
+            }
+            bufferObjects.resize(firstCreated);
+            return false;
+        }
+
+        // Offset is obtained upfront so that locking the BO later needs the mmap call only
+        uint64_t offset = 0;
+        if (retrieveMmapOffsets && retrieveMmapOffsetForBufferObject(rootDeviceIndex, *bo, mmapOffsetWc, offset)) {
+            bo->setMmapOffset(mmapOffsetWc, offset);
+        }
+        bufferObjects.push_back(bo);
+    }
+
+    return true;
+}
+
+BufferObject *DrmMemoryManager::takePrewarmedBufferObject(const PrewarmRequest &request) {
+    if (DebugManager.flags.PrewarmedBufferObjectsCount.get() <= 0 || request.size > maxPrewarmedBufferObjectSize) {
         return nullptr;
     }
+    const bool prewarmInBackground = DebugManager.flags.PrewarmBufferObjectsInBackground.get() == 1;
 
-    bo->setAddress(gpuAddress);
+    if (!prewarmInBackground) {
+        std::unique_lock<std::mutex> lock(prewarmMutex);
+        if (prewarmedBufferObjects[request.getKey()].empty()) {
+            lock.unlock();
+            prewarmBufferObjects(request);
+        }
+    }
 
+    std::unique_lock<std::mutex> lock(prewarmMutex);
+    auto &freeList = prewarmedBufferObjects[request.getKey()];
+    BufferObject *bo = nullptr;
+    if (!freeList.empty()) {
+        bo = freeList.back();
+        freeList.pop_back();
+    }
+    if (freeList.empty() && prewarmInBackground) {
+        requestPrewarm(request);
+    }
     return bo;
 }
 
+void DrmMemoryManager::requestPrewarm(const PrewarmRequest &request) {
+    if (stopPrewarmWorker) {
+        return;
+    }
+    auto isPending = std::any_of(prewarmRequests.begin(), prewarmRequests.end(), [&request](const PrewarmRequest &pendingRequest) {
+        return pendingRequest.getKey() == request.getKey();
+    });
+    if (isPending) {
+        return;
+    }
+    prewarmRequests.push_back(request);
+    if (!prewarmWorker) {
+        prewarmWorker = Thread::create(prewarmBufferObjectsInBackground, reinterpret_cast<void *>(this));
+    }
+    prewarmCondition.notify_one();
+}
+
+void DrmMemoryManager::prewarmBufferObjects(const PrewarmRequest &request) {
+    auto count = static_cast<uint32_t>(DebugManager.flags.PrewarmedBufferObjectsCount.get());
+    std::vector<BufferObject *> bufferObjects;
+    if (!createBufferObjectsInMemoryRegion(request.drm, request.patIndex, request.size, request.memoryBanks, request.maxOsContextCount,
+                                           count, true, bufferObjects)) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(prewarmMutex);
+    auto &freeList = prewarmedBufferObjects[request.getKey()];
+    freeList.insert(freeList.end(), bufferObjects.begin(), bufferObjects.end());
+}
+
+void *DrmMemoryManager::prewarmBufferObjectsInBackground(void *arg) {
+    auto self = reinterpret_cast<DrmMemoryManager *>(arg);
+    std::unique_lock<std::mutex> lock(self->prewarmMutex);
+    while (true) {
+        self->prewarmCondition.wait(lock, [self] { return self->stopPrewarmWorker || !self->prewarmRequests.empty(); });
+        if (self->stopPrewarmWorker) {
+            break;
+        }
+        // Request stays queued while being served, so that it is not requested again in the meantime
+        auto request = self->prewarmRequests.front();
+        lock.unlock();
+        self->prewarmBufferObjects(request);
+        lock.lock();
+        self->prewarmRequests.erase(self->prewarmRequests.begin());
+    }
+    return nullptr;
+}
+
+void DrmMemoryManager::releasePrewarmedBufferObjects() {
+    {
+        std::unique_lock<std::mutex> lock(prewarmMutex);
+        stopPrewarmWorker = true;
+    }
+    prewarmCondition.notify_one();
+    if (prewarmWorker) {
+        prewarmWorker->join();
+        prewarmWorker.reset();
+    }
+
+    std::unique_lock<std::mutex> lock(prewarmMutex);
+    for (auto &[key, freeList] : prewarmedBufferObjects) {
+        for (auto bo : freeList) {
+            BufferObject::Deleter()(bo);
+        }
+    }
+    prewarmedBufferObjects.clear();
+    prewarmRequests.clear();
+}
+
 bool DrmMemoryManager::createDrmAllocation(Drm *drm, DrmAllocation *allocation, uint64_t gpuAddress, size_t maxOsContextCount) {
     BufferObjects bos{};
     auto &storageInfo = allocation->storageInfo;
@@ -1595,6 +1894,10 @@ bool DrmMemoryManager::createDrmAllocation(Drm *drm, DrmAllocation *allocation,
 bool DrmMemoryManager::retrieveMmapOffsetForBufferObject(uint32_t rootDeviceIndex, BufferObject &bo, uint64_t flags, uint64_t &offset) {
     constexpr uint64_t mmapOffsetFixed = 4;
 
+    if (bo.peekMmapOffset(flags, offset)) {
+        return true;
+    }
+
     GemMmapOffset mmapOffset = {};
     mmapOffset.handle = bo.peekHandle();
     mmapOffset.flags = isLocalMemorySupported(rootDeviceIndex) ? mmapOffsetFixed : flags;
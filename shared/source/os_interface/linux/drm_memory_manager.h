@@ -6,11 +6,14 @@
  */
 
 #pragma once
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/memory_manager/memory_manager.h"
 
+#include <condition_variable>
 #include <limits>
 #include <map>
 #include <sys/mman.h>
+#include <tuple>
 #include <unistd.h>
 
 namespace NEO {
@@ -18,6 +21,7 @@ class BufferObject;
 class Drm;
 class DrmGemCloseWorker;
 class DrmAllocation;
+class Thread;
 
 enum class gemCloseWorkerMode;
 
@@ -49,6 +53,7 @@ class DrmMemoryManager : public MemoryManager {
     AllocationStatus populateOsHandles(OsHandleStorage &handleStorage, uint32_t rootDeviceIndex) override;
     void cleanOsHandles(OsHandleStorage &handleStorage, uint32_t rootDeviceIndex) override;
     void commonCleanup() override;
+    void releaseCachedHostPtrPinning(const void *ptr, size_t size) override;
 
     // drm/i915 ioctl wrappers
     MOCKABLE_VIRTUAL uint32_t unreference(BufferObject *bo, bool synchronousDestroy);
@@ -64,8 +69,11 @@ class DrmMemoryManager : public MemoryManager {
     MOCKABLE_VIRTUAL int obtainFdFromHandle(int boHandle, uint32_t rootDeviceindex);
     AddressRange reserveGpuAddress(size_t size, uint32_t rootDeviceIndex) override;
     void freeGpuAddress(AddressRange addressRange, uint32_t rootDeviceIndex) override;
+    bool mapPhysicalToVirtualMemory(GraphicsAllocation *physicalAllocation, uint64_t gpuRange, size_t bufferSize) override;
     MOCKABLE_VIRTUAL BufferObject *createBufferObjectInMemoryRegion(Drm *drm, Gmm *gmm, AllocationType allocationType, uint64_t gpuAddress, size_t size,
                                                                     uint32_t memoryBanks, size_t maxOsContextCount);
+    MOCKABLE_VIRTUAL bool createBufferObjectsInMemoryRegion(Drm *drm, uint64_t patIndex, size_t size, uint32_t memoryBanks, size_t maxOsContextCount,
+                                                            uint32_t count, bool retrieveMmapOffsets, std::vector<BufferObject *> &bufferObjects);
 
     bool isKmdMigrationAvailable(uint32_t rootDeviceIndex) override;
 
@@ -86,7 +94,38 @@ class DrmMemoryManager : public MemoryManager {
     void createDeviceSpecificMemResources(uint32_t rootDeviceIndex) override;
     bool allowIndirectAllocationsAsPack(uint32_t rootDeviceIndex) override;
 
+    static constexpr size_t maxPrewarmedBufferObjectSize = MemoryConstants::pageSize2Mb;
+
   protected:
+    struct PrewarmRequest {
+        Drm *drm = nullptr;
+        uint64_t patIndex = 0;
+        size_t size = 0;
+        uint32_t memoryBanks = 0;
+        size_t maxOsContextCount = 0;
+
+        auto getKey() const { return std::make_tuple(drm, patIndex, size, memoryBanks); }
+    };
+    using PrewarmedBufferObjectsKey = std::tuple<Drm *, uint64_t, size_t, uint32_t>;
+
+    struct CachedUserptr {
+        BufferObject *bo = nullptr;
+        uint64_t lastUsed = 0;
+    };
+    using CachedUserptrKey = std::tuple<uintptr_t, size_t, uint32_t>;
+
+    bool isUserptrPinningCacheEnabled() const { return DebugManager.flags.UserptrPinningCacheSizeInMb.get() > 0; }
+    BufferObject *takeCachedUserptr(uintptr_t address, size_t size, uint32_t rootDeviceIndex);
+    bool storeCachedUserptr(BufferObject *bo, uintptr_t address, size_t size, uint32_t rootDeviceIndex);
+    void releaseCachedUserptrs(const std::vector<BufferObject *> &bufferObjects);
+    void releaseUserptrPinningCache();
+
+    BufferObject *takePrewarmedBufferObject(const PrewarmRequest &request);
+    void requestPrewarm(const PrewarmRequest &request);
+    void prewarmBufferObjects(const PrewarmRequest &request);
+    void releasePrewarmedBufferObjects();
+    static void *prewarmBufferObjectsInBackground(void *arg);
+
     MOCKABLE_VIRTUAL BufferObject *findAndReferenceSharedBufferObject(int boHandle, uint32_t rootDeviceIndex);
     void eraseSharedBufferObject(BufferObject *bo);
     void pushSharedBufferObject(BufferObject *bo);
@@ -95,6 +134,7 @@ class DrmMemoryManager : public MemoryManager {
     uint64_t acquireGpuRange(size_t &size, uint32_t rootDeviceIndex, HeapIndex heapIndex);
     MOCKABLE_VIRTUAL void releaseGpuRange(void *address, size_t size, uint32_t rootDeviceIndex);
     void emitPinningRequest(BufferObject *bo, const AllocationData &allocationData) const;
+    void bindToDeviceNumaNode(void *ptr, size_t size, const AllocationData &allocationData);
     uint32_t getDefaultDrmContextId(uint32_t rootDeviceIndex) const;
     size_t getUserptrAlignment();
 
@@ -141,6 +181,7 @@ class DrmMemoryManager : public MemoryManager {
     std::unique_ptr<DrmGemCloseWorker> gemCloseWorker;
     decltype(&mmap) mmapFunction = mmap;
     decltype(&munmap) munmapFunction = munmap;
+    decltype(&madvise) madviseFunction = madvise;
     decltype(&lseek) lseekFunction = lseek;
     decltype(&close) closeFunction = close;
     std::vector<BufferObject *> sharingBufferObjects;
@@ -149,5 +190,18 @@ class DrmMemoryManager : public MemoryManager {
     std::vector<std::vector<GraphicsAllocation *>> localMemAllocs;
     std::vector<GraphicsAllocation *> sysMemAllocs;
     std::mutex allocMutex;
+
+    // Pinned host ranges ordered by start address, so that ranges overlapping an invalidated one are found without a full scan
+    std::map<CachedUserptrKey, CachedUserptr> userptrPinningCache;
+    size_t userptrPinningCacheSize = 0;
+    uint64_t userptrPinningCacheUseCounter = 0;
+    std::mutex userptrPinningCacheMutex;
+
+    std::map<PrewarmedBufferObjectsKey, std::vector<BufferObject *>> prewarmedBufferObjects;
+    std::vector<PrewarmRequest> prewarmRequests;
+    std::unique_ptr<Thread> prewarmWorker;
+    std::mutex prewarmMutex;
+    std::condition_variable prewarmCondition;
+    bool stopPrewarmWorker = false;
 };
 } // namespace NEO
@@ -17,6 +17,8 @@
 #include "shared/source/os_interface/linux/os_context_linux.h"
 #include "shared/source/os_interface/os_interface.h"
 
+#include <algorithm>
+
 namespace NEO {
 
 DrmMemoryOperationsHandlerBind::DrmMemoryOperationsHandlerBind(const RootDeviceEnvironment &rootDeviceEnvironment, uint32_t rootDeviceIndex)
@@ -37,29 +39,39 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResident(Device *devi
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::makeResidentWithinOsContext(OsContext *osContext, ArrayRef<GraphicsAllocation *> gfxAllocations, bool evictable) {
     auto deviceBitfield = osContext->getDeviceBitfield();
 
+    auto contextId = osContext->getContextId();
+
     std::lock_guard<std::mutex> lock(mutex);
-    auto devicesDone = 0u;
-    for (auto drmIterator = 0u; devicesDone < deviceBitfield.count(); drmIterator++) {
-        if (!deviceBitfield.test(drmIterator)) {
-            continue;
-        }
-        devicesDone++;
+    for (auto gfxAllocation = gfxAllocations.begin(); gfxAllocation != gfxAllocations.end(); gfxAllocation++) {
+        auto drmAllocation = static_cast<DrmAllocation *>(*gfxAllocation);
+
+        // only allocations added or unbound since last residency request go through bind path
+        if (!drmAllocation->isBoundInOsContext(contextId)) {
+            auto devicesDone = 0u;
+            for (auto drmIterator = 0u; devicesDone < deviceBitfield.count(); drmIterator++) {
+                if (!deviceBitfield.test(drmIterator)) {
+                    continue;
+                }
+                devicesDone++;
 
-        for (auto gfxAllocation = gfxAllocations.begin(); gfxAllocation != gfxAllocations.end(); gfxAllocation++) {
-            auto drmAllocation = static_cast<DrmAllocation *>(*gfxAllocation);
-            auto bo = drmAllocation->storageInfo.getNumBanks() > 1 ? drmAllocation->getBOs()[drmIterator] : drmAllocation->getBO();
+                auto bo = drmAllocation->storageInfo.getNumBanks() > 1 ? drmAllocation->getBOs()[drmIterator] : drmAllocation->getBO();
 
-            if (!bo->bindInfo[bo->getOsContextId(osContext)][drmIterator]) {
-                int result = drmAllocation->makeBOsResident(osContext, drmIterator, nullptr, true);
-                if (result) {
-                    return MemoryOperationsStatus::OUT_OF_MEMORY;
+                if (!bo->bindInfo[bo->getOsContextId(osContext)][drmIterator]) {
+                    int result = drmAllocation->makeBOsResident(osContext, drmIterator, nullptr, true);
+                    if (result) {
+                        return MemoryOperationsStatus::OUT_OF_MEMORY;
+                    }
                 }
             }
 
-            if (!evictable) {
-                drmAllocation->updateResidencyTaskCount(GraphicsAllocation::objectAlwaysResident, osContext->getContextId());
+            if (drmAllocation->canTrackBoundOsContexts()) {
+                drmAllocation->markBoundInOsContext(contextId);
             }
         }
+
+        if (!evictable) {
+            drmAllocation->updateResidencyTaskCount(GraphicsAllocation::objectAlwaysResident, contextId);
+        }
     }
 
     return MemoryOperationsStatus::SUCCESS;
@@ -160,11 +172,16 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocations(bo
 
 MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocationsImpl(std::vector<GraphicsAllocation *> &allocationsForEviction, bool waitForCompletion) {
     const auto &engines = this->rootDeviceEnvironment.executionEnvironment.memoryManager->getRegisteredEngines();
-    std::vector<GraphicsAllocation *> evictCandidates;
+    std::vector<std::pair<uint32_t, GraphicsAllocation *>> evictCandidates;
+
+    // retry without waiting evicts least recently used allocations first and stops once budget is released,
+    // allocations of the working set stay bound and next submission does not have to bind them again
+    int64_t evictionBudget = waitForCompletion ? -1 : DebugManager.flags.EvictUnusedAllocationsBudget.get();
 
     for (auto subdeviceIndex = 0u; subdeviceIndex < HwHelper::getSubDevicesCount(rootDeviceEnvironment.getHardwareInfo()); subdeviceIndex++) {
         for (auto &allocation : allocationsForEviction) {
             bool evict = true;
+            uint32_t lastUsedTaskCount = 0u;
 
             for (const auto &engine : engines) {
                 if (this->rootDeviceIndex == engine.commandStreamReceiver->getRootDeviceIndex() &&
@@ -181,19 +198,32 @@ MemoryOperationsStatus DrmMemoryOperationsHandlerBind::evictUnusedAllocationsImp
                         }
                     }
 
-                    if (allocation->isUsedByOsContext(engine.osContext->getContextId()) &&
-                        allocation->getTaskCount(engine.osContext->getContextId()) > *engine.commandStreamReceiver->getTagAddress()) {
-                        evict = false;
-                        break;
+                    if (allocation->isUsedByOsContext(engine.osContext->getContextId())) {
+                        auto taskCount = allocation->getTaskCount(engine.osContext->getContextId());
+                        if (taskCount > *engine.commandStreamReceiver->getTagAddress()) {
+                            evict = false;
+                            break;
+                        }
+                        lastUsedTaskCount = std::max(lastUsedTaskCount, taskCount);
                     }
                 }
             }
             if (evict) {
-                evictCandidates.push_back(allocation);
+                evictCandidates.emplace_back(lastUsedTaskCount, allocation);
             }
         }
 
-        for (auto &allocationToEvict : evictCandidates) {
+        if (evictionBudget > 0) {
+            std::stable_sort(evictCandidates.begin(), evictCandidates.end(), [](const auto &lhs, const auto &rhs) { return lhs.first < rhs.first; });
+        }
+
+        int64_t evictedBytes = 0;
+        for (auto &evictCandidate : evictCandidates) {
+            if (evictionBudget > 0 && evictedBytes >= evictionBudget) {
+                break;
+            }
+            auto allocationToEvict = evictCandidate.second;
+            evictedBytes += static_cast<int64_t>(allocationToEvict->getUnderlyingBufferSize());
             for (const auto &engine : engines) {
                 if (this->rootDeviceIndex == engine.commandStreamReceiver->getRootDeviceIndex() &&
                     engine.osContext->getDeviceBitfield().test(subdeviceIndex)) {
@@ -38,6 +38,7 @@
 #include "shared/source/utilities/directory.h"
 
 #include <cstdio>
+#include <cstdlib>
 #include <cstring>
 #include <linux/limits.h>
 #include <map>
@@ -198,6 +199,17 @@ bool Drm::readSysFsAsString(const std::string &relativeFilePath, std::string &re
     return true;
 }
 
+// -1 is returned when device is not attached to any NUMA node, as reported by sysfs
+int Drm::getNumaNode() {
+    std::call_once(queryNumaNodeOnce, [this]() {
+        std::string numaNodeString(16, '\0');
+        if (readSysFsAsString("/device/numa_node", numaNodeString)) {
+            numaNode = std::atoi(numaNodeString.c_str());
+        }
+    });
+    return numaNode;
+}
+
 int Drm::queryGttSize(uint64_t &gttSizeOutput) {
     GemContextParam contextParam = {0};
     contextParam.param = ioctlHelper->getDrmParamValue(DrmParam::ContextParamGttSize);
@@ -251,6 +263,18 @@ void Drm::setLowPriorityContextParam(uint32_t drmContextId) {
     UNRECOVERABLE_IF(retVal != 0);
 }
 
+// Raising priority above default requires CAP_SYS_NICE, without it context keeps default priority
+bool Drm::setHighPriorityContextParam(uint32_t drmContextId) {
+    GemContextParam gcp = {};
+    gcp.contextId = drmContextId;
+    gcp.param = ioctlHelper->getDrmParamValue(DrmParam::ContextParamPriority);
+    gcp.value = 1023;
+
+    auto retVal = ioctlHelper->ioctl(DrmIoctl::GemContextSetparam, &gcp);
+    PRINT_DEBUG_STRING(DebugManager.flags.PrintDebugMessages.get() && retVal != 0, stderr, "Failed to set high priority of drm context %u\n", drmContextId);
+    return retVal == 0;
+}
+
 int Drm::getQueueSliceCount(GemContextParamSseu *sseu) {
     GemContextParam contextParam = {};
     contextParam.param = ioctlHelper->getDrmParamValue(DrmParam::ContextParamSseu);
@@ -406,6 +430,7 @@ int Drm::setupHardwareInfo(const DeviceDescriptor *device, bool setupFeatureTabl
 
     const auto productFamily = hwInfo->platform.eProductFamily;
     setupIoctlHelper(productFamily);
+    queryCache = DrmQueryCache::create(hwDeviceId->getPciPath());
 
     Drm::QueryTopologyData topologyData = {};
 
@@ -556,7 +581,28 @@ std::string Drm::getDrmVersion(int fileDescriptor) {
     return std::string(name);
 }
 
+bool Drm::isQueryCacheable(uint32_t queryId) const {
+    // memory regions report current free sizes, they are always queried
+    return queryId == static_cast<uint32_t>(ioctlHelper->getDrmParamValue(DrmParam::QueryEngineInfo)) ||
+           queryId == static_cast<uint32_t>(ioctlHelper->getDrmParamValue(DrmParam::QueryHwconfigTable)) ||
+           queryId == static_cast<uint32_t>(ioctlHelper->getDrmParamValue(DrmParam::QueryComputeSlices)) ||
+           queryId == static_cast<uint32_t>(ioctlHelper->getDrmParamValue(DrmParam::QueryTopologyInfo));
+}
+
+void Drm::persistQueryCache() {
+    if (queryCache) {
+        queryCache->persist();
+    }
+}
+
 std::vector<uint8_t> Drm::query(uint32_t queryId, uint32_t queryItemFlags) {
+    const bool cacheable = queryCache && isQueryCacheable(queryId);
+    if (cacheable) {
+        if (auto cachedData = queryCache->find(queryId, queryItemFlags)) {
+            return *cachedData;
+        }
+    }
+
     Query query{};
     QueryItem queryItem{};
     queryItem.queryId = queryId;
@@ -577,6 +623,9 @@ std::vector<uint8_t> Drm::query(uint32_t queryId, uint32_t queryItemFlags) {
     if (ret != 0 || queryItem.length <= 0) {
         return {};
     }
+    if (cacheable) {
+        queryCache->store(queryId, queryItemFlags, data);
+    }
     return data;
 }
 
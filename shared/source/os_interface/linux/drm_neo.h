@@ -14,6 +14,7 @@
 #include "shared/source/os_interface/driver_info.h"
 #include "shared/source/os_interface/linux/cache_info.h"
 #include "shared/source/os_interface/linux/drm_debug.h"
+#include "shared/source/os_interface/linux/drm_query_cache.h"
 #include "shared/source/os_interface/linux/engine_info.h"
 #include "shared/source/os_interface/linux/hw_device_id.h"
 #include "shared/source/os_interface/linux/memory_info.h"
@@ -111,6 +112,7 @@ class Drm : public DriverModel {
     void destroyDrmContext(uint32_t drmContextId);
     int queryVmId(uint32_t drmContextId, uint32_t &vmId);
     void setLowPriorityContextParam(uint32_t drmContextId);
+    bool setHighPriorityContextParam(uint32_t drmContextId);
 
     unsigned int bindDrmContext(uint32_t drmContextId, uint32_t deviceIndex, aub_stream::EngineType engineType, bool engineInstancedDevice);
 
@@ -162,6 +164,7 @@ class Drm : public DriverModel {
     MOCKABLE_VIRTUAL bool registerResourceClasses();
 
     MOCKABLE_VIRTUAL void queryPageFaultSupport();
+    void persistQueryCache();
     MOCKABLE_VIRTUAL bool hasPageFaultSupport() const;
 
     MOCKABLE_VIRTUAL uint32_t registerResource(DrmResourceClass classType, const void *data, size_t size);
@@ -207,6 +210,7 @@ class Drm : public DriverModel {
     std::string getPciPath() {
         return hwDeviceId->getPciPath();
     }
+    int getNumaNode();
 
     void waitForBind(uint32_t vmHandleId);
     uint64_t getNextFenceVal(uint32_t vmHandleId) { return ++fenceVal[vmHandleId]; }
@@ -263,6 +267,7 @@ class Drm : public DriverModel {
     std::string generateElfUUID(const void *data);
     std::string getSysFsPciPath();
     std::vector<uint8_t> query(uint32_t queryId, uint32_t queryItemFlags);
+    bool isQueryCacheable(uint32_t queryId) const;
     void printIoctlStatistics();
     void setupIoctlHelper(const PRODUCT_FAMILY productFamily);
     void queryAndSetVmBindPatIndexProgrammingSupport();
@@ -302,6 +307,7 @@ class Drm : public DriverModel {
     GemContextParamSseu sseu{};
     ADAPTER_BDF adapterBDF{};
     uint32_t pciDomain = 0;
+    int numaNode = -1;
 
     TopologyMap topologyMap;
     struct IoctlStatisticsEntry {
@@ -324,8 +330,10 @@ class Drm : public DriverModel {
     std::unique_ptr<CacheInfo> cacheInfo;
     std::unique_ptr<EngineInfo> engineInfo;
     std::unique_ptr<MemoryInfo> memoryInfo;
+    std::unique_ptr<DrmQueryCache> queryCache;
 
     std::once_flag checkBindOnce;
+    std::once_flag queryNumaNodeOnce;
     std::once_flag checkCompletionFenceOnce;
 
     RootDeviceEnvironment &rootDeviceEnvironment;
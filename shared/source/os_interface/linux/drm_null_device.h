@@ -6,6 +6,7 @@
  */
 
 #pragma once
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/register_offsets.h"
 #include "shared/source/os_interface/linux/device_time_drm.h"
 #include "shared/source/os_interface/linux/drm_neo.h"
@@ -13,12 +14,29 @@
 
 namespace NEO {
 
+// Executes all ioctls except device queries at zero cost, submissions are considered completed
+// immediately. Buffer objects get unique handles, so driver side bookkeeping works as on real device.
+// Simulated ioctls are counted in ioctl statistics, which allows to profile CPU overhead of the driver.
 class DrmNullDevice : public Drm {
 
   public:
     int ioctl(DrmIoctl request, void *arg) override {
         if (request == DrmIoctl::Getparam || request == DrmIoctl::Query) {
             return Drm::ioctl(request, arg);
+        }
+
+        if (DebugManager.flags.PrintIoctlTimes.get()) {
+            auto &ioctlData = this->ioctlStatistics[request];
+            ioctlData.count++;
+            ioctlData.minTime = 0;
+        }
+
+        if (request == DrmIoctl::GemCreate) {
+            static_cast<GemCreate *>(arg)->handle = ++lastBufferObjectHandle;
+            return 0;
+        } else if (request == DrmIoctl::GemUserptr) {
+            static_cast<GemUserPtr *>(arg)->handle = ++lastBufferObjectHandle;
+            return 0;
         } else if (request == DrmIoctl::RegRead) {
             auto *regArg = static_cast<RegisterRead *>(arg);
             // Handle only 36b timestamp
@@ -39,5 +57,6 @@ class DrmNullDevice : public Drm {
 
   protected:
     uint64_t gpuTimestamp = 0;
+    uint32_t lastBufferObjectHandle = 0;
 };
 } // namespace NEO
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/drm_query_cache.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/helpers/neo_driver_version.h"
+
+#include <cstring>
+#include <fstream>
+#include <sys/utsname.h>
+
+namespace NEO {
+
+namespace {
+template <typename T>
+bool readValue(const char *&ptr, const char *end, T &value) {
+    if (static_cast<size_t>(end - ptr) < sizeof(T)) {
+        return false;
+    }
+    memcpy(&value, ptr, sizeof(T));
+    ptr += sizeof(T);
+    return true;
+}
+
+template <typename T>
+void writeValue(std::vector<char> &data, const T &value) {
+    auto bytes = reinterpret_cast<const char *>(&value);
+    data.insert(data.end(), bytes, bytes + sizeof(T));
+}
+} // namespace
+
+std::unique_ptr<DrmQueryCache> DrmQueryCache::create(const std::string &pciPath) {
+    std::string cacheDir = DebugManager.flags.DrmQueryCacheDir.get();
+    if (cacheDir == "unk" || pciPath.empty()) {
+        return nullptr;
+    }
+    auto cache = std::make_unique<DrmQueryCache>(cacheDir + "/" + pciPath + ".drmquerycache", getCacheKey());
+    cache->load();
+    return cache;
+}
+
+DrmQueryCache::DrmQueryCache(const std::string &cacheFilePath, const std::string &cacheKey)
+    : cacheFilePath(cacheFilePath), cacheKey(cacheKey) {}
+
+std::string DrmQueryCache::getCacheKey() {
+    std::string key = driverVersion;
+
+    utsname kernelName{};
+    if (uname(&kernelName) == 0) {
+        key += ";";
+        key += kernelName.release;
+    }
+
+    // procfs files have no size, boot id is read as a line
+    std::ifstream bootIdFile("/proc/sys/kernel/random/boot_id");
+    std::string bootId;
+    if (std::getline(bootIdFile, bootId)) {
+        key += ";";
+        key += bootId;
+    }
+    return key;
+}
+
+const std::vector<uint8_t> *DrmQueryCache::find(uint32_t queryId, uint32_t queryItemFlags) const {
+    auto entry = entries.find({queryId, queryItemFlags});
+    return entry != entries.end() ? &entry->second : nullptr;
+}
+
+void DrmQueryCache::store(uint32_t queryId, uint32_t queryItemFlags, const std::vector<uint8_t> &data) {
+    entries[{queryId, queryItemFlags}] = data;
+    dirty = true;
+}
+
+// File layout: key size, key, entries count, then query id, query flags, data size and data of each entry
+void DrmQueryCache::load() {
+    size_t fileSize = 0u;
+    auto fileData = loadDataFromFile(cacheFilePath.c_str(), fileSize);
+    if (!fileData) {
+        return;
+    }
+    const char *ptr = fileData.get();
+    const char *end = ptr + fileSize;
+
+    uint32_t keySize = 0u;
+    if (!readValue(ptr, end, keySize) || keySize != cacheKey.size() || static_cast<size_t>(end - ptr) < keySize ||
+        memcmp(ptr, cacheKey.data(), keySize) != 0) {
+        return;
+    }
+    ptr += keySize;
+
+    decltype(entries) loadedEntries;
+    uint32_t entriesCount = 0u;
+    if (!readValue(ptr, end, entriesCount)) {
+        return;
+    }
+    for (uint32_t i = 0; i < entriesCount; i++) {
+        uint32_t queryId = 0u;
+        uint32_t queryItemFlags = 0u;
+        uint32_t dataSize = 0u;
+        if (!readValue(ptr, end, queryId) || !readValue(ptr, end, queryItemFlags) || !readValue(ptr, end, dataSize) ||
+            static_cast<size_t>(end - ptr) < dataSize) {
+            return;
+        }
+        loadedEntries[{queryId, queryItemFlags}].assign(ptr, ptr + dataSize);
+        ptr += dataSize;
+    }
+    entries = std::move(loadedEntries);
+}
+
+void DrmQueryCache::persist() {
+    if (!dirty) {
+        return;
+    }
+    std::vector<char> data;
+    writeValue(data, static_cast<uint32_t>(cacheKey.size()));
+    data.insert(data.end(), cacheKey.begin(), cacheKey.end());
+    writeValue(data, static_cast<uint32_t>(entries.size()));
+    for (auto &entry : entries) {
+        writeValue(data, entry.first.first);
+        writeValue(data, entry.first.second);
+        writeValue(data, static_cast<uint32_t>(entry.second.size()));
+        data.insert(data.end(), entry.second.begin(), entry.second.end());
+    }
+    writeDataToFile(cacheFilePath.c_str(), data.data(), data.size());
+    dirty = false;
+}
+
+} // namespace NEO
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace NEO {
+
+// Persists results of static DRM queries between process starts. Cache file is valid only for
+// the same device, boot, kernel and driver build, otherwise queries are issued to the kernel again.
+class DrmQueryCache : NonCopyableOrMovableClass {
+  public:
+    static std::unique_ptr<DrmQueryCache> create(const std::string &pciPath);
+
+    DrmQueryCache(const std::string &cacheFilePath, const std::string &cacheKey);
+    MOCKABLE_VIRTUAL ~DrmQueryCache() = default;
+
+    const std::vector<uint8_t> *find(uint32_t queryId, uint32_t queryItemFlags) const;
+    void store(uint32_t queryId, uint32_t queryItemFlags, const std::vector<uint8_t> &data);
+    void persist();
+
+    static std::string getCacheKey();
+
+  protected:
+    void load();
+
+    const std::string cacheFilePath;
+    const std::string cacheKey;
+    std::map<std::pair<uint32_t, uint32_t>, std::vector<uint8_t>> entries;
+    bool dirty = false;
+};
+
+} // namespace NEO
@@ -102,6 +102,9 @@ uint32_t IoctlHelper::createDrmContext(Drm &drm, OsContextLinux &osContext, uint
     if (drm.isPreemptionSupported() && osContext.isLowPriority()) {
         drm.setLowPriorityContextParam(drmContextId);
     }
+    if (osContext.isHighPriority()) {
+        drm.setHighPriorityContextParam(drmContextId);
+    }
     auto engineFlag = drm.bindDrmContext(drmContextId, deviceIndex, osContext.getEngineType(), osContext.isEngineInstanced());
     osContext.setEngineFlag(engineFlag);
     return drmContextId;
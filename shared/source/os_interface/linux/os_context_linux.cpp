@@ -81,7 +81,22 @@ void OsContextLinux::waitForPagingFence() {
     }
 }
 
-void OsContextLinux::reInitializeContext() {}
+// Drm contexts are recreated on virtual memory address spaces already in use, bindings of existing allocations stay valid
+void OsContextLinux::reInitializeContext() {
+    if (!contextInitialized) {
+        return;
+    }
+    auto contextIndex = 0u;
+    for (auto deviceIndex = 0u; deviceIndex < deviceBitfield.size(); deviceIndex++) {
+        if (deviceBitfield.test(deviceIndex)) {
+            auto drmVmId = drm.isPerContextVMRequired() ? drmVmIds[deviceIndex] : drm.getVirtualMemoryAddressSpace(deviceIndex);
+            auto drmContextId = drm.getIoctlHelper()->createDrmContext(drm, *this, drmVmId, deviceIndex);
+
+            drm.destroyDrmContext(drmContextIds[contextIndex]);
+            drmContextIds[contextIndex++] = drmContextId;
+        }
+    }
+}
 
 OsContextLinux::~OsContextLinux() {
     if (contextInitialized) {
@@ -38,6 +38,9 @@ class OsContextLinux : public OsContext {
     bool isTlbFlushRequired() const {
         return (tlbFlushCounter.load() > lastFlushedTlbFlushCounter.load());
     };
+    uint64_t getResidencyEpoch() const { return residencyEpoch; }
+    void startNewResidencyEpoch() { residencyEpoch++; }
+
     bool isDirectSubmissionSupported(const HardwareInfo &hwInfo) const override;
     Drm &getDrm() const;
     void waitForPagingFence();
@@ -50,6 +53,7 @@ class OsContextLinux : public OsContext {
     std::atomic<uint32_t> tlbFlushCounter{0};
     std::atomic<uint32_t> lastFlushedTlbFlushCounter{0};
     unsigned int engineFlag = 0;
+    uint64_t residencyEpoch = 1u;
     std::vector<uint32_t> drmContextIds;
     std::vector<uint32_t> drmVmIds;
     Drm &drm;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,7 +14,24 @@ ThreadLinux::ThreadLinux(pthread_t threadId) : threadId(threadId){};
 
 std::unique_ptr<Thread> Thread::create(void *(*func)(void *), void *arg) {
     pthread_t threadId;
-    pthread_create(&threadId, nullptr, func, arg);
+    pthread_attr_t attributes;
+    pthread_attr_init(&attributes);
+
+    // without explicit cpu list threads inherit affinity of application thread creating them
+    auto cpus = Thread::getDriverThreadsCpus();
+    if (!cpus.empty()) {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        for (auto cpu : cpus) {
+            if (cpu < CPU_SETSIZE) {
+                CPU_SET(cpu, &cpuSet);
+            }
+        }
+        pthread_attr_setaffinity_np(&attributes, sizeof(cpuSet), &cpuSet);
+    }
+
+    pthread_create(&threadId, &attributes, func, arg);
+    pthread_attr_destroy(&attributes);
     return std::unique_ptr<Thread>(new ThreadLinux(threadId));
 }
 
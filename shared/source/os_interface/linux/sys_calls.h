@@ -29,5 +29,6 @@ ssize_t pwrite(int fd, const void *buf, size_t count, off_t offset);
 void *mmap(void *addr, size_t size, int prot, int flags, int fd, off_t off);
 int munmap(void *addr, size_t size);
 ssize_t read(int fd, void *buf, size_t count);
+long mbind(void *addr, unsigned long len, int mode, const unsigned long *nodemask, unsigned long maxnode, unsigned int flags);
 } // namespace SysCalls
 } // namespace NEO
@@ -14,6 +14,7 @@
 #include <stdio.h>
 #include <sys/ioctl.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
 #include <sys/sysmacros.h>
 #include <unistd.h>
 
@@ -87,5 +88,9 @@ ssize_t read(int fd, void *buf, size_t count) {
     return ::read(fd, buf, count);
 }
 
+long mbind(void *addr, unsigned long len, int mode, const unsigned long *nodemask, unsigned long maxnode, unsigned int flags) {
+    return ::syscall(SYS_mbind, addr, len, mode, nodemask, maxnode, flags);
+}
+
 } // namespace SysCalls
 } // namespace NEO
@@ -38,6 +38,7 @@ class OsContext : public ReferenceTrackedObject<OsContext> {
     EngineUsage getEngineUsage() { return engineUsage; }
     bool isRegular() const { return engineUsage == EngineUsage::Regular; }
     bool isLowPriority() const { return engineUsage == EngineUsage::LowPriority; }
+    bool isHighPriority() const { return engineUsage == EngineUsage::HighPriority; }
     bool isInternalEngine() const { return engineUsage == EngineUsage::Internal; }
     bool isCooperativeEngine() const { return engineUsage == EngineUsage::Cooperative; }
     bool isRootDevice() const { return rootDevice; }
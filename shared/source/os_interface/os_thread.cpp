@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/os_thread.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include <sstream>
+
+namespace NEO {
+
+// Parses list in "0-3,8,10-11" format, as in cpuset or sysfs local_cpulist, empty list is returned on invalid input
+std::vector<uint32_t> Thread::parseCpuList(const std::string &cpuList) {
+    std::vector<uint32_t> cpus;
+    std::istringstream stream(cpuList);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        auto separator = range.find('-');
+        auto firstString = range.substr(0, separator);
+        auto lastString = (separator != std::string::npos) ? range.substr(separator + 1) : firstString;
+        try {
+            size_t firstLength = 0;
+            size_t lastLength = 0;
+            auto first = std::stoul(firstString, &firstLength);
+            auto last = std::stoul(lastString, &lastLength);
+            if (firstLength != firstString.size() || lastLength != lastString.size() || last < first) {
+                return {};
+            }
+            for (auto cpu = first; cpu <= last; cpu++) {
+                cpus.push_back(static_cast<uint32_t>(cpu));
+            }
+        } catch (...) {
+            return {};
+        }
+    }
+    return cpus;
+}
+
+std::vector<uint32_t> Thread::getDriverThreadsCpus() {
+    auto cpuList = DebugManager.flags.DriverThreadsCpuList.get();
+    if (cpuList == "unk") {
+        return {};
+    }
+    return parseCpuList(cpuList);
+}
+
+} // namespace NEO
@@ -1,17 +1,22 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <vector>
 namespace NEO {
 
 class Thread {
   public:
     static std::unique_ptr<Thread> create(void *(*func)(void *), void *arg);
+    static std::vector<uint32_t> parseCpuList(const std::string &cpuList);
+    static std::vector<uint32_t> getDriverThreadsCpus();
     virtual void join() = 0;
     virtual ~Thread() = default;
     virtual void yield() = 0;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,11 +7,72 @@
 
 #include "shared/source/os_interface/os_time.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/hw_info.h"
 
+#include <cmath>
+
 namespace NEO {
 
 double OSTime::getDeviceTimerResolution(HardwareInfo const &hwInfo) {
     return hwInfo.capabilityTable.defaultProfilingTimerResolution;
 };
+
+bool OSTime::getCpuGpuTime(TimeStampData *gpuCpuTime) {
+    auto calibrationIntervalMs = DebugManager.flags.CpuGpuTimeCalibrationIntervalMs.get();
+    if (calibrationIntervalMs <= 0) {
+        return deviceTime->getCpuGpuTime(gpuCpuTime, this);
+    }
+
+    uint64_t maxErrorNs = 1000u;
+    if (DebugManager.flags.CpuGpuTimeCalibrationMaxErrorNs.get() != -1) {
+        maxErrorNs = static_cast<uint64_t>(DebugManager.flags.CpuGpuTimeCalibrationMaxErrorNs.get());
+    }
+
+    std::lock_guard<std::mutex> lock(calibrationMutex);
+    if (getCpuGpuTimeFromModel(gpuCpuTime, static_cast<uint64_t>(calibrationIntervalMs) * 1000000u)) {
+        return true;
+    }
+    if (!deviceTime->getCpuGpuTime(gpuCpuTime, this)) {
+        return false;
+    }
+    updateCpuGpuTimeModel(*gpuCpuTime, maxErrorNs);
+    return true;
+}
+
+bool OSTime::getCpuGpuTimeFromModel(TimeStampData *gpuCpuTime, uint64_t calibrationIntervalNs) {
+    if (!calibration.modelValid) {
+        return false;
+    }
+    uint64_t cpuTime = 0;
+    if (!getCpuTime(&cpuTime) || cpuTime < calibration.lastSample.CPUTimeinNS ||
+        cpuTime - calibration.lastSample.CPUTimeinNS >= calibrationIntervalNs) {
+        return false;
+    }
+    auto elapsedNs = cpuTime - calibration.lastSample.CPUTimeinNS;
+    gpuCpuTime->CPUTimeinNS = cpuTime;
+    gpuCpuTime->GPUTimeStamp = calibration.lastSample.GPUTimeStamp + static_cast<uint64_t>(std::llround(elapsedNs * calibration.gpuTicksPerNs));
+    return true;
+}
+
+void OSTime::updateCpuGpuTimeModel(const TimeStampData &sample, uint64_t maxErrorNs) {
+    auto &previous = calibration.lastSample;
+    bool monotonic = calibration.hasSample && sample.CPUTimeinNS > previous.CPUTimeinNS && sample.GPUTimeStamp >= previous.GPUTimeStamp;
+
+    if (!monotonic) {
+        // first sample or GPU counter was reset, wait for next sample to fit the model
+        calibration.modelValid = false;
+    } else {
+        auto elapsedNs = sample.CPUTimeinNS - previous.CPUTimeinNS;
+        if (calibration.gpuTicksPerNs > 0.0) {
+            auto predictedGpuTime = static_cast<double>(previous.GPUTimeStamp) + elapsedNs * calibration.gpuTicksPerNs;
+            auto errorTicks = std::abs(predictedGpuTime - static_cast<double>(sample.GPUTimeStamp));
+            calibration.errorNs = static_cast<uint64_t>(std::llround(errorTicks / calibration.gpuTicksPerNs));
+        }
+        calibration.gpuTicksPerNs = static_cast<double>(sample.GPUTimeStamp - previous.GPUTimeStamp) / elapsedNs;
+        calibration.modelValid = calibration.gpuTicksPerNs > 0.0 && calibration.errorNs <= maxErrorNs;
+    }
+    calibration.lastSample = sample;
+    calibration.hasSample = true;
+}
 } // namespace NEO
@@ -1,12 +1,14 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include <cstdint>
 #include <memory>
+#include <mutex>
 
 #define NSEC_PER_SEC (1000000000ULL)
 
@@ -43,9 +45,8 @@ class OSTime {
     }
 
     static double getDeviceTimerResolution(HardwareInfo const &hwInfo);
-    bool getCpuGpuTime(TimeStampData *gpuCpuTime) {
-        return deviceTime->getCpuGpuTime(gpuCpuTime, this);
-    }
+    bool getCpuGpuTime(TimeStampData *gpuCpuTime);
+    uint64_t getCpuGpuTimeModelErrorNs() const { return calibration.errorNs; }
 
     double getDynamicDeviceTimerResolution(HardwareInfo const &hwInfo) const {
         return deviceTime->getDynamicDeviceTimerResolution(hwInfo);
@@ -56,8 +57,24 @@ class OSTime {
     }
 
   protected:
+    // Offset and drift model fitted from the last two sampled CPU-GPU pairs. Between samples
+    // GPU time is extrapolated from CPU time, the model is used only when the error measured
+    // against the latest sample is within the allowed bound.
+    struct CpuGpuTimeCalibration {
+        TimeStampData lastSample{};
+        double gpuTicksPerNs = 0.0;
+        uint64_t errorNs = 0;
+        bool hasSample = false;
+        bool modelValid = false;
+    };
+
     OSTime() {}
+    bool getCpuGpuTimeFromModel(TimeStampData *gpuCpuTime, uint64_t calibrationIntervalNs);
+    void updateCpuGpuTimeModel(const TimeStampData &sample, uint64_t maxErrorNs);
+
     OSInterface *osInterface = nullptr;
     std::unique_ptr<DeviceTime> deviceTime;
+    CpuGpuTimeCalibration calibration;
+    std::mutex calibrationMutex;
 };
 } // namespace NEO
@@ -1,18 +1,34 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/os_interface/windows/os_thread_win.h"
+
+#include "shared/source/os_interface/windows/windows_wrapper.h"
+
 namespace NEO {
 ThreadWin::ThreadWin(std::thread *thread) {
     this->thread.reset(thread);
 };
 
 std::unique_ptr<Thread> Thread::create(void *(*func)(void *), void *arg) {
-    return std::unique_ptr<Thread>(new ThreadWin(new std::thread(func, arg)));
+    auto thread = new std::thread(func, arg);
+
+    auto cpus = Thread::getDriverThreadsCpus();
+    if (!cpus.empty()) {
+        DWORD_PTR affinityMask = 0;
+        for (auto cpu : cpus) {
+            if (cpu < sizeof(affinityMask) * 8) {
+                affinityMask |= static_cast<DWORD_PTR>(1) << cpu;
+            }
+        }
+        SetThreadAffinityMask(thread->native_handle(), affinityMask);
+    }
+
+    return std::unique_ptr<Thread>(new ThreadWin(thread));
 }
 
 void ThreadWin::join() {
@@ -108,64 +108,79 @@ void WddmResidencyController::trimResidency(const D3DDDI_TRIMRESIDENCYSET_FLAGS
 }
 
 bool WddmResidencyController::trimResidencyToBudget(uint64_t bytes) {
-    D3DKMT_HANDLE fragmentEvictHandles[maxFragmentsCount] = {0};
     uint64_t numberOfBytesToTrim = bytes;
-    WddmAllocation *wddmAllocation = nullptr;
-
-    while (numberOfBytesToTrim > 0 && (wddmAllocation = this->getTrimCandidateHead()) != nullptr) {
-        uint64_t lastFence = wddmAllocation->getResidencyData().getFenceValueForContextId(osContextId);
-        auto &monitoredFence = this->getMonitoredFence();
 
-        if (lastFence > monitoredFence.lastSubmittedFence) {
-            break;
+    if (DebugManager.flags.TrimResidencyByLastUsedFence.get() == 1) {
+        for (auto wddmAllocation : getTrimCandidatesByLastUsedFence()) {
+            if (numberOfBytesToTrim == 0 || !trimAllocationToBudget(wddmAllocation, numberOfBytesToTrim)) {
+                break;
+            }
         }
+    } else {
+        WddmAllocation *wddmAllocation = nullptr;
+        while (numberOfBytesToTrim > 0 && (wddmAllocation = this->getTrimCandidateHead()) != nullptr) {
+            if (!trimAllocationToBudget(wddmAllocation, numberOfBytesToTrim)) {
+                break;
+            }
+        }
+    }
 
-        uint32_t fragmentsToEvict = 0;
-        uint64_t sizeEvicted = 0;
-        uint64_t sizeToTrim = 0;
+    if (bytes > numberOfBytesToTrim && this->checkTrimCandidateListCompaction()) {
+        this->compactTrimCandidateList();
+    }
 
-        if (lastFence > *monitoredFence.cpuAddress) {
-            this->wddm.waitFromCpu(lastFence, this->getMonitoredFence());
-        }
+    return numberOfBytesToTrim == 0;
+}
 
-        if (wddmAllocation->fragmentsStorage.fragmentCount == 0) {
-            this->wddm.evict(&wddmAllocation->getHandles()[0], wddmAllocation->getNumGmms(), sizeToTrim, true);
-            sizeEvicted = wddmAllocation->getAlignedSize();
-        } else {
-            auto &fragmentStorageData = wddmAllocation->fragmentsStorage.fragmentStorageData;
-            for (uint32_t allocationId = 0; allocationId < wddmAllocation->fragmentsStorage.fragmentCount; allocationId++) {
-                if (fragmentStorageData[allocationId].residency->getFenceValueForContextId(osContextId) <= monitoredFence.lastSubmittedFence) {
-                    fragmentEvictHandles[fragmentsToEvict++] = static_cast<OsHandleWin *>(fragmentStorageData[allocationId].osHandleStorage)->handle;
-                }
-            }
+bool WddmResidencyController::trimAllocationToBudget(WddmAllocation *wddmAllocation, uint64_t &numberOfBytesToTrim) {
+    D3DKMT_HANDLE fragmentEvictHandles[maxFragmentsCount] = {0};
+    uint64_t lastFence = wddmAllocation->getResidencyData().getFenceValueForContextId(osContextId);
+    auto &monitoredFence = this->getMonitoredFence();
 
-            if (fragmentsToEvict != 0) {
-                this->wddm.evict((D3DKMT_HANDLE *)fragmentEvictHandles, fragmentsToEvict, sizeToTrim, true);
+    if (lastFence > monitoredFence.lastSubmittedFence) {
+        return false;
+    }
 
-                for (uint32_t allocationId = 0; allocationId < wddmAllocation->fragmentsStorage.fragmentCount; allocationId++) {
-                    if (fragmentStorageData[allocationId].residency->getFenceValueForContextId(osContextId) <= monitoredFence.lastSubmittedFence) {
-                        fragmentStorageData[allocationId].residency->resident[osContextId] = false;
-                        sizeEvicted += fragmentStorageData[allocationId].fragmentSize;
-                    }
-                }
+    uint32_t fragmentsToEvict = 0;
+    uint64_t sizeEvicted = 0;
+    uint64_t sizeToTrim = 0;
+
+    if (lastFence > *monitoredFence.cpuAddress) {
+        this->wddm.waitFromCpu(lastFence, this->getMonitoredFence());
+    }
+
+    if (wddmAllocation->fragmentsStorage.fragmentCount == 0) {
+        this->wddm.evict(&wddmAllocation->getHandles()[0], wddmAllocation->getNumGmms(), sizeToTrim, true);
+        sizeEvicted = wddmAllocation->getAlignedSize();
+    } else {
+        auto &fragmentStorageData = wddmAllocation->fragmentsStorage.fragmentStorageData;
+        for (uint32_t allocationId = 0; allocationId < wddmAllocation->fragmentsStorage.fragmentCount; allocationId++) {
+            if (fragmentStorageData[allocationId].residency->getFenceValueForContextId(osContextId) <= monitoredFence.lastSubmittedFence) {
+                fragmentEvictHandles[fragmentsToEvict++] = static_cast<OsHandleWin *>(fragmentStorageData[allocationId].osHandleStorage)->handle;
             }
         }
 
-        if (sizeEvicted >= numberOfBytesToTrim) {
-            numberOfBytesToTrim = 0;
-        } else {
-            numberOfBytesToTrim -= sizeEvicted;
-        }
+        if (fragmentsToEvict != 0) {
+            this->wddm.evict((D3DKMT_HANDLE *)fragmentEvictHandles, fragmentsToEvict, sizeToTrim, true);
 
-        wddmAllocation->getResidencyData().resident[osContextId] = false;
-        this->removeFromTrimCandidateList(wddmAllocation, false);
+            for (uint32_t allocationId = 0; allocationId < wddmAllocation->fragmentsStorage.fragmentCount; allocationId++) {
+                if (fragmentStorageData[allocationId].residency->getFenceValueForContextId(osContextId) <= monitoredFence.lastSubmittedFence) {
+                    fragmentStorageData[allocationId].residency->resident[osContextId] = false;
+                    sizeEvicted += fragmentStorageData[allocationId].fragmentSize;
+                }
+            }
+        }
     }
 
-    if (bytes > numberOfBytesToTrim && this->checkTrimCandidateListCompaction()) {
-        this->compactTrimCandidateList();
+    if (sizeEvicted >= numberOfBytesToTrim) {
+        numberOfBytesToTrim = 0;
+    } else {
+        numberOfBytesToTrim -= sizeEvicted;
     }
 
-    return numberOfBytesToTrim == 0;
+    wddmAllocation->getResidencyData().resident[osContextId] = false;
+    this->removeFromTrimCandidateList(wddmAllocation, false);
+    return true;
 }
 
 } // namespace NEO
\ No newline at end of file
@@ -40,10 +40,13 @@
 #include "shared/source/os_interface/windows/wddm_memory_manager.h"
 #include "shared/source/os_interface/windows/wddm_residency_allocations_container.h"
 #include "shared/source/sku_info/operations/windows/sku_info_receiver.h"
+#include "shared/source/utilities/cpuintrinsics.h"
 #include "shared/source/utilities/stackvec.h"
 
 #include "gmm_memory.h"
 
+#include <chrono>
+
 namespace NEO {
 extern Wddm::CreateDXGIFactoryFcn getCreateDxgiFactory();
 extern Wddm::DXCoreCreateAdapterFactoryFcn getDXCoreCreateAdapterFactory();
@@ -977,7 +980,7 @@ bool Wddm::destroyContext(D3DKMT_HANDLE context) {
 
 bool Wddm::submit(uint64_t commandBuffer, size_t size, void *commandHeader, WddmSubmitArguments &submitArguments) {
     bool status = false;
-    if (currentPagingFenceValue > *pagingFenceAddress && !waitOnGPU(submitArguments.contextHandle)) {
+    if (currentPagingFenceValue > *pagingFenceAddress && !pollPagingFence() && !waitOnGPU(submitArguments.contextHandle)) {
         return false;
     }
     DBG_LOG(ResidencyDebugEnable, "Residency:", __FUNCTION__, "currentFenceValue =", submitArguments.monitorFence->currentFenceValue);
@@ -1016,6 +1019,27 @@ unsigned int Wddm::getEnablePreemptionRegValue() {
     return enablePreemptionRegValue;
 }
 
+// Every thunk is a round-trip to the host when calls are marshalled (GPU-PV), paging that
+// completes within the spin time doesn't need a wait submitted to the GPU
+bool Wddm::pollPagingFence() {
+    int64_t spinTime = hwDeviceId->getUmKmDataTranslator()->enabled() ? defaultPagingFenceSpinTime : 0;
+    if (DebugManager.flags.WddmPagingFenceSpinTime.get() != -1) {
+        spinTime = DebugManager.flags.WddmPagingFenceSpinTime.get();
+    }
+    if (spinTime <= 0) {
+        return false;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    while (currentPagingFenceValue > *reinterpret_cast<volatile uint64_t *>(pagingFenceAddress)) {
+        if (std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count() >= spinTime) {
+            return false;
+        }
+        CpuIntrinsics::pause();
+    }
+    return true;
+}
+
 bool Wddm::waitOnGPU(D3DKMT_HANDLE context) {
     D3DKMT_WAITFORSYNCHRONIZATIONOBJECTFROMGPU waitOnGpu = {};
 
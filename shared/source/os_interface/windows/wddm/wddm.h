@@ -63,6 +63,7 @@ class Wddm : public DriverModel {
   public:
     static constexpr DriverModelType driverModelType = DriverModelType::WDDM;
     static constexpr std::uint64_t gpuHangIndication{std::numeric_limits<std::uint64_t>::max()};
+    static constexpr int64_t defaultPagingFenceSpinTime = 20;
 
     typedef HRESULT(WINAPI *CreateDXGIFactoryFcn)(REFIID riid, void **ppFactory);
     typedef HRESULT(WINAPI *DXCoreCreateAdapterFactoryFcn)(REFIID riid, void **ppFactory);
@@ -221,6 +222,7 @@ class Wddm : public DriverModel {
 
     Wddm(std::unique_ptr<HwDeviceIdWddm> &&hwDeviceId, RootDeviceEnvironment &rootDeviceEnvironment);
     MOCKABLE_VIRTUAL bool waitOnGPU(D3DKMT_HANDLE context);
+    bool pollPagingFence();
     bool createDevice(PreemptionMode preemptionMode);
     bool createPagingQueue();
     bool destroyPagingQueue();
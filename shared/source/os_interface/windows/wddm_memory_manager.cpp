@@ -58,7 +58,8 @@ WddmMemoryManager::WddmMemoryManager(ExecutionEnvironment &executionEnvironment)
     alignmentSelector.addCandidateAlignment(MemoryConstants::pageSize64k, true, AlignmentSelector::anyWastage);
     if (DebugManager.flags.AlignLocalMemoryVaTo2MB.get() != 0) {
         constexpr static float maxWastage2Mb = 0.1f;
-        alignmentSelector.addCandidateAlignment(MemoryConstants::pageSize2Mb, false, maxWastage2Mb);
+        const auto enforce2MBPages = DebugManager.flags.Enable2MBPagesForLargeAllocations.get() == 1;
+        alignmentSelector.addCandidateAlignment(MemoryConstants::pageSize2Mb, false, enforce2MBPages ? AlignmentSelector::anyWastage : maxWastage2Mb);
     }
     const size_t customAlignment = static_cast<size_t>(DebugManager.flags.ExperimentalEnableCustomLocalMemoryAlignment.get());
     if (customAlignment > 0) {
@@ -569,10 +570,8 @@ void WddmMemoryManager::freeGraphicsMemoryImpl(GraphicsAllocation *gfxAllocation
             [[maybe_unused]] auto status = tryDeferDeletions(nullptr, 0, input->resourceHandle, gfxAllocation->getRootDeviceIndex());
             DEBUG_BREAK_IF(!status);
         } else {
-            for (auto handle : input->getHandles()) {
-                [[maybe_unused]] auto status = tryDeferDeletions(&handle, 1, 0, gfxAllocation->getRootDeviceIndex());
-                DEBUG_BREAK_IF(!status);
-            }
+            [[maybe_unused]] auto status = tryDeferDeletions(&input->getHandles()[0], static_cast<uint32_t>(input->getHandles().size()), 0, gfxAllocation->getRootDeviceIndex());
+            DEBUG_BREAK_IF(!status);
         }
 
         alignedFreeWrapper(input->getDriverAllocatedCpuPtr());
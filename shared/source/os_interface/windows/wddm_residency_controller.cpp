@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,8 +11,11 @@
 #include "shared/source/os_interface/windows/wddm/wddm.h"
 #include "shared/source/os_interface/windows/wddm_allocation.h"
 #include "shared/source/os_interface/windows/wddm_residency_allocations_container.h"
+#include "shared/source/utilities/performance_hints_log.h"
 #include "shared/source/utilities/spinlock.h"
 
+#include <algorithm>
+
 namespace NEO {
 
 WddmResidencyController::WddmResidencyController(Wddm &wddm, uint32_t osContextId) : wddm(wddm), osContextId(osContextId) {
@@ -165,6 +168,21 @@ void WddmResidencyController::compactTrimCandidateList() {
     checkTrimCandidateCount();
 }
 
+std::vector<WddmAllocation *> WddmResidencyController::getTrimCandidatesByLastUsedFence() const {
+    std::vector<WddmAllocation *> trimCandidates;
+    trimCandidates.reserve(trimCandidatesCount);
+    for (auto trimCandidate : trimCandidateList) {
+        if (trimCandidate != nullptr) {
+            trimCandidates.push_back(static_cast<WddmAllocation *>(trimCandidate));
+        }
+    }
+    // least recently used first, allocations that need no wait for GPU precede those still in use
+    std::stable_sort(trimCandidates.begin(), trimCandidates.end(), [this](WddmAllocation *left, WddmAllocation *right) {
+        return left->getResidencyData().getFenceValueForContextId(osContextId) < right->getResidencyData().getFenceValueForContextId(osContextId);
+    });
+    return trimCandidates;
+}
+
 void WddmResidencyController::resetMonitoredFenceParams(D3DKMT_HANDLE &handle, uint64_t *cpuAddress, D3DGPU_VIRTUAL_ADDRESS &gpuAddress) {
     monitoredFence.lastSubmittedFence = 0;
     monitoredFence.currentFenceValue = 1;
@@ -196,10 +214,13 @@ bool WddmResidencyController::makeResidentResidencyAllocations(const ResidencyCo
 
         const auto fragmentCount = allocation->fragmentsStorage.fragmentCount;
         UNRECOVERABLE_IF(fragmentCount > maxFragments);
-        if (allocation->getTrimCandidateListPosition(this->osContextId) != trimListUnusedPosition) {
+        const bool isTrimCandidate = allocation->getTrimCandidateListPosition(this->osContextId) != trimListUnusedPosition;
+        if (isTrimCandidate) {
             DBG_LOG(ResidencyDebugEnable, "Residency:", __FUNCTION__, "allocation =", allocation, "on trimCandidateList");
             this->removeFromTrimCandidateList(allocation, false);
-        } else {
+        }
+        // fragments of trim candidates keep valid residency state, trimming marks evicted ones as not resident
+        if (!isTrimCandidate || DebugManager.flags.SkipMakeResidentForResidentTrimCandidateFragments.get() == 1) {
             for (uint32_t allocationId = 0; allocationId < fragmentCount; allocationId++) {
                 fragmentResidency[allocationId] = allocation->fragmentsStorage.fragmentStorageData[allocationId].residency->resident[osContextId];
                 DBG_LOG(ResidencyDebugEnable, "Residency:", __FUNCTION__, "fragment handle =",
@@ -228,6 +249,7 @@ bool WddmResidencyController::makeResidentResidencyAllocations(const ResidencyCo
         uint64_t bytesToTrim = 0;
         while ((result = wddm.makeResident(&handlesForResidency[0], totalHandlesCount, false, &bytesToTrim, totalSize)) == false) {
             this->setMemoryBudgetExhausted();
+            PERFORMANCE_HINT(PerformanceHintId::ResidencyOverflow, bytesToTrim, totalHandlesCount);
             const bool trimmingDone = this->trimResidencyToBudget(bytesToTrim);
             if (!trimmingDone) {
                 auto evictionStatus = wddm.getTemporaryResourcesContainer()->evictAllResources();
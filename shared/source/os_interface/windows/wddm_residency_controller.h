@@ -14,6 +14,7 @@
 
 #include <atomic>
 #include <mutex>
+#include <vector>
 
 struct _D3DKMT_TRIMNOTIFICATION;
 typedef _D3DKMT_TRIMNOTIFICATION D3DKMT_TRIMNOTIFICATION;
@@ -43,6 +44,7 @@ class WddmResidencyController {
 
     MOCKABLE_VIRTUAL bool checkTrimCandidateListCompaction();
     void compactTrimCandidateList();
+    std::vector<WddmAllocation *> getTrimCandidatesByLastUsedFence() const;
 
     bool wasAllocationUsedSinceLastTrim(uint64_t fenceValue) { return fenceValue > lastTrimFenceValue; }
     void updateLastTrimFenceValue() { lastTrimFenceValue = *this->getMonitoredFence().cpuAddress; }
@@ -66,6 +68,8 @@ class WddmResidencyController {
     bool isInitialized() const;
 
   protected:
+    bool trimAllocationToBudget(WddmAllocation *wddmAllocation, uint64_t &numberOfBytesToTrim);
+
     MonitoredFence monitoredFence = {};
 
     ResidencyContainer trimCandidateList;
@@ -8,6 +8,8 @@
 #include "shared/source/page_fault_manager/cpu_page_fault_manager.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/helpers/memory_properties_helpers.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/utilities/spinlock.h"
@@ -19,8 +21,14 @@ void PageFaultManager::insertAllocation(void *ptr, size_t size, SVMAllocsManager
     auto initialPlacement = MemoryPropertiesHelper::getUSMInitialPlacement(memoryProperties);
     const auto domain = (initialPlacement == GraphicsAllocation::UsmInitialPlacement::CPU) ? AllocationDomain::Cpu : AllocationDomain::None;
 
+    PageFaultData pageFaultData{size, unifiedMemoryManager, cmdQ, domain};
+    pageFaultData.chunkSize = getMigrationChunkSize(size);
+    if (pageFaultData.chunkSize != 0u) {
+        pageFaultData.cpuChunks.assign(Math::divideAndRoundUp(size, pageFaultData.chunkSize), domain == AllocationDomain::Cpu);
+    }
+
     std::unique_lock<SpinLock> lock{mtx};
-    this->memoryData.insert(std::make_pair(ptr, PageFaultData{size, unifiedMemoryManager, cmdQ, domain}));
+    this->memoryData.insert(std::make_pair(ptr, std::move(pageFaultData)));
     if (initialPlacement != GraphicsAllocation::UsmInitialPlacement::CPU) {
         this->protectCPUMemoryAccess(ptr, size);
     }
@@ -35,6 +43,9 @@ void PageFaultManager::removeAllocation(void *ptr) {
         if (pageFaultData.domain == AllocationDomain::Gpu) {
             allowCPUMemoryAccess(ptr, pageFaultData.size);
         } else {
+            if (pageFaultData.chunkSize != 0u && pageFaultData.domain == AllocationDomain::Cpu) {
+                allowCPUMemoryAccess(ptr, pageFaultData.size);
+            }
             auto &cpuAllocs = pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs;
             if (auto it = std::find(cpuAllocs.begin(), cpuAllocs.end(), ptr); it != cpuAllocs.end()) {
                 cpuAllocs.erase(it);
@@ -61,6 +72,13 @@ void PageFaultManager::moveAllocationToGpuDomain(void *ptr) {
 }
 
 void PageFaultManager::moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocsManager *unifiedMemoryManager) {
+    if (DebugManager.flags.RegisterPageFaultHandlerOnMigration.get() == 1) {
+        // runtimes loaded after driver may install own handler, faults on protected allocations must reach ours
+        if (!this->checkFaultHandlerFromPageFaultManager()) {
+            this->registerFaultHandler();
+        }
+    }
+
     std::unique_lock<SpinLock> lock{mtx};
     for (auto allocPtr : unifiedMemoryManager->nonGpuDomainAllocs) {
         auto &pageFaultData = this->memoryData[allocPtr];
@@ -70,12 +88,14 @@ void PageFaultManager::moveAllocationsWithinUMAllocsManagerToGpuDomain(SVMAllocs
 }
 
 inline void PageFaultManager::migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData) {
-    if (pageFaultData.domain == AllocationDomain::Cpu) {
+    if (pageFaultData.chunkSize != 0u) {
+        this->migrateChunksToGpuDomain(ptr, pageFaultData);
+    } else if (pageFaultData.domain == AllocationDomain::Cpu) {
         std::chrono::steady_clock::time_point start;
         std::chrono::steady_clock::time_point end;
 
         start = std::chrono::steady_clock::now();
-        this->transferToGpu(ptr, pageFaultData.cmdQ);
+        this->transferToGpu(ptr, pageFaultData.size, pageFaultData.cmdQ);
         end = std::chrono::steady_clock::now();
         long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
 
@@ -95,7 +115,15 @@ bool PageFaultManager::verifyPageFault(void *ptr) {
         auto &pageFaultData = alloc.second;
         if (ptr >= allocPtr && ptr < ptrOffset(allocPtr, pageFaultData.size)) {
             this->setAubWritable(true, allocPtr, pageFaultData.unifiedMemoryManager);
-            gpuDomainHandler(this, allocPtr, pageFaultData);
+            if (pageFaultData.chunkSize != 0u && gpuDomainHandler == &PageFaultManager::handleGpuDomainTransferForHw) {
+                this->migrateChunkToCpuDomain(allocPtr, ptr, pageFaultData);
+            } else {
+                gpuDomainHandler(this, allocPtr, pageFaultData);
+                if (pageFaultData.chunkSize != 0u && pageFaultData.domain == AllocationDomain::Cpu) {
+                    // handler made whole allocation accessible to cpu
+                    std::fill(pageFaultData.cpuChunks.begin(), pageFaultData.cpuChunks.end(), true);
+                }
+            }
             return true;
         }
     }
@@ -134,6 +162,84 @@ inline void PageFaultManager::migrateStorageToCpuDomain(void *ptr, PageFaultData
     pageFaultData.domain = AllocationDomain::Cpu;
 }
 
+std::unordered_map<void *, PageFaultManager::PageFaultData>::iterator PageFaultManager::findMemoryData(void *ptr) {
+    return std::find_if(memoryData.begin(), memoryData.end(), [ptr](const auto &alloc) {
+        return ptr >= alloc.first && ptr < ptrOffset(alloc.first, alloc.second.size);
+    });
+}
+
+size_t PageFaultManager::getMigrationChunkSize(size_t allocationSize) {
+    if (DebugManager.flags.SharedAllocationMigrationChunkSizeInKb.get() <= 0) {
+        return 0u;
+    }
+    auto chunkSize = alignUp(static_cast<size_t>(DebugManager.flags.SharedAllocationMigrationChunkSizeInKb.get()) * MemoryConstants::kiloByte, MemoryConstants::pageSize);
+    return (allocationSize > chunkSize) ? chunkSize : 0u;
+}
+
+void PageFaultManager::migrateChunksToGpuDomain(void *ptr, PageFaultData &pageFaultData) {
+    // adjacent chunks accessed by cpu are transferred and protected with single call
+    auto chunkCount = pageFaultData.cpuChunks.size();
+    for (size_t chunk = 0u; chunk < chunkCount;) {
+        if (!pageFaultData.cpuChunks[chunk]) {
+            chunk++;
+            continue;
+        }
+        auto firstChunk = chunk;
+        while (chunk < chunkCount && pageFaultData.cpuChunks[chunk]) {
+            pageFaultData.cpuChunks[chunk] = false;
+            chunk++;
+        }
+        auto rangeOffset = firstChunk * pageFaultData.chunkSize;
+        auto rangeSize = std::min(chunk * pageFaultData.chunkSize, pageFaultData.size) - rangeOffset;
+        auto rangePtr = ptrOffset(ptr, rangeOffset);
+
+        std::chrono::steady_clock::time_point start;
+        std::chrono::steady_clock::time_point end;
+
+        start = std::chrono::steady_clock::now();
+        this->transferToGpu(rangePtr, rangeSize, pageFaultData.cmdQ);
+        end = std::chrono::steady_clock::now();
+        long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+        if (DebugManager.flags.PrintUmdSharedMigration.get()) {
+            printf("UMD transferred shared allocation range %llx (%zu B) from CPU to GPU (%f us)\n", reinterpret_cast<unsigned long long int>(rangePtr), rangeSize, elapsedTime / 1e3);
+        }
+
+        this->protectCPUMemoryAccess(rangePtr, rangeSize);
+    }
+}
+
+void PageFaultManager::migrateChunkToCpuDomain(void *ptr, void *faultPtr, PageFaultData &pageFaultData) {
+    auto chunk = ptrDiff(faultPtr, ptr) / pageFaultData.chunkSize;
+    auto chunkOffset = chunk * pageFaultData.chunkSize;
+    auto chunkSize = std::min(pageFaultData.chunkSize, pageFaultData.size - chunkOffset);
+    auto chunkPtr = ptrOffset(ptr, chunkOffset);
+
+    if (!pageFaultData.cpuChunks[chunk]) {
+        // allocation never migrated to gpu holds no gpu data to transfer
+        if (pageFaultData.domain != AllocationDomain::None) {
+            std::chrono::steady_clock::time_point start;
+            std::chrono::steady_clock::time_point end;
+
+            start = std::chrono::steady_clock::now();
+            this->transferToCpu(chunkPtr, chunkSize, pageFaultData.cmdQ);
+            end = std::chrono::steady_clock::now();
+            long long elapsedTime = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+            if (DebugManager.flags.PrintUmdSharedMigration.get()) {
+                printf("UMD transferred shared allocation range %llx (%zu B) from GPU to CPU (%f us)\n", reinterpret_cast<unsigned long long int>(chunkPtr), chunkSize, elapsedTime / 1e3);
+            }
+        }
+        this->allowCPUMemoryAccess(chunkPtr, chunkSize);
+        pageFaultData.cpuChunks[chunk] = true;
+    }
+
+    if (pageFaultData.domain == AllocationDomain::Gpu) {
+        pageFaultData.unifiedMemoryManager->nonGpuDomainAllocs.push_back(ptr);
+        pageFaultData.domain = AllocationDomain::Cpu;
+    }
+}
+
 void PageFaultManager::selectGpuDomainHandler() {
     if (DebugManager.flags.SetCommandStreamReceiver.get() > CommandStreamReceiverType::CSR_HW) {
         this->gpuDomainHandler = &PageFaultManager::handleGpuDomainTransferForAubAndTbx;
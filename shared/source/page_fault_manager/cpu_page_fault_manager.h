@@ -14,6 +14,7 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace NEO {
 class GraphicsAllocation;
@@ -42,6 +43,8 @@ class PageFaultManager : public NonCopyableOrMovableClass {
         SVMAllocsManager *unifiedMemoryManager;
         void *cmdQ;
         AllocationDomain domain;
+        size_t chunkSize = 0u;
+        std::vector<bool> cpuChunks;
     };
 
     typedef void (*gpuDomainHandlerFunc)(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
@@ -51,12 +54,15 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     virtual void allowCPUMemoryAccess(void *ptr, size_t size) = 0;
     virtual void protectCPUMemoryAccess(void *ptr, size_t size) = 0;
     MOCKABLE_VIRTUAL void transferToCpu(void *ptr, size_t size, void *cmdQ);
+    static size_t getMigrationChunkSize(size_t allocationSize);
 
   protected:
     virtual void evictMemoryAfterImplCopy(GraphicsAllocation *allocation, Device *device) = 0;
+    virtual bool checkFaultHandlerFromPageFaultManager() { return true; }
+    virtual void registerFaultHandler() {}
 
     MOCKABLE_VIRTUAL bool verifyPageFault(void *ptr);
-    MOCKABLE_VIRTUAL void transferToGpu(void *ptr, void *cmdQ);
+    MOCKABLE_VIRTUAL void transferToGpu(void *ptr, size_t size, void *cmdQ);
     MOCKABLE_VIRTUAL void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager);
 
     static void handleGpuDomainTransferForHw(PageFaultManager *pageFaultHandler, void *alloc, PageFaultData &pageFaultData);
@@ -64,6 +70,9 @@ class PageFaultManager : public NonCopyableOrMovableClass {
     void selectGpuDomainHandler();
     inline void migrateStorageToGpuDomain(void *ptr, PageFaultData &pageFaultData);
     inline void migrateStorageToCpuDomain(void *ptr, PageFaultData &pageFaultData);
+    std::unordered_map<void *, PageFaultData>::iterator findMemoryData(void *ptr);
+    void migrateChunksToGpuDomain(void *ptr, PageFaultData &pageFaultData);
+    void migrateChunkToCpuDomain(void *ptr, void *faultPtr, PageFaultData &pageFaultData);
 
     decltype(&handleGpuDomainTransferForHw) gpuDomainHandler = &handleGpuDomainTransferForHw;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -31,24 +31,37 @@ PageFaultManagerLinux::PageFaultManagerLinux() {
         }
     };
 
-    struct sigaction pageFaultManagerHandler = {};
-    pageFaultManagerHandler.sa_flags = SA_SIGINFO;
-    pageFaultManagerHandler.sa_sigaction = pageFaultHandlerWrapper;
-
-    auto retVal = sigaction(SIGSEGV, &pageFaultManagerHandler, &previousPageFaultHandler);
-    UNRECOVERABLE_IF(retVal != 0);
+    registerFaultHandler();
 
     this->evictMemoryAfterCopy = DebugManager.flags.EnableDirectSubmission.get() &&
                                  DebugManager.flags.USMEvictAfterMigration.get();
 }
 
 PageFaultManagerLinux::~PageFaultManagerLinux() {
-    if (!previousHandlerRestored) {
+    // handler installed later by application stays in place
+    if (!previousHandlerRestored && checkFaultHandlerFromPageFaultManager()) {
         auto retVal = sigaction(SIGSEGV, &previousPageFaultHandler, nullptr);
         UNRECOVERABLE_IF(retVal != 0);
     }
 }
 
+bool PageFaultManagerLinux::checkFaultHandlerFromPageFaultManager() {
+    struct sigaction currentPageFaultHandler = {};
+    auto retVal = sigaction(SIGSEGV, nullptr, &currentPageFaultHandler);
+    UNRECOVERABLE_IF(retVal != 0);
+    return (currentPageFaultHandler.sa_flags & SA_SIGINFO) && currentPageFaultHandler.sa_sigaction == pageFaultHandlerWrapper;
+}
+
+void PageFaultManagerLinux::registerFaultHandler() {
+    struct sigaction pageFaultManagerHandler = {};
+    pageFaultManagerHandler.sa_flags = SA_SIGINFO;
+    pageFaultManagerHandler.sa_sigaction = pageFaultHandlerWrapper;
+
+    auto retVal = sigaction(SIGSEGV, &pageFaultManagerHandler, &previousPageFaultHandler);
+    UNRECOVERABLE_IF(retVal != 0);
+    previousHandlerRestored = false;
+}
+
 void PageFaultManagerLinux::pageFaultHandlerWrapper(int signal, siginfo_t *info, void *context) {
     pageFaultHandler(signal, info, context);
 }
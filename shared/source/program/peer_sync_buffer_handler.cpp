@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/program/peer_sync_buffer_handler.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/memory_manager/allocation_properties.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace NEO {
+
+PeerSyncBufferHandler::PeerSyncBufferHandler(MemoryManager &memoryManager, const RootDeviceIndicesContainer &rootDeviceIndices)
+    : memoryManager(memoryManager), rootDeviceIndices(rootDeviceIndices) {
+    allocateNewBuffer();
+}
+
+PeerSyncBufferHandler::~PeerSyncBufferHandler() {
+    destroyBuffer();
+}
+
+// Counters of a collective span work groups of all devices taking part in it
+size_t PeerSyncBufferHandler::obtainSlot(size_t workGroupsCount) {
+    auto requiredSize = alignUp(workGroupsCount, CommonConstants::maximalSizeOfAtomicType);
+    UNRECOVERABLE_IF(requiredSize > bufferSize);
+    std::lock_guard<std::mutex> guard(this->mutex);
+
+    bool isCurrentBufferFull = (usedBufferSize + requiredSize > bufferSize);
+    if (isCurrentBufferFull) {
+        destroyBuffer();
+        allocateNewBuffer();
+        usedBufferSize = 0;
+    }
+
+    auto slotOffset = usedBufferSize;
+    usedBufferSize += requiredSize;
+    return slotOffset;
+}
+
+void PeerSyncBufferHandler::makeResident(CommandStreamReceiver &csr) {
+    std::lock_guard<std::mutex> guard(this->mutex);
+    csr.makeResident(*getGraphicsAllocation(csr.getRootDeviceIndex()));
+}
+
+GraphicsAllocation *PeerSyncBufferHandler::getGraphicsAllocation(uint32_t rootDeviceIndex) const {
+    return multiGraphicsAllocation->getGraphicsAllocation(rootDeviceIndex);
+}
+
+void PeerSyncBufferHandler::allocateNewBuffer() {
+    auto maxRootDeviceIndex = *std::max_element(rootDeviceIndices.begin(), rootDeviceIndices.end());
+    multiGraphicsAllocation = std::make_unique<MultiGraphicsAllocation>(maxRootDeviceIndex);
+
+    AllocationProperties allocationProperties{rootDeviceIndices[0], true, bufferSize,
+                                              AllocationType::BUFFER_HOST_MEMORY,
+                                              false, /* multiOsContextCapable */
+                                              false, systemMemoryBitfield};
+    auto cpuPointer = memoryManager.createMultiGraphicsAllocationInSystemMemoryPool(rootDeviceIndices, allocationProperties, *multiGraphicsAllocation);
+    UNRECOVERABLE_IF(cpuPointer == nullptr);
+
+    std::memset(cpuPointer, 0, bufferSize);
+}
+
+// Allocations of peer devices only map the storage owned by allocation of the first root device, it is released last
+void PeerSyncBufferHandler::destroyBuffer() {
+    for (auto rootDeviceIndex = rootDeviceIndices.rbegin(); rootDeviceIndex != rootDeviceIndices.rend(); rootDeviceIndex++) {
+        auto graphicsAllocation = multiGraphicsAllocation->getGraphicsAllocation(*rootDeviceIndex);
+        if (graphicsAllocation != nullptr) {
+            memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(graphicsAllocation);
+        }
+    }
+    multiGraphicsAllocation.reset();
+}
+
+} // namespace NEO
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/memory_manager/multi_graphics_allocation.h"
+#include "shared/source/utilities/stackvec.h"
+
+#include <memory>
+#include <mutex>
+
+namespace NEO {
+
+class CommandStreamReceiver;
+class MemoryManager;
+
+// Sync buffer in system memory shared by root devices of one process. Cooperative kernels of one
+// collective are patched with the same slot on every participating device, so they can synchronize
+// through the buffer on the GPU side without host round trips between steps.
+class PeerSyncBufferHandler : NonCopyableOrMovableClass {
+  public:
+    PeerSyncBufferHandler(MemoryManager &memoryManager, const RootDeviceIndicesContainer &rootDeviceIndices);
+    ~PeerSyncBufferHandler();
+
+    size_t obtainSlot(size_t workGroupsCount);
+    template <typename KernelT>
+    void prepareForEnqueue(uint32_t rootDeviceIndex, size_t slotOffset, KernelT &kernel);
+    void makeResident(CommandStreamReceiver &csr);
+    GraphicsAllocation *getGraphicsAllocation(uint32_t rootDeviceIndex) const;
+
+  protected:
+    void allocateNewBuffer();
+    void destroyBuffer();
+
+    MemoryManager &memoryManager;
+    RootDeviceIndicesContainer rootDeviceIndices;
+    std::unique_ptr<MultiGraphicsAllocation> multiGraphicsAllocation;
+    const size_t bufferSize = 64 * KB;
+    size_t usedBufferSize = 0;
+    std::mutex mutex;
+};
+
+} // namespace NEO
@@ -0,0 +1,14 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/program/peer_sync_buffer_handler.h"
+
+template <typename KernelT>
+void NEO::PeerSyncBufferHandler::prepareForEnqueue(uint32_t rootDeviceIndex, size_t slotOffset, KernelT &kernel) {
+    std::lock_guard<std::mutex> guard(this->mutex);
+    kernel.patchSyncBuffer(getGraphicsAllocation(rootDeviceIndex), slotOffset);
+}
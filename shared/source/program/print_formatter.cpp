@@ -10,6 +10,7 @@
 #include "shared/source/helpers/string.h"
 
 #include <iostream>
+#include <string>
 
 namespace NEO {
 
@@ -24,6 +25,15 @@ PrintFormatter::PrintFormatter(const uint8_t *printfOutputBuffer, uint32_t print
     output.reset(new char[maxSinglePrintStringLength]);
 }
 
+// whole output of a kernel is written to stdout at once instead of flushing after every printf call
+void PrintFormatter::printKernelOutput() {
+    std::string kernelOutput;
+    printKernelOutput([&kernelOutput](char *str) { kernelOutput += str; });
+    if (!kernelOutput.empty()) {
+        printToSTDOUT(kernelOutput.c_str());
+    }
+}
+
 void PrintFormatter::printKernelOutput(const std::function<void(char *)> &print) {
     currentOffset = 0;
 
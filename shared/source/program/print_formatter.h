@@ -47,7 +47,8 @@ class PrintFormatter {
   public:
     PrintFormatter(const uint8_t *printfOutputBuffer, uint32_t printfOutputBufferMaxSize,
                    bool using32BitPointers, const StringMap *stringLiteralMap = nullptr);
-    void printKernelOutput(const std::function<void(char *)> &print = [](char *str) { printToSTDOUT(str); });
+    void printKernelOutput();
+    void printKernelOutput(const std::function<void(char *)> &print);
 
     constexpr static size_t maxSinglePrintStringLength = 16 * MemoryConstants::kiloByte;
 
@@ -38,4 +38,14 @@ void SyncBufferHandler::allocateNewBuffer() {
     std::memset(cpuPointer, 0, bufferSize);
 }
 
+void SyncBufferHandler::obtainNewBuffer() {
+    // buffer consumed only by completed work is cleared and reused instead of being reallocated
+    if (!memoryManager.allocInUse(*graphicsAllocation)) {
+        std::memset(graphicsAllocation->getUnderlyingBuffer(), 0, bufferSize);
+        return;
+    }
+    memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(graphicsAllocation);
+    allocateNewBuffer();
+}
+
 } // namespace NEO
@@ -30,6 +30,7 @@ class SyncBufferHandler {
 
   protected:
     void allocateNewBuffer();
+    void obtainNewBuffer();
 
     Device &device;
     MemoryManager &memoryManager;
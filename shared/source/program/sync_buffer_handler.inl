@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021 Intel Corporation
+ * Copyright (C) 2021-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,8 +14,7 @@ void NEO::SyncBufferHandler::prepareForEnqueue(size_t workGroupsCount, KernelT &
 
     bool isCurrentBufferFull = (usedBufferSize + requiredSize > bufferSize);
     if (isCurrentBufferFull) {
-        memoryManager.checkGpuUsageAndDestroyGraphicsAllocations(graphicsAllocation);
-        allocateNewBuffer();
+        obtainNewBuffer();
         usedBufferSize = 0;
     }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/tbx/tbx_sockets_imp.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/string.h"
 
@@ -29,15 +30,20 @@ typedef struct sockaddr SOCKADDR;
 #include "tbx_proto.h"
 
 #include <cstdint>
+#include <limits>
 
 namespace NEO {
 
 TbxSocketsImp::TbxSocketsImp(std::ostream &err)
     : cerrStream(err) {
+    if (DebugManager.flags.TbxWriteBatchSize.get() != -1) {
+        writeBatchSize = static_cast<size_t>(DebugManager.flags.TbxWriteBatchSize.get());
+    }
 }
 
 void TbxSocketsImp::close() {
     if (0 != m_socket) {
+        flushPendingWrites();
 #ifdef WIN32
         ::shutdown(m_socket, 0x02 /*SD_BOTH*/);
 
@@ -134,6 +140,11 @@ bool TbxSocketsImp::connectToServer(const std::string &hostNameOrIp, uint16_t po
 bool TbxSocketsImp::readMMIO(uint32_t offset, uint32_t *data) {
     bool success;
     do {
+        success = flushPendingWrites();
+        if (!success) {
+            break;
+        }
+
         HAS_MSG cmd;
         memset(&cmd, 0, sizeof(cmd));
         cmd.hdr.msg_type = HAS_MMIO_REQ_TYPE;
@@ -183,7 +194,7 @@ bool TbxSocketsImp::writeMMIO(uint32_t offset, uint32_t value) {
     cmd.u.mmio_req.write = 1;
     cmd.u.mmio_req.size = sizeof(uint32_t);
 
-    return sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+    return queueWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size) && flushPendingWrites();
 }
 
 bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
@@ -202,6 +213,11 @@ bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
 
     bool success;
     do {
+        success = flushPendingWrites();
+        if (!success) {
+            break;
+        }
+
         success = sendWriteData(&cmd, sizeof(HAS_HDR) + sizeof(HAS_READ_DATA_REQ));
         if (!success) {
             break;
@@ -227,6 +243,10 @@ bool TbxSocketsImp::readMemory(uint64_t addrOffset, void *data, size_t size) {
 }
 
 bool TbxSocketsImp::writeMemory(uint64_t physAddr, const void *data, size_t size, uint32_t type) {
+    if (appendToQueuedMemoryWrite(physAddr, data, size, type)) {
+        return true;
+    }
+
     HAS_MSG cmd;
     memset(&cmd, 0, sizeof(cmd));
     cmd.hdr.msg_type = HAS_WRITE_DATA_REQ_TYPE;
@@ -244,16 +264,23 @@ bool TbxSocketsImp::writeMemory(uint64_t physAddr, const void *data, size_t size
 
     bool success;
     do {
-        success = sendWriteData(&cmd, sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ));
+        auto headerOffset = pendingWrites.size();
+        success = queueWriteData(&cmd, sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ));
         if (!success) {
             break;
         }
 
-        success = sendWriteData(data, size);
+        success = queueWriteData(data, size);
         if (!success) {
             cerrStream << "Problem sending write data?" << std::endl;
             break;
         }
+
+        lastQueuedMemoryWrite.valid = (pendingWrites.size() == headerOffset + sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ) + size);
+        lastQueuedMemoryWrite.headerOffset = headerOffset;
+        lastQueuedMemoryWrite.dataEndOffset = pendingWrites.size();
+        lastQueuedMemoryWrite.endAddress = physAddr + size;
+        lastQueuedMemoryWrite.type = type;
     } while (false);
 
     DEBUG_BREAK_IF(!success);
@@ -271,7 +298,56 @@ bool TbxSocketsImp::writeGTT(uint32_t offset, uint64_t entry) {
     cmd.u.gtt64_req.data = static_cast<uint32_t>(entry & 0xffffffff);
     cmd.u.gtt64_req.data_h = static_cast<uint32_t>(entry >> 32);
 
-    return sendWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+    return queueWriteData(&cmd, sizeof(HAS_HDR) + cmd.hdr.size);
+}
+
+bool TbxSocketsImp::appendToQueuedMemoryWrite(uint64_t physAddr, const void *data, size_t size, uint32_t type) {
+    if (!lastQueuedMemoryWrite.valid || lastQueuedMemoryWrite.dataEndOffset != pendingWrites.size() ||
+        lastQueuedMemoryWrite.endAddress != physAddr || lastQueuedMemoryWrite.type != type ||
+        pendingWrites.size() + size > writeBatchSize) {
+        return false;
+    }
+
+    HAS_MSG cmd;
+    auto queuedHeader = &pendingWrites[lastQueuedMemoryWrite.headerOffset];
+    memcpy_s(&cmd, sizeof(cmd), queuedHeader, sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ));
+    if (static_cast<uint64_t>(cmd.u.write_req.size) + size > std::numeric_limits<uint32_t>::max()) {
+        return false;
+    }
+    cmd.u.write_req.size += static_cast<uint32_t>(size);
+    memcpy_s(queuedHeader, sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ), &cmd, sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ));
+
+    auto dataBuffer = reinterpret_cast<const char *>(data);
+    pendingWrites.insert(pendingWrites.end(), dataBuffer, dataBuffer + size);
+    lastQueuedMemoryWrite.dataEndOffset = pendingWrites.size();
+    lastQueuedMemoryWrite.endAddress += size;
+    return true;
+}
+
+bool TbxSocketsImp::queueWriteData(const void *buffer, size_t sizeInBytes) {
+    if (pendingWrites.size() + sizeInBytes > writeBatchSize) {
+        if (!flushPendingWrites()) {
+            return false;
+        }
+        if (sizeInBytes > writeBatchSize) {
+            return sendWriteData(buffer, sizeInBytes);
+        }
+    }
+
+    auto dataBuffer = reinterpret_cast<const char *>(buffer);
+    pendingWrites.insert(pendingWrites.end(), dataBuffer, dataBuffer + sizeInBytes);
+    return true;
+}
+
+bool TbxSocketsImp::flushPendingWrites() {
+    lastQueuedMemoryWrite.valid = false;
+    if (pendingWrites.empty()) {
+        return true;
+    }
+
+    auto success = sendWriteData(pendingWrites.data(), pendingWrites.size());
+    pendingWrites.clear();
+    return success;
 }
 
 bool TbxSocketsImp::sendWriteData(const void *buffer, size_t sizeInBytes) {
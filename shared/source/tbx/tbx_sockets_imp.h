@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2020 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -11,11 +11,14 @@
 #include "os_socket.h"
 
 #include <iostream>
+#include <vector>
 
 namespace NEO {
 
 class TbxSocketsImp : public TbxSockets {
   public:
+    static constexpr size_t defaultWriteBatchSize = 1 * 1024 * 1024;
+
     TbxSocketsImp(std::ostream &err = std::cerr);
     ~TbxSocketsImp() override = default;
 
@@ -34,14 +37,32 @@ class TbxSocketsImp : public TbxSockets {
     std::ostream &cerrStream;
     SOCKET m_socket = 0;
 
+    struct QueuedMemoryWrite {
+        size_t headerOffset = 0;
+        size_t dataEndOffset = 0;
+        uint64_t endAddress = 0;
+        uint32_t type = 0;
+        bool valid = false;
+    };
+
     bool connectToServer(const std::string &hostNameOrIp, uint16_t port);
-    bool sendWriteData(const void *buffer, size_t sizeInBytes);
+    MOCKABLE_VIRTUAL bool sendWriteData(const void *buffer, size_t sizeInBytes);
     bool getResponseData(void *buffer, size_t sizeInBytes);
+    bool queueWriteData(const void *buffer, size_t sizeInBytes);
+    bool appendToQueuedMemoryWrite(uint64_t physAddr, const void *data, size_t size, uint32_t type);
+    bool flushPendingWrites();
 
     inline uint32_t getNextTransID() { return transID++; }
 
     void logErrorInfo(const char *tag);
 
     uint32_t transID = 0;
+
+    // Requests which don't expect a response are buffered and sent at once, data of writes to
+    // adjacent addresses is appended to the previous request. Buffer is flushed before every
+    // request waiting for a response and after MMIO writes, which can trigger execution on TBX.
+    std::vector<char> pendingWrites;
+    size_t writeBatchSize = defaultWriteBatchSize;
+    QueuedMemoryWrite lastQueuedMemoryWrite;
 };
 } // namespace NEO
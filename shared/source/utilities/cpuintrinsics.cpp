@@ -7,10 +7,21 @@
 
 #include "shared/source/utilities/cpuintrinsics.h"
 
+#include <algorithm>
+#include <cstring>
+
 #if defined(__ARM_ARCH)
 #include <sse2neon.h>
 #else
 #include <emmintrin.h>
+#include <immintrin.h>
+#if defined(_WIN32)
+#include <intrin.h>
+#define WAITPKG_TARGET
+#else
+#include <x86intrin.h>
+#define WAITPKG_TARGET __attribute__((target("waitpkg")))
+#endif
 #endif
 
 namespace NEO {
@@ -28,5 +39,71 @@ void pause() {
     _mm_pause();
 }
 
+void nonTemporalFill(void *dst, uint64_t pattern, size_t size) {
+    auto qwords = static_cast<uint64_t *>(dst);
+    size_t count = size / sizeof(uint64_t);
+    size_t i = 0;
+    for (; i < count && (reinterpret_cast<uintptr_t>(&qwords[i]) % sizeof(__m128i)) != 0; i++) {
+        qwords[i] = pattern;
+    }
+    const __m128i vectorPattern = _mm_set1_epi64x(static_cast<long long>(pattern));
+    for (; i + 1 < count; i += 2) {
+        _mm_stream_si128(reinterpret_cast<__m128i *>(&qwords[i]), vectorPattern);
+    }
+    for (; i < count; i++) {
+        qwords[i] = pattern;
+    }
+}
+
+void nonTemporalCopy(void *dst, const void *src, size_t size) {
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+    size_t head = (sizeof(__m128i) - (reinterpret_cast<uintptr_t>(dstBytes) % sizeof(__m128i))) % sizeof(__m128i);
+    head = std::min(head, size);
+    memcpy(dstBytes, srcBytes, head);
+    size_t i = head;
+    for (; i + 4 * sizeof(__m128i) <= size; i += 4 * sizeof(__m128i)) {
+        auto srcVector = reinterpret_cast<const __m128i *>(srcBytes + i);
+        auto dstVector = reinterpret_cast<__m128i *>(dstBytes + i);
+        const __m128i v0 = _mm_loadu_si128(srcVector);
+        const __m128i v1 = _mm_loadu_si128(srcVector + 1);
+        const __m128i v2 = _mm_loadu_si128(srcVector + 2);
+        const __m128i v3 = _mm_loadu_si128(srcVector + 3);
+        _mm_stream_si128(dstVector, v0);
+        _mm_stream_si128(dstVector + 1, v1);
+        _mm_stream_si128(dstVector + 2, v2);
+        _mm_stream_si128(dstVector + 3, v3);
+    }
+    for (; i + sizeof(__m128i) <= size; i += sizeof(__m128i)) {
+        _mm_stream_si128(reinterpret_cast<__m128i *>(dstBytes + i), _mm_loadu_si128(reinterpret_cast<const __m128i *>(srcBytes + i)));
+    }
+    memcpy(dstBytes + i, srcBytes + i, size - i);
+}
+
+#if defined(__ARM_ARCH)
+void umonitor(void const *address) {
+}
+
+uint8_t umwait(uint32_t control, uint64_t counter) {
+    return 0;
+}
+
+uint64_t rdtsc() {
+    return 0;
+}
+#else
+WAITPKG_TARGET void umonitor(void const *address) {
+    _umonitor(const_cast<void *>(address));
+}
+
+WAITPKG_TARGET uint8_t umwait(uint32_t control, uint64_t counter) {
+    return _umwait(control, counter);
+}
+
+uint64_t rdtsc() {
+    return __rdtsc();
+}
+#endif
+
 } // namespace CpuIntrinsics
 } // namespace NEO
@@ -7,6 +7,9 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
+
 namespace NEO {
 namespace CpuIntrinsics {
 
@@ -16,5 +19,17 @@ void clFlush(void const *ptr);
 
 void pause();
 
+void umonitor(void const *address);
+
+uint8_t umwait(uint32_t control, uint64_t counter);
+
+uint64_t rdtsc();
+
+// fills 8-byte aligned dst with the 8-byte pattern using stores bypassing caches, size must be a multiple of 8
+void nonTemporalFill(void *dst, uint64_t pattern, size_t size);
+
+// copies size bytes using stores bypassing caches, needs sfence before the data is consumed by another agent
+void nonTemporalCopy(void *dst, const void *src, size_t size);
+
 } // namespace CpuIntrinsics
 } // namespace NEO
@@ -28,6 +28,8 @@ class SettingsReader {
     virtual bool getSetting(const char *settingName, bool defaultValue) = 0;
     virtual std::string getSetting(const char *settingName, const std::string &value) = 0;
     virtual const char *appSpecificLocation(const std::string &name) = 0;
+    // Called once before all debug variables are queried, readers may gather settings in a single pass
+    virtual void prefetchSettings() {}
     static const char *settingsFileName;
     MOCKABLE_VIRTUAL char *getenv(const char *settingName);
 };
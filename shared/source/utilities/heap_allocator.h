@@ -6,10 +6,12 @@
  */
 
 #pragma once
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/debug_helpers.h"
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
 #include <vector>
 
@@ -36,6 +38,7 @@ class HeapAllocator {
         pRightBound = address + size;
         freedChunksBig.reserve(10);
         freedChunksSmall.reserve(50);
+        sizeClassCacheEnabled = DebugManager.flags.EnableHeapAllocatorSizeClassCache.get() == 1;
     }
 
     uint64_t allocate(size_t &sizeToAllocate) {
@@ -56,6 +59,12 @@ class HeapAllocator {
             return 0llu;
         }
 
+        uint64_t sizeClassChunk = getFromSizeClassFreeList(sizeToAllocate, alignment);
+        if (sizeClassChunk != 0llu) {
+            availableSize -= sizeToAllocate;
+            return sizeClassChunk;
+        }
+
         std::vector<HeapChunk> &freedChunks = (sizeToAllocate > sizeThreshold) ? freedChunksBig : freedChunksSmall;
         uint32_t defragmentCount = 0;
 
@@ -119,11 +128,13 @@ class HeapAllocator {
         } else if (ptr == pLeftBound - size) {
             pLeftBound = ptr;
             mergeLastFreedBig();
-        } else if (ptr < pLeftBound) {
-            DEBUG_BREAK_IF(size <= sizeThreshold);
-            storeInFreedChunks(ptr, size, freedChunksBig);
-        } else {
-            storeInFreedChunks(ptr, size, freedChunksSmall);
+        } else if (false == storeInSizeClassFreeList(ptr, size)) {
+            if (ptr < pLeftBound) {
+                DEBUG_BREAK_IF(size <= sizeThreshold);
+                storeInFreedChunks(ptr, size, freedChunksBig);
+            } else {
+                storeInFreedChunks(ptr, size, freedChunksSmall);
+            }
         }
         availableSize += size;
     }
@@ -153,6 +164,58 @@ class HeapAllocator {
     std::vector<HeapChunk> freedChunksBig;
     std::mutex mtx;
 
+    static constexpr std::array<size_t, 2> sizeClasses = {{MemoryConstants::pageSize, MemoryConstants::pageSize64k}};
+    std::array<std::vector<uint64_t>, sizeClasses.size()> sizeClassFreeLists;
+    bool sizeClassCacheEnabled = false;
+
+    int32_t getSizeClassIndex(size_t size) const {
+        for (size_t i = 0; i < sizeClasses.size(); i++) {
+            if (sizeClasses[i] == size) {
+                return static_cast<int32_t>(i);
+            }
+        }
+        return -1;
+    }
+
+    uint64_t getFromSizeClassFreeList(size_t size, size_t requiredAlignment) {
+        if (!sizeClassCacheEnabled) {
+            return 0llu;
+        }
+        auto sizeClassIndex = getSizeClassIndex(size);
+        if (sizeClassIndex < 0) {
+            return 0llu;
+        }
+        auto &freeList = sizeClassFreeLists[sizeClassIndex];
+        if (freeList.empty() || !isAligned(freeList.back(), requiredAlignment)) {
+            return 0llu;
+        }
+        auto ptr = freeList.back();
+        freeList.pop_back();
+        return ptr;
+    }
+
+    bool storeInSizeClassFreeList(uint64_t ptr, size_t size) {
+        if (!sizeClassCacheEnabled) {
+            return false;
+        }
+        auto sizeClassIndex = getSizeClassIndex(size);
+        if (sizeClassIndex < 0) {
+            return false;
+        }
+        sizeClassFreeLists[sizeClassIndex].push_back(ptr);
+        return true;
+    }
+
+    void flushSizeClassFreeLists() {
+        for (size_t i = 0; i < sizeClasses.size(); i++) {
+            for (auto ptr : sizeClassFreeLists[i]) {
+                auto &freedChunks = (ptr < pLeftBound) ? freedChunksBig : freedChunksSmall;
+                freedChunks.emplace_back(ptr, sizeClasses[i]);
+            }
+            sizeClassFreeLists[i].clear();
+        }
+    }
+
     uint64_t getFromFreedChunks(size_t size, std::vector<HeapChunk> &freedChunks, size_t &sizeOfFreedChunk, size_t requiredAlignment) {
         size_t elements = freedChunks.size();
         size_t bestFitIndex = -1;
@@ -248,6 +311,7 @@ class HeapAllocator {
     }
 
     void defragment() {
+        flushSizeClassFreeLists();
 
         if (freedChunksSmall.size() > 1) {
             std::sort(freedChunksSmall.rbegin(), freedChunksSmall.rend());
@@ -34,6 +34,12 @@ class HwTimeStamps : public TagTypeBase {
     uint64_t getContextEndValue(uint32_t) const { return ContextEndTS; }
     uint64_t getGlobalEndValue(uint32_t) const { return GlobalEndTS; }
 
+    bool isCompleted(uint32_t) const { return ContextEndTS != 1u; }
+    void getGlobalStartEndRange(uint32_t, uint64_t &globalStart, uint64_t &globalEnd) const {
+        globalStart = GlobalStartTS;
+        globalEnd = GlobalEndTS;
+    }
+
     uint64_t GlobalStartTS;
     uint64_t ContextStartTS;
     uint64_t GlobalEndTS;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -209,6 +209,11 @@ class IDList {
         return std::unique_ptr<NodeObjectType>(processLocked<ThisType, &ThisType::removeOneImpl>(&node));
     }
 
+    template <typename ContainerT>
+    void removeMany(ContainerT &nodes) {
+        processLocked<ThisType, &ThisType::template removeManyImpl<ContainerT>>(nullptr, &nodes);
+    }
+
     std::unique_ptr<NodeObjectType> removeFrontOne() {
         return std::unique_ptr<NodeObjectType>(processLocked<ThisType, &ThisType::removeFrontOneImpl>(nullptr));
     }
@@ -376,6 +381,14 @@ class IDList {
         return node;
     }
 
+    template <typename ContainerT>
+    NodeObjectType *removeManyImpl(NodeObjectType *, void *data) {
+        for (auto node : *static_cast<ContainerT *>(data)) {
+            removeOneImpl(node, nullptr);
+        }
+        return nullptr;
+    }
+
     NodeObjectType *removeFrontOneImpl(NodeObjectType *, void *) {
         if (head == nullptr) {
             return nullptr;
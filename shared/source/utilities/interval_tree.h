@@ -0,0 +1,183 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace NEO {
+
+// Set of [start, end) address ranges with unique start addresses, kept in a treap
+// augmented with the maximal end address of each subtree. Lookups and overlap
+// queries take O(log n) expected time, nodes are never copied or moved so
+// references to stored values stay valid until the range is erased.
+template <typename ValueT>
+class IntervalTree {
+  public:
+    ValueT *find(uintptr_t start) {
+        auto node = root.get();
+        while (node != nullptr && node->start != start) {
+            node = (start < node->start) ? node->left.get() : node->right.get();
+        }
+        return node != nullptr ? &node->value : nullptr;
+    }
+
+    ValueT &insert(uintptr_t start, uintptr_t end, const ValueT &value) {
+        DEBUG_BREAK_IF(find(start) != nullptr);
+        auto node = std::make_unique<Node>();
+        node->start = start;
+        node->end = end;
+        node->maxEnd = end;
+        node->priority = nextPriority();
+        node->value = value;
+        nodesCount++;
+        return insert(root, std::move(node))->value;
+    }
+
+    bool erase(uintptr_t start) {
+        if (erase(root, start)) {
+            nodesCount--;
+            return true;
+        }
+        return false;
+    }
+
+    // Calls functor(start, end, value) for each stored range overlapping [start, end) in ascending
+    // order of start addresses until it returns true. Returns true if iteration was stopped.
+    template <typename FunctorT>
+    bool forEachOverlapping(uintptr_t start, uintptr_t end, FunctorT &&functor) {
+        return forEachOverlapping(root.get(), start, end, functor);
+    }
+
+    size_t size() const { return nodesCount; }
+    bool empty() const { return nodesCount == 0; }
+
+  protected:
+    struct Node {
+        uintptr_t start = 0;
+        uintptr_t end = 0;
+        uintptr_t maxEnd = 0;
+        uint32_t priority = 0;
+        ValueT value{};
+        std::unique_ptr<Node> left;
+        std::unique_ptr<Node> right;
+    };
+
+    uint32_t nextPriority() {
+        priorityState ^= priorityState << 13;
+        priorityState ^= priorityState >> 17;
+        priorityState ^= priorityState << 5;
+        return priorityState;
+    }
+
+    static void update(Node *node) {
+        node->maxEnd = node->end;
+        if (node->left) {
+            node->maxEnd = std::max(node->maxEnd, node->left->maxEnd);
+        }
+        if (node->right) {
+            node->maxEnd = std::max(node->maxEnd, node->right->maxEnd);
+        }
+    }
+
+    static void rotateRight(std::unique_ptr<Node> &node) {
+        auto newRoot = std::move(node->left);
+        node->left = std::move(newRoot->right);
+        update(node.get());
+        newRoot->right = std::move(node);
+        node = std::move(newRoot);
+        update(node.get());
+    }
+
+    static void rotateLeft(std::unique_ptr<Node> &node) {
+        auto newRoot = std::move(node->right);
+        node->right = std::move(newRoot->left);
+        update(node.get());
+        newRoot->left = std::move(node);
+        node = std::move(newRoot);
+        update(node.get());
+    }
+
+    static Node *insert(std::unique_ptr<Node> &subtree, std::unique_ptr<Node> node) {
+        if (!subtree) {
+            subtree = std::move(node);
+            return subtree.get();
+        }
+        Node *inserted = nullptr;
+        if (node->start < subtree->start) {
+            inserted = insert(subtree->left, std::move(node));
+            if (subtree->left->priority > subtree->priority) {
+                rotateRight(subtree);
+            }
+        } else {
+            inserted = insert(subtree->right, std::move(node));
+            if (subtree->right->priority > subtree->priority) {
+                rotateLeft(subtree);
+            }
+        }
+        update(subtree.get());
+        return inserted;
+    }
+
+    static bool erase(std::unique_ptr<Node> &subtree, uintptr_t start) {
+        if (!subtree) {
+            return false;
+        }
+        if (start == subtree->start) {
+            removeRoot(subtree);
+            return true;
+        }
+        auto erased = erase((start < subtree->start) ? subtree->left : subtree->right, start);
+        if (erased) {
+            update(subtree.get());
+        }
+        return erased;
+    }
+
+    static void removeRoot(std::unique_ptr<Node> &subtree) {
+        if (!subtree->left || !subtree->right) {
+            auto child = subtree->left ? std::move(subtree->left) : std::move(subtree->right);
+            subtree = std::move(child);
+            return;
+        }
+        if (subtree->left->priority > subtree->right->priority) {
+            rotateRight(subtree);
+            removeRoot(subtree->right);
+        } else {
+            rotateLeft(subtree);
+            removeRoot(subtree->left);
+        }
+        update(subtree.get());
+    }
+
+    template <typename FunctorT>
+    static bool forEachOverlapping(Node *node, uintptr_t start, uintptr_t end, FunctorT &functor) {
+        if (node == nullptr || node->maxEnd <= start) {
+            return false;
+        }
+        if (forEachOverlapping(node->left.get(), start, end, functor)) {
+            return true;
+        }
+        if (node->start >= end) {
+            return false;
+        }
+        if (node->end > start && functor(node->start, node->end, node->value)) {
+            return true;
+        }
+        return forEachOverlapping(node->right.get(), start, end, functor);
+    }
+
+    std::unique_ptr<Node> root;
+    size_t nodesCount = 0;
+    uint32_t priorityState = 0x9E3779B9u;
+};
+
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,10 @@
 
 #include "shared/source/utilities/io_functions.h"
 
+#if !defined(_WIN32)
+#include <unistd.h>
+#endif
+
 namespace NEO {
 namespace IoFunctions {
 fopenFuncPtr fopenPtr = &fopen;
@@ -18,5 +22,14 @@ ftellFuncPtr ftellPtr = &ftell;
 rewindFuncPtr rewindPtr = &rewind;
 freadFuncPtr freadPtr = &fread;
 fwriteFuncPtr fwritePtr = &fwrite;
+getEnvironmentFuncPtr getEnvironmentPtr = &getEnvironment;
+
+char **getEnvironment() {
+#if defined(_WIN32)
+    return _environ;
+#else
+    return environ;
+#endif
+}
 } // namespace IoFunctions
 } // namespace NEO
@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/latency_histograms.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/basic_math.h"
+#include "shared/source/helpers/file_io.h"
+
+#include <cmath>
+#include <sstream>
+
+namespace NEO {
+
+namespace {
+struct EntryRegistry {
+    std::mutex mutex;
+    std::vector<std::string> names;
+};
+
+EntryRegistry &getEntryRegistry() {
+    static EntryRegistry registry;
+    return registry;
+}
+
+std::atomic<uint64_t> nextInstanceId{1u};
+
+struct CachedThreadStorage {
+    uint64_t instanceId = 0u;
+    void *storage = nullptr;
+};
+thread_local CachedThreadStorage cachedThreadStorage;
+} // namespace
+
+LatencyHistograms *LatencyHistograms::get() {
+    static std::unique_ptr<LatencyHistograms> instance = []() -> std::unique_ptr<LatencyHistograms> {
+        if (DebugManager.flags.EnableLatencyHistograms.get() != 1) {
+            return nullptr;
+        }
+        std::string dumpFile = DebugManager.flags.LatencyHistogramsDumpFile.get();
+        if (dumpFile == "unk") {
+            dumpFile.clear();
+        }
+        return std::make_unique<LatencyHistograms>(dumpFile);
+    }();
+    return instance.get();
+}
+
+uint32_t LatencyHistograms::registerEntry(const char *name) {
+    auto &registry = getEntryRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (uint32_t entryId = 0; entryId < registry.names.size(); entryId++) {
+        if (registry.names[entryId] == name) {
+            return entryId;
+        }
+    }
+    if (registry.names.size() >= maxEntriesCount) {
+        return maxEntriesCount;
+    }
+    registry.names.emplace_back(name);
+    return static_cast<uint32_t>(registry.names.size() - 1);
+}
+
+std::vector<std::string> LatencyHistograms::getEntryNames() {
+    auto &registry = getEntryRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return registry.names;
+}
+
+uint32_t LatencyHistograms::getBucket(uint64_t valueNs) {
+    if (valueNs < subBucketsCount) {
+        return static_cast<uint32_t>(valueNs);
+    }
+    auto exponent = static_cast<uint32_t>(Math::log2(valueNs));
+    if (exponent > maxExponent) {
+        return bucketsCount - 1;
+    }
+    auto subBucket = static_cast<uint32_t>(valueNs >> (exponent - subBucketsShift)) & (subBucketsCount - 1);
+    return (exponent - subBucketsShift + 1) * subBucketsCount + subBucket;
+}
+
+uint64_t LatencyHistograms::getBucketUpperBound(uint32_t bucket) {
+    if (bucket < subBucketsCount) {
+        return bucket + 1u;
+    }
+    auto exponent = bucket / subBucketsCount + subBucketsShift - 1;
+    auto subBucket = static_cast<uint64_t>(bucket % subBucketsCount);
+    auto bucketWidth = 1ull << (exponent - subBucketsShift);
+    return (subBucketsCount + subBucket) * bucketWidth + bucketWidth;
+}
+
+LatencyHistograms::LatencyHistograms(const std::string &dumpFile)
+    : instanceId(nextInstanceId++), dumpFile(dumpFile) {}
+
+LatencyHistograms::~LatencyHistograms() {
+    if (!dumpFile.empty()) {
+        auto report = getPrometheusReport();
+        writeDataToFile(dumpFile.c_str(), report.c_str(), report.size());
+    }
+}
+
+LatencyHistograms::ThreadStorage &LatencyHistograms::getThreadStorage() {
+    // thread caches storage of the last used instance only, switching instances on one thread registers new storage
+    if (cachedThreadStorage.instanceId != instanceId) {
+        auto storage = std::make_unique<ThreadStorage>();
+        cachedThreadStorage.instanceId = instanceId;
+        cachedThreadStorage.storage = storage.get();
+        std::lock_guard<std::mutex> lock(mutex);
+        threadStorages.push_back(std::move(storage));
+    }
+    return *static_cast<ThreadStorage *>(cachedThreadStorage.storage);
+}
+
+void LatencyHistograms::record(uint32_t entryId, uint64_t valueNs) {
+    if (entryId >= maxEntriesCount) {
+        return;
+    }
+    auto &storage = getThreadStorage();
+    auto histogram = storage.histograms[entryId].load(std::memory_order_acquire);
+    if (histogram == nullptr) {
+        storage.ownedHistograms.push_back(std::make_unique<Histogram>());
+        histogram = storage.ownedHistograms.back().get();
+        storage.histograms[entryId].store(histogram, std::memory_order_release);
+    }
+
+    // only owning thread writes to its histograms, no read-modify-write atomics needed
+    auto add = [](std::atomic<uint64_t> &counter, uint64_t value) {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    };
+    add(histogram->buckets[getBucket(valueNs)], 1u);
+    add(histogram->count, 1u);
+    add(histogram->sumNs, valueNs);
+}
+
+std::vector<LatencyHistograms::MergedHistogram> LatencyHistograms::merge() {
+    std::vector<MergedHistogram> merged(getEntryNames().size());
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto &storage : threadStorages) {
+        for (size_t entryId = 0; entryId < merged.size(); entryId++) {
+            auto histogram = storage->histograms[entryId].load(std::memory_order_acquire);
+            if (histogram == nullptr) {
+                continue;
+            }
+            for (uint32_t bucket = 0; bucket < bucketsCount; bucket++) {
+                merged[entryId].buckets[bucket] += histogram->buckets[bucket].load(std::memory_order_relaxed);
+            }
+            merged[entryId].count += histogram->count.load(std::memory_order_relaxed);
+            merged[entryId].sumNs += histogram->sumNs.load(std::memory_order_relaxed);
+        }
+    }
+    return merged;
+}
+
+uint64_t LatencyHistograms::getPercentile(const MergedHistogram &histogram, double percentile) {
+    auto targetCount = std::max(static_cast<uint64_t>(std::ceil(percentile * histogram.count)), uint64_t{1u});
+    uint64_t cumulativeCount = 0u;
+    for (uint32_t bucket = 0; bucket < bucketsCount; bucket++) {
+        cumulativeCount += histogram.buckets[bucket];
+        if (cumulativeCount >= targetCount) {
+            return getBucketUpperBound(bucket);
+        }
+    }
+    return getBucketUpperBound(bucketsCount - 1);
+}
+
+bool LatencyHistograms::getSummary(const char *name, Summary &summary) {
+    auto names = getEntryNames();
+    auto merged = merge();
+    for (size_t entryId = 0; entryId < std::min(names.size(), merged.size()); entryId++) {
+        if (names[entryId] != name) {
+            continue;
+        }
+        auto &histogram = merged[entryId];
+        summary = {};
+        summary.count = histogram.count;
+        summary.sumNs = histogram.sumNs;
+        if (histogram.count == 0u) {
+            return true;
+        }
+        summary.p50Ns = getPercentile(histogram, 0.5);
+        summary.p99Ns = getPercentile(histogram, 0.99);
+        summary.maxNs = getPercentile(histogram, 1.0);
+        return true;
+    }
+    return false;
+}
+
+std::string LatencyHistograms::getPrometheusReport() {
+    auto names = getEntryNames();
+    auto merged = merge();
+    std::ostringstream report;
+
+    report << "# HELP neo_latency_ns Driver side latency of API calls and internal phases in nanoseconds\n";
+    report << "# TYPE neo_latency_ns histogram\n";
+    for (size_t entryId = 0; entryId < std::min(names.size(), merged.size()); entryId++) {
+        auto &histogram = merged[entryId];
+        if (histogram.count == 0u) {
+            continue;
+        }
+        uint64_t cumulativeCount = 0u;
+        for (uint32_t bucket = 0; bucket < bucketsCount; bucket++) {
+            if (histogram.buckets[bucket] == 0u) {
+                continue;
+            }
+            cumulativeCount += histogram.buckets[bucket];
+            report << "neo_latency_ns_bucket{entry=\"" << names[entryId] << "\",le=\"" << getBucketUpperBound(bucket) << "\"} " << cumulativeCount << "\n";
+        }
+        report << "neo_latency_ns_bucket{entry=\"" << names[entryId] << "\",le=\"+Inf\"} " << histogram.count << "\n";
+        report << "neo_latency_ns_sum{entry=\"" << names[entryId] << "\"} " << histogram.sumNs << "\n";
+        report << "neo_latency_ns_count{entry=\"" << names[entryId] << "\"} " << histogram.count << "\n";
+    }
+    return report.str();
+}
+
+} // namespace NEO
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace NEO {
+
+// Log-linear latency histograms of API entry points and internal driver phases. Every power of two
+// is split into subBucketsCount buckets, so reported values are within 1/subBucketsCount of recorded
+// latency. Each thread records into its own storage without locks, histograms are merged on query.
+class LatencyHistograms : NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t maxEntriesCount = 1024u;
+    static constexpr uint32_t subBucketsShift = 3u;
+    static constexpr uint32_t subBucketsCount = 1u << subBucketsShift;
+    static constexpr uint32_t maxExponent = 47u;
+    static constexpr uint32_t bucketsCount = (maxExponent - 1) * subBucketsCount;
+
+    struct Summary {
+        uint64_t count = 0u;
+        uint64_t sumNs = 0u;
+        uint64_t p50Ns = 0u;
+        uint64_t p99Ns = 0u;
+        uint64_t maxNs = 0u;
+    };
+
+    static LatencyHistograms *get();
+    static uint32_t registerEntry(const char *name);
+    static uint32_t getBucket(uint64_t valueNs);
+    static uint64_t getBucketUpperBound(uint32_t bucket);
+
+    LatencyHistograms(const std::string &dumpFile);
+    ~LatencyHistograms();
+
+    void record(uint32_t entryId, uint64_t valueNs);
+    bool getSummary(const char *name, Summary &summary);
+    std::string getPrometheusReport();
+
+  protected:
+    struct Histogram {
+        std::array<std::atomic<uint64_t>, bucketsCount> buckets{};
+        std::atomic<uint64_t> count{0u};
+        std::atomic<uint64_t> sumNs{0u};
+    };
+
+    struct ThreadStorage {
+        std::array<std::atomic<Histogram *>, maxEntriesCount> histograms{};
+        std::vector<std::unique_ptr<Histogram>> ownedHistograms;
+    };
+
+    struct MergedHistogram {
+        std::array<uint64_t, bucketsCount> buckets{};
+        uint64_t count = 0u;
+        uint64_t sumNs = 0u;
+    };
+
+    ThreadStorage &getThreadStorage();
+    std::vector<MergedHistogram> merge();
+    static uint64_t getPercentile(const MergedHistogram &histogram, double percentile);
+    static std::vector<std::string> getEntryNames();
+
+    const uint64_t instanceId;
+    const std::string dumpFile;
+    std::vector<std::unique_ptr<ThreadStorage>> threadStorages;
+    std::mutex mutex;
+};
+
+class LatencyScope : NonCopyableOrMovableClass {
+  public:
+    LatencyScope(uint32_t entryId) : histograms(LatencyHistograms::get()), entryId(entryId) {
+        if (histograms) {
+            start = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~LatencyScope() {
+        if (histograms) {
+            auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+            histograms->record(entryId, static_cast<uint64_t>(elapsed.count()));
+        }
+    }
+
+  protected:
+    LatencyHistograms *histograms;
+    const uint32_t entryId;
+    std::chrono::steady_clock::time_point start;
+};
+
+} // namespace NEO
+
+#define LATENCY_SCOPE(name)                                                                           \
+    static const uint32_t latencyEntryIdForSingleScope = NEO::LatencyHistograms::registerEntry(name); \
+    NEO::LatencyScope latencyScopeForSingleScope(latencyEntryIdForSingleScope)
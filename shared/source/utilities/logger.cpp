@@ -135,8 +135,10 @@ void FileLogger<DebugLevel>::dumpBinaryProgram(int32_t numDevices, const size_t
 }
 
 const char *getAllocationTypeString(GraphicsAllocation const *graphicsAllocation) {
-    auto type = graphicsAllocation->getAllocationType();
+    return getAllocationTypeString(graphicsAllocation->getAllocationType());
+}
 
+const char *getAllocationTypeString(AllocationType type) {
     switch (type) {
     case AllocationType::BUFFER:
         return "BUFFER";
@@ -21,8 +21,10 @@ namespace NEO {
 class Kernel;
 struct MultiDispatchInfo;
 class GraphicsAllocation;
+enum class AllocationType;
 
 const char *getAllocationTypeString(GraphicsAllocation const *graphicsAllocation);
+const char *getAllocationTypeString(AllocationType type);
 const char *getMemoryPoolString(GraphicsAllocation const *graphicsAllocation);
 
 template <DebugFunctionalityLevel DebugLevel>
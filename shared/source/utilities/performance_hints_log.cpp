@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/performance_hints_log.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+namespace NEO {
+
+namespace {
+struct CallSiteRegistry {
+    std::mutex mutex;
+    std::vector<const char *> callSites;
+};
+
+CallSiteRegistry &getCallSiteRegistry() {
+    static CallSiteRegistry registry;
+    return registry;
+}
+} // namespace
+
+PerformanceHintsLog *PerformanceHintsLog::get() {
+    static std::unique_ptr<PerformanceHintsLog> instance = []() -> std::unique_ptr<PerformanceHintsLog> {
+        auto recordsPerCallSite = DebugManager.flags.PerformanceHintsRecordsPerCallSite.get();
+        if (recordsPerCallSite <= 0) {
+            return nullptr;
+        }
+        return std::make_unique<PerformanceHintsLog>(static_cast<uint32_t>(recordsPerCallSite));
+    }();
+    return instance.get();
+}
+
+uint32_t PerformanceHintsLog::registerCallSite(const char *callSite) {
+    auto &registry = getCallSiteRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (uint32_t callSiteId = 0; callSiteId < registry.callSites.size(); callSiteId++) {
+        if (strcmp(registry.callSites[callSiteId], callSite) == 0) {
+            return callSiteId;
+        }
+    }
+    if (registry.callSites.size() >= maxCallSitesCount) {
+        return maxCallSitesCount;
+    }
+    registry.callSites.push_back(callSite);
+    return static_cast<uint32_t>(registry.callSites.size() - 1);
+}
+
+PerformanceHintsLog::PerformanceHintsLog(uint32_t recordsPerCallSite) : recordsPerCallSite(recordsPerCallSite) {}
+
+void PerformanceHintsLog::record(uint32_t callSiteId, PerformanceHintId hintId, std::initializer_list<uint64_t> params) {
+    if (callSiteId >= maxCallSitesCount) {
+        return;
+    }
+    auto occurrence = ++occurrences[callSiteId];
+    if (occurrence > recordsPerCallSite) {
+        return;
+    }
+
+    PerformanceHintRecord hintRecord;
+    hintRecord.hintId = hintId;
+    hintRecord.callSiteId = callSiteId;
+    {
+        auto &registry = getCallSiteRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        hintRecord.callSite = registry.callSites[callSiteId];
+    }
+    std::copy_n(params.begin(), std::min(params.size(), PerformanceHintRecord::maxParamsCount), hintRecord.params.begin());
+
+    std::lock_guard<std::mutex> lock(mutex);
+    if (records.size() < maxRecordsCount) {
+        records.push_back(hintRecord);
+    }
+}
+
+std::vector<PerformanceHintRecord> PerformanceHintsLog::getRecords() {
+    std::vector<PerformanceHintRecord> recordsCopy;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        recordsCopy = records;
+    }
+    for (auto &hintRecord : recordsCopy) {
+        hintRecord.occurrences = occurrences[hintRecord.callSiteId].load();
+    }
+    return recordsCopy;
+}
+
+uint64_t PerformanceHintsLog::getOccurrences(uint32_t callSiteId) const {
+    return callSiteId < maxCallSitesCount ? occurrences[callSiteId].load() : 0u;
+}
+
+} // namespace NEO
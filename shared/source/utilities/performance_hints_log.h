@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+
+enum class PerformanceHintId : uint32_t {
+    NonZeroCopyMap = 0,            // params: object size, map size
+    AuxTranslation,                // params: argument index, allocation size
+    StateBaseAddressReprogramming, // params: dsh dirty, ioh dirty, ssh dirty, task count
+    ResidencyOverflow,             // params: bytes to trim, handles count
+    CompilerCacheMiss,             // params: misses count
+    UnalignedCopy,                 // params: source address, destination address, size
+    Count
+};
+
+struct PerformanceHintRecord {
+    static constexpr size_t maxParamsCount = 4u;
+
+    PerformanceHintId hintId = PerformanceHintId::Count;
+    uint32_t callSiteId = 0u;
+    const char *callSite = nullptr;
+    std::array<uint64_t, maxParamsCount> params{};
+    uint64_t occurrences = 0u; // all occurrences at the call site, including not recorded ones
+
+};
+
+// Structured performance hints shared by the OpenCL and Level Zero drivers. Every call site
+// keeps first recordsPerCallSite records, further occurrences are only counted so hot loops
+// hitting an anti-pattern don't flood the log.
+class PerformanceHintsLog : NonCopyableOrMovableClass {
+  public:
+    static constexpr uint32_t maxCallSitesCount = 256u;
+    static constexpr size_t maxRecordsCount = 4096u;
+
+    static PerformanceHintsLog *get();
+    static uint32_t registerCallSite(const char *callSite);
+
+    PerformanceHintsLog(uint32_t recordsPerCallSite);
+
+    void record(uint32_t callSiteId, PerformanceHintId hintId, std::initializer_list<uint64_t> params);
+    std::vector<PerformanceHintRecord> getRecords();
+    uint64_t getOccurrences(uint32_t callSiteId) const;
+
+  protected:
+    const uint32_t recordsPerCallSite;
+    std::array<std::atomic<uint64_t>, maxCallSitesCount> occurrences{};
+    std::vector<PerformanceHintRecord> records;
+    std::mutex mutex;
+};
+
+} // namespace NEO
+
+#define PERFORMANCE_HINT_STRINGIFY_LINE(line) #line
+#define PERFORMANCE_HINT_CALL_SITE(file, line) file ":" PERFORMANCE_HINT_STRINGIFY_LINE(line)
+
+#define PERFORMANCE_HINT(hintId, ...)                                                                                                                     \
+    do {                                                                                                                                                  \
+        if (auto performanceHintsLog = NEO::PerformanceHintsLog::get()) {                                                                                 \
+            static const uint32_t performanceHintCallSiteId = NEO::PerformanceHintsLog::registerCallSite(PERFORMANCE_HINT_CALL_SITE(__FILE__, __LINE__)); \
+            performanceHintsLog->record(performanceHintCallSiteId, hintId, {__VA_ARGS__});                                                                \
+        }                                                                                                                                                 \
+    } while (false)
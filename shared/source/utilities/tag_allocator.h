@@ -7,6 +7,7 @@
 
 #pragma once
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/utilities/arrayref.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/idlist.h"
 #include "shared/source/utilities/stackvec.h"
@@ -42,6 +43,8 @@ class TagNodeBase : public NonCopyableOrMovableClass {
 
     MOCKABLE_VIRTUAL void returnTag();
 
+    TagAllocatorBase *getAllocator() const { return allocator; }
+
     virtual void initialize() = 0;
 
     bool canBeReleased() const;
@@ -69,6 +72,10 @@ class TagNodeBase : public NonCopyableOrMovableClass {
 
     virtual void const *getContextEndAddress(uint32_t packetIndex) const = 0;
 
+    // Reduce all used packets of the tag in a single call
+    virtual bool isCompleted() const = 0;
+    virtual void getGlobalStartEndRange(uint64_t &globalStart, uint64_t &globalEnd) const = 0;
+
     virtual uint64_t &getGlobalEndRef() const = 0;
     virtual uint64_t &getContextCompleteRef() const = 0;
 
@@ -125,6 +132,9 @@ class TagNode : public TagNodeBase, public IDNode<TagNode<TagType>> {
 
     void const *getContextEndAddress(uint32_t packetIndex) const override;
 
+    bool isCompleted() const override;
+    void getGlobalStartEndRange(uint64_t &globalStart, uint64_t &globalEnd) const override;
+
     uint64_t &getGlobalEndRef() const override;
     uint64_t &getContextCompleteRef() const override;
 
@@ -139,6 +149,8 @@ class TagAllocatorBase {
 
     virtual void returnTag(TagNodeBase *node) = 0;
 
+    virtual void returnTags(ArrayRef<TagNodeBase *const> nodes) = 0;
+
     virtual TagNodeBase *getTag() = 0;
 
   protected:
@@ -181,6 +193,8 @@ class TagAllocator : public TagAllocatorBase {
 
     void returnTag(TagNodeBase *node) override;
 
+    void returnTags(ArrayRef<TagNodeBase *const> nodes) override;
+
   protected:
     TagAllocator() = delete;
 
@@ -128,6 +128,38 @@ void TagAllocator<TagType>::returnTag(TagNodeBase *node) {
     }
 }
 
+template <typename TagType>
+void TagAllocator<TagType>::returnTags(ArrayRef<TagNodeBase *const> nodes) {
+    StackVec<NodeType *, 32> releasedNodes;
+    for (auto node : nodes) {
+        if (node->refCountFetchSub(1) == 1) {
+            releasedNodes.push_back(static_cast<NodeType *>(node));
+        }
+    }
+    if (releasedNodes.empty()) {
+        return;
+    }
+
+    usedTags.removeMany(releasedNodes);
+
+    IDList<NodeType, false> pendingFreeTags;
+    IDList<NodeType, false> pendingDeferredTags;
+    for (auto node : releasedNodes) {
+        if (node->canBeReleased()) {
+            pendingFreeTags.pushFrontOne(*node);
+        } else {
+            pendingDeferredTags.pushFrontOne(*node);
+        }
+    }
+
+    if (!pendingFreeTags.peekIsEmpty()) {
+        freeTags.splice(*pendingFreeTags.detachNodes());
+    }
+    if (!pendingDeferredTags.peekIsEmpty()) {
+        deferredTags.splice(*pendingDeferredTags.detachNodes());
+    }
+}
+
 template <typename TagType>
 size_t TagNode<TagType>::getGlobalStartOffset() const {
     if constexpr (TagType::getTagNodeType() == TagNodeType::TimestampPacket) {
@@ -200,6 +232,24 @@ uint64_t TagNode<TagType>::getGlobalEndValue([[maybe_unused]] uint32_t packetInd
     }
 }
 
+template <typename TagType>
+bool TagNode<TagType>::isCompleted() const {
+    if constexpr (TagType::getTagNodeType() != TagNodeType::HwPerfCounter) {
+        return tagForCpuAccess->isCompleted(packetsUsed);
+    } else {
+        UNRECOVERABLE_IF(true);
+    }
+}
+
+template <typename TagType>
+void TagNode<TagType>::getGlobalStartEndRange([[maybe_unused]] uint64_t &globalStart, [[maybe_unused]] uint64_t &globalEnd) const {
+    if constexpr (TagType::getTagNodeType() != TagNodeType::HwPerfCounter) {
+        tagForCpuAccess->getGlobalStartEndRange(packetsUsed, globalStart, globalEnd);
+    } else {
+        UNRECOVERABLE_IF(true);
+    }
+}
+
 template <typename TagType>
 void const *TagNode<TagType>::getContextEndAddress([[maybe_unused]] uint32_t packetIndex) const {
     if constexpr (TagType::getTagNodeType() == TagNodeType::TimestampPacket) {
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/trace_points.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/helpers/string.h"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace NEO {
+namespace TracePoints {
+
+bool enabled = false;
+
+namespace {
+struct Rings;
+std::vector<Record> getRecords(Rings &rings);
+bool dump(Rings &rings, const char *fileName);
+
+struct ThreadRing {
+    std::array<Record, ringSize> records{};
+    std::atomic<uint64_t> writeIndex{0u};
+    uint32_t threadId = 0u;
+};
+
+struct Rings {
+    ~Rings() {
+        if (!dumpFile.empty()) {
+            dump(*this, dumpFile.c_str());
+        }
+    }
+
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadRing>> threadRings;
+    std::string dumpFile;
+};
+
+Rings &getRings() {
+    static Rings rings;
+    return rings;
+}
+
+thread_local ThreadRing *threadRing = nullptr;
+
+ThreadRing &getThreadRing() {
+    if (threadRing == nullptr) {
+        auto &rings = getRings();
+        auto newRing = std::make_unique<ThreadRing>();
+        threadRing = newRing.get();
+        std::lock_guard<std::mutex> lock(rings.mutex);
+        threadRing->threadId = static_cast<uint32_t>(rings.threadRings.size());
+        rings.threadRings.push_back(std::move(newRing));
+    }
+    return *threadRing;
+}
+
+// Records of each thread are returned oldest first, reading rings of running threads may capture records being overwritten
+std::vector<Record> getRecords(Rings &rings) {
+    std::vector<Record> records;
+    std::lock_guard<std::mutex> lock(rings.mutex);
+    for (auto &ring : rings.threadRings) {
+        auto writeIndex = ring->writeIndex.load(std::memory_order_acquire);
+        auto first = writeIndex > ringSize ? writeIndex - ringSize : 0u;
+        for (auto index = first; index < writeIndex; index++) {
+            records.push_back(ring->records[index % ringSize]);
+        }
+    }
+    return records;
+}
+
+bool dump(Rings &rings, const char *fileName) {
+    auto records = getRecords(rings);
+    DumpHeader header = {dumpMagic, dumpVersion, static_cast<uint32_t>(sizeof(Record)), static_cast<uint32_t>(records.size())};
+
+    std::vector<uint8_t> data(sizeof(DumpHeader) + records.size() * sizeof(Record));
+    memcpy_s(data.data(), data.size(), &header, sizeof(DumpHeader));
+    if (!records.empty()) {
+        memcpy_s(data.data() + sizeof(DumpHeader), data.size() - sizeof(DumpHeader), records.data(), records.size() * sizeof(Record));
+    }
+    return writeDataToFile(fileName, data.data(), data.size()) == data.size();
+}
+} // namespace
+
+void init() {
+    enabled = DebugManager.flags.EnableTracePoints.get() == 1;
+    std::string dumpFile = DebugManager.flags.TracePointsDumpFile.get();
+    if (enabled && dumpFile != "unk") {
+        auto &rings = getRings();
+        std::lock_guard<std::mutex> lock(rings.mutex);
+        rings.dumpFile = dumpFile;
+    }
+}
+
+void emit(Id id, uint64_t arg0, uint64_t arg1) {
+    auto &ring = getThreadRing();
+    auto index = ring.writeIndex.load(std::memory_order_relaxed);
+    auto &record = ring.records[index % ringSize];
+    record.timestampNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    record.arg0 = arg0;
+    record.arg1 = arg1;
+    record.threadId = ring.threadId;
+    record.id = static_cast<uint16_t>(id);
+    record.reserved = 0u;
+    ring.writeIndex.store(index + 1, std::memory_order_release);
+}
+
+std::vector<Record> getRecords() {
+    return getRecords(getRings());
+}
+
+bool dump(const char *fileName) {
+    return dump(getRings(), fileName);
+}
+
+} // namespace TracePoints
+} // namespace NEO
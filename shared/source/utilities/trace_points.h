@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define NEO_USDT_PROBE(name, arg0, arg1) DTRACE_PROBE2(neo, name, arg0, arg1)
+#endif
+#endif
+
+#ifndef NEO_USDT_PROBE
+#define NEO_USDT_PROBE(name, arg0, arg1)
+#endif
+
+namespace NEO {
+namespace TracePoints {
+enum class Id : uint16_t {
+    FlushTask,
+    ExecuteCommandLists,
+    AppendLaunchKernel,
+    MakeResident,
+    WaitForTaskCount,
+    Count
+};
+
+#pragma pack(1)
+struct Record {
+    uint64_t timestampNs;
+    uint64_t arg0;
+    uint64_t arg1;
+    uint32_t threadId;
+    uint16_t id;
+    uint16_t reserved;
+};
+#pragma pack()
+static_assert(32u == sizeof(Record), "Record is part of binary dump format");
+
+struct DumpHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t recordSize;
+    uint32_t recordsCount;
+};
+
+constexpr uint32_t dumpMagic = 0x5452454Eu; // "NERT"
+constexpr uint32_t dumpVersion = 1u;
+constexpr size_t ringSize = 4096u;
+
+extern bool enabled;
+
+void init();
+void emit(Id id, uint64_t arg0, uint64_t arg1);
+std::vector<Record> getRecords();
+bool dump(const char *fileName);
+} // namespace TracePoints
+} // namespace NEO
+
+// Static markers visible to perf and bpftrace as USDT probes (provider "neo") whenever sys/sdt.h is available.
+// When recording is disabled the only cost is a single branch on a global.
+#define TRACE_POINT(name, arg0, arg1)                                                                                    \
+    do {                                                                                                                 \
+        NEO_USDT_PROBE(name, arg0, arg1);                                                                                \
+        if (NEO::TracePoints::enabled) {                                                                                 \
+            NEO::TracePoints::emit(NEO::TracePoints::Id::name, static_cast<uint64_t>(arg0), static_cast<uint64_t>(arg1)); \
+        }                                                                                                                \
+    } while (0)
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021 Intel Corporation
+ * Copyright (C) 2021-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,18 +8,34 @@
 #include "shared/source/utilities/wait_util.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/utilities/cpu_info.h"
 
 namespace NEO {
 
 namespace WaitUtils {
 
 uint32_t waitCount = defaultWaitCount;
+bool adaptiveWaitEnabled = false;
+int64_t adaptiveWaitMaxSpinTime = defaultAdaptiveWaitMaxSpinTime;
+bool waitpkgEnabled = false;
+uint64_t waitpkgCounterValue = defaultWaitpkgCounterValue;
 
 void init() {
     int32_t overrideWaitCount = DebugManager.flags.WaitLoopCount.get();
     if (overrideWaitCount != -1) {
         waitCount = static_cast<uint32_t>(overrideWaitCount);
     }
+    adaptiveWaitEnabled = DebugManager.flags.EnableAdaptiveWaitPolicy.get() == 1;
+    int32_t overrideMaxSpinTime = DebugManager.flags.AdaptiveWaitMaxSpinTime.get();
+    if (overrideMaxSpinTime != -1) {
+        adaptiveWaitMaxSpinTime = static_cast<int64_t>(overrideMaxSpinTime);
+    }
+    waitpkgEnabled = DebugManager.flags.EnableWaitpkg.get() == 1 &&
+                     CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureWaitpkg);
+    int64_t overrideWaitpkgCounterValue = DebugManager.flags.WaitpkgCounterValue.get();
+    if (overrideWaitpkgCounterValue != -1) {
+        waitpkgCounterValue = static_cast<uint64_t>(overrideWaitpkgCounterValue);
+    }
 }
 
 } // namespace WaitUtils
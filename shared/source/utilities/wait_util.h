@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021 Intel Corporation
+ * Copyright (C) 2021-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,8 @@
 #pragma once
 #include "shared/source/utilities/cpuintrinsics.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <thread>
@@ -17,10 +19,25 @@ namespace NEO {
 namespace WaitUtils {
 
 constexpr uint32_t defaultWaitCount = 1u;
+constexpr int64_t defaultAdaptiveWaitMaxSpinTime = 50;
+constexpr uint64_t defaultWaitpkgCounterValue = 12000u;
+constexpr uint32_t waitpkgControlValue = 1u; // C0.1 - lower latency wake up
 extern uint32_t waitCount;
+extern bool waitpkgEnabled;
+extern uint64_t waitpkgCounterValue;
+extern bool adaptiveWaitEnabled;
+extern int64_t adaptiveWaitMaxSpinTime;
 
 template <typename T>
-inline bool waitFunctionWithPredicate(volatile T const *pollAddress, T expectedValue, std::function<bool(T, T)> predicate) {
+inline bool waitFunctionWithPredicate(volatile T const *pollAddress, T expectedValue, std::function<bool(T, T)> predicate, bool yieldCpu) {
+    if (waitpkgEnabled && pollAddress != nullptr) {
+        CpuIntrinsics::umonitor(const_cast<T const *>(pollAddress));
+        if (predicate(*pollAddress, expectedValue)) {
+            return true;
+        }
+        CpuIntrinsics::umwait(waitpkgControlValue, CpuIntrinsics::rdtsc() + waitpkgCounterValue);
+        return predicate(*pollAddress, expectedValue);
+    }
     for (uint32_t i = 0; i < waitCount; i++) {
         CpuIntrinsics::pause();
     }
@@ -29,14 +46,62 @@ inline bool waitFunctionWithPredicate(volatile T const *pollAddress, T expectedV
             return true;
         }
     }
-    std::this_thread::yield();
+    if (yieldCpu) {
+        std::this_thread::yield();
+    }
     return false;
 }
 
+template <typename T>
+inline bool waitFunctionWithPredicate(volatile T const *pollAddress, T expectedValue, std::function<bool(T, T)> predicate) {
+    return waitFunctionWithPredicate<T>(pollAddress, expectedValue, predicate, true);
+}
+
+inline bool waitFunction(volatile uint32_t *pollAddress, uint32_t expectedValue, bool yieldCpu) {
+    return waitFunctionWithPredicate<uint32_t>(pollAddress, expectedValue, std::greater_equal<uint32_t>(), yieldCpu);
+}
+
 inline bool waitFunction(volatile uint32_t *pollAddress, uint32_t expectedValue) {
-    return waitFunctionWithPredicate<uint32_t>(pollAddress, expectedValue, std::greater_equal<uint32_t>());
+    return waitFunction(pollAddress, expectedValue, true);
 }
 
+// Learns how long waits on a single submission queue usually take (in microseconds)
+// and allows spinning without yielding only while a wait is expected to complete soon.
+class AdaptiveWaitPolicy {
+  public:
+    static constexpr int64_t averageWeight = 8;
+
+    int64_t getSpinTime() const {
+        if (!adaptiveWaitEnabled) {
+            return 0;
+        }
+        if (numSamples.load(std::memory_order_relaxed) == 0u) {
+            return adaptiveWaitMaxSpinTime;
+        }
+        auto averageTime = averageWaitTime.load(std::memory_order_relaxed);
+        if (averageTime > adaptiveWaitMaxSpinTime) {
+            return 0;
+        }
+        return std::min(adaptiveWaitMaxSpinTime, 2 * averageTime);
+    }
+
+    void recordWaitTime(int64_t waitTime) {
+        if (numSamples.load(std::memory_order_relaxed) == 0u) {
+            averageWaitTime.store(waitTime, std::memory_order_relaxed);
+            numSamples.store(1u, std::memory_order_relaxed);
+            return;
+        }
+        auto averageTime = averageWaitTime.load(std::memory_order_relaxed);
+        averageWaitTime.store((averageTime * (averageWeight - 1) + waitTime) / averageWeight, std::memory_order_relaxed);
+    }
+
+    int64_t getAverageWaitTime() const { return averageWaitTime.load(std::memory_order_relaxed); }
+
+  protected:
+    std::atomic<int64_t> averageWaitTime{0};
+    std::atomic<uint32_t> numSamples{0u};
+};
+
 void init();
 } // namespace WaitUtils
 
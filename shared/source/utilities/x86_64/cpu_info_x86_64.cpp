@@ -30,6 +30,9 @@ void CpuInfo::detect() const {
             auto mask = BIT(5) | BIT(3) | BIT(8);
             features |= (cpuInfo[1] & mask) == mask ? featureAvX2 : featureNone;
         }
+        {
+            features |= cpuInfo[2] & BIT(5) ? featureWaitpkg : featureNone;
+        }
     }
 
     cpuid(cpuInfo, 0x80000000);
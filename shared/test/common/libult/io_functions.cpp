@@ -18,6 +18,7 @@ ftellFuncPtr ftellPtr = &mockFtell;
 rewindFuncPtr rewindPtr = &mockRewind;
 freadFuncPtr freadPtr = &mockFread;
 fwriteFuncPtr fwritePtr = &mockFwrite;
+getEnvironmentFuncPtr getEnvironmentPtr = &mockGetEnvironment;
 
 uint32_t mockFopenCalled = 0;
 FILE *mockFopenReturned = reinterpret_cast<FILE *>(0x40);
@@ -25,6 +26,7 @@ uint32_t failAfterNFopenCount = 0;
 uint32_t mockVfptrinfCalled = 0;
 uint32_t mockFcloseCalled = 0;
 uint32_t mockGetenvCalled = 0;
+uint32_t mockGetEnvironmentCalled = 0;
 uint32_t mockFseekCalled = 0;
 uint32_t mockFtellCalled = 0;
 long int mockFtellReturn = 0;
@@ -39,6 +39,7 @@ class DrmMock : public Drm {
     using Drm::ioctlHelper;
     using Drm::memoryInfo;
     using Drm::nonPersistentContextsSupported;
+    using Drm::numaNode;
     using Drm::pageFaultSupported;
     using Drm::pagingFence;
     using Drm::preemptionSupported;
@@ -15,6 +15,8 @@ using namespace NEO;
 class MockPrefetchManager : public PrefetchManager {
   public:
     using PrefetchManager::allocations;
+    using PrefetchManager::indirectSharedAccessByKernel;
+    using PrefetchManager::kernelAccessedAllocations;
 
     void migrateAllocationsToGpu(SVMAllocsManager &unifiedMemoryManager, Device &device) override {
         PrefetchManager::migrateAllocationsToGpu(unifiedMemoryManager, device);
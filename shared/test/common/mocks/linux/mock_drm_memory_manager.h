@@ -87,6 +87,7 @@ class TestedDrmMemoryManager : public MemoryManagerCreate<DrmMemoryManager> {
     using DrmMemoryManager::lockBufferObject;
     using DrmMemoryManager::lockResourceImpl;
     using DrmMemoryManager::memoryForPinBBs;
+    using DrmMemoryManager::madviseFunction;
     using DrmMemoryManager::mmapFunction;
     using DrmMemoryManager::munmapFunction;
     using DrmMemoryManager::pinBBs;
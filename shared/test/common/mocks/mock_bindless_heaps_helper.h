@@ -29,6 +29,7 @@ class MockBindlesHeapsHelper : public BindlessHeapsHelper {
     using BaseClass::ssHeapsAllocations;
     using BaseClass::surfaceStateHeaps;
     using BaseClass::surfaceStateInHeapAllocationMap;
+    using BaseClass::surfaceStateInHeapPendingReuse;
     using BaseClass::surfaceStateInHeapVectorReuse;
 
     IndirectHeap *specialSsh;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -20,6 +20,7 @@ namespace NEO {
 
 class MockCompilerInterface : public CompilerInterface {
   public:
+    using CompilerInterface::cache;
     using CompilerInterface::fclDeviceContexts;
     using CompilerInterface::initialize;
     using CompilerInterface::isCompilerAvailable;
@@ -182,6 +183,7 @@ struct MockCompilerInterfaceCaptureBuildOptions : CompilerInterface {
         if ((input.internalOptions.size() > 0) && (input.internalOptions.begin() != nullptr)) {
             buildInternalOptions.assign(input.internalOptions.begin(), input.internalOptions.end());
         }
+        allowCaching = input.allowCaching;
         return TranslationOutput::ErrorCode::Success;
     }
 
@@ -197,5 +199,6 @@ struct MockCompilerInterfaceCaptureBuildOptions : CompilerInterface {
 
     std::string buildOptions;
     std::string buildInternalOptions;
+    bool allowCaching = false;
 };
 } // namespace NEO
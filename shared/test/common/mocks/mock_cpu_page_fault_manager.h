@@ -37,9 +37,10 @@ class MockPageFaultManager : public PageFaultManager {
         transferToCpuAddress = ptr;
         transferToCpuSize = size;
     }
-    void transferToGpu(void *ptr, void *cmdQ) override {
+    void transferToGpu(void *ptr, size_t size, void *cmdQ) override {
         transferToGpuCalled++;
         transferToGpuAddress = ptr;
+        transferToGpuSize = size;
     }
     void setAubWritable(bool writable, void *ptr, SVMAllocsManager *unifiedMemoryManager) override {
         isAubWritable = writable;
@@ -50,10 +51,17 @@ class MockPageFaultManager : public PageFaultManager {
     void baseCpuTransfer(void *ptr, size_t size, void *cmdQ) {
         PageFaultManager::transferToCpu(ptr, size, cmdQ);
     }
-    void baseGpuTransfer(void *ptr, void *cmdQ) {
-        PageFaultManager::transferToGpu(ptr, cmdQ);
+    void baseGpuTransfer(void *ptr, size_t size, void *cmdQ) {
+        PageFaultManager::transferToGpu(ptr, size, cmdQ);
     }
     void evictMemoryAfterImplCopy(GraphicsAllocation *allocation, Device *device) override {}
+    bool checkFaultHandlerFromPageFaultManager() override {
+        checkFaultHandlerCalled++;
+        return isFaultHandlerFromPageFaultManager;
+    }
+    void registerFaultHandler() override {
+        registerFaultHandlerCalled++;
+    }
 
     void *getHwHandlerAddress() {
         return reinterpret_cast<void *>(PageFaultManager::handleGpuDomainTransferForHw);
@@ -72,14 +80,18 @@ class MockPageFaultManager : public PageFaultManager {
     int transferToCpuCalled = 0;
     int transferToGpuCalled = 0;
     int moveAllocationToGpuDomainCalled = 0;
+    int checkFaultHandlerCalled = 0;
+    int registerFaultHandlerCalled = 0;
     void *transferToCpuAddress = nullptr;
     void *transferToGpuAddress = nullptr;
     void *allowedMemoryAccessAddress = nullptr;
     void *protectedMemoryAccessAddress = nullptr;
     size_t transferToCpuSize = 0;
+    size_t transferToGpuSize = 0;
     size_t accessAllowedSize = 0;
     size_t protectedSize = 0;
     bool isAubWritable = true;
+    bool isFaultHandlerFromPageFaultManager = true;
 };
 
 template <class T>
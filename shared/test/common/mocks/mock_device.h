@@ -62,6 +62,7 @@ class MockDevice : public RootDevice {
     using Device::isDebuggerActive;
     using Device::regularEngineGroups;
     using Device::rootCsrCreated;
+    using Device::rtDispatchGlobalsInfos;
     using Device::rtMemoryBackedBuffer;
     using RootDevice::createEngines;
     using RootDevice::defaultEngineIndex;
@@ -30,6 +30,7 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::dispatchDisablePrefetcher;
     using BaseClass::dispatchPartitionRegisterConfiguration;
     using BaseClass::dispatchPrefetchMitigation;
+    using BaseClass::dispatchRingDependenciesSection;
     using BaseClass::dispatchSemaphoreSection;
     using BaseClass::dispatchStartSection;
     using BaseClass::dispatchSwitchRingBufferSection;
@@ -41,6 +42,7 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::getSizeEnd;
     using BaseClass::getSizePartitionRegisterConfigurationSection;
     using BaseClass::getSizePrefetchMitigation;
+    using BaseClass::getSizeRingDependenciesSection;
     using BaseClass::getSizeSemaphoreSection;
     using BaseClass::getSizeStartSection;
     using BaseClass::getSizeSwitchRingBufferSection;
@@ -63,6 +65,7 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::setReturnAddress;
     using BaseClass::startRingBuffer;
     using BaseClass::stopRingBuffer;
+    using BaseClass::switchRingBuffers;
     using BaseClass::switchRingBuffersAllocations;
     using BaseClass::systemMemoryFenceAddressSet;
     using BaseClass::useNotifyForPostSync;
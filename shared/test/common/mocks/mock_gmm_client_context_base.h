@@ -28,6 +28,7 @@ class MockGmmClientContextBase : public GmmClientContext {
 
     GMM_RESOURCE_FORMAT capturedFormat = GMM_FORMAT_INVALID;
     uint8_t compressionFormatToReturn = 1;
+    uint32_t cachePolicyGetMemoryObjectCalled = 0u;
     uint32_t getSurfaceStateCompressionFormatCalled = 0u;
     uint32_t getMediaSurfaceStateCompressionFormatCalled = 0u;
     bool returnErrorOnPatIndexQuery = false;
@@ -42,8 +42,8 @@ class MockGraphicsAllocation : public MemoryAllocation {
         : MemoryAllocation(rootDeviceIndex, AllocationType::UNKNOWN, buffer, castToUint64(buffer), 0llu, sizeIn, MemoryPool::MemoryNull, MemoryManager::maxOsContextCount) {}
 
     void resetInspectionIds() {
-        for (auto &usageInfo : usageInfos) {
-            usageInfo.inspectionId = 0u;
+        for (auto &inspectionId : inspectionIds) {
+            inspectionId = 0u;
         }
     }
 
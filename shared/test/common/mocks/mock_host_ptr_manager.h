@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,6 +15,6 @@ class MockHostPtrManager : public HostPtrManager {
     using HostPtrManager::getAllocationRequirements;
     using HostPtrManager::getFragmentAndCheckForOverlaps;
     using HostPtrManager::populateAlreadyAllocatedFragments;
-    size_t getFragmentCount() { return partialAllocations.size(); }
+    size_t getFragmentCount() { return getFragmentsCount(); }
 };
 } // namespace NEO
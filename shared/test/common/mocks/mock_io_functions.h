@@ -11,6 +11,7 @@
 #include <cstdint>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace NEO {
 namespace IoFunctions {
@@ -20,6 +21,7 @@ extern FILE *mockFopenReturned;
 extern uint32_t mockVfptrinfCalled;
 extern uint32_t mockFcloseCalled;
 extern uint32_t mockGetenvCalled;
+extern uint32_t mockGetEnvironmentCalled;
 extern uint32_t mockFseekCalled;
 extern uint32_t mockFtellCalled;
 extern long int mockFtellReturn;
@@ -61,6 +63,24 @@ inline char *mockGetenv(const char *name) noexcept {
     return nullptr;
 }
 
+inline char **mockGetEnvironment() {
+    mockGetEnvironmentCalled++;
+    static std::vector<std::string> entries;
+    static std::vector<char *> environment;
+    entries.clear();
+    environment.clear();
+    if (mockableEnvValues != nullptr) {
+        for (const auto &[name, value] : *mockableEnvValues) {
+            entries.push_back(name + "=" + value);
+        }
+    }
+    for (auto &entry : entries) {
+        environment.push_back(entry.data());
+    }
+    environment.push_back(nullptr);
+    return environment.data();
+}
+
 inline int mockFseek(FILE *stream, long int offset, int origin) {
     mockFseekCalled++;
     return 0;
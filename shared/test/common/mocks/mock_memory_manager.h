@@ -47,6 +47,7 @@ class MockMemoryManager : public MemoryManagerCreate<OsAgnosticMemoryManager> {
     using MemoryManager::prefetchManager;
     using MemoryManager::registeredEngines;
     using MemoryManager::supportsMultiStorageResources;
+    using MemoryManager::tilePlacementPolicies;
     using MemoryManager::useNonSvmHostPtrAlloc;
     using OsAgnosticMemoryManager::allocateGraphicsMemoryForImageFromHostPtr;
     using MemoryManagerCreate<OsAgnosticMemoryManager>::MemoryManagerCreate;
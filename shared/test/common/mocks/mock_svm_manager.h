@@ -18,5 +18,9 @@ struct MockSVMAllocsManager : public SVMAllocsManager {
     using SVMAllocsManager::svmMapOperations;
     using SVMAllocsManager::usmDeviceAllocationsCache;
     using SVMAllocsManager::usmDeviceAllocationsCacheEnabled;
+    using SVMAllocsManager::usmHostAllocationsCache;
+    using SVMAllocsManager::usmHostAllocationsCacheEnabled;
+    using SVMAllocsManager::usmSharedAllocationsCache;
+    using SVMAllocsManager::usmSharedAllocationsCacheEnabled;
 };
 } // namespace NEO
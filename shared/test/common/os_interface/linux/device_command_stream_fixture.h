@@ -97,6 +97,7 @@ class DrmMockCustom : public Drm {
     using Drm::cacheInfo;
     using Drm::completionFenceSupported;
     using Drm::memoryInfo;
+    using Drm::numaNode;
     using Drm::setupIoctlHelper;
 
     struct IoctlResExt {
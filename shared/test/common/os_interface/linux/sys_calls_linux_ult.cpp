@@ -50,6 +50,7 @@ int (*sysCallsReadlink)(const char *path, char *buf, size_t bufsize) = nullptr;
 int (*sysCallsIoctl)(int fileDescriptor, unsigned long int request, void *arg) = nullptr;
 int (*sysCallsPoll)(struct pollfd *pollFd, unsigned long int numberOfFds, int timeout) = nullptr;
 ssize_t (*sysCallsRead)(int fd, void *buf, size_t count) = nullptr;
+long (*sysCallsMbind)(void *addr, unsigned long len, int mode, const unsigned long *nodemask, unsigned long maxnode, unsigned int flags) = nullptr;
 
 int close(int fileDescriptor) {
     closeFuncCalled++;
@@ -191,5 +192,12 @@ ssize_t read(int fd, void *buf, size_t count) {
     return 0;
 }
 
+long mbind(void *addr, unsigned long len, int mode, const unsigned long *nodemask, unsigned long maxnode, unsigned int flags) {
+    if (sysCallsMbind != nullptr) {
+        return sysCallsMbind(addr, len, mode, nodemask, maxnode, flags);
+    }
+    return 0;
+}
+
 } // namespace SysCalls
 } // namespace NEO
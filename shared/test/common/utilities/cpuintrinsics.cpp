@@ -11,6 +11,7 @@
 
 #include <atomic>
 #include <cstdint>
+#include <cstring>
 #include <functional>
 
 namespace CpuIntrinsicsTests {
@@ -19,6 +20,13 @@ std::atomic<uintptr_t> lastClFlushedPtr(0u);
 std::atomic<uint32_t> clFlushCounter(0u);
 std::atomic<uint32_t> pauseCounter(0u);
 std::atomic<uint32_t> sfenceCounter(0u);
+std::atomic<uintptr_t> lastUmonitorPtr(0u);
+std::atomic<uint32_t> umonitorCounter(0u);
+std::atomic<uint32_t> umwaitCounter(0u);
+std::atomic<uint64_t> lastUmwaitCounterValue(0u);
+std::atomic<uint32_t> nonTemporalFillCounter(0u);
+std::atomic<uint32_t> nonTemporalCopyCounter(0u);
+uint64_t rdtscRetValue = 0u;
 
 volatile uint32_t *pauseAddress = nullptr;
 uint32_t pauseValue = 0u;
@@ -51,5 +59,33 @@ void pause() {
     }
 }
 
+void umonitor(void const *address) {
+    CpuIntrinsicsTests::umonitorCounter++;
+    CpuIntrinsicsTests::lastUmonitorPtr = reinterpret_cast<uintptr_t>(address);
+}
+
+uint8_t umwait(uint32_t control, uint64_t counter) {
+    CpuIntrinsicsTests::umwaitCounter++;
+    CpuIntrinsicsTests::lastUmwaitCounterValue = counter;
+    return 0;
+}
+
+uint64_t rdtsc() {
+    return CpuIntrinsicsTests::rdtscRetValue;
+}
+
+void nonTemporalFill(void *dst, uint64_t pattern, size_t size) {
+    CpuIntrinsicsTests::nonTemporalFillCounter++;
+    auto qwords = static_cast<uint64_t *>(dst);
+    for (size_t i = 0; i < size / sizeof(uint64_t); i++) {
+        qwords[i] = pattern;
+    }
+}
+
+void nonTemporalCopy(void *dst, const void *src, size_t size) {
+    CpuIntrinsicsTests::nonTemporalCopyCounter++;
+    memcpy(dst, src, size);
+}
+
 } // namespace CpuIntrinsics
 } // namespace NEO
@@ -6,10 +6,14 @@
  */
 
 #include "shared/source/ail/ail_configuration.h"
+#include "shared/source/utilities/debug_file_reader.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
 #include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
+#include <sstream>
+
 namespace NEO {
 using IsSKL = IsProduct<IGFX_SKYLAKE>;
 using IsDG2 = IsProduct<IGFX_DG2>;
@@ -23,6 +27,14 @@ class AILMock : public AILConfigurationHw<productFamily> {
     using AILConfiguration::sourcesContainKernel;
 };
 
+class MockProfileReader : public SettingsFileReader {
+  public:
+    MockProfileReader(const std::string &profile) : SettingsFileReader("") {
+        std::stringstream profileStream(profile);
+        parseStream(profileStream);
+    }
+};
+
 HWTEST2_F(AILTests, givenUninitializedTemplateWhenGetAILConfigurationThenNullptrIsReturned, IsSKL) {
     auto ailConfiguration = AILConfiguration::get(productFamily);
 
@@ -179,4 +191,28 @@ HWTEST2_F(AILTests, whenModifyKernelIfRequiredIsCalledThenDontChangeKernelSource
     EXPECT_STREQ(copyKernel.c_str(), kernelSources.c_str());
 }
 
+HWTEST2_F(AILTests, givenPerformanceProfileWhenApplyingItThenOnlySettingsNotSetExplicitlyAreChanged, IsAtLeastGen12lp) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableHostUsmAllocationCache.set(0);
+
+    AILMock<productFamily> ail;
+    MockProfileReader profileReader("DirectSubmissionControllerTimeout = 1000\nEnableHostUsmAllocationCache = 1\n");
+    ail.applyPerformanceProfile(profileReader);
+
+    EXPECT_EQ(1000, DebugManager.flags.DirectSubmissionControllerTimeout.get());
+    EXPECT_EQ(0, DebugManager.flags.EnableHostUsmAllocationCache.get());
+    EXPECT_EQ(-1, DebugManager.flags.OverrideTimestampPacketSize.get());
+}
+
+HWTEST2_F(AILTests, givenNoPerformanceProfileForProcessWhenApplyingPerformanceProfileThenSettingsAreNotChanged, IsAtLeastGen12lp) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.AILPerformanceProfilesDirectory.set("nonExistingDirectory");
+
+    AILMock<productFamily> ail;
+    ail.processName = "application";
+    ail.applyPerformanceProfile();
+
+    EXPECT_EQ(-1, DebugManager.flags.DirectSubmissionControllerTimeout.get());
+}
+
 } // namespace NEO
@@ -236,6 +236,59 @@ TEST_F(CommandContainerTest, givenCmdContainerWithAllocsListWhenAllocateAndReset
     allocList.freeAllGraphicsAllocations(pDevice);
 }
 
+TEST_F(CommandContainerTest, givenLocalCmdBufferCacheEnabledWhenAllocateAndResetThenCmdBufferAllocIsReusedWithoutAllocsList) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.CommandContainerLocalCmdBufferCacheSize.set(1);
+
+    AllocationsList allocList;
+    auto cmdContainer = std::make_unique<CommandContainer>();
+    cmdContainer->initialize(pDevice, &allocList, true);
+    auto &cmdBufferAllocs = cmdContainer->getCmdBufferAllocations();
+    auto memoryManager = static_cast<MockMemoryManager *>(pDevice->getMemoryManager());
+
+    cmdContainer->allocateNextCommandBuffer();
+    cmdContainer->allocateNextCommandBuffer();
+    EXPECT_EQ(cmdBufferAllocs.size(), 3u);
+    auto cmdBuffer1 = cmdBufferAllocs[1];
+    auto cmdBuffer2 = cmdBufferAllocs[2];
+
+    cmdContainer->reset();
+    EXPECT_EQ(memoryManager->handleFenceCompletionCalled, 2u);
+    EXPECT_EQ(cmdBufferAllocs.size(), 1u);
+    ASSERT_EQ(cmdContainer->getLocalCmdBufferAllocations().size(), 1u);
+    EXPECT_EQ(cmdContainer->getLocalCmdBufferAllocations()[0], cmdBuffer1);
+    EXPECT_EQ(allocList.peekHead(), cmdBuffer2);
+    EXPECT_EQ(allocList.peekHead()->next, nullptr);
+
+    cmdContainer->allocateNextCommandBuffer();
+    EXPECT_EQ(cmdBufferAllocs[1], cmdBuffer1);
+    EXPECT_TRUE(cmdContainer->getLocalCmdBufferAllocations().empty());
+    EXPECT_EQ(allocList.peekHead(), cmdBuffer2);
+
+    cmdContainer->reset();
+    EXPECT_EQ(cmdContainer->getLocalCmdBufferAllocations().size(), 1u);
+
+    cmdContainer.reset();
+    EXPECT_FALSE(allocList.peekIsEmpty());
+    EXPECT_TRUE(allocList.peekContains(*cmdBuffer1));
+    EXPECT_TRUE(allocList.peekContains(*cmdBuffer2));
+    allocList.freeAllGraphicsAllocations(pDevice);
+}
+
+TEST_F(CommandContainerTest, givenLocalCmdBufferCacheEnabledAndNoAllocsListWhenResetThenCmdBufferAllocIsNotCached) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.CommandContainerLocalCmdBufferCacheSize.set(1);
+
+    CommandContainer cmdContainer;
+    cmdContainer.initialize(pDevice, nullptr, true);
+    cmdContainer.allocateNextCommandBuffer();
+    EXPECT_EQ(cmdContainer.getCmdBufferAllocations().size(), 2u);
+
+    cmdContainer.reset();
+    EXPECT_EQ(cmdContainer.getCmdBufferAllocations().size(), 1u);
+    EXPECT_TRUE(cmdContainer.getLocalCmdBufferAllocations().empty());
+}
+
 TEST_F(CommandContainerTest, givenReusableAllocationsAndRemoveUserFenceInCmdlistResetAndDestroyFlagWhenAllocateAndResetThenHandleFenceCompletionIsNotCalled) {
     DebugManagerStateRestore restore;
     DebugManager.flags.RemoveUserFenceInCmdlistResetAndDestroy.set(1);
@@ -853,3 +906,80 @@ TEST_F(CommandContainerTest, GivenCmdContainerWhenContainerIsInitializedThenSurf
     constexpr size_t expectedHeapSize = MemoryConstants::pageSize64k;
     EXPECT_EQ(expectedHeapSize, size);
 }
+
+TEST_F(CommandContainerTest, givenHeapStateDeduplicationEnabledWhenSameStateIsAddedThenItIsFoundUntilContainerIsReset) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.EnableHeapStateDeduplication.set(1);
+
+    CommandContainer cmdContainer;
+    cmdContainer.initialize(pDevice, nullptr, true);
+    EXPECT_TRUE(cmdContainer.isHeapStateDeduplicationEnabled());
+
+    uint8_t stateData[64] = {1, 2, 3};
+    uint8_t otherStateData[64] = {3, 2, 1};
+    EXPECT_EQ(CommandContainer::noDeduplicatedHeapState, cmdContainer.findDeduplicatedHeapState(HeapType::SURFACE_STATE, stateData, sizeof(stateData), 0u));
+
+    cmdContainer.addDeduplicatedHeapState(HeapType::SURFACE_STATE, stateData, sizeof(stateData), 0u, 0x80u);
+    EXPECT_EQ(0x80u, cmdContainer.findDeduplicatedHeapState(HeapType::SURFACE_STATE, stateData, sizeof(stateData), 0u));
+    EXPECT_EQ(CommandContainer::noDeduplicatedHeapState, cmdContainer.findDeduplicatedHeapState(HeapType::SURFACE_STATE, stateData, sizeof(stateData), 1u));
+    EXPECT_EQ(CommandContainer::noDeduplicatedHeapState, cmdContainer.findDeduplicatedHeapState(HeapType::SURFACE_STATE, otherStateData, sizeof(otherStateData), 0u));
+    EXPECT_EQ(CommandContainer::noDeduplicatedHeapState, cmdContainer.findDeduplicatedHeapState(HeapType::INDIRECT_OBJECT, stateData, sizeof(stateData), 0u));
+
+    cmdContainer.reset();
+    EXPECT_EQ(CommandContainer::noDeduplicatedHeapState, cmdContainer.findDeduplicatedHeapState(HeapType::SURFACE_STATE, stateData, sizeof(stateData), 0u));
+}
+
+TEST_F(CommandContainerTest, givenHeapStateDeduplicationEnabledWhenHeapAllocationIsReplacedThenPreviouslyAddedStateIsNotFound) {
+    CommandContainer cmdContainer;
+    cmdContainer.initialize(pDevice, nullptr, true);
+    cmdContainer.setHeapStateDeduplicationEnabled(true);
+
+    uint8_t stateData[64] = {1, 2, 3};
+    cmdContainer.addDeduplicatedHeapState(HeapType::SURFACE_STATE, stateData, sizeof(stateData), 0u, 0x80u);
+    EXPECT_EQ(0x80u, cmdContainer.findDeduplicatedHeapState(HeapType::SURFACE_STATE, stateData, sizeof(stateData), 0u));
+
+    auto heap = cmdContainer.getIndirectHeap(HeapType::SURFACE_STATE);
+    auto heapAllocation = heap->getGraphicsAllocation();
+    cmdContainer.getHeapWithRequiredSizeAndAlignment(HeapType::SURFACE_STATE, heap->getMaxAvailableSpace() + 1, 0);
+    EXPECT_NE(heapAllocation, heap->getGraphicsAllocation());
+    EXPECT_EQ(CommandContainer::noDeduplicatedHeapState, cmdContainer.findDeduplicatedHeapState(HeapType::SURFACE_STATE, stateData, sizeof(stateData), 0u));
+}
+
+TEST_F(CommandContainerTest, givenHeapStateDeduplicationDisabledWhenStateIsAddedThenItIsNotFound) {
+    CommandContainer cmdContainer;
+    cmdContainer.initialize(pDevice, nullptr, true);
+    EXPECT_FALSE(cmdContainer.isHeapStateDeduplicationEnabled());
+
+    uint8_t stateData[64] = {1, 2, 3};
+    cmdContainer.addDeduplicatedHeapState(HeapType::SURFACE_STATE, stateData, sizeof(stateData), 0u, 0x80u);
+    EXPECT_EQ(CommandContainer::noDeduplicatedHeapState, cmdContainer.findDeduplicatedHeapState(HeapType::SURFACE_STATE, stateData, sizeof(stateData), 0u));
+}
+
+TEST_F(CommandContainerTest, givenResizeRolledOverHeapsEnabledWhenHeapRolledOverDuringRecordingThenHeapIsReallocatedWithSizeOfWholeRecordingOnReset) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.ResizeRolledOverCommandListHeaps.set(1);
+
+    CommandContainer cmdContainer;
+    cmdContainer.initialize(pDevice, nullptr, true);
+
+    for (auto heapType : {HeapType::INDIRECT_OBJECT, HeapType::SURFACE_STATE}) {
+        auto heap = cmdContainer.getIndirectHeap(heapType);
+        heap->getSpace(heap->getAvailableSpace());
+        cmdContainer.getHeapWithRequiredSizeAndAlignment(heapType, MemoryConstants::pageSize, 0)->getSpace(MemoryConstants::pageSize);
+    }
+    auto sshSize = cmdContainer.getIndirectHeap(HeapType::SURFACE_STATE)->getGraphicsAllocation()->getUnderlyingBufferSize();
+    auto iohSize = cmdContainer.getIndirectHeap(HeapType::INDIRECT_OBJECT)->getGraphicsAllocation()->getUnderlyingBufferSize();
+
+    cmdContainer.reset();
+
+    auto ioh = cmdContainer.getIndirectHeap(HeapType::INDIRECT_OBJECT);
+    EXPECT_LE(iohSize + MemoryConstants::pageSize, ioh->getMaxAvailableSpace());
+    EXPECT_EQ(ioh->getGraphicsAllocation(), cmdContainer.getIndirectHeapAllocation(HeapType::INDIRECT_OBJECT));
+    auto &residencyContainer = cmdContainer.getResidencyContainer();
+    EXPECT_NE(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), ioh->getGraphicsAllocation()));
+    EXPECT_EQ(sshSize, cmdContainer.getIndirectHeap(HeapType::SURFACE_STATE)->getGraphicsAllocation()->getUnderlyingBufferSize());
+
+    auto iohAllocation = ioh->getGraphicsAllocation();
+    cmdContainer.reset();
+    EXPECT_EQ(iohAllocation, cmdContainer.getIndirectHeap(HeapType::INDIRECT_OBJECT)->getGraphicsAllocation());
+}
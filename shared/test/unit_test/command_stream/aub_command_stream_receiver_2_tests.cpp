@@ -824,6 +824,34 @@ HWTEST_F(AubCommandStreamReceiverTests, givenAubCommandStreamReceiverWhenWriteMe
     memoryManager->freeGraphicsMemory(gfxAllocation);
 }
 
+HWTEST_F(AubCommandStreamReceiverTests, givenDefaultSettingsWhenCheckingIfPageWriteIsRequiredThenEveryPageIsWritten) {
+    auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>("", false, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    uint8_t page[MemoryConstants::pageSize] = {};
+
+    EXPECT_TRUE(aubCsr->isPageWriteRequired(0x1000, page, sizeof(page), 0u));
+    EXPECT_TRUE(aubCsr->isPageWriteRequired(0x1000, page, sizeof(page), 0u));
+}
+
+HWTEST_F(AubCommandStreamReceiverTests, givenSkipUnchangedPagesEnabledWhenCheckingIfPageWriteIsRequiredThenOnlyChangedPagesAreWritten) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.AUBDumpSkipUnchangedPages.set(1);
+
+    auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>("", false, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    uint8_t page[MemoryConstants::pageSize] = {};
+
+    EXPECT_TRUE(aubCsr->isPageWriteRequired(0x1000, page, sizeof(page), 0u));
+    EXPECT_FALSE(aubCsr->isPageWriteRequired(0x1000, page, sizeof(page), 0u));
+    EXPECT_TRUE(aubCsr->isPageWriteRequired(0x2000, page, sizeof(page), 0u));
+
+    page[100] = 1u;
+    EXPECT_TRUE(aubCsr->isPageWriteRequired(0x1000, page, sizeof(page), 0u));
+    EXPECT_FALSE(aubCsr->isPageWriteRequired(0x1000, page, sizeof(page), 0u));
+
+    EXPECT_TRUE(aubCsr->isPageWriteRequired(0x1000, page, sizeof(page), 1u));
+    EXPECT_TRUE(aubCsr->isPageWriteRequired(0x1000, page, sizeof(page) / 2, 1u));
+    EXPECT_TRUE(aubCsr->isPageWriteRequired(0x1000, nullptr, sizeof(page) / 2, 1u));
+}
+
 HWTEST_F(AubCommandStreamReceiverTests, whenAubCommandStreamReceiverIsCreatedThenPPGTTAndGGTTCreatedHavePhysicalAddressAllocatorSet) {
     auto aubCsr = std::make_unique<AUBCommandStreamReceiverHw<FamilyType>>("", false, *pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
     ASSERT_NE(nullptr, aubCsr->ppgtt.get());
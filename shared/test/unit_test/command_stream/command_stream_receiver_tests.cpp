@@ -7,22 +7,27 @@
 
 #include "shared/source/command_container/implicit_scaling.h"
 #include "shared/source/command_stream/command_stream_receiver_simulated_hw.h"
+#include "shared/source/command_stream/gpu_hang_dump.h"
 #include "shared/source/command_stream/wait_status.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/gmm_helper/page_table_mngr.h"
 #include "shared/source/helpers/api_specific_config.h"
+#include "shared/source/helpers/file_io.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/surface.h"
 #include "shared/source/os_interface/device_factory.h"
 #include "shared/source/os_interface/hw_info_config.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/os_interface/sys_calls_common.h"
 #include "shared/source/utilities/tag_allocator.h"
+#include "shared/source/utilities/wait_util.h"
 #include "shared/test/common/fixtures/command_stream_receiver_fixture.inl"
 #include "shared/test/common/fixtures/device_fixture.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/engine_descriptor_helper.h"
 #include "shared/test/common/helpers/gtest_helpers.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
+#include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/mocks/mock_allocation_properties.h"
 #include "shared/test/common/mocks/mock_csr.h"
 #include "shared/test/common/mocks/mock_driver_model.h"
@@ -206,6 +211,53 @@ HWTEST_F(CommandStreamReceiverTest, givenDisableGpuHangDetectionFlagWhenChecking
     EXPECT_FALSE(csr.isGpuHangDetected());
 }
 
+HWTEST_F(CommandStreamReceiverTest, givenGpuHangWhenRecoveringFromGpuHangThenSubmittedTasksAreCompletedAndStatesAreProgrammedAgain) {
+    auto driverModelMock = std::make_unique<MockDriverModel>();
+    driverModelMock->isGpuHangDetectedToReturn = true;
+
+    auto osInterface = std::make_unique<OSInterface>();
+    osInterface->setDriverModel(std::move(driverModelMock));
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.executionEnvironment.rootDeviceEnvironments[csr.rootDeviceIndex]->osInterface = std::move(osInterface);
+
+    *csr.tagAddress = 3u;
+    csr.taskCount = 5u;
+    csr.latestFlushedTaskCount = 4u;
+    csr.isPreambleSent = true;
+    csr.mediaVfeStateDirty = false;
+    csr.setGSBAStateDirty(false);
+    csr.lastPreemptionMode = PreemptionMode::MidThread;
+
+    EXPECT_TRUE(csr.recoverFromGpuHang());
+    EXPECT_EQ(5u, *csr.tagAddress);
+    EXPECT_EQ(5u, csr.peekLatestFlushedTaskCount());
+    EXPECT_EQ(5u, csr.peekLatestSentTaskCount());
+    EXPECT_FALSE(csr.isPreambleSent);
+    EXPECT_TRUE(csr.mediaVfeStateDirty);
+    EXPECT_TRUE(csr.getGSBAStateDirty());
+    EXPECT_EQ(PreemptionMode::Initial, csr.lastPreemptionMode);
+}
+
+HWTEST_F(CommandStreamReceiverTest, givenNoGpuHangWhenRecoveringFromGpuHangThenNothingIsChanged) {
+    auto driverModelMock = std::make_unique<MockDriverModel>();
+    driverModelMock->isGpuHangDetectedToReturn = false;
+
+    auto osInterface = std::make_unique<OSInterface>();
+    osInterface->setDriverModel(std::move(driverModelMock));
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.executionEnvironment.rootDeviceEnvironments[csr.rootDeviceIndex]->osInterface = std::move(osInterface);
+
+    *csr.tagAddress = 3u;
+    csr.taskCount = 5u;
+    csr.isPreambleSent = true;
+
+    EXPECT_FALSE(csr.recoverFromGpuHang());
+    EXPECT_EQ(3u, *csr.tagAddress);
+    EXPECT_TRUE(csr.isPreambleSent);
+}
+
 HWTEST_F(CommandStreamReceiverTest, givenGpuHangWhenWaititingForCompletionWithTimeoutThenGpuHangIsReturned) {
     auto driverModelMock = std::make_unique<MockDriverModel>();
     driverModelMock->isGpuHangDetectedToReturn = true;
@@ -230,6 +282,51 @@ HWTEST_F(CommandStreamReceiverTest, givenGpuHangWhenWaititingForCompletionWithTi
     EXPECT_EQ(WaitStatus::GpuHang, waitStatus);
 }
 
+HWTEST_F(CommandStreamReceiverTest, givenGpuHangDumpDirectoryWhenGpuHangIsDetectedThenStateIsDumpedToFileOnce) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.GpuHangDumpDirectory.set(".");
+
+    auto driverModelMock = std::make_unique<MockDriverModel>();
+    driverModelMock->isGpuHangDetectedToReturn = true;
+
+    auto osInterface = std::make_unique<OSInterface>();
+    osInterface->setDriverModel(std::move(driverModelMock));
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.executionEnvironment.rootDeviceEnvironments[csr.rootDeviceIndex]->osInterface = std::move(osInterface);
+    csr.callBaseWaitForCompletionWithTimeout = true;
+    csr.activePartitions = 1;
+    csr.gpuHangCheckPeriod = 0us;
+    csr.getCS(1024u);
+
+    volatile std::uint32_t tasksCount[16] = {};
+    csr.tagAddress = tasksCount;
+
+    constexpr auto taskCountToWait = 7;
+    EXPECT_EQ(WaitStatus::GpuHang, csr.waitForCompletionWithTimeout(false, std::numeric_limits<std::int64_t>::max(), taskCountToWait));
+
+    auto fileName = std::string("./gpu_hang_") + std::to_string(SysCalls::getProcessId()) + "_" +
+                    std::to_string(csr.getOsContext().getContextId()) + "_" + std::to_string(taskCountToWait) + ".bin";
+    size_t dumpSize = 0;
+    auto dump = loadDataFromFile(fileName.c_str(), dumpSize);
+    ASSERT_NE(nullptr, dump);
+    ASSERT_GE(dumpSize, sizeof(GpuHangDump::Header));
+
+    auto header = reinterpret_cast<const GpuHangDump::Header *>(dump.get());
+    EXPECT_STREQ(GpuHangDump::magic, header->magic);
+    EXPECT_EQ(GpuHangDump::version, header->version);
+    EXPECT_EQ(2u, header->sectionCount);
+    EXPECT_EQ(static_cast<uint32_t>(taskCountToWait), header->taskCountToWait);
+
+    auto sectionHeader = reinterpret_cast<const GpuHangDump::SectionHeader *>(dump.get() + sizeof(GpuHangDump::Header));
+    EXPECT_EQ(GpuHangDump::SectionType::CommandStream, sectionHeader->type);
+    EXPECT_EQ(csr.commandStream.getUsed(), sectionHeader->size);
+    std::remove(fileName.c_str());
+
+    EXPECT_EQ(WaitStatus::GpuHang, csr.waitForCompletionWithTimeout(false, std::numeric_limits<std::int64_t>::max(), taskCountToWait));
+    EXPECT_FALSE(fileExists(fileName));
+}
+
 HWTEST_F(CommandStreamReceiverTest, givenNoGpuHangWhenWaititingForCompletionWithTimeoutThenReadyIsReturned) {
     auto driverModelMock = std::make_unique<MockDriverModel>();
     driverModelMock->isGpuHangDetectedToReturn = false;
@@ -278,6 +375,21 @@ HWTEST_F(CommandStreamReceiverTest, givenFailingFlushSubmissionsAndGpuHangWhenWa
     EXPECT_EQ(WaitStatus::GpuHang, waitStatus);
 }
 
+HWTEST_F(CommandStreamReceiverTest, givenAdaptiveWaitEnabledWhenTaskCountIsReachedThenWaitTimeIsRecordedInPolicy) {
+    VariableBackup<bool> backupAdaptiveWaitEnabled(&WaitUtils::adaptiveWaitEnabled, true);
+    VariableBackup<int64_t> backupMaxSpinTime(&WaitUtils::adaptiveWaitMaxSpinTime, 1'000'000);
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    EXPECT_EQ(WaitUtils::adaptiveWaitMaxSpinTime, csr.adaptiveWaitPolicy.getSpinTime());
+
+    volatile uint32_t tagValue = 2u;
+    WaitParams waitParams{false, false, 0};
+    csr.latestFlushedTaskCount = 2u;
+    EXPECT_EQ(WaitStatus::Ready, csr.baseWaitFunction(&tagValue, waitParams, 1u));
+
+    EXPECT_LT(csr.adaptiveWaitPolicy.getSpinTime(), WaitUtils::adaptiveWaitMaxSpinTime);
+}
+
 HWTEST_F(CommandStreamReceiverTest, givenFailingFlushSubmissionsAndNoGpuHangWhenWaititingForCompletionWithTimeoutThenNotReadyIsReturned) {
     auto driverModelMock = std::make_unique<MockDriverModel>();
     driverModelMock->isGpuHangDetectedToReturn = false;
@@ -560,6 +672,17 @@ HWTEST_F(CommandStreamReceiverTest, givenOverrideCsrAllocationSizeWhenCreatingCo
     EXPECT_EQ(static_cast<size_t>(overrideSize), commandStreamReceiver.preemptionAllocation->getUnderlyingBufferSize());
 }
 
+HWTEST_F(CommandStreamReceiverTest, givenCopyEngineCsrWhenCreatingPreemptionAllocationThenNoAllocationIsCreated) {
+    MockCsrHw<FamilyType> commandStreamReceiver(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    std::unique_ptr<OsContext> osContext(OsContext::create(pDevice->getExecutionEnvironment()->rootDeviceEnvironments[0]->osInterface.get(), 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_BCS, EngineUsage::Regular},
+                                                                                                        PreemptionMode::MidThread, pDevice->getDeviceBitfield())));
+    commandStreamReceiver.setupContext(*osContext);
+
+    EXPECT_TRUE(commandStreamReceiver.createPreemptionAllocation());
+    EXPECT_EQ(nullptr, commandStreamReceiver.preemptionAllocation);
+}
+
 HWTEST_F(CommandStreamReceiverTest, givenCommandStreamReceiverWhenCallingGetMemoryCompressionStateThenReturnNotApplicable) {
     CommandStreamReceiverHw<FamilyType> commandStreamReceiver(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
 
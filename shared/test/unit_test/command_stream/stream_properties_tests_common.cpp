@@ -335,3 +335,43 @@ TEST(StreamPropertiesTests, givenModeSelectPipelineSelectPropertyNotSupportedWhe
     // expect clean as changed modeSelected is not supported
     EXPECT_FALSE(pipeProperties.isDirty());
 }
+
+TEST(StreamPropertiesTests, whenSettingStateBaseAddressPropertiesThenCorrectValuesAreSetAndDirtyOnlyOnChange) {
+    StateBaseAddressProperties sbaProperties;
+    EXPECT_FALSE(sbaProperties.isDirty());
+
+    sbaProperties.setProperties(0x1000, 0x2000, 0x3000, 2);
+    EXPECT_TRUE(sbaProperties.isDirty());
+    EXPECT_EQ(0x1000, sbaProperties.generalStateBaseAddress.value);
+    EXPECT_EQ(0x2000, sbaProperties.indirectObjectBaseAddress.value);
+    EXPECT_EQ(0x3000, sbaProperties.bindingTablePoolBaseAddress.value);
+    EXPECT_EQ(2, sbaProperties.statelessMocs.value);
+
+    sbaProperties.setProperties(0x1000, 0x2000, 0x3000, 2);
+    EXPECT_FALSE(sbaProperties.isDirty());
+
+    sbaProperties.setProperties(0x1000, -1, -1, -1);
+    EXPECT_FALSE(sbaProperties.isDirty());
+    EXPECT_EQ(0x2000, sbaProperties.indirectObjectBaseAddress.value);
+
+    sbaProperties.setProperties(0x1000, 0x2000, 0x4000, 2);
+    EXPECT_TRUE(sbaProperties.isDirty());
+    EXPECT_FALSE(sbaProperties.generalStateBaseAddress.isDirty);
+    EXPECT_TRUE(sbaProperties.bindingTablePoolBaseAddress.isDirty);
+}
+
+TEST(StreamPropertiesTests, givenOtherStateBaseAddressPropertiesStructWhenSetPropertiesIsCalledThenCorrectValuesAreSet) {
+    StateBaseAddressProperties sbaPropertiesSource;
+    StateBaseAddressProperties sbaPropertiesDestination;
+    sbaPropertiesSource.setProperties(0x1000, 0x2000, 0x3000, 2);
+
+    sbaPropertiesDestination.setProperties(sbaPropertiesSource);
+    EXPECT_TRUE(sbaPropertiesDestination.isDirty());
+    EXPECT_EQ(0x1000, sbaPropertiesDestination.generalStateBaseAddress.value);
+    EXPECT_EQ(0x2000, sbaPropertiesDestination.indirectObjectBaseAddress.value);
+    EXPECT_EQ(0x3000, sbaPropertiesDestination.bindingTablePoolBaseAddress.value);
+    EXPECT_EQ(2, sbaPropertiesDestination.statelessMocs.value);
+
+    sbaPropertiesDestination.setProperties(sbaPropertiesSource);
+    EXPECT_FALSE(sbaPropertiesDestination.isDirty());
+}
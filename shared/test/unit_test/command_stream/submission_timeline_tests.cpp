@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/submission_timeline.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/mocks/mock_memory_manager.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+TEST(SubmissionTimelineTest, givenDefaultSettingsWhenCreatingTimelineThenNothingIsCreated) {
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
+    MockMemoryManager memoryManager(false, false, executionEnvironment);
+    EXPECT_EQ(nullptr, SubmissionTimeline::create(memoryManager, mockRootDeviceIndex, mockDeviceBitfield));
+}
+
+TEST(SubmissionTimelineTest, givenTimelineEnabledWhenEntriesAreRecordedThenHostAndGpuTimestampsArePairedPerSubmission) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableSubmissionTimeline.set(1);
+
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
+    MockMemoryManager memoryManager(false, false, executionEnvironment);
+    auto timeline = SubmissionTimeline::create(memoryManager, mockRootDeviceIndex, mockDeviceBitfield);
+    ASSERT_NE(nullptr, timeline);
+
+    auto allocation = timeline->getGpuTimestampsAllocation();
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(AllocationType::PROFILING_TAG_BUFFER, allocation->getAllocationType());
+
+    auto slot = timeline->beginEntry(5u);
+    EXPECT_EQ(0u, slot);
+    EXPECT_EQ(allocation->getGpuAddress(), timeline->getGpuStartAddress(slot));
+    EXPECT_EQ(allocation->getGpuAddress() + sizeof(uint64_t), timeline->getGpuEndAddress(slot));
+    timeline->markEncodeComplete(slot);
+    timeline->markSubmitted(slot);
+
+    auto gpuTimestamps = reinterpret_cast<SubmissionTimeline::GpuTimestamps *>(allocation->getUnderlyingBuffer());
+    gpuTimestamps[slot].start = 100u;
+    gpuTimestamps[slot].end = 200u;
+
+    auto entries = timeline->getTimeline();
+    ASSERT_EQ(1u, entries.size());
+    EXPECT_EQ(5u, entries[0].taskCount);
+    EXPECT_NE(0u, entries[0].encodeStartNs);
+    EXPECT_LE(entries[0].encodeStartNs, entries[0].encodeCompleteNs);
+    EXPECT_LE(entries[0].encodeCompleteNs, entries[0].submittedNs);
+    EXPECT_EQ(100u, entries[0].gpuStartTicks);
+    EXPECT_EQ(200u, entries[0].gpuEndTicks);
+}
+
+TEST(SubmissionTimelineTest, givenMoreSubmissionsThanEntriesWhenGettingTimelineThenOldestEntriesAreOverwritten) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableSubmissionTimeline.set(1);
+
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
+    MockMemoryManager memoryManager(false, false, executionEnvironment);
+    auto timeline = SubmissionTimeline::create(memoryManager, mockRootDeviceIndex, mockDeviceBitfield);
+    ASSERT_NE(nullptr, timeline);
+
+    for (uint32_t taskCount = 1; taskCount <= SubmissionTimeline::entriesCount + 2; taskCount++) {
+        timeline->beginEntry(taskCount);
+    }
+
+    auto entries = timeline->getTimeline();
+    ASSERT_EQ(SubmissionTimeline::entriesCount, entries.size());
+    EXPECT_EQ(3u, entries.front().taskCount);
+    EXPECT_EQ(SubmissionTimeline::entriesCount + 2, entries.back().taskCount);
+    EXPECT_EQ(0u, entries.back().gpuStartTicks);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2021 Intel Corporation
+ * Copyright (C) 2019-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #include "shared/source/compiler_interface/compiler_cache.h"
 #include "shared/source/compiler_interface/compiler_interface.h"
 #include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/file_io.h"
 #include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/string.h"
@@ -22,8 +23,10 @@
 #include "os_inc.h"
 
 #include <array>
+#include <cstdio>
 #include <list>
 #include <memory>
+#include <vector>
 
 using namespace NEO;
 
@@ -307,6 +310,89 @@ TEST(CompilerCacheTests, GivenBinaryCacheWhenDebugFlagIsSetAndOpenFailesThenNoCl
     EXPECT_EQ(IoFunctions::mockFwriteCalled, 0u);
 }
 
+TEST(CompilerCacheTests, givenInputWhenGettingCachedFileNameThenNameContains128BitHash) {
+    HardwareInfo hwInfo = *defaultHwInfo;
+    const char src[] = "__kernel void test() {}";
+    CompilerCache cache(CompilerCacheConfig{});
+
+    auto hash = cache.getCachedFileName(hwInfo, ArrayRef<const char>(src, sizeof(src)), ArrayRef<const char>(), ArrayRef<const char>());
+    EXPECT_EQ(2 * sizeof(FastHash::Digest), hash.size());
+    EXPECT_EQ(std::string::npos, hash.find_first_not_of("0123456789abcdef"));
+}
+
+TEST(CompilerCacheTests, givenMemoizedInputHashWhenSameLargeInputIsPassedAgainThenHashIsReusedUntilSampledPartChanges) {
+    DebugManagerStateRestore restorer;
+    HardwareInfo hwInfo = *defaultHwInfo;
+    std::vector<char> src(2 * CompilerCache::minMemoizedInputSize, 'a');
+    ArrayRef<const char> input(src.data(), src.size());
+    CompilerCache cache(CompilerCacheConfig{});
+
+    auto hash = cache.getCachedFileName(hwInfo, input, ArrayRef<const char>(), ArrayRef<const char>());
+    src[src.size() / 2] = 'b';
+    EXPECT_NE(hash, cache.getCachedFileName(hwInfo, input, ArrayRef<const char>(), ArrayRef<const char>()));
+    src[src.size() / 2] = 'a';
+
+    DebugManager.flags.BinaryCacheMemoizeInputHash.set(1);
+    EXPECT_EQ(hash, cache.getCachedFileName(hwInfo, input, ArrayRef<const char>(), ArrayRef<const char>()));
+    src[src.size() / 2] = 'b';
+    EXPECT_EQ(hash, cache.getCachedFileName(hwInfo, input, ArrayRef<const char>(), ArrayRef<const char>()));
+
+    src[0] = 'b';
+    auto modifiedHash = cache.getCachedFileName(hwInfo, input, ArrayRef<const char>(), ArrayRef<const char>());
+    EXPECT_NE(hash, modifiedHash);
+    EXPECT_EQ(modifiedHash, cache.getCachedFileName(hwInfo, input, ArrayRef<const char>(), ArrayRef<const char>()));
+}
+
+TEST(CompilerCacheTests, givenMemoryCacheDisabledWhenStoringBinaryInMemoryCacheThenItIsNotReturned) {
+    const char binary[] = "binary";
+    CompilerCache::storeInMemoryCache("memoryCacheDisabledHash", binary, sizeof(binary));
+
+    size_t size = 0u;
+    EXPECT_FALSE(CompilerCache::isMemoryCacheEnabled());
+    EXPECT_EQ(nullptr, CompilerCache::loadFromMemoryCache("memoryCacheDisabledHash", size));
+}
+
+TEST(CompilerCacheTests, givenMemoryCacheEnabledWhenBinaryIsCachedThenCompilerCachesOfOtherDevicesLoadItFromMemory) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BinaryCacheInMemorySize.set(1);
+
+    const char binary[] = "binary";
+    CompilerCacheConfig config;
+    config.cacheDir = "memoryCacheDir";
+    CompilerCache cache(config);
+    cache.cacheBinary("memoryCacheSharedHash", binary, sizeof(binary));
+
+    CompilerCacheConfig otherConfig;
+    otherConfig.cacheDir = "nonExistingMemoryCacheDir";
+    CompilerCache otherCache(otherConfig);
+    size_t size = 0u;
+    auto loadedBinary = otherCache.loadCachedBinary("memoryCacheSharedHash", size);
+    ASSERT_NE(nullptr, loadedBinary);
+    EXPECT_EQ(sizeof(binary), size);
+    EXPECT_EQ(0, memcmp(binary, loadedBinary.get(), size));
+}
+
+TEST(CompilerCacheTests, givenMemoryCacheFullWhenNewBinaryIsStoredThenLeastRecentlyUsedBinaryIsEvicted) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BinaryCacheInMemorySize.set(1);
+
+    std::vector<char> binary(400u * 1024u, 'x');
+    size_t size = 0u;
+    CompilerCache::storeInMemoryCache("memoryCacheLruHash1", binary.data(), binary.size());
+    CompilerCache::storeInMemoryCache("memoryCacheLruHash2", binary.data(), binary.size());
+    EXPECT_NE(nullptr, CompilerCache::loadFromMemoryCache("memoryCacheLruHash1", size));
+
+    CompilerCache::storeInMemoryCache("memoryCacheLruHash3", binary.data(), binary.size());
+    EXPECT_NE(nullptr, CompilerCache::loadFromMemoryCache("memoryCacheLruHash1", size));
+    EXPECT_EQ(nullptr, CompilerCache::loadFromMemoryCache("memoryCacheLruHash2", size));
+    EXPECT_NE(nullptr, CompilerCache::loadFromMemoryCache("memoryCacheLruHash3", size));
+
+    std::vector<char> tooLargeBinary(2u * 1024u * 1024u, 'x');
+    CompilerCache::storeInMemoryCache("memoryCacheLruHash4", tooLargeBinary.data(), tooLargeBinary.size());
+    EXPECT_EQ(nullptr, CompilerCache::loadFromMemoryCache("memoryCacheLruHash4", size));
+    EXPECT_NE(nullptr, CompilerCache::loadFromMemoryCache("memoryCacheLruHash1", size));
+}
+
 TEST(CompilerCacheTests, GivenEmptyBinaryWhenCachingThenBinaryIsNotCached) {
     CompilerCache cache(CompilerCacheConfig{});
     bool ret = cache.cacheBinary("some_hash", nullptr, 12u);
@@ -325,6 +411,131 @@ TEST(CompilerCacheTests, GivenNonExistantConfigWhenLoadingFromCacheThenNullIsRet
     EXPECT_EQ(0U, size);
 }
 
+class CompilerCacheWithIndexMock : public CompilerCache {
+  public:
+    using CompilerCache::evictIfNeeded;
+    using CompilerCache::getIndexShard;
+    using CompilerCache::indexedSize;
+    using CompilerCache::updateIndex;
+
+    CompilerCacheWithIndexMock(const CompilerCacheConfig &config) : CompilerCache(config) {}
+
+    void initializeIndex() override {
+        initializeIndexCalled++;
+    }
+
+    bool isIndexed(const std::string &hash) {
+        auto &shard = getIndexShard(hash);
+        return shard.entries.find(hash) != shard.entries.end();
+    }
+
+    uint32_t initializeIndexCalled = 0u;
+};
+
+TEST(CompilerCacheTests, GivenReadOnlyTierWhenBinaryIsMissingInWritableTierThenItIsLoadedFromReadOnlyTierAndNotIndexed) {
+    CompilerCacheConfig config;
+    config.cacheDir = "----do-not-exists----";
+    config.readOnlyCacheDir = ".";
+    config.cacheFileExtension = ".ro_tier_cache";
+    config.cacheSize = 1024u;
+    CompilerCacheWithIndexMock cache(config);
+
+    const char binary[] = "read-only tier binary";
+    std::string readOnlyFile = std::string(".") + PATH_SEPARATOR + "readOnlyTierHash" + config.cacheFileExtension;
+    ASSERT_NE(0u, writeDataToFile(readOnlyFile.c_str(), binary, sizeof(binary)));
+
+    size_t size = 0u;
+    auto loadedBinary = cache.loadCachedBinary("readOnlyTierHash", size);
+    std::remove(readOnlyFile.c_str());
+    ASSERT_NE(nullptr, loadedBinary);
+    EXPECT_EQ(sizeof(binary), size);
+    EXPECT_EQ(0, memcmp(binary, loadedBinary.get(), size));
+    EXPECT_EQ(1u, cache.getHitsCount(CompilerCache::CacheTier::ReadOnly));
+    EXPECT_EQ(0u, cache.getHitsCount(CompilerCache::CacheTier::Writable));
+    EXPECT_EQ(0u, cache.getMissesCount());
+    EXPECT_EQ(0u, cache.initializeIndexCalled);
+    EXPECT_EQ(0u, cache.indexedSize);
+}
+
+TEST(CompilerCacheTests, GivenBinaryMissingInAllTiersWhenLoadingThenMissIsCounted) {
+    CompilerCacheConfig config;
+    config.cacheDir = "----do-not-exists----";
+    config.readOnlyCacheDir = "----do-not-exists-read-only----";
+    CompilerCache cache(config);
+
+    size_t size = 0u;
+    EXPECT_EQ(nullptr, cache.loadCachedBinary("missingInAllTiersHash", size));
+    EXPECT_EQ(1u, cache.getMissesCount());
+    EXPECT_EQ(0u, cache.getHitsCount(CompilerCache::CacheTier::Memory));
+    EXPECT_EQ(0u, cache.getHitsCount(CompilerCache::CacheTier::Writable));
+    EXPECT_EQ(0u, cache.getHitsCount(CompilerCache::CacheTier::ReadOnly));
+}
+
+TEST(CompilerCacheTests, GivenCacheSizeLimitWhenIndexExceedsLimitThenLeastRecentlyUsedEntriesAreEvicted) {
+    CompilerCacheConfig config{};
+    config.cacheDir = "----do-not-exists----";
+    config.cacheSize = 100u;
+    CompilerCacheWithIndexMock cache(config);
+
+    cache.updateIndex("hash0", 40u);
+    cache.updateIndex("hash1", 40u);
+    cache.updateIndex("hash0", 40u);
+    cache.updateIndex("hash2", 40u);
+    EXPECT_EQ(120u, cache.indexedSize);
+
+    cache.evictIfNeeded("hash2");
+    EXPECT_EQ(80u, cache.indexedSize);
+    EXPECT_TRUE(cache.isIndexed("hash0"));
+    EXPECT_FALSE(cache.isIndexed("hash1"));
+    EXPECT_TRUE(cache.isIndexed("hash2"));
+}
+
+TEST(CompilerCacheTests, GivenCacheSizeLimitWhenOnlyProtectedEntryExceedsLimitThenItIsNotEvicted) {
+    CompilerCacheConfig config{};
+    config.cacheDir = "----do-not-exists----";
+    config.cacheSize = 10u;
+    CompilerCacheWithIndexMock cache(config);
+
+    cache.updateIndex("hash0", 40u);
+    cache.evictIfNeeded("hash0");
+    EXPECT_EQ(40u, cache.indexedSize);
+    EXPECT_TRUE(cache.isIndexed("hash0"));
+}
+
+TEST(CompilerCacheTests, GivenEntryUpdatedWithNewSizeWhenIndexingThenIndexedSizeIsAdjusted) {
+    CompilerCacheConfig config{};
+    config.cacheSize = 100u;
+    CompilerCacheWithIndexMock cache(config);
+
+    cache.updateIndex("hash0", 40u);
+    cache.updateIndex("hash0", 10u);
+    EXPECT_EQ(10u, cache.indexedSize);
+}
+
+TEST(CompilerCacheTests, GivenNoCacheSizeLimitWhenLoadingAndCachingThenIndexIsNotInitialized) {
+    CompilerCacheConfig config{};
+    config.cacheDir = "----do-not-exists----";
+    CompilerCacheWithIndexMock cache(config);
+
+    const char binary[] = "binary";
+    EXPECT_FALSE(cache.cacheBinary("some_hash", binary, sizeof(binary)));
+    size_t size = 0u;
+    EXPECT_EQ(nullptr, cache.loadCachedBinary("some_hash", size));
+    EXPECT_EQ(0u, cache.initializeIndexCalled);
+}
+
+TEST(CompilerCacheTests, GivenCacheSizeLimitWhenCachingBinaryThenIndexIsInitializedOnce) {
+    CompilerCacheConfig config{};
+    config.cacheDir = "----do-not-exists----";
+    config.cacheSize = 100u;
+    CompilerCacheWithIndexMock cache(config);
+
+    const char binary[] = "binary";
+    cache.cacheBinary("some_hash", binary, sizeof(binary));
+    cache.cacheBinary("some_hash", binary, sizeof(binary));
+    EXPECT_EQ(1u, cache.initializeIndexCalled);
+}
+
 TEST(CompilerInterfaceCachedTests, GivenNoCachedBinaryWhenBuildingThenErrorIsReturned) {
     TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
 
@@ -436,3 +647,126 @@ TEST(CompilerInterfaceCachedTests, givenKernelWithIncludesAndBinaryInCacheWhenCo
 
     gEnvironment->fclPopDebugVars();
 }
+
+TEST(CompilerInterfaceCachedTests, givenMemoryCacheEnabledAndCachingNotAllowedWhenSameKernelIsBuiltAgainThenBinaryIsReusedWithoutBinaryCache) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BinaryCacheInMemorySize.set(1);
+
+    MockDevice device{};
+    TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
+    auto src = "__kernel memoryCachedK() {}";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+
+    MockCompilerDebugVars fclDebugVars;
+    fclDebugVars.fileName = gEnvironment->fclGetMockFile();
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+    MockCompilerDebugVars igcDebugVars;
+    igcDebugVars.fileName = gEnvironment->igcGetMockFile();
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    auto cache = new CompilerCacheMock();
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::unique_ptr<CompilerCache>(cache), true));
+    TranslationOutput translationOutput;
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, compilerInterface->build(device, inputArgs, translationOutput));
+    gEnvironment->fclPopDebugVars();
+    gEnvironment->igcPopDebugVars();
+
+    fclDebugVars.forceBuildFailure = true;
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+    igcDebugVars.forceBuildFailure = true;
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    TranslationOutput cachedTranslationOutput;
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, compilerInterface->build(device, inputArgs, cachedTranslationOutput));
+    EXPECT_EQ(translationOutput.deviceBinary.size, cachedTranslationOutput.deviceBinary.size);
+    EXPECT_EQ(0u, cache->cacheInvoked);
+
+    gEnvironment->fclPopDebugVars();
+    gEnvironment->igcPopDebugVars();
+}
+
+class CompilerCacheWithIntermediateRepresentationMock : public CompilerCacheMock {
+  public:
+    bool cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) override {
+        cachedHashes.push_back(kernelFileHash);
+        return CompilerCacheMock::cacheBinary(kernelFileHash, pBinary, binarySize);
+    }
+
+    std::unique_ptr<char[]> loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize) override {
+        if (loadIntermediateRepresentation && kernelFileHash.rfind("ir_", 0) == 0) {
+            cachedBinarySize = sizeof(intermediateRepresentation);
+            auto ir = std::make_unique<char[]>(cachedBinarySize);
+            memcpy(ir.get(), intermediateRepresentation, cachedBinarySize);
+            return ir;
+        }
+        return nullptr;
+    }
+
+    const char intermediateRepresentation[9] = "cachedIr";
+    bool loadIntermediateRepresentation = false;
+    std::vector<std::string> cachedHashes;
+};
+
+TEST(CompilerInterfaceCachedTests, givenIntermediateRepresentationCachingEnabledWhenSourceIsBuiltThenFrontendOutputIsCachedWithDeviceIndependentKey) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BinaryCacheIntermediateRepresentation.set(1);
+
+    MockDevice device{};
+    TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
+    auto src = "__kernel k() {}";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+    inputArgs.allowCaching = true;
+
+    MockCompilerDebugVars fclDebugVars;
+    fclDebugVars.fileName = gEnvironment->fclGetMockFile();
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+    MockCompilerDebugVars igcDebugVars;
+    igcDebugVars.fileName = gEnvironment->igcGetMockFile();
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    auto cache = new CompilerCacheWithIntermediateRepresentationMock();
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::unique_ptr<CompilerCache>(cache), true));
+    TranslationOutput translationOutput;
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, compilerInterface->build(device, inputArgs, translationOutput));
+
+    auto expectedIrHash = cache->getCachedIntermediateFileName(inputArgs.src, inputArgs.apiOptions, inputArgs.internalOptions, translationOutput.intermediateCodeType,
+                                                               device.getHardwareInfo().capabilityTable.clVersionSupport);
+    EXPECT_EQ(0u, expectedIrHash.rfind("ir_", 0));
+    ASSERT_EQ(2u, cache->cachedHashes.size());
+    EXPECT_EQ(expectedIrHash, cache->cachedHashes[0]);
+    EXPECT_NE(expectedIrHash, cache->cachedHashes[1]);
+
+    gEnvironment->fclPopDebugVars();
+    gEnvironment->igcPopDebugVars();
+}
+
+TEST(CompilerInterfaceCachedTests, givenCachedIntermediateRepresentationWhenSourceIsBuiltThenFrontendCompilerIsSkipped) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.BinaryCacheIntermediateRepresentation.set(1);
+
+    MockDevice device{};
+    TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
+    auto src = "__kernel k() {}";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+    inputArgs.allowCaching = true;
+
+    MockCompilerDebugVars fclDebugVars;
+    fclDebugVars.fileName = gEnvironment->fclGetMockFile();
+    fclDebugVars.forceBuildFailure = true;
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+    MockCompilerDebugVars igcDebugVars;
+    igcDebugVars.fileName = gEnvironment->igcGetMockFile();
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    auto cache = new CompilerCacheWithIntermediateRepresentationMock();
+    cache->loadIntermediateRepresentation = true;
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::unique_ptr<CompilerCache>(cache), true));
+    TranslationOutput translationOutput;
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, compilerInterface->build(device, inputArgs, translationOutput));
+    ASSERT_EQ(sizeof(cache->intermediateRepresentation), translationOutput.intermediateRepresentation.size);
+    EXPECT_EQ(0, memcmp(cache->intermediateRepresentation, translationOutput.intermediateRepresentation.mem.get(), translationOutput.intermediateRepresentation.size));
+    EXPECT_EQ(1u, cache->cachedHashes.size());
+
+    gEnvironment->fclPopDebugVars();
+    gEnvironment->igcPopDebugVars();
+}
@@ -996,6 +996,91 @@ TEST_F(CompilerInterfaceTest, whenIgcReturnsErrorThenGetSipKernelBinaryFailsGrac
     gEnvironment->igcPopDebugVars();
 }
 
+class InMemoryCompilerCache : public CompilerCache {
+  public:
+    InMemoryCompilerCache() : CompilerCache(CompilerCacheConfig{}) {}
+
+    bool cacheBinary(const std::string kernelFileHash, const char *pBinary, uint32_t binarySize) override {
+        if (pBinary == nullptr || binarySize == 0) {
+            return false;
+        }
+        storage[kernelFileHash].assign(pBinary, pBinary + binarySize);
+        return true;
+    }
+
+    std::unique_ptr<char[]> loadCachedBinary(const std::string kernelFileHash, size_t &cachedBinarySize) override {
+        cachedBinarySize = 0u;
+        auto it = storage.find(kernelFileHash);
+        if (it == storage.end()) {
+            return nullptr;
+        }
+        cachedBinarySize = it->second.size();
+        return makeCopy(it->second.data(), it->second.size());
+    }
+
+    std::map<std::string, std::vector<char>> storage;
+};
+
+TEST_F(CompilerInterfaceTest, givenBuiltinBinaryCacheEnabledWhenSipKernelIsCompiledThenItIsStoredInCompilerCache) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.EnableBuiltinBinaryCache.set(1);
+    auto cache = new InMemoryCompilerCache();
+    pCompilerInterface->cache.reset(cache);
+
+    MockCompilerDebugVars igcDebugVars;
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+    std::vector<char> sipBinary;
+    std::vector<char> stateAreaHeader;
+    auto err = pCompilerInterface->getSipKernelBinary(*this->pDevice, SipKernelType::Csr, sipBinary, stateAreaHeader);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+    ASSERT_NE(0U, sipBinary.size());
+
+    bool binaryStored = false;
+    for (const auto &entry : cache->storage) {
+        binaryStored |= (entry.second == sipBinary);
+    }
+    EXPECT_TRUE(binaryStored);
+
+    gEnvironment->igcPopDebugVars();
+}
+
+TEST_F(CompilerInterfaceTest, givenBuiltinBinaryCacheEnabledAndSipKernelInCacheWhenGettingSipKernelBinaryThenCompilerIsNotUsed) {
+    DebugManagerStateRestore dbgRestore;
+    DebugManager.flags.EnableBuiltinBinaryCache.set(1);
+    pCompilerInterface->cache.reset(new InMemoryCompilerCache());
+
+    MockCompilerDebugVars igcDebugVars;
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+    std::vector<char> sipBinary;
+    std::vector<char> stateAreaHeader;
+    auto err = pCompilerInterface->getSipKernelBinary(*this->pDevice, SipKernelType::Csr, sipBinary, stateAreaHeader);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+    gEnvironment->igcPopDebugVars();
+
+    pCompilerInterface->igcMain.reset();
+    std::vector<char> cachedSipBinary;
+    std::vector<char> cachedStateAreaHeader;
+    err = pCompilerInterface->getSipKernelBinary(*this->pDevice, SipKernelType::Csr, cachedSipBinary, cachedStateAreaHeader);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+    EXPECT_EQ(sipBinary, cachedSipBinary);
+    EXPECT_EQ(stateAreaHeader, cachedStateAreaHeader);
+}
+
+TEST_F(CompilerInterfaceTest, givenBuiltinBinaryCacheDisabledWhenSipKernelIsCompiledThenCompilerCacheIsNotUsed) {
+    auto cache = new InMemoryCompilerCache();
+    pCompilerInterface->cache.reset(cache);
+
+    MockCompilerDebugVars igcDebugVars;
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+    std::vector<char> sipBinary;
+    std::vector<char> stateAreaHeader;
+    auto err = pCompilerInterface->getSipKernelBinary(*this->pDevice, SipKernelType::Csr, sipBinary, stateAreaHeader);
+    EXPECT_EQ(TranslationOutput::ErrorCode::Success, err);
+    EXPECT_TRUE(cache->storage.empty());
+
+    gEnvironment->igcPopDebugVars();
+}
+
 TEST_F(CompilerInterfaceTest, whenGetIgcDeviceCtxReturnsNullptrThenGetSipKernelBinaryFailsGracefully) {
     pCompilerInterface->failGetIgcDeviceCtx = true;
 
@@ -1324,6 +1324,94 @@ TEST(LinkerTests, givenValidSymbolsAndRelocationsThenInstructionSegmentsArePrope
     EXPECT_EQ(kd.kernelAttributes.crossThreadDataSize, perThreadPayloadOffsetPatchedValue);
 }
 
+TEST(LinkerInputTests, givenRelocationsReferringSameSymbolWhenDecodingRelocationTableThenSymbolNameIsInternedOnce) {
+    NEO::LinkerInput linkerInput;
+
+    vISA::GenRelocEntry relocs[3] = {};
+    relocs[0].r_symbol[0] = 'A';
+    relocs[0].r_type = vISA::GenRelocType::R_SYM_ADDR;
+    relocs[1].r_symbol[0] = 'B';
+    relocs[1].r_offset = 8;
+    relocs[1].r_type = vISA::GenRelocType::R_SYM_ADDR;
+    relocs[2].r_symbol[0] = 'A';
+    relocs[2].r_offset = 16;
+    relocs[2].r_type = vISA::GenRelocType::R_SYM_ADDR;
+    EXPECT_TRUE(linkerInput.decodeRelocationTable(&relocs, 2, 0));
+    EXPECT_TRUE(linkerInput.decodeRelocationTable(&relocs[2], 1, 1));
+
+    ASSERT_EQ(2U, linkerInput.getInternedSymbolNames().size());
+    EXPECT_EQ("A", linkerInput.getInternedSymbolNames()[0]);
+    EXPECT_EQ("B", linkerInput.getInternedSymbolNames()[1]);
+
+    const auto &relocations = linkerInput.getRelocationsInInstructionSegments();
+    ASSERT_EQ(2U, relocations.size());
+    EXPECT_EQ(0U, relocations[0][0].symbolId);
+    EXPECT_EQ(1U, relocations[0][1].symbolId);
+    EXPECT_EQ(0U, relocations[1][0].symbolId);
+}
+
+TEST(LinkerTests, givenLinkerRelocationThreadsSetWhenPatchingMultipleInstructionSegmentsThenAllSegmentsArePatchedAndUnresolvedExternalsAreReportedInSegmentOrder) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.LinkerRelocationThreads.set(4);
+
+    NEO::LinkerInput linkerInput;
+    vISA::GenSymEntry symGlobalVariable = {};
+    symGlobalVariable.s_name[0] = 'A';
+    symGlobalVariable.s_offset = 4;
+    symGlobalVariable.s_size = 16;
+    symGlobalVariable.s_type = vISA::GenSymType::S_GLOBAL_VAR;
+    EXPECT_TRUE(linkerInput.decodeGlobalVariablesSymbolTable(&symGlobalVariable, 1));
+
+    constexpr uint32_t numSegments = 16;
+    vISA::GenRelocEntry relocs[2] = {};
+    relocs[0].r_symbol[0] = 'A';
+    relocs[0].r_offset = 0;
+    relocs[0].r_type = vISA::GenRelocType::R_SYM_ADDR;
+    relocs[1].r_symbol[0] = 'U';
+    relocs[1].r_offset = 8;
+    relocs[1].r_type = vISA::GenRelocType::R_SYM_ADDR;
+    for (uint32_t segId = 0; segId < numSegments; segId++) {
+        EXPECT_TRUE(linkerInput.decodeRelocationTable(&relocs, 2, segId));
+    }
+
+    NEO::Linker linker(linkerInput);
+    NEO::Linker::SegmentInfo globalVarSegment, globalConstSegment, exportedFuncSegment;
+    globalVarSegment.gpuAddress = 8;
+    globalVarSegment.segmentSize = 64;
+
+    std::vector<std::vector<char>> instructionSegments(numSegments, std::vector<char>(16, 0));
+    NEO::Linker::PatchableSegments patchableInstructionSegments;
+    NEO::Linker::KernelDescriptorsT kernelDescriptors;
+    KernelDescriptor kd;
+    for (auto &instructionSegment : instructionSegments) {
+        NEO::Linker::PatchableSegment seg;
+        seg.hostPointer = instructionSegment.data();
+        seg.segmentSize = instructionSegment.size();
+        patchableInstructionSegments.push_back(seg);
+        kernelDescriptors.push_back(&kd);
+    }
+    NEO::Linker::UnresolvedExternals unresolvedExternals;
+    NEO::Linker::ExternalFunctionsT externalFunctions;
+
+    auto linkResult = linker.link(
+        globalVarSegment, globalConstSegment, exportedFuncSegment, {},
+        nullptr, nullptr, patchableInstructionSegments, unresolvedExternals,
+        nullptr, nullptr, nullptr, kernelDescriptors, externalFunctions);
+    EXPECT_EQ(NEO::LinkingStatus::LinkedPartially, linkResult);
+
+    auto expectedAddress = static_cast<uintptr_t>(globalVarSegment.gpuAddress + symGlobalVariable.s_offset);
+    for (auto &instructionSegment : instructionSegments) {
+        EXPECT_EQ(expectedAddress, *reinterpret_cast<const uintptr_t *>(instructionSegment.data()));
+    }
+
+    ASSERT_EQ(numSegments, unresolvedExternals.size());
+    for (uint32_t segId = 0; segId < numSegments; segId++) {
+        EXPECT_EQ(segId, unresolvedExternals[segId].instructionsSegmentId);
+        EXPECT_EQ("U", unresolvedExternals[segId].unresolvedRelocation.symbolName);
+        EXPECT_FALSE(unresolvedExternals[segId].internalError);
+    }
+}
+
 TEST(LinkerTests, givenInvalidSymbolOffsetWhenPatchingInstructionsThenRelocationFails) {
     NEO::LinkerInput linkerInput;
 
@@ -63,6 +63,36 @@ TEST_F(DeviceTest, whenInitializeRayTracingIsCalledAndRtBackedBufferIsNullptrThe
     EXPECT_EQ(true, pDevice->rayTracingIsInitialized());
 }
 
+TEST_F(DeviceTest, givenReleaseIdleRayTracingAllocationsEnabledWhenLastRayTracingUserIsReleasedThenAllocationsAreFreedAndAllocatedAgainOnNextUse) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.ReleaseIdleRayTracingAllocations.set(1);
+
+    pDevice->initializeRayTracing(5);
+    pDevice->initializeRayTracing(5);
+    EXPECT_NE(nullptr, pDevice->getRTDispatchGlobals(5));
+
+    pDevice->releaseRayTracing();
+    EXPECT_TRUE(pDevice->rayTracingIsInitialized());
+
+    pDevice->releaseRayTracing();
+    EXPECT_FALSE(pDevice->rayTracingIsInitialized());
+    EXPECT_EQ(nullptr, pDevice->rtDispatchGlobalsInfos[5]);
+
+    pDevice->initializeRayTracing(5);
+    EXPECT_TRUE(pDevice->rayTracingIsInitialized());
+    EXPECT_NE(nullptr, pDevice->getRTDispatchGlobals(5));
+}
+
+TEST_F(DeviceTest, givenDefaultSettingsWhenLastRayTracingUserIsReleasedThenAllocationsAreKept) {
+    pDevice->initializeRayTracing(5);
+    auto rtDispatchGlobalsInfo = pDevice->getRTDispatchGlobals(5);
+    EXPECT_NE(nullptr, rtDispatchGlobalsInfo);
+
+    pDevice->releaseRayTracing();
+    EXPECT_TRUE(pDevice->rayTracingIsInitialized());
+    EXPECT_EQ(rtDispatchGlobalsInfo, pDevice->getRTDispatchGlobals(5));
+}
+
 TEST_F(DeviceTest, whenGetRTDispatchGlobalsIsCalledWithUnsupportedBVHLevelsThenNullptrIsReturned) {
     pDevice->initializeRayTracing(5);
     EXPECT_EQ(nullptr, pDevice->getRTDispatchGlobals(100));
@@ -624,4 +654,37 @@ HWCMDTEST_F(IGFX_XE_HP_CORE, DeviceTests, givenNonDebuggableOsContextWhenDeviceC
     auto device = deviceFactory.rootDevices[0];
     auto csr = device->allEngines[device->defaultEngineIndex].commandStreamReceiver;
     EXPECT_EQ(0u, csr->peekLatestSentTaskCount());
-}
\ No newline at end of file
+}
+TEST(Device, givenDeferEngineResourcesCreationWhenEngineWithDeferredContextIsCreatedThenPreemptionAllocationIsCreatedOnFirstUse) {
+    DebugManagerStateRestore restore{};
+    DebugManager.flags.DeferOsContextInitialization.set(1);
+    DebugManager.flags.DeferEngineResourcesCreation.set(1);
+
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    device->setPreemptionMode(PreemptionMode::MidThread);
+
+    auto engineIndex = static_cast<uint32_t>(device->allEngines.size());
+    EXPECT_TRUE(device->createEngine(engineIndex, {aub_stream::ENGINE_RCS, EngineUsage::Cooperative}));
+    auto commandStreamReceiver = device->allEngines.back().commandStreamReceiver;
+    EXPECT_FALSE(device->allEngines.back().osContext->isInitialized());
+    EXPECT_EQ(nullptr, commandStreamReceiver->getPreemptionAllocation());
+
+    EXPECT_TRUE(commandStreamReceiver->ensureDeferredResourcesCreated());
+    auto preemptionAllocation = commandStreamReceiver->getPreemptionAllocation();
+    EXPECT_NE(nullptr, preemptionAllocation);
+
+    EXPECT_TRUE(commandStreamReceiver->ensureDeferredResourcesCreated());
+    EXPECT_EQ(preemptionAllocation, commandStreamReceiver->getPreemptionAllocation());
+}
+
+TEST(Device, givenDeferEngineResourcesCreationDisabledWhenEngineWithDeferredContextIsCreatedThenPreemptionAllocationIsCreatedImmediately) {
+    DebugManagerStateRestore restore{};
+    DebugManager.flags.DeferOsContextInitialization.set(1);
+
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    device->setPreemptionMode(PreemptionMode::MidThread);
+
+    auto engineIndex = static_cast<uint32_t>(device->allEngines.size());
+    EXPECT_TRUE(device->createEngine(engineIndex, {aub_stream::ENGINE_RCS, EngineUsage::Cooperative}));
+    EXPECT_NE(nullptr, device->allEngines.back().commandStreamReceiver->getPreemptionAllocation());
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2021 Intel Corporation
+ * Copyright (C) 2020-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -147,3 +147,13 @@ TEST(ArEncoder, GivenValidTwoFileEntriesWhen8BytePaddingIsRequestedThenPaddingFi
     EXPECT_EQ(0, memcmp(file1Data, data1, sizeof(data1)));
     EXPECT_EQ(0, memcmp(file2Data, data2, sizeof(data2)));
 }
+
+TEST(ArEncoder, WhenEncodingThenOutputIsAllocatedOnceWithExactSize) {
+    const uint8_t fileData[] = {1, 2, 3, 4, 5, 6, 7};
+    ArEncoder encoder(true);
+    for (uint32_t i = 0; i < 64; i++) {
+        ASSERT_NE(nullptr, encoder.appendFileEntry("file_" + std::to_string(i), fileData));
+    }
+    auto arData = encoder.encode();
+    EXPECT_EQ(arData.size(), arData.capacity());
+}
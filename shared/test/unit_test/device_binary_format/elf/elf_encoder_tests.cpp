@@ -499,3 +499,20 @@ TEST(ElfEncoder, WhenGetSectionHeaderIndexIsCalledThenCorrectSectionIdxIsReturne
     auto &sec1 = elfEncoder64.appendSection(SHT_PROGBITS, "", {});
     EXPECT_EQ(1U, elfEncoder64.getSectionHeaderIndex(sec1));
 }
+
+TEST(ElfEncoder, GivenReservedDataWhenAppendingSectionsThenDataIsNotReallocatedAndEncodedOutputIsAllocatedWithExactSize) {
+    const uint8_t sectionData[] = {1, 2, 3, 4, 5};
+    struct WhiteBoxElfEncoder : ElfEncoder<EI_CLASS_64> {
+        using ElfEncoder<EI_CLASS_64>::data;
+    } elfEncoder64;
+    elfEncoder64.reserveData(16 * alignUp(sizeof(sectionData), 8U));
+
+    auto dataStorage = elfEncoder64.data.data();
+    for (uint32_t i = 0; i < 16; i++) {
+        elfEncoder64.appendSection(SHT_PROGBITS, "section_" + std::to_string(i), sectionData);
+    }
+    EXPECT_EQ(dataStorage, elfEncoder64.data.data());
+
+    auto elfData = elfEncoder64.encode();
+    EXPECT_EQ(elfData.size(), elfData.capacity());
+}
@@ -230,6 +230,36 @@ TEST(YamlConsumeNameIdentifier, GivenNameIdentifierBeginningCharacterThenConsume
     }
 }
 
+TEST(YamlConsumeNameIdentifierCharacters, GivenAnyCharacterAtAnyPositionOfBlockThenStopsOnlyOnNonNameIdentifierCharacter) {
+    for (size_t len = 0; len < 40; ++len) {
+        for (int c = std::numeric_limits<char>::min(); c <= std::numeric_limits<char>::max(); ++c) {
+            std::string text(len, 'a');
+            text += static_cast<char>(c);
+            text += "tail";
+            auto expected = NEO::Yaml::isNameIdentifierCharacter(static_cast<char>(c)) ? text.data() + len + 5 : text.data() + len;
+            EXPECT_EQ(expected, NEO::Yaml::consumeNameIdentifierCharacters(text.data(), text.data() + text.size())) << len << " " << c;
+        }
+    }
+}
+
+TEST(YamlConsumeSpaces, GivenRunOfSpacesThenReturnsFirstNonSpacePosition) {
+    for (size_t len = 0; len < 40; ++len) {
+        std::string text(len, ' ');
+        EXPECT_EQ(text.data() + len, NEO::Yaml::consumeSpaces(text.data(), text.data() + text.size())) << len;
+        text += "\t  ";
+        EXPECT_EQ(text.data() + len, NEO::Yaml::consumeSpaces(text.data(), text.data() + text.size())) << len;
+    }
+}
+
+TEST(YamlFindNewLine, GivenTextThenReturnsPositionOfFirstNewLineOrEnd) {
+    for (size_t len = 0; len < 40; ++len) {
+        std::string text(len, '#');
+        EXPECT_EQ(text.data() + len, NEO::Yaml::findNewLine(text.data(), text.data() + text.size())) << len;
+        text += "\n##\n";
+        EXPECT_EQ(text.data() + len, NEO::Yaml::findNewLine(text.data(), text.data() + text.size())) << len;
+    }
+}
+
 TEST(YamlConsumeStringLiteral, GivenQuotedStringThenConsumeUntilEndingMarkIsMet) {
     ConstStringRef notQuoted = "a+5";
     ConstStringRef singleQuote = "\'abc de fg\'ijkl";
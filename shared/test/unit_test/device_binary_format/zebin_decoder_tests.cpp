@@ -971,6 +971,73 @@ kernels:
     EXPECT_EQ(NEO::DecodeError::InvalidBinary, err);
 }
 
+TEST(PopulateKernelDescriptor, GivenMultipleKernelsThenEachKernelGetsItsOwnTextSection) {
+    NEO::ConstStringRef zeinfo = R"===(
+kernels:
+    - name : kernel_a
+      execution_env:
+        simd_size: 8
+    - name : kernel_b
+      execution_env:
+        simd_size: 8
+    - name : kernel_c
+      execution_env:
+        simd_size: 8
+...
+)===";
+    NEO::ProgramInfo programInfo;
+    ZebinTestData::ValidEmptyProgram zebin;
+    const uint8_t isaA[] = {0xA};
+    const uint8_t isaB[] = {0xB, 0xB};
+    const uint8_t isaC[] = {0xC, 0xC, 0xC};
+    zebin.appendSection(NEO::Elf::SHT_PROGBITS, NEO::Elf::SectionsNamesZebin::textPrefix.str() + "kernel_c", isaC);
+    zebin.appendSection(NEO::Elf::SHT_PROGBITS, NEO::Elf::SectionsNamesZebin::textPrefix.str() + "kernel_a", isaA);
+    zebin.appendSection(NEO::Elf::SHT_PROGBITS, NEO::Elf::SectionsNamesZebin::textPrefix.str() + "kernel_b", isaB);
+    std::string errors, warnings;
+    auto elf = NEO::Elf::decodeElf(zebin.storage, errors, warnings);
+    ASSERT_NE(nullptr, elf.elfFileHeader) << errors << " " << warnings;
+
+    NEO::Yaml::YamlParser parser;
+    bool parseSuccess = parser.parse(zeinfo, errors, warnings);
+    ASSERT_TRUE(parseSuccess) << errors << " " << warnings;
+
+    NEO::ZebinSections zebinSections;
+    auto extractErr = NEO::extractZebinSections(elf, zebinSections, errors, warnings);
+    ASSERT_EQ(NEO::DecodeError::Success, extractErr) << errors << " " << warnings;
+
+    for (const auto &kernelNode : parser.createChildrenRange(*parser.findNodeWithKeyDfs("kernels"))) {
+        auto err = NEO::populateKernelDescriptor(programInfo, elf, zebinSections, parser, kernelNode, errors, warnings);
+        EXPECT_EQ(NEO::DecodeError::Success, err) << errors;
+    }
+    EXPECT_EQ(3U, zebinSections.textKernelSectionsByName.size());
+
+    ASSERT_EQ(3U, programInfo.kernelInfos.size());
+    EXPECT_EQ("kernel_a", programInfo.kernelInfos[0]->kernelDescriptor.kernelMetadata.kernelName);
+    EXPECT_EQ(sizeof(isaA), programInfo.kernelInfos[0]->heapInfo.KernelHeapSize);
+    EXPECT_EQ(isaA[0], *reinterpret_cast<const uint8_t *>(programInfo.kernelInfos[0]->heapInfo.pKernelHeap));
+    EXPECT_EQ("kernel_b", programInfo.kernelInfos[1]->kernelDescriptor.kernelMetadata.kernelName);
+    EXPECT_EQ(sizeof(isaB), programInfo.kernelInfos[1]->heapInfo.KernelHeapSize);
+    EXPECT_EQ(isaB[0], *reinterpret_cast<const uint8_t *>(programInfo.kernelInfos[1]->heapInfo.pKernelHeap));
+    EXPECT_EQ("kernel_c", programInfo.kernelInfos[2]->kernelDescriptor.kernelMetadata.kernelName);
+    EXPECT_EQ(sizeof(isaC), programInfo.kernelInfos[2]->heapInfo.KernelHeapSize);
+    EXPECT_EQ(isaC[0], *reinterpret_cast<const uint8_t *>(programInfo.kernelInfos[2]->heapInfo.pKernelHeap));
+}
+
+TEST(GetKernelTextSection, GivenUnknownKernelNameThenReturnsNullptr) {
+    ZebinTestData::ValidEmptyProgram zebin;
+    zebin.appendSection(NEO::Elf::SHT_PROGBITS, NEO::Elf::SectionsNamesZebin::textPrefix.str() + "some_kernel", {});
+    std::string errors, warnings;
+    auto elf = NEO::Elf::decodeElf(zebin.storage, errors, warnings);
+    ASSERT_NE(nullptr, elf.elfFileHeader) << errors << " " << warnings;
+
+    NEO::ZebinSections zebinSections;
+    auto extractErr = NEO::extractZebinSections(elf, zebinSections, errors, warnings);
+    ASSERT_EQ(NEO::DecodeError::Success, extractErr) << errors << " " << warnings;
+
+    EXPECT_NE(nullptr, NEO::getKernelTextSection(elf, zebinSections, "some_kernel"));
+    EXPECT_EQ(nullptr, NEO::getKernelTextSection(elf, zebinSections, "other_kernel"));
+}
+
 TEST(ReadZeInfoExecutionEnvironment, GivenValidYamlEntriesThenSetProperMembers) {
     NEO::ConstStringRef yaml = R"===(---
 kernels:         
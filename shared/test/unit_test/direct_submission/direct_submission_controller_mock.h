@@ -11,11 +11,16 @@
 
 namespace NEO {
 struct DirectSubmissionControllerMock : public DirectSubmissionController {
+    using DirectSubmissionController::adaptiveTimeout;
     using DirectSubmissionController::checkNewSubmissions;
+    using DirectSubmissionController::DirectSubmissionState;
     using DirectSubmissionController::directSubmissionControllingThread;
     using DirectSubmissionController::directSubmissions;
     using DirectSubmissionController::directSubmissionsMutex;
+    using DirectSubmissionController::getIdleThreshold;
     using DirectSubmissionController::keepControlling;
+    using DirectSubmissionController::ringRestartCost;
+    using DirectSubmissionController::sleepTime;
     using DirectSubmissionController::timeout;
     using DirectSubmissionController::timeoutDivisor;
 
@@ -24,6 +29,11 @@ struct DirectSubmissionControllerMock : public DirectSubmissionController {
         this->sleepCalled = true;
     }
 
+    SteadyClock::time_point getCpuTimestamp() override {
+        return cpuTimestamp;
+    }
+
+    SteadyClock::time_point cpuTimestamp{};
     bool sleepCalled = false;
 };
 } // namespace NEO
\ No newline at end of file
@@ -385,4 +385,75 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerDirectSubmi
     controller.unregisterDirectSubmission(&csr4);
 }
 
+TEST(DirectSubmissionControllerTests, givenAdaptiveTimeoutEnabledWhenRingIsIdleShorterThanItsSubmissionGapsThenItIsNotStopped) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DirectSubmissionControllerAdaptiveTimeout.set(1);
+    DebugManager.flags.DirectSubmissionControllerRingRestartCost.set(100);
+
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::Regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+    csr.taskCount.store(5u);
+
+    DirectSubmissionControllerMock controller;
+    controller.keepControlling.store(false);
+    controller.directSubmissionControllingThread->join();
+    controller.directSubmissionControllingThread.reset();
+    EXPECT_TRUE(controller.adaptiveTimeout);
+    EXPECT_EQ(100, controller.ringRestartCost);
+    controller.registerDirectSubmission(&csr);
+
+    auto start = controller.cpuTimestamp;
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(-1, controller.directSubmissions[&csr].averageSubmissionGap);
+
+    csr.taskCount.store(6u);
+    controller.cpuTimestamp = start + std::chrono::microseconds(50);
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(50, controller.directSubmissions[&csr].averageSubmissionGap);
+    EXPECT_EQ(100, controller.getIdleThreshold(controller.directSubmissions[&csr]));
+    EXPECT_EQ(100, controller.sleepTime);
+
+    controller.cpuTimestamp = start + std::chrono::microseconds(120);
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(30, controller.sleepTime);
+
+    controller.cpuTimestamp = start + std::chrono::microseconds(160);
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_EQ(controller.timeout, controller.sleepTime);
+
+    controller.unregisterDirectSubmission(&csr);
+}
+
+TEST(DirectSubmissionControllerTests, givenAdaptiveTimeoutEnabledWhenSubmissionGapsAreLongThenIdleThresholdIsLimitedByTimeout) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DirectSubmissionControllerAdaptiveTimeout.set(1);
+    DebugManager.flags.DirectSubmissionControllerTimeout.set(1000);
+
+    DirectSubmissionControllerMock controller;
+
+    DirectSubmissionControllerMock::DirectSubmissionState state{};
+    EXPECT_EQ(1000, controller.getIdleThreshold(state));
+
+    state.averageSubmissionGap = 10;
+    EXPECT_EQ(controller.ringRestartCost, controller.getIdleThreshold(state));
+
+    state.averageSubmissionGap = 300;
+    EXPECT_EQ(600, controller.getIdleThreshold(state));
+
+    state.averageSubmissionGap = 3000;
+    EXPECT_EQ(1000, controller.getIdleThreshold(state));
+}
+
 } // namespace NEO
\ No newline at end of file
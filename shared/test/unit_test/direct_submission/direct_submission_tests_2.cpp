@@ -879,3 +879,67 @@ HWTEST_F(DirectSubmissionDispatchBufferTest, givenDebugFlagSetWhenDispatchingWor
         EXPECT_EQ(initialCounterValue + expectedCount, CpuIntrinsicsTests::sfenceCounter);
     }
 }
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenRingDependenciesInBatchBufferWhenDispatchingWorkloadThenSemaphoresArePlacedInRingBeforeBatchBufferStart) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+    using MI_BATCH_BUFFER_START = typename FamilyType::MI_BATCH_BUFFER_START;
+    using Dispatcher = RenderDispatcher<FamilyType>;
+
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_TRUE(directSubmission.allocateResources());
+
+    size_t regularSizeDispatch = directSubmission.getSizeDispatch();
+    EXPECT_EQ(0u, directSubmission.getSizeRingDependenciesSection(batchBuffer));
+
+    batchBuffer.ringDependencies.push_back({5u, 0x1000ull});
+    batchBuffer.ringDependencies.push_back({7u, 0x2000ull});
+    EXPECT_EQ(2 * sizeof(MI_SEMAPHORE_WAIT), directSubmission.getSizeRingDependenciesSection(batchBuffer));
+
+    directSubmission.dispatchWorkloadSection(batchBuffer);
+    EXPECT_EQ(regularSizeDispatch + directSubmission.getSizeRingDependenciesSection(batchBuffer), directSubmission.ringCommandStream.getUsed());
+
+    HardwareParse hwParse;
+    hwParse.parseCommands<FamilyType>(directSubmission.ringCommandStream, 0);
+
+    auto semaphores = findAll<MI_SEMAPHORE_WAIT *>(hwParse.cmdList.begin(), hwParse.cmdList.end());
+    ASSERT_LE(2u, semaphores.size());
+    auto firstSemaphore = genCmdCast<MI_SEMAPHORE_WAIT *>(*semaphores[0]);
+    EXPECT_EQ(0x1000ull, firstSemaphore->getSemaphoreGraphicsAddress());
+    EXPECT_EQ(5u, firstSemaphore->getSemaphoreDataDword());
+    auto secondSemaphore = genCmdCast<MI_SEMAPHORE_WAIT *>(*semaphores[1]);
+    EXPECT_EQ(0x2000ull, secondSemaphore->getSemaphoreGraphicsAddress());
+    EXPECT_EQ(7u, secondSemaphore->getSemaphoreDataDword());
+
+    auto bbStart = find<MI_BATCH_BUFFER_START *>(hwParse.cmdList.begin(), hwParse.cmdList.end());
+    ASSERT_NE(hwParse.cmdList.end(), bbStart);
+    EXPECT_EQ(*semaphores[1], *std::prev(bbStart));
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenDirectSubmissionWhenStartingDispatchingAndStoppingRingThenCountersAreUpdated) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+
+    FlushStampTracker flushStamp(true);
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_TRUE(directSubmission.initialize(true, false));
+
+    auto &counters = directSubmission.getCounters();
+    EXPECT_EQ(1u, counters.ringStarts);
+    EXPECT_EQ(1u, counters.semaphoreSections);
+    EXPECT_EQ(0u, counters.dispatchedBuffers);
+    EXPECT_EQ(directSubmission.getSizePrefetchMitigation(), counters.prefetchMitigationBytes);
+
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_EQ(1u, counters.dispatchedBuffers);
+    EXPECT_EQ(2u, counters.semaphoreSections);
+    EXPECT_EQ(2 * directSubmission.getSizePrefetchMitigation(), counters.prefetchMitigationBytes);
+
+    EXPECT_TRUE(directSubmission.stopRingBuffer());
+    EXPECT_EQ(1u, counters.ringStops);
+
+    directSubmission.switchRingBuffers();
+    EXPECT_EQ(1u, counters.ringSwitches);
+
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_EQ(2u, counters.ringStarts);
+    EXPECT_EQ(2u, counters.dispatchedBuffers);
+}
@@ -6,6 +6,7 @@
  */
 
 #include "shared/source/gmm_helper/gmm_helper.h"
+#include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/hw_helper.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/string.h"
@@ -41,6 +42,45 @@ HWTEST_F(CommandEncodeStatesTest, GivenCommandStreamWhenEncodeCopySamplerStateTh
     EXPECT_EQ(pSmplr->getIndirectStatePointer(), usedBefore);
 }
 
+HWTEST_F(CommandEncodeStatesTest, givenHeapStateDeduplicationEnabledWhenCopyingSamplerSetsWithSameBorderColorThenBorderColorIsWrittenOnceAndSameSetIsReused) {
+    bool deviceUsesDsh = pDevice->getHardwareInfo().capabilityTable.supportsImages;
+    if (!deviceUsesDsh || ApiSpecificConfig::getBindlessConfiguration()) {
+        GTEST_SKIP();
+    }
+    using SAMPLER_STATE = typename FamilyType::SAMPLER_STATE;
+    using SAMPLER_BORDER_COLOR_STATE = typename FamilyType::SAMPLER_BORDER_COLOR_STATE;
+    using INTERFACE_DESCRIPTOR_DATA = typename EncodeStates<FamilyType>::INTERFACE_DESCRIPTOR_DATA;
+    struct alignas(64) SamplerStates {
+        SAMPLER_BORDER_COLOR_STATE borderColor;
+        SAMPLER_STATE samplerState;
+    };
+    SamplerStates firstStates = {};
+    firstStates.borderColor.init();
+    firstStates.samplerState = FamilyType::cmdInitSamplerState;
+    SamplerStates secondStates = firstStates;
+    secondStates.samplerState.setMinModeFilter(SAMPLER_STATE::MIN_MODE_FILTER_LINEAR);
+    auto samplerStateOffset = static_cast<uint32_t>(ptrDiff(&firstStates.samplerState, &firstStates));
+
+    cmdContainer->setHeapStateDeduplicationEnabled(true);
+    auto dsh = cmdContainer->getIndirectHeap(HeapType::DYNAMIC_STATE);
+    auto &hwInfo = pDevice->getHardwareInfo();
+
+    auto firstOffset = EncodeStates<FamilyType>::copyDeduplicatedSamplerState(*cmdContainer, dsh, samplerStateOffset, 1, 0, &firstStates, nullptr, hwInfo);
+    auto usedAfterFirstCopy = dsh->getUsed();
+    auto secondOffset = EncodeStates<FamilyType>::copyDeduplicatedSamplerState(*cmdContainer, dsh, samplerStateOffset, 1, 0, &secondStates, nullptr, hwInfo);
+    auto usedAfterSecondCopy = dsh->getUsed();
+    EXPECT_NE(firstOffset, secondOffset);
+    EXPECT_LE(usedAfterSecondCopy - usedAfterFirstCopy, alignUp(sizeof(SAMPLER_STATE), INTERFACE_DESCRIPTOR_DATA::SAMPLERSTATEPOINTER_ALIGN_SIZE));
+
+    auto firstSamplerState = reinterpret_cast<SAMPLER_STATE *>(ptrOffset(dsh->getCpuBase(), firstOffset));
+    auto secondSamplerState = reinterpret_cast<SAMPLER_STATE *>(ptrOffset(dsh->getCpuBase(), secondOffset));
+    EXPECT_EQ(firstSamplerState->getIndirectStatePointer(), secondSamplerState->getIndirectStatePointer());
+    EXPECT_EQ(SAMPLER_STATE::MIN_MODE_FILTER_LINEAR, secondSamplerState->getMinModeFilter());
+
+    EXPECT_EQ(secondOffset, EncodeStates<FamilyType>::copyDeduplicatedSamplerState(*cmdContainer, dsh, samplerStateOffset, 1, 0, &secondStates, nullptr, hwInfo));
+    EXPECT_EQ(usedAfterSecondCopy, dsh->getUsed());
+}
+
 HWTEST2_F(CommandEncodeStatesTest, givenDebugVariableSetWhenCopyingSamplerStateThenSetLowQualityFilterMode, IsAtLeastGen12lp) {
     bool deviceUsesDsh = pDevice->getHardwareInfo().capabilityTable.supportsImages;
     if (!deviceUsesDsh) {
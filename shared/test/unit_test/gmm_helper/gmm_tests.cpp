@@ -7,7 +7,11 @@
 
 #include "shared/source/gmm_helper/gmm.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
+#include "shared/source/gmm_helper/image_resource_info_cache.h"
+#include "shared/source/gmm_helper/resource_info.h"
 #include "shared/test/common/fixtures/mock_execution_environment_gmm_fixture.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/default_hw_info.h"
 #include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/mocks/mock_gmm.h"
 #include "shared/test/common/test_macros/test.h"
@@ -34,4 +38,74 @@ TEST_F(GmmTests, givenResourceUsageTypesUnCachedWhenGreateGmmThenFlagCachcableIs
         EXPECT_FALSE(gmm->resourceParams.Flags.Info.Cacheable);
     }
 }
+
+class MockImageResourceInfoCache : public ImageResourceInfoCache {
+  public:
+    using ImageResourceInfoCache::entries;
+    using ImageResourceInfoCache::ImageResourceInfoCache;
+};
+
+TEST(GmmHelperTest, givenImageResourceInfoCacheSizeWhenCreatingGmmHelperThenCacheIsCreatedOnlyWhenSizeIsPositive) {
+    DebugManagerStateRestore restore;
+    EXPECT_EQ(nullptr, GmmHelper(nullptr, defaultHwInfo.get()).getImageResourceInfoCache());
+
+    DebugManager.flags.ImageResourceInfoCacheSize.set(4);
+    EXPECT_NE(nullptr, GmmHelper(nullptr, defaultHwInfo.get()).getImageResourceInfoCache());
+}
+
+TEST_F(GmmTests, givenImageResourceInfoCacheWhenCreatingImagesWithSameDescriptorThenResourceInfoIsCopiedAndLayoutIsTheSame) {
+    MockImageResourceInfoCache cache(2u);
+    ImageDescriptor imgDesc = {};
+    imgDesc.imageType = ImageType::Image2D;
+    imgDesc.imageWidth = 64;
+    imgDesc.imageHeight = 33;
+    auto imgInfo = MockGmm::initImgInfo(imgDesc, 0, nullptr);
+    auto gmm = MockGmm::queryImgParams(getGmmHelper(), imgInfo, false);
+
+    std::unique_ptr<GmmResourceInfo> first(cache.create(getGmmHelper()->getClientContext(), &gmm->resourceParams));
+    ASSERT_EQ(1u, cache.entries.size());
+    auto cachedResourceInfo = cache.entries[0].second.get();
+    std::unique_ptr<GmmResourceInfo> second(cache.create(getGmmHelper()->getClientContext(), &gmm->resourceParams));
+    EXPECT_EQ(1u, cache.entries.size());
+
+    EXPECT_NE(first.get(), second.get());
+    EXPECT_NE(cachedResourceInfo, second.get());
+    EXPECT_EQ(first->getSizeAllocation(), second->getSizeAllocation());
+    EXPECT_EQ(first->getRenderPitch(), second->getRenderPitch());
+    EXPECT_EQ(first->getQPitch(), second->getQPitch());
+}
+
+TEST_F(GmmTests, givenFullImageResourceInfoCacheWhenCreatingImageWithNewDescriptorThenOldestEntryIsEvicted) {
+    MockImageResourceInfoCache cache(2u);
+    std::unique_ptr<Gmm> gmms[3];
+    for (size_t i = 0; i < 3; i++) {
+        ImageDescriptor imgDesc = {};
+        imgDesc.imageType = ImageType::Image2D;
+        imgDesc.imageWidth = 16 * (i + 1);
+        imgDesc.imageHeight = 16;
+        auto imgInfo = MockGmm::initImgInfo(imgDesc, 0, nullptr);
+        gmms[i] = MockGmm::queryImgParams(getGmmHelper(), imgInfo, false);
+        std::unique_ptr<GmmResourceInfo> resourceInfo(cache.create(getGmmHelper()->getClientContext(), &gmms[i]->resourceParams));
+        EXPECT_NE(nullptr, resourceInfo);
+    }
+
+    ASSERT_EQ(2u, cache.entries.size());
+    EXPECT_EQ(32u, cache.entries[0].first.BaseWidth64);
+    EXPECT_EQ(48u, cache.entries[1].first.BaseWidth64);
+}
+
+TEST_F(GmmTests, givenResourceParamsWithExistingSysMemWhenCreatingThroughImageResourceInfoCacheThenResourceInfoIsNotCached) {
+    MockImageResourceInfoCache cache(2u);
+    ImageDescriptor imgDesc = {};
+    imgDesc.imageType = ImageType::Image2D;
+    imgDesc.imageWidth = 16;
+    imgDesc.imageHeight = 16;
+    auto imgInfo = MockGmm::initImgInfo(imgDesc, 0, nullptr);
+    auto gmm = MockGmm::queryImgParams(getGmmHelper(), imgInfo, false);
+    gmm->resourceParams.Flags.Info.ExistingSysMem = 1;
+
+    std::unique_ptr<GmmResourceInfo> resourceInfo(cache.create(getGmmHelper()->getClientContext(), &gmm->resourceParams));
+    EXPECT_NE(nullptr, resourceInfo);
+    EXPECT_EQ(0u, cache.entries.size());
+}
 } // namespace NEO
@@ -167,8 +167,8 @@ TEST_F(BindlessHeapsHelperTests, givenBindlessHeapHelperWhenFreeGraphicsMemoryIs
     size_t size = 0x40;
     auto ssinHeapInfo = bindlessHeapHelperPtr->allocateSSInHeap(size, alloc, BindlessHeapsHelper::BindlesHeapType::GLOBAL_SSH);
     memManager->freeGraphicsMemory(alloc);
-    EXPECT_EQ(bindlessHeapHelperPtr->surfaceStateInHeapVectorReuse.size(), 1u);
-    auto ssInHeapInfoFromReuseVector = bindlessHeapHelperPtr->surfaceStateInHeapVectorReuse.front().get();
+    EXPECT_EQ(bindlessHeapHelperPtr->surfaceStateInHeapVectorReuse[size].size(), 1u);
+    auto ssInHeapInfoFromReuseVector = bindlessHeapHelperPtr->surfaceStateInHeapVectorReuse[size].front().get();
     EXPECT_EQ(ssInHeapInfoFromReuseVector->surfaceStateOffset, ssinHeapInfo.surfaceStateOffset);
     EXPECT_EQ(ssInHeapInfoFromReuseVector->ssPtr, ssinHeapInfo.ssPtr);
 }
@@ -183,10 +183,10 @@ TEST_F(BindlessHeapsHelperTests, givenBindlessHeapHelperPreviousAllocationThenIt
     size_t size = 0x40;
     auto ssInHeapInfo = bindlessHeapHelperPtr->allocateSSInHeap(size, alloc, BindlessHeapsHelper::BindlesHeapType::GLOBAL_SSH);
     memManager->freeGraphicsMemory(alloc);
-    EXPECT_EQ(bindlessHeapHelperPtr->surfaceStateInHeapVectorReuse.size(), 1u);
+    EXPECT_EQ(bindlessHeapHelperPtr->surfaceStateInHeapVectorReuse[size].size(), 1u);
     MockGraphicsAllocation *alloc2 = new MockGraphicsAllocation;
     auto reusedSSinHeapInfo = bindlessHeapHelperPtr->allocateSSInHeap(size, alloc2, BindlessHeapsHelper::BindlesHeapType::GLOBAL_SSH);
-    EXPECT_EQ(bindlessHeapHelperPtr->surfaceStateInHeapVectorReuse.size(), 0u);
+    EXPECT_EQ(bindlessHeapHelperPtr->surfaceStateInHeapVectorReuse[size].size(), 0u);
     EXPECT_EQ(ssInHeapInfo.surfaceStateOffset, reusedSSinHeapInfo.surfaceStateOffset);
     EXPECT_EQ(ssInHeapInfo.ssPtr, reusedSSinHeapInfo.ssPtr);
     memManager->freeGraphicsMemory(alloc2);
@@ -198,3 +198,55 @@ TEST_F(BindlessHeapsHelperTests, givenDeviceWhenBindlessHeapHelperInitializedThe
     auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(pDevice->getMemoryManager(), pDevice->getNumGenericSubDevices() > 1, pDevice->getRootDeviceIndex(), devBitfield);
     EXPECT_EQ(reinterpret_cast<MockMemoryManager *>(pDevice->getMemoryManager())->recentlyPassedDeviceBitfield, devBitfield);
 }
+
+TEST_F(BindlessHeapsHelperTests, givenSurfaceStateOfAllocationStillUsedByGpuWhenAllocationIsFreedThenSlotIsReusedOnlyAfterTaskCountCompletes) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.UseBindlessMode.set(1);
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(pDevice->getMemoryManager(), pDevice->getNumGenericSubDevices() > 1, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    MockBindlesHeapsHelper *bindlessHeapHelperPtr = bindlessHeapHelper.get();
+    pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]->bindlessHeapsHelper.reset(bindlessHeapHelper.release());
+
+    auto &engine = pDevice->getDefaultEngine();
+    auto tagAddress = engine.commandStreamReceiver->getTagAddress();
+    *tagAddress = 0u;
+
+    MockGraphicsAllocation *alloc = new MockGraphicsAllocation;
+    alloc->updateTaskCount(5u, engine.osContext->getContextId());
+    size_t size = 0x40;
+    auto ssInHeapInfo = bindlessHeapHelperPtr->allocateSSInHeap(size, alloc, BindlessHeapsHelper::BindlesHeapType::GLOBAL_SSH);
+    memManager->freeGraphicsMemory(alloc);
+    EXPECT_EQ(0u, bindlessHeapHelperPtr->surfaceStateInHeapVectorReuse[size].size());
+    EXPECT_EQ(1u, bindlessHeapHelperPtr->surfaceStateInHeapPendingReuse.size());
+
+    MockGraphicsAllocation alloc2;
+    auto ssInHeapInfo2 = bindlessHeapHelperPtr->allocateSSInHeap(size, &alloc2, BindlessHeapsHelper::BindlesHeapType::GLOBAL_SSH);
+    EXPECT_NE(ssInHeapInfo.surfaceStateOffset, ssInHeapInfo2.surfaceStateOffset);
+    EXPECT_EQ(1u, bindlessHeapHelperPtr->surfaceStateInHeapPendingReuse.size());
+
+    *tagAddress = 5u;
+    MockGraphicsAllocation alloc3;
+    auto ssInHeapInfo3 = bindlessHeapHelperPtr->allocateSSInHeap(size, &alloc3, BindlessHeapsHelper::BindlesHeapType::GLOBAL_SSH);
+    EXPECT_EQ(ssInHeapInfo.surfaceStateOffset, ssInHeapInfo3.surfaceStateOffset);
+    EXPECT_EQ(ssInHeapInfo.ssPtr, ssInHeapInfo3.ssPtr);
+    EXPECT_EQ(0u, bindlessHeapHelperPtr->surfaceStateInHeapPendingReuse.size());
+    EXPECT_EQ(0u, bindlessHeapHelperPtr->surfaceStateInHeapVectorReuse[size].size());
+}
+
+TEST_F(BindlessHeapsHelperTests, givenFreedSurfaceStateOfDifferentSizeWhenAllocatingSurfaceStateThenSlotIsNotReused) {
+    DebugManagerStateRestore dbgRestorer;
+    DebugManager.flags.UseBindlessMode.set(1);
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(pDevice->getMemoryManager(), pDevice->getNumGenericSubDevices() > 1, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    MockBindlesHeapsHelper *bindlessHeapHelperPtr = bindlessHeapHelper.get();
+    pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]->bindlessHeapsHelper.reset(bindlessHeapHelper.release());
+
+    MockGraphicsAllocation *alloc = new MockGraphicsAllocation;
+    auto ssInHeapInfo = bindlessHeapHelperPtr->allocateSSInHeap(0x40, alloc, BindlessHeapsHelper::BindlesHeapType::GLOBAL_SSH);
+    memManager->freeGraphicsMemory(alloc);
+    EXPECT_EQ(1u, bindlessHeapHelperPtr->surfaceStateInHeapVectorReuse[0x40].size());
+
+    MockGraphicsAllocation alloc2;
+    auto ssInHeapInfo2 = bindlessHeapHelperPtr->allocateSSInHeap(0x80, &alloc2, BindlessHeapsHelper::BindlesHeapType::GLOBAL_SSH);
+    EXPECT_NE(ssInHeapInfo.surfaceStateOffset, ssInHeapInfo2.surfaceStateOffset);
+    EXPECT_EQ(0x80u, ssInHeapInfo2.ssSize);
+    EXPECT_EQ(1u, bindlessHeapHelperPtr->surfaceStateInHeapVectorReuse[0x40].size());
+}
@@ -9,6 +9,10 @@
 
 #include "gtest/gtest.h"
 
+#include <set>
+#include <string>
+#include <vector>
+
 using namespace NEO;
 
 TEST(HashTests, givenSamePointersWhenHashIsCalculatedThenSame32BitValuesAreGenerated) {
@@ -34,3 +38,45 @@ TEST(HashTests, givenDifferentPointersWhenHashIsCalculatedThenUnique32BitValuesA
 
     EXPECT_NE(hash1, hash2);
 }
+
+TEST(FastHashTests, givenSameInputWhenHashIsCalculatedThenSameDigestIsGenerated) {
+    const char input[] = "__kernel void test(__global int *dst) { dst[0] = 0; }";
+
+    auto digest1 = FastHash::hash(input, sizeof(input));
+    auto digest2 = FastHash::hash(input, sizeof(input));
+
+    EXPECT_EQ(digest1, digest2);
+    EXPECT_NE(digest1.low, digest1.high);
+}
+
+TEST(FastHashTests, givenInputSplitIntoChunksWhenHashIsUpdatedIncrementallyThenDigestMatchesSingleUpdate) {
+    std::vector<char> input(1000);
+    for (size_t i = 0; i < input.size(); i++) {
+        input[i] = static_cast<char>(i * 31);
+    }
+    auto expectedDigest = FastHash::hash(input.data(), input.size());
+
+    for (size_t chunkSize : {1u, 7u, 31u, 32u, 33u, 500u}) {
+        FastHash hash;
+        for (size_t offset = 0; offset < input.size(); offset += chunkSize) {
+            hash.update(input.data() + offset, std::min(chunkSize, input.size() - offset));
+        }
+        EXPECT_EQ(expectedDigest, hash.finish()) << chunkSize;
+    }
+}
+
+TEST(FastHashTests, givenDifferentInputsWhenHashIsCalculatedThenUniqueDigestsAreGenerated) {
+    std::set<std::pair<uint64_t, uint64_t>> digests;
+    std::string input(64, 'a');
+    for (size_t size = 0; size <= input.size(); size++) {
+        for (char value : {'a', 'b'}) {
+            auto modifiedInput = input.substr(0, size);
+            if (size > 0) {
+                modifiedInput[size / 2] = value;
+            }
+            auto digest = FastHash::hash(modifiedInput.c_str(), modifiedInput.size());
+            digests.insert({digest.low, digest.high});
+        }
+    }
+    EXPECT_EQ(2 * input.size() + 1, digests.size());
+}
@@ -1209,3 +1209,45 @@ HWTEST2_F(BlitTests, givenDebugVariableWhenDispatchBlitCommandsForImageRegionIsC
                    << "DestinationArrayIndex: 1\n\n";
     EXPECT_EQ(expectedOutput.str(), output);
 }
+
+HWTEST2_F(BlitTests, givenLinearImageWhenDispatchBlitCommandsForImageFillThenColorBltIsProgrammedForEachSlice, IsXeHPOrAbove) {
+    using XY_COLOR_BLT = typename FamilyType::XY_COLOR_BLT;
+    EXPECT_TRUE(BlitCommandsHelper<FamilyType>::isImageFillSupported());
+
+    uint32_t streamBuffer[200] = {};
+    LinearStream stream(streamBuffer, sizeof(streamBuffer));
+    MockGraphicsAllocation dstAlloc(reinterpret_cast<void *>(0x1000), 0x10000);
+
+    BlitProperties blitProperties{};
+    blitProperties.blitDirection = BlitterConstants::BlitDirection::ImageFill;
+    blitProperties.dstAllocation = &dstAlloc;
+    blitProperties.srcAllocation = &dstAlloc;
+    blitProperties.dstGpuAddress = dstAlloc.getGpuAddress();
+    blitProperties.dstOffset = {1, 2, 1};
+    blitProperties.copySize = {4, 3, 2};
+    blitProperties.dstSize = {8, 8, 4};
+    blitProperties.bytesPerPixel = 4;
+    blitProperties.dstRowPitch = 8 * 4;
+    blitProperties.dstSlicePitch = 8 * 8 * 4;
+    blitProperties.fillPattern = {0x11223344u, 0, 0, 0};
+
+    BlitCommandsHelper<FamilyType>::dispatchBlitCommands(blitProperties, stream, *pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]);
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::PARSE::parseCommandBuffer(cmdList, stream.getCpuBase(), stream.getUsed()));
+    auto colorBlts = findAll<XY_COLOR_BLT *>(cmdList.begin(), cmdList.end());
+    ASSERT_EQ(2u, colorBlts.size());
+
+    for (uint32_t i = 0; i < colorBlts.size(); i++) {
+        auto cmd = genCmdCast<XY_COLOR_BLT *>(*colorBlts[i]);
+        EXPECT_EQ(XY_COLOR_BLT::COLOR_DEPTH::COLOR_DEPTH_32_BIT_COLOR, cmd->getColorDepth());
+        EXPECT_EQ(XY_COLOR_BLT::DESTINATION_TILING::DESTINATION_TILING_LINEAR, cmd->getDestinationTiling());
+        EXPECT_EQ(0x11223344u, cmd->TheStructure.Common.FillColor[0]);
+        EXPECT_EQ(1u, cmd->getDestinationX1CoordinateLeft());
+        EXPECT_EQ(2u, cmd->getDestinationY1CoordinateTop());
+        EXPECT_EQ(5u, cmd->getDestinationX2CoordinateRight());
+        EXPECT_EQ(5u, cmd->getDestinationY2CoordinateBottom());
+        EXPECT_EQ(32u, cmd->getDestinationPitch());
+        EXPECT_EQ(dstAlloc.getGpuAddress() + (i + 1) * blitProperties.dstSlicePitch, cmd->getDestinationBaseAddress());
+    }
+}
@@ -197,6 +197,48 @@ HWTEST_F(TimestampPacketTests, whenEstimatingSizeForNodeDependencyThenReturnCorr
     EXPECT_EQ(expectedSize, sizeForNodeDependency);
 }
 
+TEST_F(TimestampPacketTests, givenMultiplePacketsUsedWhenCheckingCompletionThenAllUsedPacketsAreReduced) {
+    TimestampPackets<uint32_t> tag;
+    MockTagNode mockNode;
+    mockNode.tagForCpuAccess = &tag;
+    mockNode.setPacketsUsed(TimestampPacketSizeControl::preferredPacketCount);
+
+    uint32_t packetData[4] = {0, 0, 0, 0};
+    for (uint32_t i = 0; i < TimestampPacketSizeControl::preferredPacketCount - 1; i++) {
+        tag.assignDataToAllTimestamps(i, packetData);
+    }
+    EXPECT_FALSE(mockNode.isCompleted());
+
+    mockNode.setPacketsUsed(TimestampPacketSizeControl::preferredPacketCount - 1);
+    EXPECT_TRUE(mockNode.isCompleted());
+
+    tag.assignDataToAllTimestamps(TimestampPacketSizeControl::preferredPacketCount - 1, packetData);
+    mockNode.setPacketsUsed(TimestampPacketSizeControl::preferredPacketCount);
+    EXPECT_TRUE(mockNode.isCompleted());
+}
+
+TEST_F(TimestampPacketTests, givenMultiplePacketsUsedWhenGettingGlobalStartEndRangeThenMinimalStartAndMaximalEndAreReturned) {
+    TimestampPackets<uint32_t> tag;
+    MockTagNode mockNode;
+    mockNode.tagForCpuAccess = &tag;
+    mockNode.setPacketsUsed(3);
+
+    uint32_t packet0[4] = {10, 20, 30, 40};
+    uint32_t packet1[4] = {5, 15, 50, 60};
+    uint32_t packet2[4] = {1, 25, 35, 45};
+    uint32_t unusedPacket[4] = {0, 0, 100, 100};
+    tag.assignDataToAllTimestamps(0, packet0);
+    tag.assignDataToAllTimestamps(1, packet1);
+    tag.assignDataToAllTimestamps(2, packet2);
+    tag.assignDataToAllTimestamps(3, unusedPacket);
+
+    uint64_t globalStart = 0;
+    uint64_t globalEnd = 0;
+    mockNode.getGlobalStartEndRange(globalStart, globalEnd);
+    EXPECT_EQ(15u, globalStart);
+    EXPECT_EQ(60u, globalEnd);
+}
+
 struct DeviceTimestampPacketTests : public ::testing::Test, DeviceFixture {
     DebugManagerStateRestore restore{};
     ExecutionEnvironment *executionEnvironment{nullptr};
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/work_group_size_cache.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace NEO;
+
+TEST(WorkGroupSizeCacheTest, GivenStoredWorkGroupSizeWhenFindingWithSameKeyThenStoredValueIsReturned) {
+    WorkGroupSizeCache cache;
+    WorkGroupSizeCacheKey key;
+    key.globalSize[0] = 1024u;
+    key.globalSize[1] = 1u;
+    key.globalSize[2] = 1u;
+    key.maxWorkGroupSize = 256u;
+    key.workDim = 1u;
+
+    size_t workGroupSize[3] = {};
+    EXPECT_FALSE(cache.find(key, workGroupSize));
+
+    size_t storedWorkGroupSize[3] = {128u, 1u, 1u};
+    cache.store(key, storedWorkGroupSize);
+    EXPECT_TRUE(cache.find(key, workGroupSize));
+    EXPECT_EQ(128u, workGroupSize[0]);
+    EXPECT_EQ(1u, workGroupSize[1]);
+    EXPECT_EQ(1u, workGroupSize[2]);
+
+    auto otherKey = key;
+    otherKey.slmTotalSize = 1024u;
+    EXPECT_FALSE(cache.find(otherKey, workGroupSize));
+}
+
+TEST(WorkGroupSizeCacheTest, GivenDifferentLwsAlgorithmWhenFindingStoredWorkGroupSizeThenItIsNotReturned) {
+    DebugManagerStateRestore restorer;
+    WorkGroupSizeCache cache;
+    WorkGroupSizeCacheKey key;
+    key.globalSize[0] = 1024u;
+
+    size_t workGroupSize[3] = {128u, 1u, 1u};
+    cache.store(key, workGroupSize);
+
+    DebugManager.flags.EnableComputeWorkSizeND.set(!DebugManager.flags.EnableComputeWorkSizeND.get());
+    WorkGroupSizeCacheKey keyWithOtherAlgorithm;
+    keyWithOtherAlgorithm.globalSize[0] = 1024u;
+    EXPECT_FALSE(cache.find(keyWithOtherAlgorithm, workGroupSize));
+}
+
+TEST(WorkGroupSizeCacheTest, GivenFullCacheWhenStoringNewEntryThenOldestEntryIsEvicted) {
+    WorkGroupSizeCache cache;
+    WorkGroupSizeCacheKey key;
+    size_t workGroupSize[3] = {1u, 1u, 1u};
+    for (size_t i = 0; i <= WorkGroupSizeCache::maxEntries; i++) {
+        key.globalSize[0] = i + 1;
+        cache.store(key, workGroupSize);
+    }
+
+    key.globalSize[0] = 1u;
+    EXPECT_FALSE(cache.find(key, workGroupSize));
+    key.globalSize[0] = 2u;
+    EXPECT_TRUE(cache.find(key, workGroupSize));
+    key.globalSize[0] = WorkGroupSizeCache::maxEntries + 1;
+    EXPECT_TRUE(cache.find(key, workGroupSize));
+}
+
+TEST(WorkGroupSizeCacheTest, givenDefaultDebugFlagsThenCacheIsEnabledAndProfileIsNotLoaded) {
+    EXPECT_TRUE(WorkGroupSizeCache::isEnabled());
+    EXPECT_EQ(nullptr, WorkGroupSizeProfile::get());
+
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableWorkGroupSizeCache.set(0);
+    EXPECT_FALSE(WorkGroupSizeCache::isEnabled());
+}
+
+TEST(WorkGroupSizeProfileTest, GivenProfileDataWhenFindingWorkGroupSizeThenMatchingValidEntryIsReturned) {
+    const char profileData[] = "# kernel gws lws\n"
+                               "kernelA 1024 1 1 64 1 1\n"
+                               "kernelA 64 64 1 16 8 1\n"
+                               "kernelA 96 1 1 64 1 1\n"
+                               "kernelB 1024 1 1 512 1 1\n"
+                               "malformed 1024 1\n";
+    WorkGroupSizeProfile profile;
+    profile.parse(profileData, strlen(profileData));
+
+    size_t workGroupSize[3] = {};
+    size_t globalSize[3] = {1024u, 1u, 1u};
+    EXPECT_TRUE(profile.find("kernelA", globalSize, 256u, workGroupSize));
+    EXPECT_EQ(64u, workGroupSize[0]);
+    EXPECT_EQ(1u, workGroupSize[1]);
+    EXPECT_EQ(1u, workGroupSize[2]);
+
+    size_t globalSize2D[3] = {64u, 64u, 1u};
+    EXPECT_TRUE(profile.find("kernelA", globalSize2D, 256u, workGroupSize));
+    EXPECT_EQ(16u, workGroupSize[0]);
+    EXPECT_EQ(8u, workGroupSize[1]);
+
+    size_t notDivisibleGlobalSize[3] = {96u, 1u, 1u};
+    EXPECT_FALSE(profile.find("kernelA", notDivisibleGlobalSize, 256u, workGroupSize));
+    EXPECT_FALSE(profile.find("kernelB", globalSize, 256u, workGroupSize));
+    EXPECT_FALSE(profile.find("kernelC", globalSize, 256u, workGroupSize));
+    EXPECT_FALSE(profile.find("malformed", globalSize, 256u, workGroupSize));
+}
+
+TEST(WorkGroupSizeCandidatesTest, GivenWorkGroupSizeWhenGeneratingCandidatesThenItIsFirstAndOthersDivideGlobalSize) {
+    std::vector<Vec3<size_t>> candidates;
+    size_t globalSize[3] = {96u, 8u, 1u};
+    size_t workGroupSize[3] = {32u, 2u, 1u};
+    generateWorkGroupSizeCandidates(candidates, globalSize, 2u, workGroupSize, 16u, 64u, 16u);
+
+    ASSERT_LE(2u, candidates.size());
+    EXPECT_EQ(Vec3<size_t>(32u, 2u, 1u), candidates[0]);
+    for (const auto &candidate : candidates) {
+        EXPECT_EQ(0u, globalSize[0] % candidate.x);
+        EXPECT_EQ(0u, globalSize[1] % candidate.y);
+        EXPECT_GE(64u, candidate.x * candidate.y * candidate.z);
+    }
+    EXPECT_NE(candidates.end(), std::find(candidates.begin(), candidates.end(), Vec3<size_t>(16u, 2u, 1u)));
+    EXPECT_NE(candidates.end(), std::find(candidates.begin(), candidates.end(), Vec3<size_t>(32u, 1u, 1u)));
+
+    candidates.clear();
+    generateWorkGroupSizeCandidates(candidates, globalSize, 2u, workGroupSize, 16u, 64u, 2u);
+    EXPECT_EQ(2u, candidates.size());
+}
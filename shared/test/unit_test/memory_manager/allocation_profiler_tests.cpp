@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/allocation_profiler.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/mocks/mock_graphics_allocation.h"
+#include "shared/test/common/mocks/mock_memory_manager.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+class WhiteBoxAllocationProfiler : public AllocationProfiler {
+  public:
+    using AllocationProfiler::aliveAllocations;
+};
+
+class MockAllocationProfiler : public AllocationProfiler {
+  public:
+    using AllocationProfiler::AllocationProfiler;
+    using AllocationProfiler::aliveAllocations;
+    using AllocationProfiler::hotspots;
+
+    CallStack captureCallStack() override {
+        captureCallStackCalled++;
+        return callStackToReturn;
+    }
+
+    uint32_t captureCallStackCalled = 0u;
+    CallStack callStackToReturn = {reinterpret_cast<void *>(0x1000), reinterpret_cast<void *>(0x2000)};
+};
+
+TEST(AllocationProfilerTest, givenDefaultSettingsWhenCreatingProfilerThenNothingIsCreated) {
+    EXPECT_EQ(nullptr, AllocationProfiler::create());
+
+    MockMemoryManager memoryManager;
+    EXPECT_EQ(nullptr, memoryManager.getAllocationProfiler());
+}
+
+TEST(AllocationProfilerTest, givenRecordedAllocationsWhenGettingReportThenAliveBytesPerTypeAndHistogramsAreReported) {
+    MockAllocationProfiler profiler(0u, "");
+    MockGraphicsAllocation buffer(nullptr, MemoryConstants::pageSize);
+    buffer.allocationType = AllocationType::BUFFER;
+    MockGraphicsAllocation image(nullptr, 3 * MemoryConstants::pageSize);
+    image.allocationType = AllocationType::IMAGE;
+
+    profiler.recordAllocation(buffer);
+    profiler.recordAllocation(buffer);
+    profiler.recordAllocation(image);
+    profiler.recordFree(buffer);
+    profiler.recordFree(buffer);
+
+    EXPECT_EQ(1u, profiler.aliveAllocations.size());
+    EXPECT_EQ(0u, profiler.captureCallStackCalled);
+
+    auto report = profiler.getReport();
+    EXPECT_NE(std::string::npos, report.find("Allocation profile: 1 allocations alive"));
+    EXPECT_NE(std::string::npos, report.find("BUFFER: allocated 1, freed 1, alive 0 bytes, peak alive 4096 bytes"));
+    EXPECT_NE(std::string::npos, report.find("IMAGE: allocated 1, freed 0, alive 12288 bytes, peak alive 12288 bytes"));
+    EXPECT_NE(std::string::npos, report.find("[4096, 8192): 1"));
+    EXPECT_NE(std::string::npos, report.find("[8192, 16384): 1"));
+}
+
+TEST(AllocationProfilerTest, givenSamplingIntervalWhenRecordingAllocationsThenCallStackOfEveryNthAllocationIsAggregated) {
+    MockAllocationProfiler profiler(2u, "");
+    MockGraphicsAllocation allocations[5];
+
+    for (auto &allocation : allocations) {
+        allocation.size = MemoryConstants::pageSize;
+        profiler.recordAllocation(allocation);
+    }
+
+    EXPECT_EQ(3u, profiler.captureCallStackCalled);
+    ASSERT_EQ(1u, profiler.hotspots.size());
+    EXPECT_EQ(3u, profiler.hotspots.begin()->second.allocationsCount);
+    EXPECT_EQ(3 * MemoryConstants::pageSize, profiler.hotspots.begin()->second.bytes);
+    EXPECT_NE(std::string::npos, profiler.getReport().find("#0: 3 allocations, 12288 bytes"));
+}
+
+TEST(AllocationProfilerTest, givenRequestedDumpWhenNextAllocationIsRecordedThenReportIsPrinted) {
+    MockAllocationProfiler profiler(0u, "");
+    MockGraphicsAllocation allocation;
+
+    testing::internal::CaptureStdout();
+    profiler.recordAllocation(allocation);
+    EXPECT_TRUE(testing::internal::GetCapturedStdout().empty());
+
+    AllocationProfiler::requestDump();
+    testing::internal::CaptureStdout();
+    profiler.recordFree(allocation);
+    auto output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("Allocation profile: 1 allocations alive"));
+
+    testing::internal::CaptureStdout();
+    profiler.recordAllocation(allocation);
+    EXPECT_TRUE(testing::internal::GetCapturedStdout().empty());
+}
+
+TEST(AllocationProfilerTest, givenProfilerEnabledWhenMemoryManagerAllocatesAndFreesThenAllocationsAreProfiledAndLeaksReportedOnDestruction) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.AllocationProfilerSamplingInterval.set(0);
+
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
+    auto memoryManager = std::make_unique<MockMemoryManager>(false, false, executionEnvironment);
+    auto profiler = static_cast<WhiteBoxAllocationProfiler *>(memoryManager->getAllocationProfiler());
+    ASSERT_NE(nullptr, profiler);
+
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties({mockRootDeviceIndex, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    ASSERT_NE(nullptr, allocation);
+    auto leakedAllocation = memoryManager->allocateGraphicsMemoryWithProperties({mockRootDeviceIndex, MemoryConstants::pageSize, AllocationType::BUFFER, mockDeviceBitfield});
+    ASSERT_NE(nullptr, leakedAllocation);
+    EXPECT_EQ(2u, profiler->aliveAllocations.size());
+
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(1u, profiler->aliveAllocations.size());
+
+    testing::internal::CaptureStdout();
+    memoryManager->freeGraphicsMemoryImpl(leakedAllocation);
+    memoryManager.reset();
+    auto output = testing::internal::GetCapturedStdout();
+    EXPECT_NE(std::string::npos, output.find("BUFFER: allocated 2, freed 1, alive 4096 bytes"));
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/memory_manager/compression_selector.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/mocks/mock_gmm.h"
+#include "shared/test/common/mocks/mock_graphics_allocation.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+struct CompressionHostAccessTrackerTest : public ::testing::Test {
+    void SetUp() override {
+        gmm = std::make_unique<MockGmm>(executionEnvironment.rootDeviceEnvironments[0]->getGmmHelper());
+        gmm->isCompressionEnabled = true;
+        compressedBuffer.setGmm(gmm.get(), 0);
+    }
+
+    MockExecutionEnvironment executionEnvironment;
+    std::unique_ptr<MockGmm> gmm;
+    MockGraphicsAllocation compressedBuffer;
+    CompressionHostAccessTracker tracker;
+};
+
+TEST_F(CompressionHostAccessTrackerTest, givenCompressedBufferAccessedOnHostMoreOftenThanAllocatedWhenCheckingHostAccessThenItIsFrequent) {
+    compressedBuffer.allocationType = AllocationType::BUFFER;
+    tracker.recordCompressedAllocation(compressedBuffer);
+    for (uint32_t i = 0; i < CompressionHostAccessTracker::minHostAccessesCount - 1; i++) {
+        tracker.recordHostAccess(compressedBuffer);
+    }
+    EXPECT_FALSE(tracker.isHostAccessFrequent(AllocationType::BUFFER));
+
+    tracker.recordHostAccess(compressedBuffer);
+    EXPECT_TRUE(tracker.isHostAccessFrequent(AllocationType::BUFFER));
+    EXPECT_FALSE(tracker.isHostAccessFrequent(AllocationType::SVM_GPU));
+}
+
+TEST_F(CompressionHostAccessTrackerTest, givenUncompressedOrNonBufferAllocationWhenRecordingHostAccessThenItIsNotCounted) {
+    MockGraphicsAllocation uncompressedBuffer;
+    uncompressedBuffer.allocationType = AllocationType::BUFFER;
+    compressedBuffer.allocationType = AllocationType::IMAGE;
+    for (uint32_t i = 0; i < CompressionHostAccessTracker::minHostAccessesCount; i++) {
+        tracker.recordHostAccess(uncompressedBuffer);
+        tracker.recordHostAccess(compressedBuffer);
+    }
+    EXPECT_FALSE(tracker.isHostAccessFrequent(AllocationType::BUFFER));
+    EXPECT_FALSE(tracker.isHostAccessFrequent(AllocationType::IMAGE));
+}
+
+TEST_F(CompressionHostAccessTrackerTest, givenAdaptiveCompressionPolicyDisabledWhenRecordingHostAccessThenItIsNeverFrequent) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableAdaptiveCompressionPolicy.set(0);
+
+    compressedBuffer.allocationType = AllocationType::BUFFER;
+    for (uint32_t i = 0; i < CompressionHostAccessTracker::minHostAccessesCount; i++) {
+        tracker.recordHostAccess(compressedBuffer);
+    }
+    EXPECT_FALSE(tracker.isHostAccessFrequent(AllocationType::BUFFER));
+}
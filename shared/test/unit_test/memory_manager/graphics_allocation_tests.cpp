@@ -20,6 +20,16 @@ TEST(GraphicsAllocationTest, givenGraphicsAllocationWhenIsCreatedThenAllInspecti
     }
 }
 
+TEST(GraphicsAllocationTest, givenGraphicsAllocationThenResidencyStateIsPlacedInLeadingCachelines) {
+    MockGraphicsAllocation graphicsAllocation;
+    auto allocationAddress = reinterpret_cast<uintptr_t>(&graphicsAllocation);
+
+    EXPECT_EQ(2 * sizeof(uint32_t), sizeof(graphicsAllocation.usageInfos[0]));
+    EXPECT_LT(reinterpret_cast<uintptr_t>(&graphicsAllocation.gpuAddress) - allocationAddress, MemoryConstants::cacheLineSize);
+    EXPECT_LT(reinterpret_cast<uintptr_t>(&graphicsAllocation.size) - allocationAddress, MemoryConstants::cacheLineSize);
+    EXPECT_LT(reinterpret_cast<uintptr_t>(&graphicsAllocation.usageInfos[0]) - allocationAddress, MemoryConstants::cacheLineSize);
+}
+
 TEST(GraphicsAllocationTest, givenGraphicsAllocationWhenIsCreatedThenTaskCountsAreInitializedProperly) {
     GraphicsAllocation graphicsAllocation1(0, AllocationType::UNKNOWN, nullptr, 0u, 0u, 0, MemoryPool::MemoryNull, MemoryManager::maxOsContextCount);
     GraphicsAllocation graphicsAllocation2(0, AllocationType::UNKNOWN, nullptr, 0u, 0u, 0, MemoryPool::MemoryNull, MemoryManager::maxOsContextCount);
@@ -826,6 +826,42 @@ TEST_F(HostPtrManagerTest, GivenHostPtrManagerFilledWithFragmentsWhenAskedForOve
     EXPECT_NE(nullptr, fragment3);
 }
 
+TEST_F(HostPtrManagerTest, GivenManyStoredFragmentsWhenCheckingForOverlapsThenOnlyFragmentsOfGivenRangeAreConsidered) {
+    MockHostPtrManager hostPtrManager;
+    constexpr size_t fragmentsCount = 1024u;
+    uintptr_t baseAddress = 0x100000u;
+
+    for (size_t i = 0; i < fragmentsCount; i++) {
+        FragmentStorage fragment;
+        fragment.fragmentSize = MemoryConstants::pageSize;
+        fragment.fragmentCpuPointer = reinterpret_cast<void *>(baseAddress + 2 * i * MemoryConstants::pageSize);
+        hostPtrManager.storeFragment(rootDeviceIndex, fragment);
+    }
+    EXPECT_EQ(fragmentsCount, hostPtrManager.getFragmentCount());
+
+    OverlapStatus overlapStatus;
+    auto gapAddress = reinterpret_cast<void *>(baseAddress + 501 * MemoryConstants::pageSize);
+    EXPECT_EQ(nullptr, hostPtrManager.getFragmentAndCheckForOverlaps(rootDeviceIndex, gapAddress, MemoryConstants::pageSize, overlapStatus));
+    EXPECT_EQ(OverlapStatus::FRAGMENT_NOT_OVERLAPING_WITH_ANY_OTHER, overlapStatus);
+
+    EXPECT_EQ(nullptr, hostPtrManager.getFragmentAndCheckForOverlaps(rootDeviceIndex, gapAddress, 3 * MemoryConstants::pageSize, overlapStatus));
+    EXPECT_EQ(OverlapStatus::FRAGMENT_OVERLAPING_AND_BIGGER_THEN_STORED_FRAGMENT, overlapStatus);
+
+    auto storedAddress = reinterpret_cast<void *>(baseAddress + 500 * MemoryConstants::pageSize);
+    auto storedFragment = hostPtrManager.getFragmentAndCheckForOverlaps(rootDeviceIndex, ptrOffset(storedAddress, 0x10), 0x10, overlapStatus);
+    EXPECT_EQ(OverlapStatus::FRAGMENT_WITHIN_STORED_FRAGMENT, overlapStatus);
+    ASSERT_NE(nullptr, storedFragment);
+    EXPECT_EQ(storedAddress, storedFragment->fragmentCpuPointer);
+
+    EXPECT_TRUE(hostPtrManager.releaseHostPtr(rootDeviceIndex, storedAddress));
+    EXPECT_EQ(fragmentsCount - 1, hostPtrManager.getFragmentCount());
+    EXPECT_EQ(nullptr, hostPtrManager.getFragment({storedAddress, rootDeviceIndex}));
+    EXPECT_EQ(nullptr, hostPtrManager.getFragmentAndCheckForOverlaps(rootDeviceIndex, storedAddress, 2 * MemoryConstants::pageSize, overlapStatus));
+    EXPECT_EQ(OverlapStatus::FRAGMENT_NOT_OVERLAPING_WITH_ANY_OTHER, overlapStatus);
+    EXPECT_EQ(nullptr, hostPtrManager.getFragmentAndCheckForOverlaps(rootDeviceIndex + 1, ptrOffset(storedAddress, 2 * MemoryConstants::pageSize), MemoryConstants::pageSize, overlapStatus));
+    EXPECT_EQ(OverlapStatus::FRAGMENT_NOT_OVERLAPING_WITH_ANY_OTHER, overlapStatus);
+}
+
 using HostPtrAllocationTest = Test<MemoryManagerWithCsrFixture>;
 
 TEST_F(HostPtrAllocationTest, givenTwoAllocationsThatSharesOneFragmentWhenOneIsDestroyedThenFragmentRemains) {
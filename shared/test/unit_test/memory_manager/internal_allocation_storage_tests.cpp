@@ -53,20 +53,20 @@ TEST_F(InternalAllocationStorageTest, whenCleanAllocationListThenRemoveOnlyCompl
     storage->storeAllocation(std::unique_ptr<GraphicsAllocation>(allocation2), TEMPORARY_ALLOCATION);
     storage->storeAllocation(std::unique_ptr<GraphicsAllocation>(allocation3), TEMPORARY_ALLOCATION);
 
-    //head point to alloc 2, tail points to alloc3
+    //list is ordered by task count, head points to alloc 2, tail points to alloc3
     EXPECT_TRUE(csr->getTemporaryAllocations().peekContains(*allocation));
     EXPECT_TRUE(csr->getTemporaryAllocations().peekContains(*allocation2));
     EXPECT_TRUE(csr->getTemporaryAllocations().peekContains(*allocation3));
-    EXPECT_EQ(-1, verifyDListOrder(csr->getTemporaryAllocations().peekHead(), allocation, allocation2, allocation3));
+    EXPECT_EQ(-1, verifyDListOrder(csr->getTemporaryAllocations().peekHead(), allocation2, allocation, allocation3));
 
-    //now remove element form the middle
+    //now remove head
     storage->cleanAllocationList(6, TEMPORARY_ALLOCATION);
     EXPECT_TRUE(csr->getTemporaryAllocations().peekContains(*allocation));
     EXPECT_FALSE(csr->getTemporaryAllocations().peekContains(*allocation2));
     EXPECT_TRUE(csr->getTemporaryAllocations().peekContains(*allocation3));
     EXPECT_EQ(-1, verifyDListOrder(csr->getTemporaryAllocations().peekHead(), allocation, allocation3));
 
-    //now remove head
+    //now remove next head
     storage->cleanAllocationList(11, TEMPORARY_ALLOCATION);
     EXPECT_FALSE(csr->getTemporaryAllocations().peekContains(*allocation));
     EXPECT_FALSE(csr->getTemporaryAllocations().peekContains(*allocation2));
@@ -326,3 +326,27 @@ TEST_F(InternalAllocationStorageTest, givenInternalAllocationWhenTaskCountMetsEx
     EXPECT_FALSE(csr->getTemporaryAllocations().peekIsEmpty());
     allocation->hostPtrTaskCountAssignment = 0;
 }
+
+TEST_F(InternalAllocationStorageTest, givenAllocationsWithHostPtrTaskCountAssignedInCompletedPrefixWhenCleaningThenOnlyNotAssignedCompletedAllocationsAreRemoved) {
+    const uint32_t contextId = csr->getOsContext().getContextId();
+    GraphicsAllocation *allocations[4];
+    for (uint32_t i = 0; i < 4; i++) {
+        allocations[i] = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{csr->getRootDeviceIndex(), MemoryConstants::pageSize});
+    }
+    allocations[1]->hostPtrTaskCountAssignment = 1;
+
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocations[3]), TEMPORARY_ALLOCATION, 20u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocations[2]), TEMPORARY_ALLOCATION, 5u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocations[1]), TEMPORARY_ALLOCATION, 5u);
+    storage->storeAllocationWithTaskCount(std::unique_ptr<GraphicsAllocation>(allocations[0]), TEMPORARY_ALLOCATION, 1u);
+    EXPECT_EQ(-1, verifyDListOrder(csr->getTemporaryAllocations().peekHead(), allocations[0], allocations[2], allocations[1], allocations[3]));
+
+    storage->cleanAllocationList(10u, TEMPORARY_ALLOCATION);
+    EXPECT_EQ(-1, verifyDListOrder(csr->getTemporaryAllocations().peekHead(), allocations[1], allocations[3]));
+    EXPECT_EQ(5u, allocations[1]->getTaskCount(contextId));
+
+    allocations[1]->hostPtrTaskCountAssignment = 0;
+    storage->cleanAllocationList(10u, TEMPORARY_ALLOCATION);
+    EXPECT_EQ(allocations[3], csr->getTemporaryAllocations().peekHead());
+    EXPECT_EQ(allocations[3], csr->getTemporaryAllocations().peekTail());
+}
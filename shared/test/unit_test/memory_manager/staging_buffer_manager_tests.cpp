@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/staging_buffer_manager.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/libult/ult_command_stream_receiver.h"
+#include "shared/test/common/mocks/mock_device.h"
+#include "shared/test/common/mocks/mock_svm_manager.h"
+#include "shared/test/common/mocks/ult_device_factory.h"
+#include "shared/test/common/test_macros/hw_test.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+struct StagingBufferManagerFixture : public ::testing::Test {
+    void SetUp() override {
+        DebugManager.flags.StagingBufferSize.set(4);
+        deviceFactory = std::make_unique<UltDeviceFactory>(1, 1);
+        device = deviceFactory->rootDevices[0];
+        svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+        stagingBufferManager = std::make_unique<StagingBufferManager>(svmManager.get(), rootDeviceIndices, deviceBitfields);
+        chunkSize = stagingBufferManager->getChunkSize();
+    }
+
+    void TearDown() override {
+        stagingBufferManager.reset();
+        svmManager.reset();
+    }
+
+    DebugManagerStateRestore restorer;
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    std::unique_ptr<UltDeviceFactory> deviceFactory;
+    MockDevice *device = nullptr;
+    std::unique_ptr<MockSVMAllocsManager> svmManager;
+    std::unique_ptr<StagingBufferManager> stagingBufferManager;
+    size_t chunkSize = 0u;
+};
+
+TEST(StagingBufferManagerTest, givenDefaultSettingsWhenCheckingIfStagingBuffersAreEnabledThenTheyAreDisabled) {
+    EXPECT_FALSE(StagingBufferManager::isEnabled());
+
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableCopyWithStagingBuffers.set(1);
+    EXPECT_TRUE(StagingBufferManager::isEnabled());
+}
+
+TEST_F(StagingBufferManagerFixture, givenStagingBufferSizeDebugFlagWhenCreatingManagerThenChunkSizeIsTakenFromFlagAndTwoUsmHostBuffersAreAllocated) {
+    EXPECT_EQ(4 * MemoryConstants::kiloByte, chunkSize);
+    EXPECT_EQ(StagingBufferManager::stagingBuffersCount, svmManager->getNumAllocs());
+}
+
+TEST_F(StagingBufferManagerFixture, givenCopyWhenCheckingIfStagingCanBeUsedThenOnlyLargePageableCopiesWithoutDependenciesAreAccepted) {
+    auto hostMemory = std::make_unique<uint8_t[]>(4 * chunkSize);
+    EXPECT_TRUE(stagingBufferManager->isValidForCopy(hostMemory.get(), 2 * chunkSize, false));
+    EXPECT_FALSE(stagingBufferManager->isValidForCopy(hostMemory.get(), 2 * chunkSize, true));
+    EXPECT_FALSE(stagingBufferManager->isValidForCopy(hostMemory.get(), 2 * chunkSize - 1, false));
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    auto usmHostPtr = svmManager->createHostUnifiedMemoryAllocation(2 * chunkSize, unifiedMemoryProperties);
+    EXPECT_FALSE(stagingBufferManager->isValidForCopy(usmHostPtr, 2 * chunkSize, false));
+    svmManager->freeSVMAlloc(usmHostPtr);
+}
+
+HWTEST_F(StagingBufferManagerFixture, givenCopySpanningSeveralChunksWhenPerformingCopyThenChunksAreCopiedThroughAlternatingStagingBuffers) {
+    auto &ultCsr = device->getUltCommandStreamReceiver<FamilyType>();
+    *ultCsr.getTagAddress() = 0u;
+    ultCsr.taskCount = 0u;
+
+    const size_t copySize = 2 * chunkSize + chunkSize / 2;
+    std::vector<uint8_t> src(copySize);
+    for (size_t i = 0; i < copySize; i++) {
+        src[i] = static_cast<uint8_t>(i % 251);
+    }
+    std::vector<uint8_t> dst(copySize, 0u);
+    std::vector<void *> usedStagingBuffers;
+    std::vector<size_t> usedChunkSizes;
+
+    ChunkCopyFunction chunkCopy = [&](void *stagingBuffer, size_t chunkOffset, size_t currentChunkSize) -> int32_t {
+        usedStagingBuffers.push_back(stagingBuffer);
+        usedChunkSizes.push_back(currentChunkSize);
+        memcpy(dst.data() + chunkOffset, stagingBuffer, currentChunkSize);
+        ultCsr.taskCount++;
+        *ultCsr.getTagAddress() = ultCsr.taskCount;
+        return 0;
+    };
+
+    EXPECT_EQ(0, stagingBufferManager->performCopy(src.data(), copySize, chunkCopy, &ultCsr));
+    EXPECT_EQ(src, dst);
+
+    ASSERT_EQ(3u, usedStagingBuffers.size());
+    EXPECT_NE(usedStagingBuffers[0], usedStagingBuffers[1]);
+    EXPECT_EQ(usedStagingBuffers[0], usedStagingBuffers[2]);
+    EXPECT_EQ(chunkSize, usedChunkSizes[0]);
+    EXPECT_EQ(chunkSize, usedChunkSizes[1]);
+    EXPECT_EQ(chunkSize / 2, usedChunkSizes[2]);
+}
+
+HWTEST_F(StagingBufferManagerFixture, givenFailingChunkCopyWhenPerformingCopyThenErrorIsReturnedAndRemainingChunksAreSkipped) {
+    auto &ultCsr = device->getUltCommandStreamReceiver<FamilyType>();
+    std::vector<uint8_t> src(3 * chunkSize);
+    uint32_t chunkCopyCalled = 0u;
+
+    ChunkCopyFunction chunkCopy = [&](void *stagingBuffer, size_t chunkOffset, size_t currentChunkSize) -> int32_t {
+        chunkCopyCalled++;
+        return -5;
+    };
+
+    EXPECT_EQ(-5, stagingBufferManager->performCopy(src.data(), src.size(), chunkCopy, &ultCsr));
+    EXPECT_EQ(1u, chunkCopyCalled);
+}
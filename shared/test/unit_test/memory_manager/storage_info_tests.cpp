@@ -9,6 +9,8 @@
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/device/root_device.h"
 #include "shared/source/device/sub_device.h"
+#include "shared/source/memory_manager/tile_placement_policy.h"
+#include "shared/source/os_interface/os_context.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/ult_hw_config.h"
 #include "shared/test/common/helpers/variable_backup.h"
@@ -325,6 +327,72 @@ TEST_F(MultiDeviceStorageInfoTest, givenNonMultiStorageResourceWhenCreatingStora
     EXPECT_FALSE(storageInfo.multiStorage);
 }
 
+TEST_F(MultiDeviceStorageInfoTest, givenPreferredTileHintWhenCreatingStorageInfoForMultiStorageBufferThenOnlyHintedMemoryBankIsOn) {
+    for (auto allocationType : {AllocationType::BUFFER, AllocationType::SVM_GPU}) {
+        AllocationProperties properties{mockRootDeviceIndex, false, numDevices * MemoryConstants::pageSize64k, allocationType, true, allTilesMask};
+        properties.preferredTileHint = singleTileMask;
+        auto storageInfo = memoryManager->createStorageInfoFromProperties(properties);
+        EXPECT_TRUE(storageInfo.cloningOfPageTables);
+        EXPECT_EQ(singleTileMask, storageInfo.memoryBanks);
+        EXPECT_EQ(allTilesMask, storageInfo.pageTablesVisibility);
+        EXPECT_FALSE(storageInfo.multiStorage);
+    }
+}
+
+TEST_F(MultiDeviceStorageInfoTest, givenPreferredTileHintOutsideOfSubDevicesWhenCreatingStorageInfoForBufferThenHintIsIgnored) {
+    AllocationProperties properties{mockRootDeviceIndex, false, numDevices * MemoryConstants::pageSize64k, AllocationType::BUFFER, true, allTilesMask};
+    properties.preferredTileHint = DeviceBitfield{static_cast<uint32_t>(1u << numDevices)};
+    auto storageInfo = memoryManager->createStorageInfoFromProperties(properties);
+    EXPECT_EQ(allTilesMask, storageInfo.memoryBanks);
+    EXPECT_TRUE(storageInfo.multiStorage);
+}
+
+TEST_F(MultiDeviceStorageInfoTest, givenTilePlacementPolicyWhenBuffersOfSimilarSizeWereAccessedMostlyByOneTileThenNewBufferIsPlacedOnThatTile) {
+    memoryManager->tilePlacementPolicies[mockRootDeviceIndex].reset(new TilePlacementPolicy(numDevices));
+    auto tilePlacementPolicy = memoryManager->getTilePlacementPolicy(mockRootDeviceIndex);
+    const size_t size = numDevices * MemoryConstants::pageSize64k;
+
+    AllocationProperties properties{mockRootDeviceIndex, false, size, AllocationType::BUFFER, true, allTilesMask};
+    tilePlacementPolicy->recordAccesses(allTilesMask, size);
+    auto storageInfo = memoryManager->createStorageInfoFromProperties(properties);
+    EXPECT_EQ(allTilesMask, storageInfo.memoryBanks);
+    EXPECT_TRUE(storageInfo.multiStorage);
+
+    for (uint32_t i = 0; i < 12; i++) {
+        tilePlacementPolicy->recordAccesses(singleTileMask, size);
+    }
+    storageInfo = memoryManager->createStorageInfoFromProperties(properties);
+    EXPECT_TRUE(storageInfo.cloningOfPageTables);
+    EXPECT_EQ(singleTileMask, storageInfo.memoryBanks);
+    EXPECT_FALSE(storageInfo.multiStorage);
+
+    properties.size = 16 * size;
+    storageInfo = memoryManager->createStorageInfoFromProperties(properties);
+    EXPECT_EQ(allTilesMask, storageInfo.memoryBanks);
+    EXPECT_TRUE(storageInfo.multiStorage);
+}
+
+TEST_F(MultiDeviceStorageInfoTest, givenTilePlacementPolicyWhenBufferUsedBySubDeviceIsFreedThenItsTileAccessesAreRecorded) {
+    memoryManager->tilePlacementPolicies[mockRootDeviceIndex].reset(new TilePlacementPolicy(numDevices));
+    auto tilePlacementPolicy = memoryManager->getTilePlacementPolicy(mockRootDeviceIndex);
+    auto subDeviceContextId = factory.subDevices[tileIndex]->getDefaultEngine().osContext->getContextId();
+
+    auto allocation = new MockGraphicsAllocation(nullptr, MemoryConstants::pageSize64k);
+    allocation->allocationType = AllocationType::BUFFER;
+    allocation->updateTaskCount(1u, subDeviceContextId);
+    memoryManager->recordTileAccesses(*allocation);
+    allocation->releaseUsageInOsContext(subDeviceContextId);
+    memoryManager->recordTileAccesses(*allocation);
+    delete allocation;
+
+    EXPECT_EQ(MemoryConstants::pageSize64k, tilePlacementPolicy->getAccessedBytes(tileIndex, MemoryConstants::pageSize64k));
+    EXPECT_EQ(0u, tilePlacementPolicy->getAccessedBytes(0u, MemoryConstants::pageSize64k));
+}
+
+TEST_F(MultiDeviceStorageInfoTest, givenDefaultFlagsThenTilePlacementPolicyIsNotCreated) {
+    EXPECT_EQ(nullptr, memoryManager->getTilePlacementPolicy(mockRootDeviceIndex));
+}
+
 TEST_F(MultiDeviceStorageInfoTest, whenCreatingStorageInfoForBufferThenLocalOnlyFlagIsRequired) {
     AllocationProperties properties{mockRootDeviceIndex, false, numDevices * MemoryConstants::pageSize64k, AllocationType::BUFFER, false, singleTileMask};
     auto storageInfo = memoryManager->createStorageInfoFromProperties(properties);
@@ -0,0 +1,43 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/memory_manager/tile_placement_policy.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+TEST(TilePlacementPolicyTest, givenNoRecordedAccessesWhenGettingDominantTileThenNoTileIsReturned) {
+    TilePlacementPolicy policy(2u);
+    uint32_t dominantTile = 0u;
+    EXPECT_FALSE(policy.getDominantTile(DeviceBitfield{0b11}, MemoryConstants::pageSize64k, dominantTile));
+}
+
+TEST(TilePlacementPolicyTest, givenAccessesSpreadOverTilesWhenGettingDominantTileThenNoTileIsReturned) {
+    TilePlacementPolicy policy(2u);
+    policy.recordAccesses(DeviceBitfield{0b11}, MemoryConstants::pageSize64k);
+    policy.recordAccesses(DeviceBitfield{0b01}, MemoryConstants::pageSize64k);
+
+    uint32_t dominantTile = 0u;
+    EXPECT_FALSE(policy.getDominantTile(DeviceBitfield{0b11}, MemoryConstants::pageSize64k, dominantTile));
+    EXPECT_EQ(2 * MemoryConstants::pageSize64k, policy.getAccessedBytes(0u, MemoryConstants::pageSize64k));
+    EXPECT_EQ(MemoryConstants::pageSize64k, policy.getAccessedBytes(1u, MemoryConstants::pageSize64k));
+}
+
+TEST(TilePlacementPolicyTest, givenAccessesDominatedByOneTileWhenGettingDominantTileThenThisTileIsReturnedOnlyForSameSizeClassAndCandidateTiles) {
+    TilePlacementPolicy policy(2u);
+    policy.recordAccesses(DeviceBitfield{0b10}, MemoryConstants::pageSize64k);
+    policy.recordAccesses(DeviceBitfield{0b10}, MemoryConstants::pageSize64k + MemoryConstants::pageSize);
+
+    uint32_t dominantTile = 0u;
+    EXPECT_TRUE(policy.getDominantTile(DeviceBitfield{0b11}, MemoryConstants::pageSize64k, dominantTile));
+    EXPECT_EQ(1u, dominantTile);
+
+    EXPECT_FALSE(policy.getDominantTile(DeviceBitfield{0b01}, MemoryConstants::pageSize64k, dominantTile));
+    EXPECT_FALSE(policy.getDominantTile(DeviceBitfield{0b11}, 4 * MemoryConstants::pageSize64k, dominantTile));
+}
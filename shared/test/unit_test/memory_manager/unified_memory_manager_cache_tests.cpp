@@ -346,4 +346,121 @@ TEST(SvmDeviceAllocationCacheTest, givenCachedAllocationsWhenDestructorIsCalledT
     ASSERT_EQ(memoryManager->freeGraphicsMemoryCalled, 0u);
     svmManager.reset();
     EXPECT_EQ(memoryManager->freeGraphicsMemoryCalled, testDataset.size());
-}
\ No newline at end of file
+}
+TEST(SvmHostAllocationCacheTest, givenAllocationCacheDefaultWhenCheckingIfEnabledThenItIsDisabled) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_EQ(DebugManager.flags.EnableHostUsmAllocationCache.get(), -1);
+    ASSERT_EQ(DebugManager.flags.EnableSharedUsmAllocationCache.get(), -1);
+    EXPECT_FALSE(svmManager->usmHostAllocationsCacheEnabled);
+    EXPECT_FALSE(svmManager->usmSharedAllocationsCacheEnabled);
+}
+
+TEST(SvmHostAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingHostAllocationThenItIsReusedBySubsequentAllocation) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableHostUsmAllocationCache.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_TRUE(svmManager->usmHostAllocationsCacheEnabled);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    auto allocation = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    ASSERT_NE(nullptr, allocation);
+
+    svmManager->freeSVMAlloc(allocation);
+    ASSERT_EQ(1u, svmManager->usmHostAllocationsCache.allocations.size());
+    EXPECT_EQ(MemoryConstants::pageSize64k, svmManager->usmHostAllocationsCache.totalSize);
+    EXPECT_NE(nullptr, svmManager->getSVMAlloc(allocation));
+
+    auto allocationFromCache = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    EXPECT_EQ(allocation, allocationFromCache);
+    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.allocations.size());
+    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.totalSize);
+
+    svmManager->freeSVMAlloc(allocationFromCache);
+    svmManager->trimUSMHostAllocCache();
+    EXPECT_EQ(0u, svmManager->usmHostAllocationsCache.allocations.size());
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(allocation));
+}
+
+TEST(SvmHostAllocationCacheTest, givenCachedHostAllocationMuchLargerThanRequestedWhenAllocatingThenItIsNotReused) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableHostUsmAllocationCache.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    auto largeAllocation = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 4, unifiedMemoryProperties);
+    ASSERT_NE(nullptr, largeAllocation);
+    svmManager->freeSVMAlloc(largeAllocation);
+    ASSERT_EQ(1u, svmManager->usmHostAllocationsCache.allocations.size());
+
+    auto smallAllocation = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    EXPECT_NE(largeAllocation, smallAllocation);
+    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache.allocations.size());
+
+    svmManager->freeSVMAlloc(smallAllocation);
+    svmManager->trimUSMHostAllocCache();
+}
+
+TEST(SvmHostAllocationCacheTest, givenCacheMaxSizeSetWhenFreeingAllocationsAboveLimitThenTheyAreReleased) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableHostUsmAllocationCache.set(1);
+    DebugManager.flags.UsmAllocationCacheMaxSize.set(MemoryConstants::pageSize64k);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    EXPECT_EQ(MemoryConstants::pageSize64k, svmManager->usmHostAllocationsCache.maxTotalSize);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::HOST_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    auto allocation1 = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    auto allocation2 = svmManager->createHostUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    ASSERT_NE(nullptr, allocation1);
+    ASSERT_NE(nullptr, allocation2);
+
+    svmManager->freeSVMAlloc(allocation1);
+    svmManager->freeSVMAlloc(allocation2);
+    EXPECT_EQ(1u, svmManager->usmHostAllocationsCache.allocations.size());
+    EXPECT_NE(nullptr, svmManager->getSVMAlloc(allocation1));
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(allocation2));
+
+    svmManager->trimUSMHostAllocCache();
+    EXPECT_EQ(nullptr, svmManager->getSVMAlloc(allocation1));
+}
+
+TEST(SvmSharedAllocationCacheTest, givenAllocationCacheEnabledWhenFreeingSharedAllocationWithoutCpuStorageThenItIsReusedBySubsequentAllocation) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableSharedUsmAllocationCache.set(1);
+    DebugManager.flags.AllocateSharedAllocationsWithCpuAndGpuStorage.set(0);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    ASSERT_TRUE(svmManager->usmSharedAllocationsCacheEnabled);
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::SHARED_UNIFIED_MEMORY, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+    auto allocation = svmManager->createSharedUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties, nullptr);
+    ASSERT_NE(nullptr, allocation);
+
+    svmManager->freeSVMAlloc(allocation);
+    ASSERT_EQ(1u, svmManager->usmSharedAllocationsCache.allocations.size());
+
+    auto allocationFromCache = svmManager->createSharedUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties, nullptr);
+    EXPECT_EQ(allocation, allocationFromCache);
+    EXPECT_EQ(0u, svmManager->usmSharedAllocationsCache.allocations.size());
+
+    svmManager->freeSVMAlloc(allocationFromCache);
+    svmManager->trimUSMAllocCaches();
+    EXPECT_EQ(0u, svmManager->usmSharedAllocationsCache.allocations.size());
+}
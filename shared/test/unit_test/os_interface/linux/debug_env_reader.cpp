@@ -65,6 +65,28 @@ TEST_F(DebugEnvReaderTests, GivenSetVariableThenSetValueIsReturned) {
     }
 }
 
+TEST_F(DebugEnvReaderTests, givenPrefetchedSettingsWhenGettingSettingsThenEnvironmentIsReadOnceAndGetenvIsNotCalled) {
+    VariableBackup<uint32_t> mockGetenvCalledBackup(&IoFunctions::mockGetenvCalled, 0);
+    VariableBackup<uint32_t> mockGetEnvironmentCalledBackup(&IoFunctions::mockGetEnvironmentCalled, 0);
+    std::unordered_map<std::string, std::string> mockableEnvs = {{"TestingVariable", "1234"}, {"TestingString", "a=b"}, {"TestingEmpty", ""}};
+    VariableBackup<std::unordered_map<std::string, std::string> *> mockableEnvValuesBackup(&IoFunctions::mockableEnvValues, &mockableEnvs);
+
+    evr->prefetchSettings();
+    EXPECT_EQ(1u, IoFunctions::mockGetEnvironmentCalled);
+
+    mockableEnvs.clear();
+    EXPECT_EQ(1234, evr->getSetting("TestingVariable", 1));
+    EXPECT_EQ(int64_t{1234}, evr->getSetting("TestingVariable", int64_t{1}));
+    EXPECT_TRUE(evr->getSetting("TestingVariable", false));
+    EXPECT_EQ("a=b", evr->getSetting("TestingString", std::string("default")));
+    EXPECT_EQ("", evr->getSetting("TestingEmpty", std::string("default")));
+    EXPECT_EQ(5, evr->getSetting("NotExistingVariable", 5));
+    EXPECT_EQ("default", evr->getSetting("NotExistingVariable", std::string("default")));
+
+    EXPECT_EQ(0u, IoFunctions::mockGetenvCalled);
+    EXPECT_EQ(1u, IoFunctions::mockGetEnvironmentCalled);
+}
+
 TEST_F(DebugEnvReaderTests, givenMaxInt64AsEnvWhenGetSettingThenProperValueIsReturned) {
     const char *testingVariableName = "TestingVariable";
     const char *testingVariableValue = "9223372036854775807";
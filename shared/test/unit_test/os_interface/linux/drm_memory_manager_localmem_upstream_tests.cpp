@@ -136,6 +136,44 @@ HWTEST2_F(DrmMemoryManagerLocalMemoryTest, givenDrmMemoryManagerWhenCreateBuffer
     EXPECT_EQ(size, bo->peekSize());
 }
 
+HWTEST2_F(DrmMemoryManagerLocalMemoryTest, givenPrewarmedBufferObjectsCountWhenCreateBufferObjectInMemoryRegionIsCalledThenBufferObjectsAreCreatedInOnePassAndReused, NonDefaultIoctlsSupported) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableLocalMemory.set(1);
+    DebugManager.flags.PrewarmedBufferObjectsCount.set(3);
+    std::vector<MemoryRegion> regionInfo(2);
+    regionInfo[0].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_SYSTEM, 0};
+    regionInfo[1].region = {drm_i915_gem_memory_class::I915_MEMORY_CLASS_DEVICE, 0};
+
+    mock->memoryInfo.reset(new MemoryInfo(regionInfo, *mock));
+    mock->ioctlCallsCount = 0;
+
+    auto size = MemoryConstants::pageSize64k;
+    auto memoryBanks = (1u << (MemoryBanks::getBankForLocalMemory(0) - 1));
+
+    auto bo = std::unique_ptr<BufferObject>(memoryManager->createBufferObjectInMemoryRegion(&memoryManager->getDrm(0), nullptr, AllocationType::BUFFER,
+                                                                                            0x1000u, size, memoryBanks, 1));
+    ASSERT_NE(nullptr, bo);
+    // GEM_CREATE_EXT and GEM_MMAP_OFFSET for each prewarmed buffer object
+    EXPECT_EQ(6u, mock->ioctlCallsCount);
+    EXPECT_EQ(0x1000u, bo->peekAddress());
+
+    auto secondBo = std::unique_ptr<BufferObject>(memoryManager->createBufferObjectInMemoryRegion(&memoryManager->getDrm(0), nullptr, AllocationType::BUFFER,
+                                                                                                  0x20000u, size, memoryBanks, 1));
+    ASSERT_NE(nullptr, secondBo);
+    EXPECT_EQ(6u, mock->ioctlCallsCount);
+    EXPECT_EQ(0x20000u, secondBo->peekAddress());
+    EXPECT_EQ(size, secondBo->peekSize());
+
+    uint64_t offset = 0;
+    uint64_t mmapOffsetWc = mock->getIoctlHelper()->getDrmParamValue(DrmParam::MmapOffsetWc);
+    EXPECT_TRUE(secondBo->peekMmapOffset(mmapOffsetWc, offset));
+
+    auto largeBo = std::unique_ptr<BufferObject>(memoryManager->createBufferObjectInMemoryRegion(&memoryManager->getDrm(0), nullptr, AllocationType::BUFFER,
+                                                                                                 0x40000u, 2 * DrmMemoryManager::maxPrewarmedBufferObjectSize, memoryBanks, 1));
+    ASSERT_NE(nullptr, largeBo);
+    EXPECT_EQ(7u, mock->ioctlCallsCount);
+}
+
 HWTEST2_F(DrmMemoryManagerLocalMemoryTest, givenMultiRootDeviceEnvironmentAndMemoryInfoWhenCreateMultiGraphicsAllocationThenImportAndExportIoctlAreUsed, NonDefaultIoctlsSupported) {
     uint32_t rootDevicesNumber = 3u;
     MultiGraphicsAllocation multiGraphics(rootDevicesNumber);
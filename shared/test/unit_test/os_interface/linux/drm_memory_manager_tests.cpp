@@ -23,6 +23,7 @@
 #include "shared/test/common/mocks/mock_gmm.h"
 #include "shared/test/common/os_interface/linux/drm_memory_manager_fixture.h"
 #include "shared/test/common/os_interface/linux/drm_mock_cache_info.h"
+#include "shared/test/common/os_interface/linux/sys_calls_linux_ult.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
 #include "gtest/gtest.h"
@@ -958,6 +959,51 @@ TEST_F(DrmMemoryManagerTest, WhenNullOsHandleStorageAskedForPopulationThenFilled
     memoryManager->cleanOsHandles(storage, rootDeviceIndex);
 }
 
+TEST_F(DrmMemoryManagerTest, givenUserptrPinningCacheWhenSameHostRangeIsPopulatedAgainThenCachedBufferObjectIsReusedUntilRangeIsReleased) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UserptrPinningCacheSizeInMb.set(1);
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemWait = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    auto populateAndRelease = [&]() {
+        OsHandleStorage storage;
+        storage.fragmentStorageData[0].cpuPtr = reinterpret_cast<void *>(0x1000);
+        storage.fragmentStorageData[0].fragmentSize = MemoryConstants::pageSize;
+        EXPECT_EQ(MemoryManager::AllocationStatus::Success, memoryManager->populateOsHandles(storage, rootDeviceIndex));
+        auto bo = static_cast<OsHandleLinux *>(storage.fragmentStorageData[0].osHandleStorage)->bo;
+        memoryManager->getHostPtrManager()->releaseHandleStorage(rootDeviceIndex, storage);
+        memoryManager->cleanOsHandles(storage, rootDeviceIndex);
+        return bo;
+    };
+
+    auto bo = populateAndRelease();
+    ASSERT_NE(nullptr, bo);
+    EXPECT_EQ(bo, populateAndRelease());
+
+    memoryManager->releaseCachedHostPtrPinning(reinterpret_cast<void *>(0x1800), 1u);
+}
+
+TEST_F(DrmMemoryManagerTest, givenUserptrPinningCacheWhenCacheSizeIsExceededThenLeastRecentlyReleasedRangeIsUnpinned) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.UserptrPinningCacheSizeInMb.set(1);
+    mock->ioctl_expected.gemUserptr = 3;
+    mock->ioctl_expected.gemWait = 3;
+    mock->ioctl_expected.gemClose = 3;
+
+    const size_t fragmentSize = MemoryConstants::megaByte / 2;
+    for (auto cpuPtr : {0x100000u, 0x200000u, 0x300000u}) {
+        OsHandleStorage storage;
+        storage.fragmentStorageData[0].cpuPtr = reinterpret_cast<void *>(static_cast<uintptr_t>(cpuPtr));
+        storage.fragmentStorageData[0].fragmentSize = fragmentSize;
+        EXPECT_EQ(MemoryManager::AllocationStatus::Success, memoryManager->populateOsHandles(storage, rootDeviceIndex));
+        memoryManager->getHostPtrManager()->releaseHandleStorage(rootDeviceIndex, storage);
+        memoryManager->cleanOsHandles(storage, rootDeviceIndex);
+    }
+    // First range is unpinned on caching the third one, the remaining two on explicit release
+    memoryManager->releaseCachedHostPtrPinning(reinterpret_cast<void *>(0x100000), 3 * MemoryConstants::megaByte);
+}
+
 TEST_F(DrmMemoryManagerWithExplicitExpectationsTest, givenEnabledHostMemoryValidationWhenReadOnlyPointerCausesPinningFailWithEfaultThenPopulateOsHandlesReturnsInvalidHostPointerError) {
     std::unique_ptr<TestedDrmMemoryManager> memoryManager(new (std::nothrow) TestedDrmMemoryManager(false,
                                                                                                     false,
@@ -2172,6 +2218,145 @@ TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenCallToAllocateGraphicsMemory
     memoryManager->freeGraphicsMemoryImpl(alloc);
 }
 
+namespace {
+int madviseCalledCount = 0;
+int madviseAdvice = 0;
+int madviseMock(void *addr, size_t length, int advice) noexcept {
+    madviseCalledCount++;
+    madviseAdvice = advice;
+    return 0;
+}
+} // namespace
+
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, given2MBPagesEnabledWhenAllocatingLargeHostMemoryThenMemoryIs2MBAlignedAndAdvisedToUseHugePages) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.Enable2MBPagesForLargeAllocations.set(1);
+    mock->ioctl_expected.gemUserptr = 2;
+    mock->ioctl_expected.gemClose = 2;
+    madviseCalledCount = 0;
+    memoryManager->madviseFunction = &madviseMock;
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize2Mb + MemoryConstants::megaByte;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    auto alloc = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, alloc);
+    EXPECT_TRUE(isAligned(alloc->getUnderlyingBuffer(), MemoryConstants::pageSize2Mb));
+    EXPECT_EQ(2 * MemoryConstants::pageSize2Mb, alloc->getUnderlyingBufferSize());
+    EXPECT_EQ(1, madviseCalledCount);
+    EXPECT_EQ(MADV_HUGEPAGE, madviseAdvice);
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+
+    allocationData.size = MemoryConstants::megaByte;
+    alloc = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, alloc);
+    EXPECT_EQ(MemoryConstants::megaByte, alloc->getUnderlyingBufferSize());
+    EXPECT_EQ(1, madviseCalledCount);
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+}
+
+namespace {
+int mbindCalledCount = 0;
+unsigned long mbindNodeMask = 0;
+long mbindMock(void *addr, unsigned long len, int mode, const unsigned long *nodemask, unsigned long maxnode, unsigned int flags) {
+    mbindCalledCount++;
+    mbindNodeMask = nodemask[0];
+    return 0;
+}
+} // namespace
+
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenDeviceOnNumaNodeWhenAllocatingInternalSystemMemoryThenMemoryIsBoundToNumaNodeOfDevice) {
+    VariableBackup<decltype(SysCalls::sysCallsMbind)> mbindBackup(&SysCalls::sysCallsMbind, mbindMock);
+    VariableBackup<int> numaNodeBackup(&mock->numaNode, 2);
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemClose = 1;
+    mbindCalledCount = 0;
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    auto alloc = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, alloc);
+    EXPECT_EQ(1, mbindCalledCount);
+    EXPECT_EQ(1ul << 2, mbindNodeMask);
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+}
+
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenDeviceOnNumaNodeWhenAllocatingHostUsmThenMemoryIsBoundOnlyWhenDebugFlagForcesIt) {
+    DebugManagerStateRestore restorer;
+    VariableBackup<decltype(SysCalls::sysCallsMbind)> mbindBackup(&SysCalls::sysCallsMbind, mbindMock);
+    VariableBackup<int> numaNodeBackup(&mock->numaNode, 1);
+    mock->ioctl_expected.gemUserptr = 2;
+    mock->ioctl_expected.gemClose = 2;
+    mbindCalledCount = 0;
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    allocationData.flags.isUSMHostAllocation = true;
+    auto alloc = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, alloc);
+    EXPECT_EQ(0, mbindCalledCount);
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+
+    DebugManager.flags.NumaLocalSystemMemory.set(1);
+    alloc = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, alloc);
+    EXPECT_EQ(1, mbindCalledCount);
+    EXPECT_EQ(1ul << 1, mbindNodeMask);
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+}
+
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenDeviceNotOnNumaNodeOrBindingDisabledWhenAllocatingSystemMemoryThenMemoryIsNotBound) {
+    DebugManagerStateRestore restorer;
+    VariableBackup<decltype(SysCalls::sysCallsMbind)> mbindBackup(&SysCalls::sysCallsMbind, mbindMock);
+    mock->ioctl_expected.gemUserptr = 2;
+    mock->ioctl_expected.gemClose = 2;
+    mbindCalledCount = 0;
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    auto alloc = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, alloc);
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+
+    VariableBackup<int> numaNodeBackup(&mock->numaNode, 0);
+    DebugManager.flags.NumaLocalSystemMemory.set(0);
+    alloc = memoryManager->allocateGraphicsMemoryWithAlignment(allocationData);
+    ASSERT_NE(nullptr, alloc);
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+
+    EXPECT_EQ(0, mbindCalledCount);
+}
+
+TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenAllocationWhenMappingPhysicalToVirtualMemoryThenBufferObjectIsMovedToReservedAddressAndRestoredOnUnmap) {
+    mock->ioctl_expected.gemUserptr = 1;
+    mock->ioctl_expected.gemClose = 1;
+
+    AllocationData allocationData;
+    allocationData.size = MemoryConstants::pageSize64k;
+    allocationData.rootDeviceIndex = rootDeviceIndex;
+    auto alloc = static_cast<DrmAllocation *>(memoryManager->allocateGraphicsMemoryWithAlignment(allocationData));
+    ASSERT_NE(nullptr, alloc);
+    auto physicalGpuAddress = alloc->getGpuAddress();
+
+    auto addressRange = memoryManager->reserveGpuAddress(MemoryConstants::pageSize64k, rootDeviceIndex);
+    ASSERT_NE(0u, addressRange.address);
+
+    EXPECT_FALSE(memoryManager->mapPhysicalToVirtualMemory(alloc, addressRange.address, MemoryConstants::pageSize));
+    EXPECT_TRUE(memoryManager->mapPhysicalToVirtualMemory(alloc, addressRange.address, MemoryConstants::pageSize64k));
+    EXPECT_EQ(addressRange.address, alloc->getGpuAddress());
+    EXPECT_EQ(addressRange.address, alloc->getBO()->peekAddress());
+
+    EXPECT_TRUE(memoryManager->mapPhysicalToVirtualMemory(alloc, physicalGpuAddress, MemoryConstants::pageSize64k));
+    EXPECT_EQ(physicalGpuAddress, alloc->getGpuAddress());
+    EXPECT_EQ(physicalGpuAddress, alloc->getBO()->peekAddress());
+
+    memoryManager->freeGpuAddress(addressRange, rootDeviceIndex);
+    memoryManager->freeGraphicsMemoryImpl(alloc);
+}
+
 TEST_F(DrmMemoryManagerUSMHostAllocationTests, givenMmapPtrWhenFreeGraphicsMemoryImplThenPtrIsDeallocated) {
     mock->ioctl_expected.gemUserptr = 1;
     mock->ioctl_expected.gemClose = 1;
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/os_interface/linux/drm_query_cache.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+
+using namespace NEO;
+
+struct DrmQueryCacheTest : public ::testing::Test {
+    void TearDown() override {
+        std::remove(cacheFilePath.c_str());
+    }
+
+    const std::string cacheFilePath = "drm_query_cache_test.drmquerycache";
+    const std::vector<uint8_t> engineInfoData = {1, 2, 3, 4, 5};
+    const std::vector<uint8_t> topologyData = {6, 7, 8};
+};
+
+TEST_F(DrmQueryCacheTest, givenPersistedQueriesWhenCacheWithSameKeyIsLoadedThenQueriesAreFound) {
+    {
+        DrmQueryCache cache(cacheFilePath, "key");
+        EXPECT_EQ(nullptr, cache.find(1u, 0u));
+        cache.store(1u, 0u, engineInfoData);
+        cache.store(2u, 1u, topologyData);
+        cache.persist();
+    }
+
+    struct LoadedDrmQueryCache : DrmQueryCache {
+        using DrmQueryCache::DrmQueryCache;
+        using DrmQueryCache::load;
+    };
+    LoadedDrmQueryCache loadedCache(cacheFilePath, "key");
+    loadedCache.load();
+
+    auto cachedEngineInfo = loadedCache.find(1u, 0u);
+    ASSERT_NE(nullptr, cachedEngineInfo);
+    EXPECT_EQ(engineInfoData, *cachedEngineInfo);
+    auto cachedTopology = loadedCache.find(2u, 1u);
+    ASSERT_NE(nullptr, cachedTopology);
+    EXPECT_EQ(topologyData, *cachedTopology);
+    EXPECT_EQ(nullptr, loadedCache.find(2u, 0u));
+
+    LoadedDrmQueryCache cacheWithOtherKey(cacheFilePath, "otherKey");
+    cacheWithOtherKey.load();
+    EXPECT_EQ(nullptr, cacheWithOtherKey.find(1u, 0u));
+}
+
+TEST_F(DrmQueryCacheTest, givenTruncatedCacheFileWhenLoadingThenNoQueriesAreFound) {
+    {
+        DrmQueryCache cache(cacheFilePath, "key");
+        cache.store(1u, 0u, engineInfoData);
+        cache.persist();
+    }
+    size_t fileSize = 0u;
+    auto fileData = loadDataFromFile(cacheFilePath.c_str(), fileSize);
+    ASSERT_NE(nullptr, fileData);
+    writeDataToFile(cacheFilePath.c_str(), fileData.get(), fileSize - 1);
+
+    struct LoadedDrmQueryCache : DrmQueryCache {
+        using DrmQueryCache::DrmQueryCache;
+        using DrmQueryCache::load;
+    };
+    LoadedDrmQueryCache loadedCache(cacheFilePath, "key");
+    loadedCache.load();
+    EXPECT_EQ(nullptr, loadedCache.find(1u, 0u));
+}
+
+TEST(DrmQueryCacheCreateTest, givenDefaultSettingsWhenCreatingCacheThenNothingIsCreated) {
+    EXPECT_EQ(nullptr, DrmQueryCache::create("0000:00:02.0"));
+
+    DebugManagerStateRestore restore;
+    DebugManager.flags.DrmQueryCacheDir.set(".");
+    EXPECT_NE(nullptr, DrmQueryCache::create("0000:00:02.0"));
+    EXPECT_EQ(nullptr, DrmQueryCache::create(""));
+}
@@ -301,6 +301,37 @@ TEST_F(DrmMemoryOperationsHandlerBindTest, whenRunningOutOfMemoryThenUnusedAlloc
     memoryManager->freeGraphicsMemory(allocation);
 }
 
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenEvictionBudgetWhenRunningOutOfMemoryThenLeastRecentlyUsedAllocationsAreUnboundUntilBudgetIsReleased) {
+    DebugManager.flags.EvictUnusedAllocationsBudget.set(MemoryConstants::pageSize);
+
+    GraphicsAllocation *allocations[3] = {};
+    uint32_t lastUsedTaskCounts[3] = {7u, 3u, 5u};
+    auto osContext = device->getDefaultEngine().osContext;
+    for (auto i = 0u; i < 3u; i++) {
+        allocations[i] = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+        for (auto &engine : device->getAllEngines()) {
+            *engine.commandStreamReceiver->getTagAddress() = 10;
+            allocations[i]->updateTaskCount(lastUsedTaskCounts[i], engine.osContext->getContextId());
+            EXPECT_EQ(operationHandler->makeResidentWithinOsContext(engine.osContext, ArrayRef<GraphicsAllocation *>(&allocations[i], 1), true), MemoryOperationsStatus::SUCCESS);
+        }
+    }
+
+    operationHandler->evictUnusedAllocations(false, true);
+
+    EXPECT_TRUE(static_cast<DrmAllocation *>(allocations[0])->isBoundInOsContext(osContext->getContextId()));
+    EXPECT_FALSE(static_cast<DrmAllocation *>(allocations[1])->isBoundInOsContext(osContext->getContextId()));
+    EXPECT_TRUE(static_cast<DrmAllocation *>(allocations[2])->isBoundInOsContext(osContext->getContextId()));
+
+    operationHandler->evictUnusedAllocations(true, true);
+
+    EXPECT_FALSE(static_cast<DrmAllocation *>(allocations[0])->isBoundInOsContext(osContext->getContextId()));
+    EXPECT_FALSE(static_cast<DrmAllocation *>(allocations[2])->isBoundInOsContext(osContext->getContextId()));
+
+    for (auto allocation : allocations) {
+        memoryManager->freeGraphicsMemory(allocation);
+    }
+}
+
 TEST_F(DrmMemoryOperationsHandlerBindTest, givenUsedAllocationInBothSubdevicesWhenEvictUnusedThenNothingIsUnbound) {
     auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
 
@@ -497,6 +528,45 @@ TEST_F(DrmMemoryOperationsHandlerBindTest, whenMakeResidentTwiceThenAllocIsBound
     memoryManager->freeGraphicsMemory(allocation);
 }
 
+TEST_F(DrmMemoryOperationsHandlerBindTest, whenMakeResidentWithinOsContextThenAllocationIsMarkedAsBoundUntilEvicted) {
+    auto allocation = memoryManager->allocateGraphicsMemoryWithProperties(MockAllocationProperties{device->getRootDeviceIndex(), MemoryConstants::pageSize});
+    auto drmAllocation = static_cast<DrmAllocation *>(allocation);
+    auto osContext = device->getDefaultEngine().osContext;
+
+    EXPECT_FALSE(drmAllocation->isBoundInOsContext(osContext->getContextId()));
+    EXPECT_EQ(operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(&allocation, 1), true), MemoryOperationsStatus::SUCCESS);
+    EXPECT_TRUE(drmAllocation->isBoundInOsContext(osContext->getContextId()));
+
+    auto vmBindCalled = mock->context.vmBindCalled;
+    EXPECT_EQ(operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(&allocation, 1), true), MemoryOperationsStatus::SUCCESS);
+    EXPECT_EQ(vmBindCalled, mock->context.vmBindCalled);
+
+    EXPECT_EQ(operationHandler->evictWithinOsContext(osContext, *allocation), MemoryOperationsStatus::SUCCESS);
+    EXPECT_FALSE(drmAllocation->isBoundInOsContext(osContext->getContextId()));
+
+    EXPECT_EQ(operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(&allocation, 1), true), MemoryOperationsStatus::SUCCESS);
+    EXPECT_TRUE(drmAllocation->isBoundInOsContext(osContext->getContextId()));
+    EXPECT_LT(vmBindCalled, mock->context.vmBindCalled);
+
+    memoryManager->freeGraphicsMemory(allocation);
+}
+
+TEST_F(DrmMemoryOperationsHandlerBindTest, givenAllocationWithSharedBufferObjectWhenMakeResidentWithinOsContextThenAllocationIsNotMarkedAsBound) {
+    auto size = 1024u;
+    BufferObjects bos;
+    BufferObject mockBo(mock, 3, 1, 0, 1);
+    mockBo.markAsReusableAllocation();
+    bos.push_back(&mockBo);
+
+    auto allocation = new DrmAllocation(0, AllocationType::UNKNOWN, bos, nullptr, 0u, size, MemoryPool::LocalMemory);
+    auto graphicsAllocation = static_cast<GraphicsAllocation *>(allocation);
+    auto osContext = device->getDefaultEngine().osContext;
+
+    EXPECT_EQ(operationHandler->makeResidentWithinOsContext(osContext, ArrayRef<GraphicsAllocation *>(&graphicsAllocation, 1), true), MemoryOperationsStatus::SUCCESS);
+    EXPECT_FALSE(allocation->isBoundInOsContext(osContext->getContextId()));
+    delete allocation;
+}
+
 TEST_F(DrmMemoryOperationsHandlerBindTest, WhenVmBindAvaialableThenMemoryManagerReturnsSupportForIndirectAllocationsAsPack) {
     mock->bindAvailable = true;
     EXPECT_TRUE(memoryManager->allowIndirectAllocationsAsPack(0u));
@@ -455,6 +455,25 @@ TEST(DrmTest, givenDrmPreemptionEnabledAndLowPriorityEngineWhenCreatingOsContext
     EXPECT_EQ(0u, drmMock.receivedContextParamRequest.size);
 }
 
+TEST(DrmTest, givenHighPriorityEngineWhenCreatingOsContextThenCallSetContextPriorityIoctlWithMaxUserPriority) {
+    auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
+    executionEnvironment->rootDeviceEnvironments[0]->setHwInfo(defaultHwInfo.get());
+    executionEnvironment->rootDeviceEnvironments[0]->initGmm();
+
+    DrmMock drmMock(*executionEnvironment->rootDeviceEnvironments[0]);
+
+    OsContextLinux osContext1(drmMock, 0u, EngineDescriptorHelper::getDefaultDescriptor());
+    osContext1.ensureContextInitialized();
+    auto contextParamRequestCount = drmMock.receivedContextParamRequestCount;
+
+    OsContextLinux osContext2(drmMock, 0u, EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_RCS, EngineUsage::HighPriority}));
+    osContext2.ensureContextInitialized();
+    EXPECT_EQ(contextParamRequestCount + 1, drmMock.receivedContextParamRequestCount);
+    EXPECT_EQ(drmMock.storedDrmContextId, drmMock.receivedContextParamRequest.contextId);
+    EXPECT_EQ(static_cast<uint64_t>(I915_CONTEXT_PARAM_PRIORITY), drmMock.receivedContextParamRequest.param);
+    EXPECT_EQ(1023u, drmMock.receivedContextParamRequest.value);
+}
+
 TEST(DrmTest, WhenGettingExecSoftPinThenCorrectValueIsReturned) {
     auto executionEnvironment = std::make_unique<MockExecutionEnvironment>();
     DrmMock *pDrm = new DrmMock(*executionEnvironment->rootDeviceEnvironments[0]);
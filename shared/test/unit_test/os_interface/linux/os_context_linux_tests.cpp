@@ -33,3 +33,21 @@ TEST(OSContextLinux, givenReinitializeContextWhenContextIsInitThenContextIsStill
     EXPECT_NO_THROW(osContext.reInitializeContext());
     EXPECT_NO_THROW(osContext.ensureContextInitialized());
 }
+
+TEST(OSContextLinux, givenInitializedContextWhenReinitializingContextThenDrmContextIsRecreated) {
+    MockExecutionEnvironment executionEnvironment;
+    std::unique_ptr<DrmMockCustom> mock(new DrmMockCustom(*executionEnvironment.rootDeviceEnvironments[0]));
+    executionEnvironment.rootDeviceEnvironments[0]->memoryOperationsInterface = DrmMemoryOperationsHandler::create(*mock.get(), 0u);
+    OsContextLinux osContext(*mock, 0u, EngineDescriptorHelper::getDefaultDescriptor());
+    osContext.ensureContextInitialized();
+    ASSERT_EQ(1u, osContext.getDrmContextIds().size());
+    auto drmContextId = osContext.getDrmContextIds()[0];
+    auto contextCreateCount = mock->ioctl_cnt.contextCreate.load();
+    auto contextDestroyCount = mock->ioctl_cnt.contextDestroy.load();
+
+    osContext.reInitializeContext();
+    EXPECT_EQ(contextCreateCount + 1, mock->ioctl_cnt.contextCreate);
+    EXPECT_EQ(contextDestroyCount + 1, mock->ioctl_cnt.contextDestroy);
+    ASSERT_EQ(1u, osContext.getDrmContextIds().size());
+    EXPECT_NE(drmContextId, osContext.getDrmContextIds()[0]);
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+
+using namespace NEO;
+
+TEST(ThreadTest, givenCpuListWithSingleCpusAndRangesWhenParsingThenAllCpusAreReturned) {
+    std::vector<uint32_t> expectedCpus = {0, 1, 2, 3, 8, 10, 11};
+    EXPECT_EQ(expectedCpus, Thread::parseCpuList("0-3,8,10-11"));
+    EXPECT_EQ(std::vector<uint32_t>{5}, Thread::parseCpuList("5"));
+}
+
+TEST(ThreadTest, givenInvalidCpuListWhenParsingThenEmptyListIsReturned) {
+    EXPECT_TRUE(Thread::parseCpuList("").empty());
+    EXPECT_TRUE(Thread::parseCpuList("a").empty());
+    EXPECT_TRUE(Thread::parseCpuList("3-1").empty());
+    EXPECT_TRUE(Thread::parseCpuList("1,2x").empty());
+    EXPECT_TRUE(Thread::parseCpuList("1-").empty());
+}
+
+TEST(ThreadTest, givenDriverThreadsCpuListWhenGettingDriverThreadsCpusThenCpusFromDebugFlagAreReturned) {
+    DebugManagerStateRestore restorer;
+    EXPECT_TRUE(Thread::getDriverThreadsCpus().empty());
+
+    DebugManager.flags.DriverThreadsCpuList.set("0,2-3");
+    std::vector<uint32_t> expectedCpus = {0, 2, 3};
+    EXPECT_EQ(expectedCpus, Thread::getDriverThreadsCpus());
+}
+
+TEST(ThreadTest, givenDriverThreadsCpuListWhenCreatingThreadThenThreadRuns) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.DriverThreadsCpuList.set("0");
+
+    std::atomic<bool> threadRun{false};
+    auto thread = Thread::create([](void *arg) -> void * {
+        static_cast<std::atomic<bool> *>(arg)->store(true);
+        return nullptr;
+    },
+                                 &threadRun);
+    thread->join();
+    EXPECT_TRUE(threadRun);
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/os_time.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+namespace {
+class ControlledDeviceTime : public DeviceTime {
+  public:
+    bool getCpuGpuTime(TimeStampData *pGpuCpuTime, OSTime *osTime) override {
+        getCpuGpuTimeCalled++;
+        *pGpuCpuTime = sampleToReturn;
+        return true;
+    }
+
+    double getDynamicDeviceTimerResolution(HardwareInfo const &hwInfo) const override {
+        return 1.0;
+    }
+
+    uint64_t getDynamicDeviceTimerClock(HardwareInfo const &hwInfo) const override {
+        return 1000000000u;
+    }
+
+    TimeStampData sampleToReturn{};
+    uint32_t getCpuGpuTimeCalled = 0u;
+};
+
+class ControlledOSTime : public OSTime {
+  public:
+    ControlledOSTime() {
+        auto controlledDeviceTime = std::make_unique<ControlledDeviceTime>();
+        mockDeviceTime = controlledDeviceTime.get();
+        this->deviceTime = std::move(controlledDeviceTime);
+    }
+
+    bool getCpuTime(uint64_t *timeStamp) override {
+        *timeStamp = cpuTime;
+        return true;
+    }
+
+    double getHostTimerResolution() const override {
+        return 0;
+    }
+
+    uint64_t getCpuRawTimestamp() override {
+        return 0;
+    }
+
+    void sample(uint64_t cpuTimeNs, uint64_t gpuTimeStamp) {
+        cpuTime = cpuTimeNs;
+        mockDeviceTime->sampleToReturn = {gpuTimeStamp, cpuTimeNs};
+        TimeStampData timeStamp{};
+        EXPECT_TRUE(getCpuGpuTime(&timeStamp));
+    }
+
+    ControlledDeviceTime *mockDeviceTime = nullptr;
+    uint64_t cpuTime = 0u;
+};
+} // namespace
+
+TEST(OSTimeCalibrationTest, givenCalibrationDisabledWhenGettingCpuGpuTimeThenDeviceIsSampledEveryTime) {
+    ControlledOSTime osTime;
+    osTime.sample(1000u, 100u);
+    osTime.sample(2000u, 200u);
+    osTime.sample(3000u, 300u);
+    EXPECT_EQ(3u, osTime.mockDeviceTime->getCpuGpuTimeCalled);
+}
+
+TEST(OSTimeCalibrationTest, givenCalibrationEnabledWhenModelIsFittedThenQueriesWithinIntervalAreAnsweredFromModel) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.CpuGpuTimeCalibrationIntervalMs.set(1);
+
+    ControlledOSTime osTime;
+    osTime.sample(1000000u, 1000u);
+    osTime.sample(3000000u, 1200u);
+    EXPECT_EQ(2u, osTime.mockDeviceTime->getCpuGpuTimeCalled);
+
+    osTime.cpuTime = 3500000u;
+    TimeStampData timeStamp{};
+    EXPECT_TRUE(osTime.getCpuGpuTime(&timeStamp));
+    EXPECT_EQ(2u, osTime.mockDeviceTime->getCpuGpuTimeCalled);
+    EXPECT_EQ(3500000u, timeStamp.CPUTimeinNS);
+    EXPECT_EQ(1250u, timeStamp.GPUTimeStamp);
+
+    osTime.cpuTime = 4000000u;
+    EXPECT_TRUE(osTime.getCpuGpuTime(&timeStamp));
+    EXPECT_EQ(3u, osTime.mockDeviceTime->getCpuGpuTimeCalled);
+}
+
+TEST(OSTimeCalibrationTest, givenModelErrorAboveBoundWhenGettingCpuGpuTimeThenDeviceIsSampledUntilModelIsAccurate) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.CpuGpuTimeCalibrationIntervalMs.set(1);
+    DebugManager.flags.CpuGpuTimeCalibrationMaxErrorNs.set(1000);
+
+    ControlledOSTime osTime;
+    osTime.sample(1000000u, 1000u);
+    osTime.sample(2000000u, 1100u);
+    osTime.sample(3000000u, 1300u);
+    EXPECT_EQ(1000000u, osTime.getCpuGpuTimeModelErrorNs());
+    EXPECT_EQ(3u, osTime.mockDeviceTime->getCpuGpuTimeCalled);
+
+    osTime.sample(3100000u, 1320u);
+    EXPECT_EQ(4u, osTime.mockDeviceTime->getCpuGpuTimeCalled);
+    EXPECT_EQ(0u, osTime.getCpuGpuTimeModelErrorNs());
+
+    osTime.sample(3200000u, 0u);
+    EXPECT_EQ(4u, osTime.mockDeviceTime->getCpuGpuTimeCalled);
+}
@@ -172,6 +172,34 @@ TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocWhenMovingAllocsOfGivenUMMan
     EXPECT_EQ(unifiedMemoryManager->nonGpuDomainAllocs.size(), 0u);
 }
 
+TEST_F(PageFaultManagerTest, givenRegisterPageFaultHandlerOnMigrationEnabledAndHandlerReplacedWhenMovingAllocsToGpuDomainThenFaultHandlerIsRegistered) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.RegisterPageFaultHandlerOnMigration.set(1);
+
+    void *alloc = reinterpret_cast<void *>(0x1);
+    pageFaultManager->insertAllocation(alloc, 10u, unifiedMemoryManager.get(), nullptr, {});
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+    EXPECT_EQ(1, pageFaultManager->checkFaultHandlerCalled);
+    EXPECT_EQ(0, pageFaultManager->registerFaultHandlerCalled);
+
+    pageFaultManager->isFaultHandlerFromPageFaultManager = false;
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+    EXPECT_EQ(2, pageFaultManager->checkFaultHandlerCalled);
+    EXPECT_EQ(1, pageFaultManager->registerFaultHandlerCalled);
+}
+
+TEST_F(PageFaultManagerTest, givenRegisterPageFaultHandlerOnMigrationDefaultWhenMovingAllocsToGpuDomainThenFaultHandlerIsNotChecked) {
+    void *alloc = reinterpret_cast<void *>(0x1);
+    pageFaultManager->insertAllocation(alloc, 10u, unifiedMemoryManager.get(), nullptr, {});
+    pageFaultManager->isFaultHandlerFromPageFaultManager = false;
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+    EXPECT_EQ(0, pageFaultManager->checkFaultHandlerCalled);
+    EXPECT_EQ(0, pageFaultManager->registerFaultHandlerCalled);
+    EXPECT_EQ(1, pageFaultManager->transferToGpuCalled);
+}
+
 TEST_F(PageFaultManagerTest, givenUnifiedMemoryAllocsWhenMovingToGpuDomainWithPrintUsmSharedMigrationDebugKeyThenMessageIsPrinted) {
     DebugManagerStateRestore restorer;
     DebugManager.flags.PrintUmdSharedMigration.set(1);
@@ -755,3 +783,102 @@ TEST_F(PageFaultManagerTest, givenNoUsmInitialPlacementFlagsWHenInsertingUsmAllo
     EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, pageFaultManager->memoryData.at(allocs[3]).domain);
     EXPECT_EQ(allocs[3], unifiedMemoryManager->nonGpuDomainAllocs[3]);
 }
+
+TEST_F(PageFaultManagerTest, givenMigrationChunkSizeSetWhenInsertingAllocationLargerThanChunkThenAllocationIsTrackedInChunks) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SharedAllocationMigrationChunkSizeInKb.set(64);
+    void *alloc1 = reinterpret_cast<void *>(0x10000);
+    void *alloc2 = reinterpret_cast<void *>(0x100000);
+    constexpr size_t chunkSize = 64 * MemoryConstants::kiloByte;
+
+    pageFaultManager->insertAllocation(alloc1, 3 * chunkSize + 1, unifiedMemoryManager.get(), nullptr, {});
+    EXPECT_EQ(chunkSize, pageFaultManager->memoryData[alloc1].chunkSize);
+    EXPECT_EQ(4u, pageFaultManager->memoryData[alloc1].cpuChunks.size());
+
+    pageFaultManager->insertAllocation(alloc2, chunkSize, unifiedMemoryManager.get(), nullptr, {});
+    EXPECT_EQ(0u, pageFaultManager->memoryData[alloc2].chunkSize);
+    EXPECT_TRUE(pageFaultManager->memoryData[alloc2].cpuChunks.empty());
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedAllocationInGpuDomainWhenPageFaultOccursThenOnlyFaultedChunkIsMigratedToCpuAndBackToGpu) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SharedAllocationMigrationChunkSizeInKb.set(64);
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    constexpr size_t chunkSize = 64 * MemoryConstants::kiloByte;
+
+    pageFaultManager->insertAllocation(alloc, 4 * chunkSize, unifiedMemoryManager.get(), cmdQ, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(1, pageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(alloc, pageFaultManager->transferToGpuAddress);
+    EXPECT_EQ(4 * chunkSize, pageFaultManager->transferToGpuSize);
+    EXPECT_EQ(1, pageFaultManager->protectMemoryCalled);
+    EXPECT_EQ(4 * chunkSize, pageFaultManager->protectedSize);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Gpu, pageFaultManager->memoryData[alloc].domain);
+    EXPECT_TRUE(unifiedMemoryManager->nonGpuDomainAllocs.empty());
+
+    auto chunkPtr = ptrOffset(alloc, chunkSize);
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(chunkPtr, 0x10)));
+    EXPECT_EQ(1, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(chunkPtr, pageFaultManager->transferToCpuAddress);
+    EXPECT_EQ(chunkSize, pageFaultManager->transferToCpuSize);
+    EXPECT_EQ(1, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(chunkPtr, pageFaultManager->allowedMemoryAccessAddress);
+    EXPECT_EQ(chunkSize, pageFaultManager->accessAllowedSize);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Cpu, pageFaultManager->memoryData[alloc].domain);
+    EXPECT_EQ(1u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+
+    pageFaultManager->moveAllocationsWithinUMAllocsManagerToGpuDomain(unifiedMemoryManager.get());
+    EXPECT_EQ(2, pageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(chunkPtr, pageFaultManager->transferToGpuAddress);
+    EXPECT_EQ(chunkSize, pageFaultManager->transferToGpuSize);
+    EXPECT_EQ(2, pageFaultManager->protectMemoryCalled);
+    EXPECT_EQ(chunkPtr, pageFaultManager->protectedMemoryAccessAddress);
+    EXPECT_EQ(chunkSize, pageFaultManager->protectedSize);
+    EXPECT_EQ(PageFaultManager::AllocationDomain::Gpu, pageFaultManager->memoryData[alloc].domain);
+}
+
+TEST_F(PageFaultManagerTest, givenAdjacentChunksAccessedByCpuWhenMovingAllocationToGpuDomainThenChunksAreTransferredAndProtectedTogether) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SharedAllocationMigrationChunkSizeInKb.set(64);
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    constexpr size_t chunkSize = 64 * MemoryConstants::kiloByte;
+
+    pageFaultManager->insertAllocation(alloc, 4 * chunkSize, unifiedMemoryManager.get(), cmdQ, {});
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, 2 * chunkSize)));
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, chunkSize)));
+    EXPECT_EQ(2, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(1u, unifiedMemoryManager->nonGpuDomainAllocs.size());
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(2, pageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(ptrOffset(alloc, chunkSize), pageFaultManager->transferToGpuAddress);
+    EXPECT_EQ(2 * chunkSize, pageFaultManager->transferToGpuSize);
+    EXPECT_EQ(2, pageFaultManager->protectMemoryCalled);
+    EXPECT_EQ(2 * chunkSize, pageFaultManager->protectedSize);
+}
+
+TEST_F(PageFaultManagerTest, givenChunkedAllocationNeverMigratedToGpuWhenPageFaultOccursThenChunkIsNotTransferred) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.SharedAllocationMigrationChunkSizeInKb.set(64);
+    void *cmdQ = reinterpret_cast<void *>(0xFFFF);
+    void *alloc = reinterpret_cast<void *>(0x10000);
+    constexpr size_t chunkSize = 64 * MemoryConstants::kiloByte;
+
+    pageFaultManager->insertAllocation(alloc, 4 * chunkSize, unifiedMemoryManager.get(), cmdQ, {});
+    pageFaultManager->memoryData[alloc].domain = PageFaultManager::AllocationDomain::None;
+    std::fill(pageFaultManager->memoryData[alloc].cpuChunks.begin(), pageFaultManager->memoryData[alloc].cpuChunks.end(), false);
+
+    EXPECT_TRUE(pageFaultManager->verifyPageFault(ptrOffset(alloc, 3 * chunkSize)));
+    EXPECT_EQ(0, pageFaultManager->transferToCpuCalled);
+    EXPECT_EQ(1, pageFaultManager->allowMemoryAccessCalled);
+    EXPECT_EQ(ptrOffset(alloc, 3 * chunkSize), pageFaultManager->allowedMemoryAccessAddress);
+
+    pageFaultManager->moveAllocationToGpuDomain(alloc);
+    EXPECT_EQ(1, pageFaultManager->transferToGpuCalled);
+    EXPECT_EQ(ptrOffset(alloc, 3 * chunkSize), pageFaultManager->transferToGpuAddress);
+    EXPECT_EQ(chunkSize, pageFaultManager->transferToGpuSize);
+}
@@ -122,8 +122,10 @@ TEST_F(PageFaultManagerLinuxTest, givenProtectedMemoryWhenTryingToAccessThenPage
 class MockFailPageFaultManager : public PageFaultManagerLinux {
   public:
     using PageFaultManagerLinux::callPreviousHandler;
+    using PageFaultManagerLinux::checkFaultHandlerFromPageFaultManager;
     using PageFaultManagerLinux::PageFaultManagerLinux;
     using PageFaultManagerLinux::previousHandlerRestored;
+    using PageFaultManagerLinux::registerFaultHandler;
 
     bool verifyPageFault(void *ptr) override {
         verifyCalled = true;
@@ -223,3 +225,44 @@ TEST_F(PageFaultManagerLinuxTest, givenIgnoringSaHandlerWhenInvokeCallPreviousSa
     mockPageFaultManager.reset();
     sigaction(SIGSEGV, &originalHandler, nullptr);
 }
+
+TEST_F(PageFaultManagerLinuxTest, givenHandlerReplacedAfterPageFaultManagerCreationWhenRegisteringFaultHandlerThenPageFaultManagerHandlerIsRestoredAndReplacingHandlerIsChained) {
+    struct sigaction originalHandler = {};
+    auto mockPageFaultManager = std::make_unique<MockFailPageFaultManager>();
+    EXPECT_TRUE(mockPageFaultManager->checkFaultHandlerFromPageFaultManager());
+
+    struct sigaction mockHandler = {};
+    mockHandler.sa_flags = SA_SIGINFO;
+    mockHandler.sa_sigaction = MockFailPageFaultManager::mockPageFaultHandler;
+    auto retVal = sigaction(SIGSEGV, &mockHandler, &originalHandler);
+    EXPECT_EQ(retVal, 0);
+    EXPECT_FALSE(mockPageFaultManager->checkFaultHandlerFromPageFaultManager());
+
+    mockPageFaultManager->registerFaultHandler();
+    EXPECT_TRUE(mockPageFaultManager->checkFaultHandlerFromPageFaultManager());
+
+    std::raise(SIGSEGV);
+    EXPECT_TRUE(mockPageFaultManager->verifyCalled);
+    EXPECT_TRUE(MockFailPageFaultManager::mockCalled);
+
+    mockPageFaultManager.reset();
+    sigaction(SIGSEGV, &originalHandler, nullptr);
+}
+
+TEST_F(PageFaultManagerLinuxTest, givenHandlerReplacedAfterPageFaultManagerCreationWhenPageFaultManagerIsDestroyedThenReplacingHandlerStaysInstalled) {
+    struct sigaction originalHandler = {};
+    auto mockPageFaultManager = std::make_unique<MockFailPageFaultManager>();
+
+    struct sigaction mockHandler = {};
+    mockHandler.sa_flags = SA_SIGINFO;
+    mockHandler.sa_sigaction = MockFailPageFaultManager::mockPageFaultHandler;
+    auto retVal = sigaction(SIGSEGV, &mockHandler, &originalHandler);
+    EXPECT_EQ(retVal, 0);
+
+    mockPageFaultManager.reset();
+
+    struct sigaction currentHandler = {};
+    retVal = sigaction(SIGSEGV, &originalHandler, &currentHandler);
+    EXPECT_EQ(retVal, 0);
+    EXPECT_EQ(reinterpret_cast<void *>(MockFailPageFaultManager::mockPageFaultHandler), reinterpret_cast<void *>(currentHandler.sa_sigaction));
+}
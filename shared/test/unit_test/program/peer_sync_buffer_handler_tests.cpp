@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/program/peer_sync_buffer_handler.h"
+#include "shared/source/program/peer_sync_buffer_handler.inl"
+#include "shared/test/common/mocks/mock_device.h"
+#include "shared/test/common/mocks/ult_device_factory.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+class MockPeerSyncBufferHandler : public PeerSyncBufferHandler {
+  public:
+    using PeerSyncBufferHandler::bufferSize;
+    using PeerSyncBufferHandler::PeerSyncBufferHandler;
+    using PeerSyncBufferHandler::usedBufferSize;
+};
+
+struct MockSyncBufferKernel {
+    void patchSyncBuffer(GraphicsAllocation *gfxAllocation, size_t bufferOffset) {
+        patchedAllocation = gfxAllocation;
+        patchedOffset = bufferOffset;
+    }
+
+    GraphicsAllocation *patchedAllocation = nullptr;
+    size_t patchedOffset = 0u;
+};
+
+struct PeerSyncBufferHandlerTest : ::testing::Test {
+    UltDeviceFactory deviceFactory{2, 0};
+    RootDeviceIndicesContainer rootDeviceIndices = {0u, 1u};
+};
+
+TEST_F(PeerSyncBufferHandlerTest, givenPeerSyncBufferWhenPreparingKernelsOfCollectiveThenKernelsOnAllDevicesShareTheSameMemoryAndSlot) {
+    MockPeerSyncBufferHandler handler(*deviceFactory.rootDevices[0]->getMemoryManager(), rootDeviceIndices);
+
+    auto allocation0 = handler.getGraphicsAllocation(0u);
+    auto allocation1 = handler.getGraphicsAllocation(1u);
+    ASSERT_NE(nullptr, allocation0);
+    ASSERT_NE(nullptr, allocation1);
+    EXPECT_NE(allocation0, allocation1);
+    EXPECT_EQ(allocation0->getUnderlyingBuffer(), allocation1->getUnderlyingBuffer());
+
+    auto firstSlot = handler.obtainSlot(10u);
+    auto secondSlot = handler.obtainSlot(10u);
+    EXPECT_EQ(0u, firstSlot);
+    EXPECT_EQ(alignUp(10u, CommonConstants::maximalSizeOfAtomicType), secondSlot);
+
+    MockSyncBufferKernel kernels[2];
+    handler.prepareForEnqueue(0u, secondSlot, kernels[0]);
+    handler.prepareForEnqueue(1u, secondSlot, kernels[1]);
+    EXPECT_EQ(allocation0, kernels[0].patchedAllocation);
+    EXPECT_EQ(allocation1, kernels[1].patchedAllocation);
+    EXPECT_EQ(secondSlot, kernels[0].patchedOffset);
+    EXPECT_EQ(secondSlot, kernels[1].patchedOffset);
+}
+
+TEST_F(PeerSyncBufferHandlerTest, givenFullPeerSyncBufferWhenObtainingSlotThenNewZeroedBufferIsAllocated) {
+    MockPeerSyncBufferHandler handler(*deviceFactory.rootDevices[0]->getMemoryManager(), rootDeviceIndices);
+    memset(handler.getGraphicsAllocation(0u)->getUnderlyingBuffer(), 1, handler.bufferSize);
+
+    handler.usedBufferSize = handler.bufferSize - CommonConstants::maximalSizeOfAtomicType;
+    auto slot = handler.obtainSlot(2 * CommonConstants::maximalSizeOfAtomicType);
+
+    EXPECT_EQ(0u, slot);
+    EXPECT_EQ(2 * CommonConstants::maximalSizeOfAtomicType, handler.usedBufferSize);
+    auto buffer = reinterpret_cast<uint8_t *>(handler.getGraphicsAllocation(1u)->getUnderlyingBuffer());
+    EXPECT_EQ(0u, buffer[0]);
+    EXPECT_EQ(0u, buffer[handler.bufferSize - 1]);
+}
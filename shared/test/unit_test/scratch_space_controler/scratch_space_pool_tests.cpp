@@ -0,0 +1,136 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_stream/scratch_space_controller_base.h"
+#include "shared/source/command_stream/scratch_space_pool.h"
+#include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/memory_manager/allocation_properties.h"
+#include "shared/test/common/fixtures/device_fixture.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_command_stream_receiver.h"
+#include "shared/test/common/test_macros/hw_test.h"
+
+using namespace NEO;
+
+class MockScratchSpacePool : public ScratchSpacePool {
+  public:
+    using ScratchSpacePool::allocationsInUse;
+    using ScratchSpacePool::pooledAllocations;
+    using ScratchSpacePool::pooledSize;
+    using ScratchSpacePool::ScratchSpacePool;
+
+    bool isAllocationIdle(GraphicsAllocation &allocation) override {
+        return allocationIdle;
+    }
+
+    bool allocationIdle = true;
+};
+
+using ScratchSpacePoolTests = Test<DeviceFixture>;
+
+TEST(ScratchSpacePoolSizeClassTests, whenGettingSizeClassThenSizeIsRoundedUpToPowerOfTwoNotSmallerThanMinimalClass) {
+    EXPECT_EQ(ScratchSpacePool::minSizeClass, ScratchSpacePool::getSizeClass(1u));
+    EXPECT_EQ(ScratchSpacePool::minSizeClass, ScratchSpacePool::getSizeClass(ScratchSpacePool::minSizeClass));
+    EXPECT_EQ(2 * ScratchSpacePool::minSizeClass, ScratchSpacePool::getSizeClass(ScratchSpacePool::minSizeClass + 1));
+    EXPECT_EQ(8 * MemoryConstants::megaByte, ScratchSpacePool::getSizeClass(5 * MemoryConstants::megaByte));
+}
+
+TEST_F(ScratchSpacePoolTests, givenReleasedIdleAllocationWhenObtainingAllocationOfSameKindThenItIsReused) {
+    MockScratchSpacePool pool(*pDevice->getMemoryManager(), ScratchSpacePool::defaultMaxPooledSize);
+    AllocationProperties properties{pDevice->getRootDeviceIndex(), 100 * MemoryConstants::kiloByte, AllocationType::SCRATCH_SURFACE, pDevice->getDeviceBitfield()};
+
+    auto allocation = pool.obtainAllocation(properties);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(ScratchSpacePool::getSizeClass(properties.size), allocation->getUnderlyingBufferSize());
+    EXPECT_EQ(1u, pool.allocationsInUse.size());
+
+    pool.releaseAllocation(allocation);
+    EXPECT_EQ(0u, pool.allocationsInUse.size());
+    EXPECT_EQ(1u, pool.pooledAllocations.size());
+    EXPECT_EQ(allocation->getUnderlyingBufferSize(), pool.pooledSize);
+
+    properties.size = 80 * MemoryConstants::kiloByte;
+    auto reusedAllocation = pool.obtainAllocation(properties);
+    EXPECT_EQ(allocation, reusedAllocation);
+    EXPECT_EQ(0u, pool.pooledAllocations.size());
+    EXPECT_EQ(0u, pool.pooledSize);
+
+    AllocationProperties privateProperties{pDevice->getRootDeviceIndex(), 100 * MemoryConstants::kiloByte, AllocationType::PRIVATE_SURFACE, pDevice->getDeviceBitfield()};
+    pool.releaseAllocation(reusedAllocation);
+    auto privateAllocation = pool.obtainAllocation(privateProperties);
+    EXPECT_NE(allocation, privateAllocation);
+    EXPECT_EQ(1u, pool.pooledAllocations.size());
+
+    pool.releaseAllocation(privateAllocation);
+}
+
+TEST_F(ScratchSpacePoolTests, givenReleasedAllocationStillUsedByGpuWhenObtainingAllocationThenNewAllocationIsCreated) {
+    MockScratchSpacePool pool(*pDevice->getMemoryManager(), ScratchSpacePool::defaultMaxPooledSize);
+    AllocationProperties properties{pDevice->getRootDeviceIndex(), MemoryConstants::pageSize64k, AllocationType::SCRATCH_SURFACE, pDevice->getDeviceBitfield()};
+
+    auto allocation = pool.obtainAllocation(properties);
+    pool.releaseAllocation(allocation);
+
+    pool.allocationIdle = false;
+    auto newAllocation = pool.obtainAllocation(properties);
+    EXPECT_NE(allocation, newAllocation);
+    EXPECT_EQ(1u, pool.pooledAllocations.size());
+
+    pool.releaseAllocation(newAllocation);
+    EXPECT_EQ(2u, pool.pooledAllocations.size());
+}
+
+TEST_F(ScratchSpacePoolTests, givenPooledSizeAboveLimitWhenReleasingAllocationThenOldestPooledAllocationsAreFreed) {
+    MockScratchSpacePool pool(*pDevice->getMemoryManager(), MemoryConstants::pageSize64k);
+    AllocationProperties properties{pDevice->getRootDeviceIndex(), MemoryConstants::pageSize64k, AllocationType::SCRATCH_SURFACE, pDevice->getDeviceBitfield()};
+
+    auto allocation0 = pool.obtainAllocation(properties);
+    auto allocation1 = pool.obtainAllocation(properties);
+
+    pool.releaseAllocation(allocation0);
+    EXPECT_EQ(1u, pool.pooledAllocations.size());
+
+    pool.releaseAllocation(allocation1);
+    ASSERT_EQ(1u, pool.pooledAllocations.size());
+    EXPECT_EQ(allocation1, pool.pooledAllocations[0].allocation);
+    EXPECT_EQ(MemoryConstants::pageSize64k, pool.pooledSize);
+}
+
+class MockScratchSpaceControllerForPool : public ScratchSpaceControllerBase {
+  public:
+    using ScratchSpaceControllerBase::scratchSpacePool;
+    using ScratchSpaceControllerBase::ScratchSpaceControllerBase;
+};
+
+HWTEST_F(ScratchSpacePoolTests, givenScratchSpacePoolingEnabledWhenScratchOfOneControllerGrowsThenRetiredAllocationIsReusedByOtherController) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableScratchSpacePooling.set(1);
+
+    MockCsrHw2<FamilyType> csr(*pDevice->getExecutionEnvironment(), 0, pDevice->getDeviceBitfield());
+    csr.initializeTagAllocation();
+    csr.setupContext(*pDevice->getDefaultEngine().osContext);
+    auto &osContext = *pDevice->getDefaultEngine().osContext;
+
+    auto executionEnvironment = pDevice->getExecutionEnvironment();
+    auto controller0 = std::make_unique<MockScratchSpaceControllerForPool>(pDevice->getRootDeviceIndex(), *executionEnvironment, *csr.getInternalAllocationStorage());
+    auto controller1 = std::make_unique<MockScratchSpaceControllerForPool>(pDevice->getRootDeviceIndex(), *executionEnvironment, *csr.getInternalAllocationStorage());
+    ASSERT_NE(nullptr, controller0->scratchSpacePool);
+    EXPECT_EQ(executionEnvironment->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]->getScratchSpacePool(), controller0->scratchSpacePool);
+
+    bool stateBaseAddressDirty = false;
+    bool vfeStateDirty = false;
+    controller0->setRequiredScratchSpace(nullptr, 0u, 0x400, 0u, 0u, osContext, stateBaseAddressDirty, vfeStateDirty);
+    auto smallAllocation = controller0->getScratchSpaceAllocation();
+    ASSERT_NE(nullptr, smallAllocation);
+
+    controller0->setRequiredScratchSpace(nullptr, 0u, 0x4000, 0u, 0u, osContext, stateBaseAddressDirty, vfeStateDirty);
+    EXPECT_NE(smallAllocation, controller0->getScratchSpaceAllocation());
+    EXPECT_TRUE(csr.getTemporaryAllocations().peekIsEmpty());
+
+    controller1->setRequiredScratchSpace(nullptr, 0u, 0x400, 0u, 0u, osContext, stateBaseAddressDirty, vfeStateDirty);
+    EXPECT_EQ(smallAllocation, controller1->getScratchSpaceAllocation());
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/tbx/tbx_proto.h"
+#include "shared/source/tbx/tbx_sockets_imp.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+using namespace NEO;
+
+class MockTbxSocketsImp : public TbxSocketsImp {
+  public:
+    using TbxSocketsImp::flushPendingWrites;
+    using TbxSocketsImp::pendingWrites;
+    using TbxSocketsImp::TbxSocketsImp;
+
+    bool sendWriteData(const void *buffer, size_t sizeInBytes) override {
+        auto dataBuffer = reinterpret_cast<const char *>(buffer);
+        sentData.emplace_back(dataBuffer, dataBuffer + sizeInBytes);
+        return true;
+    }
+
+    std::vector<std::vector<char>> sentData;
+};
+
+constexpr size_t writeRequestSize = sizeof(HAS_HDR) + sizeof(HAS_WRITE_DATA_REQ);
+
+HAS_MSG getWriteRequest(const std::vector<char> &data, size_t offset) {
+    HAS_MSG cmd = {};
+    memcpy(&cmd, &data[offset], writeRequestSize);
+    return cmd;
+}
+
+TEST(TbxSocketsImpTest, givenWritesToAdjacentAddressesWhenFlushingThenSingleWriteRequestIsSent) {
+    std::stringstream err;
+    MockTbxSocketsImp tbxSockets(err);
+
+    char data[] = {1, 2, 3, 4, 5, 6, 7, 8};
+    EXPECT_TRUE(tbxSockets.writeMemory(0x1000, data, 4, MEM_TYPE_SYSTEM));
+    EXPECT_TRUE(tbxSockets.writeMemory(0x1004, data + 4, 4, MEM_TYPE_SYSTEM));
+    EXPECT_TRUE(tbxSockets.sentData.empty());
+
+    EXPECT_TRUE(tbxSockets.flushPendingWrites());
+    ASSERT_EQ(1u, tbxSockets.sentData.size());
+    auto &sent = tbxSockets.sentData[0];
+    ASSERT_EQ(writeRequestSize + sizeof(data), sent.size());
+
+    auto cmd = getWriteRequest(sent, 0);
+    EXPECT_EQ(static_cast<uint32_t>(HAS_WRITE_DATA_REQ_TYPE), cmd.hdr.msg_type);
+    EXPECT_EQ(0x1000u, cmd.u.write_req.address);
+    EXPECT_EQ(sizeof(data), cmd.u.write_req.size);
+    EXPECT_EQ(0, memcmp(data, &sent[writeRequestSize], sizeof(data)));
+}
+
+TEST(TbxSocketsImpTest, givenWritesToNonAdjacentAddressesOrDifferentMemoryTypesWhenFlushingThenSeparateRequestsAreSentAtOnce) {
+    std::stringstream err;
+    MockTbxSocketsImp tbxSockets(err);
+
+    uint32_t data = 0x12345678;
+    EXPECT_TRUE(tbxSockets.writeMemory(0x1000, &data, sizeof(data), MEM_TYPE_SYSTEM));
+    EXPECT_TRUE(tbxSockets.writeMemory(0x2000, &data, sizeof(data), MEM_TYPE_SYSTEM));
+    EXPECT_TRUE(tbxSockets.writeMemory(0x2004, &data, sizeof(data), MEM_TYPE_LOCALMEM));
+
+    EXPECT_TRUE(tbxSockets.flushPendingWrites());
+    ASSERT_EQ(1u, tbxSockets.sentData.size());
+    auto &sent = tbxSockets.sentData[0];
+    ASSERT_EQ(3 * (writeRequestSize + sizeof(data)), sent.size());
+
+    EXPECT_EQ(0x1000u, getWriteRequest(sent, 0).u.write_req.address);
+    EXPECT_EQ(0x2000u, getWriteRequest(sent, writeRequestSize + sizeof(data)).u.write_req.address);
+    auto lastCmd = getWriteRequest(sent, 2 * (writeRequestSize + sizeof(data)));
+    EXPECT_EQ(0x2004u, lastCmd.u.write_req.address);
+    EXPECT_EQ(static_cast<uint32_t>(MEM_TYPE_LOCALMEM), lastCmd.u.write_req.memory_type);
+}
+
+TEST(TbxSocketsImpTest, givenPendingWritesWhenWritingMmioThenAllRequestsAreSent) {
+    std::stringstream err;
+    MockTbxSocketsImp tbxSockets(err);
+
+    uint64_t entry = 0x1000;
+    EXPECT_TRUE(tbxSockets.writeGTT(0, entry));
+    EXPECT_TRUE(tbxSockets.writeMemory(0x1000, &entry, sizeof(entry), MEM_TYPE_SYSTEM));
+    EXPECT_TRUE(tbxSockets.sentData.empty());
+
+    EXPECT_TRUE(tbxSockets.writeMMIO(0x2000, 1));
+    ASSERT_EQ(1u, tbxSockets.sentData.size());
+    EXPECT_EQ(sizeof(HAS_HDR) + sizeof(HAS_GTT64_REQ) + writeRequestSize + sizeof(entry) + sizeof(HAS_HDR) + sizeof(HAS_MMIO_REQ), tbxSockets.sentData[0].size());
+    EXPECT_TRUE(tbxSockets.pendingWrites.empty());
+}
+
+TEST(TbxSocketsImpTest, givenWriteBatchingDisabledWhenWritingMemoryThenRequestIsSentImmediately) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.TbxWriteBatchSize.set(0);
+
+    std::stringstream err;
+    MockTbxSocketsImp tbxSockets(err);
+
+    uint32_t data[2] = {};
+    EXPECT_TRUE(tbxSockets.writeMemory(0x1000, &data[0], sizeof(data[0]), MEM_TYPE_SYSTEM));
+    EXPECT_TRUE(tbxSockets.writeMemory(0x1004, &data[1], sizeof(data[1]), MEM_TYPE_SYSTEM));
+
+    ASSERT_EQ(4u, tbxSockets.sentData.size());
+    EXPECT_EQ(writeRequestSize, tbxSockets.sentData[0].size());
+    EXPECT_EQ(sizeof(data[0]), tbxSockets.sentData[1].size());
+    EXPECT_TRUE(tbxSockets.pendingWrites.empty());
+}
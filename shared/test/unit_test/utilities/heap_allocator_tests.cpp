@@ -1,11 +1,12 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2022 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #include "shared/source/utilities/heap_allocator.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/test_macros/test.h"
 
 #include "gtest/gtest.h"
@@ -40,6 +41,7 @@ class HeapAllocatorUnderTest : public HeapAllocator {
     std::vector<HeapChunk> &getFreedChunksBig() { return this->freedChunksBig; };
 
     using HeapAllocator::allocationAlignment;
+    using HeapAllocator::sizeClassFreeLists;
 };
 
 TEST(HeapAllocatorTest, WhenHeapAllocatorIsCreatedWithAlignmentThenAlignmentIsSet) {
@@ -1423,3 +1425,90 @@ TEST(HeapAllocatorTest, givenZeroAlignmentPassedWhenAllocatingMemoryWithCustomAl
     uint64_t ptr = heapAllocator.allocateWithCustomAlignment(ptrSize, 0u);
     EXPECT_EQ(alignUp(heapBase, allocationAlignment), ptr);
 }
+
+TEST(HeapAllocatorTest, givenSizeClassCacheDisabledWhenFreeingPageSizedChunkThenChunkIsStoredInFreedChunks) {
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
+
+    size_t sizeToAllocate = MemoryConstants::pageSize;
+    auto ptr1 = heapAllocator->allocate(sizeToAllocate);
+    auto ptr2 = heapAllocator->allocate(sizeToAllocate);
+    EXPECT_NE(0llu, ptr2);
+    heapAllocator->free(ptr1, MemoryConstants::pageSize);
+
+    EXPECT_EQ(1u, heapAllocator->getFreedChunksSmall().size());
+    EXPECT_TRUE(heapAllocator->sizeClassFreeLists[0].empty());
+}
+
+TEST(HeapAllocatorTest, givenSizeClassCacheEnabledWhenFreeingAndAllocatingSizeClassChunkThenChunkIsReusedFromSizeClassFreeList) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableHeapAllocatorSizeClassCache.set(1);
+
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
+
+    size_t sizeToAllocate = MemoryConstants::pageSize;
+    auto ptr1 = heapAllocator->allocate(sizeToAllocate);
+    auto ptr2 = heapAllocator->allocate(sizeToAllocate);
+    EXPECT_NE(0llu, ptr2);
+    auto availableSize = heapAllocator->getavailableSize();
+
+    heapAllocator->free(ptr1, MemoryConstants::pageSize);
+    EXPECT_TRUE(heapAllocator->getFreedChunksSmall().empty());
+    ASSERT_EQ(1u, heapAllocator->sizeClassFreeLists[0].size());
+    EXPECT_EQ(availableSize + MemoryConstants::pageSize, heapAllocator->getavailableSize());
+
+    sizeToAllocate = MemoryConstants::pageSize;
+    auto ptr3 = heapAllocator->allocate(sizeToAllocate);
+    EXPECT_EQ(ptr1, ptr3);
+    EXPECT_TRUE(heapAllocator->sizeClassFreeLists[0].empty());
+    EXPECT_EQ(availableSize, heapAllocator->getavailableSize());
+}
+
+TEST(HeapAllocatorTest, givenSizeClassCacheEnabledWhenFreeingChunkOfOtherSizeThenChunkIsStoredInFreedChunks) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableHeapAllocatorSizeClassCache.set(1);
+
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
+
+    size_t sizeToAllocate = 2 * MemoryConstants::pageSize;
+    auto ptr1 = heapAllocator->allocate(sizeToAllocate);
+    auto ptr2 = heapAllocator->allocate(sizeToAllocate);
+    EXPECT_NE(0llu, ptr2);
+    heapAllocator->free(ptr1, 2 * MemoryConstants::pageSize);
+
+    EXPECT_EQ(1u, heapAllocator->getFreedChunksSmall().size());
+    EXPECT_TRUE(heapAllocator->sizeClassFreeLists[0].empty());
+    EXPECT_TRUE(heapAllocator->sizeClassFreeLists[1].empty());
+}
+
+TEST(HeapAllocatorTest, givenSizeClassCacheEnabledWhenDefragmentingThenSizeClassChunksAreMergedBackIntoHeap) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableHeapAllocatorSizeClassCache.set(1);
+
+    uint64_t ptrBase = 0x100000llu;
+    size_t size = 1024 * 4096;
+    auto heapAllocator = std::make_unique<HeapAllocatorUnderTest>(ptrBase, size, allocationAlignment, sizeThreshold);
+    auto rightBound = heapAllocator->getRightBound();
+
+    size_t sizeToAllocate = MemoryConstants::pageSize;
+    auto ptr1 = heapAllocator->allocate(sizeToAllocate);
+    auto ptr2 = heapAllocator->allocate(sizeToAllocate);
+    auto ptr3 = heapAllocator->allocate(sizeToAllocate);
+
+    heapAllocator->free(ptr2, MemoryConstants::pageSize);
+    heapAllocator->free(ptr1, MemoryConstants::pageSize);
+    EXPECT_EQ(2u, heapAllocator->sizeClassFreeLists[0].size());
+
+    heapAllocator->free(ptr3, MemoryConstants::pageSize);
+    heapAllocator->defragment();
+
+    EXPECT_TRUE(heapAllocator->sizeClassFreeLists[0].empty());
+    EXPECT_TRUE(heapAllocator->getFreedChunksSmall().empty());
+    EXPECT_EQ(rightBound, heapAllocator->getRightBound());
+    EXPECT_EQ(size, heapAllocator->getavailableSize());
+}
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/interval_tree.h"
+
+#include "gtest/gtest.h"
+
+#include <limits>
+#include <vector>
+
+using namespace NEO;
+
+TEST(IntervalTreeTest, givenEmptyTreeWhenQueryingThenNothingIsFound) {
+    IntervalTree<int> tree;
+    EXPECT_TRUE(tree.empty());
+    EXPECT_EQ(nullptr, tree.find(0x1000));
+    EXPECT_FALSE(tree.erase(0x1000));
+    EXPECT_FALSE(tree.forEachOverlapping(0u, std::numeric_limits<uintptr_t>::max(), [](uintptr_t, uintptr_t, int &) { return true; }));
+}
+
+TEST(IntervalTreeTest, givenStoredRangesWhenValuesAreInsertedAndErasedThenReferencesToRemainingValuesStayValid) {
+    IntervalTree<int> tree;
+    std::vector<int *> values;
+    for (int i = 0; i < 64; i++) {
+        values.push_back(&tree.insert(0x1000 * (i + 1), 0x1000 * (i + 1) + 0x800, i));
+    }
+    EXPECT_EQ(64u, tree.size());
+
+    for (int i = 0; i < 64; i += 2) {
+        EXPECT_TRUE(tree.erase(0x1000 * (i + 1)));
+    }
+    EXPECT_EQ(32u, tree.size());
+
+    for (int i = 1; i < 64; i += 2) {
+        EXPECT_EQ(values[i], tree.find(0x1000 * (i + 1)));
+        EXPECT_EQ(i, *values[i]);
+    }
+    EXPECT_EQ(nullptr, tree.find(0x1000));
+}
+
+TEST(IntervalTreeTest, givenNestedAndDisjointRangesWhenQueryingOverlapsThenOverlappingRangesAreVisitedInAscendingOrder) {
+    IntervalTree<int> tree;
+    tree.insert(0x1000, 0x9000, 0);
+    tree.insert(0x2000, 0x3000, 1);
+    tree.insert(0x4000, 0x5000, 2);
+    tree.insert(0xA000, 0xB000, 3);
+
+    std::vector<int> visited;
+    auto collect = [&visited](uintptr_t, uintptr_t, int &value) {
+        visited.push_back(value);
+        return false;
+    };
+
+    EXPECT_FALSE(tree.forEachOverlapping(0x2800, 0x4001, collect));
+    EXPECT_EQ((std::vector<int>{0, 1, 2}), visited);
+
+    visited.clear();
+    tree.forEachOverlapping(0x9000, 0xA000, collect);
+    EXPECT_TRUE(visited.empty());
+
+    visited.clear();
+    tree.forEachOverlapping(0x8FFF, 0xA001, collect);
+    EXPECT_EQ((std::vector<int>{0, 3}), visited);
+
+    uintptr_t firstStart = 0u;
+    EXPECT_TRUE(tree.forEachOverlapping(0x4800, 0xA800, [&firstStart](uintptr_t start, uintptr_t, int &) {
+        firstStart = start;
+        return true;
+    }));
+    EXPECT_EQ(0x1000u, firstStart);
+}
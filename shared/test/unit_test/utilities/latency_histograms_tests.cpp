@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/latency_histograms.h"
+
+#include "gtest/gtest.h"
+
+#include <limits>
+#include <thread>
+
+using namespace NEO;
+
+TEST(LatencyHistogramsTest, givenDefaultSettingsWhenGettingHistogramsThenNothingIsCreated) {
+    EXPECT_EQ(nullptr, LatencyHistograms::get());
+}
+
+TEST(LatencyHistogramsTest, givenValuesWhenGettingBucketThenBucketBoundsAreWithinSubBucketPrecision) {
+    for (uint64_t value : {0ull, 1ull, 7ull, 8ull, 9ull, 100ull, 1000ull, 123456789ull, 1ull << 40}) {
+        auto bucket = LatencyHistograms::getBucket(value);
+        auto upperBound = LatencyHistograms::getBucketUpperBound(bucket);
+        EXPECT_GT(upperBound, value);
+        EXPECT_LE(upperBound - value, std::max(value / LatencyHistograms::subBucketsCount, uint64_t{1u}));
+    }
+    EXPECT_EQ(LatencyHistograms::bucketsCount - 1, LatencyHistograms::getBucket(std::numeric_limits<uint64_t>::max()));
+}
+
+TEST(LatencyHistogramsTest, givenSameNameWhenRegisteringEntryThenSameIdIsReturned) {
+    auto entryId = LatencyHistograms::registerEntry("latencyTestEntry");
+    EXPECT_EQ(entryId, LatencyHistograms::registerEntry("latencyTestEntry"));
+    EXPECT_NE(entryId, LatencyHistograms::registerEntry("otherLatencyTestEntry"));
+}
+
+TEST(LatencyHistogramsTest, givenLatenciesRecordedOnMultipleThreadsWhenGettingSummaryThenHistogramsAreMerged) {
+    LatencyHistograms histograms("");
+    auto entryId = LatencyHistograms::registerEntry("mergedLatencyTestEntry");
+
+    std::thread worker([&]() {
+        for (uint32_t i = 0; i < 99; i++) {
+            histograms.record(entryId, 100u);
+        }
+    });
+    worker.join();
+    histograms.record(entryId, 10000u);
+
+    LatencyHistograms::Summary summary;
+    ASSERT_TRUE(histograms.getSummary("mergedLatencyTestEntry", summary));
+    EXPECT_EQ(100u, summary.count);
+    EXPECT_EQ(99u * 100u + 10000u, summary.sumNs);
+    EXPECT_EQ(LatencyHistograms::getBucketUpperBound(LatencyHistograms::getBucket(100u)), summary.p50Ns);
+    EXPECT_EQ(LatencyHistograms::getBucketUpperBound(LatencyHistograms::getBucket(100u)), summary.p99Ns);
+    EXPECT_EQ(LatencyHistograms::getBucketUpperBound(LatencyHistograms::getBucket(10000u)), summary.maxNs);
+
+    EXPECT_FALSE(histograms.getSummary("notRegisteredLatencyTestEntry", summary));
+}
+
+TEST(LatencyHistogramsTest, givenRecordedLatenciesWhenGettingPrometheusReportThenCumulativeBucketsSumAndCountAreReported) {
+    LatencyHistograms histograms("");
+    auto entryId = LatencyHistograms::registerEntry("reportedLatencyTestEntry");
+    histograms.record(entryId, 100u);
+    histograms.record(entryId, 100u);
+    histograms.record(entryId, 1000u);
+
+    auto report = histograms.getPrometheusReport();
+    EXPECT_NE(std::string::npos, report.find("# TYPE neo_latency_ns histogram"));
+    EXPECT_NE(std::string::npos, report.find("neo_latency_ns_bucket{entry=\"reportedLatencyTestEntry\",le=\"104\"} 2"));
+    EXPECT_NE(std::string::npos, report.find("neo_latency_ns_bucket{entry=\"reportedLatencyTestEntry\",le=\"1024\"} 3"));
+    EXPECT_NE(std::string::npos, report.find("neo_latency_ns_bucket{entry=\"reportedLatencyTestEntry\",le=\"+Inf\"} 3"));
+    EXPECT_NE(std::string::npos, report.find("neo_latency_ns_sum{entry=\"reportedLatencyTestEntry\"} 1200"));
+    EXPECT_NE(std::string::npos, report.find("neo_latency_ns_count{entry=\"reportedLatencyTestEntry\"} 3"));
+    EXPECT_EQ(std::string::npos, report.find("mergedLatencyTestEntry"));
+}
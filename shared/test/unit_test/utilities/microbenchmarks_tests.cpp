@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device_binary_format/ar/ar_decoder.h"
+#include "shared/source/device_binary_format/ar/ar_encoder.h"
+#include "shared/source/device_binary_format/elf/elf_decoder.h"
+#include "shared/source/device_binary_format/elf/elf_encoder.h"
+#include "shared/source/device_binary_format/yaml/yaml_parser.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/utilities/heap_allocator.h"
+#include "shared/source/utilities/idlist.h"
+#include "shared/source/utilities/iflist.h"
+#include "shared/source/utilities/lookup_array.h"
+#include "shared/source/utilities/stackvec.h"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace NEO;
+
+// Microbenchmarks of shared utilities, disabled by default. Run with
+// --gtest_also_run_disabled_tests --gtest_filter=*Microbenchmark* --gtest_output=xml:<file>
+// to get average time per operation of each benchmark and element count as a test property.
+class Microbenchmark : public ::testing::TestWithParam<size_t> {
+  public:
+    static constexpr uint32_t iterationsCount = 1000u;
+
+    template <typename FunctorT>
+    void measure(FunctorT &&functor) {
+        functor();
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterationsCount; i++) {
+            checksum += functor();
+        }
+        auto end = std::chrono::steady_clock::now();
+
+        auto nsPerIteration = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count() / iterationsCount;
+        auto testInfo = ::testing::UnitTest::GetInstance()->current_test_info();
+        RecordProperty("nsPerIteration", std::to_string(nsPerIteration));
+        printf("%s/%s: %lld ns per iteration\n", testInfo->test_suite_name(), testInfo->name(), static_cast<long long>(nsPerIteration));
+        EXPECT_NE(0u, checksum);
+    }
+
+    uint64_t checksum = 0u;
+};
+
+INSTANTIATE_TEST_CASE_P(ElementsCount, Microbenchmark, ::testing::Values(4u, 16u, 64u, 1024u));
+
+TEST_P(Microbenchmark, DISABLED_stackVecPushBackWithinAndBeyondStackCapacity) {
+    auto elementsCount = GetParam();
+    measure([elementsCount]() {
+        StackVec<uint64_t, 16> vec;
+        for (size_t i = 0; i < elementsCount; i++) {
+            vec.push_back(i);
+        }
+        return static_cast<uint64_t>(vec.size());
+    });
+}
+
+TEST_P(Microbenchmark, DISABLED_idListPushTailAndDetach) {
+    struct Node : IDNode<Node> {};
+    std::vector<Node> nodes(GetParam());
+    measure([&nodes]() {
+        IDList<Node, false, false> list;
+        for (auto &node : nodes) {
+            list.pushTailOne(node);
+        }
+        auto head = list.detachNodes();
+        return static_cast<uint64_t>(head != nullptr);
+    });
+}
+
+TEST_P(Microbenchmark, DISABLED_ifListPushFrontAndDetach) {
+    struct Node : IFNode<Node> {};
+    std::vector<Node> nodes(GetParam());
+    measure([&nodes]() {
+        IFList<Node, true, false> list;
+        for (auto &node : nodes) {
+            list.pushFrontOne(node);
+        }
+        auto head = list.detachNodes();
+        return static_cast<uint64_t>(head != nullptr);
+    });
+}
+
+TEST_P(Microbenchmark, DISABLED_heapAllocatorAllocateAndFreeMixedSizes) {
+    auto elementsCount = GetParam();
+    std::vector<std::pair<uint64_t, size_t>> allocations;
+    allocations.reserve(elementsCount);
+    measure([elementsCount, &allocations]() {
+        HeapAllocator allocator(0x100000000ull, 64 * MemoryConstants::gigaByte);
+        for (size_t i = 0; i < elementsCount; i++) {
+            size_t size = MemoryConstants::pageSize << (i % 12);
+            auto address = allocator.allocate(size);
+            allocations.emplace_back(address, size);
+        }
+        for (size_t i = 0; i < allocations.size(); i += 2) {
+            allocator.free(allocations[i].first, allocations[i].second);
+        }
+        for (size_t i = 0; i < allocations.size(); i += 2) {
+            allocations[i].first = allocator.allocate(allocations[i].second);
+        }
+        auto usedSize = allocator.getUsedSize();
+        for (auto &allocation : allocations) {
+            allocator.free(allocation.first, allocation.second);
+        }
+        allocations.clear();
+        return usedSize;
+    });
+}
+
+TEST_P(Microbenchmark, DISABLED_lookupArrayFindLastKey) {
+    constexpr LookupArray<uint32_t, uint32_t, 8> lookupArray({{{0, 1}, {1, 2}, {2, 3}, {3, 4}, {4, 5}, {5, 6}, {6, 7}, {7, 8}}});
+    auto elementsCount = GetParam();
+    measure([elementsCount, &lookupArray]() {
+        uint64_t sum = 0u;
+        for (size_t i = 0; i < elementsCount; i++) {
+            sum += lookupArray.lookUp(static_cast<uint32_t>(7 - (i % 2)));
+        }
+        return sum;
+    });
+}
+
+TEST_P(Microbenchmark, DISABLED_yamlParserParseKernelsMetadata) {
+    std::string yaml = "version : '1.0'\nkernels :\n";
+    for (size_t i = 0; i < GetParam(); i++) {
+        yaml += "  - name : kernel_" + std::to_string(i) + "\n";
+        yaml += "    execution_env :\n";
+        yaml += "      grf_count : 128\n";
+        yaml += "      simd_size : 32\n";
+        yaml += "    payload_arguments :\n";
+        yaml += "      - arg_type : global_id_offset\n";
+        yaml += "        offset : 0\n";
+        yaml += "        size : 12\n";
+        yaml += "      - arg_type : arg_bypointer\n";
+        yaml += "        offset : 32\n";
+        yaml += "        size : 8\n";
+        yaml += "        arg_index : 0\n";
+        yaml += "        addrmode : stateless\n";
+        yaml += "        addrspace : global\n";
+        yaml += "        access_type : readwrite\n";
+    }
+    measure([&yaml]() {
+        Yaml::YamlParser parser;
+        std::string errors;
+        std::string warnings;
+        auto success = parser.parse(yaml, errors, warnings);
+        return static_cast<uint64_t>(success);
+    });
+}
+
+TEST_P(Microbenchmark, DISABLED_elfDecoderDecodeSections) {
+    std::vector<uint8_t> sectionData(MemoryConstants::pageSize, 0xcd);
+    Elf::ElfEncoder<Elf::EI_CLASS_64> elfEncoder;
+    for (size_t i = 0; i < GetParam(); i++) {
+        elfEncoder.appendSection(Elf::SHT_PROGBITS, ".text.kernel_" + std::to_string(i), sectionData);
+    }
+    auto elfBinary = elfEncoder.encode();
+    measure([&elfBinary]() {
+        std::string errors;
+        std::string warnings;
+        auto elf = Elf::decodeElf<Elf::EI_CLASS_64>(elfBinary, errors, warnings);
+        return static_cast<uint64_t>(elf.sectionHeaders.size());
+    });
+}
+
+TEST_P(Microbenchmark, DISABLED_arDecoderDecodeFileEntries) {
+    std::vector<uint8_t> fileData(MemoryConstants::pageSize, 0xcd);
+    Ar::ArEncoder arEncoder(true);
+    for (size_t i = 0; i < GetParam(); i++) {
+        arEncoder.appendFileEntry("file_" + std::to_string(i), fileData);
+    }
+    auto arBinary = arEncoder.encode();
+    measure([&arBinary]() {
+        std::string errors;
+        std::string warnings;
+        auto ar = Ar::decodeAr(arBinary, errors, warnings);
+        return static_cast<uint64_t>(ar.files.size());
+    });
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/performance_hints_log.h"
+
+#include "gtest/gtest.h"
+
+#include <thread>
+
+using namespace NEO;
+
+TEST(PerformanceHintsLogTest, givenDefaultSettingsWhenGettingLogThenNothingIsCreated) {
+    EXPECT_EQ(nullptr, PerformanceHintsLog::get());
+}
+
+TEST(PerformanceHintsLogTest, givenSameCallSiteWhenRegisteringThenSameIdIsReturned) {
+    auto callSiteId = PerformanceHintsLog::registerCallSite("performanceHintsTestCallSite:1");
+    EXPECT_EQ(callSiteId, PerformanceHintsLog::registerCallSite("performanceHintsTestCallSite:1"));
+    EXPECT_NE(callSiteId, PerformanceHintsLog::registerCallSite("performanceHintsTestCallSite:2"));
+}
+
+TEST(PerformanceHintsLogTest, givenHintsRecordedAboveLimitWhenGettingRecordsThenOnlyFirstHintsPerCallSiteAreReturnedWithAllOccurrences) {
+    PerformanceHintsLog log(2u);
+    auto copyCallSiteId = PerformanceHintsLog::registerCallSite("performanceHintsTestCopy:1");
+    auto mapCallSiteId = PerformanceHintsLog::registerCallSite("performanceHintsTestMap:1");
+
+    std::thread worker([&]() {
+        for (uint64_t i = 0; i < 5; i++) {
+            log.record(copyCallSiteId, PerformanceHintId::UnalignedCopy, {0x1001u, 0x2000u, i});
+        }
+    });
+    worker.join();
+    log.record(mapCallSiteId, PerformanceHintId::NonZeroCopyMap, {4096u, 64u});
+
+    auto records = log.getRecords();
+    ASSERT_EQ(3u, records.size());
+    EXPECT_EQ(5u, log.getOccurrences(copyCallSiteId));
+
+    EXPECT_EQ(PerformanceHintId::UnalignedCopy, records[0].hintId);
+    EXPECT_STREQ("performanceHintsTestCopy:1", records[0].callSite);
+    EXPECT_EQ(0x1001u, records[0].params[0]);
+    EXPECT_EQ(0u, records[0].params[2]);
+    EXPECT_EQ(5u, records[0].occurrences);
+    EXPECT_EQ(1u, records[1].params[2]);
+    EXPECT_EQ(5u, records[1].occurrences);
+
+    EXPECT_EQ(PerformanceHintId::NonZeroCopyMap, records[2].hintId);
+    EXPECT_EQ(mapCallSiteId, records[2].callSiteId);
+    EXPECT_EQ(4096u, records[2].params[0]);
+    EXPECT_EQ(0u, records[2].params[3]);
+    EXPECT_EQ(1u, records[2].occurrences);
+}
+
+TEST(PerformanceHintsLogTest, givenInvalidCallSiteWhenRecordingHintThenHintIsIgnored) {
+    PerformanceHintsLog log(1u);
+    log.record(PerformanceHintsLog::maxCallSitesCount, PerformanceHintId::CompilerCacheMiss, {1u});
+    EXPECT_TRUE(log.getRecords().empty());
+    EXPECT_EQ(0u, log.getOccurrences(PerformanceHintsLog::maxCallSitesCount));
+}
@@ -439,6 +439,37 @@ TEST_F(TagAllocatorTest, givenEmptyFreeListWhenAskingForNewTagThenTryToReleaseDe
     EXPECT_TRUE(tagAllocator.freeTags.peekIsEmpty()); // empty again - new pool wasnt allocated
 }
 
+TEST_F(TagAllocatorTest, givenBatchedTimestampPacketReturnEnabledWhenContainerIsReleasedThenAllNodesAreReturnedToFreeList) {
+    DebugManagerStateRestore restorer;
+    DebugManager.flags.EnableBatchedTimestampPacketReturn.set(1);
+
+    MockTagAllocator<TimestampPackets<uint32_t>> tagAllocator(memoryManager, 10, 64, deviceBitfield);
+    IDList<TagNode<TimestampPackets<uint32_t>>> &freeList = tagAllocator.freeTags;
+    IDList<TagNode<TimestampPackets<uint32_t>>> &usedList = tagAllocator.usedTags;
+
+    TagNodeBase *sharedNode = nullptr;
+    StackVec<TagNodeBase *, 3> nodes;
+    {
+        TimestampPacketContainer container;
+        for (int i = 0; i < 3; i++) {
+            nodes.push_back(tagAllocator.getTag());
+            container.add(nodes.back());
+        }
+        sharedNode = nodes[1];
+        sharedNode->incRefCount();
+    }
+
+    EXPECT_TRUE(freeList.peekContains(*static_cast<TagNode<TimestampPackets<uint32_t>> *>(nodes[0])));
+    EXPECT_TRUE(freeList.peekContains(*static_cast<TagNode<TimestampPackets<uint32_t>> *>(nodes[2])));
+    EXPECT_TRUE(usedList.peekContains(*static_cast<TagNode<TimestampPackets<uint32_t>> *>(sharedNode)));
+    EXPECT_FALSE(freeList.peekContains(*static_cast<TagNode<TimestampPackets<uint32_t>> *>(sharedNode)));
+
+    TagNodeBase *const lastReference[] = {sharedNode};
+    tagAllocator.returnTags(ArrayRef<TagNodeBase *const>(lastReference));
+    EXPECT_TRUE(freeList.peekContains(*static_cast<TagNode<TimestampPackets<uint32_t>> *>(sharedNode)));
+    EXPECT_TRUE(usedList.peekIsEmpty());
+}
+
 TEST_F(TagAllocatorTest, givenTagAllocatorWhenGraphicsAllocationIsCreatedThenSetValidllocationType) {
     MockTagAllocator<TimestampPackets<uint32_t>> timestampPacketAllocator(mockRootDeviceIndex, memoryManager, 1, 1, sizeof(TimestampPackets<uint32_t>), false, mockDeviceBitfield);
     MockTagAllocator<HwTimeStamps> hwTimeStampsAllocator(mockRootDeviceIndex, memoryManager, 1, 1, sizeof(HwTimeStamps), false, mockDeviceBitfield);
@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2022 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/file_io.h"
+#include "shared/source/utilities/trace_points.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/variable_backup.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <thread>
+
+using namespace NEO;
+
+namespace {
+size_t countRecords(TracePoints::Id id, uint64_t arg0) {
+    auto records = TracePoints::getRecords();
+    return static_cast<size_t>(std::count_if(records.begin(), records.end(), [&](const TracePoints::Record &record) {
+        return record.id == static_cast<uint16_t>(id) && record.arg0 == arg0;
+    }));
+}
+} // namespace
+
+TEST(TracePointsTest, givenDefaultSettingsWhenInitializingThenRecordingIsDisabled) {
+    VariableBackup<bool> enabledBackup(&TracePoints::enabled, true);
+    TracePoints::init();
+    EXPECT_FALSE(TracePoints::enabled);
+}
+
+TEST(TracePointsTest, givenRecordingDisabledWhenTracePointIsHitThenNoRecordIsEmitted) {
+    VariableBackup<bool> enabledBackup(&TracePoints::enabled, false);
+    TRACE_POINT(FlushTask, 0x1001u, 1u);
+    EXPECT_EQ(0u, countRecords(TracePoints::Id::FlushTask, 0x1001u));
+}
+
+TEST(TracePointsTest, givenRecordingEnabledWhenTracePointsAreHitOnMultipleThreadsThenRecordsAreEmittedToPerThreadRings) {
+    DebugManagerStateRestore restore;
+    DebugManager.flags.EnableTracePoints.set(1);
+    VariableBackup<bool> enabledBackup(&TracePoints::enabled);
+    TracePoints::init();
+    EXPECT_TRUE(TracePoints::enabled);
+
+    TRACE_POINT(WaitForTaskCount, 0x2002u, 2u);
+    std::thread worker([]() {
+        TRACE_POINT(WaitForTaskCount, 0x2002u, 3u);
+    });
+    worker.join();
+
+    auto records = TracePoints::getRecords();
+    std::vector<TracePoints::Record> emitted;
+    std::copy_if(records.begin(), records.end(), std::back_inserter(emitted), [](const TracePoints::Record &record) {
+        return record.id == static_cast<uint16_t>(TracePoints::Id::WaitForTaskCount) && record.arg0 == 0x2002u;
+    });
+    ASSERT_EQ(2u, emitted.size());
+    EXPECT_NE(emitted[0].threadId, emitted[1].threadId);
+    EXPECT_EQ(5u, emitted[0].arg1 + emitted[1].arg1);
+}
+
+TEST(TracePointsTest, givenMoreRecordsThanRingSizeWhenGettingRecordsThenOnlyNewestRecordsAreKept) {
+    VariableBackup<bool> enabledBackup(&TracePoints::enabled, true);
+    std::thread worker([]() {
+        for (uint64_t i = 0; i < TracePoints::ringSize + 10; i++) {
+            TRACE_POINT(MakeResident, 0x3003u, i);
+        }
+    });
+    worker.join();
+
+    auto records = TracePoints::getRecords();
+    std::vector<uint64_t> emittedArgs;
+    for (auto &record : records) {
+        if (record.id == static_cast<uint16_t>(TracePoints::Id::MakeResident) && record.arg0 == 0x3003u) {
+            emittedArgs.push_back(record.arg1);
+        }
+    }
+    ASSERT_EQ(TracePoints::ringSize, emittedArgs.size());
+    EXPECT_EQ(10u, emittedArgs.front());
+    EXPECT_EQ(TracePoints::ringSize + 9, emittedArgs.back());
+}
+
+TEST(TracePointsTest, givenEmittedRecordsWhenDumpingThenBinaryFileWithHeaderAndRecordsIsWritten) {
+    VariableBackup<bool> enabledBackup(&TracePoints::enabled, true);
+    TRACE_POINT(AppendLaunchKernel, 0x4004u, 4u);
+
+    const char *fileName = "trace_points_dump.bin";
+    ASSERT_TRUE(TracePoints::dump(fileName));
+    size_t dataSize = 0;
+    auto data = loadDataFromFile(fileName, dataSize);
+    std::remove(fileName);
+
+    ASSERT_GE(dataSize, sizeof(TracePoints::DumpHeader));
+    auto header = reinterpret_cast<const TracePoints::DumpHeader *>(data.get());
+    EXPECT_EQ(TracePoints::dumpMagic, header->magic);
+    EXPECT_EQ(TracePoints::dumpVersion, header->version);
+    EXPECT_EQ(sizeof(TracePoints::Record), header->recordSize);
+    EXPECT_EQ(sizeof(TracePoints::DumpHeader) + header->recordsCount * sizeof(TracePoints::Record), dataSize);
+
+    auto records = reinterpret_cast<const TracePoints::Record *>(data.get() + sizeof(TracePoints::DumpHeader));
+    EXPECT_TRUE(std::any_of(records, records + header->recordsCount, [](const TracePoints::Record &record) {
+        return record.id == static_cast<uint16_t>(TracePoints::Id::AppendLaunchKernel) && record.arg0 == 0x4004u && record.arg1 == 4u;
+    }));
+}
@@ -16,6 +16,11 @@ using namespace NEO;
 
 namespace CpuIntrinsicsTests {
 extern std::atomic<uint32_t> pauseCounter;
+extern std::atomic<uintptr_t> lastUmonitorPtr;
+extern std::atomic<uint32_t> umonitorCounter;
+extern std::atomic<uint32_t> umwaitCounter;
+extern std::atomic<uint64_t> lastUmwaitCounterValue;
+extern uint64_t rdtscRetValue;
 } // namespace CpuIntrinsicsTests
 
 TEST(WaitTest, givenDefaultSettingsWhenNoPollAddressProvidedThenPauseDefaultTimeAndReturnFalse) {
@@ -90,3 +95,135 @@ TEST(WaitTest, givenDebugFlagSetZeroWhenPollAddressProvidedMeetsCriteriaThenPaus
     EXPECT_TRUE(ret);
     EXPECT_EQ(oldCount + WaitUtils::waitCount, CpuIntrinsicsTests::pauseCounter);
 }
+
+TEST(WaitTest, givenYieldCpuDisabledWhenPollAddressDoesNotMeetCriteriaThenPauseAndReturnFalse) {
+    WaitUtils::init();
+    volatile uint32_t pollValue = 1u;
+    uint32_t expectedValue = 3;
+
+    uint32_t oldCount = CpuIntrinsicsTests::pauseCounter.load();
+    bool ret = WaitUtils::waitFunction(&pollValue, expectedValue, false);
+    EXPECT_FALSE(ret);
+    EXPECT_EQ(oldCount + WaitUtils::waitCount, CpuIntrinsicsTests::pauseCounter);
+}
+
+TEST(AdaptiveWaitPolicyTest, givenDefaultSettingsWhenInitializingThenAdaptiveWaitIsDisabledAndSpinTimeIsZero) {
+    WaitUtils::init();
+    EXPECT_FALSE(WaitUtils::adaptiveWaitEnabled);
+    EXPECT_EQ(WaitUtils::defaultAdaptiveWaitMaxSpinTime, WaitUtils::adaptiveWaitMaxSpinTime);
+
+    WaitUtils::AdaptiveWaitPolicy policy;
+    EXPECT_EQ(0, policy.getSpinTime());
+}
+
+TEST(AdaptiveWaitPolicyTest, givenDebugFlagsSetWhenInitializingThenAdaptiveWaitSettingsAreOverridden) {
+    DebugManagerStateRestore restore;
+    VariableBackup<bool> backupAdaptiveWaitEnabled(&WaitUtils::adaptiveWaitEnabled);
+    VariableBackup<int64_t> backupMaxSpinTime(&WaitUtils::adaptiveWaitMaxSpinTime);
+
+    DebugManager.flags.EnableAdaptiveWaitPolicy.set(1);
+    DebugManager.flags.AdaptiveWaitMaxSpinTime.set(100);
+    WaitUtils::init();
+
+    EXPECT_TRUE(WaitUtils::adaptiveWaitEnabled);
+    EXPECT_EQ(100, WaitUtils::adaptiveWaitMaxSpinTime);
+}
+
+TEST(AdaptiveWaitPolicyTest, givenAdaptiveWaitEnabledWhenNoWaitsRecordedThenMaxSpinTimeIsReturned) {
+    VariableBackup<bool> backupAdaptiveWaitEnabled(&WaitUtils::adaptiveWaitEnabled, true);
+    VariableBackup<int64_t> backupMaxSpinTime(&WaitUtils::adaptiveWaitMaxSpinTime, 50);
+
+    WaitUtils::AdaptiveWaitPolicy policy;
+    EXPECT_EQ(50, policy.getSpinTime());
+}
+
+TEST(AdaptiveWaitPolicyTest, givenShortWaitsRecordedWhenGettingSpinTimeThenTwiceAverageWaitTimeIsReturned) {
+    VariableBackup<bool> backupAdaptiveWaitEnabled(&WaitUtils::adaptiveWaitEnabled, true);
+    VariableBackup<int64_t> backupMaxSpinTime(&WaitUtils::adaptiveWaitMaxSpinTime, 50);
+
+    WaitUtils::AdaptiveWaitPolicy policy;
+    policy.recordWaitTime(10);
+    EXPECT_EQ(10, policy.getAverageWaitTime());
+    EXPECT_EQ(20, policy.getSpinTime());
+
+    policy.recordWaitTime(18);
+    EXPECT_EQ(11, policy.getAverageWaitTime());
+    EXPECT_EQ(22, policy.getSpinTime());
+
+    policy.recordWaitTime(42);
+    EXPECT_EQ(14, policy.getAverageWaitTime());
+    EXPECT_EQ(28, policy.getSpinTime());
+}
+
+TEST(AdaptiveWaitPolicyTest, givenLongWaitsRecordedWhenGettingSpinTimeThenZeroIsReturned) {
+    VariableBackup<bool> backupAdaptiveWaitEnabled(&WaitUtils::adaptiveWaitEnabled, true);
+    VariableBackup<int64_t> backupMaxSpinTime(&WaitUtils::adaptiveWaitMaxSpinTime, 50);
+
+    WaitUtils::AdaptiveWaitPolicy policy;
+    policy.recordWaitTime(40);
+    EXPECT_EQ(50, policy.getSpinTime());
+
+    policy.recordWaitTime(1000);
+    EXPECT_LT(50, policy.getAverageWaitTime());
+    EXPECT_EQ(0, policy.getSpinTime());
+}
+
+TEST(WaitpkgTest, givenDefaultSettingsWhenInitializingThenWaitpkgIsDisabled) {
+    WaitUtils::init();
+    EXPECT_FALSE(WaitUtils::waitpkgEnabled);
+    EXPECT_EQ(WaitUtils::defaultWaitpkgCounterValue, WaitUtils::waitpkgCounterValue);
+}
+
+TEST(WaitpkgTest, givenWaitpkgCounterValueDebugFlagSetWhenInitializingThenCounterValueIsOverridden) {
+    DebugManagerStateRestore restore;
+    VariableBackup<uint64_t> backupCounterValue(&WaitUtils::waitpkgCounterValue);
+
+    DebugManager.flags.WaitpkgCounterValue.set(1000);
+    WaitUtils::init();
+    EXPECT_EQ(1000u, WaitUtils::waitpkgCounterValue);
+}
+
+TEST(WaitpkgTest, givenWaitpkgEnabledWhenPollAddressDoesNotMeetCriteriaThenMonitorAndWaitInsteadOfPause) {
+    VariableBackup<bool> backupWaitpkgEnabled(&WaitUtils::waitpkgEnabled, true);
+    VariableBackup<uint64_t> backupCounterValue(&WaitUtils::waitpkgCounterValue, 100u);
+    VariableBackup<uint64_t> backupRdtsc(&CpuIntrinsicsTests::rdtscRetValue, 5000u);
+
+    volatile uint32_t pollValue = 1u;
+    uint32_t expectedValue = 3;
+
+    uint32_t oldPauseCount = CpuIntrinsicsTests::pauseCounter.load();
+    uint32_t oldUmonitorCount = CpuIntrinsicsTests::umonitorCounter.load();
+    uint32_t oldUmwaitCount = CpuIntrinsicsTests::umwaitCounter.load();
+    bool ret = WaitUtils::waitFunction(&pollValue, expectedValue);
+    EXPECT_FALSE(ret);
+    EXPECT_EQ(oldPauseCount, CpuIntrinsicsTests::pauseCounter);
+    EXPECT_EQ(oldUmonitorCount + 1, CpuIntrinsicsTests::umonitorCounter);
+    EXPECT_EQ(oldUmwaitCount + 1, CpuIntrinsicsTests::umwaitCounter);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(&pollValue), CpuIntrinsicsTests::lastUmonitorPtr);
+    EXPECT_EQ(5100u, CpuIntrinsicsTests::lastUmwaitCounterValue);
+}
+
+TEST(WaitpkgTest, givenWaitpkgEnabledWhenPollAddressMeetsCriteriaThenReturnTrueWithoutWaiting) {
+    VariableBackup<bool> backupWaitpkgEnabled(&WaitUtils::waitpkgEnabled, true);
+
+    volatile uint32_t pollValue = 3u;
+    uint32_t expectedValue = 1;
+
+    uint32_t oldUmonitorCount = CpuIntrinsicsTests::umonitorCounter.load();
+    uint32_t oldUmwaitCount = CpuIntrinsicsTests::umwaitCounter.load();
+    bool ret = WaitUtils::waitFunction(&pollValue, expectedValue);
+    EXPECT_TRUE(ret);
+    EXPECT_EQ(oldUmonitorCount + 1, CpuIntrinsicsTests::umonitorCounter);
+    EXPECT_EQ(oldUmwaitCount, CpuIntrinsicsTests::umwaitCounter);
+}
+
+TEST(WaitpkgTest, givenWaitpkgEnabledWhenNoPollAddressProvidedThenPauseIsUsed) {
+    VariableBackup<bool> backupWaitpkgEnabled(&WaitUtils::waitpkgEnabled, true);
+
+    uint32_t oldPauseCount = CpuIntrinsicsTests::pauseCounter.load();
+    uint32_t oldUmwaitCount = CpuIntrinsicsTests::umwaitCounter.load();
+    bool ret = WaitUtils::waitFunction(nullptr, 0u);
+    EXPECT_FALSE(ret);
+    EXPECT_EQ(oldPauseCount + WaitUtils::waitCount, CpuIntrinsicsTests::pauseCounter);
+    EXPECT_EQ(oldUmwaitCount, CpuIntrinsicsTests::umwaitCounter);
+}